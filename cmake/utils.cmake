@@ -62,3 +62,49 @@ function(clean_cmake_files directory)
 		endif()
 	endforeach(file)
 endfunction()
+
+# Generate a C++ include file with names of passes from 'input' that contains
+# one pass per line (e.g. '-decoder'). Empty lines and comments ('#') are
+# skipped and the leading dash is removed. A line '@file' is replaced with
+# passes from 'file' in the directory of 'input'. Every pass becomes a string
+# literal followed by a comma, so the file can be included into an
+# initializer list. The output file is rewritten only if its content changes.
+# Usage example:
+#     generate_pass_list(
+#         ${PROJECT_SOURCE_DIR}/scripts/retdec-bin2llvmir-passes.txt
+#         ${CMAKE_CURRENT_BINARY_DIR}/include/bin2llvmir_passes.inc
+#     )
+function(generate_pass_list input output)
+	read_pass_list(${input} passes)
+
+	set(content "// Generated from ${input}, do not edit.\n")
+	foreach(pass ${passes})
+		set(content "${content}\"${pass}\",\n")
+	endforeach()
+
+	file(WRITE ${output}.tmp "${content}")
+	configure_file(${output}.tmp ${output} COPYONLY)
+endfunction()
+
+# Read names of passes (without the leading dash) from 'input' into 'var'.
+# See generate_pass_list() for the format of the file.
+function(read_pass_list input var)
+	set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${input})
+	get_filename_component(dir ${input} DIRECTORY)
+
+	set(passes "")
+	file(STRINGS ${input} lines REGEX "^[ \t]*[-@]")
+	foreach(line ${lines})
+		string(STRIP "${line}" line)
+		string(SUBSTRING "${line}" 0 1 kind)
+		string(SUBSTRING "${line}" 1 -1 name)
+		if(kind STREQUAL "@")
+			read_pass_list(${dir}/${name} included)
+			list(APPEND passes ${included})
+		else()
+			list(APPEND passes ${name})
+		endif()
+	endforeach()
+
+	set(${var} ${passes} PARENT_SCOPE)
+endfunction()
@@ -3,9 +3,8 @@
 * @brief Reaching definitions analysis (RDA) builds UD and DU chains.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 *
-* Right now, this works on an entire module. But we could insert an another layer
-* that represents functions. Then it would be possible to associate BBs with
-* functions that own them and recompute RDA only for the selected function.
+* RDA of a module is computed for each function separately. Functions are
+* independent, so they are analyzed in parallel.
 */
 
 #ifndef RETDEC_BIN2LLVMIR_ANALYSES_REACHING_DEFINITIONS_H
@@ -108,7 +107,7 @@ class BasicBlockEntry
 
 	private:
 		unsigned id;
-	    static int newUID;
+	    static thread_local int newUID;
 };
 
 class ReachingDefinitionsAnalysis
@@ -146,18 +145,23 @@ class ReachingDefinitionsAnalysis
 				llvm::Instruction* I);
 
 	private:
-		void run();
+		using BasicBlockEntries = std::map<const llvm::BasicBlock*, BasicBlockEntry>;
+
+		void run(llvm::Function& F, BasicBlockEntries& bbs) const;
 		const BasicBlockEntry& getBasicBlockEntry(const llvm::Instruction* I) const;
-		void initializeBasicBlocks(llvm::Module& M);
-		void initializeBasicBlocks(llvm::Function& F);
-		void initializeBasicBlocksPrev();
-		void initializeKillGenSets();
-		void propagate();
-		void initializeDefsAndUses();
-		void clearInternal();
+		void initializeBasicBlocks(
+				llvm::Function& F,
+				BasicBlockEntries& bbs) const;
+		static void initializeBasicBlocksPrev(BasicBlockEntries& bbs);
+		static void initializeKillGenSets(BasicBlockEntries& bbs);
+		static void propagate(
+				const llvm::Function* fnc,
+				BasicBlockEntries& bbs);
+		static void initializeDefsAndUses(BasicBlockEntries& bbs);
+		static void clearInternal(BasicBlockEntries& bbs);
 
 	private:
-		std::map<const llvm::Function*, std::map<const llvm::BasicBlock*, BasicBlockEntry>> bbMap;
+		std::map<const llvm::Function*, BasicBlockEntries> bbMap;
 		bool _trackFlagRegs = false;
 		const llvm::GlobalVariable* _specialGlobal = nullptr;
 		bool _run = false;
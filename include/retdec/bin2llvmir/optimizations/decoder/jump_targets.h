@@ -87,7 +87,7 @@ class JumpTarget
 		mutable cs_mode _mode = CS_MODE_BIG_ENDIAN;
 
 	public:
-		static Config* config;
+		static thread_local Config* config;
 };
 
 /**
@@ -118,7 +118,7 @@ class JumpTargets
 		std::set<JumpTarget> _data;
 
 	public:
-		static Config* config;
+		static thread_local Config* config;
 };
 
 } // namespace bin2llvmir
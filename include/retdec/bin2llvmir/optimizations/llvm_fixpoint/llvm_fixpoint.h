@@ -0,0 +1,92 @@
+/**
+* @file include/retdec/bin2llvmir/optimizations/llvm_fixpoint/llvm_fixpoint.h
+* @brief Run LLVM optimizations on changed functions until a fixed point.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_LLVM_FIXPOINT_LLVM_FIXPOINT_H
+#define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_LLVM_FIXPOINT_LLVM_FIXPOINT_H
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <llvm/Analysis/TargetLibraryInfo.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Pass.h>
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Runs a list of LLVM passes repeatedly until nothing changes or until the
+ * maximal number of iterations is reached.
+ *
+ * The first iteration runs the passes on all functions. Every next iteration
+ * runs function passes only on functions changed by the previous one, their
+ * callers and functions using changed global variables, so analyses like
+ * dominator trees or memory dependences are not recomputed for functions
+ * which are already optimized. Module passes run in every iteration and
+ * functions they change are optimized in the rest of the iteration.
+ *
+ * It is not run in the default decompilation, which runs the list of passes
+ * twice over the whole module (see scripts/retdec-bin2llvmir-passes.txt).
+ *
+ * Consecutive function passes run in one function pass manager. Analyses from
+ * the list are not run on their own, passes request them when they need them.
+ */
+class LlvmFixpoint : public llvm::ModulePass
+{
+	public:
+		static char ID;
+		LlvmFixpoint();
+		LlvmFixpoint(
+				const std::vector<std::string>& passes,
+				unsigned maxIterations);
+		virtual void getAnalysisUsage(llvm::AnalysisUsage& AU) const override;
+		virtual bool runOnModule(llvm::Module& M) override;
+
+		unsigned getIterationCount() const;
+
+		static const std::vector<std::string>& getDefaultPasses();
+
+	private:
+		/// Consecutive passes of the same kind run by one pass manager.
+		struct Group
+		{
+			std::unique_ptr<llvm::legacy::FunctionPassManager> functionPasses;
+			std::unique_ptr<llvm::legacy::PassManager> modulePasses;
+		};
+
+		/// Fingerprints of defined functions and global variables.
+		using Fingerprints = std::map<const llvm::Value*, std::size_t>;
+
+	private:
+		bool run();
+		void createGroups();
+		void addImmutablePasses(llvm::legacy::PassManagerBase& pm) const;
+		bool runIteration(std::set<const llvm::Function*>& dirty);
+		Fingerprints getFingerprints() const;
+		bool markChanged(
+				const Fingerprints& before,
+				std::set<const llvm::Function*>& dirty) const;
+		static std::size_t getFingerprint(const llvm::Function& f);
+
+	private:
+		llvm::Module* _module = nullptr;
+		std::vector<std::string> _passes;
+		unsigned _maxIterations = 0;
+		unsigned _iterations = 0;
+		std::unique_ptr<llvm::TargetLibraryInfoImpl> _tlii;
+		std::vector<const llvm::PassInfo*> _immutablePasses;
+		std::vector<Group> _groups;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
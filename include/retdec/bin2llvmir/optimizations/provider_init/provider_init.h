@@ -7,9 +7,14 @@
 #ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_PROVIDER_INIT_PROVIDER_INIT_H
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_PROVIDER_INIT_PROVIDER_INIT_H
 
+#include <memory>
+
 #include <llvm/IR/Module.h>
 #include <llvm/Pass.h>
 
+#include "retdec/config/config.h"
+#include "retdec/fileformat/file_format/file_format.h"
+
 namespace retdec {
 namespace bin2llvmir {
 
@@ -17,9 +22,17 @@ class ProviderInitialization : public llvm::ModulePass
 {
 	public:
 		static char ID;
-		ProviderInitialization();
+		ProviderInitialization(
+				const retdec::config::Config* c = nullptr,
+				const std::shared_ptr<retdec::fileformat::FileFormat>& ff = nullptr);
 		virtual bool runOnModule(llvm::Module& m) override;
 		virtual bool doFinalization(llvm::Module& m) override;
+
+	private:
+		/// Already parsed config used instead of the one from -config-path.
+		const retdec::config::Config* _config = nullptr;
+		/// Already parsed input file used instead of the one from config.
+		std::shared_ptr<retdec::fileformat::FileFormat> _fileFormat;
 };
 
 } // namespace bin2llvmir
@@ -157,7 +157,7 @@ class EqSet
 
 	public:
 		/// Each instance gets its own unique ID for debug print purposes.
-		static unsigned newUID;
+		static thread_local unsigned newUID;
 		const unsigned id;
 
 		/// Type of an entire equivalence set.
@@ -7,6 +7,8 @@
 #ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_STACK_POINTER_OPS_STACK_POINTER_OPS_H
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_STACK_POINTER_OPS_STACK_POINTER_OPS_H
 
+#include <vector>
+
 #include <llvm/IR/Function.h>
 #include <llvm/IR/Module.h>
 #include <llvm/Pass.h>
@@ -28,6 +30,12 @@ class StackPointerOpsRemove : public llvm::ModulePass
 		bool run();
 		bool removeStackPointerStores();
 		bool removePreservationStores();
+		std::vector<llvm::Instruction*> findStackPointerStores(
+				llvm::Function& f) const;
+		static std::vector<llvm::Instruction*> findPreservationStores(
+				llvm::Function& f);
+		static bool eraseInstructions(
+				const std::vector<std::vector<llvm::Instruction*>>& toRemove);
 
 	private:
 		llvm::Module* _module = nullptr;
@@ -7,6 +7,8 @@
 #ifndef RETDEC_BIN2LLVMIR_PROVIDERS_ASM_INSTRUCTION_H
 #define RETDEC_BIN2LLVMIR_PROVIDERS_ASM_INSTRUCTION_H
 
+#include <memory>
+
 #include <capstone/capstone.h>
 #include "retdec/capstone2llvmir/arm/arm_defs.h"
 #include "retdec/capstone2llvmir/mips/mips_defs.h"
@@ -149,6 +151,9 @@ class AsmInstruction
 		static void setLlvmToAsmGlobalVariable(
 				const llvm::Module* m,
 				llvm::GlobalVariable* gv);
+		static void addLlvmToAsmInstruction(
+				llvm::StoreInst* s,
+				cs_insn* insn);
 		static retdec::utils::Address getInstructionAddress(
 				llvm::Instruction* inst);
 		static retdec::utils::Address getBasicBlockAddress(
@@ -157,24 +162,24 @@ class AsmInstruction
 				llvm::Function* f);
 		static bool isLlvmToAsmInstruction(const llvm::Value* inst);
 		static void clear();
+		static void clear(const llvm::Module* m);
+
+	public:
+		class ModuleIndex;
+		struct ModuleIndexDeleter
+		{
+			void operator()(ModuleIndex* index) const;
+		};
 
 	private:
 		const llvm::GlobalVariable* getLlvmToAsmGlobalVariablePrivate(
 				llvm::Module* m) const;
 		bool isLlvmToAsmInstructionPrivate(llvm::Value* inst) const;
-
-	private:
-		using ModuleGlobalPair = std::pair<
-				const llvm::Module*,
-				llvm::GlobalVariable*>;
-		using ModuleInstructionMap = std::pair<
-				const llvm::Module*,
-				std::map<llvm::StoreInst*, cs_insn*>>;
+		static ModuleIndex* getModuleIndex(const llvm::Module* m);
+		static ModuleIndex* findModuleIndex(const llvm::Module* m);
 
 	private:
 		llvm::StoreInst* _llvmToAsmInstr = nullptr;
-		static std::vector<ModuleGlobalPair> _module2global;
-		static std::vector<ModuleInstructionMap> _module2instMap;
 
 	public:
 		template<
@@ -24,6 +24,9 @@ class Config
 		static Config empty(llvm::Module* m);
 		static Config fromFile(llvm::Module* m, const std::string& path);
 		static Config fromJsonString(llvm::Module* m, const std::string& json);
+		static Config fromConfig(
+				llvm::Module* m,
+				const retdec::config::Config& config);
 
 		void doFinalization();
 
@@ -216,13 +219,13 @@ class ConfigProvider
 		static Config* addConfigJsonString(
 				llvm::Module* m,
 				const std::string& json);
+		static Config* addConfig(
+				llvm::Module* m,
+				const retdec::config::Config& config);
 		static Config* getConfig(llvm::Module* m);
 		static bool getConfig(llvm::Module* m, Config*& c);
 		static void doFinalization(llvm::Module* m);
 		static void clear();
-
-	private:
-		static std::map<llvm::Module*, Config> _module2config;
 };
 
 } // namespace bin2llvmir
@@ -40,11 +40,6 @@ class DemanglerProvider
 				retdec::demangler::CDemangler*& d);
 
 		static void clear();
-
-	private:
-		using Demangler = std::unique_ptr<retdec::demangler::CDemangler>;
-		/// Mapping of modules to demanglers associated with them.
-		static std::map<llvm::Module*, Demangler> _module2demangler;
 };
 
 } // namespace bin2llvmir
@@ -137,10 +137,6 @@ class FileImageProvider
 		static FileImage* addFileImage(
 				llvm::Module* m,
 				FileImage img);
-
-	private:
-		/// Mapping of modules to file images associated with them.
-		static std::map<llvm::Module*, FileImage> _module2image;
 };
 
 } // namespace bin2llvmir
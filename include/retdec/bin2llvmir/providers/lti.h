@@ -13,6 +13,7 @@
 #include "retdec/ctypes/module.h"
 #include "retdec/ctypes/type.h"
 #include "retdec/ctypes/visitor.h"
+#include "retdec/ctypesparser/binary_ctypes_parser.h"
 #include "retdec/ctypesparser/json_ctypes_parser.h"
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/fileimage.h"
@@ -89,6 +90,8 @@ class Lti
 		retdec::loader::Image* _image = nullptr;
 		std::unique_ptr<retdec::ctypes::Module> _ltiModule;
 		ctypesparser::JSONCTypesParser _ltiParser;
+		/// Precompiled LTI databases, functions are parsed from them lazily.
+		std::vector<std::unique_ptr<ctypesparser::BinaryCTypesParser>> _ltiDatabases;
 };
 
 class LtiProvider
@@ -101,9 +104,6 @@ class LtiProvider
 		static Lti* getLti(llvm::Module* m);
 		static bool getLti(llvm::Module* m, Lti*& lti);
 		static void clear();
-
-	private:
-		static std::map<llvm::Module*, Lti> _module2lti;
 };
 
 } // namespace bin2llvmir
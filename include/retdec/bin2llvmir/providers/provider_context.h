@@ -0,0 +1,80 @@
+/**
+ * @file include/retdec/bin2llvmir/providers/provider_context.h
+ * @brief Data of all providers associated with one module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_BIN2LLVMIR_PROVIDERS_PROVIDER_CONTEXT_H
+#define RETDEC_BIN2LLVMIR_PROVIDERS_PROVIDER_CONTEXT_H
+
+#include <functional>
+#include <memory>
+
+#include <llvm/IR/Module.h>
+
+#include "retdec/bin2llvmir/providers/abi/abi.h"
+#include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/debugformat.h"
+#include "retdec/bin2llvmir/providers/fileimage.h"
+#include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/demangler/demangler.h"
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Data of all providers associated with one module.
+ *
+ * Providers (@c ConfigProvider, @c AbiProvider, @c AsmInstruction, ...) are
+ * thin static wrappers which find the context of the given module and access
+ * its data. Contexts of different modules are independent, so different
+ * modules can be processed by different threads at once. One module must not
+ * be processed by more threads at once.
+ *
+ * Context can be created explicitly for a module. Then it is used until it is
+ * destroyed, and all data of providers are released together with it.
+ * Otherwise, providers create the context on its first use and it lives until
+ * the end of the process (or until @c clear()).
+ */
+class ProviderContext : private retdec::utils::NonCopyable
+{
+	public:
+		ProviderContext(const llvm::Module* m);
+		~ProviderContext();
+
+		const llvm::Module* getModule() const;
+
+		static ProviderContext* get(const llvm::Module* m);
+		static ProviderContext& getOrCreate(const llvm::Module* m);
+		static void forEach(const std::function<void(ProviderContext&)>& f);
+		static void clear();
+
+	public:
+		std::unique_ptr<Config> config;
+		std::unique_ptr<DebugFormat> debugFormat;
+		std::unique_ptr<retdec::demangler::CDemangler> demangler;
+		std::unique_ptr<FileImage> fileImage;
+		std::unique_ptr<Lti> lti;
+		std::unique_ptr<NameContainer> names;
+		std::unique_ptr<Abi> abi;
+
+		/// @name Data of AsmInstruction
+		/// @{
+		llvm::GlobalVariable* llvmToAsmGlobal = nullptr;
+		Llvm2CapstoneMap llvmToCapstone;
+		std::unique_ptr<
+				AsmInstruction::ModuleIndex,
+				AsmInstruction::ModuleIndexDeleter> asmIndex;
+		/// @}
+
+	private:
+		const llvm::Module* _module = nullptr;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
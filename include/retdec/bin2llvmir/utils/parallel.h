@@ -0,0 +1,54 @@
+/**
+ * @file include/retdec/bin2llvmir/utils/parallel.h
+ * @brief Running function-local work of passes in parallel.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_BIN2LLVMIR_UTILS_PARALLEL_H
+#define RETDEC_BIN2LLVMIR_UTILS_PARALLEL_H
+
+#include <type_traits>
+#include <vector>
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Module.h>
+
+#include "retdec/utils/thread_pool.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+retdec::utils::ThreadPool& getThreadPool();
+
+std::vector<llvm::Function*> getDefinedFunctions(llvm::Module& m);
+
+/**
+ * Run @a analyze on all functions @a fncs in parallel and return its results
+ * in the same order as @a fncs.
+ *
+ * LLVM IR is not thread-safe -- even creation of a constant modifies the
+ * shared @c LLVMContext and creation of an instruction modifies use lists of
+ * globals used by other functions. Therefore, @a analyze must not modify IR or
+ * any data shared between functions. Passes are expected to apply results to
+ * the module afterwards, one function after another in the order of @a fncs,
+ * so the output does not depend on the number of threads.
+ */
+template<typename Analysis>
+auto analyzeFunctions(
+		const std::vector<llvm::Function*>& fncs,
+		Analysis analyze)
+{
+	using Result = typename std::result_of<Analysis(llvm::Function&)>::type;
+
+	std::vector<Result> results(fncs.size());
+	getThreadPool().parallelFor(fncs.size(), [&](std::size_t i)
+	{
+		results[i] = analyze(*fncs[i]);
+	});
+	return results;
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
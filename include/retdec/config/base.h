@@ -253,10 +253,20 @@ class BaseSequentialContainer
 
 			for (auto& elem : val)
 			{
-				if ( ! elem.isNull() )
-				{
-					_data.push_back( Elem::fromJsonValue(elem) );
-				}
+				readJsonArrayElement(elem);
+			}
+		}
+
+		/**
+		 * Reads JSON object into a new element of this container.
+		 * It allows to read array of JSON objects element by element.
+		 * @param val JSON object to read.
+		 */
+		void readJsonArrayElement(const Json::Value& val)
+		{
+			if ( ! val.isNull() )
+			{
+				_data.push_back( Elem::fromJsonValue(val) );
 			}
 		}
 
@@ -315,8 +325,8 @@ class BaseAssociativeContainer
 		const_iterator end() const   { return _data.end(); }
 		size_t size() const          { return _data.size(); }
 		bool empty() const           { return _data.empty(); }
-		void clear()                 { _data.clear(); }
-		size_t erase(const ID& k)    { return _data.erase(k); }
+		virtual void clear()         { _data.clear(); }
+		virtual size_t erase(const ID& k) { return _data.erase(k); }
 
 		/**
 		 * This method behaves slightly different than std::map::insert().
@@ -371,10 +381,20 @@ class BaseAssociativeContainer
 
 			for (auto& elem : val)
 			{
-				if ( ! elem.isNull() )
-				{
-					insert( Elem::fromJsonValue(elem) );
-				}
+				readJsonArrayElement(elem);
+			}
+		}
+
+		/**
+		 * Reads JSON object into a new element of this container.
+		 * It allows to read array of JSON objects element by element.
+		 * @param val JSON object to read.
+		 */
+		void readJsonArrayElement(const Json::Value& val)
+		{
+			if ( ! val.isNull() )
+			{
+				insert( Elem::fromJsonValue(val) );
 			}
 		}
 
@@ -488,10 +508,20 @@ class BaseSetContainer
 		{
 			for (auto& elem : val)
 			{
-				if ( ! elem.isNull() )
-				{
-					insert( Elem::fromJsonValue(elem) );
-				}
+				readJsonArrayElement(elem);
+			}
+		}
+
+		/**
+		 * Reads JSON object into a new element of this container.
+		 * It allows to read array of JSON objects element by element.
+		 * @param val JSON object to read.
+		 */
+		void readJsonArrayElement(const Json::Value& val)
+		{
+			if ( ! val.isNull() )
+			{
+				insert( Elem::fromJsonValue(val) );
 			}
 		}
 
@@ -7,6 +7,8 @@
 #ifndef RETDEC_CONFIG_CONFIG_H
 #define RETDEC_CONFIG_CONFIG_H
 
+#include <functional>
+
 #include "retdec/config/architecture.h"
 #include "retdec/config/base.h"
 #include "retdec/config/classes.h"
@@ -17,6 +19,7 @@
 #include "retdec/config/parameters.h"
 #include "retdec/config/patterns.h"
 #include "retdec/config/segments.h"
+#include "retdec/config/serialization.h"
 #include "retdec/config/tool_info.h"
 #include "retdec/config/types.h"
 #include "retdec/config/vtables.h"
@@ -35,6 +38,7 @@ class Config
 		static Config empty(const std::string& path = "");
 		static Config fromFile(const std::string& path);
 		static Config fromJsonString(const std::string& json);
+		static Config fromBinaryString(const std::string& data);
 		/// @}
 
 		/// @name Config query methods.
@@ -75,6 +79,15 @@ class Config
 		void readJsonString(const std::string& json);
 		void readJsonFile(const std::string& input);
 
+		std::string generateBinaryString() const;
+		std::string generateBinaryFile(const std::string& outputFilePath) const;
+		void readBinaryString(const std::string& data);
+
+	private:
+		void readMembers(
+				const std::function<void(ConfigReaderHandler&)>& parse);
+		void writeMembers(ConfigWriter& writer) const;
+
 	public:
 		Parameters parameters;
 		Architecture architecture;
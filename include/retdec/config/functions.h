@@ -7,7 +7,10 @@
 #ifndef RETDEC_CONFIG_FUNCTIONS_H
 #define RETDEC_CONFIG_FUNCTIONS_H
 
+#include <map>
+#include <set>
 #include <string>
+#include <unordered_map>
 
 #include "retdec/config/base.h"
 #include "retdec/config/calling_convention.h"
@@ -145,6 +148,12 @@ class Function : public retdec::utils::AddressRange
 /**
  * An associative container with functions' names as the key.
  * See Function class for details.
+ *
+ * Functions are also indexed by their start addresses and real names, so
+ * they can be found by them in logarithmic (constant) time. The indexes are
+ * updated when functions are inserted or erased. If a start address or a real
+ * name of a function in the container is changed, the function has to be
+ * inserted again to be found by the new value.
  */
 class FunctionContainer : public BaseAssociativeContainer<std::string, Function>
 {
@@ -153,7 +162,23 @@ class FunctionContainer : public BaseAssociativeContainer<std::string, Function>
 		Function* getFunctionByName(const std::string& name);
 		const Function* getFunctionByName(const std::string& name) const;
 		Function* getFunctionByStartAddress(const retdec::utils::Address& addr);
+		const Function* getFunctionByStartAddress(const retdec::utils::Address& addr) const;
 		Function* getFunctionByRealName(const std::string& name);
+		const Function* getFunctionByRealName(const std::string& name) const;
+
+		virtual std::pair<iterator,bool> insert(const Function& e) override;
+		virtual void clear() override;
+		virtual size_t erase(const std::string& name) override;
+
+	private:
+		void addToIndexes(const Function& f);
+		void removeFromIndexes(const Function& f);
+
+	private:
+		/// Names of functions starting at an address.
+		std::map<retdec::utils::Address, std::set<std::string>> _start2names;
+		/// Names of functions with a real name.
+		std::unordered_map<std::string, std::set<std::string>> _realName2names;
 };
 
 } // namespace config
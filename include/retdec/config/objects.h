@@ -7,7 +7,10 @@
 #ifndef RETDEC_CONFIG_OBJECTS_H
 #define RETDEC_CONFIG_OBJECTS_H
 
+#include <map>
+#include <set>
 #include <string>
+#include <unordered_map>
 
 #include "retdec/config/base.h"
 #include "retdec/config/storage.h"
@@ -104,7 +107,7 @@ class ObjectSetContainer : public BaseAssociativeContainer<std::string, Object>
 {
 	public:
 		const Object* getObjectByName(const std::string& name) const;
-		const Object* getObjectByRealName(const std::string& name) const;
+		virtual const Object* getObjectByRealName(const std::string& name) const;
 		const Object* getObjectByNameOrRealName(const std::string& name) const;
 };
 
@@ -112,12 +115,34 @@ class ObjectSetContainer : public BaseAssociativeContainer<std::string, Object>
  * Set container for register objects.
  * Only register objects are allowed to be inserted -- other objects
  * are not inserted.
+ *
+ * Registers are also indexed by their real names. If a real name of
+ * a register in the container is changed, the register has to be inserted
+ * again to be found by the new real name.
  */
 class RegisterContainer : public ObjectSetContainer
 {
 	public:
+		virtual const Object* getObjectByRealName(
+				const std::string& name) const override;
+
+		/// @name Reimplemented base container methods.
+		///
+		/// They need to be reimplemented to modify both underlying container
+		/// and @c realName2names map.
+		/// @{
 		virtual std::pair<iterator,bool> insert(const Object& e) override;
 		std::pair<iterator,bool> insert(const std::string& name);
+		virtual void clear() override;
+		virtual size_t erase(const std::string& name) override;
+		/// @}
+
+	private:
+		void removeFromIndex(const Object& o);
+
+	private:
+		/// Map allows fast registers search by real name.
+		std::unordered_map<std::string, std::set<std::string>> _realName2names;
 };
 
 /**
@@ -140,7 +165,8 @@ class GlobalVarContainer : public ObjectSetContainer
 		/// and @c addr2global map.
 		/// @{
 		virtual std::pair<iterator,bool> insert(const Object& e) override;
-		void clear();
+		virtual void clear() override;
+		virtual size_t erase(const std::string& name) override;
 		size_t erase(const Object& val);
 		/// @}
 
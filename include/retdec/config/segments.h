@@ -48,7 +48,12 @@ class Segment : public retdec::utils::AddressRange
  * Set container for segments.
  * Segments' address ranges are set's keys.
  */
-using SegmentContainer = BaseSetContainer<Segment>;
+class SegmentContainer : public BaseSetContainer<Segment>
+{
+	public:
+		const Segment* getSegmentContainingAddress(
+				const retdec::utils::Address& addr) const;
+};
 
 } // namespace config
 } // namespace retdec
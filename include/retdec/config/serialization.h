@@ -0,0 +1,103 @@
+/**
+ * @file include/retdec/config/serialization.h
+ * @brief Streaming reading and writing of configuration in JSON and binary
+ *        encodings.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_CONFIG_SERIALIZATION_H
+#define RETDEC_CONFIG_SERIALIZATION_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <json/json.h>
+
+namespace retdec {
+namespace config {
+
+/**
+ * Handler of members of the root object of a configuration.
+ *
+ * Readers never create a JSON value for the whole configuration. They create
+ * values of members of the root object one by one. Arrays (e.g. functions)
+ * may be read even element by element, so that only a single element is
+ * stored in a JSON value at a time.
+ */
+class ConfigReaderHandler
+{
+	public:
+		virtual ~ConfigReaderHandler() = default;
+
+		/**
+		 * Member @a name with value @a val has been read.
+		 */
+		virtual void onMember(
+				const std::string& name,
+				const Json::Value& val) = 0;
+
+		/**
+		 * Member @a name whose value is an array is being read.
+		 * @return @c True if elements of the array should be passed to
+		 *         onArrayElement() one by one, @c false if the whole array
+		 *         should be passed to onMember().
+		 */
+		virtual bool onArrayStart(const std::string& name) = 0;
+
+		/**
+		 * Element @a val of array in member @a name has been read.
+		 */
+		virtual void onArrayElement(
+				const std::string& name,
+				const Json::Value& val) = 0;
+};
+
+/**
+ * Writes members of the root object of a configuration one by one, so values
+ * of all members do not need to exist at the same time.
+ *
+ * Members should be written in the order of their names to get the same
+ * output as jsoncpp writers produce.
+ */
+class ConfigWriter
+{
+	public:
+		static std::unique_ptr<ConfigWriter> createJsonWriter();
+		static std::unique_ptr<ConfigWriter> createBinaryWriter();
+
+		virtual ~ConfigWriter() = default;
+
+		/**
+		 * Writes member @a name with value @a val into the root object.
+		 */
+		virtual void writeMember(
+				const std::string& name,
+				const Json::Value& val) = 0;
+
+		/**
+		 * Starts member @a name whose value is an array of @a size elements.
+		 * The elements have to be written by writeArrayElement() and the
+		 * array has to be ended by endArrayMember().
+		 */
+		virtual void startArrayMember(
+				const std::string& name,
+				std::size_t size) = 0;
+		virtual void writeArrayElement(const Json::Value& val) = 0;
+		virtual void endArrayMember() = 0;
+
+		/**
+		 * Ends the root object and returns the whole output.
+		 * No more members can be written afterwards.
+		 */
+		virtual std::string finish() = 0;
+};
+
+void readJsonConfig(const std::string& json, ConfigReaderHandler& handler);
+void readBinaryConfig(const std::string& data, ConfigReaderHandler& handler);
+bool isBinaryConfig(const std::string& data);
+
+} // namespace config
+} // namespace retdec
+
+#endif
@@ -7,6 +7,9 @@
 #ifndef RETDEC_CPDETECT_COMPILER_DETECTOR_SEARCH_SEARCH_H
 #define RETDEC_CPDETECT_COMPILER_DETECTOR_SEARCH_SEARCH_H
 
+#include <utility>
+
+#include "retdec/cpdetect/compiler_detector/search/signature_matcher.h"
 #include "retdec/cpdetect/cptypes.h"
 #include "retdec/fileformat/file_format/file_format.h"
 
@@ -40,10 +43,13 @@ class Search
 		};
 	private:
 		retdec::fileformat::FileFormat &parser; ///< parser of input file
-		std::string nibbles;             ///< content of file in hexadecimal string representation
+		const std::uint8_t *data;        ///< content of file in little endian
+		std::size_t dataSize;            ///< size of content of file in bytes
+		std::vector<std::uint8_t> swappedBytes; ///< content of big endian file converted to little endian
 		std::string plain;               ///< content of file as plain string
 		std::vector<RelativeJump> jumps; ///< representation of supported relative jumps
 		std::size_t averageSlashLen;     ///< average length of one slash representation
+		std::size_t nibblesInByte;       ///< number of nibbles in one byte of file
 		bool fileLoaded;                 ///< @c true if file was successfully loaded, @c false otherwise
 		bool fileSupported;              ///< @c true if search of patterns is supported for input file, @c false otherwise
 
@@ -52,6 +58,9 @@ class Search
 		bool haveSlashes() const;
 		std::size_t nibblesFromBytes(std::size_t nBytes) const;
 		std::size_t bytesFromNibbles(std::size_t nNibbles) const;
+		std::size_t getNumberOfNibbles() const;
+		char getNibble(std::size_t nibbleOffset) const;
+		bool hasSignatureOnNibble(const std::string &signPattern, std::size_t nibbleOffset, std::size_t stopNibble) const;
 		/// @}
 	public:
 		Search(retdec::fileformat::FileFormat &fileParser);
@@ -65,7 +74,6 @@ class Search
 
 		/// @name Getters
 		/// @{
-		const std::string& getNibbles() const;
 		const std::string& getPlainString() const;
 		/// @}
 
@@ -79,6 +87,8 @@ class Search
 		unsigned long long countImpNibbles(const std::string &signPattern) const;
 		unsigned long long findUnslashedSignature(const std::string &signPattern, std::size_t startOffset, std::size_t stopOffset) const;
 		unsigned long long findSlashedSignature(const std::string &signPattern, std::size_t startOffset, std::size_t stopOffset) const;
+		std::vector<unsigned long long> findUnslashedSignatures(const SignatureMatcher &signatures, std::size_t startOffset, std::size_t stopOffset) const;
+		std::vector<unsigned long long> findSlashedSignatures(const SignatureMatcher &signatures, const std::vector<std::pair<std::size_t, std::size_t>> &areas) const;
 		unsigned long long exactComparison(const std::string &signPattern, std::size_t fileOffset, std::size_t shift = 0) const;
 		bool countSimilarity(const std::string &signPattern, Similarity &sim, std::size_t fileOffset, std::size_t shift = 0) const;
 		bool areaSimilarity(const std::string &signPattern, Similarity &sim, std::size_t startOffset, std::size_t stopOffset) const;
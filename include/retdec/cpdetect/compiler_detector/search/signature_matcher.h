@@ -0,0 +1,86 @@
+/**
+ * @file include/retdec/cpdetect/compiler_detector/search/signature_matcher.h
+ * @brief Class for simultaneous search of several signatures.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_CPDETECT_COMPILER_DETECTOR_SEARCH_SIGNATURE_MATCHER_H
+#define RETDEC_CPDETECT_COMPILER_DETECTOR_SEARCH_SIGNATURE_MATCHER_H
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace retdec {
+namespace cpdetect {
+
+/**
+ * Set of signature patterns compiled for search in raw bytes
+ *
+ * Every pattern is represented by its longest run of fully specified bytes
+ * (anchor) that precedes the first slash. Anchors of all patterns are indexed
+ * by their first one or two bytes, so one pass over data finds positions where
+ * any of patterns can start. Patterns may start on any nibble, so each of them
+ * has an anchor for start on the high nibble and for start on the low nibble
+ * of byte.
+ *
+ * Matcher only finds candidates, they must be verified against whole pattern
+ * by the caller. Candidates of patterns which were already verified are not
+ * reported. Anchors assume bytes of two nibbles. In data with other size of
+ * byte, every nibble is a candidate for every pattern.
+ */
+class SignatureMatcher
+{
+	private:
+		/**
+		 * Anchor of one pattern
+		 */
+		struct Anchor
+		{
+			std::size_t pattern;   ///< index of pattern
+			std::size_t shift;     ///< nibble in byte on which pattern starts
+			std::size_t offset;    ///< offset of anchor from start of pattern (in bytes)
+			std::uint16_t key;     ///< first bytes of anchor
+			bool twoBytes;         ///< @c true if @c key consists of two bytes
+		};
+
+		std::vector<std::string> patterns;           ///< signature patterns
+		std::vector<Anchor> longAnchors;             ///< anchors with two bytes, sorted by key
+		std::bitset<0x10000> longKeys;               ///< keys of anchors with two bytes
+		std::array<std::vector<Anchor>, 0x100> shortAnchors; ///< anchors with one byte by key
+		std::vector<Anchor> noAnchors;               ///< patterns without fixed byte
+		std::size_t maxAnchorOffset = 0;             ///< the highest offset of anchor
+		int commonFirstByte = -1;                    ///< first byte of all anchors (if they share it)
+
+		void addPattern(std::size_t index);
+	public:
+		/**
+		 * Verification of candidate. Gets index of pattern and nibble offset
+		 * of candidate and returns @c true if pattern is present there.
+		 */
+		using Verifier = std::function<bool(std::size_t, std::size_t)>;
+
+		SignatureMatcher(const std::vector<std::string> &signPatterns);
+
+		/// @name Getters
+		/// @{
+		std::size_t getNumberOfPatterns() const;
+		const std::string& getPattern(std::size_t index) const;
+		/// @}
+
+		/// @name Search methods
+		/// @{
+		std::vector<bool> search(
+				const std::uint8_t *data, std::size_t size, std::size_t nibblesInByte,
+				std::size_t startNibble, std::size_t stopNibble,
+				const Verifier &verify) const;
+		/// @}
+};
+
+} // namespace cpdetect
+} // namespace retdec
+
+#endif
@@ -0,0 +1,86 @@
+/**
+* @file include/retdec/crypto/multi_hash.h
+* @brief Declaration of class MultiHashContext.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_CRYPTO_MULTI_HASH_H
+#define RETDEC_CRYPTO_MULTI_HASH_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <openssl/evp.h>
+
+#include "retdec/crypto/crc32.h"
+
+namespace retdec {
+namespace crypto {
+
+/**
+ * Digests which can be computed in one pass.
+ */
+enum DigestFlags
+{
+	DIGEST_NONE   = 0,
+	DIGEST_CRC32  = 1,
+	DIGEST_MD5    = 2,
+	DIGEST_SHA1   = 4,
+	DIGEST_SHA256 = 8,
+	DIGEST_ALL    = DIGEST_CRC32 | DIGEST_MD5 | DIGEST_SHA1 | DIGEST_SHA256
+};
+
+/**
+ * Results of hashing. Digests which were not requested are empty.
+ * All digests are lowercase hexadecimal strings.
+ */
+struct Digests
+{
+	std::string crc32;
+	std::string md5;
+	std::string sha1;
+	std::string sha256;
+};
+
+/**
+ * Continuous computation of several digests of the same data.
+ *
+ * Data are split into chunks small enough to stay in cache and every chunk
+ * is fed to all requested digests before the next one is read, so the data
+ * are walked through only once.
+ */
+class MultiHashContext
+{
+public:
+	explicit MultiHashContext(unsigned digests = DIGEST_ALL);
+	~MultiHashContext();
+
+	MultiHashContext(const MultiHashContext&) = delete;
+	MultiHashContext& operator=(const MultiHashContext&) = delete;
+
+	bool addData(const std::uint8_t* data, std::size_t size);
+	bool addData(const std::vector<std::uint8_t>& data);
+	Digests getDigests();
+
+private:
+	struct EvpDigest
+	{
+		std::string* result;
+		EVP_MD_CTX* ctx;
+	};
+
+	unsigned _digests;               ///< Requested digests.
+	CRC32 _crc32;                    ///< CRC32 state (if requested).
+	std::vector<EvpDigest> _evp;     ///< OpenSSL states of requested digests.
+	Digests _result;                 ///< Storage of final digests.
+	bool _ok = true;                 ///< @c false if any OpenSSL call failed.
+};
+
+Digests computeDigests(const unsigned char *data, std::uint64_t length,
+		unsigned digests = DIGEST_ALL);
+
+} // namespace crypto
+} // namespace retdec
+
+#endif
@@ -22,6 +22,12 @@ class Function;
 */
 class Module
 {
+	private:
+		using Functions = std::unordered_map<std::string, std::shared_ptr<Function>>;
+
+	public:
+		using const_function_iterator = Functions::const_iterator;
+
 	public:
 		explicit Module(const std::shared_ptr<Context> &context);
 
@@ -29,13 +35,19 @@ class Module
 		std::shared_ptr<Function> getFunctionWithName(const std::string &name) const;
 		void addFunction(const std::shared_ptr<Function> &function);
 
+		/// @name Module functions.
+		/// @{
+		const_function_iterator function_begin() const;
+		const_function_iterator function_end() const;
+		Functions::size_type getFunctionCount() const;
+		/// @}
+
 		std::shared_ptr<Context> getContext() const;
 
 	private:
 		/// Container for all functions and types.
 		std::shared_ptr<Context> context;
 
-		using Functions = std::unordered_map<std::string, std::shared_ptr<Function>>;
 		/// Container for functions in this module.
 		Functions functions;
 };
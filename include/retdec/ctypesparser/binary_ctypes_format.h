@@ -0,0 +1,118 @@
+/**
+* @file include/retdec/ctypesparser/binary_ctypes_format.h
+* @brief Constants of the binary format of C-types databases.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*
+* A C-types database is a precompiled form of C-types in JSON. It is meant to
+* be mapped into memory and read lazily, so only the functions that are really
+* needed (and types they use) are ever converted into C-types objects.
+*
+* All numbers are little-endian. All offsets are absolute (from the start of
+* the database), so the database is position independent.
+*
+* @code
+* database   := header buckets functionOffsets typeOffsets records
+* header     := "RDCT" u32(version) u32(functionCount) u32(typeCount)
+*               u32(bucketCount) u64(sourceSize) u64(sourceModificationTime)
+* buckets    := u32(functionIndex + 1 or 0 for an empty bucket)*
+*               (hash table of function names with linear probing)
+* string     := u32(length) bytes
+* function   := string(name) u32(returnType) string(callConv) u8(varArg)
+*               string(declaration) string(header) u32(paramCount) param*
+* param      := string(name) u32(type) u8(annotationCount)
+*               (u8(annotationKind) string(annotationName))*
+* type       := u8(typeKind) ... (see BinaryCTypesWriter::visit())
+* @endcode
+*
+* Bit widths and call conventions that were not specified in JSON are stored
+* as @c 0 and an empty string, respectively. They are resolved when the
+* database is read, so the same database can be used for all architectures.
+*
+* The size and modification time of the JSON file the database was compiled
+* from are stored in the header (see SourceStamp), so a user of the database
+* can detect that the JSON file has changed since then.
+*/
+
+#ifndef RETDEC_CTYPESPARSER_BINARY_CTYPES_FORMAT_H
+#define RETDEC_CTYPESPARSER_BINARY_CTYPES_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace retdec {
+namespace ctypesparser {
+namespace binary_ctypes {
+
+/// Magic bytes at the start of every database.
+constexpr char MAGIC[] = {'R', 'D', 'C', 'T'};
+constexpr std::uint32_t VERSION = 2;
+constexpr std::size_t HEADER_SIZE = sizeof(MAGIC) + 4 * sizeof(std::uint32_t)
+	+ 2 * sizeof(std::uint64_t);
+
+/**
+* @brief Identification of the file a database was compiled from.
+*/
+struct SourceStamp
+{
+	/// Size of the file in bytes.
+	std::uint64_t size = 0;
+	/// Time of the last modification of the file (seconds since the epoch).
+	std::uint64_t modificationTime = 0;
+};
+
+inline bool operator==(const SourceStamp &s1, const SourceStamp &s2)
+{
+	return s1.size == s2.size && s1.modificationTime == s2.modificationTime;
+}
+
+inline bool operator!=(const SourceStamp &s1, const SourceStamp &s2)
+{
+	return !(s1 == s2);
+}
+
+bool readSourceStamp(const std::string &path, SourceStamp &stamp);
+
+enum class TypeKind : std::uint8_t
+{
+	Array,
+	Enum,
+	FloatingPoint,
+	Function,
+	Integral,
+	Pointer,
+	Struct,
+	Typedef,
+	Union,
+	Unknown,
+	Void
+};
+
+enum class AnnotationKind : std::uint8_t
+{
+	In,
+	InOut,
+	Optional,
+	Out
+};
+
+/**
+* @brief Returns a hash of function name used in the hash table of functions
+*        (32-bit FNV-1a).
+*/
+inline std::uint32_t hashName(const char *name, std::size_t size)
+{
+	std::uint32_t hash = 2166136261u;
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		hash ^= static_cast<std::uint8_t>(name[i]);
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+} // namespace binary_ctypes
+} // namespace ctypesparser
+} // namespace retdec
+
+#endif
@@ -0,0 +1,101 @@
+/**
+* @file include/retdec/ctypesparser/binary_ctypes_parser.h
+* @brief Parser for C-types from databases created by @c BinaryCTypesWriter.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_CTYPESPARSER_BINARY_CTYPES_PARSER_H
+#define RETDEC_CTYPESPARSER_BINARY_CTYPES_PARSER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "retdec/ctypesparser/binary_ctypes_format.h"
+#include "retdec/ctypesparser/ctypes_parser.h"
+#include "retdec/utils/memory_mapped_file.h"
+
+namespace retdec {
+namespace ctypesparser {
+
+/**
+* @brief Parser for C-types from databases created by @c BinaryCTypesWriter.
+*
+* Besides parsing the whole database from a stream, the parser can map a
+* database file into memory and parse only the requested functions (and the
+* types they use) by their names (see open() and getFunction()).
+*/
+class BinaryCTypesParser: public CTypesParser
+{
+	public:
+		BinaryCTypesParser();
+		BinaryCTypesParser(unsigned defaultBitWidth);
+
+		virtual std::unique_ptr<retdec::ctypes::Module> parse(
+			std::istream &stream,
+			const TypeWidths &typeWidths = {},
+			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention()) override;
+		virtual void parseInto(
+			std::istream &stream,
+			std::unique_ptr<retdec::ctypes::Module> &module,
+			const TypeWidths &typeWidths = {},
+			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention()) override;
+
+		/// @name Lazy parsing.
+		/// @{
+		bool open(
+			const std::string &path,
+			const std::shared_ptr<retdec::ctypes::Context> &context,
+			const TypeWidths &typeWidths = {},
+			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention());
+		bool hasFunction(const std::string &name) const;
+		std::shared_ptr<retdec::ctypes::Function> getFunction(
+			const std::string &name);
+		const binary_ctypes::SourceStamp &getSourceStamp() const;
+		/// @}
+
+	private:
+		bool setData(const std::uint8_t *data, std::size_t size);
+		void setParams(
+			const std::shared_ptr<retdec::ctypes::Context> &context,
+			const TypeWidths &typeWidths,
+			const retdec::ctypes::CallConvention &callConvention);
+		std::uint32_t findFunction(const std::string &name) const;
+		std::uint32_t getFunctionOffset(std::uint32_t index) const;
+		std::uint32_t getTypeOffset(std::uint32_t index) const;
+
+		/// @name Parsing methods.
+		/// @{
+		std::shared_ptr<retdec::ctypes::Function> parseFunction(
+			std::uint32_t index);
+		std::shared_ptr<retdec::ctypes::Type> getOrParseType(
+			std::uint32_t index);
+		std::shared_ptr<retdec::ctypes::Type> parseType(std::uint32_t index);
+		retdec::ctypes::CallConvention parseCallConv(
+			const std::string &callConv) const;
+		/// @}
+
+	private:
+		/// Database file (when the database is read lazily).
+		retdec::utils::MemoryMappedFile file;
+		/// Database content (when the database is read from a stream).
+		std::string buffer;
+
+		const std::uint8_t *data = nullptr;
+		std::size_t size = 0;
+		std::uint32_t functionCount = 0;
+		std::uint32_t typeCount = 0;
+		std::uint32_t bucketCount = 0;
+		/// Stamp of the file from which the database was compiled.
+		binary_ctypes::SourceStamp sourceStamp;
+
+		/// Already parsed types, indexed by type indexes.
+		std::vector<std::shared_ptr<retdec::ctypes::Type>> types;
+		/// Types whose parsing has started but not finished yet.
+		std::vector<bool> typesInProgress;
+};
+
+} // namespace ctypesparser
+} // namespace retdec
+
+#endif
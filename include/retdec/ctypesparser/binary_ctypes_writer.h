@@ -0,0 +1,80 @@
+/**
+* @file include/retdec/ctypesparser/binary_ctypes_writer.h
+* @brief Writer of C-types databases.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_CTYPESPARSER_BINARY_CTYPES_WRITER_H
+#define RETDEC_CTYPESPARSER_BINARY_CTYPES_WRITER_H
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "retdec/ctypes/visitor.h"
+#include "retdec/ctypesparser/binary_ctypes_format.h"
+
+namespace retdec {
+namespace ctypes {
+
+class Function;
+class Module;
+class Type;
+
+} // namespace ctypes
+
+namespace ctypesparser {
+
+/**
+* @brief Writes C-types from a module into a database readable by
+*        @c BinaryCTypesParser.
+*
+* To get a database usable for all architectures, the module should be parsed
+* by @c JSONCTypesParser with default bit width @c 0, without type widths and
+* with an empty call convention. Such values are then resolved when the
+* database is read.
+*/
+class BinaryCTypesWriter: private retdec::ctypes::Visitor
+{
+	public:
+		BinaryCTypesWriter();
+		virtual ~BinaryCTypesWriter() override;
+
+		void write(
+			std::ostream &stream,
+			const retdec::ctypes::Module &module,
+			const binary_ctypes::SourceStamp &source = binary_ctypes::SourceStamp());
+
+	private:
+		/// @name Visitor interface.
+		/// @{
+		virtual void visit(const std::shared_ptr<retdec::ctypes::ArrayType> &type) override;
+		virtual void visit(const std::shared_ptr<retdec::ctypes::EnumType> &type) override;
+		virtual void visit(const std::shared_ptr<retdec::ctypes::FloatingPointType> &type) override;
+		virtual void visit(const std::shared_ptr<retdec::ctypes::FunctionType> &type) override;
+		virtual void visit(const std::shared_ptr<retdec::ctypes::IntegralType> &type) override;
+		virtual void visit(const std::shared_ptr<retdec::ctypes::PointerType> &type) override;
+		virtual void visit(const std::shared_ptr<retdec::ctypes::StructType> &type) override;
+		virtual void visit(const std::shared_ptr<retdec::ctypes::TypedefedType> &type) override;
+		virtual void visit(const std::shared_ptr<retdec::ctypes::UnionType> &type) override;
+		virtual void visit(const std::shared_ptr<retdec::ctypes::UnknownType> &type) override;
+		virtual void visit(const std::shared_ptr<retdec::ctypes::VoidType> &type) override;
+		/// @}
+
+		std::string writeFunction(const retdec::ctypes::Function &function);
+		std::uint32_t getTypeIndex(const std::shared_ptr<retdec::ctypes::Type> &type);
+
+	private:
+		/// Indexes of already written types.
+		std::unordered_map<const retdec::ctypes::Type *, std::uint32_t> typeIndexes;
+		/// Records of types, indexed by type indexes.
+		std::vector<std::string> typeRecords;
+};
+
+} // namespace ctypesparser
+} // namespace retdec
+
+#endif
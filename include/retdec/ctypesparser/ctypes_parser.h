@@ -64,6 +64,9 @@ class CTypesParser
 		CTypesParser();
 		CTypesParser(unsigned defaultBitWidth);
 
+		unsigned getIntegralTypeBitWidth(const std::string &type) const;
+		unsigned getBitWidthOrDefault(const std::string &typeName) const;
+
 	protected:
 		/// Container for already parsed functions, types.
 		std::shared_ptr<retdec::ctypes::Context> context;
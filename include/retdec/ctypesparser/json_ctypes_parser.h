@@ -122,8 +122,6 @@ class JSONCTypesParser: public CTypesParser
 				std::shared_ptr<retdec::ctypes::Type> (const std::string &typeName)
 			> &parseType
 		);
-		unsigned getIntegralTypeBitWidth(const std::string &type) const;
-		unsigned getBitWidthOrDefault(const std::string &typeName) const;
 		/// @}
 
 	private:
@@ -16,6 +16,7 @@
 #include "retdec/dwarfparser/dwarf_file.h"
 #include "retdec/fileformat/fileformat.h"
 #include "retdec/loader/loader.h"
+#include "retdec/utils/thread_pool.h"
 
 namespace retdec {
 namespace debugformat {
@@ -27,6 +28,7 @@ class DebugFormat
 {
 	public:
 		using SymbolTable = std::map<retdec::utils::Address, const retdec::fileformat::Symbol*>;
+		using FunctionMap = std::map<retdec::utils::Address, retdec::config::Function>;
 
 	public:
 		DebugFormat();
@@ -35,24 +37,37 @@ class DebugFormat
 				const std::string& pdbFile,
 				SymbolTable* symtab,
 				retdec::demangler::CDemangler* demangler,
-				unsigned long long imageBase = 0);
+				unsigned long long imageBase = 0,
+				retdec::utils::ThreadPool* threadPool = nullptr);
+		~DebugFormat();
+
+		DebugFormat(const DebugFormat&) = delete;
+		DebugFormat& operator=(const DebugFormat&) = delete;
 
 		retdec::config::Function* getFunction(retdec::utils::Address a);
 		const retdec::config::Object* getGlobalVar(retdec::utils::Address a);
 
-		bool hasInformation() const;
+		const FunctionMap& getFunctions();
+		const retdec::config::GlobalVarContainer& getGlobalVars();
+		const retdec::config::TypeContainer& getTypes();
+
+		bool hasInformation();
 
 	private:
-		void loadPdb();
+		void loadFunctions();
+		void loadGlobalVariables();
+		void loadTypes();
+
 		void loadPdbTypes();
 		void loadPdbGlobalVariables();
 		void loadPdbFunctions();
 		retdec::config::Type loadPdbType(retdec::pdbparser::PDBTypeDef* type);
 
-		void loadDwarf();
 		void loadDwarfTypes();
 		void loadDwarfGlobalVariables();
+		void loadDwarfGlobalVariable(retdec::dwarfparser::DwarfVar* gvar);
 		void loadDwarfFunctions();
+		void loadDwarfFunction(retdec::dwarfparser::DwarfFunction* df);
 		retdec::config::Type loadDwarfType(retdec::dwarfparser::DwarfType* type);
 
 		void loadSymtab();
@@ -66,16 +81,29 @@ class DebugFormat
 		retdec::loader::Image* _inFile = nullptr;
 		/// Underlying PDB representation.
 		retdec::pdbparser::PDBFile* _pdbFile = nullptr;
-		/// Underlying DWARF representation.
+		/// Underlying DWARF representation. Its compilation units are loaded
+		/// when something in them is requested.
 		retdec::dwarfparser::DwarfFile* _dwarfFile = nullptr;
 		/// Demangler.
 		retdec::demangler::CDemangler* _demangler = nullptr;
-
-	public:
-		retdec::config::GlobalVarContainer globals;
-		retdec::config::TypeContainer types;
-
-		std::map<retdec::utils::Address, retdec::config::Function> functions;
+		/// Threads to load all DWARF compilation units by.
+		retdec::utils::ThreadPool* _threadPool = nullptr;
+
+		/// Functions from debug information and symbol table.
+		FunctionMap _functions;
+		/// Global variables from debug information.
+		retdec::config::GlobalVarContainer _globals;
+		/// Types from debug information.
+		retdec::config::TypeContainer _types;
+
+		/// Were functions already loaded by loadFunctions()?
+		bool _functionsLoaded = false;
+		/// Were global variables already loaded by loadGlobalVariables()?
+		bool _globalsLoaded = false;
+		/// Were types already loaded by loadTypes()?
+		bool _typesLoaded = false;
+		/// Were functions from symbol table already loaded by loadSymtab()?
+		bool _symtabLoaded = false;
 };
 
 } // namespace debugformat
@@ -0,0 +1,105 @@
+/**
+ * @file include/retdec/decompiler/decompiler.h
+ * @brief In-process decompilation pipeline.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_DECOMPILER_DECOMPILER_H
+#define RETDEC_DECOMPILER_DECOMPILER_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+
+#include "retdec/config/config.h"
+#include "retdec/fileformat/file_format/file_format.h"
+#include "retdec/llvmir2hll/decompiler.h"
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace decompiler {
+
+/**
+ * Statistics of one stage of decompilation.
+ */
+struct StageStatistics
+{
+	std::string name;                  ///< name of stage
+	double time = 0.0;                 ///< wall time spent in stage (in seconds)
+	std::size_t peakMemoryGrowth = 0;  ///< growth of peak memory usage of process during stage (in bytes)
+	std::size_t processPeakMemory = 0; ///< peak memory usage of process at the end of stage (in bytes)
+};
+
+/**
+ * Settings of decompilation.
+ */
+struct Settings
+{
+	/// Names of bin2llvmir passes (without leading dash) in order in which
+	/// they are run.
+	std::vector<std::string> bin2llvmirPasses;
+	/// Options of conversion of LLVM IR into the target HLL.
+	retdec::llvmir2hll::DecompilerOptions backend;
+	/// Path to the file with the generated HLL code.
+	std::string outputFile;
+	/// If not empty, config updated by decompilation is stored into this file.
+	std::string outputConfigFile;
+	/// If not empty, LLVM IR produced by bin2llvmir is stored into this file.
+	std::string outputLlvmIrFile;
+
+	Settings();
+	static std::vector<std::string> getDefaultBin2llvmirPasses();
+};
+
+/**
+ * Decompilation of binary file into the target high-level language in one
+ * process.
+ *
+ * Stages of decompilation share all their data in memory: input file is parsed
+ * only once, config is passed between stages without serialization and LLVM
+ * module produced by bin2llvmir is decompiled by llvmir2hll directly, without
+ * writing it into bitcode file and reading it back.
+ *
+ * Input config has to be prepared in the same way as for bin2llvmir (i.e. by
+ * fileinfo and configtool).
+ */
+class Decompiler : private retdec::utils::NonCopyable
+{
+	public:
+		Decompiler(const retdec::config::Config &config, const Settings &settings);
+
+		bool run();
+
+		/// @name Getters
+		/// @{
+		const std::string& getErrorMessage() const;
+		const std::vector<StageStatistics>& getStatistics() const;
+		const retdec::config::Config& getConfig() const;
+		const retdec::fileformat::FileFormat* getFileFormat() const;
+		const llvm::Module* getModule() const;
+		/// @}
+	private:
+		bool loadInputFile();
+		bool runBin2llvmir();
+		bool runLlvmir2hll();
+		bool runStage(const std::string &name, bool (Decompiler::*stage)());
+		bool setError(const std::string &message);
+		static void initializeLlvm();
+
+		retdec::config::Config config;                                   ///< config shared by all stages
+		Settings settings;                                               ///< settings of decompilation
+		std::shared_ptr<retdec::fileformat::FileFormat> fileFormat;      ///< parsed input file
+		llvm::LLVMContext context;                                       ///< context of @c module
+		std::unique_ptr<llvm::Module> module;                            ///< LLVM IR of input file
+		std::vector<StageStatistics> statistics;                         ///< statistics of finished stages
+		std::string errorMessage;                                        ///< description of the last error
+};
+
+} // namespace decompiler
+} // namespace retdec
+
+#endif
@@ -67,6 +67,7 @@ class DwarfBaseContainer
 
 		// TODO: get element by DIE?
 		DwarfBaseElement *getElemByOffset(Dwarf_Off o);
+		void takeElementsOf(DwarfBaseContainer<T> &o);
 
 	//
 	// Virtual functions.
@@ -171,6 +172,22 @@ DwarfBaseElement* DwarfBaseContainer<T>::getElemByOffset(Dwarf_Off o)
 		return nullptr;
 }
 
+/**
+ * @brief Move all elements of another container to the end of this one.
+ * @param o Container to take elements of. It is empty afterwards.
+ *
+ * Moved elements still refer to @a o as to their parent container, so it
+ * has to live as long as they do.
+ */
+template <class T>
+void DwarfBaseContainer<T>::takeElementsOf(DwarfBaseContainer<T> &o)
+{
+	m_data.insert(m_data.end(), o.m_data.begin(), o.m_data.end());
+	off2data.insert(o.off2data.begin(), o.off2data.end());
+	o.m_data.clear();
+	o.off2data.clear();
+}
+
 } // namespace dwarfparser
 } // namespace retdec
 
@@ -26,7 +26,11 @@
 #ifndef RETDEC_DWARFPARSER_DWARF_FILE_H
 #define RETDEC_DWARFPARSER_DWARF_FILE_H
 
+#include <map>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <libdwarf/dwarf.h>
 #include <libdwarf/libdwarf.h>
@@ -42,6 +46,7 @@
 #include "retdec/dwarfparser/dwarf_types.h"
 #include "retdec/dwarfparser/dwarf_utils.h"
 #include "retdec/dwarfparser/dwarf_vars.h"
+#include "retdec/utils/thread_pool.h"
 
 namespace retdec {
 namespace dwarfparser {
@@ -61,10 +66,25 @@ class DwarfFile
 	// Public methods.
 	//
 	public:
-		DwarfFile(std::string fileName, retdec::fileformat::FileFormat *fileParser = nullptr);
+		DwarfFile(std::string fileName, retdec::fileformat::FileFormat *fileParser = nullptr, bool lazy = false);
 		~DwarfFile();
 		bool hasDwarfInfo();
 
+	//
+	// Loading of compilation units on demand.
+	//
+	public:
+		std::size_t getCUCount() const;
+		std::size_t getLoadedCUCount() const;
+		bool loadCUsForAddress(Dwarf_Addr addr);
+		bool loadCUsForName(const std::string &name);
+		void loadCUs(std::size_t first, std::size_t last);
+		void loadAllCUs(retdec::utils::ThreadPool *threadPool = nullptr);
+		DwarfFunction *getFunction(Dwarf_Addr addr);
+		DwarfFunction *getFunction(const std::string &name);
+		DwarfVar *getGlobalVar(Dwarf_Addr addr);
+		const std::map<Dwarf_Addr, Dwarf_Unsigned> &getLoadedLineNumbers();
+
 	//
 	// Functions getting particular DWARF records.
 	//
@@ -81,7 +101,17 @@ class DwarfFile
 	//
 	private:
 		bool loadFile(std::string fileName, retdec::fileformat::FileFormat *fileParser);
-		void loadFileCUs();
+		void indexFileCUs();
+		void indexAranges(std::map<Dwarf_Off, std::vector<std::pair<Dwarf_Addr, Dwarf_Addr>>> &ranges);
+		void loadCU(std::size_t index);
+		void loadCUsInParallel(const std::vector<std::size_t> &indexes,
+				retdec::utils::ThreadPool &threadPool);
+		void loadAllCUsIfNotLoading();
+		void indexGlobalDIEs();
+		void indexGlobalDIE(Dwarf_Die die, std::size_t cuIndex);
+		void addNamesOfDIE(Dwarf_Die die, std::size_t cuIndex);
+		void indexFunctions();
+		void indexGlobalVars();
 		void loadCUtree(Dwarf_Die die, DwarfBaseElement* parent, int lvl);
 		void loadDIE(Dwarf_Die die, DwarfBaseElement* &parent, int lvl);
 		void makeStructTypesUnique();
@@ -105,6 +135,74 @@ class DwarfFile
 		Dwarf_Debug m_dbg;   ///< Libdwarf structure representing DWARF file.
 		int m_fd;            ///< File descriptor used in dwarf_init().
 		Dwarf_Error m_error; ///< Global libdwarf error code.
+		/// Access to sections of input file used by @c m_dbg. Libdwarf loads
+		/// sections when they are first used, so it has to live as long as
+		/// @c m_dbg does.
+		std::unique_ptr<BinInt> m_binInt;
+		std::string m_fileName;                          ///< Name of input file.
+		retdec::fileformat::FileFormat *m_fileParser;    ///< Parser of input file.
+		/// Files which loaded some CUs in parallel. Their elements were moved
+		/// to containers of this file, but they still refer to them.
+		std::vector<std::unique_ptr<DwarfFile>> m_slices;
+
+	//
+	// Index of compilation units.
+	//
+	private:
+		/**
+		 * @brief Compilation unit which may be loaded on demand.
+		 */
+		struct CUIndexEntry
+		{
+			Dwarf_Off dieOffset = 0; ///< Offset of the CU DIE.
+			/// Address ranges [low, high) covered by the CU. If there are
+			/// none, the CU is loaded by every query which is not resolved
+			/// by other CUs.
+			std::vector<std::pair<Dwarf_Addr, Dwarf_Addr>> ranges;
+			bool loaded = false;     ///< Are contents of the CU loaded?
+			/// Does the CU contain global variables whose addresses are not
+			/// in m_globalAddrToCUs?
+			bool hasUnindexedGlobals = false;
+		};
+
+		std::vector<CUIndexEntry> m_cuIndex; ///< All CUs in the file order.
+		std::size_t m_loadedCUs;      ///< Number of loaded CUs.
+		bool m_loadingCU;             ///< Is some CU being loaded right now?
+
+		/// Are names and global variables of CUs indexed by indexGlobalDIEs()?
+		bool m_globalDIEsIndexed;
+		/// Indexes of CUs by names of functions, variables and types
+		/// declared in them outside of other functions and types.
+		std::map<std::string, std::vector<std::size_t>> m_nameToCUs;
+		/// Indexes of CUs by addresses of global variables defined in them.
+		std::map<Dwarf_Addr, std::vector<std::size_t>> m_globalAddrToCUs;
+
+		/// Are struct types renamed by makeStructTypesUnique() when CUs are
+		/// loaded? CUs loaded in parallel are renamed after they are merged.
+		bool m_makeStructTypesUnique;
+		/// Number of struct types already processed by makeStructTypesUnique().
+		std::size_t m_uniqueTypesCount;
+		/// Struct names seen by makeStructTypesUnique() and their counts.
+		std::map<std::string, unsigned> m_structNames;
+		/// Number of anonymous struct types named by makeStructTypesUnique().
+		unsigned m_anonStructsCount;
+
+		/// Functions by their lowest addresses.
+		std::map<Dwarf_Addr, DwarfFunction*> m_addrToFunction;
+		/// Functions by their names and linkage names.
+		std::map<std::string, DwarfFunction*> m_nameToFunction;
+		/// Number of functions in m_addrToFunction and m_nameToFunction.
+		std::size_t m_indexedFunctionsCount;
+
+		/// Global variables by their addresses.
+		std::map<Dwarf_Addr, DwarfVar*> m_addrToGlobalVar;
+		/// Number of global variables in m_addrToGlobalVar.
+		std::size_t m_indexedGlobalVarsCount;
+
+		/// Line numbers by addresses in loaded CUs.
+		std::map<Dwarf_Addr, Dwarf_Unsigned> m_addrToLine;
+		/// Number of lines in m_addrToLine.
+		std::size_t m_indexedLinesCount;
 
 	//
 	// Variables keep track of the context of DWARF tree.
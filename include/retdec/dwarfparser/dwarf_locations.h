@@ -95,6 +95,7 @@ class DwarfLocationDesc
 		std::size_t count() const;
 		bool isEmpty();
 		bool isNormal() const;
+		bool getStaticAddress(Dwarf_Addr *a) const;
 		bool isList();
 		bool isOnStack(Dwarf_Signed *off, bool *deref, Dwarf_Addr pc = 0, int *regNum=nullptr);
 		void dump();
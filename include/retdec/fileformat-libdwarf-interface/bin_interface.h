@@ -12,6 +12,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -43,6 +44,7 @@ class BinInt
 			m_parserInsteadOfPath(m_fileParser && m_fileParser->isInValidState()),
 			m_success(true),
 			m_binInt(nullptr),
+			m_file(nullptr),
 			dwarf_binint_object_access_methods()
 		{
 			dwarf_binint_object_access_init();
@@ -118,8 +120,10 @@ class BinInt
 				return;
 			}
 
-			// Initialize the interface struct.
-			m_binInt->object = objFile;
+			// Initialize the interface struct. Access functions get this
+			// object, so every instance has its own loaded sections.
+			m_file = objFile;
+			m_binInt->object = this;
 			m_binInt->methods = &dwarf_binint_object_access_methods;
 			m_success = objFile->isInValidState();
 			return;
@@ -143,7 +147,7 @@ class BinInt
 				Dwarf_Obj_Access_Section* ret_scn,
 				int* error)
 		{
-			auto *obj = static_cast<retdec::fileformat::FileFormat*>(obj_in);
+			auto *obj = static_cast<BinInt*>(obj_in)->m_file;
 
 			const auto *sec = obj->getSection(section_index);
 			if (!sec)
@@ -168,7 +172,7 @@ class BinInt
 		static Dwarf_Endianness dwarf_binint_object_access_get_byte_order(
 				void* obj_in)
 		{
-			auto *obj = static_cast<retdec::fileformat::FileFormat*>(obj_in);
+			auto *obj = static_cast<BinInt*>(obj_in)->m_file;
 
 			if (obj->isLittleEndian())
 			{
@@ -196,7 +200,7 @@ class BinInt
 		static Dwarf_Small dwarf_binint_object_access_get_length_size(
 				void* obj_in)
 		{
-			auto *obj = static_cast<retdec::fileformat::FileFormat*>(obj_in);
+			auto *obj = static_cast<BinInt*>(obj_in)->m_file;
 			return static_cast<Dwarf_Small>(obj->getBytesPerWord());
 		}
 
@@ -208,7 +212,7 @@ class BinInt
 		static Dwarf_Small dwarf_binint_object_access_get_pointer_size(
 				void* obj_in)
 		{
-			auto *obj = static_cast<retdec::fileformat::FileFormat*>(obj_in);
+			auto *obj = static_cast<BinInt*>(obj_in)->m_file;
 			return static_cast<Dwarf_Small>(obj->getBytesPerWord());
 		}
 
@@ -220,7 +224,7 @@ class BinInt
 		static Dwarf_Unsigned dwarf_binint_object_access_get_section_count(
 				void * obj_in)
 		{
-			auto *obj = static_cast<retdec::fileformat::FileFormat*>(obj_in);
+			auto *obj = static_cast<BinInt*>(obj_in)->m_file;
 			return obj->getNumberOfSections();
 		}
 
@@ -238,32 +242,37 @@ class BinInt
 				Dwarf_Small** section_data,
 				int* error)
 		{
-			std::map<Dwarf_Half, std::vector<unsigned char>>::iterator fIt = BinInt::secBytes().find(section_index);
-			if (fIt != BinInt::secBytes().end())
+			auto *binInt = static_cast<BinInt*>(obj_in);
+			if (!binInt || !section_data)
+			{
+				*error = DW_DLE_MDE;
+				return DW_DLV_ERROR;
+			}
+
+			auto fIt = binInt->m_secBytes.find(section_index);
+			if (fIt != binInt->m_secBytes.end())
 			{
 				*section_data = fIt->second.data();
 				return DW_DLV_OK;
 			}
 			else
 			{
-				auto *obj = static_cast<retdec::fileformat::FileFormat*>(obj_in);
-				if (!obj || !section_data)
-				{
-					*error = DW_DLE_MDE;
-					return DW_DLV_ERROR;
-				}
-
-				const auto *fSec = obj->getSection(section_index);
+				// Several instances may share one parser and load sections
+				// from different threads.
 				std::vector<unsigned char> bytes;
-				if (!fSec || !fSec->getBytes(bytes))
 				{
-					*error = DW_DLE_MDE;
-					return DW_DLV_ERROR;
+					std::lock_guard<std::mutex> lock(fileMutex());
+					const auto *fSec = binInt->m_file->getSection(section_index);
+					if (!fSec || !fSec->getBytes(bytes))
+					{
+						*error = DW_DLE_MDE;
+						return DW_DLV_ERROR;
+					}
 				}
 
-				BinInt::secBytes()[section_index] = bytes;
-
-				*section_data = BinInt::secBytes()[section_index].data();
+				auto &secBytes = binInt->m_secBytes[section_index];
+				secBytes = std::move(bytes);
+				*section_data = secBytes.data();
 
 				if (*section_data == NULL)
 				{
@@ -293,21 +302,15 @@ class BinInt
 		}
 
 	//
-	// When this module had both header and source file, we declared static variable
-	// secBytes here in header and defined it in source.
-	// However, it is easier to use this module when it is header only.
-	// The problem is that static member variables can not be defined in header files.
-	// Therefore, we hack it by using static member getter method which contains
-	// static local variable in its body.
-	//
-	// Matula: I have no idea why there is (must be?) a static member variable in the
-	// first place, but it seems to work, so be it.
+	// This module is header only and static member variables can not be
+	// defined in header files. Therefore, a static member getter method
+	// containing a static local variable is used instead.
 	//
 	private:
-		static std::map<Dwarf_Half, std::vector<unsigned char>>& secBytes()
+		static std::mutex& fileMutex()
 		{
-			static std::map<Dwarf_Half, std::vector<unsigned char>> secBytes;
-			return secBytes;
+			static std::mutex fileMutex;
+			return fileMutex;
 		}
 
 	//
@@ -320,6 +323,10 @@ class BinInt
 		bool m_parserInsteadOfPath;
 		bool m_success;
 		Dwarf_Obj_Access_Interface *m_binInt;
+		retdec::fileformat::FileFormat *m_file; ///< Input file sections are read from.
+		/// Loaded sections by their indexes. Libdwarf uses them as long as
+		/// this object lives.
+		std::map<Dwarf_Half, std::vector<unsigned char>> m_secBytes;
 		struct Dwarf_Obj_Access_Methods_s dwarf_binint_object_access_methods;
 };
 
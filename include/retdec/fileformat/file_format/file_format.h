@@ -7,14 +7,22 @@
 #ifndef RETDEC_FILEFORMAT_FILE_FORMAT_FILE_FORMAT_H
 #define RETDEC_FILEFORMAT_FILE_FORMAT_FILE_FORMAT_H
 
+#include <atomic>
 #include <fstream>
 #include <initializer_list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <vector>
 
+#include <llvm/ADT/ArrayRef.h>
+
 #include "retdec/config/config.h"
 #include "retdec/utils/byte_value_storage.h"
+#include "retdec/utils/interval_index.h"
+#include "retdec/utils/memory_mapped_file.h"
+#include "retdec/utils/memory_stream_buffer.h"
 #include "retdec/utils/non_copyable.h"
 #include "retdec/fileformat/fftypes.h"
 
@@ -42,8 +50,15 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 {
 	private:
 		std::ifstream auxStream;                 ///< auxiliary member for opening of input file
-		std::vector<unsigned char> *loadedBytes; ///< reference to serialized content of input file
+		retdec::utils::MemoryMappedFile mappedFile; ///< memory-mapped content of input file
+		std::unique_ptr<retdec::utils::MemoryStreamBuffer> mappedStreamBuffer; ///< buffer of file stream reading @c mappedFile
+		std::vector<unsigned char> *loadedBytes; ///< reference to serialized content of input file (@c nullptr if same as file content)
 		LoadFlags loadFlags;                     ///< load flags for configurable file loading
+		mutable retdec::utils::IntervalIndex<const Section*> sectionAddressIndex; ///< sections by address
+		mutable retdec::utils::IntervalIndex<const Segment*> segmentAddressIndex; ///< segments by address
+		mutable std::atomic<std::size_t> indexedSections; ///< number of sections in address index
+		mutable std::atomic<std::size_t> indexedSegments; ///< number of segments in address index
+		mutable std::mutex addressIndexMutex;    ///< guards build of address index
 
 		/// @name Initialization methods
 		/// @{
@@ -52,6 +67,12 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		template<typename T> void initFormatArch(T derivedPtr, const retdec::config::Architecture &arch);
 		/// @}
 
+		/// @name Address index methods
+		/// @{
+		bool isAddressIndexValid() const;
+		void buildAddressIndex() const;
+		/// @}
+
 		/// @name Pure virtual initialization methods
 		/// @{
 		virtual std::size_t initSectionTableHashOffsets() = 0;
@@ -70,7 +91,7 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		std::vector<SymbolTable*> symbolTables;                           ///< symbol tables
 		std::vector<RelocationTable*> relocationTables;                   ///< relocation tables
 		std::vector<DynamicTable*> dynamicTables;                         ///< tables with dynamic records
-		std::vector<unsigned char> bytes;                                 ///< content of file as bytes
+		std::vector<unsigned char> bytes;                                 ///< content of file as bytes (if input is not memory-mapped)
 		std::vector<String> strings;                                      ///< detected strings
 		std::vector<ElfNoteSecSeg> noteSecSegs;                           ///< note sections or segemnts found in ELF file
 		std::set<std::uint64_t> unknownRelocs;                            ///< unknown relocations
@@ -92,6 +113,7 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		/// @name Clear methods
 		/// @{
 		void clear();
+		void invalidateAddressIndex();
 		/// @}
 
 		/// @name Protected detection methods
@@ -102,6 +124,7 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		/// @name Setters
 		/// @{
 		void setLoadedBytes(std::vector<unsigned char> *lBytes);
+		void appendBytes(const unsigned char *data, std::size_t size);
 		/// @}
 
 		FileFormat(std::istream &inputStream, LoadFlags loadFlags = LoadFlags::NONE);
@@ -198,6 +221,9 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		bool getAddressFromOffset(unsigned long long &result, unsigned long long offset) const;
 		bool getBytes(std::vector<std::uint8_t> &result, unsigned long long offset, unsigned long long numberOfBytes) const;
 		bool getEpBytes(std::vector<std::uint8_t> &result, unsigned long long numberOfBytes) const;
+		llvm::ArrayRef<std::uint8_t> getBytesView(unsigned long long offset, unsigned long long numberOfBytes) const;
+		llvm::ArrayRef<std::uint8_t> getEpBytesView(unsigned long long numberOfBytes) const;
+		llvm::ArrayRef<std::uint8_t> getXBytesView(std::uint64_t address, std::uint64_t x) const;
 		bool getHexBytes(std::string &result, unsigned long long offset, unsigned long long numberOfBytes) const;
 		bool getHexEpBytes(std::string &result, unsigned long long numberOfBytes) const;
 		bool getHexBytesFromEnd(std::string &result, unsigned long long numberOfBytes) const;
@@ -248,8 +274,8 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		const std::vector<SymbolTable*>& getSymbolTables() const;
 		const std::vector<RelocationTable*>& getRelocationTables() const;
 		const std::vector<DynamicTable*>& getDynamicTables() const;
-		const std::vector<unsigned char>& getBytes() const;
-		const std::vector<unsigned char>& getLoadedBytes() const;
+		llvm::ArrayRef<unsigned char> getBytes() const;
+		llvm::ArrayRef<unsigned char> getLoadedBytes() const;
 		const unsigned char* getBytesData() const;
 		const unsigned char* getLoadedBytesData() const;
 		const std::vector<String>& getStrings() const;
@@ -34,14 +34,13 @@ class MachOFormat : public FileFormat
 		unsigned long long entryPointOffset = 0;                       ///< entry point offset
 		std::uint32_t chosenArchOffset = 0;                            ///< offset of chosen architecture from universal binary
 		std::uint32_t chosenArchSize = 0;                              ///< size of chosen architecture from universal binary
-		std::vector<std::uint8_t> chosenArchBytes;                     ///< bytes of chosen architecture from universal binary
 		std::size_t sectionCounter = 0;                                ///< number of segment commands found
 		std::size_t segmentCounter = 0;                                ///< number of section commands found
 		std::vector<MachOSymbol> symbols;                              ///< temporary symbol representation
 		std::vector<unsigned long long> indirectTable;                 ///< indirect table for import addresses
 		llvm::MachO::mach_header header32;                             ///< 32 bit Mach-O header
 		llvm::MachO::mach_header_64 header64;                          ///< 64 bit Mach-O header
-		llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> fileBuffer; ///< LLVM buffer of input file
+		llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> fileBuffer; ///< LLVM buffer referencing content of input file
 
 		/// @name Auxiliary initialization methods
 		/// @{
@@ -40,8 +40,8 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<BreakStmt> stmt) override;
-	virtual void visit(ShPtr<GotoStmt> stmt) override;
+	virtual void visit(const ShPtr<BreakStmt> &stmt) override;
+	virtual void visit(const ShPtr<GotoStmt> &stmt) override;
 	/// @}
 
 private:
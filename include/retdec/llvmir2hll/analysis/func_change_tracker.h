@@ -0,0 +1,83 @@
+/**
+* @file include/retdec/llvmir2hll/analysis/func_change_tracker.h
+* @brief Tracking of changes of functions between runs of analyses.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_ANALYSIS_FUNC_CHANGE_TRACKER_H
+#define RETDEC_LLVMIR2HLL_ANALYSIS_FUNC_CHANGE_TRACKER_H
+
+#include <cstddef>
+#include <map>
+
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/llvmir2hll/support/types.h"
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class Function;
+class Module;
+
+/**
+* @brief Tracks which functions of a module have changed since an analysis or
+*        optimization processed them.
+*
+* A client marks functions as up to date after it has processed them (e.g.
+* computed their CFGs). Later, getChangedFuncs() returns functions that have
+* been added or modified since then, so the client may recompute its results
+* only for them.
+*
+* Changes are detected by comparing fingerprints of functions. A fingerprint
+* is computed from the identity (address) of every statement and expression in
+* the body of the function and from the values of constants, so any code
+* modifying the module is detected without the need to report the changes.
+* Renaming of variables or changing their types does not change fingerprints.
+*
+* Instances of this class have reference object semantics.
+*/
+class FuncChangeTracker: private retdec::utils::NonCopyable {
+public:
+	static ShPtr<FuncChangeTracker> create(ShPtr<Module> module,
+		bool trackGlobalVars = false);
+
+	FuncSet getChangedFuncs() const;
+	bool hasChanged(ShPtr<Function> func) const;
+	void markAsUpToDate(const FuncSet &funcs);
+	void markAsChanged(const FuncSet &funcs);
+
+	static std::size_t getFingerprint(ShPtr<Function> func);
+
+private:
+	/// Fingerprints of a function and of global variables from the time the
+	/// function was marked as up to date.
+	struct Fingerprints {
+		std::size_t func;
+		std::size_t globalVars;
+	};
+
+	/// Mapping of a function into its fingerprints.
+	using FuncFingerprintsMap = std::map<ShPtr<Function>, Fingerprints>;
+
+private:
+	FuncChangeTracker(ShPtr<Module> module, bool trackGlobalVars);
+
+	std::size_t getGlobalVarsFingerprint() const;
+	bool hasChanged(ShPtr<Function> func, std::size_t globalVarsFingerprint) const;
+
+private:
+	/// Module whose functions are tracked.
+	ShPtr<Module> module;
+
+	/// Should all functions be considered changed when global variables change?
+	bool trackGlobalVars;
+
+	/// Fingerprints of functions marked as up to date.
+	FuncFingerprintsMap upToDateFuncs;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
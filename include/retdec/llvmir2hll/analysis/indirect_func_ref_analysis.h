@@ -65,8 +65,8 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<CallExpr> expr) override;
-	virtual void visit(ShPtr<Variable> var) override;
+	virtual void visit(const ShPtr<CallExpr> &expr) override;
+	virtual void visit(const ShPtr<Variable> &var) override;
 	/// @}
 
 private:
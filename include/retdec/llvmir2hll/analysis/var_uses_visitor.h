@@ -71,7 +71,8 @@ public:
 	/// @}
 
 	static ShPtr<VarUsesVisitor> create(ShPtr<ValueAnalysis> va,
-		bool enableCaching = false, ShPtr<Module> module = nullptr);
+		bool enableCaching = false, ShPtr<Module> module = nullptr,
+		const FuncSet &funcs = FuncSet());
 
 private:
 	/// Mapping of a variable into its uses.
@@ -85,27 +86,27 @@ private:
 private:
 	VarUsesVisitor(ShPtr<ValueAnalysis> va, bool enableCaching = false);
 
-	void precomputeEverything(ShPtr<Module> module);
+	void precomputeEverything(ShPtr<Module> module, const FuncSet &funcs);
 	void findAndStoreUses(ShPtr<Statement> stmt);
 	void dumpCache();
 
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<AssignStmt> stmt) override;
-	virtual void visit(ShPtr<VarDefStmt> stmt) override;
-	virtual void visit(ShPtr<CallStmt> stmt) override;
-	virtual void visit(ShPtr<ReturnStmt> stmt) override;
-	virtual void visit(ShPtr<EmptyStmt> stmt) override;
-	virtual void visit(ShPtr<IfStmt> stmt) override;
-	virtual void visit(ShPtr<SwitchStmt> stmt) override;
-	virtual void visit(ShPtr<WhileLoopStmt> stmt) override;
-	virtual void visit(ShPtr<ForLoopStmt> stmt) override;
-	virtual void visit(ShPtr<UForLoopStmt> stmt) override;
-	virtual void visit(ShPtr<BreakStmt> stmt) override;
-	virtual void visit(ShPtr<ContinueStmt> stmt) override;
-	virtual void visit(ShPtr<GotoStmt> stmt) override;
-	virtual void visit(ShPtr<UnreachableStmt> stmt) override;
+	virtual void visit(const ShPtr<AssignStmt> &stmt) override;
+	virtual void visit(const ShPtr<VarDefStmt> &stmt) override;
+	virtual void visit(const ShPtr<CallStmt> &stmt) override;
+	virtual void visit(const ShPtr<ReturnStmt> &stmt) override;
+	virtual void visit(const ShPtr<EmptyStmt> &stmt) override;
+	virtual void visit(const ShPtr<IfStmt> &stmt) override;
+	virtual void visit(const ShPtr<SwitchStmt> &stmt) override;
+	virtual void visit(const ShPtr<WhileLoopStmt> &stmt) override;
+	virtual void visit(const ShPtr<ForLoopStmt> &stmt) override;
+	virtual void visit(const ShPtr<UForLoopStmt> &stmt) override;
+	virtual void visit(const ShPtr<BreakStmt> &stmt) override;
+	virtual void visit(const ShPtr<ContinueStmt> &stmt) override;
+	virtual void visit(const ShPtr<GotoStmt> &stmt) override;
+	virtual void visit(const ShPtr<UnreachableStmt> &stmt) override;
 	/// @}
 
 private:
@@ -0,0 +1,208 @@
+/**
+* @file include/retdec/llvmir2hll/decompiler.h
+* @brief Conversion of LLVM IR into the target high-level language.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_DECOMPILER_H
+#define RETDEC_LLVMIR2HLL_DECOMPILER_H
+
+#include <string>
+
+#include <llvm/IR/Module.h>
+#include <llvm/Pass.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "retdec/llvmir2hll/pattern/pattern_finder_runner.h"
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/llvmir2hll/support/types.h"
+#include "retdec/utils/profiler.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class AliasAnalysis;
+class ArithmExprEvaluator;
+class CallInfoObtainer;
+class Config;
+class HLLWriter;
+class LLVMIR2BIRConverter;
+class Module;
+class Semantics;
+class VarNameGen;
+class VarRenamer;
+
+/**
+* @brief Options of the decompilation of LLVM IR into the target HLL.
+*
+* They correspond to the command-line parameters of llvmir2hll. For their
+* description, run llvmir2hll with `-help`.
+*/
+struct DecompilerOptions {
+	std::string targetHll = "c";
+	bool debug = false;
+	std::string semantics;
+	std::string configPath;
+	bool emitDebugComments = false;
+	std::string enabledOpts;
+	std::string disabledOpts;
+	bool noOpts = false;
+	bool aggressiveOpts = false;
+	bool noVarRenaming = false;
+	bool noSymbolicNames = false;
+	bool keepAllBrackets = false;
+	bool keepLibraryFunctions = false;
+	bool noTimeVaryingInfo = false;
+	bool noCompoundOperators = false;
+	bool validateModule = false;
+	std::string findPatterns;
+	std::string aliasAnalysis = "simple";
+	std::string varNameGen = "fruit";
+	std::string varNameGenPrefix;
+	std::string varRenamer = "readable";
+	std::string llvmir2BirConverter = "orig";
+	bool emitCfgs = false;
+	std::string cfgWriter = "dot";
+	bool emitCg = false;
+	std::string cgWriter = "dot";
+	std::string callInfoObtainer = "optim";
+	std::string arithmExprEvaluator = "c";
+	std::string forcedModuleName;
+	bool strictFpuSemantics = false;
+	unsigned long long maxMemoryLimit = 0;
+	bool maxMemoryLimitHalfRam = false;
+	/// Number of threads running function-local optimizations (@c 0 means
+	/// the number of CPU cores).
+	unsigned threads = 1;
+	/// Base name of the files into which CFGs and CGs are emitted.
+	std::string outputFile;
+	/// If non-null, phases and optimizations are recorded in this profiler.
+	retdec::utils::Profiler *profiler = nullptr;
+};
+
+/**
+* @brief This class is the main chunk of code that converts an LLVM
+*        module to the specified high-level language (HLL).
+*
+* The decompilation is composed of the following steps:
+* 1) Decompiler is instantiated with the output stream, where the target
+*    code will be emitted, and with the options of the decompilation.
+* 2) The function runOnModule() is called, which decompiles the given
+*    LLVM IR into BIR (backend IR).
+* 3) The resulting IR is then converted into the requested HLL at the end of
+*    runOnModule().
+*
+* The pass requires @c LoopInfoWrapperPass and @c ScalarEvolutionWrapperPass,
+* so they have to be registered before it is run.
+*
+* The config is either given to the constructor (then it is used as it is and
+* it is not loaded nor saved), or it is loaded from and saved into the path
+* from the options.
+*/
+class Decompiler: public llvm::ModulePass {
+public:
+	Decompiler(llvm::raw_pwrite_stream &out, const DecompilerOptions &options,
+		ShPtr<Config> config = nullptr);
+
+	virtual const char *getPassName() const override { return "Decompiler"; }
+	virtual bool runOnModule(llvm::Module &m) override;
+
+	bool hasSucceeded() const;
+
+public:
+	/// Class identification.
+	static char ID;
+
+private:
+	virtual void getAnalysisUsage(llvm::AnalysisUsage &au) const override;
+
+	void startPhase(const std::string &phase);
+	void endPhase();
+	bool initialize(llvm::Module &m);
+	bool limitMaximalMemoryIfRequested();
+	void createSemantics();
+	void createSemanticsFromParameter();
+	void createSemanticsFromLLVMIR();
+	bool loadConfig();
+	void saveConfig();
+	void convertLLVMIRToBIR();
+	void removeLibraryFuncs();
+	void removeCodeUnreachableInCFG();
+	void removeFuncsPrefixedWith(const StringSet &prefixes);
+	void fixSignedUnsignedTypes();
+	void convertLLVMIntrinsicFunctions();
+	void obtainDebugInfo();
+	void initAliasAnalysis();
+	void runOptimizations();
+	void renameVariables();
+	void convertConstantsToSymbolicNames();
+	void validateResultingModule();
+	void findPatterns();
+	void emitCFGs();
+	void emitCG();
+	void emitTargetHLLCode();
+	void finalize();
+	void cleanup();
+
+	StringSet parseListOfOpts(const std::string &opts) const;
+	std::string getTypeOfRunOptimizations() const;
+	StringVector getIdsOfPatternFindersToBeRun() const;
+	PatternFinderRunner::PatternFinders instantiatePatternFinders(
+		const StringVector &pfsIds);
+	ShPtr<PatternFinderRunner> instantiatePatternFinderRunner() const;
+	StringSet getPrefixesOfFuncsToBeRemoved() const;
+
+private:
+	/// Output stream into which the generated code will be emitted.
+	llvm::raw_pwrite_stream &out;
+
+	/// Options of the decompilation.
+	DecompilerOptions options;
+
+	/// The input LLVM module.
+	llvm::Module *llvmModule;
+
+	/// The resulting module in BIR.
+	ShPtr<Module> resModule;
+
+	/// The used semantics.
+	ShPtr<Semantics> semantics;
+
+	/// The used config.
+	ShPtr<Config> config;
+
+	/// Has the config been given from outside?
+	bool configGiven;
+
+	/// The used HLL writer.
+	ShPtr<HLLWriter> hllWriter;
+
+	/// The used alias analysis.
+	ShPtr<AliasAnalysis> aliasAnalysis;
+
+	/// The used obtainer of information about function and function calls.
+	ShPtr<CallInfoObtainer> cio;
+
+	/// The used evaluator of arithmetical expressions.
+	ShPtr<ArithmExprEvaluator> arithmExprEvaluator;
+
+	/// The used generator of variable names.
+	ShPtr<VarNameGen> varNameGen;
+
+	/// The used renamer of variables.
+	ShPtr<VarRenamer> varRenamer;
+
+	/// The used convereter of LLVM IR to BIR.
+	ShPtr<LLVMIR2BIRConverter> llvm2BIRConverter;
+
+	/// Is a phase recorded in the profiler from the options running?
+	bool phaseRunning;
+
+	/// Has the last run of the decompilation finished successfully?
+	bool succeeded;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -43,21 +43,21 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<Function> func) override;
-	virtual void visit(ShPtr<AssignStmt> stmt) override;
-	virtual void visit(ShPtr<VarDefStmt> stmt) override;
-	virtual void visit(ShPtr<CallStmt> stmt) override;
-	virtual void visit(ShPtr<ReturnStmt> stmt) override;
-	virtual void visit(ShPtr<EmptyStmt> stmt) override;
-	virtual void visit(ShPtr<IfStmt> stmt) override;
-	virtual void visit(ShPtr<SwitchStmt> stmt) override;
-	virtual void visit(ShPtr<WhileLoopStmt> stmt) override;
-	virtual void visit(ShPtr<ForLoopStmt> stmt) override;
-	virtual void visit(ShPtr<UForLoopStmt> stmt) override;
-	virtual void visit(ShPtr<BreakStmt> stmt) override;
-	virtual void visit(ShPtr<ContinueStmt> stmt) override;
-	virtual void visit(ShPtr<GotoStmt> stmt) override;
-	virtual void visit(ShPtr<UnreachableStmt> stmt) override;
+	virtual void visit(const ShPtr<Function> &func) override;
+	virtual void visit(const ShPtr<AssignStmt> &stmt) override;
+	virtual void visit(const ShPtr<VarDefStmt> &stmt) override;
+	virtual void visit(const ShPtr<CallStmt> &stmt) override;
+	virtual void visit(const ShPtr<ReturnStmt> &stmt) override;
+	virtual void visit(const ShPtr<EmptyStmt> &stmt) override;
+	virtual void visit(const ShPtr<IfStmt> &stmt) override;
+	virtual void visit(const ShPtr<SwitchStmt> &stmt) override;
+	virtual void visit(const ShPtr<WhileLoopStmt> &stmt) override;
+	virtual void visit(const ShPtr<ForLoopStmt> &stmt) override;
+	virtual void visit(const ShPtr<UForLoopStmt> &stmt) override;
+	virtual void visit(const ShPtr<BreakStmt> &stmt) override;
+	virtual void visit(const ShPtr<ContinueStmt> &stmt) override;
+	virtual void visit(const ShPtr<GotoStmt> &stmt) override;
+	virtual void visit(const ShPtr<UnreachableStmt> &stmt) override;
 	virtual void visitStmt(ShPtr<Statement> stmt, bool visitSuccessors = true,
 		bool visitNestedStmts = true) override;
 	/// @}
@@ -77,16 +77,16 @@ private:
 	/// @name OrderedAllVisitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<AddOpExpr> expr) override;
-	virtual void visit(ShPtr<SubOpExpr> expr) override;
-	virtual void visit(ShPtr<MulOpExpr> expr) override;
-	virtual void visit(ShPtr<ModOpExpr> expr) override;
-	virtual void visit(ShPtr<DivOpExpr> expr) override;
-	virtual void visit(ShPtr<BitAndOpExpr> expr) override;
-	virtual void visit(ShPtr<BitOrOpExpr> expr) override;
-	virtual void visit(ShPtr<BitXorOpExpr> expr) override;
-	virtual void visit(ShPtr<BitShlOpExpr> expr) override;
-	virtual void visit(ShPtr<BitShrOpExpr> expr) override;
+	virtual void visit(const ShPtr<AddOpExpr> &expr) override;
+	virtual void visit(const ShPtr<SubOpExpr> &expr) override;
+	virtual void visit(const ShPtr<MulOpExpr> &expr) override;
+	virtual void visit(const ShPtr<ModOpExpr> &expr) override;
+	virtual void visit(const ShPtr<DivOpExpr> &expr) override;
+	virtual void visit(const ShPtr<BitAndOpExpr> &expr) override;
+	virtual void visit(const ShPtr<BitOrOpExpr> &expr) override;
+	virtual void visit(const ShPtr<BitXorOpExpr> &expr) override;
+	virtual void visit(const ShPtr<BitShlOpExpr> &expr) override;
+	virtual void visit(const ShPtr<BitShrOpExpr> &expr) override;
 	/// @}
 
 	/// @name Specializations To What Optimize
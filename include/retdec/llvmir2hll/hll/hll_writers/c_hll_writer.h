@@ -56,77 +56,77 @@ private:
 
 	/// @name Visitor Interface
 	/// @{
-	virtual void visit(ShPtr<GlobalVarDef> varDef) override;
-	virtual void visit(ShPtr<Function> func) override;
-	virtual void visit(ShPtr<Variable> var) override;
-	virtual void visit(ShPtr<AddressOpExpr> expr) override;
-	virtual void visit(ShPtr<AssignOpExpr> expr) override;
-	virtual void visit(ShPtr<ArrayIndexOpExpr> expr) override;
-	virtual void visit(ShPtr<StructIndexOpExpr> expr) override;
-	virtual void visit(ShPtr<DerefOpExpr> expr) override;
-	virtual void visit(ShPtr<NotOpExpr> expr) override;
-	virtual void visit(ShPtr<NegOpExpr> expr) override;
-	virtual void visit(ShPtr<EqOpExpr> expr) override;
-	virtual void visit(ShPtr<NeqOpExpr> expr) override;
-	virtual void visit(ShPtr<LtEqOpExpr> expr) override;
-	virtual void visit(ShPtr<GtEqOpExpr> expr) override;
-	virtual void visit(ShPtr<LtOpExpr> expr) override;
-	virtual void visit(ShPtr<GtOpExpr> expr) override;
-	virtual void visit(ShPtr<AddOpExpr> expr) override;
-	virtual void visit(ShPtr<SubOpExpr> expr) override;
-	virtual void visit(ShPtr<MulOpExpr> expr) override;
-	virtual void visit(ShPtr<ModOpExpr> expr) override;
-	virtual void visit(ShPtr<DivOpExpr> expr) override;
-	virtual void visit(ShPtr<AndOpExpr> expr) override;
-	virtual void visit(ShPtr<OrOpExpr> expr) override;
-	virtual void visit(ShPtr<BitAndOpExpr> expr) override;
-	virtual void visit(ShPtr<BitOrOpExpr> expr) override;
-	virtual void visit(ShPtr<BitXorOpExpr> expr) override;
-	virtual void visit(ShPtr<BitShlOpExpr> expr) override;
-	virtual void visit(ShPtr<BitShrOpExpr> expr) override;
-	virtual void visit(ShPtr<TernaryOpExpr> expr) override;
-	virtual void visit(ShPtr<CallExpr> expr) override;
-	virtual void visit(ShPtr<CommaOpExpr> expr) override;
-	virtual void visit(ShPtr<ConstBool> constant) override;
-	virtual void visit(ShPtr<ConstFloat> constant) override;
-	virtual void visit(ShPtr<ConstInt> constant) override;
-	virtual void visit(ShPtr<ConstNullPointer> constant) override;
-	virtual void visit(ShPtr<ConstString> constant) override;
-	virtual void visit(ShPtr<ConstArray> constant) override;
-	virtual void visit(ShPtr<ConstStruct> constant) override;
-	virtual void visit(ShPtr<ConstSymbol> constant) override;
-	virtual void visit(ShPtr<AssignStmt> stmt) override;
-	virtual void visit(ShPtr<VarDefStmt> stmt) override;
-	virtual void visit(ShPtr<CallStmt> stmt) override;
-	virtual void visit(ShPtr<ReturnStmt> stmt) override;
-	virtual void visit(ShPtr<EmptyStmt> stmt) override;
-	virtual void visit(ShPtr<IfStmt> stmt) override;
-	virtual void visit(ShPtr<SwitchStmt> stmt) override;
-	virtual void visit(ShPtr<WhileLoopStmt> stmt) override;
-	virtual void visit(ShPtr<ForLoopStmt> stmt) override;
-	virtual void visit(ShPtr<UForLoopStmt> stmt) override;
-	virtual void visit(ShPtr<BreakStmt> stmt) override;
-	virtual void visit(ShPtr<ContinueStmt> stmt) override;
-	virtual void visit(ShPtr<GotoStmt> stmt) override;
-	virtual void visit(ShPtr<UnreachableStmt> stmt) override;
+	virtual void visit(const ShPtr<GlobalVarDef> &varDef) override;
+	virtual void visit(const ShPtr<Function> &func) override;
+	virtual void visit(const ShPtr<Variable> &var) override;
+	virtual void visit(const ShPtr<AddressOpExpr> &expr) override;
+	virtual void visit(const ShPtr<AssignOpExpr> &expr) override;
+	virtual void visit(const ShPtr<ArrayIndexOpExpr> &expr) override;
+	virtual void visit(const ShPtr<StructIndexOpExpr> &expr) override;
+	virtual void visit(const ShPtr<DerefOpExpr> &expr) override;
+	virtual void visit(const ShPtr<NotOpExpr> &expr) override;
+	virtual void visit(const ShPtr<NegOpExpr> &expr) override;
+	virtual void visit(const ShPtr<EqOpExpr> &expr) override;
+	virtual void visit(const ShPtr<NeqOpExpr> &expr) override;
+	virtual void visit(const ShPtr<LtEqOpExpr> &expr) override;
+	virtual void visit(const ShPtr<GtEqOpExpr> &expr) override;
+	virtual void visit(const ShPtr<LtOpExpr> &expr) override;
+	virtual void visit(const ShPtr<GtOpExpr> &expr) override;
+	virtual void visit(const ShPtr<AddOpExpr> &expr) override;
+	virtual void visit(const ShPtr<SubOpExpr> &expr) override;
+	virtual void visit(const ShPtr<MulOpExpr> &expr) override;
+	virtual void visit(const ShPtr<ModOpExpr> &expr) override;
+	virtual void visit(const ShPtr<DivOpExpr> &expr) override;
+	virtual void visit(const ShPtr<AndOpExpr> &expr) override;
+	virtual void visit(const ShPtr<OrOpExpr> &expr) override;
+	virtual void visit(const ShPtr<BitAndOpExpr> &expr) override;
+	virtual void visit(const ShPtr<BitOrOpExpr> &expr) override;
+	virtual void visit(const ShPtr<BitXorOpExpr> &expr) override;
+	virtual void visit(const ShPtr<BitShlOpExpr> &expr) override;
+	virtual void visit(const ShPtr<BitShrOpExpr> &expr) override;
+	virtual void visit(const ShPtr<TernaryOpExpr> &expr) override;
+	virtual void visit(const ShPtr<CallExpr> &expr) override;
+	virtual void visit(const ShPtr<CommaOpExpr> &expr) override;
+	virtual void visit(const ShPtr<ConstBool> &constant) override;
+	virtual void visit(const ShPtr<ConstFloat> &constant) override;
+	virtual void visit(const ShPtr<ConstInt> &constant) override;
+	virtual void visit(const ShPtr<ConstNullPointer> &constant) override;
+	virtual void visit(const ShPtr<ConstString> &constant) override;
+	virtual void visit(const ShPtr<ConstArray> &constant) override;
+	virtual void visit(const ShPtr<ConstStruct> &constant) override;
+	virtual void visit(const ShPtr<ConstSymbol> &constant) override;
+	virtual void visit(const ShPtr<AssignStmt> &stmt) override;
+	virtual void visit(const ShPtr<VarDefStmt> &stmt) override;
+	virtual void visit(const ShPtr<CallStmt> &stmt) override;
+	virtual void visit(const ShPtr<ReturnStmt> &stmt) override;
+	virtual void visit(const ShPtr<EmptyStmt> &stmt) override;
+	virtual void visit(const ShPtr<IfStmt> &stmt) override;
+	virtual void visit(const ShPtr<SwitchStmt> &stmt) override;
+	virtual void visit(const ShPtr<WhileLoopStmt> &stmt) override;
+	virtual void visit(const ShPtr<ForLoopStmt> &stmt) override;
+	virtual void visit(const ShPtr<UForLoopStmt> &stmt) override;
+	virtual void visit(const ShPtr<BreakStmt> &stmt) override;
+	virtual void visit(const ShPtr<ContinueStmt> &stmt) override;
+	virtual void visit(const ShPtr<GotoStmt> &stmt) override;
+	virtual void visit(const ShPtr<UnreachableStmt> &stmt) override;
 	// Types
-	virtual void visit(ShPtr<FloatType> type) override;
-	virtual void visit(ShPtr<IntType> type) override;
-	virtual void visit(ShPtr<PointerType> type) override;
-	virtual void visit(ShPtr<StringType> type) override;
-	virtual void visit(ShPtr<ArrayType> type) override;
-	virtual void visit(ShPtr<StructType> type) override;
-	virtual void visit(ShPtr<FunctionType> type) override;
-	virtual void visit(ShPtr<VoidType> type) override;
-	virtual void visit(ShPtr<UnknownType> type) override;
+	virtual void visit(const ShPtr<FloatType> &type) override;
+	virtual void visit(const ShPtr<IntType> &type) override;
+	virtual void visit(const ShPtr<PointerType> &type) override;
+	virtual void visit(const ShPtr<StringType> &type) override;
+	virtual void visit(const ShPtr<ArrayType> &type) override;
+	virtual void visit(const ShPtr<StructType> &type) override;
+	virtual void visit(const ShPtr<FunctionType> &type) override;
+	virtual void visit(const ShPtr<VoidType> &type) override;
+	virtual void visit(const ShPtr<UnknownType> &type) override;
 	// Casts
-	virtual void visit(ShPtr<BitCastExpr> expr) override;
-	virtual void visit(ShPtr<ExtCastExpr> expr) override;
-	virtual void visit(ShPtr<TruncCastExpr> expr) override;
-	virtual void visit(ShPtr<FPToIntCastExpr> expr) override;
-	virtual void visit(ShPtr<IntToFPCastExpr> expr) override;
-	virtual void visit(ShPtr<IntToPtrCastExpr> expr) override;
-	virtual void visit(ShPtr<PtrToIntCastExpr> expr) override;
+	virtual void visit(const ShPtr<BitCastExpr> &expr) override;
+	virtual void visit(const ShPtr<ExtCastExpr> &expr) override;
+	virtual void visit(const ShPtr<TruncCastExpr> &expr) override;
+	virtual void visit(const ShPtr<FPToIntCastExpr> &expr) override;
+	virtual void visit(const ShPtr<IntToFPCastExpr> &expr) override;
+	virtual void visit(const ShPtr<IntToPtrCastExpr> &expr) override;
+	virtual void visit(const ShPtr<PtrToIntCastExpr> &expr) override;
 	/// @}
 
 	bool shouldEmitFunctionPrototypesHeader() const;
@@ -0,0 +1,55 @@
+/**
+* @file include/retdec/llvmir2hll/ir/arena/arena_const_operator_const_optimizer.h
+* @brief Evaluation of operators with constant operands in expressions stored
+*        in ExprArena.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_IR_ARENA_ARENA_CONST_OPERATOR_CONST_OPTIMIZER_H
+#define RETDEC_LLVMIR2HLL_IR_ARENA_ARENA_CONST_OPERATOR_CONST_OPTIMIZER_H
+
+#include "retdec/llvmir2hll/ir/arena/arena_visitor.h"
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief Evaluation of operators with constant operands in expressions stored
+*        in ExprArena.
+*
+* The counterpart of ConstOperatorConstSubOptimizer for integer operators in
+* ExprArena. For example,
+* @code
+* 2 + 3 * 4
+* @endcode
+* is replaced with
+* @code
+* 14
+* @endcode
+* Only operands of the same bit width and signedness are evaluated. Operators
+* whose result would overflow are kept, like in CArithmExprEvaluator.
+*
+* Use optimize() to perform the optimization.
+*/
+class ArenaConstOperatorConstOptimizer: private ArenaVisitor,
+		private retdec::utils::NonCopyable {
+public:
+	static ExprHandle optimize(ExprArena &arena, ExprHandle expr);
+
+private:
+	ArenaConstOperatorConstOptimizer(ExprArena &arena);
+
+	virtual void visitBinaryOp(ExprHandle expr) override;
+
+	void replaceWithConstInt(ExprHandle expr, const llvm::APSInt &value);
+
+private:
+	/// Root of the optimized expression.
+	ExprHandle root;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -0,0 +1,46 @@
+/**
+* @file include/retdec/llvmir2hll/ir/arena/arena_used_vars_visitor.h
+* @brief A visitor for obtaining the used variables in an expression stored in
+*        ExprArena.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_IR_ARENA_ARENA_USED_VARS_VISITOR_H
+#define RETDEC_LLVMIR2HLL_IR_ARENA_ARENA_USED_VARS_VISITOR_H
+
+#include "retdec/llvmir2hll/ir/arena/arena_visitor.h"
+#include "retdec/llvmir2hll/support/types.h"
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief A visitor for obtaining the used variables in an expression stored in
+*        ExprArena.
+*
+* The counterpart of UsedVarsVisitor for expressions. Variables in opaque
+* expressions are obtained by UsedVarsVisitor.
+*
+* Use getUsedVars() to obtain the variables.
+*/
+class ArenaUsedVarsVisitor: private ArenaVisitor,
+		private retdec::utils::NonCopyable {
+public:
+	static VarSet getUsedVars(ExprArena &arena, ExprHandle expr);
+
+private:
+	ArenaUsedVarsVisitor(ExprArena &arena);
+
+	virtual void visitVariable(ExprHandle expr) override;
+	virtual void visitOpaque(ExprHandle expr) override;
+
+private:
+	/// Variables found so far.
+	VarSet usedVars;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -0,0 +1,49 @@
+/**
+* @file include/retdec/llvmir2hll/ir/arena/arena_visitor.h
+* @brief A base class of visitors of expressions stored in ExprArena.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_IR_ARENA_ARENA_VISITOR_H
+#define RETDEC_LLVMIR2HLL_IR_ARENA_ARENA_VISITOR_H
+
+#include "retdec/llvmir2hll/ir/arena/expr_arena.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief A base class of visitors of expressions stored in ExprArena.
+*
+* The counterpart of OrderedAllVisitor for expressions in ExprArena. visit()
+* dispatches on the kind of the expression. By default, operators visit their
+* operands in order and other expressions do nothing. Unlike visitors of the
+* backend IR, no reference counts are changed during the traversal.
+*
+* A visitor may replace the visited expression in its parent (see
+* ExprArena::replace()) after its operands have been visited.
+*/
+class ArenaVisitor {
+public:
+	virtual ~ArenaVisitor();
+
+	void visit(ExprHandle expr);
+
+protected:
+	ArenaVisitor(ExprArena &arena);
+
+	virtual void visitVariable(ExprHandle expr);
+	virtual void visitConstInt(ExprHandle expr);
+	virtual void visitBinaryOp(ExprHandle expr);
+	virtual void visitUnaryOp(ExprHandle expr);
+	virtual void visitOpaque(ExprHandle expr);
+
+protected:
+	/// Arena of the visited expressions.
+	ExprArena &arena;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
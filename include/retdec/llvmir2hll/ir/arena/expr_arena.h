@@ -0,0 +1,201 @@
+/**
+* @file include/retdec/llvmir2hll/ir/arena/expr_arena.h
+* @brief A module-scoped arena of expressions addressed by handles.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_IR_ARENA_EXPR_ARENA_H
+#define RETDEC_LLVMIR2HLL_IR_ARENA_EXPR_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include <llvm/ADT/APSInt.h>
+
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class Expression;
+class Variable;
+
+/**
+* @brief A handle of an expression stored in ExprArena.
+*
+* A handle is just an index into the arena, so it is cheap to copy and it does
+* not own anything. It is valid as long as the arena that created it exists.
+*
+* Instances of this class have value object semantics.
+*/
+class ExprHandle {
+public:
+	/**
+	* @brief Constructs an invalid handle.
+	*/
+	ExprHandle(): index(INVALID_INDEX) {}
+
+	/**
+	* @brief Constructs a handle of the expression with the given @a index.
+	*/
+	explicit ExprHandle(std::uint32_t index): index(index) {}
+
+	/**
+	* @brief Returns @c true if the handle refers to an expression, @c false
+	*        otherwise.
+	*/
+	bool isValid() const { return index != INVALID_INDEX; }
+
+	/**
+	* @brief Returns the index of the expression in its arena.
+	*/
+	std::uint32_t getIndex() const { return index; }
+
+	bool operator==(const ExprHandle &other) const {
+		return index == other.index;
+	}
+
+	bool operator!=(const ExprHandle &other) const {
+		return index != other.index;
+	}
+
+private:
+	/// Index of invalid handles.
+	static constexpr std::uint32_t INVALID_INDEX =
+		std::numeric_limits<std::uint32_t>::max();
+
+private:
+	/// Index of the expression in its arena.
+	std::uint32_t index;
+};
+
+/**
+* @brief A module-scoped arena of expressions.
+*
+* This is an alternative representation of expressions in the backend IR (see
+* Expression). Expressions are stored in a single vector and refer to each
+* other by ExprHandle, so there is no reference counting and no per-node heap
+* allocation. Instead of the Observer/Subject lists of Value, every expression
+* knows its parent and every variable knows the expressions that use it.
+*
+* Only variables, integer constants, and integer arithmetic and bitwise
+* operators have their own kinds. Any other expression is stored as an opaque
+* expression which keeps the original Expression, so conversions from and
+* to the backend IR (see ExprArenaConverter) do not lose anything.
+*
+* Expressions are never freed one by one. They are freed all at once when the
+* arena is destroyed. A replaced expression stays in the arena, but it is
+* detached from its parent and the uses of variables in it are removed.
+*
+* Instances of this class have reference object semantics.
+*/
+class ExprArena: private retdec::utils::NonCopyable {
+public:
+	/// Kinds of expressions.
+	enum class Kind: std::uint8_t {
+		Variable,
+		ConstInt,
+		Add,
+		Sub,
+		Mul,
+		BitAnd,
+		BitOr,
+		BitXor,
+		Neg,
+		Opaque
+	};
+
+	/// Handles of expressions.
+	using ExprHandles = std::vector<ExprHandle>;
+
+public:
+	ExprArena();
+	~ExprArena();
+
+	/// @name Creation
+	/// @{
+	ExprHandle createVariable(ShPtr<Variable> var);
+	ExprHandle createConstInt(const llvm::APSInt &value);
+	ExprHandle createBinaryOp(Kind kind, ExprHandle op1, ExprHandle op2);
+	ExprHandle createUnaryOp(Kind kind, ExprHandle op);
+	ExprHandle createOpaque(ShPtr<Expression> expr);
+	/// @}
+
+	/// @name Accessors
+	/// @{
+	Kind getKind(ExprHandle expr) const;
+	std::size_t getNumOfOperands(ExprHandle expr) const;
+	ExprHandle getOperand(ExprHandle expr, std::size_t n) const;
+	ExprHandle getParent(ExprHandle expr) const;
+	ShPtr<Variable> getVariable(ExprHandle expr) const;
+	const llvm::APSInt &getConstInt(ExprHandle expr) const;
+	ShPtr<Expression> getOpaque(ExprHandle expr) const;
+	const ExprHandles &getUses(ShPtr<Variable> var) const;
+	/// @}
+
+	/// @name Modification
+	/// @{
+	void replace(ExprHandle oldExpr, ExprHandle newExpr);
+	/// @}
+
+	/// @name Statistics
+	/// @{
+	std::size_t getNumOfExprs() const;
+	std::size_t getMemoryUsage() const;
+	/// @}
+
+	static bool isBinaryOp(Kind kind);
+	static bool isUnaryOp(Kind kind);
+
+private:
+	/// Stored expression.
+	struct Node {
+		/// Kind of the expression.
+		Kind kind;
+
+		/// Parent expression (invalid for roots).
+		ExprHandle parent;
+
+		/// Operands (invalid if there are less than two of them).
+		ExprHandle ops[2];
+
+		/// Index into @c vars, @c ints, or @c opaques (depending on @c kind).
+		std::uint32_t data;
+	};
+
+private:
+	ExprHandle addNode(Kind kind, ExprHandle op1, ExprHandle op2,
+		std::uint32_t data);
+	const Node &getNode(ExprHandle expr) const;
+	Node &getNode(ExprHandle expr);
+	void setParent(ExprHandle expr, ExprHandle parent);
+	void removeUses(ExprHandle expr);
+
+private:
+	/// Stored expressions.
+	std::vector<Node> nodes;
+
+	/// Variables of variable expressions.
+	std::vector<ShPtr<Variable>> vars;
+
+	/// Indexes of variables in @c vars.
+	std::unordered_map<Variable *, std::uint32_t> varIndexes;
+
+	/// Uses of variables (in the same order as @c vars).
+	std::vector<ExprHandles> varUses;
+
+	/// Values of integer constants.
+	std::vector<llvm::APSInt> ints;
+
+	/// Original expressions of opaque expressions.
+	std::vector<ShPtr<Expression>> opaques;
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -0,0 +1,39 @@
+/**
+* @file include/retdec/llvmir2hll/ir/arena/expr_arena_converter.h
+* @brief Conversions of expressions between the backend IR and ExprArena.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_IR_ARENA_EXPR_ARENA_CONVERTER_H
+#define RETDEC_LLVMIR2HLL_IR_ARENA_EXPR_ARENA_CONVERTER_H
+
+#include "retdec/llvmir2hll/ir/arena/expr_arena.h"
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class Expression;
+
+/**
+* @brief Conversions of expressions between the backend IR and ExprArena.
+*
+* Expressions which have no kind in ExprArena are stored as opaque
+* expressions, so converting an expression into the arena and back gives an
+* equal expression.
+*
+* This class is not meant to be instantiated.
+*/
+class ExprArenaConverter {
+public:
+	ExprArenaConverter() = delete;
+
+	static ExprHandle toArena(ExprArena &arena, ShPtr<Expression> expr);
+	static ShPtr<Expression> toExpression(const ExprArena &arena,
+		ExprHandle expr);
+};
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -89,7 +89,7 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<CallExpr> expr) override;
+	virtual void visit(const ShPtr<CallExpr> &expr) override;
 	/// @}
 
 private:
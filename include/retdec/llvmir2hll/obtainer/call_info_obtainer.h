@@ -23,6 +23,7 @@ class CFG;
 class CFGBuilder;
 class CallExpr;
 class Function;
+class FuncChangeTracker;
 class Module;
 class ValueAnalysis;
 
@@ -324,6 +325,9 @@ protected:
 	/// The used builder of CFGs.
 	ShPtr<CFGBuilder> cfgBuilder;
 
+	/// Tracker of functions whose CFGs have to be rebuilt.
+	ShPtr<FuncChangeTracker> cfgTracker;
+
 private:
 	/**
 	* @brief A computation of strongly connected components (SCCs) from a call
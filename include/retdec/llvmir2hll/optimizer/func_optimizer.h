@@ -45,6 +45,8 @@ class FuncOptimizer: public Optimizer {
 public:
 	virtual ~FuncOptimizer() override;
 
+	void optimizeFunction(ShPtr<Function> func);
+
 protected:
 	FuncOptimizer(ShPtr<Module> module);
 
@@ -57,7 +59,7 @@ protected:
 	*
 	* This function is very handy in subclasses. Typical usage:
 	* @code
-	* void ForLoopOptimizer::visit(ShPtr<WhileLoopStmt> stmt) {
+	* void ForLoopOptimizer::visit(const ShPtr<WhileLoopStmt> &stmt) {
 	*     visitNestedAndSuccessorStatements(stmt);
 	*     tryConversionToForLoop(stmt);
 	* }
@@ -73,6 +75,10 @@ protected:
 protected:
 	/// Function that is currently being optimized.
 	ShPtr<Function> currFunc;
+
+private:
+	/// If non-null, only this function is optimized (see optimizeFunction()).
+	ShPtr<Function> onlyFunc;
 };
 
 } // namespace llvmir2hll
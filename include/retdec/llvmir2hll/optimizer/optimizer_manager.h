@@ -7,17 +7,24 @@
 #ifndef RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZER_MANAGER_H
 #define RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZER_MANAGER_H
 
+#include <functional>
+#include <string>
+#include <vector>
+
 #include "retdec/llvmir2hll/optimizer/optimizer.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/llvmir2hll/support/types.h"
 #include "retdec/llvm-support/diagnostics.h"
 #include "retdec/utils/non_copyable.h"
+#include "retdec/utils/profiler.h"
+#include "retdec/utils/thread_pool.h"
 
 namespace retdec {
 namespace llvmir2hll {
 
 class ArithmExprEvaluator;
 class CallInfoObtainer;
+class FuncOptimizer;
 class HLLWriter;
 class Module;
 class ValueAnalysis;
@@ -25,6 +32,14 @@ class ValueAnalysis;
 /**
 * @brief A manager managing optimizations.
 *
+* If more than one thread is used, consecutive function-local optimizations
+* (see isFunctionLocal()) are not run one after another over the whole module.
+* Instead, every function is optimized by all of them by one of the threads.
+* Other optimizations act as barriers: they are run after all functions are
+* optimized by the preceding function-local optimizations. Since every
+* function is optimized by the same optimizations in the same order, the
+* result does not depend on the number of threads.
+*
 * Instances of this class have reference object semantics. This class is not
 * meant to be subclassed.
 */
@@ -33,20 +48,62 @@ public:
 	OptimizerManager(const StringSet &enabledOpts, const StringSet &disabledOpts,
 		ShPtr<HLLWriter> hllWriter, ShPtr<ValueAnalysis> va,
 		ShPtr<CallInfoObtainer> cio, ShPtr<ArithmExprEvaluator> arithmExprEvaluator,
-		bool enableAggressiveOpts, bool enableDebug = false);
+		bool enableAggressiveOpts, bool enableDebug = false,
+		retdec::utils::Profiler *profiler = nullptr,
+		std::size_t threadCount = 1);
 	~OptimizerManager();
 
 	void optimize(ShPtr<Module> m);
 
+private:
+	/// Analyses and optimizers used by one thread optimizing functions.
+	struct FuncOptContext {
+		/// Value analysis of the thread (sharing the alias analysis).
+		ShPtr<ValueAnalysis> va;
+		/// Evaluator of arithmetical expressions of the thread.
+		ShPtr<ArithmExprEvaluator> arithmExprEvaluator;
+		/// Instances of the scheduled optimizers (in the same order).
+		std::vector<ShPtr<FuncOptimizer>> optimizers;
+	};
+
+	/// Creates an optimizer using analyses from the given context.
+	using FuncOptCreator = std::function<ShPtr<FuncOptimizer>(
+		FuncOptContext &)>;
+
+	/// A function-local optimization waiting to be run.
+	struct ScheduledFuncOpt {
+		std::string id;
+		FuncOptCreator create;
+	};
+
 private:
 	void printOptimization(const std::string &optName) const;
 	bool optShouldBeRun(const std::string &optName) const;
-	void runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimizer);
+	void runOptimizerProvidedItShouldBeRun(ShPtr<Module> m,
+		ShPtr<Optimizer> optimizer);
 	bool shouldSecondCopyPropagationBeRun() const;
 
 	template<typename Optimization, typename... Args>
 	void run(ShPtr<Module> m, Args &&... args);
 
+	/// @name Function-Local Optimizations
+	/// @{
+	static bool isFunctionLocal(const std::string &optId);
+	void scheduleFuncOptimizer(const std::string &optId,
+		FuncOptCreator create);
+	void runScheduledFuncOptimizers(ShPtr<Module> m);
+	UPtr<FuncOptContext> createFuncOptContext() const;
+
+	template<typename T>
+	static const T &forContext(const T &arg, FuncOptContext &) {
+		return arg;
+	}
+	static ShPtr<ValueAnalysis> forContext(const ShPtr<ValueAnalysis> &,
+		FuncOptContext &context);
+	static ShPtr<ArithmExprEvaluator> forContext(
+		const ShPtr<ArithmExprEvaluator> &, FuncOptContext &context);
+	/// @}
+
 private:
 	/// No other optimization than these will be run.
 	const StringSet enabledOpts;
@@ -72,11 +129,20 @@ private:
 	/// Enable emission of debug messages?
 	bool enableDebug;
 
+	/// Profiler recording the run optimizations (may be the null pointer).
+	retdec::utils::Profiler *profiler;
+
 	/// Should we recover from out-of-memory errors during optimizations?
 	bool recoverFromOutOfMemory;
 
 	/// List of our optimizations that were run.
 	StringSet backendRunOpts;
+
+	/// Threads optimizing functions (the null pointer if only one is used).
+	UPtr<retdec::utils::ThreadPool> threadPool;
+
+	/// Function-local optimizations to be run before the next barrier.
+	std::vector<ScheduledFuncOpt> scheduledFuncOpts;
 };
 
 } // namespace llvmir2hll
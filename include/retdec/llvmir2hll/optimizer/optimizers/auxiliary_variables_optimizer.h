@@ -52,8 +52,8 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	void visit(ShPtr<AssignStmt> stmt) override;
-	void visit(ShPtr<VarDefStmt> stmt) override;
+	void visit(const ShPtr<AssignStmt> &stmt) override;
+	void visit(const ShPtr<VarDefStmt> &stmt) override;
 	/// @}
 
 private:
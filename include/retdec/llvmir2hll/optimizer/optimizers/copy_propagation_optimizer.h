@@ -14,8 +14,10 @@
 namespace retdec {
 namespace llvmir2hll {
 
+class CG;
 class CallInfoObtainer;
 class DefUseAnalysis;
+class FuncChangeTracker;
 class DefUseChains;
 class UseDefAnalysis;
 class UseDefChains;
@@ -57,6 +59,11 @@ class VarUsesVisitor;
 * @endcode
 * provided that @c a is non-global.
 *
+* When the optimization is run several times over the same module, pass the
+* same FuncChangeTracker to all the runs. Then, every run optimizes only
+* functions that have changed (or whose callees have changed) since the
+* previous run; other functions are already optimized.
+*
 * Instances of this class have reference object semantics.
 *
 * This is a concrete optimizer which should not be subclassed.
@@ -64,7 +71,8 @@ class VarUsesVisitor;
 class CopyPropagationOptimizer final: public FuncOptimizer {
 public:
 	CopyPropagationOptimizer(ShPtr<Module> module, ShPtr<ValueAnalysis> va,
-		ShPtr<CallInfoObtainer> cio);
+		ShPtr<CallInfoObtainer> cio,
+		ShPtr<FuncChangeTracker> tracker = nullptr);
 
 	virtual ~CopyPropagationOptimizer() override;
 
@@ -87,6 +95,7 @@ private:
 	void handleCaseMoreThanOneUse(ShPtr<Statement> stmt, ShPtr<Variable> stmtLhsVar,
 		const StmtSet &uses);
 	bool shouldBeIncludedInDefUseChains(ShPtr<Variable> var);
+	FuncSet getFuncsToOptimize(ShPtr<CG> cg) const;
 
 private:
 	/// Analysis of values.
@@ -95,6 +104,16 @@ private:
 	/// Obtainer of information about function calls.
 	ShPtr<CallInfoObtainer> cio;
 
+	/// Tracker of functions that have changed since the previous run (may be
+	/// the null pointer).
+	ShPtr<FuncChangeTracker> tracker;
+
+	/// Functions that are optimized in this run.
+	FuncSet funcsToOptimize;
+
+	/// Functions that have been changed in this run.
+	FuncSet changedFuncs;
+
 	/// Visitor for obtaining uses of variables.
 	ShPtr<VarUsesVisitor> vuv;
 
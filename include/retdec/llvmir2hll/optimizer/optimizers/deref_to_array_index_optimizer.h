@@ -70,7 +70,7 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<DerefOpExpr> expr) override;
+	virtual void visit(const ShPtr<DerefOpExpr> &expr) override;
 	/// @}
 
 	Maybe<BaseAndIndex> getBaseAndIndexFromExprIfPossible(ShPtr<AddOpExpr> expr);
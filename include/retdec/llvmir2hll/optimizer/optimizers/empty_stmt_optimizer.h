@@ -34,7 +34,7 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<EmptyStmt> stmt) override;
+	virtual void visit(const ShPtr<EmptyStmt> &stmt) override;
 	/// @}
 };
 
@@ -65,7 +65,7 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using SubOptimizer::visit;
-	virtual void visit(ShPtr<NotOpExpr> expr) override;
+	virtual void visit(const ShPtr<NotOpExpr> &expr) override;
 	/// @}
 };
 
@@ -58,7 +58,7 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<ForLoopStmt> stmt) override;
+	virtual void visit(const ShPtr<ForLoopStmt> &stmt) override;
 	/// @}
 
 private:
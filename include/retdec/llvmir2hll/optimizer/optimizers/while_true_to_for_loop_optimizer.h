@@ -58,7 +58,7 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<WhileLoopStmt> stmt) override;
+	virtual void visit(const ShPtr<WhileLoopStmt> &stmt) override;
 	/// @}
 
 	ShPtr<Expression> computeStartValueOfForLoop(
@@ -8,31 +8,64 @@
 #define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_C_HEADER_FILE_FOR_FUNC_H
 
 #include <cstddef>
+#include <cstring>
+#include <string>
 
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/sorted_table.h"
 #include "retdec/llvmir2hll/support/maybe.h"
-#include "retdec/llvmir2hll/support/types.h"
-#include "retdec/utils/array.h"
+
+namespace retdec {
+namespace llvmir2hll {
+namespace semantics {
 
 /**
-* @brief Maps all the functions from array @a funcs into @a header by adding
-*        them into @a map.
+* @brief A function and the C header file in which it is declared.
 *
-* @param[in] funcs Statically allocated array of function names
-*                  (<tt>const char *</tt>).
-* @param[in] header The name of the header file (<tt>const char *</tt>).
-* @param[out] map A map into which the mappings will be stored.
+* Tables of these entries are constant-initialized, so they need no
+* initialization when the decompiler starts. They have to be sorted by
+* function names (see isSortedTable()).
 */
-#define ADD_FUNCS_TO_C_HEADER_MAP(funcs, header, map) \
-	for (std::size_t i = 0, e = retdec::utils::arraySize(funcs); i != e; ++i) { \
-		map[funcs[i]] = header; \
-	}
+struct FuncCHeader {
+	const char *funcName;
+	const char *header;
+};
 
-namespace retdec {
-namespace llvmir2hll {
-namespace semantics {
+/**
+* @brief Compares the given two entries by their function names.
+*/
+inline int compareTableEntries(const FuncCHeader &e1, const FuncCHeader &e2) {
+	return std::strcmp(e1.funcName, e2.funcName);
+}
 
-Maybe<std::string> getCHeaderFileForFuncFromMap(const std::string &funcName,
-		const StringStringUMap &map);
+/**
+* @brief A range <tt>[begin, end)</tt> of a sorted table of header files.
+*/
+struct FuncCHeadersTable {
+	const FuncCHeader *begin;
+	const FuncCHeader *end;
+};
+
+/**
+* @brief Returns a range covering the whole given table.
+*/
+template<std::size_t N>
+constexpr FuncCHeadersTable makeFuncCHeadersTable(
+		const FuncCHeader (&table)[N]) {
+	return FuncCHeadersTable{table, table + N};
+}
+
+Maybe<std::string> getCHeaderFileForFuncFromTable(const std::string &funcName,
+	const FuncCHeader *begin, const FuncCHeader *end);
+
+/**
+* @brief Returns the header name for the given function from the given sorted
+*        table.
+*/
+template<std::size_t N>
+Maybe<std::string> getCHeaderFileForFuncFromTable(const std::string &funcName,
+		const FuncCHeader (&table)[N]) {
+	return getCHeaderFileForFuncFromTable(funcName, table, table + N);
+}
 
 } // namespace semantics
 } // namespace llvmir2hll
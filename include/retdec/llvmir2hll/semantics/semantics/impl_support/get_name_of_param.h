@@ -8,40 +8,59 @@
 #define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_NAME_OF_PARAM_H
 
 #include <cstddef>
+#include <cstring>
 #include <string>
-#include <unordered_map>
 
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/sorted_table.h"
 #include "retdec/llvmir2hll/support/maybe.h"
 
-/**
-* @brief Sets a name of the given parameter for the given function.
-*/
-#define ADD_PARAM_NAME(funcName, paramPos, paramName) \
-	funcParamNamesMap[FuncParamPosPair(funcName, paramPos)] = paramName;
-
 namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 
-/// A pair of function name and parameter position.
-using FuncParamPosPair = std::pair<std::string, unsigned>;
+/**
+* @brief A name of a parameter of a function.
+*
+* Tables of these entries are constant-initialized, so they need no
+* initialization when the decompiler starts. They have to be sorted by
+* function names and parameter positions (see isSortedTable()).
+*/
+struct FuncParamName {
+	const char *funcName;
+	unsigned paramPos;
+	const char *paramName;
+};
 
 /**
-* @brief A hashing functor for FuncParamPosPair.
+* @brief Compares the given two entries by their function names and parameter
+*        positions.
 */
-struct FuncParamPosPairHasher {
-	std::size_t operator()(const FuncParamPosPair &p) const {
-		return std::hash<std::string>()(p.first) + p.second;
-	}
+inline int compareTableEntries(const FuncParamName &e1,
+		const FuncParamName &e2) {
+	int result = std::strcmp(e1.funcName, e2.funcName);
+	return result != 0 ? result :
+		static_cast<int>(e1.paramPos) - static_cast<int>(e2.paramPos);
+}
+
+/**
+* @brief A range <tt>[begin, end)</tt> of a sorted table of parameter names.
+*/
+struct FuncParamNamesTable {
+	const FuncParamName *begin;
+	const FuncParamName *end;
 };
 
-/// Mapping of a function name and parameter position into the name of this
-/// parameter.
-using FuncParamNamesMap = std::unordered_map<FuncParamPosPair, std::string,
-	FuncParamPosPairHasher>;
+/**
+* @brief Returns a range covering the whole given table.
+*/
+template<std::size_t N>
+constexpr FuncParamNamesTable makeFuncParamNamesTable(
+		const FuncParamName (&table)[N]) {
+	return FuncParamNamesTable{table, table + N};
+}
 
-Maybe<std::string> getNameOfParamFromMap(const std::string &funcName,
-	unsigned paramPos, const FuncParamNamesMap &map);
+Maybe<std::string> getNameOfParamFromTable(const std::string &funcName,
+	unsigned paramPos, const FuncParamNamesTable &table);
 
 } // namespace semantics
 } // namespace llvmir2hll
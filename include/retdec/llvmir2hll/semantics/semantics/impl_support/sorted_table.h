@@ -0,0 +1,41 @@
+/**
+* @file include/retdec/llvmir2hll/semantics/semantics/impl_support/sorted_table.h
+* @brief Support for implementing semantics by using sorted constant tables.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_SORTED_TABLE_H
+#define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_SORTED_TABLE_H
+
+#include <algorithm>
+
+namespace retdec {
+namespace llvmir2hll {
+namespace semantics {
+
+/**
+* @brief Returns @c true if the entries of the given table <tt>[begin, end)</tt>
+*        are strictly ascending, @c false otherwise.
+*
+* Entries are compared by <tt>compareTableEntries(e1, e2)</tt>, which has to
+* return a negative number, zero, or a positive number (like
+* @c std::strcmp()). Since such a table contains no duplicate keys, it can be
+* searched by binary search.
+*
+* The tables have thousands of entries, which is too much for checking them in
+* constant expressions, so their order is checked by unit tests.
+*/
+template<typename Entry>
+bool isSortedTable(const Entry *begin, const Entry *end) {
+	return std::adjacent_find(begin, end,
+		[](const Entry &e1, const Entry &e2) {
+			return compareTableEntries(e1, e2) >= 0;
+		}
+	) == end;
+}
+
+} // namespace semantics
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -10,6 +10,7 @@
 
 #include <string>
 
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/get_name_of_param.h"
 #include "retdec/llvmir2hll/support/maybe.h"
 
 namespace retdec {
@@ -19,6 +20,7 @@ namespace libc {
 
 Maybe<std::string> getNameOfParam(const std::string &funcName,
 	unsigned paramPos);
+FuncParamNamesTable getFuncParamNamesTable();
 
 } // namespace libc
 } // namespace semantics
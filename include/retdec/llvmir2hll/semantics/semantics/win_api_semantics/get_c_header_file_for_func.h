@@ -10,6 +10,7 @@
 
 #include <string>
 
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/get_c_header_file_for_func.h"
 #include "retdec/llvmir2hll/support/maybe.h"
 
 namespace retdec {
@@ -18,6 +19,7 @@ namespace semantics {
 namespace win_api {
 
 Maybe<std::string> getCHeaderFileForFunc(const std::string &funcName);
+FuncCHeadersTable getFuncCHeadersTable();
 
 } // namespace win_api
 } // namespace semantics
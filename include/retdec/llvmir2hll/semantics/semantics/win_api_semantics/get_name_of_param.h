@@ -9,7 +9,9 @@
 #define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_WIN_API_SEMANTICS_GET_NAME_OF_PARAM_H
 
 #include <string>
+#include <vector>
 
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/get_name_of_param.h"
 #include "retdec/llvmir2hll/support/maybe.h"
 
 namespace retdec {
@@ -19,6 +21,7 @@ namespace win_api {
 
 Maybe<std::string> getNameOfParam(const std::string &funcName,
 	unsigned paramPos);
+std::vector<FuncParamNamesTable> getFuncParamNamesTables();
 
 } // namespace win_api
 } // namespace semantics
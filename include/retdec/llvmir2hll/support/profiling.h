@@ -0,0 +1,23 @@
+/**
+* @file include/retdec/llvmir2hll/support/profiling.h
+* @brief Support for profiling of the decompilation phases.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_SUPPORT_PROFILING_H
+#define RETDEC_LLVMIR2HLL_SUPPORT_PROFILING_H
+
+#include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/utils/profiler.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+class Module;
+
+retdec::utils::Profiler::Sizes getModuleSize(ShPtr<Module> module);
+
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
@@ -8,6 +8,9 @@
 #define RETDEC_LLVMIR2HLL_SUPPORT_SUBJECT_H
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 #include <vector>
 
 #include "retdec/llvmir2hll/support/smart_ptr.h"
@@ -15,6 +18,43 @@
 namespace retdec {
 namespace llvmir2hll {
 
+/**
+* @brief Enables locking of the lists of observers of all subjects during its
+*        lifetime.
+*
+* Lists of observers are changed from several threads only when functions are
+* optimized in parallel (see OptimizerManager), so they are locked only when
+* an instance of this class exists. It has to be created before the threads
+* are started and destroyed after they are joined.
+*/
+class ObserversLocking {
+public:
+	ObserversLocking() {
+		++getNumOfInstances();
+	}
+
+	~ObserversLocking() {
+		--getNumOfInstances();
+	}
+
+	ObserversLocking(const ObserversLocking &) = delete;
+	ObserversLocking &operator=(const ObserversLocking &) = delete;
+
+	/**
+	* @brief Returns @c true if the lists of observers have to be locked,
+	*        @c false otherwise.
+	*/
+	static bool isEnabled() {
+		return getNumOfInstances().load(std::memory_order_relaxed) > 0;
+	}
+
+private:
+	static std::atomic<std::size_t> &getNumOfInstances() {
+		static std::atomic<std::size_t> numOfInstances(0);
+		return numOfInstances;
+	}
+};
+
 /**
 * @brief Implementation of a generic typed observer using shared pointers
 *        (subject part).
@@ -37,6 +77,11 @@ namespace llvmir2hll {
 * };
 * @endcode
 *
+* Lists of observers may be changed from several threads at once (e.g. a
+* global variable is used in functions optimized in parallel), so they are
+* guarded by mutexes while an instance of ObserversLocking exists. Observers
+* themselves are notified without holding any lock.
+*
 * @see Observer
 */
 template<typename SubjectType, typename ArgType = SubjectType>
@@ -89,6 +134,7 @@ public:
 	* @param[in] observer Observer to be added.
 	*/
 	void addObserver(ObserverPtr observer) {
+		auto lock = lockObservers();
 		observers.push_back(observer);
 	}
 
@@ -98,6 +144,7 @@ public:
 	* @param[in] observer Observer to be removed.
 	*/
 	void removeObserver(ObserverPtr observer) {
+		auto lock = lockObservers();
 		removeObserverAndNonExistingObservers(observer);
 	}
 
@@ -105,6 +152,7 @@ public:
 	* @brief Removes all observers.
 	*/
 	void removeObservers() {
+		auto lock = lockObservers();
 		observers.clear();
 	}
 
@@ -125,7 +173,16 @@ public:
 	void notifyObservers(ShPtr<ArgType> arg = nullptr) {
 		// We have to iterate over a copy of the container because it can be
 		// modified during the iteration (either by us or in an update() call).
-		for (const auto &observer : ObserverContainer(observers)) {
+		ObserverContainer observersToNotify;
+		{
+			auto lock = lockObservers();
+			if (observers.empty()) {
+				return;
+			}
+			observersToNotify = observers;
+		}
+
+		for (const auto &observer : observersToNotify) {
 			notifyObserverOrRemoveItIfNotExists(observer, arg);
 		}
 	}
@@ -155,6 +212,35 @@ protected:
 	}
 
 private:
+	/// Number of mutexes guarding lists of observers.
+	static constexpr std::size_t NUM_OF_OBSERVERS_MUTEXES = 64;
+
+private:
+	/**
+	* @brief Returns the mutex guarding the list of observers.
+	*
+	* A mutex per subject would make every value much larger, so subjects share
+	* a fixed number of mutexes selected by their addresses.
+	*/
+	std::mutex &getObserversMutex() const {
+		static std::mutex mutexes[NUM_OF_OBSERVERS_MUTEXES];
+		return mutexes[(reinterpret_cast<std::uintptr_t>(this) >> 4) %
+			NUM_OF_OBSERVERS_MUTEXES];
+	}
+
+	/**
+	* @brief Locks the list of observers if it may be changed from several
+	*        threads at once.
+	*
+	* @return Lock owning the mutex returned by getObserversMutex() if an
+	*         instance of ObserversLocking exists, an empty lock otherwise.
+	*/
+	std::unique_lock<std::mutex> lockObservers() const {
+		if (!ObserversLocking::isEnabled()) {
+			return std::unique_lock<std::mutex>();
+		}
+		return std::unique_lock<std::mutex>(getObserversMutex());
+	}
 
 	/**
 	* @brief Notifies the given observer (if it exists) or removes it (if it
@@ -187,13 +273,18 @@ private:
 
 	/**
 	* @brief Removes the given observer and all the non-existing observers.
+	*
+	* The list of observers has to be locked by lockObservers().
 	*/
 	void removeObserverAndNonExistingObservers(ObserverPtr observer) {
+		// Weak pointers are compared by their control blocks, so there is no
+		// need to lock them.
 		observers.erase(std::remove_if(observers.begin(), observers.end(),
 			[&observer](const auto &other) {
-				return other.expired() || observer.lock() == other.lock();
+				return other.expired() ||
+					(!observer.owner_before(other) && !other.owner_before(observer));
 			}
-		));
+		), observers.end());
 	}
 
 private:
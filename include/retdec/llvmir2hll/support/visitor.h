@@ -91,85 +91,89 @@ class WhileLoopStmt;
 *
 * This class implements the Visitor design pattern to circumvent the lack of
 * double dispatch in C++.
+*
+* Visited values are passed by constant references so that dispatching does
+* not copy shared pointers (every copy is an atomic increment and decrement of
+* the reference count). If you need to keep a visited value, copy it.
 */
 class Visitor {
 public:
 	virtual ~Visitor() = 0;
 
-	virtual void visit(ShPtr<GlobalVarDef> varDef) = 0;
-	virtual void visit(ShPtr<Function> func) = 0;
+	virtual void visit(const ShPtr<GlobalVarDef> &varDef) = 0;
+	virtual void visit(const ShPtr<Function> &func) = 0;
 	// Statements
-	virtual void visit(ShPtr<AssignStmt> stmt) = 0;
-	virtual void visit(ShPtr<BreakStmt> stmt) = 0;
-	virtual void visit(ShPtr<CallStmt> stmt) = 0;
-	virtual void visit(ShPtr<ContinueStmt> stmt) = 0;
-	virtual void visit(ShPtr<EmptyStmt> stmt) = 0;
-	virtual void visit(ShPtr<ForLoopStmt> stmt) = 0;
-	virtual void visit(ShPtr<UForLoopStmt> stmt) = 0;
-	virtual void visit(ShPtr<GotoStmt> stmt) = 0;
-	virtual void visit(ShPtr<IfStmt> stmt) = 0;
-	virtual void visit(ShPtr<ReturnStmt> stmt) = 0;
-	virtual void visit(ShPtr<SwitchStmt> stmt) = 0;
-	virtual void visit(ShPtr<UnreachableStmt> stmt) = 0;
-	virtual void visit(ShPtr<VarDefStmt> stmt) = 0;
-	virtual void visit(ShPtr<WhileLoopStmt> stmt) = 0;
+	virtual void visit(const ShPtr<AssignStmt> &stmt) = 0;
+	virtual void visit(const ShPtr<BreakStmt> &stmt) = 0;
+	virtual void visit(const ShPtr<CallStmt> &stmt) = 0;
+	virtual void visit(const ShPtr<ContinueStmt> &stmt) = 0;
+	virtual void visit(const ShPtr<EmptyStmt> &stmt) = 0;
+	virtual void visit(const ShPtr<ForLoopStmt> &stmt) = 0;
+	virtual void visit(const ShPtr<UForLoopStmt> &stmt) = 0;
+	virtual void visit(const ShPtr<GotoStmt> &stmt) = 0;
+	virtual void visit(const ShPtr<IfStmt> &stmt) = 0;
+	virtual void visit(const ShPtr<ReturnStmt> &stmt) = 0;
+	virtual void visit(const ShPtr<SwitchStmt> &stmt) = 0;
+	virtual void visit(const ShPtr<UnreachableStmt> &stmt) = 0;
+	virtual void visit(const ShPtr<VarDefStmt> &stmt) = 0;
+	virtual void visit(const ShPtr<WhileLoopStmt> &stmt) = 0;
 	// Expressions
-	virtual void visit(ShPtr<AddOpExpr> expr) = 0;
-	virtual void visit(ShPtr<AddressOpExpr> expr) = 0;
-	virtual void visit(ShPtr<AndOpExpr> expr) = 0;
-	virtual void visit(ShPtr<ArrayIndexOpExpr> expr) = 0;
-	virtual void visit(ShPtr<AssignOpExpr> expr) = 0;
-	virtual void visit(ShPtr<BitAndOpExpr> expr) = 0;
-	virtual void visit(ShPtr<BitOrOpExpr> expr) = 0;
-	virtual void visit(ShPtr<BitShlOpExpr> expr) = 0;
-	virtual void visit(ShPtr<BitShrOpExpr> expr) = 0;
-	virtual void visit(ShPtr<BitXorOpExpr> expr) = 0;
-	virtual void visit(ShPtr<CallExpr> expr) = 0;
-	virtual void visit(ShPtr<CommaOpExpr> expr) = 0;
-	virtual void visit(ShPtr<DerefOpExpr> expr) = 0;
-	virtual void visit(ShPtr<DivOpExpr> expr) = 0;
-	virtual void visit(ShPtr<EqOpExpr> expr) = 0;
-	virtual void visit(ShPtr<GtEqOpExpr> expr) = 0;
-	virtual void visit(ShPtr<GtOpExpr> expr) = 0;
-	virtual void visit(ShPtr<LtEqOpExpr> expr) = 0;
-	virtual void visit(ShPtr<LtOpExpr> expr) = 0;
-	virtual void visit(ShPtr<ModOpExpr> expr) = 0;
-	virtual void visit(ShPtr<MulOpExpr> expr) = 0;
-	virtual void visit(ShPtr<NegOpExpr> expr) = 0;
-	virtual void visit(ShPtr<NeqOpExpr> expr) = 0;
-	virtual void visit(ShPtr<NotOpExpr> expr) = 0;
-	virtual void visit(ShPtr<OrOpExpr> expr) = 0;
-	virtual void visit(ShPtr<StructIndexOpExpr> expr) = 0;
-	virtual void visit(ShPtr<SubOpExpr> expr) = 0;
-	virtual void visit(ShPtr<TernaryOpExpr> expr) = 0;
-	virtual void visit(ShPtr<Variable> var) = 0;
+	virtual void visit(const ShPtr<AddOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<AddressOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<AndOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<ArrayIndexOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<AssignOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<BitAndOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<BitOrOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<BitShlOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<BitShrOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<BitXorOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<CallExpr> &expr) = 0;
+	virtual void visit(const ShPtr<CommaOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<DerefOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<DivOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<EqOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<GtEqOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<GtOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<LtEqOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<LtOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<ModOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<MulOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<NegOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<NeqOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<NotOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<OrOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<StructIndexOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<SubOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<TernaryOpExpr> &expr) = 0;
+	virtual void visit(const ShPtr<Variable> &var) = 0;
 	// Casts
-	virtual void visit(ShPtr<BitCastExpr> expr) = 0;
-	virtual void visit(ShPtr<ExtCastExpr> expr) = 0;
-	virtual void visit(ShPtr<FPToIntCastExpr> expr) = 0;
-	virtual void visit(ShPtr<IntToFPCastExpr> expr) = 0;
-	virtual void visit(ShPtr<IntToPtrCastExpr> expr) = 0;
-	virtual void visit(ShPtr<PtrToIntCastExpr> expr) = 0;
-	virtual void visit(ShPtr<TruncCastExpr> expr) = 0;
+	virtual void visit(const ShPtr<BitCastExpr> &expr) = 0;
+	virtual void visit(const ShPtr<ExtCastExpr> &expr) = 0;
+	virtual void visit(const ShPtr<FPToIntCastExpr> &expr) = 0;
+	virtual void visit(const ShPtr<IntToFPCastExpr> &expr) = 0;
+	virtual void visit(const ShPtr<IntToPtrCastExpr> &expr) = 0;
+	virtual void visit(const ShPtr<PtrToIntCastExpr> &expr) = 0;
+	virtual void visit(const ShPtr<TruncCastExpr> &expr) = 0;
 	// Constants
-	virtual void visit(ShPtr<ConstArray> constant) = 0;
-	virtual void visit(ShPtr<ConstBool> constant) = 0;
-	virtual void visit(ShPtr<ConstFloat> constant) = 0;
-	virtual void visit(ShPtr<ConstInt> constant) = 0;
-	virtual void visit(ShPtr<ConstNullPointer> constant) = 0;
-	virtual void visit(ShPtr<ConstString> constant) = 0;
-	virtual void visit(ShPtr<ConstStruct> constant) = 0;
-	virtual void visit(ShPtr<ConstSymbol> constant) = 0;
+	virtual void visit(const ShPtr<ConstArray> &constant) = 0;
+	virtual void visit(const ShPtr<ConstBool> &constant) = 0;
+	virtual void visit(const ShPtr<ConstFloat> &constant) = 0;
+	virtual void visit(const ShPtr<ConstInt> &constant) = 0;
+	virtual void visit(const ShPtr<ConstNullPointer> &constant) = 0;
+	virtual void visit(const ShPtr<ConstString> &constant) = 0;
+	virtual void visit(const ShPtr<ConstStruct> &constant) = 0;
+	virtual void visit(const ShPtr<ConstSymbol> &constant) = 0;
 	// Types
-	virtual void visit(ShPtr<ArrayType> type) = 0;
-	virtual void visit(ShPtr<FloatType> type) = 0;
-	virtual void visit(ShPtr<IntType> type) = 0;
-	virtual void visit(ShPtr<PointerType> type) = 0;
-	virtual void visit(ShPtr<StringType> type) = 0;
-	virtual void visit(ShPtr<StructType> type) = 0;
-	virtual void visit(ShPtr<FunctionType> type) = 0;
-	virtual void visit(ShPtr<VoidType> type) = 0;
-	virtual void visit(ShPtr<UnknownType> type) = 0;
+	virtual void visit(const ShPtr<ArrayType> &type) = 0;
+	virtual void visit(const ShPtr<FloatType> &type) = 0;
+	virtual void visit(const ShPtr<IntType> &type) = 0;
+	virtual void visit(const ShPtr<PointerType> &type) = 0;
+	virtual void visit(const ShPtr<StringType> &type) = 0;
+	virtual void visit(const ShPtr<StructType> &type) = 0;
+	virtual void visit(const ShPtr<FunctionType> &type) = 0;
+	virtual void visit(const ShPtr<VoidType> &type) = 0;
+	virtual void visit(const ShPtr<UnknownType> &type) = 0;
 
 protected:
 	Visitor();
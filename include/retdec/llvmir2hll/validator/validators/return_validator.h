@@ -39,7 +39,7 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<ReturnStmt> stmt) override;
+	virtual void visit(const ShPtr<ReturnStmt> &stmt) override;
 	/// @}
 };
 
@@ -97,7 +97,7 @@ protected:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<Variable> var) override;
+	virtual void visit(const ShPtr<Variable> &var) override;
 	/// @}
 
 protected:
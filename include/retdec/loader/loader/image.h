@@ -7,9 +7,12 @@
 #ifndef RETDEC_LOADER_RETDEC_LOADER_IMAGE_H
 #define RETDEC_LOADER_RETDEC_LOADER_IMAGE_H
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 #include "retdec/utils/byte_value_storage.h"
+#include "retdec/utils/interval_index.h"
 #include "retdec/fileformat/fftypes.h"
 #include "retdec/fileformat/file_format/file_format.h"
 #include "retdec/loader/loader/segment.h"
@@ -72,6 +75,7 @@ public:
 	const Segment* getEpSegment();
 
 	std::pair<const std::uint8_t*, std::uint64_t> getRawSegmentData(std::uint64_t address) const;
+	llvm::ArrayRef<std::uint8_t> getBytesView(std::uint64_t address, std::uint64_t size) const;
 
 	const std::string& getStatusMessage() const;
 	const retdec::fileformat::LoaderErrorInfo & getLoaderErrorInfo() const;
@@ -81,6 +85,7 @@ protected:
 	void removeSegment(Segment* segment);
 	void nameSegment(Segment* segment);
 	void sortSegments();
+	void invalidateSegmentIndex();
 
 	void setStatusMessage(const std::string& message);
 
@@ -89,12 +94,17 @@ private:
 	const Segment* _getSegment(const std::string& name) const;
 	const Segment* _getSegmentWithIndex(std::size_t index) const;
 	const Segment* _getSegmentFromAddress(std::uint64_t address) const;
+	void _buildSegmentIndex() const;
 
 	std::shared_ptr<retdec::fileformat::FileFormat> _fileFormat;
 	std::vector<std::unique_ptr<Segment>> _segments;
 	std::uint64_t _baseAddress;
 	NameGenerator _namelessSegNameGen;
 	std::string _statusMessage;
+
+	mutable retdec::utils::IntervalIndex<const Segment*> _segmentIndex;
+	mutable std::atomic<bool> _segmentIndexValid;
+	mutable std::mutex _segmentIndexMutex;
 };
 
 } // namespace loader
@@ -47,6 +47,7 @@ public:
 
 	bool getBytes(std::vector<unsigned char>& result) const;
 	bool getBytes(std::vector<unsigned char>& result, std::uint64_t addressOffset, std::uint64_t size) const;
+	llvm::ArrayRef<std::uint8_t> getBytesView(std::uint64_t addressOffset, std::uint64_t size) const;
 	bool getBits(std::string& result) const;
 	bool getBits(std::string& result, std::uint64_t addressOffset, std::uint64_t bytesCount) const;
 
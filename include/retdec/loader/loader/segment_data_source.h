@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 
+#include <llvm/ADT/ArrayRef.h>
 #include <llvm/ADT/StringRef.h>
 
 namespace retdec {
@@ -28,6 +29,7 @@ public:
 
 	const std::uint8_t* getData() const;
 	std::uint64_t getDataSize() const;
+	llvm::ArrayRef<std::uint8_t> getDataView(std::uint64_t viewOffset, std::uint64_t viewSize) const;
 
 	void resize(std::uint64_t newSize);
 	bool shrink(std::uint64_t newOffset, std::uint64_t newSize);
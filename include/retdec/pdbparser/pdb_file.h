@@ -11,6 +11,7 @@
 #include "retdec/pdbparser/pdb_symbols.h"
 #include "retdec/pdbparser/pdb_types.h"
 #include "retdec/pdbparser/pdb_utils.h"
+#include "retdec/utils/memory_mapped_file.h"
 
 namespace retdec {
 namespace pdbparser {
@@ -136,7 +137,8 @@ class PDBFile
 				pdb_loaded(false), pdb_initialized(false), pdb_filename(nullptr), pdb_version(0), page_size(0), pdb_file_size(
 				        0), pdb_file_data(
 				nullptr), num_streams(0), pdb_fpo_num(0), pdb_newfpo_num(0), pdb_sec_num(0), pdb_header(nullptr), pdb_root_dir(
-				nullptr), pdb_info_v700(nullptr), dbi_header_v700(nullptr), pdb_types(nullptr), pdb_symbols(nullptr)
+				nullptr), pdb_root_dir_copied(false), pdb_info_v700(nullptr), dbi_header_v700(nullptr), pdb_types(nullptr), pdb_symbols(
+				nullptr)
 		{
 		}
 		;
@@ -152,13 +154,8 @@ class PDBFile
 		{
 			return pdb_version;
 		}
-		PDBStream * get_stream(unsigned int num)
-		{
-			if (num < num_streams)
-				return &streams[num];
-			else
-				return nullptr;
-		}
+		PDBStream * get_stream(unsigned int num);
+		bool is_stream_loaded(unsigned int num) const;
 		const char * get_module_name(unsigned int num)
 		{
 			if (num < modules.size())
@@ -168,22 +165,22 @@ class PDBFile
 		}
 		PDBTypes * get_types_container(void)
 		{
-			return pdb_types;
+			return load_types();
 		}
 		PDBSymbols * get_symbols_container(void)
 		{
-			return pdb_symbols;
+			return load_global_symbols();
 		}
 		PDBFunctionAddressMap * get_functions(void)
 		{
-			if (pdb_symbols != nullptr)
+			if (load_symbols() != nullptr)
 				return &pdb_symbols->get_functions();
 			else
 				return nullptr;
 		}
 		PDBGlobalVarAddressMap * get_global_variables(void)
 		{
-			if (pdb_symbols != nullptr)
+			if (load_global_symbols() != nullptr)
 				return &pdb_symbols->get_global_variables();
 			else
 				return nullptr;
@@ -198,7 +195,11 @@ class PDBFile
 	private:
 		// Internal functions
 		bool stream_is_linear(PDB_DWORD *pages, int num_pages);
+		bool pages_are_in_file(PDB_DWORD *pages, int num_pages);
 		char * extract_stream(PDB_DWORD *pages, int num_pages);
+		PDBTypes * load_types(void);
+		PDBSymbols * load_symbols(void);
+		PDBSymbols * load_global_symbols(void);
 		PDBFileState load_pdb_v200(void);
 		PDBFileState load_pdb_v700(void);
 		void parse_modules(void);
@@ -211,7 +212,8 @@ class PDBFile
 		unsigned int pdb_version;
 		unsigned int page_size;
 		unsigned int pdb_file_size;
-		char * pdb_file_data;
+		retdec::utils::MemoryMappedFile pdb_file;  // PDB file mapped into memory
+		char * pdb_file_data;  // start of mapped PDB file
 		unsigned int num_streams;
 		int pdb_fpo_num;
 		int pdb_newfpo_num;
@@ -220,6 +222,7 @@ class PDBFile
 		// Data structure pointers
 		PDB_HEADER * pdb_header;
 		PDB_ROOT * pdb_root_dir;
+		bool pdb_root_dir_copied;  // root directory is not linear in PDB file
 		PDBInfo70 * pdb_info_v700;
 		NewDBIHdr * dbi_header_v700;
 
@@ -124,13 +124,9 @@ class PDBSymbols
 {
 	public:
 		// Constructor and destructor
-		PDBSymbols(PDBStream *gsi, PDBStream *psi, PDBStream *sym, PDBModulesVec & m, PDBSectionsVec & s,
-		        PDBTypes * tps) :
-//		pdb_gsi_size(gsi->size),
-//		pdb_gsi_data(gsi->data),
-//		pdb_psi_size(psi->size),
-//		pdb_psi_data(psi->data),
-				pdb_sym_size(sym->size), pdb_sym_data(sym->data), modules(m), sections(s), types(tps), parsed(false)
+		PDBSymbols(PDBModulesVec & m, PDBSectionsVec & s, PDBTypes * tps) :
+				pdb_sym_size(0), pdb_sym_data(nullptr), modules(m), sections(s), types(tps), parsed(false), sym_parsed(
+				        false)
 		{
 		}
 		;
@@ -138,6 +134,7 @@ class PDBSymbols
 
 		// Action methods
 		void parse_symbols(void);
+		void parse_global_symbols(PDBStream *sym_stream);
 
 		// Getting methods
 		PDBFunctionAddressMap & get_functions(void)
@@ -187,16 +184,13 @@ class PDBSymbols
 		static void dump_symbol(PSYM Sym);
 
 		// Variables
-//	unsigned int		pdb_gsi_size;	// size of GSI stream
-//	char *				pdb_gsi_data;	// data from GSI stream
-//	unsigned int		pdb_psi_size;	// size of PSI stream
-//	char *				pdb_psi_data;	// data from PSI stream
 		unsigned int pdb_sym_size;  // size of SYM stream
 		char * pdb_sym_data;  // data from SYM stream
 		PDBModulesVec & modules;  // modules
 		PDBSectionsVec & sections;  // sections
 		PDBTypes * types;  // types
 		bool parsed;  // modules are parsed
+		bool sym_parsed;  // SYM stream is parsed
 
 		// Data containers
 		PDBFunctionAddressMap functions;  // Map of functions (key is address)
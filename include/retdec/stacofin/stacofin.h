@@ -14,10 +14,22 @@
 #include "retdec/utils/address.h"
 
 namespace retdec {
+namespace fileformat {
+	class FileFormat;
+} // namespace fileformat
+
 namespace loader {
 	class Image;
 } // namespace loader
 
+namespace utils {
+	class ThreadPool;
+} // namespace utils
+
+namespace yara_support {
+	class YaraRule;
+} // namespace yara_support
+
 namespace stacofin {
 
 /**
@@ -62,6 +74,10 @@ class Finder
 		void search(
 			const retdec::loader::Image &image,
 			const std::string &yaraFile);
+		void search(
+			const retdec::loader::Image &image,
+			const std::vector<std::string> &yaraFiles,
+			retdec::utils::ThreadPool *threadPool = nullptr);
 		/// @}
 
 		/// @name Getters.
@@ -75,6 +91,10 @@ class Finder
 		CoveredCode coveredCode;                         ///< Code coverage.
 		std::vector<DetectedFunction> detectedFunctions; ///< Functions.
 
+		void storeDetections(
+			const retdec::fileformat::FileFormat *fileFormat,
+			const std::string &yaraFile,
+			const std::vector<retdec::yara_support::YaraRule> &detectedRules);
 		void sort();
 		bool isSorted = true; ///< @c true if detected functions are sorted.
 };
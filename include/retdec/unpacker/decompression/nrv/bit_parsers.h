@@ -13,54 +13,25 @@
 namespace retdec {
 namespace unpacker {
 
-class BitParser
-{
-public:
-	BitParser() {}
-	BitParser(const BitParser&) = delete;
-	virtual ~BitParser() {}
-
-	virtual bool getBit(uint8_t& bit, const DynamicBuffer& data, uint32_t& pos) = 0;
-
-private:
-	BitParser& operator =(const BitParser&);
-};
-
-template <typename T> class BitParserN : public BitParser
-{
-public:
-	BitParserN() : _value()
-	{
-		static_assert(std::is_integral<T>::value, "BitParser requires integral type");
-	}
-
-	BitParserN(const BitParser&) = delete;
-	virtual ~BitParserN() override {}
-
-protected:
-	T _value;
-
-private:
-	BitParserN& operator =(const BitParserN&);
-};
-
-class BitParser8 : public BitParserN<uint32_t>
+/**
+ * Reader of bits refilled by single bytes. It reads the data directly from memory and
+ * its methods are not virtual, so it can be inlined into decompression loops.
+ */
+class BitReader8
 {
 public:
-	BitParser8() {}
-	BitParser8(const BitParser8&) = delete;
-	virtual ~BitParser8() override {}
+	BitReader8() : _value(0) {}
 
-	virtual bool getBit(uint8_t& bit, const DynamicBuffer& data, uint32_t& pos) override
+	bool getBit(uint8_t& bit, const uint8_t* data, uint32_t size, uint32_t& pos)
 	{
 		bit = (_value >> 7) & 1;
 		_value <<= 1;
 		if ((_value & 0xFF) == 0)
 		{
-			if (pos >= data.getRealDataSize())
+			if (pos >= size)
 				return false;
 
-			_value = data.read<uint8_t>(pos++, retdec::utils::Endianness::LITTLE);
+			_value = data[pos++];
 
 			bit = (_value >> 7) & 1;
 			_value <<= 1;
@@ -69,25 +40,33 @@ public:
 
 		return true;
 	}
+
+private:
+	uint32_t _value;
 };
 
-class BitParserLe32 : public BitParserN<uint32_t>
+/**
+ * Reader of bits refilled by little-endian 32-bit words. It reads the data directly from memory
+ * and its methods are not virtual, so it can be inlined into decompression loops.
+ */
+class BitReaderLe32
 {
 public:
-	BitParserLe32() {}
-	BitParserLe32(const BitParserLe32&) = delete;
-	virtual ~BitParserLe32() {}
+	BitReaderLe32() : _value(0) {}
 
-	virtual bool getBit(uint8_t& bit, const DynamicBuffer& data, uint32_t& pos) override
+	bool getBit(uint8_t& bit, const uint8_t* data, uint32_t size, uint32_t& pos)
 	{
 		bit = (_value >> 31) & 1;
 		_value <<= 1;
 		if (_value == 0)
 		{
-			if (pos >= data.getRealDataSize())
+			if (pos >= size)
 				return false;
 
-			_value = data.read<uint32_t>(pos, retdec::utils::Endianness::LITTLE);
+			// Bytes beyond the end of the data are read as 0
+			uint32_t bytesToRead = size - pos < 4 ? size - pos : 4;
+			for (uint32_t i = 0; i < bytesToRead; ++i)
+				_value |= static_cast<uint32_t>(data[pos + i]) << (i << 3);
 			pos += 4;
 
 			bit = (_value >> 31) & 1;
@@ -97,6 +76,65 @@ public:
 
 		return true;
 	}
+
+private:
+	uint32_t _value;
+};
+
+class BitParser
+{
+public:
+	BitParser() {}
+	BitParser(const BitParser&) = delete;
+	virtual ~BitParser() {}
+
+	virtual bool getBit(uint8_t& bit, const DynamicBuffer& data, uint32_t& pos) = 0;
+
+private:
+	BitParser& operator =(const BitParser&);
+};
+
+/**
+ * Bit parser wrapping a bit reader. Decompression algorithms can access the wrapped reader
+ * directly (see NrvData::visitBitReader()) and avoid the virtual call for every bit.
+ *
+ * @tparam Reader Type of the wrapped bit reader.
+ */
+template <typename Reader> class BitParserN : public BitParser
+{
+public:
+	BitParserN() : _reader() {}
+	BitParserN(const BitParserN&) = delete;
+	virtual ~BitParserN() override {}
+
+	virtual bool getBit(uint8_t& bit, const DynamicBuffer& data, uint32_t& pos) override
+	{
+		return _reader.getBit(bit, data.getRawBuffer(), data.getRealDataSize(), pos);
+	}
+
+	Reader& getReader() { return _reader; }
+
+protected:
+	Reader _reader;
+
+private:
+	BitParserN& operator =(const BitParserN&);
+};
+
+class BitParser8 : public BitParserN<BitReader8>
+{
+public:
+	BitParser8() {}
+	BitParser8(const BitParser8&) = delete;
+	virtual ~BitParser8() override {}
+};
+
+class BitParserLe32 : public BitParserN<BitReaderLe32>
+{
+public:
+	BitParserLe32() {}
+	BitParserLe32(const BitParserLe32&) = delete;
+	virtual ~BitParserLe32() override {}
 };
 
 } // namespace unpacker
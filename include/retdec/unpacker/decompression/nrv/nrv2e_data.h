@@ -28,6 +28,8 @@ public:
 	virtual bool decompress(DynamicBuffer& outputBuffer) override;
 
 private:
+	template <typename BitReader> bool decompressImpl(BitReader& bitReader, DynamicBuffer& outputBuffer);
+
 	Nrv2eData& operator =(const Nrv2eData&);
 };
 
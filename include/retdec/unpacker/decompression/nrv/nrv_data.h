@@ -13,6 +13,86 @@
 namespace retdec {
 namespace unpacker {
 
+/**
+ * Output of NRV decompression. The output buffer is resized to its whole capacity at the beginning,
+ * so the decompressed bytes can be written directly into memory. When the output is destroyed,
+ * the buffer is shrunk back to the data that were actually written.
+ */
+class NrvOutput
+{
+public:
+	NrvOutput(DynamicBuffer& buffer, uint32_t& writePos) : _buffer(buffer), _writePos(writePos),
+		_origSize(buffer.getRealDataSize()), _capacity(buffer.getCapacity())
+	{
+		if (_capacity > _origSize)
+			_buffer.setRealDataSize(_capacity);
+		_data = _buffer.getRawBuffer();
+	}
+
+	NrvOutput(const NrvOutput&) = delete;
+
+	~NrvOutput()
+	{
+		if (_capacity > _origSize)
+			_buffer.setRealDataSize(_writePos > _origSize ? _writePos : _origSize);
+	}
+
+	bool putByte(uint8_t byte)
+	{
+		if (_writePos >= _capacity)
+			return false;
+
+		_data[_writePos++] = byte;
+		return true;
+	}
+
+	/**
+	 * Copies the already decompressed data.
+	 *
+	 * @param srcPos Position of the data to copy.
+	 * @param count Number of bytes to copy (0 stands for 2^32).
+	 *
+	 * @return True if all the bytes fit into the capacity of the output, otherwise false.
+	 */
+	bool copyMatch(uint32_t srcPos, uint32_t count)
+	{
+		if (srcPos < _writePos && count != 0 && count <= _capacity - _writePos)
+		{
+			// The source and destination can overlap, so the bytes have to be copied one by one
+			const uint8_t* src = _data + srcPos;
+			uint8_t* dst = _data + _writePos;
+			_writePos += count;
+			do
+			{
+				*dst++ = *src++;
+			} while (--count);
+
+			return true;
+		}
+
+		do
+		{
+			if (_writePos >= _capacity)
+				return false;
+
+			// Data outside of the output are read as 0
+			_data[_writePos++] = srcPos < _capacity ? _data[srcPos] : 0;
+			srcPos++;
+		} while (--count);
+
+		return true;
+	}
+
+private:
+	NrvOutput& operator =(const NrvOutput&);
+
+	DynamicBuffer& _buffer;
+	uint32_t& _writePos;
+	uint32_t _origSize;
+	uint32_t _capacity;
+	uint8_t* _data;
+};
+
 class NrvData : public CompressedData
 {
 public:
@@ -29,6 +109,24 @@ public:
 	}
 
 protected:
+	/**
+	 * Calls the given function with the bit reader of the associated bit parser. This way, the decompression
+	 * loop is instantiated for the concrete type of the bit reader and no bit is read through a virtual call.
+	 *
+	 * @param func Function accepting a reference to @c BitReader8 or @c BitReaderLe32.
+	 *
+	 * @return The result of @p func, or false if the bit parser is of unknown type.
+	 */
+	template <typename Func> bool visitBitReader(Func func)
+	{
+		if (auto bitParser = dynamic_cast<BitParser8*>(_bitParser))
+			return func(bitParser->getReader());
+		else if (auto bitParser = dynamic_cast<BitParserLe32*>(_bitParser))
+			return func(bitParser->getReader());
+
+		return false;
+	}
+
 	uint32_t _readPos, _writePos;
 	BitParser* _bitParser;
 
@@ -46,11 +46,13 @@ public:
 	void setEndianness(retdec::utils::Endianness endianness);
 	retdec::utils::Endianness getEndianness() const;
 
+	void setRealDataSize(uint32_t size);
 	uint32_t getRealDataSize() const;
 
 	void erase(uint32_t startPos, uint32_t amount);
 
 	const uint8_t* getRawBuffer() const;
+	uint8_t* getRawBuffer();
 	std::vector<uint8_t> getBuffer() const;
 
 	void forEach(const std::function<void(uint8_t&)>& func);
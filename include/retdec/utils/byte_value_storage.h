@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace retdec {
@@ -64,6 +65,7 @@ public:
 	bool getWord(std::uint64_t address, std::uint64_t& res, Endianness e = Endianness::UNKNOWN) const;
 	bool getFloat(std::uint64_t address, float& res) const;
 	bool getDouble(std::uint64_t address, double& res) const;
+	template <typename T> bool getValue(std::uint64_t address, T& res, Endianness e = Endianness::UNKNOWN) const;
 
 	bool set1Byte(std::uint64_t address, std::uint64_t val, Endianness e = Endianness::UNKNOWN);
 	bool set2Byte(std::uint64_t address, std::uint64_t val, Endianness e = Endianness::UNKNOWN);
@@ -90,6 +92,7 @@ public:
 
 protected:
 	bool createValueFromBytes(const std::vector<std::uint8_t>& data, std::uint64_t& value, Endianness endian, std::uint64_t offset = 0, std::uint64_t size = 0) const;
+	bool createValueFromBytes(const std::uint8_t* data, std::uint64_t dataSize, std::uint64_t& value, Endianness endian, std::uint64_t offset = 0, std::uint64_t size = 0) const;
 	bool createBytesFromValue(std::uint64_t data, std::uint64_t x, std::vector<std::uint8_t>& value, Endianness endian) const;
 
 	bool get10ByteImpl(const std::vector<std::uint8_t>& data, long double& res) const;
@@ -103,6 +106,33 @@ protected:
 	bool getNTWSNiceImpl(const GetXByteFn& getXByteFn, std::uint64_t address, std::size_t width, std::vector<std::uint64_t>& res) const;
 };
 
+/**
+ * Get integer of type @a T located at provided address using the specified endian or default file endian
+ *
+ * @tparam T Integral type which determines number of read bytes
+ *
+ * @param address Address to get integer from
+ * @param res Result integer
+ * @param e Endian - if specified it is forced, otherwise file's endian is used
+ *
+ * @return Status of operation (@c true if all is OK, @c false otherwise)
+ */
+template <typename T>
+bool ByteValueStorage::getValue(std::uint64_t address, T& res, Endianness e/* = Endianness::UNKNOWN*/) const
+{
+	static_assert(std::is_integral<T>::value && sizeof(T) <= sizeof(std::uint64_t),
+			"getValue() supports only integral types up to 8 bytes");
+
+	std::uint64_t value = 0;
+	if (!getXByte(address, sizeof(T), value, e))
+	{
+		return false;
+	}
+
+	res = static_cast<T>(value);
+	return true;
+}
+
 } // namespace utils
 } // namespace retdec
 
@@ -0,0 +1,148 @@
+/**
+ * @file include/retdec/utils/interval_index.h
+ * @brief Declaration of templated IntervalIndex class.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_UTILS_INTERVAL_INDEX_H
+#define RETDEC_UTILS_INTERVAL_INDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace retdec {
+namespace utils {
+
+/**
+ * Index of possibly overlapping address intervals for logarithmic lookups.
+ *
+ * Intervals are flattened into a sorted sequence of disjoint pieces. Every
+ * piece remembers the value of the preferred interval covering it, so lookup
+ * is one binary search. Which interval is preferred where intervals overlap
+ * is given by comparator passed to build(). If comparator does not prefer
+ * any of them, the one added first wins.
+ *
+ * @tparam T Type of values associated with intervals. Default constructed
+ *    value is returned for addresses which are not covered.
+ */
+template <typename T> class IntervalIndex
+{
+public:
+	/**
+	 * Interval <first, last> -- including both bounds.
+	 */
+	struct Interval
+	{
+		std::uint64_t first;
+		std::uint64_t last;
+		T value;
+	};
+
+	/**
+	 * Build index from intervals. Previous content of index is dropped.
+	 *
+	 * @param intervals Intervals to index.
+	 * @param preferred Comparator returning @c true if its first interval
+	 *    should be preferred to the second one where they overlap.
+	 */
+	template <typename Compare>
+	void build(const std::vector<Interval>& intervals, Compare preferred)
+	{
+		_pieces.clear();
+
+		// Interval starts at its first address and ends after its last one.
+		// Interval ending at the highest address never ends.
+		std::vector<std::pair<std::uint64_t, std::size_t>> starts, ends;
+		for (std::size_t i = 0, e = intervals.size(); i < e; ++i)
+		{
+			if (intervals[i].first > intervals[i].last)
+				continue;
+
+			starts.emplace_back(intervals[i].first, i);
+			if (intervals[i].last != std::numeric_limits<std::uint64_t>::max())
+				ends.emplace_back(intervals[i].last + 1, i);
+		}
+		std::sort(starts.begin(), starts.end());
+		std::sort(ends.begin(), ends.end());
+
+		auto order = [&](std::size_t i, std::size_t j)
+		{
+			if (preferred(intervals[i], intervals[j]))
+				return true;
+			if (preferred(intervals[j], intervals[i]))
+				return false;
+			return i < j;
+		};
+		std::set<std::size_t, decltype(order)> active(order);
+
+		auto startItr = starts.begin();
+		auto endItr = ends.begin();
+		while (startItr != starts.end() || endItr != ends.end())
+		{
+			std::uint64_t address = std::numeric_limits<std::uint64_t>::max();
+			if (startItr != starts.end())
+				address = startItr->first;
+			if (endItr != ends.end())
+				address = std::min(address, endItr->first);
+
+			for (; endItr != ends.end() && endItr->first == address; ++endItr)
+				active.erase(endItr->second);
+			for (; startItr != starts.end() && startItr->first == address; ++startItr)
+				active.insert(startItr->second);
+
+			auto value = active.empty() ? T() : intervals[*active.begin()].value;
+			if (_pieces.empty() || _pieces.back().second != value)
+				_pieces.emplace_back(address, value);
+		}
+	}
+
+	/**
+	 * Drop all intervals from index.
+	 */
+	void clear()
+	{
+		_pieces.clear();
+	}
+
+	/**
+	 * Find value of preferred interval covering the given address.
+	 *
+	 * @param address Address to find.
+	 * @return Value of interval or default constructed value if address is
+	 *    not covered by any interval.
+	 */
+	T find(std::uint64_t address) const
+	{
+		auto itr = std::upper_bound(_pieces.begin(), _pieces.end(), address,
+				[](std::uint64_t a, const std::pair<std::uint64_t, T>& piece)
+				{
+					return a < piece.first;
+				});
+
+		return itr == _pieces.begin() ? T() : std::prev(itr)->second;
+	}
+
+	/**
+	 * Check if index contains no intervals.
+	 *
+	 * @return @c true if index is empty, otherwise @c false.
+	 */
+	bool empty() const
+	{
+		return _pieces.empty();
+	}
+
+private:
+	/// Starts of disjoint pieces with values of their preferred intervals.
+	std::vector<std::pair<std::uint64_t, T>> _pieces;
+};
+
+} // namespace utils
+} // namespace retdec
+
+#endif
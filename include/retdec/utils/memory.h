@@ -15,6 +15,7 @@ namespace utils {
 std::size_t getTotalSystemMemory();
 bool limitSystemMemory(std::size_t limit);
 bool limitSystemMemoryToHalfOfTotalSystemMemory();
+std::size_t getPeakMemoryUsage();
 
 } // namespace utils
 } // namespace retdec
@@ -0,0 +1,59 @@
+/**
+ * @file include/retdec/utils/memory_mapped_file.h
+ * @brief Read-only view of a file mapped into memory.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_UTILS_MEMORY_MAPPED_FILE_H
+#define RETDEC_UTILS_MEMORY_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "retdec/utils/non_copyable.h"
+#include "retdec/utils/os.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+ * @brief File mapped into the address space of the process.
+ *
+ * Pages of the file are loaded by the operating system when they are touched
+ * for the first time, so opening a file is O(1) regardless of its size and the
+ * only copy of its content is the one in the page cache.
+ *
+ * The mapping is read-only.
+ */
+class MemoryMappedFile : private NonCopyable
+{
+public:
+	MemoryMappedFile() = default;
+	explicit MemoryMappedFile(const std::string& path);
+	MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+	MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+	~MemoryMappedFile();
+
+	bool open(const std::string& path);
+	void close();
+
+	bool isOpen() const;
+	const std::uint8_t* getData() const;
+	std::size_t getSize() const;
+
+private:
+	void swap(MemoryMappedFile& other) noexcept;
+
+	const std::uint8_t* _data = nullptr; ///< Start of the mapped view.
+	std::size_t _size = 0;               ///< Size of the mapped view.
+	bool _isOpen = false;                ///< Empty files are open, but not mapped.
+#ifdef OS_WINDOWS
+	void* _mapping = nullptr;            ///< Handle of the file mapping object.
+#endif
+};
+
+} // namespace utils
+} // namespace retdec
+
+#endif
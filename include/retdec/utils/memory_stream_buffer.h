@@ -0,0 +1,42 @@
+/**
+ * @file include/retdec/utils/memory_stream_buffer.h
+ * @brief Stream buffer reading bytes from memory.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_UTILS_MEMORY_STREAM_BUFFER_H
+#define RETDEC_UTILS_MEMORY_STREAM_BUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <streambuf>
+
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+ * @brief Read-only stream buffer over bytes in memory.
+ *
+ * It lets parsers which read their input from @c std::istream read e.g. a
+ * memory-mapped file without copying it. The bytes are not owned by the
+ * buffer and they must outlive it. Writing into the buffer is not supported.
+ */
+class MemoryStreamBuffer : public std::streambuf, private NonCopyable
+{
+public:
+	MemoryStreamBuffer(const std::uint8_t* data, std::size_t size);
+
+protected:
+	virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+			std::ios_base::openmode which = std::ios_base::in) override;
+	virtual pos_type seekpos(pos_type pos,
+			std::ios_base::openmode which = std::ios_base::in) override;
+	virtual std::streamsize showmanyc() override;
+};
+
+} // namespace utils
+} // namespace retdec
+
+#endif
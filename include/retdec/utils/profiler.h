@@ -0,0 +1,95 @@
+/**
+ * @file include/retdec/utils/profiler.h
+ * @brief Recording of time and memory used by phases of a program.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_UTILS_PROFILER_H
+#define RETDEC_UTILS_PROFILER_H
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+ * @brief Records time and memory used by phases of a program.
+ *
+ * Phases are delimited by @c start() and @c stop() and they may be nested.
+ * For each phase, the profiler records wall time, CPU time of the process,
+ * growth of the peak memory usage, number of heap allocations (done by
+ * @c operator @c new) and sizes of the processed data (e.g. number of
+ * functions and instructions) before and after the phase.
+ *
+ * Heap allocations are counted only in programs linked with the object library
+ * @c retdec-utils-allocation-hook, which replaces the global @c operator
+ * @c new, and only while some profiler exists. Libraries never replace the
+ * allocator of programs using them, so other programs record no allocations.
+ */
+class Profiler : private NonCopyable
+{
+public:
+	/// Named sizes of the processed data, e.g. <tt>{"functions", 42}</tt>.
+	using Sizes = std::vector<std::pair<std::string, std::size_t>>;
+
+	/// Resources used by one phase.
+	struct Record
+	{
+		std::string name;               ///< Name of the phase.
+		std::size_t level = 0;          ///< Nesting level (@c 0 is top-level).
+		double wallTime = 0.0;          ///< Wall time (in seconds).
+		double cpuTime = 0.0;           ///< CPU time of the process (in seconds).
+		std::size_t peakMemoryGrowth = 0; ///< Growth of the peak memory usage (in bytes).
+		std::size_t allocations = 0;    ///< Number of heap allocations.
+		Sizes sizesBefore;              ///< Sizes of data before the phase.
+		Sizes sizesAfter;               ///< Sizes of data after the phase.
+	};
+
+public:
+	Profiler();
+	~Profiler();
+
+	void start(const std::string& name, const Sizes& sizesBefore = Sizes());
+	void stop(const Sizes& sizesAfter = Sizes());
+	bool isRunning() const;
+
+	const std::vector<Record>& getRecords() const;
+	void writeJson(std::ostream& out) const;
+	bool writeJsonFile(const std::string& path) const;
+
+	static double getCpuTime();
+	static std::size_t getAllocationCount();
+
+	/// @name Allocation hook
+	/// @{
+	static void enableAllocationCounting();
+	static bool isCountingAllocations();
+	static void recordAllocation() noexcept;
+	/// @}
+
+private:
+	/// State of a running phase.
+	struct Running
+	{
+		std::size_t record;
+		std::chrono::steady_clock::time_point wallTime;
+		double cpuTime;
+		std::size_t peakMemory;
+		std::size_t allocations;
+	};
+
+	std::vector<Record> _records;  ///< Records in the order of starts.
+	std::vector<Running> _running; ///< Stack of running phases.
+};
+
+} // namespace utils
+} // namespace retdec
+
+#endif
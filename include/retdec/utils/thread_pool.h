@@ -0,0 +1,82 @@
+/**
+ * @file include/retdec/utils/thread_pool.h
+ * @brief Pool of threads running independent tasks in parallel.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_UTILS_THREAD_POOL_H
+#define RETDEC_UTILS_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+ * @brief Pool of threads running independent tasks in parallel.
+ *
+ * Tasks are identified by indexes. Every thread has its own queue of tasks.
+ * It takes tasks from the front of its queue and when the queue gets empty,
+ * it steals tasks from the back of queues of other threads, so threads with
+ * cheap tasks help the ones with expensive tasks.
+ *
+ * The thread calling @c parallelFor() runs tasks too. Calls of
+ * @c parallelFor() from tasks run serially in the calling thread.
+ */
+class ThreadPool : private NonCopyable
+{
+public:
+	explicit ThreadPool(std::size_t threadCount = 0);
+	~ThreadPool();
+
+	std::size_t getThreadCount() const;
+	void parallelFor(std::size_t count,
+		const std::function<void(std::size_t)>& task);
+
+	static std::size_t getDefaultThreadCount();
+
+private:
+	/// Tasks assigned to one thread.
+	struct Queue
+	{
+		std::mutex mutex;
+		std::deque<std::size_t> tasks;
+	};
+
+	void workerLoop(std::size_t id);
+	void runTasks(std::size_t id);
+	bool popTask(std::size_t id, std::size_t& task);
+
+	/// Queues of all threads, the one of the calling thread is the first.
+	std::vector<std::unique_ptr<Queue>> _queues;
+	std::vector<std::thread> _threads;
+
+	/// Serializes calls of @c parallelFor() from different threads.
+	std::mutex _batchMutex;
+	/// Guards all members below.
+	std::mutex _mutex;
+	std::condition_variable _wakeUp;
+	std::condition_variable _done;
+	std::size_t _batch = 0;
+	bool _stop = false;
+	const std::function<void(std::size_t)>* _task = nullptr;
+	std::exception_ptr _error;
+	/// Number of not yet finished tasks of the current batch.
+	std::atomic<std::size_t> _pending{0};
+};
+
+} // namespace utils
+} // namespace retdec
+
+#endif
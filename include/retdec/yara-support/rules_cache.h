@@ -0,0 +1,107 @@
+/**
+ * @file include/retdec/yara-support/rules_cache.h
+ * @brief Process-wide cache of compiled YARA rules.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_YARA_SUPPORT_RULES_CACHE_H
+#define RETDEC_YARA_SUPPORT_RULES_CACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace yara_support {
+
+class CompiledRules;
+
+/**
+ * File with YARA rules and namespace into which its rules are compiled.
+ */
+struct RuleFile
+{
+	std::string path;      ///< path to file with rules
+	std::string nameSpace; ///< namespace of rules (empty for default one)
+};
+
+/**
+ * @brief Cache of compiled YARA rules shared by all detectors in the process.
+ *
+ * Every rule file is compiled (or loaded, if it is precompiled) only once per
+ * process. Entries are keyed by path and invalidated when the modification
+ * time or size of the file changes.
+ *
+ * Several text rule files can be compiled into one set, so that a single scan
+ * evaluates all of them. Such sets are cached as a whole.
+ *
+ * When a cache directory is set, text rules are additionally stored into it
+ * in the precompiled form, so that subsequent runs only load them.
+ */
+class RulesCache : private retdec::utils::NonCopyable
+{
+	public:
+		static RulesCache& getInstance();
+
+		/// @name Settings
+		/// @{
+		void setCacheDirectory(const std::string &dir);
+		std::string getCacheDirectory() const;
+		/// @}
+
+		/// @name Cache access
+		/// @{
+		std::shared_ptr<const CompiledRules> getRules(const std::string &path);
+		std::shared_ptr<const CompiledRules> getRules(const std::vector<RuleFile> &files);
+		void clear();
+		/// @}
+
+		/// @name Other methods
+		/// @{
+		static bool isPrecompiled(const std::string &path);
+		/// @}
+	private:
+		/**
+		 * Identification of a version of a rule file.
+		 */
+		struct FileStamp
+		{
+			std::int64_t mtime = 0;
+			std::uint64_t size = 0;
+
+			bool operator==(const FileStamp &o) const;
+		};
+
+		struct Entry
+		{
+			std::vector<FileStamp> stamps;               ///< versions of files
+			std::shared_ptr<const CompiledRules> rules;  ///< compiled rules
+		};
+
+		RulesCache();
+		~RulesCache();
+
+		static bool getFileStamp(const std::string &path, FileStamp &stamp);
+		static std::string getCachedFilePath(
+				const std::vector<RuleFile> &files,
+				const std::vector<FileStamp> &stamps,
+				const std::string &dir);
+		static std::shared_ptr<const CompiledRules> loadRules(
+				const std::vector<RuleFile> &files,
+				const std::vector<FileStamp> &stamps,
+				const std::string &dir);
+
+		mutable std::mutex mutex;                        ///< guards all members
+		std::string cacheDir;                            ///< on-disk cache of precompiled rules
+		std::unordered_map<std::string, Entry> entries;  ///< rules by namespaces and paths of files
+};
+
+} // namespace yara_support
+} // namespace retdec
+
+#endif
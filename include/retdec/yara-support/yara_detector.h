@@ -0,0 +1,75 @@
+/**
+ * @file include/retdec/yara-support/yara_detector.h
+ * @brief Detection of YARA rules in files and memory buffers.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_YARA_SUPPORT_YARA_DETECTOR_H
+#define RETDEC_YARA_SUPPORT_YARA_DETECTOR_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "retdec/yara-support/rules_cache.h"
+#include "retdec/yara-support/yara_rule.h"
+
+namespace retdec {
+namespace yara_support {
+
+/**
+ * @brief Detector of YARA rules.
+ *
+ * Rule files are obtained from @c RulesCache, so each of them is compiled
+ * only once per process no matter how many detectors use it.
+ *
+ * All text rule files added to one detector are compiled into a single set,
+ * so that one pass over scanned data evaluates all of them. Every file with
+ * precompiled rules needs its own pass. Detected rules can be distinguished
+ * by namespace given when their file was added.
+ */
+class YaraDetector
+{
+	public:
+		/// @name Rule files
+		/// @{
+		bool addRuleFile(const std::string &pathToFile, const std::string &nameSpace = "");
+		/// @}
+
+		/// @name Detection methods
+		/// @{
+		bool analyze(const std::string &pathToInputFile, bool storeAllRules = false);
+		bool analyze(const std::uint8_t *data, std::size_t size, bool storeAllRules = false);
+		/// @}
+
+		/// @name Getters
+		/// @{
+		const std::vector<YaraRule>& getDetectedRules() const;
+		const std::vector<YaraRule>& getUndetectedRules() const;
+		bool isInValidState() const;
+		/// @}
+	private:
+		/**
+		 * Compiled rules together with namespace forced to their rules
+		 */
+		struct RuleSet
+		{
+			std::shared_ptr<const CompiledRules> rules;
+			std::string nameSpace;
+		};
+
+		bool prepareTextRules();
+
+		std::vector<RuleSet> precompiledRules;                   ///< sets which cannot be merged
+		std::vector<RuleFile> textRuleFiles;                     ///< files compiled into one set
+		std::vector<RuleSet> textRules;                          ///< compiled text rules
+		std::vector<YaraRule> detectedRules;                     ///< rules matched by last scan
+		std::vector<YaraRule> undetectedRules;                   ///< rules not matched by last scan
+		bool stateIsValid = true;                                ///< @c false if any error occurred
+};
+
+} // namespace yara_support
+} // namespace retdec
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ * @file include/retdec/yara-support/yara_rule.h
+ * @brief Representation of YARA rules, their metas and matches.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_YARA_SUPPORT_YARA_RULE_H
+#define RETDEC_YARA_SUPPORT_YARA_RULE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace retdec {
+namespace yara_support {
+
+/**
+ * Meta attribute of a YARA rule.
+ */
+class YaraMeta
+{
+	public:
+		enum class Type
+		{
+			String,
+			Int
+		};
+
+		/// @name Getters
+		/// @{
+		const std::string& getId() const;
+		Type getType() const;
+		const std::string& getStringValue() const;
+		std::uint64_t getIntValue() const;
+		/// @}
+
+		/// @name Setters
+		/// @{
+		void setId(const std::string &metaId);
+		void setType(Type metaType);
+		void setStringValue(const std::string &value);
+		void setIntValue(std::uint64_t value);
+		/// @}
+	private:
+		std::string id;              ///< name of meta
+		Type type = Type::String;    ///< type of meta value
+		std::string strValue;        ///< string value of meta
+		std::uint64_t intValue = 0;  ///< integral value of meta
+};
+
+/**
+ * One match of a YARA rule string.
+ */
+class YaraMatch
+{
+	public:
+		/// @name Getters
+		/// @{
+		std::uint64_t getOffset() const;
+		std::size_t getDataSize() const;
+		/// @}
+
+		/// @name Setters
+		/// @{
+		void setOffset(std::uint64_t matchOffset);
+		void setDataSize(std::size_t matchDataSize);
+		/// @}
+	private:
+		std::uint64_t offset = 0; ///< offset of match in the scanned data
+		std::size_t dataSize = 0; ///< size of matched data
+};
+
+/**
+ * YARA rule together with its matches in the scanned data.
+ */
+class YaraRule
+{
+	public:
+		/// @name Getters
+		/// @{
+		const std::string& getName() const;
+		const std::string& getNamespace() const;
+		const YaraMeta* getMeta(const std::string &id) const;
+		const YaraMatch* getMatch(std::size_t index) const;
+		const YaraMatch* getFirstMatch() const;
+		const std::vector<YaraMeta>& getMetas() const;
+		const std::vector<YaraMatch>& getMatches() const;
+		std::size_t getNumberOfMetas() const;
+		std::size_t getNumberOfMatches() const;
+		/// @}
+
+		/// @name Setters
+		/// @{
+		void setName(const std::string &ruleName);
+		void setNamespace(const std::string &ruleNamespace);
+		void addMeta(const YaraMeta &meta);
+		void addMatch(const YaraMatch &match);
+		/// @}
+	private:
+		std::string name;               ///< name of rule
+		std::string nameSpace;          ///< namespace of rule
+		std::vector<YaraMeta> metas;    ///< meta attributes of rule
+		std::vector<YaraMatch> matches; ///< matches of rule strings
+};
+
+} // namespace yara_support
+} // namespace retdec
+
+#endif
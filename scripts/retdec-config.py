@@ -42,117 +42,47 @@ parameters beginning with -disable-* may be included only once, which is the
 
  - Optimization -phi2seq is needed to be run at the end and not to run two
  times. This is the reason why it is placed at the very end.
+
+ - BIN2LLVMIR_LLVM_PASSES_ONLY is run twice over the whole module. Putting
+ -llvm-fixpoint in place of both runs repeats the list only on changed
+ functions and their callers until nothing changes (at most
+ -llvm-fixpoint-max-iterations times). It is not used by default until its
+ output is shown to be the same on the regression samples.
+
+ - BIN2LLVMIR_PARAMS are defined only in BIN2LLVMIR_PASSES_FILE and
+ BIN2LLVMIR_LLVM_PASSES_ONLY only in BIN2LLVMIR_LLVM_PASSES_FILE, which the
+ former includes by '@retdec-bin2llvmir-llvm-passes.txt' lines. The same
+ files are compiled into the in-process decompiler and -llvm-fixpoint, so
+ passes have to be changed there.
 """
+BIN2LLVMIR_PASSES_FILE = os.path.join(INSTALL_SHARE_DIR, 'retdec-bin2llvmir-passes.txt')
+BIN2LLVMIR_LLVM_PASSES_FILE = os.path.join(INSTALL_SHARE_DIR, 'retdec-bin2llvmir-llvm-passes.txt')
+
+
+def read_pass_list(path):
+    """Reads passes from the given file, one pass per line. Empty lines and
+    lines starting with '#' are skipped. A line '@file' is replaced with
+    passes from the given file in the same directory.
+    """
+    passes = []
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if line.startswith('@'):
+                passes += read_pass_list(
+                    os.path.join(os.path.dirname(path), line[1:]))
+            elif line and not line.startswith('#'):
+                passes.append(line)
+    return passes
+
+
 BIN2LLVMIR_PARAMS_DISABLES = [
     '-disable-inlining',
     '-disable-simplify-libcalls',
 ]
-BIN2LLVMIR_LLVM_PASSES_ONLY = [
-    '-instcombine',
-    '-tbaa',
-    '-targetlibinfo',
-    '-basicaa',
-    '-domtree',
-    '-simplifycfg',
-    '-domtree',
-    '-early-cse',
-    '-lower-expect',
-    '-targetlibinfo',
-    '-tbaa',
-    '-basicaa',
-    '-globalopt',
-    '-mem2reg',
-    '-instcombine',
-    '-simplifycfg',
-    '-basiccg',
-    '-domtree',
-    '-early-cse',
-    '-lazy-value-info',
-    '-jump-threading',
-    '-correlated-propagation',
-    '-simplifycfg',
-    '-instcombine',
-    '-simplifycfg',
-    '-reassociate',
-    '-domtree',
-    '-loops',
-    '-loop-simplify',
-    '-lcssa',
-    '-loop-rotate',
-    '-licm',
-    '-lcssa',
-    '-instcombine',
-    '-scalar-evolution',
-    '-loop-simplifycfg',
-    '-loop-simplify',
-    '-aa',
-    '-loop-accesses',
-    '-loop-load-elim',
-    '-lcssa',
-    '-indvars',
-    '-loop-idiom',
-    '-loop-deletion',
-    '-memdep',
-    '-gvn',
-    '-memdep',
-    '-sccp',
-    '-instcombine',
-    '-lazy-value-info',
-    '-jump-threading',
-    '-correlated-propagation',
-    '-domtree',
-    '-memdep',
-    '-dse',
-    '-dce',
-    '-bdce',
-    '-adce',
-    '-die',
-    '-simplifycfg',
-    '-instcombine',
-    '-strip-dead-prototypes',
-    '-globaldce',
-    '-constmerge',
-    '-constprop',
-    '-instnamer',
-    '-domtree',
-    '-instcombine',
-]
+BIN2LLVMIR_LLVM_PASSES_ONLY = read_pass_list(BIN2LLVMIR_LLVM_PASSES_FILE)
 
-BIN2LLVMIR_PARAMS = [
-    '-provider-init',
-    '-decoder',
-    '-verify',
-    '-x87-fpu',
-    '-main-detection',
-    '-idioms-libgcc',
-    '-inst-opt',
-    '-cond-branch-opt',
-    '-syscalls',
-    '-stack',
-    '-constants',
-    '-param-return',
-    '-local-vars',
-    '-inst-opt',
-    '-simple-types',
-    '-generate-dsm',
-    '-remove-asm-instrs',
-    '-class-hierarchy',
-    '-select-fncs',
-    '-unreachable-funcs',
-    '-inst-opt',
-    '-x86-addr-spaces',
-    '-value-protect',
-] + BIN2LLVMIR_LLVM_PASSES_ONLY + BIN2LLVMIR_LLVM_PASSES_ONLY + [
-    '-simple-types',
-    '-stack-ptr-op-remove',
-    '-inst-opt',
-    '-idioms',
-    '-global-to-local',
-    '-dead-global-assign',
-    '-instcombine',
-    '-phi2seq',
-    '-value-protect',
-] + BIN2LLVMIR_PARAMS_DISABLES
+BIN2LLVMIR_PARAMS = read_pass_list(BIN2LLVMIR_PASSES_FILE) + BIN2LLVMIR_PARAMS_DISABLES
 
 # Paths to tools.
 FILEINFO = os.path.join(INSTALL_BIN_DIR, 'retdec-fileinfo')
@@ -22,6 +22,7 @@
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 #define debug_enabled false
 #include "retdec/bin2llvmir/utils/llvm.h"
 
@@ -47,8 +48,22 @@ bool ReachingDefinitionsAnalysis::runOnModule(
 	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(&M);
 
 	clear();
-	initializeBasicBlocks(M);
-	run();
+
+	// Functions are independent, so they are analyzed in parallel. All
+	// entries of bbMap are created first, workers only fill them.
+	auto fncs = getDefinedFunctions(M);
+	std::vector<BasicBlockEntries*> entries;
+	entries.reserve(fncs.size());
+	for (auto* F : fncs)
+	{
+		entries.push_back(&bbMap[F]);
+	}
+	getThreadPool().parallelFor(fncs.size(), [&](std::size_t i)
+	{
+		run(*fncs[i], *entries[i]);
+	});
+
+	LOG << *this << "\n";
 
 	_run = true;
 	return false;
@@ -64,34 +79,36 @@ bool ReachingDefinitionsAnalysis::runOnFunction(
 	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(F.getParent());
 
 	clear();
-	initializeBasicBlocks(F);
-	run();
-
-	_run = true;
-	return false;
-}
-
-void ReachingDefinitionsAnalysis::run()
-{
-	initializeBasicBlocksPrev();
-	initializeKillGenSets();
-	propagate();
-	initializeDefsAndUses();
+	if (!F.empty())
+	{
+		run(F, bbMap[&F]);
+	}
 
 	LOG << *this << "\n";
 
-	clearInternal();
+	_run = true;
+	return false;
 }
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Module& M)
+/**
+ * Compute RDA of function @a F into its basic block entries @a bbs. It uses
+ * only data of @a F, so it can run in parallel for different functions.
+ */
+void ReachingDefinitionsAnalysis::run(
+		llvm::Function& F,
+		BasicBlockEntries& bbs) const
 {
-	for (Function& F : M)
-	{
-		initializeBasicBlocks(F);
-	}
+	initializeBasicBlocks(F, bbs);
+	initializeBasicBlocksPrev(bbs);
+	initializeKillGenSets(bbs);
+	propagate(&F, bbs);
+	initializeDefsAndUses(bbs);
+	clearInternal(bbs);
 }
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Function& F)
+void ReachingDefinitionsAnalysis::initializeBasicBlocks(
+		llvm::Function& F,
+		BasicBlockEntries& bbs) const
 {
 	for (BasicBlock& B : F)
 	{
@@ -168,7 +185,7 @@ void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Function& F)
 			}
 		}
 
-		bbMap[&F][&B] = bbe;
+		bbs[&B] = bbe;
 	}
 }
 
@@ -187,10 +204,9 @@ bool ReachingDefinitionsAnalysis::wasRun() const
  * Clear internal structures used to compute RDA, but not needed to use it once
  * it is computed.
  */
-void ReachingDefinitionsAnalysis::clearInternal()
+void ReachingDefinitionsAnalysis::clearInternal(BasicBlockEntries& bbs)
 {
-	for (auto& pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : bbs)
 	{
 		BasicBlockEntry& bb = pair.second;
 		bb.defsOut.clear();
@@ -199,10 +215,10 @@ void ReachingDefinitionsAnalysis::clearInternal()
 	}
 }
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev()
+void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev(
+		BasicBlockEntries& bbs)
 {
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : bbs)
 	{
 		auto B = pair.first;
 		auto &entry = pair.second;
@@ -210,60 +226,57 @@ void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev()
 		for (auto PI = pred_begin(B), E = pred_end(B); PI != E; ++PI)
 		{
 			auto* pred = *PI;
-			auto p = pair1.second.find(pred);
+			auto p = bbs.find(pred);
 
-			assert(p != pair1.second.end() && "we should have all BBs stored in bbMap");
+			assert(p != bbs.end() && "we should have all BBs stored in bbMap");
 
 			entry.prevBBs.insert( &p->second );
 		}
 	}
 }
 
-void ReachingDefinitionsAnalysis::initializeKillGenSets()
+void ReachingDefinitionsAnalysis::initializeKillGenSets(
+		BasicBlockEntries& bbs)
 {
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : bbs)
 	{
 		pair.second.initializeKillDefSets();
 	}
 }
 
-void ReachingDefinitionsAnalysis::propagate()
+void ReachingDefinitionsAnalysis::propagate(
+		const llvm::Function* fnc,
+		BasicBlockEntries& bbs)
 {
-	for (auto &pair1 : bbMap)
+	std::vector<BasicBlockEntry*> workList;
+	workList.reserve(bbs.size());
+	ReversePostOrderTraversal<const Function*> RPOT(fnc); // Expensive to create
+	for (auto I = RPOT.begin(); I != RPOT.end(); ++I)
 	{
-		const Function* fnc = pair1.first;
+		const BasicBlock* bb = *I;
+		auto fIt = bbs.find(bb);
+		assert(fIt != bbs.end());
+		workList.push_back(&(fIt->second));
 
-		std::vector<BasicBlockEntry*> workList;
-		workList.reserve(pair1.second.size());
-		ReversePostOrderTraversal<const Function*> RPOT(fnc); // Expensive to create
-		for (auto I = RPOT.begin(); I != RPOT.end(); ++I)
-		{
-			const BasicBlock* bb = *I;
-			auto fIt = pair1.second.find(bb);
-			assert(fIt != pair1.second.end());
-			workList.push_back(&(fIt->second));
+		fIt->second.changed = true;
+	}
 
-			fIt->second.changed = true;
-		}
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
 
-		bool changed = true;
-		while (changed)
+		for (auto* bbe : workList)
 		{
-			changed = false;
-
-			for (auto* bbe : workList)
-			{
-				changed |= bbe->initDefsOut();
-			}
+			changed |= bbe->initDefsOut();
 		}
 	}
 }
 
-void ReachingDefinitionsAnalysis::initializeDefsAndUses()
+void ReachingDefinitionsAnalysis::initializeDefsAndUses(
+		BasicBlockEntries& bbs)
 {
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : bbs)
 	{
 		BasicBlockEntry &bb = pair.second;
 		OrderedBasicBlock obb(bb.bb);
@@ -353,7 +366,7 @@ std::ostream& operator<<(std::ostream& out, const ReachingDefinitionsAnalysis& r
 //=============================================================================
 //
 
-int BasicBlockEntry::newUID = 0;
+thread_local int BasicBlockEntry::newUID = 0;
 
 BasicBlockEntry::BasicBlockEntry(const llvm::BasicBlock* b) :
 	bb(b),
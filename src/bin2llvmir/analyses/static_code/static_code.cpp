@@ -5,6 +5,7 @@
 */
 
 #include "retdec/bin2llvmir/analyses/static_code/static_code.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 #include "retdec/utils/string.h"
 
 // Debug logs enabled/disabled.
@@ -325,10 +326,10 @@ void searchInSignaturePaths(
 		std::set<std::string>& sigPaths,
 		FileImage* image)
 {
-	for (const auto &path : sigPaths)
-	{
-		codeFinder.search(*image->getImage(), path);
-	}
+	codeFinder.search(
+			*image->getImage(),
+			std::vector<std::string>(sigPaths.begin(), sigPaths.end()),
+			&getThreadPool());
 }
 
 void collectImports(
@@ -55,7 +55,6 @@ bool Decoder::runOnModule(Module& m)
 	_debug = DebugFormatProvider::getDebugFormat(_module);
 	_names = NamesProvider::getNames(_module);
 	_abi = AbiProvider::getAbi(_module);
-	_llvm2capstone = &AsmInstruction::getLlvmToCapstoneInsnMap(_module);
 	return runCatcher();
 }
 
@@ -73,7 +72,6 @@ bool Decoder::runOnModuleCustom(
 	_debug = d;
 	_names = n;
 	_abi = a;
-	_llvm2capstone = &AsmInstruction::getLlvmToCapstoneInsnMap(_module);
 	return runCatcher();
 }
 
@@ -320,7 +318,7 @@ void Decoder::decodeJumpTarget(const JumpTarget& jt)
 		}
 		_somethingDecoded = true;
 
-		_llvm2capstone->emplace(res.llvmInsn, res.capstoneInsn);
+		AsmInstruction::addLlvmToAsmInstruction(res.llvmInsn, res.capstoneInsn);
 
 		bbEnd |= getJumpTargetsFromInstruction(oldAddr, res, bytes.second);
 		bbEnd |= instructionBreaksBasicBlock(oldAddr, res);
@@ -1387,7 +1385,7 @@ void Decoder::handleDelaySlotTypical(
 		{
 			break;
 		}
-		_llvm2capstone->emplace(r.llvmInsn, r.capstoneInsn);
+		AsmInstruction::addLlvmToAsmInstruction(r.llvmInsn, r.capstoneInsn);
 	}
 
 	irb.SetInsertPoint(oldIp);
@@ -1444,7 +1442,7 @@ void Decoder::handleDelaySlotLikely(
 			{
 				break;
 			}
-			_llvm2capstone->emplace(res.llvmInsn, res.capstoneInsn);
+			AsmInstruction::addLlvmToAsmInstruction(res.llvmInsn, res.capstoneInsn);
 		}
 
 		_likelyBb2Target.emplace(newBb, target);
@@ -367,7 +367,7 @@ void Decoder::initAllowedRangesWithConfig()
 
 	if (!selectedFs.empty())
 	{
-		for (auto& dfp : _debug->functions)
+		for (auto& dfp : _debug->getFunctions())
 		{
 			auto& df = dfp.second;
 			auto fIt = selectedFs.find(df.getName());
@@ -851,7 +851,7 @@ void Decoder::initJumpTargetsDebug()
 		return;
 	}
 
-	for (const auto& p : _debug->functions)
+	for (const auto& p : _debug->getFunctions())
 	{
 		utils::Address addr = p.first;
 		if (addr.isUndefined())
@@ -1006,7 +1006,11 @@ void Decoder::initConfigFunctions()
 		std::string realName = _names->getPreferredNameForAddress(start);
 		if (cf->getName() != realName)
 		{
-			cf->setRealName(realName);
+			// Real name is indexed by the container, so the function has to
+			// be inserted again.
+			auto named = *cf;
+			named.setRealName(realName);
+			cf = &_config->getConfig().functions.insert(named).first->second;
 		}
 
 		cf->setIsExported(_exports.count(start));
@@ -92,10 +92,18 @@ void RangesToDecode::removeZeroSequences(
 		uint64_t byte = 0;
 		Address addr;
 
+		// Bytes are read from the view into the loaded file. Bytes which are
+		// not in the file (e.g. zero-filled memory) are read one by one.
+		auto bytes = image->getImage()->getBytesView(start, size);
+
 		while (iter < size)
 		{
 			addr = start + iter;
-			if (image->getImage()->get1Byte(addr, byte))
+			if (iter < bytes.size())
+			{
+				byte = bytes[iter];
+			}
+			if (iter < bytes.size() || image->getImage()->get1Byte(addr, byte))
 			{
 				if (byte == 0)
 				{
@@ -503,6 +503,8 @@ void DsmGenerator::generateData(
 		std::size_t size,
 		const std::string& objVal)
 {
+	auto bytes = _objf->getImage()->getBytesView(start, size);
+
 	Address off = 0;
 	while (off < size)
 	{
@@ -515,7 +517,12 @@ void DsmGenerator::generateData(
 			if (off+off1 < size)
 			{
 				std::uint64_t val = 0;
-				if (_objf->getImage()->get1Byte(start + off + off1, val))
+				if (off + off1 < bytes.size())
+				{
+					val = bytes[off + off1];
+				}
+				if (off + off1 < bytes.size()
+						|| _objf->getImage()->get1Byte(start + off + off1, val))
 				{
 					unsigned char c = val;
 					ret << std::setw(2) << std::setfill('0') << std::hex << val;
@@ -0,0 +1,489 @@
+/**
+* @file src/bin2llvmir/optimizations/llvm_fixpoint/llvm_fixpoint.cpp
+* @brief Run LLVM optimizations on changed functions until a fixed point.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/Triple.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Instruction.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/InitializePasses.h>
+#include <llvm/PassRegistry.h>
+#include <llvm/Support/CommandLine.h>
+
+#include "retdec/bin2llvmir/optimizations/llvm_fixpoint/llvm_fixpoint.h"
+
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+
+namespace {
+
+cl::opt<unsigned> MaxIterations(
+		"llvm-fixpoint-max-iterations",
+		cl::desc("Maximal number of iterations of -llvm-fixpoint."),
+		cl::init(4)
+);
+
+/**
+ * Mix hash @a v into hash @a h (the same as @c boost::hash_combine()).
+ */
+void combine(std::size_t& h, std::size_t v)
+{
+	h ^= v + 0x9e3779b9 + (h << 6) + (h >> 2);
+}
+
+std::size_t hashPointer(const void* p)
+{
+	return std::hash<const void*>()(p);
+}
+
+/**
+ * Mix constant @a c into hash @a h. Aggregates and constant expressions can
+ * be updated in place when their operands change, so their operands are
+ * hashed as well. Other constants are uniqued and never change.
+ */
+void combineConstant(std::size_t& h, const Constant* c)
+{
+	combine(h, hashPointer(c));
+	if (isa<ConstantArray>(c)
+			|| isa<ConstantStruct>(c)
+			|| isa<ConstantVector>(c)
+			|| isa<ConstantExpr>(c))
+	{
+		for (auto& op : c->operands())
+		{
+			if (auto* opc = dyn_cast<Constant>(op.get()))
+			{
+				if (!isa<GlobalValue>(opc))
+				{
+					combineConstant(h, opc);
+					continue;
+				}
+			}
+			combine(h, hashPointer(op.get()));
+		}
+	}
+}
+
+/**
+ * Fingerprint of global variable @a gv. It changes if the variable gets
+ * constant, its initializer (including its contents), linkage or alignment
+ * changes.
+ */
+std::size_t getGlobalFingerprint(const GlobalVariable& gv)
+{
+	std::size_t h = hashPointer(&gv);
+	combine(h, gv.isConstant());
+	combine(h, gv.getLinkage());
+	combine(h, gv.getAlignment());
+	if (gv.hasInitializer())
+	{
+		combineConstant(h, gv.getInitializer());
+	}
+	return h;
+}
+
+/**
+ * Mix everything of instruction @a i which passes may change without
+ * replacing the instruction into hash @a h: flags (nsw, exact, fast-math,
+ * ...), predicates, attributes of calls and metadata.
+ */
+void combineInstructionDetails(std::size_t& h, const Instruction& i)
+{
+	combine(h, i.getRawSubclassOptionalData());
+
+	if (auto* cmp = dyn_cast<CmpInst>(&i))
+	{
+		combine(h, cmp->getPredicate());
+	}
+	else if (auto* call = dyn_cast<CallInst>(&i))
+	{
+		combine(h, hashPointer(call->getAttributes().getRawPointer()));
+		combine(h, call->getCallingConv());
+		combine(h, call->isTailCall());
+		// Callee may get attributes (e.g. readnone) which enable further
+		// optimizations of callers.
+		if (auto* callee = call->getCalledFunction())
+		{
+			combine(h, hashPointer(callee->getAttributes().getRawPointer()));
+		}
+	}
+	else if (auto* load = dyn_cast<LoadInst>(&i))
+	{
+		combine(h, load->isVolatile());
+		combine(h, load->getAlignment());
+	}
+	else if (auto* store = dyn_cast<StoreInst>(&i))
+	{
+		combine(h, store->isVolatile());
+		combine(h, store->getAlignment());
+	}
+
+	SmallVector<std::pair<unsigned, MDNode*>, 4> mds;
+	i.getAllMetadata(mds);
+	for (auto& md : mds)
+	{
+		combine(h, md.first);
+		combine(h, hashPointer(md.second));
+	}
+}
+
+/**
+ * Insert all functions using value @a v (directly or through constant
+ * expressions) into @a dirty.
+ */
+void markUsers(const Value* v, std::set<const Function*>& dirty)
+{
+	for (auto* u : v->users())
+	{
+		if (auto* i = dyn_cast<Instruction>(u))
+		{
+			dirty.insert(i->getParent()->getParent());
+		}
+		else if (isa<Constant>(u) && !isa<GlobalValue>(u))
+		{
+			markUsers(u, dirty);
+		}
+	}
+}
+
+} // anonymous namespace
+
+char LlvmFixpoint::ID = 0;
+
+static RegisterPass<LlvmFixpoint> X(
+		"llvm-fixpoint",
+		"LLVM optimizations until a fixed point",
+		false, // Only looks at CFG
+		false // Analysis Pass
+);
+
+/**
+ * Create pass running the default LLVM passes at most
+ * @c -llvm-fixpoint-max-iterations times.
+ */
+LlvmFixpoint::LlvmFixpoint() :
+		LlvmFixpoint(getDefaultPasses(), 0)
+{
+
+}
+
+/**
+ * @param passes        Names of LLVM passes (without the leading dash).
+ * @param maxIterations Maximal number of iterations. If it is @c 0,
+ *                      @c -llvm-fixpoint-max-iterations is used.
+ */
+LlvmFixpoint::LlvmFixpoint(
+		const std::vector<std::string>& passes,
+		unsigned maxIterations) :
+		ModulePass(ID),
+		_passes(passes),
+		_maxIterations(maxIterations)
+{
+	PassRegistry& registry = *PassRegistry::getPassRegistry();
+	initializeCore(registry);
+	initializeScalarOpts(registry);
+	initializeIPO(registry);
+	initializeAnalysis(registry);
+	initializeTransformUtils(registry);
+	initializeInstCombine(registry);
+}
+
+void LlvmFixpoint::getAnalysisUsage(AnalysisUsage& AU) const
+{
+	AU.addRequired<TargetLibraryInfoWrapperPass>();
+}
+
+bool LlvmFixpoint::runOnModule(Module& M)
+{
+	_module = &M;
+
+	// Library functions disabled in the outer pass manager (e.g. by
+	// -disable-simplify-libcalls) must stay disabled in our pass managers.
+	auto& tli = getAnalysis<TargetLibraryInfoWrapperPass>().getTLI();
+	_tlii = std::make_unique<TargetLibraryInfoImpl>(
+			Triple(M.getTargetTriple()));
+	for (unsigned i = 0; i < LibFunc::NumLibFuncs; ++i)
+	{
+		auto f = static_cast<LibFunc::Func>(i);
+		if (!tli.has(f))
+		{
+			_tlii->setUnavailable(f);
+		}
+	}
+
+	return run();
+}
+
+/**
+ * Get the number of iterations done by the last run.
+ */
+unsigned LlvmFixpoint::getIterationCount() const
+{
+	return _iterations;
+}
+
+/**
+ * Get LLVM passes run by default. They are defined in
+ * @c scripts/retdec-bin2llvmir-llvm-passes.txt, which is also used by
+ * @c scripts/retdec-config.py.
+ */
+const std::vector<std::string>& LlvmFixpoint::getDefaultPasses()
+{
+	static const std::vector<std::string> passes =
+	{
+#include "llvm_fixpoint_passes.inc"
+	};
+	return passes;
+}
+
+/**
+ * @return @c True if module @a _module was modified in any way,
+ *         @c false otherwise.
+ */
+bool LlvmFixpoint::run()
+{
+	if (_module == nullptr)
+	{
+		return false;
+	}
+
+	auto maxIterations = _maxIterations ? _maxIterations : MaxIterations;
+	createGroups();
+
+	std::set<const Function*> dirty;
+	for (auto& f : *_module)
+	{
+		if (!f.isDeclaration())
+		{
+			dirty.insert(&f);
+		}
+	}
+
+	bool changed = false;
+	_iterations = 0;
+	while (_iterations < maxIterations)
+	{
+		++_iterations;
+
+		auto before = getFingerprints();
+		changed |= runIteration(dirty);
+
+		dirty.clear();
+		if (!markChanged(before, dirty))
+		{
+			break;
+		}
+	}
+
+	_groups.clear();
+	return changed;
+}
+
+/**
+ * Split passes into groups of consecutive function passes and consecutive
+ * module passes. Every group gets its own pass manager.
+ */
+void LlvmFixpoint::createGroups()
+{
+	_groups.clear();
+	_immutablePasses.clear();
+
+	PassRegistry& registry = *PassRegistry::getPassRegistry();
+	std::vector<std::unique_ptr<Pass>> transforms;
+	for (auto& name : _passes)
+	{
+		auto* info = registry.getPassInfo(name);
+		if (info == nullptr || info->getNormalCtor() == nullptr)
+		{
+			throw std::runtime_error("cannot create LLVM pass: " + name);
+		}
+
+		std::unique_ptr<Pass> p(info->getNormalCtor()());
+		if (p->getAsImmutablePass())
+		{
+			// Target library info is created from the outer pass manager.
+			if (info->getTypeInfo() != &TargetLibraryInfoWrapperPass::ID
+					&& std::find(_immutablePasses.begin(),
+							_immutablePasses.end(), info)
+							== _immutablePasses.end())
+			{
+				_immutablePasses.push_back(info);
+			}
+		}
+		else if (!info->isAnalysis() && !info->isAnalysisGroup())
+		{
+			transforms.push_back(std::move(p));
+		}
+	}
+
+	for (auto& p : transforms)
+	{
+		bool modulePass = p->getPassKind() == PT_Module
+				|| p->getPassKind() == PT_CallGraphSCC;
+		if (_groups.empty()
+				|| modulePass != (_groups.back().modulePasses != nullptr))
+		{
+			Group g;
+			if (modulePass)
+			{
+				g.modulePasses = std::make_unique<legacy::PassManager>();
+				addImmutablePasses(*g.modulePasses);
+			}
+			else
+			{
+				g.functionPasses =
+						std::make_unique<legacy::FunctionPassManager>(_module);
+				addImmutablePasses(*g.functionPasses);
+			}
+			_groups.push_back(std::move(g));
+		}
+
+		auto& g = _groups.back();
+		if (modulePass)
+		{
+			g.modulePasses->add(p.release());
+		}
+		else
+		{
+			g.functionPasses->add(p.release());
+		}
+	}
+}
+
+/**
+ * Add target library info and immutable passes from the list (e.g. alias
+ * analyses) into pass manager @a pm.
+ */
+void LlvmFixpoint::addImmutablePasses(legacy::PassManagerBase& pm) const
+{
+	pm.add(new TargetLibraryInfoWrapperPass(*_tlii));
+	for (auto* info : _immutablePasses)
+	{
+		pm.add(info->getNormalCtor()());
+	}
+}
+
+/**
+ * Run all groups once. Function passes run only on functions in @a dirty.
+ * Functions changed by module passes are inserted into @a dirty.
+ * @return @c True if some pass manager modified the module.
+ */
+bool LlvmFixpoint::runIteration(std::set<const Function*>& dirty)
+{
+	bool changed = false;
+	for (auto& g : _groups)
+	{
+		if (g.functionPasses)
+		{
+			g.functionPasses->doInitialization();
+			for (auto& f : *_module)
+			{
+				if (dirty.count(&f))
+				{
+					changed |= g.functionPasses->run(f);
+				}
+			}
+			g.functionPasses->doFinalization();
+		}
+		else
+		{
+			auto before = getFingerprints();
+			changed |= g.modulePasses->run(*_module);
+			markChanged(before, dirty);
+		}
+	}
+	return changed;
+}
+
+/**
+ * Get fingerprints of all defined functions and global variables.
+ */
+LlvmFixpoint::Fingerprints LlvmFixpoint::getFingerprints() const
+{
+	Fingerprints ret;
+	for (auto& f : *_module)
+	{
+		if (!f.isDeclaration())
+		{
+			ret[&f] = getFingerprint(f);
+		}
+	}
+	for (auto& gv : _module->globals())
+	{
+		ret[&gv] = getGlobalFingerprint(gv);
+	}
+	return ret;
+}
+
+/**
+ * Insert functions changed since fingerprints @a before were taken, their
+ * callers and functions using changed global variables into @a dirty.
+ * @return @c True if some function or global variable was changed, added,
+ *         or removed.
+ */
+bool LlvmFixpoint::markChanged(
+		const Fingerprints& before,
+		std::set<const Function*>& dirty) const
+{
+	auto after = getFingerprints();
+	bool changed = after.size() != before.size();
+	for (auto& p : after)
+	{
+		auto it = before.find(p.first);
+		if (it != before.end() && it->second == p.second)
+		{
+			continue;
+		}
+
+		changed = true;
+		if (auto* f = dyn_cast<Function>(p.first))
+		{
+			dirty.insert(f);
+		}
+		// Callers of changed functions and users of changed global variables
+		// may be optimized further as well.
+		markUsers(p.first, dirty);
+	}
+	return changed;
+}
+
+/**
+ * Fingerprint of function @a f. It changes whenever an instruction is added,
+ * removed, gets different operands, flags, attributes or metadata, or when
+ * attributes, calling convention or linkage of the function or attributes of
+ * functions it calls change. Names are not taken into account.
+ */
+std::size_t LlvmFixpoint::getFingerprint(const Function& f)
+{
+	std::size_t h = f.size();
+	combine(h, hashPointer(f.getAttributes().getRawPointer()));
+	combine(h, f.getCallingConv());
+	combine(h, f.getLinkage());
+	for (auto& bb : f)
+	{
+		combine(h, hashPointer(&bb));
+		for (auto& i : bb)
+		{
+			combine(h, i.getOpcode());
+			combine(h, hashPointer(&i));
+			for (auto& op : i.operands())
+			{
+				combine(h, hashPointer(op.get()));
+			}
+			combineInstructionDetails(h, i);
+		}
+	}
+	return h;
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
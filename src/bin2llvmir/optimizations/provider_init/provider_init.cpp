@@ -39,8 +39,19 @@ cl::opt<std::string> ConfigPath(
 		cl::init("")
 );
 
-ProviderInitialization::ProviderInitialization() :
-		ModulePass(ID)
+/**
+ * @param c  Config to use instead of the one from @c -config-path. It is
+ *           copied into the config provider when the pass is run.
+ * @param ff Input file to use instead of loading the one from config.
+ *
+ * This allows to run bin2llvmir passes on data already loaded in memory.
+ */
+ProviderInitialization::ProviderInitialization(
+		const retdec::config::Config* c,
+		const std::shared_ptr<retdec::fileformat::FileFormat>& ff) :
+		ModulePass(ID),
+		_config(c),
+		_fileFormat(ff)
 {
 
 }
@@ -50,14 +61,17 @@ ProviderInitialization::ProviderInitialization() :
  */
 bool ProviderInitialization::runOnModule(Module& m)
 {
-	static bool firstRun = true;
+	// Providers are initialized only once for each module.
 	std::string confPath = ConfigPath;
-	if (!firstRun || confPath.empty())
+	if (ConfigProvider::getConfig(&m)
+			|| (_config == nullptr && confPath.empty()))
 	{
 		return false;
 	}
 
-	auto* c = ConfigProvider::addConfigFile(&m, confPath);
+	auto* c = _config
+			? ConfigProvider::addConfig(&m, *_config)
+			: ConfigProvider::addConfigFile(&m, confPath);
 	if (c == nullptr)
 	{
 		return false;
@@ -73,10 +87,12 @@ bool ProviderInitialization::runOnModule(Module& m)
 		return false;
 	}
 
-	auto* f = FileImageProvider::addFileImage(
-			&m,
-			c->getConfig().getInputFile(),
-			c);
+	auto* f = _fileFormat
+			? FileImageProvider::addFileImage(&m, _fileFormat, c)
+			: FileImageProvider::addFileImage(
+					&m,
+					c->getConfig().getInputFile(),
+					c);
 	if (f == nullptr)
 	{
 		return false;
@@ -93,9 +109,7 @@ bool ProviderInitialization::runOnModule(Module& m)
 
 	NamesProvider::addNames(&m, c, debug, f, d, lti);
 
-	AsmInstruction::clear();
-
-	firstRun = false;
+	AsmInstruction::clear(&m);
 
 	return false;
 }
@@ -762,7 +762,7 @@ std::ostream& operator<<(std::ostream& out, const EqSetContainer& eqs)
 //=============================================================================
 //
 
-unsigned EqSet::newUID = 0;
+thread_local unsigned EqSet::newUID = 0;
 
 EqSet::EqSet() :
 		id(newUID++)
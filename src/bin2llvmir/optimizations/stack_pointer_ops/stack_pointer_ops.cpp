@@ -7,6 +7,7 @@
 #include <cassert>
 #include <iomanip>
 #include <iostream>
+#include <set>
 
 #include <llvm/IR/InstIterator.h>
 #include <llvm/IR/Instruction.h>
@@ -16,6 +17,7 @@
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/optimizations/stack_pointer_ops/stack_pointer_ops.h"
 #include "retdec/bin2llvmir/utils/debug.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 
 using namespace retdec::utils;
 using namespace llvm;
@@ -67,6 +69,10 @@ bool StackPointerOpsRemove::run()
 	return changed;
 }
 
+/**
+ * Stores into the stack pointer register are analyzed in all functions in
+ * parallel and then removed one function after another.
+ */
 bool StackPointerOpsRemove::removeStackPointerStores()
 {
 	if (_config == nullptr)
@@ -75,36 +81,33 @@ bool StackPointerOpsRemove::removeStackPointerStores()
 		return false;
 	}
 
-	bool changed = false;
-	for (auto& F : _module->getFunctionList())
-	for (auto& B : F)
+	auto toRemove = analyzeFunctions(
+			getDefinedFunctions(*_module),
+			[this](Function& f) { return findStackPointerStores(f); });
+
+	return eraseInstructions(toRemove);
+}
+
+/**
+ * @return Stores into the stack pointer register in function @a f.
+ */
+std::vector<llvm::Instruction*> StackPointerOpsRemove::findStackPointerStores(
+		llvm::Function& f) const
+{
+	std::vector<llvm::Instruction*> ret;
+	for (auto& B : f)
+	for (auto& I : B)
 	{
-		auto it = B.begin();
-		while (it != B.end())
+		if (StoreInst* s = dyn_cast<StoreInst>(&I))
 		{
-			// We need to move to the next instruction before optimizing
-			// (potentially removing) the current instruction. Otherwise,
-			// the iterator would become invalid.
-			//
-			auto* inst = &(*it);
-			++it;
-
-			if (StoreInst* s = dyn_cast<StoreInst>(inst))
+			auto* reg = s->getPointerOperand();
+			if (_config->isStackPointerRegister(reg))
 			{
-				auto* reg = s->getPointerOperand();
-				if (!_config->isStackPointerRegister(reg))
-				{
-					continue;
-				}
-
-				LOG << "erase: " << llvmObjToString(inst) << std::endl;
-				inst->eraseFromParent();
-				changed = true;
+				ret.push_back(s);
 			}
 		}
 	}
-
-	return changed;
+	return ret;
 }
 
 /**
@@ -113,33 +116,65 @@ bool StackPointerOpsRemove::removeStackPointerStores()
  */
 bool StackPointerOpsRemove::removePreservationStores()
 {
-	bool changed = false;
+	auto toRemove = analyzeFunctions(
+			getDefinedFunctions(*_module),
+			[](Function& f) { return findPreservationStores(f); });
 
-	for (auto& f : _module->getFunctionList())
+	return eraseInstructions(toRemove);
+}
+
+/**
+ * @return Stores which preserve ebp in allocas of function @a f.
+ */
+std::vector<llvm::Instruction*> StackPointerOpsRemove::findPreservationStores(
+		llvm::Function& f)
+{
+	std::vector<llvm::Instruction*> ret;
+
+	for (inst_iterator I = inst_begin(f), E = inst_end(f); I != E; ++I)
 	{
-		for (inst_iterator I = inst_begin(f), E = inst_end(f); I != E; ++I)
+		auto* a = dyn_cast<AllocaInst>(&*I);
+		if (a == nullptr)
 		{
-			auto* a = dyn_cast<AllocaInst>(&*I);
-			if (a == nullptr)
+			continue;
+		}
+
+		bool remove = true;
+		Value* storedVal = nullptr;
+		std::set<llvm::Instruction*> toRemove;
+		for (auto* u : a->users())
+		{
+			if (auto* s = dyn_cast<StoreInst>(u))
 			{
-				continue;
+				auto* l = dyn_cast<LoadInst>(s->getValueOperand());
+				if (l && storedVal == nullptr
+						&& (l->getPointerOperand()->getName() == "ebp" || l->getPointerOperand()->getName() == "rbp"))
+				{
+					storedVal = l->getPointerOperand();
+					toRemove.insert(s);
+				}
+				else if (l && l->getPointerOperand() == storedVal)
+				{
+					toRemove.insert(s);
+				}
+				else
+				{
+					remove = false;
+					break;
+				}
 			}
-
-			bool remove = true;
-			Value* storedVal = nullptr;
-			std::set<llvm::Instruction*> toRemove;
-			for (auto* u : a->users())
+			else if (isa<LoadInst>(u) || isa<CastInst>(u))
 			{
-				if (auto* s = dyn_cast<StoreInst>(u))
+				for (auto* uu : u->users())
 				{
-					auto* l = dyn_cast<LoadInst>(s->getValueOperand());
-					if (l && storedVal == nullptr
-							&& (l->getPointerOperand()->getName() == "ebp" || l->getPointerOperand()->getName() == "rbp"))
+					auto* s = dyn_cast<StoreInst>(uu);
+					if (s && storedVal == nullptr
+							&& (s->getPointerOperand()->getName() == "ebp" || s->getPointerOperand()->getName() == "rbp"))
 					{
-						storedVal = l->getPointerOperand();
+						storedVal = s->getPointerOperand();
 						toRemove.insert(s);
 					}
-					else if (l && l->getPointerOperand() == storedVal)
+					else if (s && s->getPointerOperand() == storedVal)
 					{
 						toRemove.insert(s);
 					}
@@ -149,51 +184,45 @@ bool StackPointerOpsRemove::removePreservationStores()
 						break;
 					}
 				}
-				else if (isa<LoadInst>(u) || isa<CastInst>(u))
-				{
-					for (auto* uu : u->users())
-					{
-						auto* s = dyn_cast<StoreInst>(uu);
-						if (s && storedVal == nullptr
-								&& (s->getPointerOperand()->getName() == "ebp" || s->getPointerOperand()->getName() == "rbp"))
-						{
-							storedVal = s->getPointerOperand();
-							toRemove.insert(s);
-						}
-						else if (s && s->getPointerOperand() == storedVal)
-						{
-							toRemove.insert(s);
-						}
-						else
-						{
-							remove = false;
-							break;
-						}
-					}
 
-					if (!remove)
-					{
-						break;
-					}
-				}
-				else
+				if (!remove)
 				{
-					remove = false;
 					break;
 				}
 			}
-
-			if (remove)
+			else
 			{
-				for (auto* i : toRemove)
-				{
-					i->eraseFromParent();
-					changed = true;
-				}
+				remove = false;
+				break;
 			}
 		}
+
+		if (remove)
+		{
+			ret.insert(ret.end(), toRemove.begin(), toRemove.end());
+		}
 	}
 
+	return ret;
+}
+
+/**
+ * Erase instructions found in functions. Functions are processed in the
+ * module order, so the result does not depend on the number of threads.
+ */
+bool StackPointerOpsRemove::eraseInstructions(
+		const std::vector<std::vector<llvm::Instruction*>>& toRemove)
+{
+	bool changed = false;
+	for (auto& insts : toRemove)
+	{
+		for (auto* i : insts)
+		{
+			LOG << "erase: " << llvmObjToString(i) << std::endl;
+			i->eraseFromParent();
+			changed = true;
+		}
+	}
 	return changed;
 }
 
@@ -9,6 +9,7 @@
 #include "retdec/bin2llvmir/providers/abi/mips.h"
 #include "retdec/bin2llvmir/providers/abi/powerpc.h"
 #include "retdec/bin2llvmir/providers/abi/x86.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 
 using namespace llvm;
 
@@ -198,8 +199,6 @@ bool Abi::isPowerPC() const
 //==============================================================================
 //
 
-std::map<llvm::Module*, std::unique_ptr<Abi>> AbiProvider::_module2abi;
-
 Abi* AbiProvider::addAbi(
 		llvm::Module* m,
 		Config* c)
@@ -209,35 +208,37 @@ Abi* AbiProvider::addAbi(
 		return nullptr;
 	}
 
+	auto& ctx = ProviderContext::getOrCreate(m);
+	if (ctx.abi)
+	{
+		return ctx.abi.get();
+	}
+
 	if (c->getConfig().architecture.isArmOrThumb())
 	{
-		auto p = _module2abi.emplace(m, std::make_unique<AbiArm>(m, c));
-		return p.first->second.get();
+		ctx.abi = std::make_unique<AbiArm>(m, c);
 	}
 	else if (c->getConfig().architecture.isMipsOrPic32())
 	{
-		auto p = _module2abi.emplace(m, std::make_unique<AbiMips>(m, c));
-		return p.first->second.get();
+		ctx.abi = std::make_unique<AbiMips>(m, c);
 	}
 	else if (c->getConfig().architecture.isPpc())
 	{
-		auto p = _module2abi.emplace(m, std::make_unique<AbiPowerpc>(m, c));
-		return p.first->second.get();
+		ctx.abi = std::make_unique<AbiPowerpc>(m, c);
 	}
 	else if (c->getConfig().architecture.isX86())
 	{
-		auto p = _module2abi.emplace(m, std::make_unique<AbiX86>(m, c));
-		return p.first->second.get();
+		ctx.abi = std::make_unique<AbiX86>(m, c);
 	}
 	// ...
 
-	return nullptr;
+	return ctx.abi.get();
 }
 
 Abi* AbiProvider::getAbi(llvm::Module* m)
 {
-	auto f = _module2abi.find(m);
-	return f != _module2abi.end() ? f->second.get() : nullptr;
+	auto* c = ProviderContext::get(m);
+	return c ? c->abi.get() : nullptr;
 }
 
 bool AbiProvider::getAbi(llvm::Module* m, Abi*& abi)
@@ -248,7 +249,7 @@ bool AbiProvider::getAbi(llvm::Module* m, Abi*& abi)
 
 void AbiProvider::clear()
 {
-	_module2abi.clear();
+	ProviderContext::forEach([](ProviderContext& c) { c.abi.reset(); });
 }
 
 } // namespace bin2llvmir
@@ -4,13 +4,19 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+#include <unordered_map>
+
 #include <llvm/IR/Constants.h>
 #include <llvm/IR/InstIterator.h>
+#include <llvm/IR/ValueHandle.h>
+#include <llvm/IR/ValueMap.h>
 
 #include "retdec/utils/container.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/debug.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 #include "retdec/bin2llvmir/utils/llvm.h"
@@ -20,44 +26,225 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
-std::vector<AsmInstruction::ModuleGlobalPair> AsmInstruction::_module2global;
-std::vector<AsmInstruction::ModuleInstructionMap> AsmInstruction::_module2instMap;
+//
+//==============================================================================
+// AsmInstruction::ModuleIndex
+//==============================================================================
+//
 
-AsmInstruction::AsmInstruction()
+namespace {
+
+/**
+ * Entries of removed instructions are dropped from the map. Entries are not
+ * moved to values replacing their instructions.
+ */
+struct DropOnlyConfig : ValueMapConfig<const Instruction*>
 {
+	enum { FollowRAUW = false };
+};
 
-}
+} // anonymous namespace
 
-AsmInstruction::AsmInstruction(llvm::Instruction* inst)
+/**
+ * Index of special LLVM-to-ASM mapping instructions in one module.
+ *
+ * It maps addresses to special instructions, and ordinary instructions to
+ * special instructions of ASM instructions they belong to. The latter is
+ * filled lazily as instructions are looked up.
+ *
+ * Both maps are kept up to date as instructions are removed. Owners of
+ * instructions are invalidated whenever a special instruction is added or
+ * removed, because that may change the ASM instruction some LLVM instructions
+ * belong to.
+ */
+class AsmInstruction::ModuleIndex
 {
-	if (inst == nullptr)
-	{
-		return;
-	}
+	public:
+		/**
+		 * Handle of special instruction which invalidates owners of
+		 * instructions when the special instruction is removed.
+		 */
+		class SpecialHandle : public CallbackVH
+		{
+			public:
+				SpecialHandle(StoreInst* s, ModuleIndex* index) :
+						CallbackVH(s),
+						_index(index)
+				{
 
-	auto* bb = inst->getParent();
-	while (inst && !isLlvmToAsmInstructionPrivate(inst))
-	{
-		if (&bb->front() == inst)
+				}
+
+				StoreInst* get() const
+				{
+					return cast_or_null<StoreInst>(
+							static_cast<Value*>(*this));
+				}
+
+				virtual void deleted() override
+				{
+					++_index->epoch;
+					setValPtr(nullptr);
+				}
+
+			private:
+				ModuleIndex* _index = nullptr;
+		};
+
+		/**
+		 * Special instruction owning an ordinary instruction, valid only
+		 * while @c epoch is the same as the index's one.
+		 */
+		struct Owner
 		{
-			if (&bb->getParent()->front() == bb)
+			StoreInst* special = nullptr;
+			std::size_t epoch = 0;
+		};
+
+	public:
+		ModuleIndex(GlobalVariable* gv) :
+				global(gv)
+		{
+			// Users are listed from the most recently added one.
+			for (auto* u : gv->users())
+			{
+				auto* s = dyn_cast<StoreInst>(u);
+				if (s && s->getPointerOperand() == gv)
+				{
+					add(s, true);
+				}
+			}
+		}
+
+		/**
+		 * Add special instruction. If there are more of them with the
+		 * same address, the last added one is found.
+		 */
+		void add(StoreInst* s, bool asOldest = false)
+		{
+			auto* ci = dyn_cast<ConstantInt>(s->getValueOperand());
+			if (ci == nullptr)
 			{
 				return;
 			}
-			else
+
+			auto& specials = addr2special[ci->getZExtValue()];
+			specials.emplace(
+					asOldest ? specials.begin() : specials.end(),
+					s,
+					this);
+			++epoch;
+		}
+
+		StoreInst* find(std::uint64_t addr)
+		{
+			auto it = addr2special.find(addr);
+			if (it == addr2special.end())
 			{
-				bb = bb->getPrevNode();
-				inst = &bb->back();
+				return nullptr;
+			}
+
+			auto& specials = it->second;
+			while (!specials.empty() && specials.back().get() == nullptr)
+			{
+				specials.pop_back();
 			}
+			return specials.empty() ? nullptr : specials.back().get();
 		}
-		else
+
+		bool isSpecial(const Instruction* i) const
+		{
+			auto* s = dyn_cast<StoreInst>(i);
+			return s && s->getPointerOperand() == global;
+		}
+
+		/**
+		 * Find special instruction of ASM instruction @a inst belongs to.
+		 * It is the closest special instruction before @a inst (including
+		 * instructions in preceding basic blocks). All instructions passed on
+		 * the way there have the same owner, so they are remembered too.
+		 */
+		StoreInst* findOwner(Instruction* inst)
 		{
-			inst = inst->getPrevNode();
+			std::vector<Instruction*> passed;
+			StoreInst* owner = nullptr;
+
+			auto* bb = inst->getParent();
+			while (true)
+			{
+				if (isSpecial(inst))
+				{
+					owner = cast<StoreInst>(inst);
+					break;
+				}
+
+				auto it = inst2owner.find(inst);
+				if (it != inst2owner.end() && it->second.epoch == epoch)
+				{
+					owner = it->second.special;
+					break;
+				}
+				passed.push_back(inst);
+
+				if (&bb->front() != inst)
+				{
+					inst = inst->getPrevNode();
+				}
+				else if (&bb->getParent()->front() != bb)
+				{
+					bb = bb->getPrevNode();
+					inst = &bb->back();
+				}
+				else
+				{
+					break;
+				}
+			}
+
+			for (auto* i : passed)
+			{
+				inst2owner[i] = Owner{owner, epoch};
+			}
+			return owner;
 		}
+
+	public:
+		/// Special global variable of module.
+		GlobalVariable* global = nullptr;
+		/// Incremented on every change of special instructions.
+		std::size_t epoch = 0;
+		/// Special instructions by addresses.
+		std::unordered_map<std::uint64_t, std::vector<SpecialHandle>> addr2special;
+		/// Owners of ordinary instructions.
+		ValueMap<const Instruction*, Owner, DropOnlyConfig> inst2owner;
+};
+
+//
+//==============================================================================
+// AsmInstruction
+//==============================================================================
+//
+
+void AsmInstruction::ModuleIndexDeleter::operator()(ModuleIndex* index) const
+{
+	delete index;
+}
+
+AsmInstruction::AsmInstruction()
+{
+
+}
+
+AsmInstruction::AsmInstruction(llvm::Instruction* inst)
+{
+	if (inst == nullptr)
+	{
+		return;
 	}
 
-	auto* s = dyn_cast_or_null<StoreInst>(inst);
-	_llvmToAsmInstr = isLlvmToAsmInstructionPrivate(s) ? s : nullptr;
+	if (auto* index = getModuleIndex(inst->getModule()))
+	{
+		_llvmToAsmInstr = index->findOwner(inst);
+	}
 }
 
 AsmInstruction::AsmInstruction(llvm::BasicBlock* bb)
@@ -95,22 +282,9 @@ AsmInstruction::AsmInstruction(llvm::Module* m, retdec::utils::Address addr)
 		return;
 	}
 
-	ConstantInt* ci = ConstantInt::get(
-			Type::getInt64Ty(m->getContext()),
-			addr,
-			false);
-	if (ci == nullptr)
-	{
-		return;
-	}
-
-	for (auto* u : ci->users())
+	if (auto* index = getModuleIndex(m))
 	{
-		if (isLlvmToAsmInstructionPrivate(u))
-		{
-			_llvmToAsmInstr = dyn_cast_or_null<StoreInst>(u);
-			return;
-		}
+		_llvmToAsmInstr = index->find(addr);
 	}
 }
 
@@ -186,38 +360,76 @@ const llvm::GlobalVariable* AsmInstruction::getLlvmToAsmGlobalVariablePrivate(
 Llvm2CapstoneMap& AsmInstruction::getLlvmToCapstoneInsnMap(
 		const llvm::Module* m)
 {
-	for (auto& p : _module2instMap)
-	{
-		if (p.first == m)
-		{
-			return p.second;
-		}
-	}
-
-	auto it = _module2instMap.emplace(_module2instMap.end(), std::make_pair(
-			m,
-			std::map<llvm::StoreInst*, cs_insn*>()));
-	return it->second;
+	return ProviderContext::getOrCreate(m).llvmToCapstone;
 }
 
 llvm::GlobalVariable* AsmInstruction::getLlvmToAsmGlobalVariable(
 		const llvm::Module* m)
 {
-	for (auto& p : _module2global)
-	{
-		if (p.first == m)
-		{
-			return p.second;
-		}
-	}
-	return nullptr;
+	auto* c = ProviderContext::get(m);
+	return c ? c->llvmToAsmGlobal : nullptr;
 }
 
 void AsmInstruction::setLlvmToAsmGlobalVariable(
 		const llvm::Module* m,
 		llvm::GlobalVariable* gv)
 {
-	_module2global.emplace_back(m, gv);
+	auto& c = ProviderContext::getOrCreate(m);
+	c.asmIndex.reset();
+	c.llvmToAsmGlobal = gv;
+}
+
+/**
+ * Register a new special LLVM-to-ASM instruction @a s created for Capstone
+ * instruction @a insn. All special instructions created after the module was
+ * first queried must be registered, otherwise they are not found by address
+ * and instructions after them may be assigned to previous ASM instructions.
+ */
+void AsmInstruction::addLlvmToAsmInstruction(
+		llvm::StoreInst* s,
+		cs_insn* insn)
+{
+	auto* m = s->getModule();
+	getLlvmToCapstoneInsnMap(m).emplace(s, insn);
+	if (auto* index = findModuleIndex(m))
+	{
+		index->add(s);
+	}
+}
+
+/**
+ * Get index of special instructions in module @a m. It is created on the
+ * first use.
+ * @return Index or @c nullptr if module has no special global variable.
+ */
+AsmInstruction::ModuleIndex* AsmInstruction::getModuleIndex(
+		const llvm::Module* m)
+{
+	if (auto* index = findModuleIndex(m))
+	{
+		return index;
+	}
+
+	auto* gv = getLlvmToAsmGlobalVariable(m);
+	if (gv == nullptr)
+	{
+		return nullptr;
+	}
+
+	auto& c = ProviderContext::getOrCreate(m);
+	c.asmIndex.reset(new ModuleIndex(gv));
+	return c.asmIndex.get();
+}
+
+/**
+ * Get index of special instructions in module @a m if it was already created.
+ * @return Index or @c nullptr if there is none.
+ */
+AsmInstruction::ModuleIndex* AsmInstruction::findModuleIndex(
+		const llvm::Module* m)
+{
+	auto* c = ProviderContext::get(m);
+	return c ? c->asmIndex.get() : nullptr;
 }
 
 retdec::utils::Address AsmInstruction::getInstructionAddress(
@@ -272,8 +484,23 @@ bool AsmInstruction::isLlvmToAsmInstruction(const llvm::Value* inst)
 
 void AsmInstruction::clear()
 {
-	_module2global.clear();
-	_module2instMap.clear();
+	ProviderContext::forEach([](ProviderContext& c)
+	{
+		clear(c.getModule());
+	});
+}
+
+/**
+ * Drop all data associated with module @a m.
+ */
+void AsmInstruction::clear(const llvm::Module* m)
+{
+	if (auto* c = ProviderContext::get(m))
+	{
+		c->asmIndex.reset();
+		c->llvmToAsmGlobal = nullptr;
+		c->llvmToCapstone.clear();
+	}
 }
 
 bool AsmInstruction::isValid() const
@@ -288,16 +515,14 @@ bool AsmInstruction::isInvalid() const
 
 cs_insn* AsmInstruction::getCapstoneInsn() const
 {
-	for (auto& p : _module2instMap)
+	auto* c = ProviderContext::get(_llvmToAsmInstr->getModule());
+	if (c == nullptr)
 	{
-		if (p.first == _llvmToAsmInstr->getModule())
-		{
-			auto it =  p.second.find(_llvmToAsmInstr);
-			return it != p.second.end() ? it->second : nullptr;
-		}
+		return nullptr;
 	}
 
-	return nullptr;
+	auto it = c->llvmToCapstone.find(_llvmToAsmInstr);
+	return it != c->llvmToCapstone.end() ? it->second : nullptr;
 }
 
 bool AsmInstruction::isThumb() const
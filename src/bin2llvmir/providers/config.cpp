@@ -12,6 +12,7 @@
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/config.h"
 #include "retdec/bin2llvmir/providers/demangler.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/debug.h"
 #include "retdec/bin2llvmir/utils/llvm.h"
 
@@ -79,6 +80,30 @@ Config Config::fromJsonString(llvm::Module* m, const std::string& json)
 	return config;
 }
 
+/**
+ * Create config from an already parsed config. Such config is not associated
+ * with any file, so it is not saved in @c doFinalization().
+ */
+Config Config::fromConfig(llvm::Module* m, const retdec::config::Config& c)
+{
+	Config config;
+	config._module = m;
+	config._configDB = c;
+
+	for (auto& s : config.getConfig().structures)
+	{
+		llvm_utils::stringToLlvmType(m->getContext(), s.getLlvmIr());
+	}
+
+	// TODO: needed?
+	if (config.getConfig().tools.isPic32())
+	{
+		config.getConfig().architecture.setIsPic32();
+	}
+
+	return config;
+}
+
 /**
  * Save the config to reflect changes that have been done to it in
  * the bin2llvmirl.
@@ -804,26 +829,44 @@ bool Config::getCryptoPattern(
 //=============================================================================
 //
 
-std::map<llvm::Module*, Config> ConfigProvider::_module2config;
-
 Config* ConfigProvider::addConfigFile(llvm::Module* m, const std::string& path)
 {
-	auto p = _module2config.emplace(m, Config::fromFile(m, path));
-	return &p.first->second;
+	auto& c = ProviderContext::getOrCreate(m);
+	if (c.config == nullptr)
+	{
+		c.config = std::make_unique<Config>(Config::fromFile(m, path));
+	}
+	return c.config.get();
 }
 
 Config* ConfigProvider::addConfigJsonString(
 		llvm::Module* m,
 		const std::string& json)
 {
-	auto p = _module2config.emplace(m, Config::fromJsonString(m, json));
-	return &p.first->second;
+	auto& c = ProviderContext::getOrCreate(m);
+	if (c.config == nullptr)
+	{
+		c.config = std::make_unique<Config>(Config::fromJsonString(m, json));
+	}
+	return c.config.get();
+}
+
+Config* ConfigProvider::addConfig(
+		llvm::Module* m,
+		const retdec::config::Config& config)
+{
+	auto& c = ProviderContext::getOrCreate(m);
+	if (c.config == nullptr)
+	{
+		c.config = std::make_unique<Config>(Config::fromConfig(m, config));
+	}
+	return c.config.get();
 }
 
 Config* ConfigProvider::getConfig(llvm::Module* m)
 {
-	auto f = _module2config.find(m);
-	return f != _module2config.end() ? &f->second : nullptr;
+	auto* c = ProviderContext::get(m);
+	return c ? c->config.get() : nullptr;
 }
 
 bool ConfigProvider::getConfig(llvm::Module* m, Config*& c)
@@ -846,7 +889,7 @@ void ConfigProvider::doFinalization(llvm::Module* m)
  */
 void ConfigProvider::clear()
 {
-	_module2config.clear();
+	ProviderContext::forEach([](ProviderContext& c) { c.config.reset(); });
 }
 
 } // namespace bin2llvmir
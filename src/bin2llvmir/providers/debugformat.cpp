@@ -5,6 +5,8 @@
  */
 
 #include "retdec/bin2llvmir/providers/debugformat.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
+#include "retdec/bin2llvmir/utils/parallel.h"
 
 using namespace llvm;
 
@@ -23,8 +25,6 @@ namespace bin2llvmir {
 //=============================================================================
 //
 
-std::map<Module*, DebugFormat> DebugFormatProvider::_module2debug;
-
 /**
  * Create and add to provider a debug info for the given module @a m, file
  * image @a objf, pdb file path @a pdbFile, possible PE image base @a imageBase
@@ -44,15 +44,18 @@ DebugFormat* DebugFormatProvider::addDebugFormat(
 		return nullptr;
 	}
 
-	auto p = _module2debug.emplace(
-			m,
-			DebugFormat(
-					objf,
-					pdbFile,
-					nullptr, // symbol table -- not needed.
-					demangler,
-					imageBase));
-	return &p.first->second;
+	auto& c = ProviderContext::getOrCreate(m);
+	if (c.debugFormat == nullptr)
+	{
+		c.debugFormat = std::make_unique<DebugFormat>(
+				objf,
+				pdbFile,
+				nullptr, // symbol table -- not needed.
+				demangler,
+				imageBase,
+				&getThreadPool());
+	}
+	return c.debugFormat.get();
 }
 
 /**
@@ -62,8 +65,8 @@ DebugFormat* DebugFormatProvider::addDebugFormat(
 DebugFormat* DebugFormatProvider::getDebugFormat(
 		llvm::Module* m)
 {
-	auto f = _module2debug.find(m);
-	return f != _module2debug.end() ? &f->second : nullptr;
+	auto* c = ProviderContext::get(m);
+	return c ? c->debugFormat.get() : nullptr;
 }
 
 /**
@@ -85,7 +88,7 @@ bool DebugFormatProvider::getDebugFormat(llvm::Module* m, DebugFormat*& df)
  */
 void DebugFormatProvider::clear()
 {
-	_module2debug.clear();
+	ProviderContext::forEach([](ProviderContext& c) { c.debugFormat.reset(); });
 }
 
 } // namespace bin2llvmir
@@ -5,14 +5,13 @@
  */
 
 #include "retdec/bin2llvmir/providers/demangler.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 
 using namespace llvm;
 
 namespace retdec {
 namespace bin2llvmir {
 
-std::map<Module*, DemanglerProvider::Demangler> DemanglerProvider::_module2demangler;
-
 /**
  * Create and add to provider a demangler for the given module @a m
  * and tools @a t.
@@ -23,6 +22,12 @@ retdec::demangler::CDemangler* DemanglerProvider::addDemangler(
 		llvm::Module* m,
 		const retdec::config::ToolInfoContainer& t)
 {
+	auto& c = ProviderContext::getOrCreate(m);
+	if (c.demangler)
+	{
+		return c.demangler.get();
+	}
+
 	std::unique_ptr<retdec::demangler::CDemangler> d;
 
 	if (t.isGcc())
@@ -42,9 +47,8 @@ retdec::demangler::CDemangler* DemanglerProvider::addDemangler(
 		d = retdec::demangler::CDemangler::createGcc();
 	}
 
-	auto p = _module2demangler.insert(std::make_pair(m, std::move(d)));
-
-	return p.first->second.get();
+	c.demangler = std::move(d);
+	return c.demangler.get();
 }
 
 /**
@@ -53,8 +57,8 @@ retdec::demangler::CDemangler* DemanglerProvider::addDemangler(
  */
 retdec::demangler::CDemangler* DemanglerProvider::getDemangler(llvm::Module* m)
 {
-	auto f = _module2demangler.find(m);
-	return f != _module2demangler.end() ? f->second.get() : nullptr;
+	auto* c = ProviderContext::get(m);
+	return c ? c->demangler.get() : nullptr;
 }
 
 /**
@@ -78,7 +82,7 @@ bool DemanglerProvider::getDemangler(
  */
 void DemanglerProvider::clear()
 {
-	_module2demangler.clear();
+	ProviderContext::forEach([](ProviderContext& c) { c.demangler.reset(); });
 }
 
 } // namespace bin2llvmir
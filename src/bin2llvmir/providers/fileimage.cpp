@@ -6,6 +6,7 @@
 
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/providers/fileimage.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 #include "retdec/loader/image_factory.h"
 #include "retdec/loader/loader/raw_data/raw_data_image.h"
@@ -600,8 +601,6 @@ bool FileImage::isImportTerminating(
 //=============================================================================
 //
 
-std::map<llvm::Module*, FileImage> FileImageProvider::_module2image;
-
 /**
  * Create and add to provider a file image created from file at @a path for
  * the given module @a m and architecture @a a.
@@ -634,8 +633,12 @@ FileImage* FileImageProvider::addFileImage(
 		llvm::Module* m,
 		FileImage img)
 {
-	auto p = _module2image.emplace(m, std::move(img));
-	return &p.first->second;
+	auto& c = ProviderContext::getOrCreate(m);
+	if (c.fileImage == nullptr)
+	{
+		c.fileImage = std::make_unique<FileImage>(std::move(img));
+	}
+	return c.fileImage.get();
 }
 
 /**
@@ -645,8 +648,8 @@ FileImage* FileImageProvider::addFileImage(
 FileImage* FileImageProvider::getFileImage(
 		llvm::Module* m)
 {
-	auto f = _module2image.find(m);
-	return f != _module2image.end() ? &f->second : nullptr;
+	auto* c = ProviderContext::get(m);
+	return c ? c->fileImage.get() : nullptr;
 }
 
 /**
@@ -670,7 +673,7 @@ bool FileImageProvider::getFileImage(
  */
 void FileImageProvider::clear()
 {
-	_module2image.clear();
+	ProviderContext::forEach([](ProviderContext& c) { c.fileImage.reset(); });
 }
 
 } // namespace bin2llvmir
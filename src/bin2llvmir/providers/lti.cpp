@@ -19,6 +19,7 @@
 #include "retdec/ctypes/void_type.h"
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 
 using namespace llvm;
 
@@ -307,14 +308,38 @@ void Lti::loadLtiFile(const std::string& filePath)
 		{"unsigned __int3264", 32} // this has the same size as arch size
 	};
 
+	std::string cc = "cdecl";
+	if (retdec::utils::containsCaseInsensitive(filePath, "win"))
+	{
+		cc = "stdcall";
+	}
+
+	// Prefer the precompiled database (see retdec-ctypes-compiler), which is
+	// only mapped into memory here. Functions are parsed from it on demand.
+	// A database compiled from another version of the JSON file is ignored.
+	auto dbPath = filePath;
+	if (retdec::utils::endsWith(dbPath, ".json"))
+	{
+		dbPath.erase(dbPath.size() - std::string(".json").size());
+	}
+	dbPath += ".ctdb";
+	auto db = std::make_unique<ctypesparser::BinaryCTypesParser>(
+			static_cast<unsigned>(
+					_config->getConfig().architecture.getBitSize()));
+	ctypesparser::binary_ctypes::SourceStamp jsonStamp;
+	bool jsonExists = ctypesparser::binary_ctypes::readSourceStamp(
+			filePath,
+			jsonStamp);
+	if (db->open(dbPath, _ltiModule->getContext(), typeWidths, cc)
+			&& (!jsonExists || db->getSourceStamp() == jsonStamp))
+	{
+		_ltiDatabases.push_back(std::move(db));
+		return;
+	}
+
 	std::ifstream file(filePath);
 	if (file)
 	{
-		std::string cc = "cdecl";
-		if (retdec::utils::containsCaseInsensitive(filePath, "win"))
-		{
-			cc = "stdcall";
-		}
 		_ltiParser.parseInto(file, _ltiModule, typeWidths, cc);
 	}
 }
@@ -327,7 +352,21 @@ bool Lti::hasLtiFunction(const std::string& name)
 std::shared_ptr<retdec::ctypes::Function> Lti::getLtiFunction(
 		const std::string& name)
 {
-	return _ltiModule->getFunctionWithName(name);
+	if (auto fnc = _ltiModule->getFunctionWithName(name))
+	{
+		return fnc;
+	}
+
+	for (auto& db : _ltiDatabases)
+	{
+		if (auto fnc = db->getFunction(name))
+		{
+			_ltiModule->addFunction(fnc);
+			return fnc;
+		}
+	}
+
+	return nullptr;
 }
 
 /**
@@ -445,8 +484,6 @@ llvm::Type* Lti::getLlvmType(std::shared_ptr<retdec::ctypes::Type> type)
 //=============================================================================
 //
 
-std::map<llvm::Module*, Lti> LtiProvider::_module2lti;
-
 Lti* LtiProvider::addLti(
 		llvm::Module* m,
 		Config* c,
@@ -457,14 +494,18 @@ Lti* LtiProvider::addLti(
 		return nullptr;
 	}
 
-	auto p = _module2lti.emplace(m, Lti(m, c, objf));
-	return &p.first->second;
+	auto& ctx = ProviderContext::getOrCreate(m);
+	if (ctx.lti == nullptr)
+	{
+		ctx.lti = std::make_unique<Lti>(m, c, objf);
+	}
+	return ctx.lti.get();
 }
 
 Lti* LtiProvider::getLti(llvm::Module* m)
 {
-	auto f = _module2lti.find(m);
-	return f != _module2lti.end() ? &f->second : nullptr;
+	auto* c = ProviderContext::get(m);
+	return c ? c->lti.get() : nullptr;
 }
 
 bool LtiProvider::getLti(llvm::Module* m, Lti*& lti)
@@ -475,7 +516,7 @@ bool LtiProvider::getLti(llvm::Module* m, Lti*& lti)
 
 void LtiProvider::clear()
 {
-	_module2lti.clear();
+	ProviderContext::forEach([](ProviderContext& c) { c.lti.reset(); });
 }
 
 } // namespace bin2llvmir
@@ -5,6 +5,7 @@
 */
 
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/utils/string.h"
 
 using namespace retdec::utils;
@@ -347,7 +348,7 @@ void NameContainer::initFromDebug()
 		return;
 	}
 
-	for (const auto& p : _debug->functions)
+	for (const auto& p : _debug->getFunctions())
 	{
 		addNameForAddress(
 				p.first,
@@ -355,7 +356,7 @@ void NameContainer::initFromDebug()
 				Name::eType::DEBUG_FUNCTION);
 	}
 
-	for (const auto& p : _debug->globals)
+	for (const auto& p : _debug->getGlobalVars())
 	{
 		Address addr;
 		if (p.second.getStorage().isMemory(addr))
@@ -547,8 +548,6 @@ bool NameContainer::loadImportOrds(const std::string& libName)
 //==============================================================================
 //
 
-std::map<llvm::Module*, NameContainer> NamesProvider::_module2names;
-
 NameContainer* NamesProvider::addNames(
 		llvm::Module* m,
 		Config* c,
@@ -566,14 +565,18 @@ NameContainer* NamesProvider::addNames(
 		return nullptr;
 	}
 
-	auto p = _module2names.emplace(m, NameContainer(m, c, d, i, dm, lti));
-	return &p.first->second;
+	auto& ctx = ProviderContext::getOrCreate(m);
+	if (ctx.names == nullptr)
+	{
+		ctx.names = std::make_unique<NameContainer>(m, c, d, i, dm, lti);
+	}
+	return ctx.names.get();
 }
 
 NameContainer* NamesProvider::getNames(llvm::Module* m)
 {
-	auto f = _module2names.find(m);
-	return f != _module2names.end() ? &f->second : nullptr;
+	auto* c = ProviderContext::get(m);
+	return c ? c->names.get() : nullptr;
 }
 
 bool NamesProvider::getNames(llvm::Module* m, NameContainer*& names)
@@ -584,7 +587,7 @@ bool NamesProvider::getNames(llvm::Module* m, NameContainer*& names)
 
 void NamesProvider::clear()
 {
-	_module2names.clear();
+	ProviderContext::forEach([](ProviderContext& c) { c.names.reset(); });
 }
 
 } // namespace bin2llvmir
@@ -0,0 +1,174 @@
+/**
+ * @file src/bin2llvmir/providers/provider_context.cpp
+ * @brief Data of all providers associated with one module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "retdec/bin2llvmir/providers/provider_context.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+namespace {
+
+/**
+ * Contexts of all modules.
+ */
+struct Registry
+{
+	/// Guards all members except @c generation.
+	std::mutex mutex;
+	/// Registered contexts.
+	std::map<const llvm::Module*, ProviderContext*> contexts;
+	/// Incremented whenever @c contexts change.
+	std::atomic<std::size_t> generation{1};
+	/// Contexts created by providers on their first use. They unregister
+	/// themselves when destroyed, so they are declared last.
+	std::vector<std::unique_ptr<ProviderContext>> implicitContexts;
+};
+
+Registry& getRegistry()
+{
+	static Registry registry;
+	return registry;
+}
+
+/**
+ * The last context found by the current thread. Providers ask for the same
+ * module over and over, so most of lookups end here without locking.
+ * It is valid only if generation of registry has not changed since.
+ */
+struct LastLookup
+{
+	const llvm::Module* module = nullptr;
+	ProviderContext* context = nullptr;
+	std::size_t generation = 0;
+};
+
+thread_local LastLookup lastLookup;
+
+} // anonymous namespace
+
+/**
+ * Create context of module @a m. It replaces the current context of @a m,
+ * if there is any.
+ */
+ProviderContext::ProviderContext(const llvm::Module* m) :
+		_module(m)
+{
+	auto& registry = getRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	registry.contexts[m] = this;
+	++registry.generation;
+}
+
+/**
+ * Destroy context and all data of providers in it.
+ */
+ProviderContext::~ProviderContext()
+{
+	auto& registry = getRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	auto it = registry.contexts.find(_module);
+	if (it != registry.contexts.end() && it->second == this)
+	{
+		registry.contexts.erase(it);
+	}
+	++registry.generation;
+}
+
+const llvm::Module* ProviderContext::getModule() const
+{
+	return _module;
+}
+
+/**
+ * @return Context of module @a m or @c nullptr if there is none.
+ */
+ProviderContext* ProviderContext::get(const llvm::Module* m)
+{
+	if (m == nullptr)
+	{
+		return nullptr;
+	}
+
+	auto& registry = getRegistry();
+	if (lastLookup.module == m
+			&& lastLookup.generation == registry.generation)
+	{
+		return lastLookup.context;
+	}
+
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	auto it = registry.contexts.find(m);
+	auto* c = it != registry.contexts.end() ? it->second : nullptr;
+	lastLookup.module = m;
+	lastLookup.context = c;
+	lastLookup.generation = registry.generation;
+	return c;
+}
+
+/**
+ * @return Context of module @a m. If there is none, it is created and it
+ *         lives until the end of the process.
+ */
+ProviderContext& ProviderContext::getOrCreate(const llvm::Module* m)
+{
+	if (auto* c = get(m))
+	{
+		return *c;
+	}
+
+	auto context = std::make_unique<ProviderContext>(m);
+	auto* c = context.get();
+
+	auto& registry = getRegistry();
+	std::lock_guard<std::mutex> lock(registry.mutex);
+	registry.implicitContexts.push_back(std::move(context));
+	return *c;
+}
+
+/**
+ * Call @a f on all contexts.
+ * @note It must not be used while other threads use providers.
+ */
+void ProviderContext::forEach(const std::function<void(ProviderContext&)>& f)
+{
+	std::vector<ProviderContext*> contexts;
+	{
+		auto& registry = getRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		for (auto& p : registry.contexts)
+		{
+			contexts.push_back(p.second);
+		}
+	}
+
+	for (auto* c : contexts)
+	{
+		f(*c);
+	}
+}
+
+/**
+ * Destroy all contexts created by providers on their first use.
+ * Explicitly created contexts are not affected.
+ */
+void ProviderContext::clear()
+{
+	std::vector<std::unique_ptr<ProviderContext>> contexts;
+	{
+		auto& registry = getRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+		contexts.swap(registry.implicitContexts);
+	}
+	// Contexts unregister themselves here, outside of the lock.
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
@@ -0,0 +1,50 @@
+/**
+ * @file src/bin2llvmir/utils/parallel.cpp
+ * @brief Running function-local work of passes in parallel.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <llvm/Support/CommandLine.h>
+
+#include "retdec/bin2llvmir/utils/parallel.h"
+
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+
+cl::opt<unsigned> ThreadCount(
+		"threads",
+		cl::desc("Number of threads running function-local analyses "
+				"(0 means one per CPU core)."),
+		cl::init(0)
+);
+
+/**
+ * Get pool of threads shared by all passes. It is created on the first use
+ * with the number of threads given by @c -threads.
+ */
+retdec::utils::ThreadPool& getThreadPool()
+{
+	static retdec::utils::ThreadPool pool(ThreadCount);
+	return pool;
+}
+
+/**
+ * Get all functions of module @a m which have a body, in the module order.
+ */
+std::vector<llvm::Function*> getDefinedFunctions(llvm::Module& m)
+{
+	std::vector<llvm::Function*> ret;
+	for (auto& f : m)
+	{
+		if (!f.empty())
+		{
+			ret.push_back(&f);
+		}
+	}
+	return ret;
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
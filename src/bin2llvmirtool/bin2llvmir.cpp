@@ -55,6 +55,7 @@
 #include "retdec/llvm-support/diagnostics.h"
 #include "retdec/utils/memory.h"
 #include "retdec/utils/conversion.h"
+#include "retdec/utils/profiler.h"
 #include "retdec/utils/string.h"
 
 using namespace llvm;
@@ -112,6 +113,47 @@ static cl::opt<bool>
 DisableSimplifyLibCalls("disable-simplify-libcalls",
 		cl::desc("Disable simplify-libcalls"));
 
+static cl::opt<std::string>
+ProfileReport("profile-report",
+		cl::desc("Store time, memory and IR size of each pass into the given JSON file."),
+		cl::value_desc("filename"));
+
+/**
+ * Profiler of passes. It is used only if @c -profile-report is given.
+ */
+std::unique_ptr<retdec::utils::Profiler> profiler;
+
+/**
+ * Get size of LLVM IR in module @a m for profiler.
+ */
+retdec::utils::Profiler::Sizes getIrSize(const Module& m)
+{
+	std::size_t functions = 0;
+	std::size_t basicBlocks = 0;
+	std::size_t instructions = 0;
+	for (auto& f : m)
+	{
+		if (f.isDeclaration())
+		{
+			continue;
+		}
+
+		++functions;
+		for (auto& bb : f)
+		{
+			++basicBlocks;
+			instructions += bb.size();
+		}
+	}
+
+	return {
+		{"functions", functions},
+		{"basic_blocks", basicBlocks},
+		{"instructions", instructions},
+		{"globals", m.getGlobalList().size()}
+	};
+}
+
 /**
  * These passes are considered to be from LLVM, not from RetDec.
  * We do not want to write phase information for each of them.
@@ -152,6 +194,7 @@ std::set<std::string> llvmPasses =
 	"Interprocedural Sparse Conditional Constant Propagation",
 	"Interprocedural constant propagation",
 	"Jump Threading",
+	"LLVM optimizations until a fixed point",
 	"Lazy Value Information Analysis",
 	"Loop Invariant Code Motion",
 	"Loop-Closed SSA Form Pass",
@@ -230,6 +273,14 @@ class ModulePassPrinter : public ModulePass
 			// LastPhase gets updated every time.
 			LastPhase = PhaseName;
 
+			// Each pass is profiled from its printer to the next one.
+			if (profiler)
+			{
+				auto size = getIrSize(M);
+				profiler->stop(size);
+				profiler->start(PhaseName, size);
+			}
+
 			return false;
 		}
 
@@ -429,6 +480,11 @@ int _main(int argc, char **argv)
 
 	limitMaximalMemoryIfRequested();
 
+	if (!ProfileReport.empty())
+	{
+		profiler = std::make_unique<retdec::utils::Profiler>();
+	}
+
 	LLVMContext Context;
 	std::unique_ptr<Module> M = createLlvmModule(Context);
 
@@ -506,6 +562,17 @@ int _main(int argc, char **argv)
 	// Now that we have all of the passes ready, run them.
 	Passes.run(*M);
 
+	if (profiler)
+	{
+		profiler->stop(getIrSize(*M));
+		if (!profiler->writeJsonFile(ProfileReport))
+		{
+			throw std::runtime_error(
+				"failed to write profile report into " + ProfileReport
+			);
+		}
+	}
+
 	// Declare success.
 	retdec::llvm_support::printPhase("Cleanup");
 	bcOut->keep();
@@ -0,0 +1,433 @@
+/**
+ * @file src/config/binary_serialization.cpp
+ * @brief Reading and writing of configuration in a compact binary encoding.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ *
+ * The binary encoding stores the same JSON values as the JSON encoding, so
+ * it uses the same schema. It is smaller and faster to read and write because
+ * numbers are stored as variable-length integers and every distinct string
+ * (member name or string value) is stored only once:
+ *
+ * @code
+ * config  := magic version (MEMBER string value)* END
+ * value   := NULL | FALSE | TRUE | INT varint(zigzag) | UINT varint
+ *          | REAL 8B-little-endian | STRING string
+ *          | ARRAY varint(count) value* | OBJECT varint(count) (string value)*
+ * string  := varint(0) varint(length) bytes    (new string, gets next index)
+ *          | varint(index)                      (index of a string seen before)
+ * @endcode
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <unordered_map>
+
+#include "retdec/config/config_exceptions.h"
+#include "retdec/config/serialization.h"
+
+namespace retdec {
+namespace config {
+
+namespace {
+
+const std::string MAGIC = "RDCB";
+const char VERSION = 1;
+
+/// Maximal nesting of arrays and objects (the same as in jsoncpp).
+const std::size_t MAX_DEPTH = 1000;
+
+/// Tags of members of the root object.
+enum MemberTag : char
+{
+	END = 0,
+	MEMBER = 1
+};
+
+/// Tags of values.
+enum ValueTag : char
+{
+	NULL_VALUE = 0,
+	FALSE_VALUE,
+	TRUE_VALUE,
+	INT_VALUE,
+	UINT_VALUE,
+	REAL_VALUE,
+	STRING_VALUE,
+	ARRAY_VALUE,
+	OBJECT_VALUE
+};
+
+std::uint64_t zigZagEncode(std::int64_t i)
+{
+	return (static_cast<std::uint64_t>(i) << 1) ^ static_cast<std::uint64_t>(i >> 63);
+}
+
+std::int64_t zigZagDecode(std::uint64_t u)
+{
+	return static_cast<std::int64_t>(u >> 1) ^ -static_cast<std::int64_t>(u & 1);
+}
+
+/**
+ * Writer of the binary encoding.
+ */
+class BinaryConfigWriter : public ConfigWriter
+{
+	public:
+		BinaryConfigWriter()
+		{
+			_out.append(MAGIC);
+			_out.push_back(VERSION);
+		}
+
+		virtual void writeMember(
+				const std::string& name,
+				const Json::Value& val) override
+		{
+			_out.push_back(MEMBER);
+			writeString(name);
+			writeValue(val);
+		}
+
+		virtual void startArrayMember(
+				const std::string& name,
+				std::size_t size) override
+		{
+			_out.push_back(MEMBER);
+			writeString(name);
+			_out.push_back(ARRAY_VALUE);
+			writeVarint(size);
+		}
+
+		virtual void writeArrayElement(const Json::Value& val) override
+		{
+			writeValue(val);
+		}
+
+		virtual void endArrayMember() override
+		{
+		}
+
+		virtual std::string finish() override
+		{
+			_out.push_back(END);
+			_strings.clear();
+			return std::move(_out);
+		}
+
+	private:
+		void writeVarint(std::uint64_t v)
+		{
+			while (v >= 0x80)
+			{
+				_out.push_back(static_cast<char>(v | 0x80));
+				v >>= 7;
+			}
+			_out.push_back(static_cast<char>(v));
+		}
+
+		void writeString(const std::string& s)
+		{
+			auto res = _strings.emplace(s, _strings.size() + 1);
+			if (!res.second)
+			{
+				writeVarint(res.first->second);
+				return;
+			}
+
+			writeVarint(0);
+			writeVarint(s.size());
+			_out.append(s);
+		}
+
+		void writeValue(const Json::Value& val)
+		{
+			switch (val.type())
+			{
+				case Json::nullValue:
+					_out.push_back(NULL_VALUE);
+					break;
+				case Json::booleanValue:
+					_out.push_back(val.asBool() ? TRUE_VALUE : FALSE_VALUE);
+					break;
+				case Json::intValue:
+					_out.push_back(INT_VALUE);
+					writeVarint(zigZagEncode(val.asLargestInt()));
+					break;
+				case Json::uintValue:
+					_out.push_back(UINT_VALUE);
+					writeVarint(val.asLargestUInt());
+					break;
+				case Json::realValue:
+				{
+					_out.push_back(REAL_VALUE);
+					double d = val.asDouble();
+					std::uint64_t bits = 0;
+					std::memcpy(&bits, &d, sizeof(bits));
+					for (unsigned i = 0; i < sizeof(bits); ++i)
+					{
+						_out.push_back(static_cast<char>(bits >> (8 * i)));
+					}
+					break;
+				}
+				case Json::stringValue:
+				{
+					_out.push_back(STRING_VALUE);
+					const char* begin = nullptr;
+					const char* end = nullptr;
+					val.getString(&begin, &end);
+					writeString(begin ? std::string(begin, end) : std::string());
+					break;
+				}
+				case Json::arrayValue:
+					_out.push_back(ARRAY_VALUE);
+					writeVarint(val.size());
+					for (auto& elem : val)
+					{
+						writeValue(elem);
+					}
+					break;
+				case Json::objectValue:
+					_out.push_back(OBJECT_VALUE);
+					writeVarint(val.size());
+					for (auto it = val.begin(); it != val.end(); ++it)
+					{
+						writeString(it.name());
+						writeValue(*it);
+					}
+					break;
+			}
+		}
+
+	private:
+		std::string _out;
+		/// Indexes (starting from 1) of strings written so far.
+		std::unordered_map<std::string, std::uint64_t> _strings;
+};
+
+/**
+ * Reader of the binary encoding.
+ */
+class BinaryConfigReader
+{
+	public:
+		explicit BinaryConfigReader(const std::string& data) :
+			_data(data)
+		{
+		}
+
+		void read(ConfigReaderHandler& handler)
+		{
+			if (!isBinaryConfig(_data))
+			{
+				error("missing header");
+			}
+			_pos = MAGIC.size();
+			if (readByte() != VERSION)
+			{
+				error("unsupported version");
+			}
+
+			while (true)
+			{
+				auto tag = readByte();
+				if (tag == END)
+				{
+					break;
+				}
+				else if (tag != MEMBER)
+				{
+					error("bad member tag");
+				}
+
+				auto& name = readString();
+				if (peekByte() == ARRAY_VALUE && handler.onArrayStart(name))
+				{
+					++_pos;
+					auto count = readVarint();
+					for (std::uint64_t i = 0; i < count; ++i)
+					{
+						Json::Value val;
+						readValue(val, 1);
+						handler.onArrayElement(name, val);
+					}
+				}
+				else
+				{
+					Json::Value val;
+					readValue(val, 0);
+					handler.onMember(name, val);
+				}
+			}
+		}
+
+	private:
+		[[noreturn]] void error(const std::string& message) const
+		{
+			throw ParseException(
+					"Failed to parse binary configuration: " + message,
+					0,
+					_pos);
+		}
+
+		char peekByte()
+		{
+			if (_pos >= _data.size())
+			{
+				error("unexpected end of data");
+			}
+			return _data[_pos];
+		}
+
+		char readByte()
+		{
+			auto c = peekByte();
+			++_pos;
+			return c;
+		}
+
+		std::uint64_t readVarint()
+		{
+			std::uint64_t v = 0;
+			for (unsigned shift = 0; shift < 64; shift += 7)
+			{
+				auto b = static_cast<unsigned char>(readByte());
+				v |= static_cast<std::uint64_t>(b & 0x7f) << shift;
+				if ((b & 0x80) == 0)
+				{
+					return v;
+				}
+			}
+			error("too long number");
+		}
+
+		const std::string& readString()
+		{
+			auto index = readVarint();
+			if (index != 0)
+			{
+				if (index > _strings.size())
+				{
+					error("bad string index");
+				}
+				return _strings[index - 1];
+			}
+
+			auto size = readVarint();
+			if (size > _data.size() - _pos)
+			{
+				error("unexpected end of data");
+			}
+			_strings.emplace_back(_data, _pos, size);
+			_pos += size;
+			return _strings.back();
+		}
+
+		void readValue(Json::Value& val, std::size_t depth)
+		{
+			if (depth > MAX_DEPTH)
+			{
+				error("too deep nesting");
+			}
+
+			auto start = _pos;
+			switch (readByte())
+			{
+				case NULL_VALUE:
+					val = Json::Value();
+					break;
+				case FALSE_VALUE:
+					val = false;
+					break;
+				case TRUE_VALUE:
+					val = true;
+					break;
+				case INT_VALUE:
+					val = Json::Value::LargestInt(zigZagDecode(readVarint()));
+					break;
+				case UINT_VALUE:
+					val = Json::Value::LargestUInt(readVarint());
+					break;
+				case REAL_VALUE:
+				{
+					std::uint64_t bits = 0;
+					for (unsigned i = 0; i < sizeof(bits); ++i)
+					{
+						bits |= static_cast<std::uint64_t>(
+								static_cast<unsigned char>(readByte())) << (8 * i);
+					}
+					double d = 0.0;
+					std::memcpy(&d, &bits, sizeof(d));
+					val = d;
+					break;
+				}
+				case STRING_VALUE:
+				{
+					auto& s = readString();
+					val = Json::Value(s.data(), s.data() + s.size());
+					break;
+				}
+				case ARRAY_VALUE:
+				{
+					val = Json::Value(Json::arrayValue);
+					auto count = readVarint();
+					for (std::uint64_t i = 0; i < count; ++i)
+					{
+						readValue(val.append(Json::Value()), depth + 1);
+					}
+					break;
+				}
+				case OBJECT_VALUE:
+				{
+					val = Json::Value(Json::objectValue);
+					auto count = readVarint();
+					for (std::uint64_t i = 0; i < count; ++i)
+					{
+						auto& name = readString();
+						readValue(val[name], depth + 1);
+					}
+					break;
+				}
+				default:
+					_pos = start;
+					error("bad value tag");
+			}
+			val.setOffsetStart(start);
+		}
+
+	private:
+		const std::string& _data;
+		std::size_t _pos = 0;
+		/// Strings read so far. Deque keeps references to them valid.
+		std::deque<std::string> _strings;
+};
+
+} // anonymous namespace
+
+std::unique_ptr<ConfigWriter> ConfigWriter::createBinaryWriter()
+{
+	return std::unique_ptr<ConfigWriter>(new BinaryConfigWriter());
+}
+
+/**
+ * Reads configuration @a data in the binary encoding and passes members of
+ * its root object to @a handler.
+ * If the data can not be parsed, an instance of @c ParseException is thrown.
+ * Its column is the offset of the bad byte.
+ */
+void readBinaryConfig(const std::string& data, ConfigReaderHandler& handler)
+{
+	BinaryConfigReader(data).read(handler);
+}
+
+/**
+ * @return @c True if @a data start with the header of the binary encoding,
+ *         @c false otherwise.
+ */
+bool isBinaryConfig(const std::string& data)
+{
+	return data.compare(0, MAGIC.size(), MAGIC) == 0;
+}
+
+} // namespace config
+} // namespace retdec
@@ -5,6 +5,8 @@
  */
 
 #include <fstream>
+#include <functional>
+#include <map>
 
 #include "retdec/config/config.h"
 #include "retdec/utils/string.h"
@@ -45,6 +47,118 @@ const std::string JSON_patterns          = "patterns";
 namespace retdec {
 namespace config {
 
+namespace {
+
+/**
+ * Reads members of the root object of configuration into @a config.
+ * Sections (e.g. functions) are read as soon as they are parsed, arrays
+ * element by element. Other members are stored into @a root.
+ */
+class ConfigReader : public ConfigReaderHandler
+{
+	public:
+		ConfigReader(Config& config, Json::Value& root) :
+			_config(config),
+			_root(root)
+		{
+		}
+
+		virtual void onMember(
+				const std::string& name,
+				const Json::Value& val) override
+		{
+			if (name == JSON_parameters)         _config.parameters.readJsonValue(val);
+			else if (name == JSON_architecture)  _config.architecture.readJsonValue(val);
+			else if (name == JSON_fileType)      _config.fileType.readJsonValue(val);
+			else if (name == JSON_fileFormat)    _config.fileFormat.readJsonValue(val);
+			else if (name == JSON_tools)         _config.tools.readJsonValue(val);
+			else if (name == JSON_languages)     _config.languages.readJsonValue(val);
+			else if (name == JSON_functions)     _config.functions.readJsonValue(val);
+			else if (name == JSON_globals)       _config.globals.readJsonValue(val);
+			else if (name == JSON_registers)     _config.registers.readJsonValue(val);
+			else if (name == JSON_structures)    _config.structures.readJsonValue(val);
+			else if (name == JSON_segments)      _config.segments.readJsonValue(val);
+			else if (name == JSON_vtables)       _config.vtables.readJsonValue(val);
+			else if (name == JSON_classes)       _config.classes.readJsonValue(val);
+			else if (name == JSON_patterns)      _config.patterns.readJsonValue(val);
+			else _root[name] = val;
+		}
+
+		virtual bool onArrayStart(const std::string& name) override
+		{
+			_readElement = nullptr;
+
+			if (name == JSON_tools)              startArray(_config.tools);
+			else if (name == JSON_languages)     startArray(_config.languages);
+			else if (name == JSON_functions)     startArray(_config.functions);
+			else if (name == JSON_globals)       startArray(_config.globals);
+			else if (name == JSON_registers)     startArray(_config.registers);
+			else if (name == JSON_structures)    startArray(_config.structures);
+			else if (name == JSON_segments)      startArray(_config.segments);
+			else if (name == JSON_vtables)       startArray(_config.vtables);
+			else if (name == JSON_classes)       startArray(_config.classes);
+			else if (name == JSON_patterns)      startArray(_config.patterns);
+
+			return _readElement != nullptr;
+		}
+
+		virtual void onArrayElement(
+				const std::string&,
+				const Json::Value& val) override
+		{
+			_readElement(val);
+		}
+
+	private:
+		template <typename Container>
+		void startArray(Container& c)
+		{
+			c.clear();
+			_readElement = [&c](const Json::Value& val)
+			{
+				c.readJsonArrayElement(val);
+			};
+		}
+
+	private:
+		Config& _config;
+		Json::Value& _root;
+		/// Reader of elements of the array which is being read.
+		std::function<void(const Json::Value&)> _readElement;
+};
+
+template <typename Elem>
+const Elem& getElement(const Elem& e)
+{
+	return e;
+}
+
+template <typename ID, typename Elem>
+const Elem& getElement(const std::pair<const ID, Elem>& p)
+{
+	return p.second;
+}
+
+/**
+ * Writes container @a c into member @a name element by element, so JSON
+ * value for the whole container is not created.
+ */
+template <typename Container>
+void writeArrayMember(
+		ConfigWriter& writer,
+		const std::string& name,
+		const Container& c)
+{
+	writer.startArrayMember(name, c.size());
+	for (auto& e : c)
+	{
+		writer.writeArrayElement(getElement(e).getJsonValue());
+	}
+	writer.endArrayMember();
+}
+
+} // anonymous namespace
+
 Config Config::empty(const std::string& path)
 {
 	Config config;
@@ -66,6 +180,13 @@ Config Config::fromJsonString(const std::string& json)
 	return config;
 }
 
+Config Config::fromBinaryString(const std::string& data)
+{
+	Config config;
+	config.readBinaryString(data);
+	return config;
+}
+
 bool Config::isIda() const { return _ida; }
 
 void Config::setInputFile(const std::string& n)          { _inputFile = n; }
@@ -90,6 +211,7 @@ retdec::utils::Address Config::getImageBase() const      { return _imageBase; }
 
 /**
  * Reads JSON file into internal representation.
+ * Files in the binary encoding (see generateBinaryFile()) are read as well.
  * If file can not be opened, an instance of @c FileNotFoundException is thrown.
  * If file can not be parsed, an instance of @c ParseException is thrown.
  * @param input Path to input JSON file.
@@ -113,13 +235,21 @@ void Config::readJsonFile(const std::string& input)
 	jsonFile.read(&jsonContent[0], jsonContent.size());
 	jsonFile.close();
 
-	readJsonString(jsonContent);
+	if (isBinaryConfig(jsonContent))
+	{
+		readBinaryString(jsonContent);
+	}
+	else
+	{
+		readJsonString(jsonContent);
+	}
 	_configFileName = input;
 }
 
 /**
  * Generates JSON configuration file.
- * @return Path to generated JSON file.
+ * @return Path to generated JSON file, or empty string if file could not be
+ *         written.
  */
 std::string Config::generateJsonFile() const
 {
@@ -132,7 +262,8 @@ std::string Config::generateJsonFile() const
 /**
  * Generates JSON configuration file.
  * @param outputFilePath Path to output JSON file. If not set, use 'inputName'.
- * @return Path to generated JSON file.
+ * @return Path to generated JSON file, or empty string if file could not be
+ *         written.
  */
 std::string Config::generateJsonFile(const std::string& outputFilePath) const
 {
@@ -140,6 +271,11 @@ std::string Config::generateJsonFile(const std::string& outputFilePath) const
 
 	std::ofstream jsonFile( jsonName.c_str() );
 	jsonFile << generateJsonString();
+	jsonFile.close();
+	if (!jsonFile)
+	{
+		return std::string();
+	}
 
 	return jsonName;
 }
@@ -150,115 +286,161 @@ std::string Config::generateJsonFile(const std::string& outputFilePath) const
  */
 std::string Config::generateJsonString() const
 {
-	Json::Value root;
-
-	root[JSON_date]           = retdec::utils::getCurrentDate();
-	root[JSON_time]           = retdec::utils::getCurrentTime();
-	root[JSON_inputFile]      = getInputFile();
-
-	if (isIda()) root[JSON_ida] = isIda();
-	if (!getUnpackedInputFile().empty()) root[JSON_unpackedInputFile] = getUnpackedInputFile();
-	if (!getPdbInputFile().empty()) root[JSON_pdbInputFile] = getPdbInputFile();
-	if (!getFrontendVersion().empty()) root[JSON_frontendVersion] = getFrontendVersion();
-	if (getEntryPoint().isDefined()) root[JSON_entryPoint] = toJsonValue(getEntryPoint());
-	if (getMainAddress().isDefined()) root[JSON_mainAddress] = toJsonValue(getMainAddress());
-	if (getSectionVMA().isDefined()) root[JSON_sectionVMA] = toJsonValue(getSectionVMA());
-	if (getImageBase().isDefined()) root[JSON_imageBase] = toJsonValue(getImageBase());
-
-	root[JSON_parameters]     = parameters.getJsonValue();
-	root[JSON_architecture]   = architecture.getJsonValue();
-	root[JSON_fileType]       = fileType.getJsonValue();
-	root[JSON_fileFormat]     = fileFormat.getJsonValue();
-	root[JSON_tools]          = tools.getJsonValue();
-	root[JSON_languages]      = languages.getJsonValue();
-	root[JSON_functions]      = functions.getJsonValue();
-	root[JSON_globals]        = globals.getJsonValue();
-	root[JSON_registers]      = registers.getJsonValue();
-	root[JSON_structures]     = structures.getJsonValue();
-	root[JSON_segments]       = segments.getJsonValue();
-	root[JSON_vtables]        = vtables.getJsonValue();
-	root[JSON_classes]        = classes.getJsonValue();
-	root[JSON_patterns]       = patterns.getJsonValue();
-
-	StreamWriterBuilder builder;
-	return writeString(builder, root);
+	auto writer = ConfigWriter::createJsonWriter();
+	writeMembers(*writer);
+	return writer->finish();
 }
 
 /**
  * Reads string containig JSON representation of configuration.
  * If file can not be parsed, an instance of @c ParseException is thrown.
+ * Configuration is not changed in such a case.
  * @param json JSON string.
  */
 void Config::readJsonString(const std::string& json)
 {
-	Json::Value root;
-	std::string errs;
-
-	std::istringstream input(json);
-	Json::CharReaderBuilder rbuilder;
-	bool success = Json::parseFromStream(rbuilder, input, &root, &errs);
-	if (!success || root.isNull() || !root.isObject() )
+	try
 	{
-		std::string errMsg = "Failed to parse configuration";
-		std::size_t line = 0;
-		std::size_t column = 0;
-
-		if (!errs.empty())
+		readMembers([&json](ConfigReaderHandler& handler)
 		{
-			const auto posNL = errs.find('\n');
-			const auto posLine = errs.find("Line");
-			const auto posColumn = errs.find("Column");
+			readJsonConfig(json, handler);
+		});
+	}
+	catch (const InternalException& e)
+	{
+		auto loc = retdec::utils::getLineAndColumnFromPosition(json, e.getPosition());
+		throw ParseException(e.getMessage(), loc.first, loc.second);
+	}
+}
 
-			if (posNL != std::string::npos
-					&& posLine != std::string::npos
-					&& posColumn != std::string::npos)
-			{
-				// Get error postion from message
-				line = std::stoul(errs.substr(posLine + 5));
-				column = std::stoul(errs.substr(posColumn + 7));
-
-				// Get error description from message
-				auto message = errs.substr(posNL + 1);
-				errMsg = retdec::utils::trim(message, " .\r\n");
-			}
-		}
+/**
+ * Generates string containing compact binary representation of configuration.
+ * It has the same content as the JSON representation, but it is smaller and
+ * faster to generate and read. It is meant to pass configuration between
+ * tools.
+ * @return Binary string.
+ */
+std::string Config::generateBinaryString() const
+{
+	auto writer = ConfigWriter::createBinaryWriter();
+	writeMembers(*writer);
+	return writer->finish();
+}
 
-		throw ParseException(errMsg, line, column);
-	}
+/**
+ * Generates configuration file in the binary encoding.
+ * It can be read by readJsonFile().
+ * @param outputFilePath Path to output file. If not set, use 'inputName'.
+ * @return Path to generated file.
+ */
+std::string Config::generateBinaryFile(const std::string& outputFilePath) const
+{
+	std::string name = (outputFilePath.empty()) ? (getInputFile() + ".json") : (outputFilePath);
 
-	*this = Config();
+	std::ofstream file( name.c_str(), std::ios::out | std::ios::binary );
+	file << generateBinaryString();
 
+	return name;
+}
+
+/**
+ * Reads string containig binary representation of configuration
+ * (see generateBinaryString()).
+ * If data can not be parsed, an instance of @c ParseException is thrown.
+ * Its column is the offset of the bad byte. Configuration is not changed
+ * in such a case.
+ * @param data Binary string.
+ */
+void Config::readBinaryString(const std::string& data)
+{
 	try
 	{
-		setIsIda( safeGetBool(root, JSON_ida) );
-		setInputFile( safeGetString(root, JSON_inputFile) );
-		setUnpackedInputFile( safeGetString(root, JSON_unpackedInputFile) );
-		setPdbInputFile( safeGetString(root, JSON_pdbInputFile) );
-		setFrontendVersion( safeGetString(root, JSON_frontendVersion) );
-		setEntryPoint( safeGetAddress(root, JSON_entryPoint) );
-		setMainAddress( safeGetAddress(root, JSON_mainAddress) );
-		setSectionVMA( safeGetAddress(root, JSON_sectionVMA) );
-		setImageBase( safeGetAddress(root, JSON_imageBase) );
-
-		parameters.readJsonValue( root[JSON_parameters] );
-		architecture.readJsonValue( root[JSON_architecture] );
-		fileType.readJsonValue( root[JSON_fileType] );
-		fileFormat.readJsonValue( root[JSON_fileFormat] );
-		tools.readJsonValue( root[JSON_tools] );
-		languages.readJsonValue( root[JSON_languages] );
-		functions.readJsonValue( root[JSON_functions] );
-		globals.readJsonValue( root[JSON_globals] );
-		registers.readJsonValue( root[JSON_registers] );
-		structures.readJsonValue( root[JSON_structures] );
-		segments.readJsonValue( root[JSON_segments] );
-		vtables.readJsonValue( root[JSON_vtables] );
-		classes.readJsonValue( root[JSON_classes] );
-		patterns.readJsonValue( root[JSON_patterns] );
+		readMembers([&data](ConfigReaderHandler& handler)
+		{
+			readBinaryConfig(data, handler);
+		});
 	}
 	catch (const InternalException& e)
 	{
-		auto loc = retdec::utils::getLineAndColumnFromPosition(json, e.getPosition());
-		throw ParseException(e.getMessage(), loc.first, loc.second);
+		throw ParseException(e.getMessage(), 0, e.getPosition());
+	}
+}
+
+/**
+ * Reads members of the root object of configuration produced by @a parse.
+ * Configuration is changed only if the whole input is read successfully.
+ */
+void Config::readMembers(
+		const std::function<void(ConfigReaderHandler&)>& parse)
+{
+	Config config;
+	Json::Value root(Json::objectValue);
+	ConfigReader reader(config, root);
+	parse(reader);
+
+	config.setIsIda( safeGetBool(root, JSON_ida) );
+	config.setInputFile( safeGetString(root, JSON_inputFile) );
+	config.setUnpackedInputFile( safeGetString(root, JSON_unpackedInputFile) );
+	config.setPdbInputFile( safeGetString(root, JSON_pdbInputFile) );
+	config.setFrontendVersion( safeGetString(root, JSON_frontendVersion) );
+	config.setEntryPoint( safeGetAddress(root, JSON_entryPoint) );
+	config.setMainAddress( safeGetAddress(root, JSON_mainAddress) );
+	config.setSectionVMA( safeGetAddress(root, JSON_sectionVMA) );
+	config.setImageBase( safeGetAddress(root, JSON_imageBase) );
+
+	*this = std::move(config);
+}
+
+/**
+ * Writes all members of the root object of configuration into @a writer.
+ * Sections which are arrays are written element by element.
+ */
+void Config::writeMembers(ConfigWriter& writer) const
+{
+	using MemberWriter = std::function<void(ConfigWriter&)>;
+
+	// Ordered by names, the same as members of jsoncpp objects.
+	std::map<std::string, MemberWriter> members;
+	auto addValue = [&members](const std::string& name, const Json::Value& val)
+	{
+		members[name] = [name, val](ConfigWriter& w) { w.writeMember(name, val); };
+	};
+	auto addArray = [&members](const std::string& name, const auto& c)
+	{
+		members[name] = [name, &c](ConfigWriter& w) { writeArrayMember(w, name, c); };
+	};
+
+	addValue(JSON_date, retdec::utils::getCurrentDate());
+	addValue(JSON_time, retdec::utils::getCurrentTime());
+	addValue(JSON_inputFile, getInputFile());
+
+	if (isIda()) addValue(JSON_ida, isIda());
+	if (!getUnpackedInputFile().empty()) addValue(JSON_unpackedInputFile, getUnpackedInputFile());
+	if (!getPdbInputFile().empty()) addValue(JSON_pdbInputFile, getPdbInputFile());
+	if (!getFrontendVersion().empty()) addValue(JSON_frontendVersion, getFrontendVersion());
+	if (getEntryPoint().isDefined()) addValue(JSON_entryPoint, toJsonValue(getEntryPoint()));
+	if (getMainAddress().isDefined()) addValue(JSON_mainAddress, toJsonValue(getMainAddress()));
+	if (getSectionVMA().isDefined()) addValue(JSON_sectionVMA, toJsonValue(getSectionVMA()));
+	if (getImageBase().isDefined()) addValue(JSON_imageBase, toJsonValue(getImageBase()));
+
+	addValue(JSON_parameters, parameters.getJsonValue());
+	addValue(JSON_architecture, architecture.getJsonValue());
+	addValue(JSON_fileType, fileType.getJsonValue());
+	addValue(JSON_fileFormat, fileFormat.getJsonValue());
+	addArray(JSON_tools, tools);
+	addArray(JSON_languages, languages);
+	addArray(JSON_functions, functions);
+	addArray(JSON_globals, globals);
+	addArray(JSON_registers, registers);
+	addArray(JSON_structures, structures);
+	addArray(JSON_segments, segments);
+	addArray(JSON_vtables, vtables);
+	addArray(JSON_classes, classes);
+	addArray(JSON_patterns, patterns);
+
+	for (auto& m : members)
+	{
+		m.second(writer);
 	}
 }
 
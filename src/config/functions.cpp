@@ -270,32 +270,133 @@ const Function* FunctionContainer::getFunctionByName(const std::string& name) co
 
 /**
  * @return Pointer to function or @c nullptr if not found.
+ * If there are more functions starting at @a addr, the one with the
+ * lexicographically smallest name is returned.
  */
 Function* FunctionContainer::getFunctionByStartAddress(const retdec::utils::Address& addr)
 {
-	for (auto& elem : _data)
+	return likeConstVersion(this, &FunctionContainer::getFunctionByStartAddress, addr);
+}
+
+/// const version of getFunctionByStartAddress().
+const Function* FunctionContainer::getFunctionByStartAddress(const retdec::utils::Address& addr) const
+{
+	auto it = _start2names.find(addr);
+	if (it == _start2names.end())
 	{
-		if (addr == elem.second.getStart())
+		return nullptr;
+	}
+
+	// Check the current address in case it was changed in place.
+	for (auto& name : it->second)
+	{
+		auto* f = getElementById(name);
+		if (f && f->getStart() == addr)
 		{
-			return &elem.second;
+			return f;
 		}
 	}
 
 	return nullptr;
 }
 
+/**
+ * @return Pointer to function or @c nullptr if not found.
+ * If there are more functions with real name @a name, the one with the
+ * lexicographically smallest name is returned.
+ */
 Function* FunctionContainer::getFunctionByRealName(const std::string& name)
 {
-	for (auto& elem : _data)
+	return likeConstVersion(this, &FunctionContainer::getFunctionByRealName, name);
+}
+
+/// const version of getFunctionByRealName().
+const Function* FunctionContainer::getFunctionByRealName(const std::string& name) const
+{
+	auto it = _realName2names.find(name);
+	if (it == _realName2names.end())
 	{
-		if (name == elem.second.getRealName())
+		return nullptr;
+	}
+
+	// Check the current real name in case it was changed in place.
+	for (auto& n : it->second)
+	{
+		auto* f = getElementById(n);
+		if (f && f->getRealName() == name)
 		{
-			return &elem.second;
+			return f;
 		}
 	}
 
 	return nullptr;
 }
 
+/**
+ * Inserts function @a e and updates the indexes.
+ * See @c BaseAssociativeContainer::insert() for details.
+ */
+std::pair<FunctionContainer::iterator,bool> FunctionContainer::insert(const Function& e)
+{
+	if (auto* old = getFunctionByName(e.getName()))
+	{
+		removeFromIndexes(*old);
+	}
+
+	auto res = BaseAssociativeContainer::insert(e);
+	addToIndexes(res.first->second);
+	return res;
+}
+
+void FunctionContainer::clear()
+{
+	BaseAssociativeContainer::clear();
+	_start2names.clear();
+	_realName2names.clear();
+}
+
+/**
+ * Erases function named @a name and updates the indexes.
+ * @return Number of erased functions.
+ */
+size_t FunctionContainer::erase(const std::string& name)
+{
+	if (auto* f = getFunctionByName(name))
+	{
+		removeFromIndexes(*f);
+	}
+
+	return BaseAssociativeContainer::erase(name);
+}
+
+void FunctionContainer::addToIndexes(const Function& f)
+{
+	_start2names[f.getStart()].insert(f.getName());
+	_realName2names[f.getRealName()].insert(f.getName());
+}
+
+void FunctionContainer::removeFromIndexes(const Function& f)
+{
+	auto sIt = _start2names.find(f.getStart());
+	if (sIt != _start2names.end())
+	{
+		sIt->second.erase(f.getName());
+		if (sIt->second.empty())
+		{
+			_start2names.erase(sIt);
+		}
+	}
+
+	auto rIt = _realName2names.find(f.getRealName());
+	if (rIt != _realName2names.end())
+	{
+		rIt->second.erase(f.getName());
+		if (rIt->second.empty())
+		{
+			_realName2names.erase(rIt);
+		}
+	}
+}
+
 } // namespace config
 } // namespace retdec
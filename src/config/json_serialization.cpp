@@ -0,0 +1,363 @@
+/**
+ * @file src/config/json_serialization.cpp
+ * @brief Streaming reading and writing of configuration in JSON.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ *
+ * JSON is parsed and written by rapidjson, which is much faster than jsoncpp
+ * readers and writers. Only values of members of the root object are
+ * converted into jsoncpp values. They are passed to the handler as soon as
+ * they are complete, so the whole configuration is never stored twice.
+ * Elements of arrays may be passed to the handler even one by one.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <rapidjson/error/en.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/reader.h>
+
+#include "retdec/config/config_exceptions.h"
+#include "retdec/config/serialization.h"
+#include "retdec/utils/string.h"
+
+namespace retdec {
+namespace config {
+
+namespace {
+
+/**
+ * Output stream for rapidjson writers appending characters to a string.
+ */
+class StringOutputStream
+{
+	public:
+		using Ch = char;
+
+	public:
+		void Put(Ch c) { str.push_back(c); }
+		void Flush() {}
+
+	public:
+		std::string str;
+};
+
+/**
+ * Writer of the JSON encoding.
+ */
+class JsonConfigWriter : public ConfigWriter
+{
+	public:
+		JsonConfigWriter() :
+			_writer(_stream)
+		{
+			// The same indentation as used by jsoncpp writers.
+			_writer.SetIndent('\t', 1);
+			_writer.StartObject();
+		}
+
+		virtual void writeMember(
+				const std::string& name,
+				const Json::Value& val) override
+		{
+			writeKey(name);
+			writeValue(val);
+		}
+
+		virtual void startArrayMember(const std::string& name, std::size_t) override
+		{
+			writeKey(name);
+			_writer.StartArray();
+		}
+
+		virtual void writeArrayElement(const Json::Value& val) override
+		{
+			writeValue(val);
+		}
+
+		virtual void endArrayMember() override
+		{
+			_writer.EndArray();
+		}
+
+		virtual std::string finish() override
+		{
+			_writer.EndObject();
+			return std::move(_stream.str);
+		}
+
+	private:
+		void writeKey(const std::string& name)
+		{
+			_writer.Key(
+					name.data(),
+					static_cast<rapidjson::SizeType>(name.size()));
+		}
+
+		void writeValue(const Json::Value& val)
+		{
+			switch (val.type())
+			{
+				case Json::nullValue:
+					_writer.Null();
+					break;
+				case Json::booleanValue:
+					_writer.Bool(val.asBool());
+					break;
+				case Json::intValue:
+					_writer.Int64(val.asLargestInt());
+					break;
+				case Json::uintValue:
+					_writer.Uint64(val.asLargestUInt());
+					break;
+				case Json::realValue:
+					_writer.Double(val.asDouble());
+					break;
+				case Json::stringValue:
+				{
+					const char* begin = nullptr;
+					const char* end = nullptr;
+					val.getString(&begin, &end);
+					_writer.String(
+							begin ? begin : "",
+							static_cast<rapidjson::SizeType>(end - begin));
+					break;
+				}
+				case Json::arrayValue:
+					_writer.StartArray();
+					for (auto& elem : val)
+					{
+						writeValue(elem);
+					}
+					_writer.EndArray();
+					break;
+				case Json::objectValue:
+					_writer.StartObject();
+					for (auto it = val.begin(); it != val.end(); ++it)
+					{
+						writeKey(it.name());
+						writeValue(*it);
+					}
+					_writer.EndObject();
+					break;
+			}
+		}
+
+	private:
+		StringOutputStream _stream;
+		rapidjson::PrettyWriter<StringOutputStream> _writer;
+};
+
+/**
+ * SAX handler creating jsoncpp values of members of the root object.
+ */
+class JsonValueBuilder : public rapidjson::BaseReaderHandler<
+		rapidjson::UTF8<>,
+		JsonValueBuilder>
+{
+	public:
+		JsonValueBuilder(
+				ConfigReaderHandler& handler,
+				const rapidjson::MemoryStream& stream) :
+			_handler(handler),
+			_stream(stream)
+		{
+		}
+
+		bool Null() { return add(Json::Value()); }
+		bool Bool(bool b) { return add(Json::Value(b)); }
+		bool Int(int i) { return add(Json::Value(Json::Value::LargestInt(i))); }
+		bool Uint(unsigned u) { return addUnsigned(u); }
+		bool Int64(std::int64_t i) { return add(Json::Value(Json::Value::LargestInt(i))); }
+		bool Uint64(std::uint64_t u) { return addUnsigned(u); }
+		bool Double(double d) { return add(Json::Value(d)); }
+
+		bool String(const char* str, rapidjson::SizeType length, bool)
+		{
+			return add(Json::Value(str, str + length));
+		}
+
+		bool Key(const char* str, rapidjson::SizeType length, bool)
+		{
+			if (_stack.empty())
+			{
+				_memberName.assign(str, length);
+			}
+			else
+			{
+				_key.assign(str, length);
+			}
+			return true;
+		}
+
+		bool StartObject() { return start(Json::objectValue); }
+		bool EndObject(rapidjson::SizeType) { return end(); }
+		bool StartArray() { return start(Json::arrayValue); }
+		bool EndArray(rapidjson::SizeType) { return end(); }
+
+		bool isRootObject() const
+		{
+			return _rootIsObject;
+		}
+
+	private:
+		/**
+		 * jsoncpp stores non-negative numbers which fit into the largest int
+		 * type as int values.
+		 */
+		bool addUnsigned(std::uint64_t u)
+		{
+			return u <= std::uint64_t(Json::Value::maxLargestInt)
+					? add(Json::Value(Json::Value::LargestInt(u)))
+					: add(Json::Value(Json::Value::LargestUInt(u)));
+		}
+
+		/**
+		 * Returns a new value in the innermost array or object.
+		 */
+		Json::Value& slot()
+		{
+			auto* top = _stack.back();
+			return top->isArray() ? top->append(Json::Value()) : (*top)[_key];
+		}
+
+		bool add(Json::Value&& val)
+		{
+			if (!_inRoot)
+			{
+				_rootIsObject = false;
+				return false;
+			}
+
+			val.setOffsetStart(_stream.Tell());
+			if (_stack.empty())
+			{
+				dispatch(val);
+			}
+			else
+			{
+				slot().swap(val);
+			}
+			return true;
+		}
+
+		bool start(Json::ValueType type)
+		{
+			if (!_inRoot)
+			{
+				_rootIsObject = type == Json::objectValue;
+				_inRoot = true;
+				return _rootIsObject;
+			}
+
+			if (_stack.empty()
+					&& !_inArray
+					&& type == Json::arrayValue
+					&& _handler.onArrayStart(_memberName))
+			{
+				_inArray = true;
+				return true;
+			}
+
+			auto& val = _stack.empty() ? _member : slot();
+			val = Json::Value(type);
+			val.setOffsetStart(_stream.Tell() - 1);
+			_stack.push_back(&val);
+			return true;
+		}
+
+		bool end()
+		{
+			if (_stack.empty())
+			{
+				// End of an array read element by element or of the root
+				// object.
+				_inArray = false;
+				return true;
+			}
+
+			_stack.pop_back();
+			if (_stack.empty())
+			{
+				dispatch(_member);
+				_member = Json::Value();
+			}
+			return true;
+		}
+
+		/**
+		 * Passes completely read value @a val to the handler.
+		 */
+		void dispatch(const Json::Value& val)
+		{
+			if (_inArray)
+			{
+				_handler.onArrayElement(_memberName, val);
+			}
+			else
+			{
+				_handler.onMember(_memberName, val);
+			}
+		}
+
+	private:
+		ConfigReaderHandler& _handler;
+		const rapidjson::MemoryStream& _stream;
+		/// Have we entered the root value?
+		bool _inRoot = false;
+		bool _rootIsObject = true;
+		/// Are we in an array read element by element?
+		bool _inArray = false;
+		/// Name of the currently read member of the root object.
+		std::string _memberName;
+		/// Value of the currently read member of the root object.
+		Json::Value _member;
+		/// Name of the currently read member of the innermost object.
+		std::string _key;
+		/// Arrays and objects which are being read.
+		std::vector<Json::Value*> _stack;
+};
+
+} // anonymous namespace
+
+std::unique_ptr<ConfigWriter> ConfigWriter::createJsonWriter()
+{
+	return std::unique_ptr<ConfigWriter>(new JsonConfigWriter());
+}
+
+/**
+ * Reads configuration @a json and passes members of its root object to
+ * @a handler.
+ * If the JSON can not be parsed or its root is not an object, an instance of
+ * @c ParseException is thrown.
+ */
+void readJsonConfig(const std::string& json, ConfigReaderHandler& handler)
+{
+	// Comments and trailing characters are allowed, like in jsoncpp readers.
+	const unsigned flags = rapidjson::kParseCommentsFlag
+			| rapidjson::kParseStopWhenDoneFlag
+			| rapidjson::kParseFullPrecisionFlag;
+
+	rapidjson::MemoryStream stream(json.data(), json.size());
+	JsonValueBuilder builder(handler, stream);
+	rapidjson::Reader reader;
+	auto res = reader.Parse<flags>(stream, builder);
+	if (!builder.isRootObject())
+	{
+		throw ParseException("Failed to parse configuration", 0, 0);
+	}
+	else if (res.IsError())
+	{
+		auto loc = retdec::utils::getLineAndColumnFromPosition(
+				json,
+				res.Offset());
+		throw ParseException(
+				rapidjson::GetParseError_En(res.Code()),
+				loc.first,
+				loc.second);
+	}
+}
+
+} // namespace config
+} // namespace retdec
@@ -236,7 +236,14 @@ std::pair<RegisterContainer::iterator,bool> RegisterContainer::insert(const Obje
 {
 	if (e.getStorage().isRegister())
 	{
-		return BaseAssociativeContainer::insert(e);
+		if (auto* existing = getObjectByName(e.getName()))
+		{
+			removeFromIndex(*existing);
+		}
+
+		auto res = BaseAssociativeContainer::insert(e);
+		_realName2names[e.getRealName()].insert(e.getName());
+		return res;
 	}
 	else
 	{
@@ -254,6 +261,66 @@ std::pair<RegisterContainer::iterator,bool> RegisterContainer::insert(
 	return insert(r);
 }
 
+/**
+ * @return Pointer to register or @c nullptr if not found.
+ * If there are more registers with real name @a name, the one with the
+ * lexicographically smallest name is returned.
+ */
+const Object* RegisterContainer::getObjectByRealName(
+		const std::string& name) const
+{
+	auto fIt = _realName2names.find(name);
+	if (fIt == _realName2names.end())
+	{
+		return nullptr;
+	}
+
+	// Check the current real name in case it was changed in place.
+	for (auto& n : fIt->second)
+	{
+		auto* r = getObjectByName(n);
+		if (r && r->getRealName() == name)
+		{
+			return r;
+		}
+	}
+	return nullptr;
+}
+
+/**
+ * Clear both underlying container and @c realName2names map.
+ */
+void RegisterContainer::clear()
+{
+	_data.clear();
+	_realName2names.clear();
+}
+
+/**
+ * Erase from both underlying container and @c realName2names map.
+ */
+size_t RegisterContainer::erase(const std::string& name)
+{
+	if (auto* r = getObjectByName(name))
+	{
+		removeFromIndex(*r);
+	}
+	return _data.erase(name);
+}
+
+void RegisterContainer::removeFromIndex(const Object& o)
+{
+	auto fIt = _realName2names.find(o.getRealName());
+	if (fIt != _realName2names.end())
+	{
+		fIt->second.erase(o.getName());
+		if (fIt->second.empty())
+		{
+			_realName2names.erase(fIt);
+		}
+	}
+}
+
 //
 //=============================================================================
 // GlobalVarContainer
@@ -322,6 +389,13 @@ std::pair<GlobalVarContainer::iterator,bool> GlobalVarContainer::insert(
 	{
 		erase(*existing);
 	}
+	// Object with the same name may be on a different address, which must
+	// not be mapped to it anymore.
+	auto sameName = getObjectByName(e.getName());
+	if (sameName && sameName->getStorage().isMemory())
+	{
+		_addr2global.erase(sameName->getStorage().getAddress());
+	}
 
 	auto retPair = BaseAssociativeContainer::insert(e);
 
@@ -347,6 +421,16 @@ void GlobalVarContainer::clear()
 	_addr2global.clear();
 }
 
+/**
+ * Erase object named @a name from both underlying container and
+ * @c addr2global map.
+ */
+size_t GlobalVarContainer::erase(const std::string& name)
+{
+	auto* obj = getObjectByName(name);
+	return obj ? erase(*obj) : 0;
+}
+
 /**
  * Erase from both underlying container and @c addr2global map.
  */
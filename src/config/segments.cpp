@@ -62,5 +62,31 @@ void Segment::setComment(const std::string& c) { _comment = c; }
 std::string Segment::getName() const           { return _name; }
 std::string Segment::getComment() const        { return _comment; }
 
+//
+//=============================================================================
+// SegmentContainer
+//=============================================================================
+//
+
+/**
+ * @return Pointer to segment containing address @a addr or @c nullptr if
+ *         there is no such segment.
+ * @note Segments are ordered by their start addresses and they are expected
+ *       not to overlap, so this search has logarithmic time complexity.
+ */
+const Segment* SegmentContainer::getSegmentContainingAddress(
+		const retdec::utils::Address& addr) const
+{
+	// The last segment starting at or before the address.
+	auto it = _data.upper_bound(Segment(addr));
+	if (it == _data.begin())
+	{
+		return nullptr;
+	}
+
+	--it;
+	return it->contains(addr) ? &*it : nullptr;
+}
+
 } // namespace config
 } // namespace retdec
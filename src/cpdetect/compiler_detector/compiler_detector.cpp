@@ -15,7 +15,7 @@
 
 using namespace retdec::fileformat;
 using namespace retdec::utils;
-using namespace yaracpp;
+using namespace retdec::yara_support;
 
 namespace retdec {
 namespace cpdetect {
@@ -323,7 +323,8 @@ ReturnCode CompilerDetector::getAllSignatures()
 		}
 	}
 
-	yara.analyze(fileParser.getPathToFile(), cpParams.searchType != SearchType::EXACT_MATCH);
+	yara.analyze(fileParser.getBytesData(), fileParser.getFileLength(),
+			cpParams.searchType != SearchType::EXACT_MATCH);
 	const auto &detected = yara.getDetectedRules();
 	const auto &undetected = yara.getUndetectedRules();
 	auto result = false;
@@ -566,14 +566,13 @@ void Heuristics::getCommentSectionsHeuristics()
 {
 	for (const auto *sec : fileParser.getSections({".comment", ".rdata"}))
 	{
-		std::string secContent;
-		if (!sec || !sec->getString(secContent))
+		if (!sec)
 		{
 			continue;
 		}
 
 		std::vector<std::string> records;
-		separateStrings(secContent, records);
+		separateStrings(sec->getBytes(), records);
 
 		for (const auto &item : records)
 		{
@@ -777,20 +776,21 @@ std::string Heuristics::getEmbarcaderoVersion()
 	// Get comment section name
 	auto sectionName = commentSectionNameByFormat(fileParser.getFileFormat());
 
-	std::string content;
 	const Section* section = fileParser.getSection(sectionName);
-	if (section && section->getString(content, 0, 0))
+	if (section)
 	{
+		const auto content = section->getBytes();
+
 		// Get offset to version in compiler ID string
 		auto startOffset = content.find("Embarcadero Delphi ");
-		if (startOffset != std::string::npos)
+		if (startOffset != llvm::StringRef::npos)
 		{
 			// Search for platform specific string
-			std::string::size_type offset = startOffset + 19;
+			std::size_t offset = startOffset + 19;
 			for (const auto pair : delphiStrings)
 			{
 				offset = content.find(pair.first, startOffset);
-				if (offset != std::string::npos)
+				if (offset != llvm::StringRef::npos)
 				{
 					offset = pair.second;
 					break;
@@ -798,9 +798,9 @@ std::string Heuristics::getEmbarcaderoVersion()
 			}
 
 			// Search for compiler version in xx.x format
-			if (offset != std::string::npos)
+			if (offset != llvm::StringRef::npos)
 			{
-				auto version = content.substr(startOffset + offset, 4);
+				auto version = content.substr(startOffset + offset, 4).str();
 				if (std::regex_match(version, std::regex("[[:digit:]]+.[[:digit:]]")))
 				{
 					return version;
@@ -75,6 +75,24 @@ const std::vector<Signature> x86SlashedSignatures =
 	{"yoda's Protector", "1.03.3", "E803000000/BB55000000E803000000/E88E000000E803000000EB01--E881000000E803000000EB01--E8B7000000E803000000EB01--E8AA000000E803000000EB01--83FB55E803000000EB01--75;", "Ashkbiz Danehkar", 0, 0}
 };
 
+/**
+ * Get patterns of signatures
+ * @param signatures Signatures
+ * @return Patterns in the same order as @a signatures
+ */
+std::vector<std::string> getPatterns(const std::vector<Signature> &signatures)
+{
+	std::vector<std::string> patterns;
+	for (const auto &sig : signatures)
+	{
+		patterns.push_back(sig.pattern);
+	}
+
+	return patterns;
+}
+
+const SignatureMatcher x86SlashedMatcher(getPatterns(x86SlashedSignatures));
+
 const std::vector<std::string> enigmaPatterns =
 {
 	"60E8000000005D81ED--------81ED--------E9;",
@@ -92,6 +110,8 @@ const std::vector<std::string> dotNetShrinkPatterns =
 	"20E6EA19BE28--------13--2039EA19BE28--------13--11--11--161F4028--------26;"
 };
 
+const SignatureMatcher dotNetShrinkMatcher(dotNetShrinkPatterns);
+
 const std::string msvcRuntimeString = "Microsoft Visual C++ Runtime Library";
 
 const std::vector<std::string> msvcRuntimeStrings =
@@ -338,6 +358,7 @@ void PeHeuristics::getSlashedSignatures()
 	}
 
 	const auto stopOffset = toolInfo.epOffset + LIGHTWEIGHT_FILE_SCAN_AREA;
+	std::vector<std::pair<std::size_t, std::size_t>> areas;
 	for (const auto &sig : x86SlashedSignatures)
 	{
 		auto start = toolInfo.epOffset;
@@ -354,9 +375,17 @@ void PeHeuristics::getSlashedSignatures()
 					+ fileParser.bytesFromNibblesRounded(sig.pattern.length() - 1) - 1);
 		}
 
-		const auto nibbles = search.findSlashedSignature(sig.pattern, start, end);
+		areas.emplace_back(start, end);
+	}
+
+	// all signatures are searched in one pass over area after entry point
+	const auto found = search.findSlashedSignatures(x86SlashedMatcher, areas);
+	for (std::size_t i = 0, e = found.size(); i < e; ++i)
+	{
+		const auto nibbles = found[i];
 		if (nibbles)
 		{
+			const auto &sig = x86SlashedSignatures[i];
 			addPacker(nibbles, nibbles, sig.name, sig.version, sig.additional);
 		}
 	}
@@ -809,9 +838,9 @@ void PeHeuristics::getNetHeuristic()
 
 		// Note: Before modifying the following loop to std::any_of(),
 		//       please see #231 (compilation bug with GCC 5).
-		for (const auto& str : dotNetShrinkPatterns)
+		for (const auto nibbles : search.findUnslashedSignatures(dotNetShrinkMatcher, start, end))
 		{
-			if (search.findUnslashedSignature(str, start, end))
+			if (nibbles)
 			{
 				addPacker(source, strength, ".netshrink", "2.01 (demo)");
 				break;
@@ -1157,15 +1186,14 @@ void PeHeuristics::getRdataHeuristic()
 	auto source = DetectionMethod::COMMENT_H;
 	auto strength = DetectionStrength::MEDIUM;
 
-	std::string content;
 	const Section* section = fileParser.getSection(".rdata");
-	if (!section || !section->getString(content))
+	if (!section)
 	{
 		return;
 	}
 
 	std::vector<std::string> records;
-	separateStrings(content, records);
+	separateStrings(section->getBytes(), records);
 
 	std::string name, version, extra;
 	for (const auto& record : records)
@@ -5,6 +5,7 @@
  */
 
 #include <algorithm>
+#include <limits>
 #include <map>
 
 #include "retdec/utils/container.h"
@@ -37,13 +38,32 @@ const std::map<Architecture, std::vector<Search::RelativeJump>> jumpMap =
  * Constructor
  * @param fileParser Parser of input file
  */
-Search::Search(retdec::fileformat::FileFormat &fileParser) : parser(fileParser), averageSlashLen(0)
+Search::Search(retdec::fileformat::FileFormat &fileParser) : parser(fileParser), data(nullptr), dataSize(0), averageSlashLen(0),
+	nibblesInByte(fileParser.getNumberOfNibblesInByte())
 {
-	const auto &bytes = parser.getLoadedBytes();
-	bytesToHexString(bytes, nibbles);
-	bytesToString(bytes, plain);
+	const auto bytes = parser.getLoadedBytes();
+	bytesToString(bytes.data(), bytes.size(), plain);
+	data = bytes.data();
+	dataSize = bytes.size();
 	fileLoaded = !bytes.empty();
-	fileSupported = parser.hexToLittle(nibbles) && parser.getNumberOfNibblesInByte();
+	fileSupported = !parser.isUnknownEndian() && nibblesInByte;
+
+	// signatures are always written in little endian, incomplete word at the end of file is ignored
+	if(fileSupported && parser.isBigEndian())
+	{
+		const auto wordSize = parser.getBytesPerWord();
+		fileSupported = wordSize && dataSize >= wordSize;
+		if(fileSupported)
+		{
+			swappedBytes.assign(data, data + dataSize - dataSize % wordSize);
+			for(auto it = swappedBytes.begin(), e = swappedBytes.end(); it != e; it += wordSize)
+			{
+				std::reverse(it, it + wordSize);
+			}
+			data = swappedBytes.data();
+			dataSize = swappedBytes.size();
+		}
+	}
 	jumps = mapGetValueOrDefault(jumpMap, parser.getTargetArchitecture(), std::vector<RelativeJump>());
 
 	for(std::size_t i = 0, e = jumps.size(); i < e; ++i)
@@ -144,6 +164,55 @@ std::size_t Search::bytesFromNibbles(std::size_t nNibbles) const
 	return parser.bytesFromNibbles(nNibbles);
 }
 
+/**
+ * Get number of nibbles in content of file
+ * @return Number of nibbles
+ */
+std::size_t Search::getNumberOfNibbles() const
+{
+	return nibblesFromBytes(dataSize);
+}
+
+/**
+ * Get one nibble of content of file
+ * @param nibbleOffset Offset of nibble in content of file
+ * @return Hexadecimal digit of selected nibble (in uppercase)
+ *
+ * The first nibble of each byte is the most significant one.
+ */
+char Search::getNibble(std::size_t nibbleOffset) const
+{
+	const auto byte = data[nibbleOffset / nibblesInByte];
+	const auto shift = 4 * (nibblesInByte - 1 - nibbleOffset % nibblesInByte);
+	return "0123456789ABCDEF"[(byte >> shift) & 0x0F];
+}
+
+/**
+ * Check if unslashed signature is present on specified nibble
+ * @param signPattern Signature pattern
+ * @param nibbleOffset Offset of nibble in content of file
+ * @param stopNibble Offset of first nibble which cannot be covered by signature
+ * @return @c true if signature is present on @a nibbleOffset, @c false otherwise
+ */
+bool Search::hasSignatureOnNibble(const std::string &signPattern, std::size_t nibbleOffset, std::size_t stopNibble) const
+{
+	if(nibbleOffset > stopNibble || stopNibble - nibbleOffset < signPattern.length())
+	{
+		return false;
+	}
+
+	for(std::size_t i = 0, e = signPattern.length(); i < e; ++i)
+	{
+		const auto c = signPattern[i];
+		if(c != getNibble(nibbleOffset + i) && c != '-' && c != '?' && c != ';')
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 /**
  * Check if input file was successfully loaded
  * @return @c true if file was successfully loaded, @c false otherwise
@@ -162,15 +231,6 @@ bool Search::isFileSupported() const
 	return fileSupported;
 }
 
-/**
- * Get content of file in hexadecimal string representation
- * @return Content of file in hexadecimal string representation
- */
-const std::string& Search::getNibbles() const
-{
-	return nibbles;
-}
-
 /**
  * Get content of file as plain string
  * @return Content of file as plain string
@@ -191,13 +251,14 @@ const std::string& Search::getPlainString() const
 const Search::RelativeJump* Search::getRelativeJump(std::size_t fileOffset, std::size_t shift, std::int64_t &moveSize) const
 {
 	const auto nibbleOffset = nibblesFromBytes(fileOffset) + shift;
+	const auto nibbleCount = getNumberOfNibbles();
 	moveSize = 0;
 
 	for(const auto &jump : jumps)
 	{
 		const auto nibblesAfter = nibblesFromBytes(jump.getBytesAfter());
-		if(!hasSubstringOnPosition(nibbles, jump.getSlash(), nibbleOffset) ||
-			(nibbleOffset + jump.getSlashNibbleSize() + nibblesAfter - 1 >= nibbles.length()))
+		if(!hasSignatureOnNibble(jump.getSlash(), nibbleOffset, nibbleCount) ||
+			(nibbleOffset + jump.getSlashNibbleSize() + nibblesAfter - 1 >= nibbleCount))
 		{
 			continue;
 		}
@@ -267,22 +328,7 @@ unsigned long long Search::countImpNibbles(const std::string &signPattern) const
  */
 unsigned long long Search::findUnslashedSignature(const std::string &signPattern, std::size_t startOffset, std::size_t stopOffset) const
 {
-	if(startOffset > stopOffset)
-	{
-		return 0;
-	}
-
-	const auto startIterator = nibbles.begin() + nibblesFromBytes(startOffset);
-	const auto stopIndex = nibblesFromBytes(stopOffset) + 1;
-	const auto stopIterator = stopIndex < nibbles.size() ? nibbles.begin() + stopIndex : nibbles.end();
-	const auto it = std::search(startIterator, stopIterator, signPattern.begin(), signPattern.end(),
-		[] (const char fileNibble, const char signatureNibble)
-		{
-			return fileNibble == signatureNibble || signatureNibble == '-' || signatureNibble == '?' || signatureNibble == ';';
-		}
-	);
-
-	return (it != stopIterator) ? countImpNibbles(signPattern) : 0;
+	return findUnslashedSignatures(SignatureMatcher({signPattern}), startOffset, stopOffset)[0];
 }
 
 /**
@@ -294,29 +340,102 @@ unsigned long long Search::findUnslashedSignature(const std::string &signPattern
  */
 unsigned long long Search::findSlashedSignature(const std::string &signPattern, std::size_t startOffset, std::size_t stopOffset) const
 {
+	return findSlashedSignatures(SignatureMatcher({signPattern}), {{startOffset, stopOffset}})[0];
+}
+
+/**
+ * Search for several unslashed signatures in one pass over selected area of file
+ * @param signatures Signature patterns
+ * @param startOffset Start offset in file (in bytes)
+ * @param stopOffset Stop offset in file (in bytes)
+ * @return For each pattern number of its significant nibbles if it is present
+ *    in area, 0 otherwise
+ */
+std::vector<unsigned long long> Search::findUnslashedSignatures(
+	const SignatureMatcher &signatures,
+	std::size_t startOffset,
+	std::size_t stopOffset) const
+{
+	std::vector<unsigned long long> result(signatures.getNumberOfPatterns(), 0);
 	if(startOffset > stopOffset)
 	{
-		return 0;
+		return result;
 	}
 
-	const auto areaSize = nibblesFromBytes(stopOffset - startOffset + 1);
-	const auto signSize = signPattern.length() - std::count(signPattern.begin(), signPattern.end(), ';');
-	if(areaSize < signSize)
+	const auto startNibble = nibblesFromBytes(startOffset);
+	const auto stopNibble = std::min(nibblesFromBytes(stopOffset) + 1, getNumberOfNibbles());
+	const auto found = signatures.search(data, dataSize, nibblesInByte, startNibble, stopNibble,
+		[&] (std::size_t index, std::size_t nibbleOffset)
+		{
+			return hasSignatureOnNibble(signatures.getPattern(index), nibbleOffset, stopNibble);
+		}
+	);
+
+	for(std::size_t i = 0, e = result.size(); i < e; ++i)
 	{
-		return false;
+		if(found[i])
+		{
+			result[i] = countImpNibbles(signatures.getPattern(i));
+		}
 	}
-	const auto iters = (startOffset == stopOffset) ? 1 : areaSize - signSize + 1;
 
-	for(std::size_t i = 0; i < iters; ++i)
+	return result;
+}
+
+/**
+ * Search for several signatures (which may contain slashes) in one pass over file
+ * @param signatures Signature patterns
+ * @param areas For each pattern start and stop offset (in bytes) of area in
+ *    which it is searched
+ * @return For each pattern number of its significant nibbles if it is present
+ *    in its area, 0 otherwise
+ */
+std::vector<unsigned long long> Search::findSlashedSignatures(
+	const SignatureMatcher &signatures,
+	const std::vector<std::pair<std::size_t, std::size_t>> &areas) const
+{
+	std::vector<unsigned long long> result(signatures.getNumberOfPatterns(), 0);
+	std::vector<std::pair<std::size_t, std::size_t>> nibbleAreas(result.size(), {0, 0});
+	auto minNibble = std::numeric_limits<std::size_t>::max();
+	std::size_t maxNibble = 0;
+
+	for(std::size_t i = 0, e = std::min(result.size(), areas.size()); i < e; ++i)
 	{
-		const auto result = exactComparison(signPattern, startOffset, i);
-		if(result)
+		const auto &pattern = signatures.getPattern(i);
+		const auto startOffset = areas[i].first;
+		const auto stopOffset = areas[i].second;
+		if(startOffset > stopOffset)
+		{
+			continue;
+		}
+
+		const auto areaSize = nibblesFromBytes(stopOffset - startOffset + 1);
+		const auto signSize = pattern.length() - std::count(pattern.begin(), pattern.end(), ';');
+		if(areaSize < signSize)
 		{
-			return result;
+			continue;
 		}
+		const auto iters = (startOffset == stopOffset) ? 1 : areaSize - signSize + 1;
+
+		nibbleAreas[i] = {nibblesFromBytes(startOffset), nibblesFromBytes(startOffset) + iters};
+		minNibble = std::min(minNibble, nibbleAreas[i].first);
+		maxNibble = std::max(maxNibble, nibbleAreas[i].second);
 	}
 
-	return 0;
+	signatures.search(data, dataSize, nibblesInByte, minNibble, std::min(maxNibble, getNumberOfNibbles()),
+		[&] (std::size_t index, std::size_t nibbleOffset)
+		{
+			if(nibbleOffset < nibbleAreas[index].first || nibbleOffset >= nibbleAreas[index].second)
+			{
+				return false;
+			}
+
+			result[index] = exactComparison(signatures.getPattern(index), 0, nibbleOffset);
+			return result[index] != 0;
+		}
+	);
+
+	return result;
 }
 
 /**
@@ -328,7 +447,7 @@ unsigned long long Search::findSlashedSignature(const std::string &signPattern,
  */
 unsigned long long Search::exactComparison(const std::string &signPattern, std::size_t fileOffset, std::size_t shift) const
 {
-	for(std::size_t sigIndex = 0, fileIndex = nibblesFromBytes(fileOffset) + shift, fileLen = nibbles.length();
+	for(std::size_t sigIndex = 0, fileIndex = nibblesFromBytes(fileOffset) + shift, fileLen = getNumberOfNibbles();
 		fileIndex < fileLen; ++sigIndex, ++fileIndex)
 	{
 		if(sigIndex == signPattern.length() || signPattern[sigIndex] == ';')
@@ -338,7 +457,7 @@ unsigned long long Search::exactComparison(const std::string &signPattern, std::
 		else if(signPattern[sigIndex] == '/')
 		{
 			std::int64_t moveSize = 0;
-			const auto actShift = (parser.getNumberOfNibblesInByte() ? fileIndex % parser.getNumberOfNibblesInByte() : 0);
+			const auto actShift = (nibblesInByte ? fileIndex % nibblesInByte : 0);
 			const auto *jump = getRelativeJump(bytesFromNibbles(fileIndex), actShift, moveSize);
 			if(!jump)
 			{
@@ -354,7 +473,7 @@ unsigned long long Search::exactComparison(const std::string &signPattern, std::
 			// move after one nibble is in header of cycle
 			fileIndex += jump->getSlashNibbleSize() + nibblesFromBytes(jump->getBytesAfter()) + moveSize - 1;
 		}
-		else if(signPattern[sigIndex] != nibbles[fileIndex] && signPattern[sigIndex] != '-' && signPattern[sigIndex] != '?')
+		else if(signPattern[sigIndex] != getNibble(fileIndex) && signPattern[sigIndex] != '-' && signPattern[sigIndex] != '?')
 		{
 			return 0;
 		}
@@ -377,7 +496,7 @@ bool Search::countSimilarity(const std::string &signPattern, Similarity &sim, st
 {
 	Similarity result;
 
-	for(std::size_t sigIndex = 0, fileIndex = nibblesFromBytes(fileOffset) + shift, fileLen = nibbles.length(); fileIndex < fileLen; ++sigIndex, ++fileIndex)
+	for(std::size_t sigIndex = 0, fileIndex = nibblesFromBytes(fileOffset) + shift, fileLen = getNumberOfNibbles(); fileIndex < fileLen; ++sigIndex, ++fileIndex)
 	{
 		if(sigIndex == signPattern.length() || signPattern[sigIndex] == ';')
 		{
@@ -393,7 +512,7 @@ bool Search::countSimilarity(const std::string &signPattern, Similarity &sim, st
 		else if(signPattern[sigIndex] == '/')
 		{
 			std::int64_t moveSize = 0;
-			const auto actShift = (parser.getNumberOfNibblesInByte() ? fileIndex % parser.getNumberOfNibblesInByte() : 0);
+			const auto actShift = (nibblesInByte ? fileIndex % nibblesInByte : 0);
 			const auto *jump = getRelativeJump(bytesFromNibbles(fileIndex), actShift, moveSize);
 			if(!jump)
 			{
@@ -413,7 +532,7 @@ bool Search::countSimilarity(const std::string &signPattern, Similarity &sim, st
 			}
 			continue;
 		}
-		else if(signPattern[sigIndex] == nibbles[fileIndex])
+		else if(signPattern[sigIndex] == getNibble(fileIndex))
 		{
 			++result.same;
 		}
@@ -551,11 +670,11 @@ bool Search::createSignature(std::string &pattern, std::size_t fileOffset, std::
 {
 	pattern.clear();
 
-	for(std::size_t i = 0, fileIndex = nibblesFromBytes(fileOffset), fileLen = nibbles.length(), nibbleSize = nibblesFromBytes(size);
+	for(std::size_t i = 0, fileIndex = nibblesFromBytes(fileOffset), fileLen = getNumberOfNibbles(), nibbleSize = nibblesFromBytes(size);
 		fileIndex < fileLen && i < nibbleSize; ++i, ++fileIndex)
 	{
 		std::int64_t moveSize = 0;
-		const auto actShift = (parser.getNumberOfNibblesInByte() ? fileIndex % parser.getNumberOfNibblesInByte() : 0);
+		const auto actShift = (nibblesInByte ? fileIndex % nibblesInByte : 0);
 		const auto *jump = getRelativeJump(bytesFromNibbles(fileIndex), actShift, moveSize);
 		if(jump)
 		{
@@ -564,7 +683,7 @@ bool Search::createSignature(std::string &pattern, std::size_t fileOffset, std::
 		}
 		else
 		{
-			pattern += nibbles[fileIndex];
+			pattern += getNibble(fileIndex);
 		}
 	}
 
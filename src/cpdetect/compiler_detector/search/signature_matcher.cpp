@@ -0,0 +1,287 @@
+/**
+ * @file src/cpdetect/compiler_detector/search/signature_matcher.cpp
+ * @brief Class for simultaneous search of several signatures.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <set>
+
+#include "retdec/cpdetect/compiler_detector/search/signature_matcher.h"
+
+namespace retdec {
+namespace cpdetect {
+
+namespace
+{
+
+/**
+ * Get value of nibble from signature
+ * @param c Character from signature
+ * @return Value of nibble or -1 if @a c does not represent one fixed nibble
+ *
+ * Only uppercase hexadecimal digits can match content of file. Everything else
+ * is treated as wildcard here, so that matcher never misses any candidate.
+ */
+int getNibbleValue(char c)
+{
+	if(c >= '0' && c <= '9')
+	{
+		return c - '0';
+	}
+	else if(c >= 'A' && c <= 'F')
+	{
+		return c - 'A' + 10;
+	}
+
+	return -1;
+}
+
+} // anonymous namespace
+
+/**
+ * Constructor
+ * @param signPatterns Signature patterns
+ */
+SignatureMatcher::SignatureMatcher(const std::vector<std::string> &signPatterns) : patterns(signPatterns)
+{
+	for(std::size_t i = 0, e = patterns.size(); i < e; ++i)
+	{
+		addPattern(i);
+	}
+
+	std::stable_sort(longAnchors.begin(), longAnchors.end(),
+		[] (const Anchor &a, const Anchor &b)
+		{
+			return a.key < b.key;
+		}
+	);
+
+	if(!noAnchors.empty())
+	{
+		return;
+	}
+
+	std::set<int> firstBytes;
+	for(const auto &anchor : longAnchors)
+	{
+		firstBytes.insert(anchor.key >> 8);
+	}
+	for(std::size_t i = 0, e = shortAnchors.size(); i < e; ++i)
+	{
+		if(!shortAnchors[i].empty())
+		{
+			firstBytes.insert(i);
+		}
+	}
+	if(firstBytes.size() == 1)
+	{
+		commonFirstByte = *firstBytes.begin();
+	}
+}
+
+/**
+ * Create anchors of one pattern
+ * @param index Index of pattern
+ */
+void SignatureMatcher::addPattern(std::size_t index)
+{
+	const auto &pattern = patterns[index];
+	const auto prefixLen = std::min(pattern.find_first_of("/;"), pattern.length());
+	std::vector<Anchor> anchors;
+
+	for(std::size_t shift = 0; shift < 2; ++shift)
+	{
+		std::vector<int> nibbles(shift, -1);
+		for(std::size_t i = 0; i < prefixLen; ++i)
+		{
+			nibbles.push_back(getNibbleValue(pattern[i]));
+		}
+
+		// find the longest run of fully specified bytes
+		std::size_t bestOffset = 0, bestLen = 0, actLen = 0;
+		for(std::size_t i = 0, e = nibbles.size() / 2; i < e; ++i)
+		{
+			if(nibbles[2 * i] < 0 || nibbles[2 * i + 1] < 0)
+			{
+				actLen = 0;
+				continue;
+			}
+
+			if(++actLen > bestLen)
+			{
+				bestLen = actLen;
+				bestOffset = i + 1 - actLen;
+			}
+		}
+
+		if(!bestLen)
+		{
+			// pattern without fixed byte must be verified on every nibble
+			noAnchors.push_back({index, 0, 0, 0});
+			return;
+		}
+
+		const auto byteAt = [&] (std::size_t i)
+		{
+			return static_cast<std::uint16_t>(nibbles[2 * i] << 4 | nibbles[2 * i + 1]);
+		};
+
+		auto key = byteAt(bestOffset);
+		if(bestLen >= 2)
+		{
+			key = static_cast<std::uint16_t>(key << 8 | byteAt(bestOffset + 1));
+		}
+		anchors.push_back({index, shift, bestOffset, key, bestLen >= 2});
+	}
+
+	for(const auto &anchor : anchors)
+	{
+		if(anchor.twoBytes)
+		{
+			longAnchors.push_back(anchor);
+			longKeys.set(anchor.key);
+		}
+		else
+		{
+			shortAnchors[anchor.key].push_back(anchor);
+		}
+
+		maxAnchorOffset = std::max(maxAnchorOffset, anchor.offset);
+	}
+}
+
+/**
+ * Get number of patterns
+ * @return Number of patterns
+ */
+std::size_t SignatureMatcher::getNumberOfPatterns() const
+{
+	return patterns.size();
+}
+
+/**
+ * Get selected pattern
+ * @param index Index of pattern (indexed from 0)
+ * @return Selected pattern
+ */
+const std::string& SignatureMatcher::getPattern(std::size_t index) const
+{
+	return patterns[index];
+}
+
+/**
+ * Search for all patterns in one pass over data
+ * @param data Searched data
+ * @param size Size of @a data in bytes
+ * @param nibblesInByte Number of nibbles in one byte of @a data
+ * @param startNibble Offset of first nibble on which pattern can start
+ * @param stopNibble Offset of nibble after the last one on which pattern can start
+ * @param verify Function which verifies candidates
+ * @return For each pattern @c true if @a verify accepted any of its candidates
+ *
+ * Candidates of each pattern are passed to @a verify until it accepts one of them.
+ */
+std::vector<bool> SignatureMatcher::search(
+		const std::uint8_t *data, std::size_t size, std::size_t nibblesInByte,
+		std::size_t startNibble, std::size_t stopNibble,
+		const Verifier &verify) const
+{
+	std::vector<bool> found(patterns.size(), false);
+	auto remaining = patterns.size();
+	if(!data || startNibble >= stopNibble || !remaining)
+	{
+		return found;
+	}
+
+	const auto verifyEverywhere = [&] (std::size_t pattern)
+	{
+		for(auto i = startNibble; i < stopNibble; ++i)
+		{
+			if(verify(pattern, i))
+			{
+				found[pattern] = true;
+				--remaining;
+				break;
+			}
+		}
+	};
+
+	if(nibblesInByte != 2)
+	{
+		for(std::size_t i = 0, e = patterns.size(); i < e; ++i)
+		{
+			verifyEverywhere(i);
+		}
+
+		return found;
+	}
+
+	for(const auto &anchor : noAnchors)
+	{
+		verifyEverywhere(anchor.pattern);
+	}
+
+	const auto tryCandidate = [&] (const Anchor &anchor, std::size_t pos)
+	{
+		if(found[anchor.pattern] || pos < anchor.offset)
+		{
+			return;
+		}
+
+		const auto nibble = 2 * (pos - anchor.offset) + anchor.shift;
+		if(nibble >= startNibble && nibble < stopNibble && verify(anchor.pattern, nibble))
+		{
+			found[anchor.pattern] = true;
+			--remaining;
+		}
+	};
+
+	const auto last = std::min(size, (stopNibble - 1) / 2 + maxAnchorOffset + 1);
+	for(auto pos = startNibble / 2; remaining && pos < last; ++pos)
+	{
+		if(commonFirstByte >= 0)
+		{
+			const auto *next = static_cast<const std::uint8_t*>(std::memchr(data + pos, commonFirstByte, last - pos));
+			if(!next)
+			{
+				break;
+			}
+			pos = next - data;
+		}
+
+		for(const auto &anchor : shortAnchors[data[pos]])
+		{
+			tryCandidate(anchor, pos);
+		}
+
+		if(pos + 1 >= size)
+		{
+			continue;
+		}
+
+		const std::uint16_t key = data[pos] << 8 | data[pos + 1];
+		if(!longKeys[key])
+		{
+			continue;
+		}
+
+		Anchor keyAnchor{0, 0, 0, key, true};
+		const auto range = std::equal_range(longAnchors.begin(), longAnchors.end(), keyAnchor,
+			[] (const Anchor &a, const Anchor &b)
+			{
+				return a.key < b.key;
+			}
+		);
+		for(auto it = range.first; it != range.second; ++it)
+		{
+			tryCandidate(*it, pos);
+		}
+	}
+
+	return found;
+}
+
+} // namespace cpdetect
+} // namespace retdec
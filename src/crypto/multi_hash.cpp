@@ -0,0 +1,145 @@
+/**
+* @file src/crypto/multi_hash.cpp
+* @brief Implementation of class MultiHashContext.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+
+#include "retdec/crypto/multi_hash.h"
+#include "retdec/utils/conversion.h"
+
+namespace retdec {
+namespace crypto {
+
+namespace {
+
+/**
+ * Size of chunks fed to digests. It should fit into L2 cache together with
+ * the internal states of all digests.
+ */
+constexpr std::size_t CHUNK_SIZE = 0x10000;
+
+} // anonymous namespace
+
+/**
+ * Constructor.
+ * @param digests Bitwise or of @c DigestFlags to compute.
+ */
+MultiHashContext::MultiHashContext(unsigned digests) : _digests(digests)
+{
+	const std::pair<unsigned, std::pair<const EVP_MD*, std::string*>> algos[] =
+	{
+		{ DIGEST_MD5,    { EVP_md5(),    &_result.md5    } },
+		{ DIGEST_SHA1,   { EVP_sha1(),   &_result.sha1   } },
+		{ DIGEST_SHA256, { EVP_sha256(), &_result.sha256 } }
+	};
+
+	for (const auto& algo : algos)
+	{
+		if (!(_digests & algo.first))
+			continue;
+
+		auto* ctx = EVP_MD_CTX_create();
+		_ok = _ok && ctx && EVP_DigestInit(ctx, algo.second.first) == 1;
+		_evp.push_back({algo.second.second, ctx});
+	}
+}
+
+/**
+ * Destructor.
+ */
+MultiHashContext::~MultiHashContext()
+{
+	for (auto& evp : _evp)
+	{
+		EVP_MD_CTX_destroy(evp.ctx);
+	}
+}
+
+/**
+ * Adds the new data to all requested digests.
+ *
+ * @param data Pointer to the start of data.
+ * @param size Size of data.
+ *
+ * @return @c true if success, otherwise @c false.
+ */
+bool MultiHashContext::addData(const std::uint8_t* data, std::size_t size)
+{
+	if (!_ok)
+		return false;
+
+	for (std::size_t offset = 0; offset < size; offset += CHUNK_SIZE)
+	{
+		const auto chunk = data + offset;
+		const auto chunkSize = std::min(CHUNK_SIZE, size - offset);
+
+		if (_digests & DIGEST_CRC32)
+			_crc32.add(chunk, chunkSize);
+
+		for (auto& evp : _evp)
+			_ok = _ok && EVP_DigestUpdate(evp.ctx, chunk, chunkSize) == 1;
+	}
+
+	return _ok;
+}
+
+/**
+ * Adds the new data to all requested digests.
+ *
+ * @param data Data to hash.
+ *
+ * @return @c true if success, otherwise @c false.
+ */
+bool MultiHashContext::addData(const std::vector<std::uint8_t>& data)
+{
+	return addData(data.data(), data.size());
+}
+
+/**
+ * Gets the final digests of all added data.
+ * The context must not be used after this call.
+ *
+ * @return Requested digests. All digests are empty in case of an error.
+ */
+Digests MultiHashContext::getDigests()
+{
+	if (!_ok)
+		return {};
+
+	if (_digests & DIGEST_CRC32)
+		_result.crc32 = _crc32.getHash();
+
+	for (auto& evp : _evp)
+	{
+		unsigned char hash[EVP_MAX_MD_SIZE];
+		unsigned int hashSize = 0;
+		if (EVP_DigestFinal(evp.ctx, hash, &hashSize) != 1)
+			return {};
+
+		retdec::utils::bytesToHexString(hash, hashSize, *evp.result, 0, 0, false);
+	}
+
+	return _result;
+}
+
+/**
+ * @brief Count several digests of @a data at once.
+ * @param[in] data Input data.
+ * @param[in] length Length of input data.
+ * @param[in] digests Bitwise or of @c DigestFlags to compute.
+ * @return Requested digests of input data. They are identical to the results
+ *    of @c getCrc32(), @c getMd5(), @c getSha1() and @c getSha256().
+ *
+ * The data are walked through only once (see @c MultiHashContext).
+ */
+Digests computeDigests(const unsigned char *data, std::uint64_t length, unsigned digests)
+{
+	MultiHashContext ctx(digests);
+	ctx.addData(data, length);
+	return ctx.getDigests();
+}
+
+} // namespace crypto
+} // namespace retdec
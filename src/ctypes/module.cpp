@@ -51,6 +51,32 @@ void Module::addFunction(const std::shared_ptr<Function> &function)
 	functions.emplace(function->getName(), function);
 }
 
+/**
+* @brief Returns an iterator to the first function (pair name-function).
+*
+* Functions are not ordered in any particular way.
+*/
+Module::const_function_iterator Module::function_begin() const
+{
+	return functions.begin();
+}
+
+/**
+* @brief Returns an iterator past the last function.
+*/
+Module::const_function_iterator Module::function_end() const
+{
+	return functions.end();
+}
+
+/**
+* @brief Returns the number of functions in module.
+*/
+Module::Functions::size_type Module::getFunctionCount() const
+{
+	return functions.size();
+}
+
 /*
 * @brief Returns container of type information used in module's functions.
 *
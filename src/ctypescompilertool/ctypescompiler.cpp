@@ -0,0 +1,88 @@
+/**
+ * @file src/ctypescompilertool/ctypescompiler.cpp
+ * @brief Compiles C-types in JSON into C-types databases.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "retdec/ctypes/exceptions.h"
+#include "retdec/ctypes/module.h"
+#include "retdec/ctypesparser/binary_ctypes_writer.h"
+#include "retdec/ctypesparser/json_ctypes_parser.h"
+
+/**
+ * @brief String constant containing help.
+ */
+const std::string helpmsg =
+	"C-types compiler.\n"
+	"\n"
+	"Compiles C-types in JSON into a database that can be mapped into memory\n"
+	"and read lazily (see BinaryCTypesParser).\n"
+	"\n"
+	"Usage:\n"
+	"\tretdec-ctypes-compiler -h | Show this help.\n"
+	"\tretdec-ctypes-compiler INPUT.json OUTPUT.ctdb | Compile INPUT.json into OUTPUT.ctdb.\n";
+
+int main(int argc, char *argv[])
+{
+	if (argc == 2
+			&& (std::strcmp(argv[1], "-h") == 0
+			|| std::strcmp(argv[1], "--help") == 0))
+	{
+		std::cout << helpmsg;
+		return 0;
+	}
+	else if (argc != 3)
+	{
+		std::cerr << helpmsg;
+		return 1;
+	}
+
+	std::ifstream input(argv[1]);
+	if (!input)
+	{
+		std::cerr << "Error: failed to open " << argv[1] << std::endl;
+		return 1;
+	}
+	// The stamp lets readers of the database detect that the JSON file has
+	// been changed after the database was compiled.
+	retdec::ctypesparser::binary_ctypes::SourceStamp source;
+	if (!retdec::ctypesparser::binary_ctypes::readSourceStamp(argv[1], source))
+	{
+		std::cerr << "Error: failed to stat " << argv[1] << std::endl;
+		return 1;
+	}
+
+	try
+	{
+		// Bit widths and call conventions that are not given in JSON are
+		// left unresolved (0 and empty), so they are resolved by the reader
+		// of the database according to the analysed binary.
+		retdec::ctypesparser::JSONCTypesParser parser(0);
+		auto module = parser.parse(input);
+
+		std::ofstream output(argv[2], std::ios::binary);
+		if (!output)
+		{
+			std::cerr << "Error: failed to create " << argv[2] << std::endl;
+			return 1;
+		}
+		retdec::ctypesparser::BinaryCTypesWriter writer;
+		writer.write(output, *module, source);
+		if (!output)
+		{
+			std::cerr << "Error: failed to write " << argv[2] << std::endl;
+			return 1;
+		}
+	}
+	catch (const retdec::ctypes::CTypesError &e)
+	{
+		std::cerr << "Error: " << argv[1] << ": " << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
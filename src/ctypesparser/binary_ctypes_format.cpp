@@ -0,0 +1,37 @@
+/**
+* @file src/ctypesparser/binary_ctypes_format.cpp
+* @brief Support for the binary format of C-types databases.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "retdec/ctypesparser/binary_ctypes_format.h"
+
+namespace retdec {
+namespace ctypesparser {
+namespace binary_ctypes {
+
+/**
+* @brief Reads the size and modification time of file @a path into @a stamp.
+*
+* @return @c true if the file exists and its stamp has been read, @c false
+*         otherwise.
+*/
+bool readSourceStamp(const std::string &path, SourceStamp &stamp)
+{
+	struct stat fileStat;
+	if (stat(path.c_str(), &fileStat) != 0)
+	{
+		return false;
+	}
+
+	stamp.size = static_cast<std::uint64_t>(fileStat.st_size);
+	stamp.modificationTime = static_cast<std::uint64_t>(fileStat.st_mtime);
+	return true;
+}
+
+} // namespace binary_ctypes
+} // namespace ctypesparser
+} // namespace retdec
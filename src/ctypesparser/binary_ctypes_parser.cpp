@@ -0,0 +1,626 @@
+/**
+* @file src/ctypesparser/binary_ctypes_parser.cpp
+* @brief Parser for C-types from databases created by @c BinaryCTypesWriter.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cassert>
+#include <cstring>
+#include <istream>
+#include <sstream>
+
+#include "retdec/ctypes/annotation_in.h"
+#include "retdec/ctypes/annotation_inout.h"
+#include "retdec/ctypes/annotation_optional.h"
+#include "retdec/ctypes/annotation_out.h"
+#include "retdec/ctypes/array_type.h"
+#include "retdec/ctypes/context.h"
+#include "retdec/ctypes/enum_type.h"
+#include "retdec/ctypes/floating_point_type.h"
+#include "retdec/ctypes/function.h"
+#include "retdec/ctypes/function_declaration.h"
+#include "retdec/ctypes/function_type.h"
+#include "retdec/ctypes/header_file.h"
+#include "retdec/ctypes/integral_type.h"
+#include "retdec/ctypes/member.h"
+#include "retdec/ctypes/module.h"
+#include "retdec/ctypes/parameter.h"
+#include "retdec/ctypes/pointer_type.h"
+#include "retdec/ctypes/struct_type.h"
+#include "retdec/ctypes/typedefed_type.h"
+#include "retdec/ctypes/union_type.h"
+#include "retdec/ctypes/unknown_type.h"
+#include "retdec/ctypes/void_type.h"
+#include "retdec/ctypesparser/binary_ctypes_format.h"
+#include "retdec/ctypesparser/binary_ctypes_parser.h"
+
+using namespace retdec::ctypesparser::binary_ctypes;
+
+namespace retdec {
+namespace ctypesparser {
+
+namespace {
+
+/**
+* @brief Sequential reader of a record in a database.
+*
+* All reads are bounds-checked, so a corrupted database results in an
+* exception instead of a crash.
+*/
+class RecordReader
+{
+	public:
+		RecordReader(const std::uint8_t *data, std::size_t size, std::size_t pos):
+			data(data), size(size), pos(pos) {}
+
+		std::uint8_t readU8()
+		{
+			check(1);
+			return data[pos++];
+		}
+
+		std::uint32_t readU32()
+		{
+			check(4);
+			std::uint32_t value = 0;
+			for (unsigned i = 0; i < sizeof(value); ++i)
+			{
+				value |= static_cast<std::uint32_t>(data[pos++]) << (8 * i);
+			}
+			return value;
+		}
+
+		std::uint64_t readU64()
+		{
+			check(8);
+			std::uint64_t value = 0;
+			for (unsigned i = 0; i < sizeof(value); ++i)
+			{
+				value |= static_cast<std::uint64_t>(data[pos++]) << (8 * i);
+			}
+			return value;
+		}
+
+		std::string readString()
+		{
+			auto length = readU32();
+			check(length);
+			std::string str(reinterpret_cast<const char *>(data + pos), length);
+			pos += length;
+			return str;
+		}
+
+		/**
+		* @brief Reads a string and checks if it is equal to @a str without
+		*        creating a copy of it.
+		*/
+		bool readStringAndCompare(const std::string &str)
+		{
+			auto length = readU32();
+			check(length);
+			bool equal = length == str.size()
+				&& std::memcmp(data + pos, str.data(), length) == 0;
+			pos += length;
+			return equal;
+		}
+
+	private:
+		void check(std::size_t count) const
+		{
+			if (pos > size || count > size - pos)
+			{
+				throw CTypesParseError("Corrupted C-types database.");
+			}
+		}
+
+	private:
+		const std::uint8_t *data;
+		std::size_t size;
+		std::size_t pos;
+};
+
+} // anonymous namespace
+
+/**
+* @brief Constructs a new parser.
+*/
+BinaryCTypesParser::BinaryCTypesParser() = default;
+
+/**
+* @brief Constructs a new parser.
+*
+* @param defaultBitWidth BitWidth used for types that are not in typeWidths
+*        and whose bit width is not stored in the database.
+*/
+BinaryCTypesParser::BinaryCTypesParser(unsigned defaultBitWidth):
+	CTypesParser(defaultBitWidth) {}
+
+/**
+* @brief Parses all C-types from a database.
+*
+* @param[in] stream Input stream containing the database.
+* @param[in] typeWidths C-types' bit widths.
+* @param[in] callConvention Function call convention.
+*
+* @return Module filled with C-types information.
+*
+* @throw CTypesParseError when the input database is invalid.
+*
+* Call convention is used when function itself does not specify its call
+* convention.
+*/
+std::unique_ptr<retdec::ctypes::Module> BinaryCTypesParser::parse(
+	std::istream &stream,
+	const CTypesParser::TypeWidths &typeWidths,
+	const retdec::ctypes::CallConvention &callConvention)
+{
+	auto module = std::make_unique<retdec::ctypes::Module>(context);
+	parseInto(stream, module, typeWidths, callConvention);
+	return module;
+}
+
+/**
+* @brief Parses all C-types from a database to user's module.
+*
+* @param[in] stream Input stream containing the database.
+* @param[in] module User's module.
+* @param[in] typeWidths C-types' bit widths.
+* @param[in] callConvention Function call convention.
+*
+* @throw CTypesParseError when the input database is invalid.
+*
+* Call convention is used when function itself does not specify its call
+* convention.
+*/
+void BinaryCTypesParser::parseInto(
+	std::istream &stream,
+	std::unique_ptr<retdec::ctypes::Module> &module,
+	const CTypesParser::TypeWidths &typeWidths,
+	const retdec::ctypes::CallConvention &callConvention)
+{
+	assert(module && "violated precondition - module cannot be null");
+
+	std::ostringstream sstr;
+	sstr << stream.rdbuf();
+	if (!stream.good())
+	{
+		throw CTypesParseError("Failed to read from the input stream.");
+	}
+
+	file.close();
+	buffer = sstr.str();
+	if (!setData(reinterpret_cast<const std::uint8_t *>(buffer.data()), buffer.size()))
+	{
+		throw CTypesParseError("Input is not a C-types database.");
+	}
+	setParams(module->getContext(), typeWidths, callConvention);
+
+	for (std::uint32_t i = 0; i < functionCount; ++i)
+	{
+		module->addFunction(parseFunction(i));
+	}
+}
+
+/**
+* @brief Maps database in file @a path into memory for lazy parsing by
+*        getFunction().
+*
+* @param[in] path Path to the database.
+* @param[in] context Context into which parsed functions and types are stored.
+* @param[in] typeWidths C-types' bit widths.
+* @param[in] callConvention Function call convention.
+*
+* @return @c true if the file has been opened and it is a C-types database,
+*         @c false otherwise.
+*
+* Only the header of the database is checked, so opening is O(1) regardless
+* of the size of the database.
+*/
+bool BinaryCTypesParser::open(
+	const std::string &path,
+	const std::shared_ptr<retdec::ctypes::Context> &context,
+	const CTypesParser::TypeWidths &typeWidths,
+	const retdec::ctypes::CallConvention &callConvention)
+{
+	assert(context && "violated precondition - context cannot be null");
+
+	buffer.clear();
+	if (!file.open(path) || !setData(file.getData(), file.getSize()))
+	{
+		file.close();
+		setData(nullptr, 0);
+		return false;
+	}
+	setParams(context, typeWidths, callConvention);
+	return true;
+}
+
+/**
+* @brief Checks if the opened database contains function @a name.
+*/
+bool BinaryCTypesParser::hasFunction(const std::string &name) const
+{
+	return findFunction(name) != 0;
+}
+
+/**
+* @brief Returns function @a name from the opened database.
+*
+* @return Requested function, or @c null if it is not in the database.
+*
+* @throw CTypesParseError when the database is corrupted.
+*
+* The function is parsed on first request. As in the other parsers, if
+* the context already contains a function with the same name, the stored
+* function is returned.
+*/
+std::shared_ptr<retdec::ctypes::Function> BinaryCTypesParser::getFunction(
+	const std::string &name)
+{
+	auto index = findFunction(name);
+	return index ? parseFunction(index - 1) : nullptr;
+}
+
+/**
+* @brief Returns the stamp of the file from which the opened database was
+*        compiled.
+*
+* The stamp is zero if it was not given to the writer of the database.
+*/
+const SourceStamp &BinaryCTypesParser::getSourceStamp() const
+{
+	return sourceStamp;
+}
+
+/**
+* @brief Sets database content and checks its header.
+*
+* @return @c true if the header is valid, @c false otherwise.
+*/
+bool BinaryCTypesParser::setData(const std::uint8_t *data, std::size_t size)
+{
+	this->data = data;
+	this->size = size;
+	functionCount = typeCount = bucketCount = 0;
+	sourceStamp = SourceStamp();
+	types.clear();
+	typesInProgress.clear();
+
+	if (data == nullptr
+			|| size < HEADER_SIZE
+			|| std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0)
+	{
+		return false;
+	}
+
+	RecordReader reader(data, size, sizeof(MAGIC));
+	if (reader.readU32() != VERSION)
+	{
+		return false;
+	}
+	auto fncCount = reader.readU32();
+	auto tCount = reader.readU32();
+	auto bCount = reader.readU32();
+	SourceStamp source;
+	source.size = reader.readU64();
+	source.modificationTime = reader.readU64();
+	std::uint64_t tablesSize = 4 * (std::uint64_t(fncCount) + tCount + bCount);
+	if (bCount == 0
+			|| (bCount & (bCount - 1)) != 0
+			|| bCount < fncCount
+			|| tablesSize > size - HEADER_SIZE)
+	{
+		return false;
+	}
+
+	functionCount = fncCount;
+	typeCount = tCount;
+	bucketCount = bCount;
+	sourceStamp = source;
+	types.resize(typeCount);
+	typesInProgress.resize(typeCount);
+	return true;
+}
+
+void BinaryCTypesParser::setParams(
+	const std::shared_ptr<retdec::ctypes::Context> &context,
+	const CTypesParser::TypeWidths &typeWidths,
+	const retdec::ctypes::CallConvention &callConvention)
+{
+	this->context = context;
+	this->typeWidths = typeWidths;
+	defaultCallConv = callConvention;
+}
+
+/**
+* @brief Finds function @a name in the hash table of the database.
+*
+* @return Index of the function plus one, or @c 0 if it is not there.
+*/
+std::uint32_t BinaryCTypesParser::findFunction(const std::string &name) const
+{
+	if (bucketCount == 0)
+	{
+		return 0;
+	}
+
+	auto mask = bucketCount - 1;
+	auto b = hashName(name.data(), name.size()) & mask;
+	for (std::uint32_t probes = 0; probes < bucketCount; ++probes)
+	{
+		RecordReader bucket(data, size, HEADER_SIZE + 4 * std::size_t(b));
+		auto entry = bucket.readU32();
+		if (entry == 0)
+		{
+			return 0;
+		}
+		if (entry > functionCount)
+		{
+			throw CTypesParseError("Corrupted C-types database.");
+		}
+
+		RecordReader function(data, size, getFunctionOffset(entry - 1));
+		if (function.readStringAndCompare(name))
+		{
+			return entry;
+		}
+		b = (b + 1) & mask;
+	}
+	return 0;
+}
+
+std::uint32_t BinaryCTypesParser::getFunctionOffset(std::uint32_t index) const
+{
+	auto tableOffset = HEADER_SIZE + 4 * std::size_t(bucketCount);
+	return RecordReader(data, size, tableOffset + 4 * std::size_t(index)).readU32();
+}
+
+std::uint32_t BinaryCTypesParser::getTypeOffset(std::uint32_t index) const
+{
+	auto tableOffset = HEADER_SIZE
+		+ 4 * (std::size_t(bucketCount) + functionCount);
+	return RecordReader(data, size, tableOffset + 4 * std::size_t(index)).readU32();
+}
+
+/**
+* @brief Parses function with index @a index.
+*/
+std::shared_ptr<retdec::ctypes::Function> BinaryCTypesParser::parseFunction(
+	std::uint32_t index)
+{
+	RecordReader reader(data, size, getFunctionOffset(index));
+	auto name = reader.readString();
+	auto cachedFunc = context->getFunctionWithName(name);
+	if (cachedFunc)
+	{
+		return cachedFunc;
+	}
+
+	auto returnType = getOrParseType(reader.readU32());
+	auto callConv = parseCallConv(reader.readString());
+	auto varArgness = reader.readU8() ?
+		retdec::ctypes::FunctionType::VarArgness::IsVarArg :
+		retdec::ctypes::FunctionType::VarArgness::IsNotVarArg;
+	auto decl = reader.readString();
+	auto header = reader.readString();
+
+	retdec::ctypes::Function::Parameters parameters;
+	auto paramCount = reader.readU32();
+	for (std::uint32_t i = 0; i < paramCount; ++i)
+	{
+		auto paramName = reader.readString();
+		auto paramType = getOrParseType(reader.readU32());
+
+		retdec::ctypes::Parameter::Annotations annots;
+		auto annotCount = reader.readU8();
+		for (unsigned j = 0; j < annotCount; ++j)
+		{
+			auto kind = static_cast<AnnotationKind>(reader.readU8());
+			auto annotName = reader.readString();
+			switch (kind)
+			{
+				case AnnotationKind::In:
+					annots.insert(retdec::ctypes::AnnotationIn::create(context, annotName));
+					break;
+				case AnnotationKind::InOut:
+					annots.insert(retdec::ctypes::AnnotationInOut::create(context, annotName));
+					break;
+				case AnnotationKind::Optional:
+					annots.insert(retdec::ctypes::AnnotationOptional::create(context, annotName));
+					break;
+				case AnnotationKind::Out:
+					annots.insert(retdec::ctypes::AnnotationOut::create(context, annotName));
+					break;
+				default:
+					throw CTypesParseError("Corrupted C-types database.");
+			}
+		}
+		parameters.emplace_back(paramName, paramType, annots);
+	}
+
+	auto newFunction = retdec::ctypes::Function::create(
+		context, name, returnType, parameters, callConv, varArgness);
+	newFunction->setDeclaration(retdec::ctypes::FunctionDeclaration(decl));
+	newFunction->setHeaderFile(retdec::ctypes::HeaderFile(header));
+	return newFunction;
+}
+
+/**
+* @brief Returns already parsed type with index @a index, or parses it.
+*/
+std::shared_ptr<retdec::ctypes::Type> BinaryCTypesParser::getOrParseType(
+	std::uint32_t index)
+{
+	if (index >= typeCount)
+	{
+		throw CTypesParseError("Corrupted C-types database.");
+	}
+	if (types[index])
+	{
+		return types[index];
+	}
+	if (typesInProgress[index])
+	{
+		// Only composite types may be recursive and those are stored into
+		// types before their members are parsed.
+		throw CTypesParseError("Corrupted C-types database.");
+	}
+
+	typesInProgress[index] = true;
+	auto type = parseType(index);
+	typesInProgress[index] = false;
+	types[index] = type;
+	return type;
+}
+
+/**
+* @brief Parses type with index @a index.
+*
+* Named types are taken from the context if they are already there, like in
+* @c JSONCTypesParser.
+*/
+std::shared_ptr<retdec::ctypes::Type> BinaryCTypesParser::parseType(
+	std::uint32_t index)
+{
+	RecordReader reader(data, size, getTypeOffset(index));
+	auto kind = static_cast<TypeKind>(reader.readU8());
+	switch (kind)
+	{
+		case TypeKind::Array:
+		{
+			auto elementType = getOrParseType(reader.readU32());
+			retdec::ctypes::ArrayType::Dimensions dimensions;
+			auto dimCount = reader.readU32();
+			for (std::uint32_t i = 0; i < dimCount; ++i)
+			{
+				dimensions.push_back(
+					static_cast<retdec::ctypes::ArrayType::DimensionType>(reader.readU64()));
+			}
+			return retdec::ctypes::ArrayType::create(context, elementType, dimensions);
+		}
+		case TypeKind::Enum:
+		{
+			auto name = reader.readString();
+			if (auto cachedType = context->getNamedType(name))
+			{
+				return cachedType;
+			}
+			retdec::ctypes::EnumType::Values values;
+			auto valueCount = reader.readU32();
+			for (std::uint32_t i = 0; i < valueCount; ++i)
+			{
+				auto valueName = reader.readString();
+				auto value = static_cast<std::int64_t>(reader.readU64());
+				values.emplace_back(valueName, value);
+			}
+			return retdec::ctypes::EnumType::create(context, name, values);
+		}
+		case TypeKind::FloatingPoint:
+		{
+			auto name = reader.readString();
+			if (auto cachedType = context->getNamedType(name))
+			{
+				return cachedType;
+			}
+			auto bitWidth = reader.readU32();
+			return retdec::ctypes::FloatingPointType::create(context, name,
+				bitWidth ? bitWidth : getBitWidthOrDefault(name));
+		}
+		case TypeKind::Function:
+		{
+			auto returnType = getOrParseType(reader.readU32());
+			retdec::ctypes::FunctionType::Parameters params;
+			auto paramCount = reader.readU32();
+			for (std::uint32_t i = 0; i < paramCount; ++i)
+			{
+				params.push_back(getOrParseType(reader.readU32()));
+			}
+			auto callConv = parseCallConv(reader.readString());
+			auto varArgness = reader.readU8() ?
+				retdec::ctypes::FunctionType::VarArgness::IsVarArg :
+				retdec::ctypes::FunctionType::VarArgness::IsNotVarArg;
+			return retdec::ctypes::FunctionType::create(
+				context, returnType, params, callConv, varArgness);
+		}
+		case TypeKind::Integral:
+		{
+			auto name = reader.readString();
+			if (auto cachedType = context->getNamedType(name))
+			{
+				return cachedType;
+			}
+			auto bitWidth = reader.readU32();
+			auto sign = reader.readU8() ?
+				retdec::ctypes::IntegralType::Signess::Unsigned :
+				retdec::ctypes::IntegralType::Signess::Signed;
+			return retdec::ctypes::IntegralType::create(context, name,
+				bitWidth ? bitWidth : getIntegralTypeBitWidth(name), sign);
+		}
+		case TypeKind::Pointer:
+		{
+			auto pointedType = getOrParseType(reader.readU32());
+			auto bitWidth = reader.readU32();
+			return retdec::ctypes::PointerType::create(context, pointedType,
+				bitWidth ? bitWidth : getBitWidthOrDefault("*"));
+		}
+		case TypeKind::Struct:
+		case TypeKind::Union:
+		{
+			auto name = reader.readString();
+			if (auto cachedType = context->getNamedType(name))
+			{
+				return cachedType;
+			}
+
+			// Like a forward declaration, so members may refer to the type.
+			std::shared_ptr<retdec::ctypes::CompositeType> newType;
+			if (kind == TypeKind::Struct)
+			{
+				newType = retdec::ctypes::StructType::create(context, name, {});
+			}
+			else
+			{
+				newType = retdec::ctypes::UnionType::create(context, name, {});
+			}
+			types[index] = newType;
+
+			retdec::ctypes::CompositeType::Members members;
+			auto memberCount = reader.readU32();
+			for (std::uint32_t i = 0; i < memberCount; ++i)
+			{
+				auto memberName = reader.readString();
+				members.emplace_back(memberName, getOrParseType(reader.readU32()));
+			}
+			newType->setMembers(members);
+			return newType;
+		}
+		case TypeKind::Typedef:
+		{
+			auto name = reader.readString();
+			if (auto cachedType = context->getNamedType(name))
+			{
+				return cachedType;
+			}
+			auto aliasedType = getOrParseType(reader.readU32());
+			return retdec::ctypes::TypedefedType::create(context, name, aliasedType);
+		}
+		case TypeKind::Unknown:
+			return retdec::ctypes::UnknownType::create();
+		case TypeKind::Void:
+			return retdec::ctypes::VoidType::create();
+		default:
+			throw CTypesParseError("Corrupted C-types database.");
+	}
+}
+
+/**
+* @brief Returns @a callConv, or the default call convention if it is empty.
+*/
+retdec::ctypes::CallConvention BinaryCTypesParser::parseCallConv(
+	const std::string &callConv) const
+{
+	return callConv.empty() ? defaultCallConv : retdec::ctypes::CallConvention(callConv);
+}
+
+} // namespace ctypesparser
+} // namespace retdec
@@ -0,0 +1,432 @@
+/**
+* @file src/ctypesparser/binary_ctypes_writer.cpp
+* @brief Writer of C-types databases.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <limits>
+
+#include "retdec/ctypes/annotation.h"
+#include "retdec/ctypes/array_type.h"
+#include "retdec/ctypes/enum_type.h"
+#include "retdec/ctypes/exceptions.h"
+#include "retdec/ctypes/floating_point_type.h"
+#include "retdec/ctypes/function.h"
+#include "retdec/ctypes/function_type.h"
+#include "retdec/ctypes/integral_type.h"
+#include "retdec/ctypes/member.h"
+#include "retdec/ctypes/module.h"
+#include "retdec/ctypes/parameter.h"
+#include "retdec/ctypes/pointer_type.h"
+#include "retdec/ctypes/struct_type.h"
+#include "retdec/ctypes/typedefed_type.h"
+#include "retdec/ctypes/union_type.h"
+#include "retdec/ctypes/unknown_type.h"
+#include "retdec/ctypes/void_type.h"
+#include "retdec/ctypesparser/binary_ctypes_format.h"
+#include "retdec/ctypesparser/binary_ctypes_writer.h"
+
+using namespace retdec::ctypesparser::binary_ctypes;
+
+namespace retdec {
+namespace ctypesparser {
+
+namespace {
+
+void appendU8(std::string &out, std::uint8_t value)
+{
+	out.push_back(static_cast<char>(value));
+}
+
+void appendU32(std::string &out, std::uint32_t value)
+{
+	for (unsigned i = 0; i < sizeof(value); ++i)
+	{
+		out.push_back(static_cast<char>(value >> (8 * i)));
+	}
+}
+
+void appendU64(std::string &out, std::uint64_t value)
+{
+	for (unsigned i = 0; i < sizeof(value); ++i)
+	{
+		out.push_back(static_cast<char>(value >> (8 * i)));
+	}
+}
+
+std::uint32_t checkedU32(std::size_t value)
+{
+	if (value > std::numeric_limits<std::uint32_t>::max())
+	{
+		throw retdec::ctypes::CTypesError("C-types database is too large.");
+	}
+	return static_cast<std::uint32_t>(value);
+}
+
+void appendString(std::string &out, const std::string &str)
+{
+	appendU32(out, checkedU32(str.size()));
+	out.append(str);
+}
+
+void appendKind(std::string &out, TypeKind kind)
+{
+	appendU8(out, static_cast<std::uint8_t>(kind));
+}
+
+AnnotationKind getAnnotationKind(const retdec::ctypes::Annotation &annot)
+{
+	if (annot.isInOut())
+	{
+		return AnnotationKind::InOut;
+	}
+	else if (annot.isOut())
+	{
+		return AnnotationKind::Out;
+	}
+	else if (annot.isIn())
+	{
+		return AnnotationKind::In;
+	}
+	return AnnotationKind::Optional;
+}
+
+} // anonymous namespace
+
+/**
+* @brief Constructs a new writer.
+*/
+BinaryCTypesWriter::BinaryCTypesWriter() = default;
+
+/**
+* @brief Destructs the writer.
+*/
+BinaryCTypesWriter::~BinaryCTypesWriter() = default;
+
+/**
+* @brief Writes all functions from @a module (and all types they use) into
+*        @a stream.
+*
+* @param[out] stream Stream into which the database is written.
+* @param[in] module Module to be written.
+* @param[in] source Stamp of the file from which @a module was parsed.
+*
+* Functions are written in the order of their names, so the same module always
+* produces the same database.
+*/
+void BinaryCTypesWriter::write(
+	std::ostream &stream,
+	const retdec::ctypes::Module &module,
+	const SourceStamp &source)
+{
+	typeIndexes.clear();
+	typeRecords.clear();
+
+	std::vector<const retdec::ctypes::Function *> functions;
+	functions.reserve(module.getFunctionCount());
+	for (auto i = module.function_begin(), e = module.function_end(); i != e; ++i)
+	{
+		functions.push_back(i->second.get());
+	}
+	std::sort(functions.begin(), functions.end(),
+		[](const auto *f1, const auto *f2)
+		{
+			return f1->getName() < f2->getName();
+		}
+	);
+
+	std::vector<std::string> functionRecords;
+	functionRecords.reserve(functions.size());
+	for (const auto *function: functions)
+	{
+		functionRecords.push_back(writeFunction(*function));
+	}
+
+	// Hash table with at most 50 % load, so lookups rarely need more than one
+	// probe.
+	std::uint32_t bucketCount = 1;
+	while (bucketCount < 2 * functions.size())
+	{
+		bucketCount *= 2;
+	}
+	std::vector<std::uint32_t> buckets(bucketCount, 0);
+	for (std::size_t i = 0; i < functions.size(); ++i)
+	{
+		const auto &name = functions[i]->getName();
+		auto b = hashName(name.data(), name.size()) & (bucketCount - 1);
+		while (buckets[b] != 0)
+		{
+			b = (b + 1) & (bucketCount - 1);
+		}
+		buckets[b] = checkedU32(i + 1);
+	}
+
+	std::string header(MAGIC, sizeof(MAGIC));
+	appendU32(header, VERSION);
+	appendU32(header, checkedU32(functionRecords.size()));
+	appendU32(header, checkedU32(typeRecords.size()));
+	appendU32(header, bucketCount);
+	appendU64(header, source.size);
+	appendU64(header, source.modificationTime);
+	for (auto b: buckets)
+	{
+		appendU32(header, b);
+	}
+
+	std::size_t offset = header.size()
+		+ 4 * (functionRecords.size() + typeRecords.size());
+	for (const auto &record: functionRecords)
+	{
+		appendU32(header, checkedU32(offset));
+		offset += record.size();
+	}
+	for (const auto &record: typeRecords)
+	{
+		appendU32(header, checkedU32(offset));
+		offset += record.size();
+	}
+
+	stream.write(header.data(), header.size());
+	for (const auto &record: functionRecords)
+	{
+		stream.write(record.data(), record.size());
+	}
+	for (const auto &record: typeRecords)
+	{
+		stream.write(record.data(), record.size());
+	}
+}
+
+/**
+* @brief Returns a record of @a function.
+*/
+std::string BinaryCTypesWriter::writeFunction(
+	const retdec::ctypes::Function &function)
+{
+	std::string record;
+	appendString(record, function.getName());
+	appendU32(record, getTypeIndex(function.getReturnType()));
+	appendString(record, function.getCallConvention());
+	appendU8(record, function.isVarArg());
+	appendString(record, function.getDeclaration());
+	appendString(record, function.getHeaderFile().getPath());
+
+	appendU32(record, checkedU32(function.getParameterCount()));
+	for (auto i = function.parameter_begin(), e = function.parameter_end();
+			i != e; ++i)
+	{
+		appendString(record, i->getName());
+		appendU32(record, getTypeIndex(i->getType()));
+
+		std::vector<const retdec::ctypes::Annotation *> annots;
+		for (auto a = i->annotation_begin(), ae = i->annotation_end(); a != ae; ++a)
+		{
+			annots.push_back(a->get());
+		}
+		// Annotations are stored in a set ordered by addresses.
+		std::sort(annots.begin(), annots.end(),
+			[](const auto *a1, const auto *a2)
+			{
+				return a1->getName() < a2->getName()
+					|| (a1->getName() == a2->getName()
+						&& getAnnotationKind(*a1) < getAnnotationKind(*a2));
+			}
+		);
+		appendU8(record, static_cast<std::uint8_t>(annots.size()));
+		for (const auto *annot: annots)
+		{
+			appendU8(record, static_cast<std::uint8_t>(getAnnotationKind(*annot)));
+			appendString(record, annot->getName());
+		}
+	}
+	return record;
+}
+
+/**
+* @brief Returns an index of @a type in the database.
+*
+* Types that have not been written yet are written first. The index is
+* assigned before the type is visited, so recursive types (e.g. a struct
+* containing a pointer to itself) are written only once.
+*/
+std::uint32_t BinaryCTypesWriter::getTypeIndex(
+	const std::shared_ptr<retdec::ctypes::Type> &type)
+{
+	auto it = typeIndexes.find(type.get());
+	if (it != typeIndexes.end())
+	{
+		return it->second;
+	}
+
+	auto index = checkedU32(typeRecords.size());
+	typeIndexes.emplace(type.get(), index);
+	typeRecords.emplace_back();
+	type->accept(this);
+	return index;
+}
+
+/**
+* @brief Writes @c u32(elementType) @c u32(dimensionCount) @c u64(dimension)*.
+*/
+void BinaryCTypesWriter::visit(
+	const std::shared_ptr<retdec::ctypes::ArrayType> &type)
+{
+	std::string record;
+	appendKind(record, TypeKind::Array);
+	appendU32(record, getTypeIndex(type->getElementType()));
+	appendU32(record, checkedU32(type->getDimensionCount()));
+	for (auto d: type->getDimensions())
+	{
+		appendU64(record, d);
+	}
+	typeRecords[typeIndexes[type.get()]] = std::move(record);
+}
+
+/**
+* @brief Writes @c string(name) @c u32(valueCount)
+*        (@c string(valueName) @c i64(value))*.
+*/
+void BinaryCTypesWriter::visit(
+	const std::shared_ptr<retdec::ctypes::EnumType> &type)
+{
+	std::string record;
+	appendKind(record, TypeKind::Enum);
+	appendString(record, type->getName());
+	appendU32(record, checkedU32(type->getValueCount()));
+	for (auto i = type->value_begin(), e = type->value_end(); i != e; ++i)
+	{
+		appendString(record, i->getName());
+		appendU64(record, static_cast<std::uint64_t>(i->getValue()));
+	}
+	typeRecords[typeIndexes[type.get()]] = std::move(record);
+}
+
+/**
+* @brief Writes @c string(name) @c u32(bitWidth).
+*/
+void BinaryCTypesWriter::visit(
+	const std::shared_ptr<retdec::ctypes::FloatingPointType> &type)
+{
+	std::string record;
+	appendKind(record, TypeKind::FloatingPoint);
+	appendString(record, type->getName());
+	appendU32(record, type->getBitWidth());
+	typeRecords[typeIndexes[type.get()]] = std::move(record);
+}
+
+/**
+* @brief Writes @c u32(returnType) @c u32(paramCount) @c u32(paramType)*
+*        @c string(callConv) @c u8(varArg).
+*/
+void BinaryCTypesWriter::visit(
+	const std::shared_ptr<retdec::ctypes::FunctionType> &type)
+{
+	std::string record;
+	appendKind(record, TypeKind::Function);
+	appendU32(record, getTypeIndex(type->getReturnType()));
+	appendU32(record, checkedU32(type->getParameterCount()));
+	for (const auto &param: type->getParameters())
+	{
+		appendU32(record, getTypeIndex(param));
+	}
+	appendString(record, type->getCallConvention());
+	appendU8(record, type->isVarArg());
+	typeRecords[typeIndexes[type.get()]] = std::move(record);
+}
+
+/**
+* @brief Writes @c string(name) @c u32(bitWidth) @c u8(isUnsigned).
+*/
+void BinaryCTypesWriter::visit(
+	const std::shared_ptr<retdec::ctypes::IntegralType> &type)
+{
+	std::string record;
+	appendKind(record, TypeKind::Integral);
+	appendString(record, type->getName());
+	appendU32(record, type->getBitWidth());
+	appendU8(record, type->isUnsigned());
+	typeRecords[typeIndexes[type.get()]] = std::move(record);
+}
+
+/**
+* @brief Writes @c u32(pointedType) @c u32(bitWidth).
+*/
+void BinaryCTypesWriter::visit(
+	const std::shared_ptr<retdec::ctypes::PointerType> &type)
+{
+	std::string record;
+	appendKind(record, TypeKind::Pointer);
+	appendU32(record, getTypeIndex(type->getPointedType()));
+	appendU32(record, type->getBitWidth());
+	typeRecords[typeIndexes[type.get()]] = std::move(record);
+}
+
+/**
+* @brief Writes @c string(name) @c u32(memberCount)
+*        (@c string(memberName) @c u32(memberType))*.
+*/
+void BinaryCTypesWriter::visit(
+	const std::shared_ptr<retdec::ctypes::StructType> &type)
+{
+	std::string record;
+	appendKind(record, TypeKind::Struct);
+	appendString(record, type->getName());
+	appendU32(record, checkedU32(type->getMemberCount()));
+	for (auto i = type->member_begin(), e = type->member_end(); i != e; ++i)
+	{
+		appendString(record, i->getName());
+		appendU32(record, getTypeIndex(i->getType()));
+	}
+	typeRecords[typeIndexes[type.get()]] = std::move(record);
+}
+
+/**
+* @brief Writes @c string(name) @c u32(aliasedType).
+*/
+void BinaryCTypesWriter::visit(
+	const std::shared_ptr<retdec::ctypes::TypedefedType> &type)
+{
+	std::string record;
+	appendKind(record, TypeKind::Typedef);
+	appendString(record, type->getName());
+	appendU32(record, getTypeIndex(type->getAliasedType()));
+	typeRecords[typeIndexes[type.get()]] = std::move(record);
+}
+
+/**
+* @brief Writes the same record as for struct types.
+*/
+void BinaryCTypesWriter::visit(
+	const std::shared_ptr<retdec::ctypes::UnionType> &type)
+{
+	std::string record;
+	appendKind(record, TypeKind::Union);
+	appendString(record, type->getName());
+	appendU32(record, checkedU32(type->getMemberCount()));
+	for (auto i = type->member_begin(), e = type->member_end(); i != e; ++i)
+	{
+		appendString(record, i->getName());
+		appendU32(record, getTypeIndex(i->getType()));
+	}
+	typeRecords[typeIndexes[type.get()]] = std::move(record);
+}
+
+void BinaryCTypesWriter::visit(
+	const std::shared_ptr<retdec::ctypes::UnknownType> &type)
+{
+	std::string record;
+	appendKind(record, TypeKind::Unknown);
+	typeRecords[typeIndexes[type.get()]] = std::move(record);
+}
+
+void BinaryCTypesWriter::visit(
+	const std::shared_ptr<retdec::ctypes::VoidType> &type)
+{
+	std::string record;
+	appendKind(record, TypeKind::Void);
+	typeRecords[typeIndexes[type.get()]] = std::move(record);
+}
+
+} // namespace ctypesparser
+} // namespace retdec
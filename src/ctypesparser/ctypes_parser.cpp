@@ -4,8 +4,11 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <regex>
+
 #include "retdec/ctypes/context.h"
 #include "retdec/ctypesparser/ctypes_parser.h"
+#include "retdec/utils/container.h"
 
 namespace retdec {
 namespace ctypesparser {
@@ -25,5 +28,64 @@ CTypesParser::CTypesParser(unsigned defaultBitWidth):
 	context(std::make_shared<retdec::ctypes::Context>()),
 	defaultBitWidth(defaultBitWidth) {}
 
+/**
+* @brief Returns bit width stored in @c typeWidths for integral type.
+*
+* Returns default bit width if not found.
+*/
+unsigned CTypesParser::getIntegralTypeBitWidth(const std::string &type) const
+{
+	std::string toSearch;
+
+	static const std::regex reChar("\\bchar\\b");
+	static const std::regex reShort("\\bshort\\b");
+	static const std::regex reLongLong("\\blong long\\b");
+	static const std::regex reLong("\\blong\\b");
+	static const std::regex reInt("\\bint\\b");
+	static const std::regex reUnSigned("^(un)?signed$");
+
+	// Ignore type's sign, use only core info about bit width to search in map
+	// - smaller map.
+	// Order of getting core type is important - int should be last - short int
+	// should be treated as short, same long. Long long differs from long.
+	if (std::regex_search(type, reChar))
+	{
+		toSearch = "char";
+	}
+	else if (std::regex_search(type, reShort))
+	{
+		toSearch = "short";
+	}
+	else if (std::regex_search(type, reLongLong))
+	{
+		toSearch = "long long";
+	}
+	else if (std::regex_search(type, reLong))
+	{
+		toSearch = "long";
+	}
+	else if (std::regex_search(type, reInt))
+	{
+		toSearch = "int";
+	}
+	else if (std::regex_search(type, reUnSigned))
+	{
+		toSearch = "int";
+	}
+	else
+	{
+		toSearch = type;
+	}
+	return getBitWidthOrDefault(toSearch);
+}
+
+/**
+* @brief Returns bit width stored in @c typeWidths for type, default if not found.
+*/
+unsigned CTypesParser::getBitWidthOrDefault(const std::string &typeName) const
+{
+	return retdec::utils::mapGetValueOrDefault(typeWidths, typeName, defaultBitWidth);
+}
+
 } // namespace ctypesparser
 } // namespace retdec
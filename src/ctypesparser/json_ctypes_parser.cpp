@@ -6,7 +6,6 @@
 
 #include <cassert>
 #include <istream>
-#include <regex>
 #include <sstream>
 
 #include <rapidjson/error/en.h>
@@ -627,65 +626,6 @@ std::shared_ptr<retdec::ctypes::Type> JSONCTypesParser::parseFloatingPointType(
 	);
 }
 
-/**
-* @brief Returns bit width stored in @c typeWidths for integral type.
-*
-* Returns default bit width if not found.
-*/
-unsigned JSONCTypesParser::getIntegralTypeBitWidth(const std::string &type) const
-{
-	std::string toSearch;
-
-	static const std::regex reChar("\\bchar\\b");
-	static const std::regex reShort("\\bshort\\b");
-	static const std::regex reLongLong("\\blong long\\b");
-	static const std::regex reLong("\\blong\\b");
-	static const std::regex reInt("\\bint\\b");
-	static const std::regex reUnSigned("^(un)?signed$");
-
-	// Ignore type's sign, use only core info about bit width to search in map
-	// - smaller map.
-	// Order of getting core type is important - int should be last - short int
-	// should be treated as short, same long. Long long differs from long.
-	if (std::regex_search(type, reChar))
-	{
-		toSearch = "char";
-	}
-	else if (std::regex_search(type, reShort))
-	{
-		toSearch = "short";
-	}
-	else if (std::regex_search(type, reLongLong))
-	{
-		toSearch = "long long";
-	}
-	else if (std::regex_search(type, reLong))
-	{
-		toSearch = "long";
-	}
-	else if (std::regex_search(type, reInt))
-	{
-		toSearch = "int";
-	}
-	else if (std::regex_search(type, reUnSigned))
-	{
-		toSearch = "int";
-	}
-	else
-	{
-		toSearch = type;
-	}
-	return getBitWidthOrDefault(toSearch);
-}
-
-/**
-* @brief Returns bit width stored in @c typeWidths for type, default if not found.
-*/
-unsigned JSONCTypesParser::getBitWidthOrDefault(const std::string &typeName) const
-{
-	return retdec::utils::mapGetValueOrDefault(typeWidths, typeName, defaultBitWidth);
-}
-
 /**
 * @brief Parses typedef from JSON representation.
 *
@@ -26,53 +26,126 @@ DebugFormat::DebugFormat()
  * @param symtab    Symbol table.
  * @param demangler Demangled instance used for this input file.
  * @param imageBase Image base used in PDB initialization.
+ * @param threadPool Threads to load all DWARF compilation units by
+ *                   (@c nullptr to load them serially).
  */
 DebugFormat::DebugFormat(
 		retdec::loader::Image* inFile,
 		const std::string& pdbFile,
 		SymbolTable* symtab,
 		retdec::demangler::CDemangler* demangler,
-		unsigned long long imageBase)
+		unsigned long long imageBase,
+		retdec::utils::ThreadPool* threadPool)
 		:
 		_symtab(symtab),
 		_inFile(inFile),
-		_demangler(demangler)
+		_demangler(demangler),
+		_threadPool(threadPool)
 {
 	_pdbFile = new retdec::pdbparser::PDBFile();
 	auto s = _pdbFile->load_pdb_file(pdbFile.c_str());
-	_dwarfFile = new retdec::dwarfparser::DwarfFile(_inFile->getFileFormat()->getPathToFile(), _inFile->getFileFormat());
 
 	if (s == retdec::pdbparser::PDB_STATE_OK)
 	{
 		LOG << "\n*** DebugFormat::DebugFormat(): PDB" << std::endl;
+		// Only the DBI stream is parsed here. Types and symbols are
+		// loaded when they are first requested.
 		_pdbFile->initialize(imageBase);
-		loadPdb();
 	}
-	else if (_dwarfFile->hasDwarfInfo())
+	else
 	{
-		LOG << "\n*** DebugFormat::DebugFormat(): DWARF" << std::endl;
-		loadDwarf();
+		delete _pdbFile;
+		_pdbFile = nullptr;
+
+		// Only compilation units are indexed here. Their contents are loaded
+		// when a function or a variable in them is requested, or when all
+		// functions, variables or types are requested.
+		_dwarfFile = new retdec::dwarfparser::DwarfFile(_inFile->getFileFormat()->getPathToFile(), _inFile->getFileFormat(), true);
+		if (_dwarfFile->hasDwarfInfo())
+		{
+			LOG << "\n*** DebugFormat::DebugFormat(): DWARF" << std::endl;
+		}
+		else
+		{
+			delete _dwarfFile;
+			_dwarfFile = nullptr;
+		}
 	}
+}
 
-	loadSymtab();
+DebugFormat::~DebugFormat()
+{
+	delete _pdbFile;
+	delete _dwarfFile;
 }
 
 /**
  * @return @c True if debug info was loaded successfully from PDB or DWARF.
  *         @c False otherwise.
  */
-bool DebugFormat::hasInformation() const
+bool DebugFormat::hasInformation()
+{
+	return !getFunctions().empty();
+}
+
+/**
+ * Loads functions from debug information and symbol table if they were not
+ * loaded yet.
+ */
+void DebugFormat::loadFunctions()
+{
+	if (_functionsLoaded)
+		return;
+
+	if (_pdbFile)
+		loadPdbFunctions();
+	if (_dwarfFile)
+		loadDwarfFunctions();
+	// Functions from debug information take precedence over symbols.
+	loadSymtab();
+	_functionsLoaded = true;
+}
+
+/**
+ * Loads global variables from debug information if they were not loaded yet.
+ */
+void DebugFormat::loadGlobalVariables()
 {
-	return !functions.empty();
+	if (_globalsLoaded)
+		return;
+
+	if (_pdbFile)
+		loadPdbGlobalVariables();
+	if (_dwarfFile)
+		loadDwarfGlobalVariables();
+	_globalsLoaded = true;
 }
 
 /**
+ * Loads types from debug information if they were not loaded yet.
+ */
+void DebugFormat::loadTypes()
+{
+	if (_typesLoaded)
+		return;
+
+	if (_pdbFile)
+		loadPdbTypes();
+	if (_dwarfFile)
+		loadDwarfTypes();
+	_typesLoaded = true;
+}
+
+/**
+ * Loads functions from symbol table if they were not loaded yet. Functions
+ * from debug information which are already loaded are not replaced.
  * TODO: move to own module.
  */
 void DebugFormat::loadSymtab()
 {
-	if (!_symtab)
+	if (!_symtab || _symtabLoaded)
 		return;
+	_symtabLoaded = true;
 
 	for (auto it = _symtab->begin(); it != _symtab->end(); ++it)
 	{
@@ -118,20 +191,78 @@ void DebugFormat::loadSymtab()
 		nf.returnType.setLlvmIr("void");
 		nf.setIsFromDebug(false);
 		nf.setIsThumb(it->second->isThumbSymbol());
-		functions.insert( {nf.getStart(), nf} );
+		_functions.insert( {nf.getStart(), nf} );
 	}
 }
 
+/**
+ * @return Function starting at the given address @p a or @c nullptr if
+ *         there is no such function.
+ */
 retdec::config::Function* DebugFormat::getFunction(retdec::utils::Address a)
 {
-	auto fIt = functions.find(a);
-	return fIt != functions.end() ? &fIt->second : nullptr;
+	if (_dwarfFile && !_functionsLoaded)
+	{
+		// Only compilation units covering the address are loaded.
+		if (auto* df = _dwarfFile->getFunction(a))
+			loadDwarfFunction(df);
+		loadSymtab();
+	}
+	else
+	{
+		loadFunctions();
+	}
+
+	auto fIt = _functions.find(a);
+	return fIt != _functions.end() ? &fIt->second : nullptr;
 }
 
+/**
+ * @return Global variable at the given address @p a or @c nullptr if there
+ *         is no such variable.
+ */
 const retdec::config::Object* DebugFormat::getGlobalVar(
 		retdec::utils::Address a)
 {
-	return globals.getObjectByAddress(a);
+	if (_dwarfFile && !_globalsLoaded)
+	{
+		// Only compilation units defining the variable are loaded.
+		if (auto* gvar = _dwarfFile->getGlobalVar(a))
+			loadDwarfGlobalVariable(gvar);
+	}
+	else
+	{
+		loadGlobalVariables();
+	}
+	return _globals.getObjectByAddress(a);
+}
+
+/**
+ * @return All functions (key is their start address). They are loaded
+ *         at the first call.
+ */
+const DebugFormat::FunctionMap& DebugFormat::getFunctions()
+{
+	loadFunctions();
+	return _functions;
+}
+
+/**
+ * @return All global variables. They are loaded at the first call.
+ */
+const retdec::config::GlobalVarContainer& DebugFormat::getGlobalVars()
+{
+	loadGlobalVariables();
+	return _globals;
+}
+
+/**
+ * @return All types. They are loaded at the first call.
+ */
+const retdec::config::TypeContainer& DebugFormat::getTypes()
+{
+	loadTypes();
+	return _types;
 }
 
 } // namespace debugformat
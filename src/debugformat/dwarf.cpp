@@ -16,151 +16,166 @@
 namespace retdec {
 namespace debugformat {
 
-void DebugFormat::loadDwarf()
-{
-	if (!_dwarfFile)
-		return;
-
-	loadDwarfTypes();
-	loadDwarfGlobalVariables();
-	loadDwarfFunctions();
-}
-
 void DebugFormat::loadDwarfTypes()
 {
+	_dwarfFile->loadAllCUs(_threadPool);
+
 	auto* ts = _dwarfFile->getTypes();
 	for (auto* t : *ts)
 	{
 		if (t)
 		{
-			types.insert(loadDwarfType(t));
+			_types.insert(loadDwarfType(t));
 		}
 	}
 }
 
 void DebugFormat::loadDwarfGlobalVariables()
 {
+	_dwarfFile->loadAllCUs(_threadPool);
+
 	auto* dwarfGvars = _dwarfFile->getGlobalVars();
 	if (dwarfGvars == nullptr)
 		return;
 
 	for (auto* gvar : *dwarfGvars)
 	{
-		if (gvar->location == nullptr || !gvar->location->isNormal() || gvar->name.empty())
-		{
-			continue;
-		}
-
-		Dwarf_Addr address;
-		std::string n;
-		retdec::dwarfparser::DwarfLocationDesc::cLocType loc = gvar->getLocation(&n, &address, 1);
-		if (loc.isAddress())
-		{
-			std::string name = gvar->name.empty() ? "glob_var_" + retdec::utils::toHexString(address) : gvar->name;
-			auto addr = retdec::utils::Address(address);
-			if (!addr.isDefined())
-				continue;
-			retdec::config::Object gv(name, retdec::config::Storage::inMemory(addr));
-			gv.type = loadDwarfType(gvar->type);
-			if (gv.type.getLlvmIr() == "void")
-				gv.type.setLlvmIr("i32");
-			globals.insert(gv);
-		}
+		loadDwarfGlobalVariable(gvar);
 	}
 }
 
-void DebugFormat::loadDwarfFunctions()
+void DebugFormat::loadDwarfGlobalVariable(retdec::dwarfparser::DwarfVar* gvar)
 {
-	// Lines
-	//
-	std::map<retdec::utils::Address, int> lines;
-	for (auto* line : *_dwarfFile->getLines())
+	if (gvar->location == nullptr || !gvar->location->isNormal() || gvar->name.empty())
 	{
-		lines[line->addr] = line->lineNum;
+		return;
+	}
+
+	Dwarf_Addr address;
+	std::string n;
+	retdec::dwarfparser::DwarfLocationDesc::cLocType loc = gvar->getLocation(&n, &address, 1);
+	if (loc.isAddress())
+	{
+		std::string name = gvar->name.empty() ? "glob_var_" + retdec::utils::toHexString(address) : gvar->name;
+		auto addr = retdec::utils::Address(address);
+		if (!addr.isDefined())
+			return;
+		retdec::config::Object gv(name, retdec::config::Storage::inMemory(addr));
+		gv.type = loadDwarfType(gvar->type);
+		if (gv.type.getLlvmIr() == "void")
+			gv.type.setLlvmIr("i32");
+		_globals.insert(gv);
 	}
+}
+
+void DebugFormat::loadDwarfFunctions()
+{
+	_dwarfFile->loadAllCUs(_threadPool);
 
-	// Functions
-	//
 	for (auto* df : *_dwarfFile->getFunctions())
 	{
-		if (df->lowAddr <= 0)
-			continue;
+		loadDwarfFunction(df);
+	}
+}
 
-		std::string name;
-		std::string demangledName;
-		if (df->linkageName.empty())
-		{
-			name = df->name;
-		}
-		else
+/**
+ * Convert DWARF function into common function representation. Function is
+ * not converted if a function from debug information already starts at its
+ * address. Function from symbol table at the address is replaced.
+ * @param df DWARF function whose compilation unit is loaded.
+ */
+void DebugFormat::loadDwarfFunction(retdec::dwarfparser::DwarfFunction* df)
+{
+	if (df->lowAddr <= 0)
+		return;
+
+	auto fIt = _functions.find(df->lowAddr);
+	if (fIt != _functions.end() && fIt->second.isFromDebug())
+		return;
+
+	std::string name;
+	std::string demangledName;
+	if (df->linkageName.empty())
+	{
+		name = df->name;
+	}
+	else
+	{
+		name = df->linkageName;
+		demangledName = _demangler->demangleToString(name);
+		if (demangledName.empty())
 		{
-			name = df->linkageName;
-			demangledName = _demangler->demangleToString(name);
-			if (demangledName.empty())
-			{
-				demangledName = name;
-			}
+			demangledName = name;
 		}
+	}
 
-		retdec::config::Function dif(name);
-		dif.setDemangledName(demangledName);
+	retdec::config::Function dif(name);
+	dif.setDemangledName(demangledName);
 
-		dif.setStartEnd(df->lowAddr, df->highAddr);
-		dif.setSourceFileName(df->file);
-		dif.setIsVariadic(df->isVariadic);
-		dif.returnType = loadDwarfType(df->type);
+	dif.setStartEnd(df->lowAddr, df->highAddr);
+	dif.setSourceFileName(df->file);
+	dif.setIsVariadic(df->isVariadic);
+	dif.returnType = loadDwarfType(df->type);
 
-		dif.setStartLine(df->line);
-		auto lastLine = lines.find(dif.getStart());
-		while (lastLine != lines.end() && lastLine->first < dif.getEnd())
-		{
-			dif.setEndLine(lastLine->second);
-			++lastLine;
-		}
+	// Lines of the compilation unit of the function are loaded with it.
+	dif.setStartLine(df->line);
+	const auto& lines = _dwarfFile->getLoadedLineNumbers();
+	auto lastLine = lines.find(dif.getStart());
+	while (lastLine != lines.end() && lastLine->first < dif.getEnd())
+	{
+		dif.setEndLine(lastLine->second);
+		++lastLine;
+	}
 
-		auto* sym = _inFile->getFileFormat()->getSymbol(df->lowAddr + 1);
-		dif.setIsThumb(sym && sym->isThumbSymbol());
+	auto* sym = _inFile->getFileFormat()->getSymbol(df->lowAddr + 1);
+	dif.setIsThumb(sym && sym->isThumbSymbol());
 
-		std::string regName;
-		Dwarf_Addr frameRegNum = 0;
-		if (df->frameBase && df->frameBase->computeLocation(&regName, &frameRegNum).isRegister())
-		{
-			dif.frameBaseStorage = retdec::config::Storage::inRegister(frameRegNum);
-		}
+	std::string regName;
+	Dwarf_Addr frameRegNum = 0;
+	if (df->frameBase && df->frameBase->computeLocation(&regName, &frameRegNum).isRegister())
+	{
+		dif.frameBaseStorage = retdec::config::Storage::inRegister(frameRegNum);
+	}
+
+	unsigned argCntr = 0;
+	for (auto* param : *df->getParams())
+	{
+		std::string name = param->name.empty() ? std::string("arg") + std::to_string(argCntr) : param->name;
+		retdec::config::Object newArg(name, retdec::config::Storage::undefined());
+		newArg.type = loadDwarfType(param->type); // void -> i32
+		dif.parameters.insert(newArg);
+		++argCntr;
+	}
 
-		unsigned argCntr = 0;
-		for (auto* param : *df->getParams())
+	for (auto* var : *df->getVars())
+	{
+		if (var->location == nullptr || var->location->isEmpty() || var->name.empty())
 		{
-			std::string name = param->name.empty() ? std::string("arg") + std::to_string(argCntr) : param->name;
-			retdec::config::Object newArg(name, retdec::config::Storage::undefined());
-			newArg.type = loadDwarfType(param->type); // void -> i32
-			dif.parameters.insert(newArg);
-			++argCntr;
+			continue;
 		}
 
-		for (auto* var : *df->getVars())
+		retdec::config::Storage storage;
+		Dwarf_Signed address;
+		int regNum = -1;
+		bool deref;
+		if (var->isOnStack(&address, &deref, 0, &regNum))
 		{
-			if (var->location == nullptr || var->location->isEmpty() || var->name.empty())
-			{
-				continue;
-			}
-
-			retdec::config::Storage storage;
-			Dwarf_Signed address;
-			int regNum = -1;
-			bool deref;
-			if (var->isOnStack(&address, &deref, 0, &regNum))
-			{
-				storage = retdec::config::Storage::onStack(address, regNum);
-			}
-
-			retdec::config::Object newLocalVar(var->name, storage);
-			newLocalVar.type = loadDwarfType(var->type); // TODO: void -> i32
-			dif.locals.insert(newLocalVar);
+			storage = retdec::config::Storage::onStack(address, regNum);
 		}
 
-		dif.setIsFromDebug(true);
-		functions.insert( {dif.getStart(), dif} );
+		retdec::config::Object newLocalVar(var->name, storage);
+		newLocalVar.type = loadDwarfType(var->type); // TODO: void -> i32
+		dif.locals.insert(newLocalVar);
+	}
+
+	dif.setIsFromDebug(true);
+	if (fIt != _functions.end())
+	{
+		fIt->second = dif;
+	}
+	else
+	{
+		_functions.insert( {dif.getStart(), dif} );
 	}
 }
 
@@ -15,16 +15,6 @@
 namespace retdec {
 namespace debugformat {
 
-void DebugFormat::loadPdb()
-{
-	if (!_pdbFile)
-		return;
-
-	loadPdbTypes();
-	loadPdbGlobalVariables();
-	loadPdbFunctions();
-}
-
 void DebugFormat::loadPdbTypes()
 {
 	auto* ts = _pdbFile->get_types_container();
@@ -32,14 +22,14 @@ void DebugFormat::loadPdbTypes()
 	{
 		if (item.second)
 		{
-			types.insert(loadPdbType(item.second));
+			_types.insert(loadPdbType(item.second));
 		}
 	}
 	for (auto& item : ts->types_fully_defined)
 	{
 		if (item.second)
 		{
-			types.insert(loadPdbType(item.second));
+			_types.insert(loadPdbType(item.second));
 		}
 	}
 }
@@ -63,7 +53,7 @@ void DebugFormat::loadPdbGlobalVariables()
 		gv.type = loadPdbType(pgv.type_def);
 		if (gv.type.getLlvmIr() == "void")
 			gv.type.setLlvmIr("i32");
-		globals.insert(gv);
+		_globals.insert(gv);
 	}
 }
 
@@ -148,7 +138,7 @@ void DebugFormat::loadPdbFunctions()
 		}
 
 		fnc.setIsFromDebug(true);
-		functions.insert( {fnc.getStart(), fnc} );
+		_functions.insert( {fnc.getStart(), fnc} );
 	}
 }
 
@@ -0,0 +1,345 @@
+/**
+ * @file src/decompiler/decompiler.cpp
+ * @brief In-process decompilation pipeline.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+
+#include <llvm/ADT/Triple.h>
+#include <llvm/Analysis/LoopInfo.h>
+#include <llvm/Analysis/ScalarEvolution.h>
+#include <llvm/Analysis/TargetLibraryInfo.h>
+#include <llvm/Analysis/TargetTransformInfo.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/InitializePasses.h>
+#include <llvm/PassRegistry.h>
+#include <llvm/PassInfo.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "retdec/bin2llvmir/analyses/symbolic_tree.h"
+#include "retdec/bin2llvmir/optimizations/provider_init/provider_init.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
+#include "retdec/decompiler/decompiler.h"
+#include "retdec/fileformat/format_factory.h"
+#include "retdec/llvm-support/diagnostics.h"
+#include "retdec/llvmir2hll/config/configs/json_config.h"
+#include "retdec/utils/memory.h"
+
+using namespace retdec::bin2llvmir;
+
+namespace retdec {
+namespace decompiler {
+
+namespace {
+
+/**
+ * Drops pointers to data of providers which passes of the current thread left
+ * in @c SymbolicTree.
+ */
+struct SymbolicTreeReset
+{
+	~SymbolicTreeReset()
+	{
+		SymbolicTree::setAbi(nullptr);
+		SymbolicTree::setConfig(nullptr);
+	}
+};
+
+} // anonymous namespace
+
+/**
+ * Create settings with the default list of bin2llvmir passes.
+ */
+Settings::Settings() : bin2llvmirPasses(getDefaultBin2llvmirPasses())
+{
+	backend.validateModule = true;
+}
+
+/**
+ * Get passes run by bin2llvmir in the default decompilation
+ * @return Names of passes from @c scripts/retdec-bin2llvmir-passes.txt, which
+ *    is also used by @c scripts/retdec-config.py
+ */
+std::vector<std::string> Settings::getDefaultBin2llvmirPasses()
+{
+	const std::vector<std::string> passes =
+	{
+#include "bin2llvmir_passes.inc"
+	};
+	return passes;
+}
+
+/**
+ * Constructor
+ * @param config Config of the input file prepared for bin2llvmir
+ * @param settings Settings of decompilation
+ */
+Decompiler::Decompiler(const retdec::config::Config &config, const Settings &settings) :
+		config(config), settings(settings)
+{
+	initializeLlvm();
+}
+
+/**
+ * Run all stages of decompilation
+ * @return @c true if decompilation succeeded, @c false otherwise (see
+ *    @c getErrorMessage())
+ */
+bool Decompiler::run()
+{
+	statistics.clear();
+	errorMessage.clear();
+
+	return runStage("fileformat", &Decompiler::loadInputFile)
+		&& runStage("bin2llvmir", &Decompiler::runBin2llvmir)
+		&& runStage("llvmir2hll", &Decompiler::runLlvmir2hll);
+}
+
+/**
+ * Get description of the error which stopped decompilation
+ */
+const std::string& Decompiler::getErrorMessage() const
+{
+	return errorMessage;
+}
+
+/**
+ * Get statistics of stages finished by the last @c run()
+ */
+const std::vector<StageStatistics>& Decompiler::getStatistics() const
+{
+	return statistics;
+}
+
+/**
+ * Get config updated by decompilation
+ */
+const retdec::config::Config& Decompiler::getConfig() const
+{
+	return config;
+}
+
+/**
+ * Get parsed input file
+ * @return Input file or @c nullptr if it has not been loaded yet
+ */
+const retdec::fileformat::FileFormat* Decompiler::getFileFormat() const
+{
+	return fileFormat.get();
+}
+
+/**
+ * Get LLVM IR produced by bin2llvmir
+ * @return Module or @c nullptr if bin2llvmir has not been run yet
+ */
+const llvm::Module* Decompiler::getModule() const
+{
+	return module.get();
+}
+
+/**
+ * Parse input file. It is shared by all other stages.
+ */
+bool Decompiler::loadInputFile()
+{
+	fileFormat = retdec::fileformat::createFileFormat(config.getInputFile(), &config);
+	if (!fileFormat || !fileFormat->isInValidState())
+	{
+		return setError("failed to load input file " + config.getInputFile());
+	}
+
+	return true;
+}
+
+/**
+ * Translate input file into LLVM IR and optimize it.
+ */
+bool Decompiler::runBin2llvmir()
+{
+	module = std::make_unique<llvm::Module>(config.getInputFile(), context);
+
+	// Data of providers are released when this context is destroyed, so they
+	// never outlive the module and other decompilers are not affected.
+	ProviderContext providers(module.get());
+	SymbolicTreeReset symbolicTreeReset;
+
+	llvm::legacy::PassManager passes;
+	llvm::TargetLibraryInfoImpl tlii(llvm::Triple(module->getTargetTriple()));
+	// bin2llvmir is always run with -disable-simplify-libcalls.
+	tlii.disableAllFunctions();
+	passes.add(new llvm::TargetLibraryInfoWrapperPass(tlii));
+	passes.add(llvm::createTargetTransformInfoWrapperPass(llvm::TargetIRAnalysis()));
+
+	auto &registry = *llvm::PassRegistry::getPassRegistry();
+	for (const auto &name : settings.bin2llvmirPasses)
+	{
+		if (name == "provider-init")
+		{
+			passes.add(new ProviderInitialization(&config, fileFormat));
+			continue;
+		}
+
+		const auto *info = registry.getPassInfo(name);
+		if (!info || !info->getNormalCtor())
+		{
+			return setError("cannot create pass: " + name);
+		}
+		passes.add(info->createPass());
+	}
+
+	try
+	{
+		passes.run(*module);
+	}
+	catch (const std::runtime_error &e)
+	{
+		return setError(e.what());
+	}
+
+	// Passes worked on a copy of config owned by provider, take it back.
+	if (providers.config)
+	{
+		config = providers.config->getConfig();
+	}
+
+	if (!settings.outputConfigFile.empty())
+	{
+		if (config.generateJsonFile(settings.outputConfigFile).empty())
+		{
+			return setError("cannot write " + settings.outputConfigFile);
+		}
+	}
+
+	if (!settings.outputLlvmIrFile.empty())
+	{
+		std::error_code ec;
+		llvm::raw_fd_ostream out(settings.outputLlvmIrFile, ec, llvm::sys::fs::F_None);
+		if (ec)
+		{
+			return setError("cannot open " + settings.outputLlvmIrFile + ": " + ec.message());
+		}
+		module->print(out, nullptr);
+	}
+
+	return true;
+}
+
+/**
+ * Decompile LLVM IR produced by bin2llvmir into the target HLL.
+ */
+bool Decompiler::runLlvmir2hll()
+{
+	std::error_code ec;
+	llvm::raw_fd_ostream out(settings.outputFile, ec, llvm::sys::fs::F_None);
+	if (ec)
+	{
+		return setError("cannot open " + settings.outputFile + ": " + ec.message());
+	}
+
+	auto options = settings.backend;
+	if (options.outputFile.empty())
+	{
+		options.outputFile = settings.outputFile;
+	}
+
+	llvm::legacy::PassManager passes;
+	llvm::TargetLibraryInfoImpl tlii(llvm::Triple(module->getTargetTriple()));
+	passes.add(new llvm::TargetLibraryInfoWrapperPass(tlii));
+	passes.add(new llvm::LoopInfoWrapperPass());
+	passes.add(new llvm::ScalarEvolutionWrapperPass());
+	auto *decompiler = new retdec::llvmir2hll::Decompiler(out, options,
+			retdec::llvmir2hll::JSONConfig::fromConfig(config));
+	passes.add(decompiler);
+
+	try
+	{
+		passes.run(*module);
+	}
+	catch (const std::runtime_error &e)
+	{
+		return setError(e.what());
+	}
+
+	// The pass is owned by the pass manager, which is still alive here.
+	if (!decompiler->hasSucceeded())
+	{
+		return setError("conversion of LLVM IR into " + options.targetHll
+				+ " failed");
+	}
+
+	out.flush();
+	if (out.has_error())
+	{
+		out.clear_error();
+		return setError("cannot write " + settings.outputFile);
+	}
+
+	return true;
+}
+
+/**
+ * Run one stage of decompilation and record its statistics
+ * @param name Name of stage
+ * @param stage Method performing the stage
+ * @return @c true if stage succeeded, @c false otherwise
+ */
+bool Decompiler::runStage(const std::string &name, bool (Decompiler::*stage)())
+{
+	retdec::llvm_support::printPhase(name);
+
+	const auto startPeakMemory = retdec::utils::getPeakMemoryUsage();
+	const auto start = std::chrono::steady_clock::now();
+	const auto ok = (this->*stage)();
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	const auto peakMemory = retdec::utils::getPeakMemoryUsage();
+
+	StageStatistics stats;
+	stats.name = name;
+	stats.time = elapsed.count();
+	// Peak memory usage of process never decreases, so the growth is the
+	// memory which the stage needed above what was already used before it.
+	stats.peakMemoryGrowth = peakMemory > startPeakMemory
+		? peakMemory - startPeakMemory
+		: 0;
+	stats.processPeakMemory = peakMemory;
+	statistics.push_back(stats);
+	return ok;
+}
+
+/**
+ * Store error message
+ * @param message Description of error
+ * @return Always @c false
+ */
+bool Decompiler::setError(const std::string &message)
+{
+	errorMessage = message;
+	return false;
+}
+
+/**
+ * Register LLVM passes, the same as bin2llvmir does. It is done only once
+ * per process.
+ */
+void Decompiler::initializeLlvm()
+{
+	static std::once_flag initialized;
+	std::call_once(initialized, []()
+	{
+		auto &registry = *llvm::PassRegistry::getPassRegistry();
+		llvm::initializeCore(registry);
+		llvm::initializeScalarOpts(registry);
+		llvm::initializeIPO(registry);
+		llvm::initializeAnalysis(registry);
+		llvm::initializeTransformUtils(registry);
+		llvm::initializeInstCombine(registry);
+		llvm::initializeTarget(registry);
+	});
+}
+
+} // namespace decompiler
+} // namespace retdec
@@ -0,0 +1,195 @@
+/**
+ * @file src/decompilertool/decompiler.cpp
+ * @brief Decompiler tool running the whole decompilation in one process.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "retdec/config/config.h"
+#include "retdec/decompiler/decompiler.h"
+#include "retdec/utils/conversion.h"
+#include "retdec/utils/memory.h"
+
+using namespace retdec::decompiler;
+using namespace retdec::utils;
+
+/**
+ * Print usage.
+ */
+void printUsage()
+{
+	std::cout << "\nDecompiler of binary files in one process.\n"
+		<< "Usage: retdec-decompiler --config CONFIG_FILE -o OUTPUT_FILE [OPTIONS]\n\n"
+		<< "Config has to be prepared by fileinfo in the same way as for bin2llvmir.\n\n"
+		<< "Options:\n"
+		<< "    --config FILE              Config of the input file.\n"
+		<< "    -o FILE                    Output file with the generated code.\n"
+		<< "    --target-hll HLL           Target high-level language (default: c).\n"
+		<< "    --output-config FILE       Store config updated by decompilation.\n"
+		<< "    --output-ll FILE           Store LLVM IR produced by bin2llvmir.\n"
+		<< "    --keep-unreachable-funcs   Keep functions unreachable from main.\n"
+		<< "    --no-opts                  Do not run optimizations of llvmir2hll.\n"
+		<< "    --aggressive-opts          Run aggressive optimizations of llvmir2hll.\n"
+		<< "    --no-var-renaming          Do not rename variables.\n"
+		<< "    --no-debug-comments        Do not emit debug comments.\n"
+		<< "    --max-memory N             Limit memory to N bytes.\n"
+		<< "    --no-memory-limit          Do not limit memory (default: half of RAM).\n"
+		<< "    --stats FILE               Store time and memory used by stages (JSON).\n\n";
+}
+
+/**
+ * Print error message and return non-zero value.
+ *
+ * @param errorMessage message to print
+ * @return non-zero value
+ */
+int printError(
+	const std::string &errorMessage)
+{
+	std::cerr << "Error: " << errorMessage << "\n";
+	return 1;
+}
+
+/**
+ * Store statistics of stages into JSON file.
+ *
+ * @param path path to output file
+ * @param statistics statistics to store
+ * @return @c true if statistics were stored, @c false otherwise
+ */
+bool writeStatistics(
+	const std::string &path,
+	const std::vector<StageStatistics> &statistics)
+{
+	std::ofstream out(path);
+	if (!out) {
+		return false;
+	}
+
+	out << "{\n\t\"stages\": [";
+	for (std::size_t i = 0; i < statistics.size(); ++i) {
+		out << (i ? "," : "") << "\n\t\t{ \"name\": \"" << statistics[i].name
+			<< "\", \"time\": " << statistics[i].time
+			<< ", \"peak_memory_growth\": " << statistics[i].peakMemoryGrowth
+			<< ", \"process_peak_memory\": " << statistics[i].processPeakMemory
+			<< " }";
+	}
+	out << "\n\t]\n}\n";
+	return out.good();
+}
+
+/**
+ * Do actions according to command line arguments.
+ *
+ * @param args command line arguments
+ */
+int doActions(
+	const std::vector<std::string> &args)
+{
+	Settings settings;
+	settings.backend.emitDebugComments = true;
+
+	std::string configPath;
+	std::string statsPath;
+	bool keepUnreachableFuncs = false;
+	bool limitMemory = true;
+	unsigned long long memoryLimit = 0;
+
+	for (std::size_t i = 0; i < args.size(); ++i) {
+		if (args[i] == "-h" || args[i] == "--help") {
+			printUsage();
+			return 0;
+		}
+		else if (args[i] == "--config" && i + 1 < args.size()) {
+			configPath = args[++i];
+		}
+		else if (args[i] == "-o" && i + 1 < args.size()) {
+			settings.outputFile = args[++i];
+		}
+		else if (args[i] == "--target-hll" && i + 1 < args.size()) {
+			settings.backend.targetHll = args[++i];
+		}
+		else if (args[i] == "--output-config" && i + 1 < args.size()) {
+			settings.outputConfigFile = args[++i];
+		}
+		else if (args[i] == "--output-ll" && i + 1 < args.size()) {
+			settings.outputLlvmIrFile = args[++i];
+		}
+		else if (args[i] == "--stats" && i + 1 < args.size()) {
+			statsPath = args[++i];
+		}
+		else if (args[i] == "--keep-unreachable-funcs") {
+			keepUnreachableFuncs = true;
+		}
+		else if (args[i] == "--no-opts") {
+			settings.backend.noOpts = true;
+		}
+		else if (args[i] == "--aggressive-opts") {
+			settings.backend.aggressiveOpts = true;
+		}
+		else if (args[i] == "--no-var-renaming") {
+			settings.backend.noVarRenaming = true;
+		}
+		else if (args[i] == "--no-debug-comments") {
+			settings.backend.emitDebugComments = false;
+		}
+		else if (args[i] == "--no-memory-limit") {
+			limitMemory = false;
+		}
+		else if (args[i] == "--max-memory" && i + 1 < args.size()) {
+			if (!strToNum(args[++i], memoryLimit) || memoryLimit == 0) {
+				return printError("invalid memory limit '" + args[i] + "'");
+			}
+		}
+		else {
+			return printError("invalid argument '" + args[i] + "'");
+		}
+	}
+
+	if (configPath.empty() || settings.outputFile.empty()) {
+		printUsage();
+		return 1;
+	}
+
+	if (keepUnreachableFuncs) {
+		auto &passes = settings.bin2llvmirPasses;
+		passes.erase(std::remove(passes.begin(), passes.end(), "unreachable-funcs"),
+			passes.end());
+	}
+
+	if (limitMemory) {
+		auto limited = memoryLimit
+			? limitSystemMemory(memoryLimit)
+			: limitSystemMemoryToHalfOfTotalSystemMemory();
+		if (!limited) {
+			return printError("failed to limit memory");
+		}
+	}
+
+	retdec::config::Config config;
+	try {
+		config.readJsonFile(configPath);
+	}
+	catch (const retdec::config::Exception &e) {
+		return printError("loading of config '" + configPath + "' failed: " + e.what());
+	}
+
+	Decompiler decompiler(config, settings);
+	const auto ok = decompiler.run();
+
+	if (!statsPath.empty() && !writeStatistics(statsPath, decompiler.getStatistics())) {
+		return printError("cannot write statistics into '" + statsPath + "'");
+	}
+
+	return ok ? 0 : printError(decompiler.getErrorMessage());
+}
+
+int main(int argc, char **argv)
+{
+	return doActions(std::vector<std::string>(argv + 1, argv + argc));
+}
@@ -5,6 +5,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <cstdlib>
 #include <fcntl.h>
 
@@ -26,8 +27,15 @@ namespace dwarfparser {
  * @brief ctor -- create containers and load data from input file.
  * @param fileName Name of file to open.
  * @param fileParser Parser of input file (optional)
+ * @param lazy If @c true, only the index of compilation units is created and
+ *             their contents are loaded on demand by loadCUsForAddress(),
+ *             loadCUsForName(), loadCUs(), loadAllCUs(), getFunction(),
+ *             getGlobalVar() or by any getter of containers.
+ *
+ * If @a fileParser is given, it has to outlive the created object because
+ * sections are read from it when they are first used.
  */
-DwarfFile::DwarfFile(string fileName, retdec::fileformat::FileFormat *fileParser) :
+DwarfFile::DwarfFile(string fileName, retdec::fileformat::FileFormat *fileParser, bool lazy) :
 		m_CUs(this),
 		m_lines(this),
 		m_functions(this),
@@ -38,9 +46,25 @@ DwarfFile::DwarfFile(string fileName, retdec::fileformat::FileFormat *fileParser
 		m_dbg(nullptr),
 		m_fd(0),
 		m_error(nullptr),
+		m_fileName(fileName),
+		m_fileParser(fileParser),
+		m_loadedCUs(0),
+		m_loadingCU(false),
+		m_globalDIEsIndexed(false),
+		m_makeStructTypesUnique(true),
+		m_uniqueTypesCount(0),
+		m_anonStructsCount(0),
+		m_indexedFunctionsCount(0),
+		m_indexedGlobalVarsCount(0),
+		m_indexedLinesCount(0),
 		m_activeCU(nullptr)
 {
 	loadFile(fileName, fileParser);
+
+	if (!lazy)
+	{
+		loadAllCUs();
+	}
 }
 
 /**
@@ -78,10 +102,10 @@ bool DwarfFile::loadFile(string fileName, retdec::fileformat::FileFormat *filePa
 	Dwarf_Ptr errArg = nullptr;
 
 	// It is possible to load input file with our backend.
-	BinInt binInt(fileName, fileParser);
-	if (binInt.success())
+	m_binInt.reset(new BinInt(fileName, fileParser));
+	if (m_binInt->success())
 	{
-		m_res = dwarf_object_init(binInt.getInt(),
+		m_res = dwarf_object_init(m_binInt->getInt(),
 				errHand, errArg, &m_dbg, &m_error);
 
 		// Input file has no DWARF information.
@@ -99,7 +123,7 @@ bool DwarfFile::loadFile(string fileName, retdec::fileformat::FileFormat *filePa
 
 		resources.initMappingDefault();
 
-		loadFileCUs();
+		indexFileCUs();
 		m_hasDwarf = true;
 	}
 
@@ -135,7 +159,7 @@ bool DwarfFile::loadFile(string fileName, retdec::fileformat::FileFormat *filePa
 		// Init register mapping by default values.
 		resources.initMappingDefault();
 
-		loadFileCUs();
+		indexFileCUs();
 		m_hasDwarf = true;
 	}
 
@@ -149,18 +173,32 @@ bool DwarfFile::loadFile(string fileName, retdec::fileformat::FileFormat *filePa
  * otherwise, string based (LLVM) type representation can not be used.
  * Several same named structures would be generated and it would not be possible
  * to distinguish their uses from one another.
+ *
+ * Only types loaded since the last call are processed, so loading of another
+ * CU does not rename already renamed types. Anonymous structures are named
+ * here as well, so their names depend only on the order of loaded CUs.
  */
 void DwarfFile::makeStructTypesUnique()
 {
-	std::map<std::string, unsigned> typeMap;
-	for (auto& t : m_types)
+	if (!m_makeStructTypesUnique)
+	{
+		return;
+	}
+
+	for (; m_uniqueTypesCount < m_types.size(); ++m_uniqueTypesCount)
 	{
+		auto* t = *(m_types.begin() + m_uniqueTypesCount);
 		if (t->constructed_as<DwarfStructType>())
 		{
-			auto fIt = typeMap.find(t->name);
-			if (fIt == typeMap.end())
+			if (t->name.empty())
 			{
-				typeMap[t->name] = 1;
+				t->name = "anon_struct_" + std::to_string(m_anonStructsCount++);
+			}
+
+			auto fIt = m_structNames.find(t->name);
+			if (fIt == m_structNames.end())
+			{
+				m_structNames[t->name] = 1;
 			}
 			else
 			{
@@ -181,10 +219,16 @@ bool DwarfFile::hasDwarfInfo()
 }
 
 /**
- * @brief Iterate over DWARF file's CUs.
+ * @brief Iterate over DWARF file's CU headers and create index of CUs.
+ *        Address ranges of CUs are taken from @c .debug_aranges and if a CU
+ *        is not there, from the low and high PC of its DIE. Contents of CUs
+ *        are not loaded.
  */
-void DwarfFile::loadFileCUs()
+void DwarfFile::indexFileCUs()
 {
+	std::map<Dwarf_Off, std::vector<std::pair<Dwarf_Addr, Dwarf_Addr>>> aranges;
+	indexAranges(aranges);
+
 	Dwarf_Unsigned cu_header_length = 0;
 	Dwarf_Half version_stamp = 0;
 	Dwarf_Unsigned abbrev_offset = 0;
@@ -218,20 +262,585 @@ void DwarfFile::loadFileCUs()
 		if (m_res == DW_DLV_ERROR)
 		{
 			DWARF_ERROR("Libdwarf error: " << getDwarfError(m_error));
-			return;
+			continue;
 		}
 		else if (m_res == DW_DLV_NO_ENTRY)
 		{
+			continue;
+		}
+
+		CUIndexEntry cu;
+		AttrProcessor ap(m_dbg, cuDie, this);
+		cu.dieOffset = ap.getDieOff();
+
+		auto fIt = aranges.find(cu.dieOffset);
+		if (fIt != aranges.end())
+		{
+			cu.ranges = std::move(fIt->second);
+		}
+		else
+		{
+			Dwarf_Addr low, high;
+			ap.get(DW_AT_low_pc, low);
+			ap.get(DW_AT_high_pc, high);
+			// High PC may be an offset from low PC.
+			if (high < low)
+			{
+				high += low;
+			}
+			if (low != EMPTY_ADDR && high != EMPTY_ADDR && low < high)
+			{
+				cu.ranges.emplace_back(low, high);
+			}
+		}
+
+		m_cuIndex.push_back(std::move(cu));
+		dwarf_dealloc(m_dbg, cuDie, DW_DLA_DIE);
+	}
+}
+
+/**
+ * @brief Get address ranges of CUs from @c .debug_aranges.
+ * @param ranges Address ranges [low, high) by offsets of CU DIEs.
+ */
+void DwarfFile::indexAranges(std::map<Dwarf_Off, std::vector<std::pair<Dwarf_Addr, Dwarf_Addr>>> &ranges)
+{
+	Dwarf_Arange *aranges = nullptr;
+	Dwarf_Signed count = 0;
+	if (dwarf_get_aranges(m_dbg, &aranges, &count, &m_error) != DW_DLV_OK)
+	{
+		return;
+	}
+
+	for (Dwarf_Signed i = 0; i < count; ++i)
+	{
+		Dwarf_Unsigned segment = 0;
+		Dwarf_Unsigned segmentEntrySize = 0;
+		Dwarf_Addr start = 0;
+		Dwarf_Unsigned length = 0;
+		Dwarf_Off cuDieOffset = 0;
+		if (dwarf_get_arange_info_b(
+					aranges[i],
+					&segment,
+					&segmentEntrySize,
+					&start,
+					&length,
+					&cuDieOffset,
+					&m_error) == DW_DLV_OK
+				&& length > 0)
+		{
+			ranges[cuDieOffset].emplace_back(start, start + length);
+		}
+
+		dwarf_dealloc(m_dbg, aranges[i], DW_DLA_ARANGE);
+	}
+
+	dwarf_dealloc(m_dbg, aranges, DW_DLA_LIST);
+}
+
+/**
+ * @brief Load contents of CU with the given index, if it is not loaded yet.
+ * @param index Index of CU in m_cuIndex.
+ */
+void DwarfFile::loadCU(std::size_t index)
+{
+	auto &cu = m_cuIndex[index];
+	if (cu.loaded)
+	{
+		return;
+	}
+	cu.loaded = true;
+	++m_loadedCUs;
+
+	Dwarf_Die cuDie = nullptr;
+	m_res = dwarf_offdie_b(m_dbg, cu.dieOffset, is_info, &cuDie, &m_error);
+	if (m_res == DW_DLV_ERROR)
+	{
+		DWARF_ERROR("Libdwarf error: " << getDwarfError(m_error));
+		return;
+	}
+	else if (m_res == DW_DLV_NO_ENTRY)
+	{
+		return;
+	}
+
+	// Getters of containers are used during loading, they must not start
+	// loading of all CUs.
+	bool wasLoading = m_loadingCU;
+	m_loadingCU = true;
+
+	int lvl = 0;
+	loadCUtree(cuDie, nullptr, lvl);
+
+	m_loadingCU = wasLoading;
+
+	dwarf_dealloc(m_dbg, cuDie, DW_DLA_DIE);
+
+	makeStructTypesUnique();
+}
+
+/**
+ * @brief Get the number of all CUs in the file.
+ */
+std::size_t DwarfFile::getCUCount() const
+{
+	return m_cuIndex.size();
+}
+
+/**
+ * @brief Get the number of CUs whose contents are loaded.
+ */
+std::size_t DwarfFile::getLoadedCUCount() const
+{
+	return m_loadedCUs;
+}
+
+/**
+ * @brief Load contents of all CUs covering the given address. If there is no
+ *        such CU, CUs without known address ranges are loaded.
+ * @param addr Address to load CUs for.
+ * @return True if some CU covering the address is loaded, false otherwise.
+ */
+bool DwarfFile::loadCUsForAddress(Dwarf_Addr addr)
+{
+	bool found = false;
+	for (std::size_t i = 0; i < m_cuIndex.size(); ++i)
+	{
+		for (auto &r : m_cuIndex[i].ranges)
+		{
+			if (r.first <= addr && addr < r.second)
+			{
+				loadCU(i);
+				found = true;
+				break;
+			}
+		}
+	}
+
+	if (!found)
+	{
+		for (std::size_t i = 0; i < m_cuIndex.size(); ++i)
+		{
+			if (m_cuIndex[i].ranges.empty())
+			{
+				loadCU(i);
+			}
+		}
+	}
+
+	return found;
+}
+
+/**
+ * @brief Load contents of all CUs covering something with the given name.
+ *        Only CUs in which the name is declared outside of functions and
+ *        types (or in namespaces) are loaded.
+ * @param name Name or linkage name of function, variable or type.
+ * @return True if some CU declaring the name is loaded, false otherwise.
+ */
+bool DwarfFile::loadCUsForName(const std::string &name)
+{
+	indexGlobalDIEs();
+
+	auto fIt = m_nameToCUs.find(name);
+	if (fIt == m_nameToCUs.end())
+	{
+		return false;
+	}
+
+	for (auto i : fIt->second)
+	{
+		loadCU(i);
+	}
+	return true;
+}
+
+/**
+ * @brief Load contents of CUs with indexes in [first, last) which are not
+ *        loaded yet.
+ * @param first Index of the first CU to load.
+ * @param last Index after the last CU to load.
+ */
+void DwarfFile::loadCUs(std::size_t first, std::size_t last)
+{
+	for (std::size_t i = first; i < last && i < m_cuIndex.size(); ++i)
+	{
+		loadCU(i);
+	}
+}
+
+/**
+ * @brief Load contents of all CUs which are not loaded yet.
+ * @param threadPool Threads to load CUs by (@c nullptr to load serially).
+ */
+void DwarfFile::loadAllCUs(retdec::utils::ThreadPool *threadPool)
+{
+	std::vector<std::size_t> indexes;
+	for (std::size_t i = 0; i < m_cuIndex.size(); ++i)
+	{
+		if (!m_cuIndex[i].loaded)
+		{
+			indexes.push_back(i);
+		}
+	}
+
+	if (threadPool && threadPool->getThreadCount() > 1 && indexes.size() > 1)
+	{
+		loadCUsInParallel(indexes, *threadPool);
+	}
+	else
+	{
+		for (auto i : indexes)
+		{
+			loadCU(i);
+		}
+	}
+}
+
+/**
+ * @brief Load contents of CUs with the given indexes in parallel.
+ * @param indexes Indexes of CUs which are not loaded yet, in ascending order.
+ * @param threadPool Threads to load CUs by.
+ *
+ * Libdwarf instance can not be used by several threads, so the CUs are split
+ * into consecutive slices and every slice is loaded by its own lazy file.
+ * Loaded elements are then moved to containers of this file in the order of
+ * CUs, and struct types are renamed as if the CUs were loaded here serially.
+ * Types referenced from other CUs are loaded by every slice referencing them.
+ */
+void DwarfFile::loadCUsInParallel(
+		const std::vector<std::size_t> &indexes,
+		retdec::utils::ThreadPool &threadPool)
+{
+	std::size_t sliceCount = std::min(threadPool.getThreadCount(), indexes.size());
+	std::vector<std::unique_ptr<DwarfFile>> slices;
+	for (std::size_t s = 0; s < sliceCount; ++s)
+	{
+		std::unique_ptr<DwarfFile> slice(new DwarfFile(m_fileName, m_fileParser, true));
+		if (!slice->hasDwarfInfo() || slice->getCUCount() != getCUCount())
+		{
+			DWARF_WARNING("CUs can not be loaded in parallel.");
+			for (auto i : indexes)
+			{
+				loadCU(i);
+			}
 			return;
 		}
 
-		int lvl = 0;
-		loadCUtree(cuDie, nullptr, lvl);
+		slice->m_makeStructTypesUnique = false;
+		slice->resources = resources;
+		slices.push_back(std::move(slice));
+	}
+
+	auto sliceBegin = [&](std::size_t s) {
+		return s * indexes.size() / sliceCount;
+	};
+
+	threadPool.parallelFor(sliceCount, [&](std::size_t s) {
+		for (std::size_t i = sliceBegin(s); i < sliceBegin(s + 1); ++i)
+		{
+			slices[s]->loadCU(indexes[i]);
+		}
+	});
+
+	for (std::size_t s = 0; s < sliceCount; ++s)
+	{
+		for (std::size_t i = sliceBegin(s); i < sliceBegin(s + 1); ++i)
+		{
+			m_cuIndex[indexes[i]].loaded = true;
+			++m_loadedCUs;
+		}
+
+		auto &slice = *slices[s];
+		m_CUs.takeElementsOf(slice.m_CUs);
+		m_lines.takeElementsOf(slice.m_lines);
+		m_functions.takeElementsOf(slice.m_functions);
+		m_types.takeElementsOf(slice.m_types);
+		m_globalVars.takeElementsOf(slice.m_globalVars);
+		m_slices.push_back(std::move(slices[s]));
+	}
+
+	makeStructTypesUnique();
+}
+
+/**
+ * @brief Load all CUs unless some CU is being loaded right now.
+ */
+void DwarfFile::loadAllCUsIfNotLoading()
+{
+	if (!m_loadingCU)
+	{
+		loadAllCUs();
+	}
+}
+
+/**
+ * @brief Get function starting at the given address. Only CUs covering the
+ *        address are loaded.
+ * @param addr Lowest address of function.
+ * @return Function or nullptr if there is no such function.
+ */
+DwarfFunction *DwarfFile::getFunction(Dwarf_Addr addr)
+{
+	loadCUsForAddress(addr);
+	indexFunctions();
+
+	auto fIt = m_addrToFunction.find(addr);
+	return fIt != m_addrToFunction.end() ? fIt->second : nullptr;
+}
+
+/**
+ * @brief Get function with the given name. Only CUs declaring the name are
+ *        loaded (see loadCUsForName()).
+ * @param name Name or linkage name of function.
+ * @return Function or nullptr if there is no such function. If there are
+ *         several of them, the first loaded one is returned.
+ */
+DwarfFunction *DwarfFile::getFunction(const std::string &name)
+{
+	loadCUsForName(name);
+	indexFunctions();
+
+	auto fIt = m_nameToFunction.find(name);
+	return fIt != m_nameToFunction.end() ? fIt->second : nullptr;
+}
+
+/**
+ * @brief Get global variable at the given address. Only CUs defining a global
+ *        variable at the address are loaded. If there is no such CU, CUs with
+ *        global variables whose addresses are not known without loading them
+ *        are loaded.
+ * @param addr Address of global variable.
+ * @return Global variable or nullptr if there is no such variable.
+ */
+DwarfVar *DwarfFile::getGlobalVar(Dwarf_Addr addr)
+{
+	indexGlobalDIEs();
+
+	auto fIt = m_globalAddrToCUs.find(addr);
+	if (fIt != m_globalAddrToCUs.end())
+	{
+		for (auto i : fIt->second)
+		{
+			loadCU(i);
+		}
+	}
+	else
+	{
+		for (std::size_t i = 0; i < m_cuIndex.size(); ++i)
+		{
+			if (m_cuIndex[i].hasUnindexedGlobals)
+			{
+				loadCU(i);
+			}
+		}
+	}
+
+	indexGlobalVars();
+
+	auto vIt = m_addrToGlobalVar.find(addr);
+	return vIt != m_addrToGlobalVar.end() ? vIt->second : nullptr;
+}
+
+/**
+ * @brief Get line numbers by their addresses in all loaded CUs. No CU is
+ *        loaded. If there are more lines at one address, the last loaded
+ *        one is used.
+ */
+const std::map<Dwarf_Addr, Dwarf_Unsigned> &DwarfFile::getLoadedLineNumbers()
+{
+	for (; m_indexedLinesCount < m_lines.size(); ++m_indexedLinesCount)
+	{
+		auto *l = *(m_lines.begin() + m_indexedLinesCount);
+		m_addrToLine[l->addr] = l->lineNum;
+	}
+
+	return m_addrToLine;
+}
+
+/**
+ * @brief Add functions loaded since the last call to indexes of functions.
+ *        Only defined functions are indexed.
+ */
+void DwarfFile::indexFunctions()
+{
+	for (; m_indexedFunctionsCount < m_functions.size(); ++m_indexedFunctionsCount)
+	{
+		auto *f = *(m_functions.begin() + m_indexedFunctionsCount);
+		if (f->lowAddr > 0)
+		{
+			m_addrToFunction.emplace(f->lowAddr, f);
+			m_nameToFunction.emplace(f->name, f);
+			if (!f->linkageName.empty())
+			{
+				m_nameToFunction.emplace(f->linkageName, f);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Add global variables loaded since the last call to the index of
+ *        global variables.
+ */
+void DwarfFile::indexGlobalVars()
+{
+	for (; m_indexedGlobalVarsCount < m_globalVars.size(); ++m_indexedGlobalVarsCount)
+	{
+		auto *v = *(m_globalVars.begin() + m_indexedGlobalVarsCount);
+		if (v->location == nullptr || !v->location->isNormal())
+		{
+			continue;
+		}
+
+		std::string n;
+		Dwarf_Addr addr = 0;
+		if (v->getLocation(&n, &addr).isAddress())
+		{
+			m_addrToGlobalVar.emplace(addr, v);
+		}
+	}
+}
+
+/**
+ * @brief Index CUs by names declared in them and by addresses of global
+ *        variables defined in them. CUs are not loaded, only DIEs directly
+ *        in CUs or in namespaces are read. It is done only once.
+ */
+void DwarfFile::indexGlobalDIEs()
+{
+	if (m_globalDIEsIndexed)
+	{
+		return;
+	}
+	m_globalDIEsIndexed = true;
+
+	for (std::size_t i = 0; i < m_cuIndex.size(); ++i)
+	{
+		Dwarf_Die cuDie = nullptr;
+		m_res = dwarf_offdie_b(m_dbg, m_cuIndex[i].dieOffset, is_info, &cuDie, &m_error);
+		if (m_res == DW_DLV_ERROR)
+		{
+			DWARF_ERROR("Libdwarf error: " << getDwarfError(m_error));
+			continue;
+		}
+		else if (m_res == DW_DLV_NO_ENTRY)
+		{
+			continue;
+		}
+
+		Dwarf_Die child = nullptr;
+		if (dwarf_child(cuDie, &child, &m_error) == DW_DLV_OK)
+		{
+			indexGlobalDIE(child, i);
+		}
 
 		dwarf_dealloc(m_dbg, cuDie, DW_DLA_DIE);
 	}
 }
 
+/**
+ * @brief Index the given DIE, its siblings and DIEs in namespaces among them.
+ * @param die The first DIE to index. It is deallocated.
+ * @param cuIndex Index of CU containing the DIE.
+ */
+void DwarfFile::indexGlobalDIE(Dwarf_Die die, std::size_t cuIndex)
+{
+	while (die)
+	{
+		Dwarf_Half tag = 0;
+		if (dwarf_tag(die, &tag, &m_error) == DW_DLV_OK)
+		{
+			if (tag == DW_TAG_namespace)
+			{
+				Dwarf_Die child = nullptr;
+				if (dwarf_child(die, &child, &m_error) == DW_DLV_OK)
+				{
+					indexGlobalDIE(child, cuIndex);
+				}
+			}
+			else
+			{
+				addNamesOfDIE(die, cuIndex);
+			}
+
+			if (tag == DW_TAG_variable)
+			{
+				AttrProcessor ap(m_dbg, die, this);
+				DwarfLocationDesc *loc = nullptr;
+				if (ap.get(DW_AT_location, loc) && loc != nullptr)
+				{
+					Dwarf_Addr addr = 0;
+					if (loc->getStaticAddress(&addr))
+					{
+						auto &cus = m_globalAddrToCUs[addr];
+						if (cus.empty() || cus.back() != cuIndex)
+						{
+							cus.push_back(cuIndex);
+						}
+					}
+					else
+					{
+						m_cuIndex[cuIndex].hasUnindexedGlobals = true;
+					}
+				}
+				delete loc;
+			}
+		}
+
+		Dwarf_Die sibling = nullptr;
+		if (dwarf_siblingof_b(m_dbg, die, is_info, &sibling, &m_error) != DW_DLV_OK)
+		{
+			sibling = nullptr;
+		}
+		dwarf_dealloc(m_dbg, die, DW_DLA_DIE);
+		die = sibling;
+	}
+}
+
+/**
+ * @brief Index CU by names and linkage names of the given DIE. Definitions of
+ *        things declared elsewhere are indexed by names of the declarations.
+ * @param die DIE whose names to index.
+ * @param cuIndex Index of CU containing the DIE.
+ */
+void DwarfFile::addNamesOfDIE(Dwarf_Die die, std::size_t cuIndex)
+{
+	auto addNames = [this, cuIndex](Dwarf_Die d) {
+		AttrProcessor ap(m_dbg, d, this);
+		for (Dwarf_Half attrCode : {DW_AT_name, DW_AT_linkage_name, DW_AT_MIPS_linkage_name})
+		{
+			std::string name;
+			if (ap.get(attrCode, name) && !name.empty())
+			{
+				auto &cus = m_nameToCUs[name];
+				if (cus.empty() || cus.back() != cuIndex)
+				{
+					cus.push_back(cuIndex);
+				}
+			}
+		}
+	};
+
+	addNames(die);
+
+	AttrProcessor ap(m_dbg, die, this);
+	Dwarf_Off ref = EMPTY_UNSIGNED;
+	ap.get(DW_AT_abstract_origin, ref);
+	if (ref == EMPTY_UNSIGNED)
+	{
+		ap.get(DW_AT_specification, ref);
+	}
+
+	Dwarf_Die refDie = nullptr;
+	if (ref != EMPTY_UNSIGNED
+			&& dwarf_offdie_b(m_dbg, ref, is_info, &refDie, &m_error) == DW_DLV_OK)
+	{
+		addNames(refDie);
+		dwarf_dealloc(m_dbg, refDie, DW_DLA_DIE);
+	}
+}
+
 /**
  * @brief Gets a CU DIE at first and recursively load all DIEs in tree.
  * @param inDie Input die
@@ -658,6 +1267,7 @@ Dwarf_Debug &DwarfFile::getDwarfDebug()
  */
 DwarfCUContainer *DwarfFile::getCUs()
 {
+	loadAllCUsIfNotLoading();
 	return &m_CUs;
 }
 
@@ -667,6 +1277,7 @@ DwarfCUContainer *DwarfFile::getCUs()
  */
 DwarfLineContainer *DwarfFile::getLines()
 {
+	loadAllCUsIfNotLoading();
 	return &m_lines;
 }
 
@@ -676,6 +1287,7 @@ DwarfLineContainer *DwarfFile::getLines()
  */
 DwarfFunctionContainer *DwarfFile::getFunctions()
 {
+	loadAllCUsIfNotLoading();
 	return &m_functions;
 }
 
@@ -685,6 +1297,7 @@ DwarfFunctionContainer *DwarfFile::getFunctions()
  */
 DwarfTypeContainer *DwarfFile::getTypes()
 {
+	loadAllCUsIfNotLoading();
 	return &m_types;
 }
 
@@ -694,6 +1307,7 @@ DwarfTypeContainer *DwarfFile::getTypes()
  */
 DwarfVarContainer *DwarfFile::getGlobalVars()
 {
+	loadAllCUsIfNotLoading();
 	return &m_globalVars;
 }
 
@@ -172,6 +172,25 @@ bool DwarfLocationDesc::isNormal() const
 	return (count() == 1);
 }
 
+/**
+ * @brief Get address of location which consists only of DW_OP_addr.
+ *        Unlike computeLocation(), it does not need parent of this location.
+ * @param a Pointer to address that will be filled by method.
+ * @return True if location is a static address, false otherwise.
+ */
+bool DwarfLocationDesc::getStaticAddress(Dwarf_Addr *a) const
+{
+	if (!isNormal()
+			|| m_exprs[0].count() != 1
+			|| m_exprs[0].atoms[0].opcode != DW_OP_addr)
+	{
+		return false;
+	}
+
+	*a = m_exprs[0].atoms[0].op1;
+	return true;
+}
+
 /**
  * @brief Location description is list if it has multiple expression records.
  * @return True if list, false otherwise.
@@ -179,7 +179,8 @@ DwarfType *DwarfTypeContainer::loadAndGetDie(Dwarf_Die die, unsigned)
 		}
 	}
 
-	static std::map<Dwarf_Off, DwarfType*> inProgress;
+	// Several files may be loaded in parallel, see DwarfFile::loadAllCUs().
+	static thread_local std::map<Dwarf_Off, DwarfType*> inProgress;
 	auto fIt = inProgress.find(off);
 	if (fIt != inProgress.end())
 	{
@@ -798,11 +799,7 @@ void DwarfStructType::load(AttrProcessor &ap)
 {
 	this->DwarfType::load(ap);
 
-	static unsigned anonCntr = 0;
-	if (name.empty())
-	{
-		name = "anon_struct_" + std::to_string(anonCntr++);
-	}
+	// Anonymous structures are named by DwarfFile::makeStructTypesUnique().
 }
 
 /**
@@ -214,7 +214,8 @@ Symbol::UsageType getSymbolUsageType(std::uint8_t storageClass, std::uint8_t com
  * @param pathToFile Path to input file
  * @param loadFlags Load flags
  */
-CoffFormat::CoffFormat(std::string pathToFile, LoadFlags loadFlags) : FileFormat(pathToFile, loadFlags), fileBuffer(MemoryBuffer::getFile(Twine(pathToFile)))
+CoffFormat::CoffFormat(std::string pathToFile, LoadFlags loadFlags) : FileFormat(pathToFile, loadFlags),
+	fileBuffer(MemoryBuffer::getMemBuffer(StringRef(reinterpret_cast<const char*>(getBytesData()), getFileLength()), pathToFile, false))
 {
 	initStructures();
 }
@@ -10,11 +10,12 @@
 #include <cstring>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <sstream>
 
 #include <pelib/PeLibInc.h>
 
-#include "retdec/crypto/crypto.h"
+#include "retdec/crypto/multi_hash.h"
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/file_io.h"
 #include "retdec/utils/string.h"
@@ -68,45 +69,53 @@ bool isOffsetFromRegion(const SecSeg *actualRegion, const SecSeg *newRegion, std
 }
 
 /**
- * Decide whether @a address is part of region (section or segment) @a newRegion
- * @param actualRegion Region to which is address currently assigned (may be @c nullptr)
- * @param newRegion Currently examined region
- * @param address Address in memory
- * @return @c true if @a address is in range of @a newRegion and @a actualRegion is
- *    @c nullptr or @a newRegion is subset of @a actualRegion, @c false otherwise
+ * Get size of region (section or segment) in memory
+ * @param region Examined region
+ * @return Size in memory or size in file if size in memory is not known
  */
-bool isAddressFromRegion(const SecSeg *actualRegion, const SecSeg *newRegion, std::size_t address)
+unsigned long long getRegionMemorySize(const SecSeg *region)
 {
-	if(!newRegion)
+	unsigned long long size;
+	if(!region->getSizeInMemory(size))
 	{
-		return false;
+		size = region->getSizeInFile();
 	}
 
-	unsigned long long newRegionSize;
-	if(!newRegion->getSizeInMemory(newRegionSize))
-	{
-		newRegionSize = newRegion->getSizeInFile();
-	}
+	return size;
+}
 
-	unsigned long long actualRegionSize = 0;
-	if(actualRegion)
+/**
+ * Create address index of regions (sections or segments)
+ * @param regions Regions to index
+ * @param index Into this parameter is stored created index
+ *
+ * If address is part of several regions, index returns the one with the highest
+ * start address. If they start on the same address, the smaller one is returned.
+ */
+template<typename T> void buildRegionIndex(const std::vector<T*> &regions, IntervalIndex<const T*> &index)
+{
+	std::vector<typename IntervalIndex<const T*>::Interval> intervals;
+	for(const auto *region : regions)
 	{
-		if(!actualRegion->getSizeInMemory(actualRegionSize))
+		const auto size = region ? getRegionMemorySize(region) : 0;
+		if(!size || !region->getMemory())
 		{
-			actualRegionSize = actualRegion->getSizeInFile();
+			continue;
 		}
+
+		const auto first = region->getAddress();
+		const auto last = size - 1 > std::numeric_limits<std::uint64_t>::max() - first
+			? std::numeric_limits<std::uint64_t>::max() : first + (size - 1);
+		intervals.push_back({first, last, region});
 	}
 
-	if(newRegion->getMemory() && address >= newRegion->getAddress() && address - newRegion->getAddress() < newRegionSize)
-	{
-		if(!actualRegion || (newRegion->getAddress() > actualRegion->getAddress() ||
-			(newRegion->getAddress() == actualRegion->getAddress() && newRegionSize < actualRegionSize)))
+	index.build(intervals,
+		[] (const auto &i1, const auto &i2)
 		{
-			return true;
+			return i1.first > i2.first ||
+				(i1.first == i2.first && getRegionMemorySize(i1.value) < getRegionMemorySize(i2.value));
 		}
-	}
-
-	return false;
+	);
 }
 
 } // anonymous namespace
@@ -116,8 +125,9 @@ bool isAddressFromRegion(const SecSeg *actualRegion, const SecSeg *newRegion, st
  * @param inputStream Stream which represents input file
  * @param loadFlags Load flags
  */
-FileFormat::FileFormat(std::istream &inputStream, LoadFlags loadFlags) : loadedBytes(&bytes),
-	loadFlags(loadFlags), fileStream(inputStream), _ldrErrInfo()
+FileFormat::FileFormat(std::istream &inputStream, LoadFlags loadFlags) : loadedBytes(nullptr),
+	loadFlags(loadFlags), indexedSections(std::numeric_limits<std::size_t>::max()),
+	indexedSegments(std::numeric_limits<std::size_t>::max()), fileStream(inputStream), _ldrErrInfo()
 {
 	stateIsValid = !inputStream.fail();
 	init();
@@ -128,8 +138,9 @@ FileFormat::FileFormat(std::istream &inputStream, LoadFlags loadFlags) : loadedB
  * @param pathToFile Path to input file
  * @param loadFlags Load flags
  */
-FileFormat::FileFormat(std::string pathToFile, LoadFlags loadFlags) : loadedBytes(&bytes),
-	loadFlags(loadFlags), filePath(pathToFile), fileStream(auxStream), _ldrErrInfo()
+FileFormat::FileFormat(std::string pathToFile, LoadFlags loadFlags) : loadedBytes(nullptr),
+	loadFlags(loadFlags), indexedSections(std::numeric_limits<std::size_t>::max()),
+	indexedSegments(std::numeric_limits<std::size_t>::max()), filePath(pathToFile), fileStream(auxStream), _ldrErrInfo()
 {
 	auxStream.open(filePath, std::ifstream::binary);
 	stateIsValid = auxStream.is_open();
@@ -158,7 +169,19 @@ void FileFormat::init()
 	certificateTable = nullptr;
 	elfCoreInfo = nullptr;
 	fileFormat = Format::UNDETECTABLE;
-	stateIsValid = readFile(fileStream, bytes) && stateIsValid;
+	// Inputs given by path are mapped into memory, so their content is never
+	// copied. Streams (and files which cannot be mapped) are read into bytes.
+	if(filePath.empty() || !mappedFile.open(filePath))
+	{
+		stateIsValid = readFile(fileStream, bytes) && stateIsValid;
+	}
+	else
+	{
+		// Parsers reading the file stream (e.g. ELFIO) read the mapping too.
+		mappedStreamBuffer = std::make_unique<retdec::utils::MemoryStreamBuffer>(
+			mappedFile.getData(), mappedFile.getSize());
+		static_cast<std::istream&>(auxStream).rdbuf(mappedStreamBuffer.get());
+	}
 	if (getLoadFlags() & LoadFlags::NO_FILE_HASHES)
 	{
 		crc32.clear();
@@ -167,9 +190,11 @@ void FileFormat::init()
 	}
 	else
 	{
-		crc32 = retdec::crypto::getCrc32(bytes.data(), bytes.size());
-		md5 = retdec::crypto::getMd5(bytes.data(), bytes.size());
-		sha256 = retdec::crypto::getSha256(bytes.data(), bytes.size());
+		auto digests = retdec::crypto::computeDigests(getBytesData(), getFileLength(),
+				retdec::crypto::DIGEST_CRC32 | retdec::crypto::DIGEST_MD5 | retdec::crypto::DIGEST_SHA256);
+		crc32 = std::move(digests.crc32);
+		md5 = std::move(digests.md5);
+		sha256 = std::move(digests.sha256);
 	}
 	initStream();
 }
@@ -183,6 +208,29 @@ void FileFormat::initStream()
 	fileStream.seekg(0);
 }
 
+/**
+ * Append bytes to the end of member @c bytes
+ * @param data Bytes to append
+ * @param size Number of bytes to append
+ *
+ * If input file is memory-mapped, its content is copied into member @c bytes
+ * and the file is unmapped first, because the mapping cannot grow. Member
+ * @c fileStream then reads the file itself again.
+ */
+void FileFormat::appendBytes(const unsigned char *data, std::size_t size)
+{
+	if(mappedFile.isOpen())
+	{
+		const auto *mappedData = mappedFile.getData();
+		bytes.assign(mappedData, mappedData + mappedFile.getSize());
+		static_cast<std::istream&>(auxStream).rdbuf(auxStream.rdbuf());
+		mappedStreamBuffer.reset();
+		mappedFile.close();
+	}
+
+	bytes.insert(bytes.end(), data, data + size);
+}
+
 /**
  * Provides architecture information for formats which do not store such information eg. Intel HEX
  * @param derivedPtr Pointer to derived FileFormat class
@@ -278,6 +326,47 @@ void FileFormat::clear()
 	symbolTables.clear();
 	relocationTables.clear();
 	dynamicTables.clear();
+	invalidateAddressIndex();
+}
+
+/**
+ * Mark address index of sections and segments as outdated
+ *
+ * Index is rebuilt automatically when number of sections or segments changes.
+ * This method must be called if address or size of already loaded section
+ * or segment is changed.
+ */
+void FileFormat::invalidateAddressIndex()
+{
+	indexedSections = std::numeric_limits<std::size_t>::max();
+	indexedSegments = std::numeric_limits<std::size_t>::max();
+}
+
+/**
+ * Check if address index corresponds to current sections and segments
+ * @return @c true if index can be used, @c false otherwise
+ */
+bool FileFormat::isAddressIndexValid() const
+{
+	return indexedSections.load(std::memory_order_acquire) == sections.size()
+		&& indexedSegments.load(std::memory_order_acquire) == segments.size();
+}
+
+/**
+ * Build address index of sections and segments if it is outdated
+ */
+void FileFormat::buildAddressIndex() const
+{
+	std::lock_guard<std::mutex> lock(addressIndexMutex);
+	if(isAddressIndexValid())
+	{
+		return;
+	}
+
+	buildRegionIndex(sections, sectionAddressIndex);
+	buildRegionIndex(segments, segmentAddressIndex);
+	indexedSections.store(sections.size(), std::memory_order_release);
+	indexedSegments.store(segments.size(), std::memory_order_release);
 }
 
 /**
@@ -328,9 +417,11 @@ void FileFormat::computeSectionTableHashes()
 
 	if(!data.empty())
 	{
-		sectionCrc32 = retdec::crypto::getCrc32(data.data(), data.size());
-		sectionMd5 = retdec::crypto::getMd5(data.data(), data.size());
-		sectionSha256 = retdec::crypto::getSha256(data.data(), data.size());
+		auto digests = retdec::crypto::computeDigests(data.data(), data.size(),
+				retdec::crypto::DIGEST_CRC32 | retdec::crypto::DIGEST_MD5 | retdec::crypto::DIGEST_SHA256);
+		sectionCrc32 = std::move(digests.crc32);
+		sectionMd5 = std::move(digests.md5);
+		sectionSha256 = std::move(digests.sha256);
 	}
 }
 
@@ -593,17 +684,12 @@ bool FileFormat::haveDataOnOffset(unsigned long long offset) const
  */
 const Section* FileFormat::getSectionFromAddress(unsigned long long address) const
 {
-	const Section *actSec = nullptr;
-
-	for(const auto *item : sections)
+	if(!isAddressIndexValid())
 	{
-		if(isAddressFromRegion(actSec, item, address))
-		{
-			actSec = item;
-		}
+		buildAddressIndex();
 	}
 
-	return actSec;
+	return sectionAddressIndex.find(address);
 }
 
 /**
@@ -614,17 +700,12 @@ const Section* FileFormat::getSectionFromAddress(unsigned long long address) con
  */
 const Segment* FileFormat::getSegmentFromAddress(unsigned long long address) const
 {
-	const Segment *actSeg = nullptr;
-
-	for(const auto *item : segments)
+	if(!isAddressIndexValid())
 	{
-		if(isAddressFromRegion(actSeg, item, address))
-		{
-			actSeg = item;
-		}
+		buildAddressIndex();
 	}
 
-	return actSeg;
+	return segmentAddressIndex.find(address);
 }
 
 /**
@@ -1067,7 +1148,7 @@ std::size_t FileFormat::getNumberOfDynamicTables() const
  */
 std::size_t FileFormat::getFileLength() const
 {
-	return bytes.size();
+	return mappedFile.isOpen() ? mappedFile.getSize() : bytes.size();
 }
 
 /**
@@ -1076,7 +1157,7 @@ std::size_t FileFormat::getFileLength() const
  */
 std::size_t FileFormat::getLoadedFileLength() const
 {
-	return loadedBytes->size();
+	return loadedBytes ? loadedBytes->size() : getFileLength();
 }
 
 /**
@@ -1177,10 +1258,8 @@ bool FileFormat::getBytes(std::vector<std::uint8_t> &result, unsigned long long
 		return false;
 	}
 
-	numberOfBytes = offset + numberOfBytes > getLoadedFileLength() ? getLoadedFileLength() - offset : numberOfBytes;
-	result.clear();
-	result.reserve(numberOfBytes);
-	std::copy(loadedBytes->begin() + offset, loadedBytes->begin() + offset + numberOfBytes, std::back_inserter(result));
+	const auto view = getBytesView(offset, numberOfBytes);
+	result.assign(view.begin(), view.end());
 	return true;
 }
 
@@ -1207,6 +1286,44 @@ bool FileFormat::getEpBytes(std::vector<std::uint8_t> &result, unsigned long lon
 	return false;
 }
 
+/**
+ * Get view of bytes from specified offset without copying them
+ * @param offset Start offset for read
+ * @param numberOfBytes Number of bytes for read
+ * @return View of bytes (valid as long as this instance exists)
+ *
+ * If there are less than @a numberOfBytes bytes after @a offset, view is shortened.
+ * If @a offset is out of file, empty view is returned.
+ */
+llvm::ArrayRef<std::uint8_t> FileFormat::getBytesView(unsigned long long offset, unsigned long long numberOfBytes) const
+{
+	if(offset >= getLoadedFileLength())
+	{
+		return {};
+	}
+
+	numberOfBytes = std::min(numberOfBytes, static_cast<unsigned long long>(getLoadedFileLength() - offset));
+	return llvm::ArrayRef<std::uint8_t>(getLoadedBytesData() + offset, numberOfBytes);
+}
+
+/**
+ * Get view of bytes from entry point without copying them
+ * @param numberOfBytes Number of bytes for read
+ * @return View of bytes (valid as long as this instance exists)
+ *
+ * If file has no entry point or entry point has not detected, empty view is returned.
+ */
+llvm::ArrayRef<std::uint8_t> FileFormat::getEpBytesView(unsigned long long numberOfBytes) const
+{
+	unsigned long long epOffset;
+	if(stateIsValid && getEpOffset(epOffset))
+	{
+		return getBytesView(epOffset, numberOfBytes);
+	}
+
+	return {};
+}
+
 /**
  * Get bytes from specified offset in hexadecimal string representation
  * @param result Read bytes in hexadecimal string representation
@@ -1216,7 +1333,7 @@ bool FileFormat::getEpBytes(std::vector<std::uint8_t> &result, unsigned long lon
  */
 bool FileFormat::getHexBytes(std::string &result, unsigned long long offset, unsigned long long numberOfBytes) const
 {
-	bytesToHexString(*loadedBytes, result, offset, numberOfBytes);
+	bytesToHexString(getLoadedBytesData(), getLoadedFileLength(), result, offset, numberOfBytes);
 	return offset < getLoadedFileLength();
 }
 
@@ -1267,7 +1384,7 @@ bool FileFormat::getHexBytesFromEnd(std::string &result, unsigned long long numb
  */
 bool FileFormat::getString(std::string &result, unsigned long long offset, unsigned long long numberOfBytes) const
 {
-	bytesToString(*loadedBytes, result, offset, numberOfBytes);
+	bytesToString(getLoadedBytesData(), getLoadedFileLength(), result, offset, numberOfBytes);
 	return offset < getLoadedFileLength();
 }
 
@@ -1825,20 +1942,22 @@ const std::vector<DynamicTable*>& FileFormat::getDynamicTables() const
 
 /**
  * Get content of input file as bytes
- * @return Content of input file as bytes
+ * @return View of content of input file, valid during the whole lifetime of
+ *    this instance
  */
-const std::vector<unsigned char>& FileFormat::getBytes() const
+llvm::ArrayRef<unsigned char> FileFormat::getBytes() const
 {
-	return bytes;
+	return llvm::ArrayRef<unsigned char>(getBytesData(), getFileLength());
 }
 
 /**
  * Get serialized loaded content of input file as bytes
- * @return Serialized content of input file as bytes
+ * @return View of serialized content of input file, valid during the whole
+ *    lifetime of this instance
  */
-const std::vector<unsigned char>& FileFormat::getLoadedBytes() const
+llvm::ArrayRef<unsigned char> FileFormat::getLoadedBytes() const
 {
-	return *loadedBytes;
+	return llvm::ArrayRef<unsigned char>(getLoadedBytesData(), getLoadedFileLength());
 }
 
 /**
@@ -1847,7 +1966,7 @@ const std::vector<unsigned char>& FileFormat::getLoadedBytes() const
  */
 const unsigned char* FileFormat::getBytesData() const
 {
-	return bytes.data();
+	return mappedFile.isOpen() ? mappedFile.getData() : bytes.data();
 }
 
 /**
@@ -1856,7 +1975,7 @@ const unsigned char* FileFormat::getBytesData() const
  */
 const unsigned char* FileFormat::getLoadedBytesData() const
 {
-	return loadedBytes->data();
+	return loadedBytes ? loadedBytes->data() : getBytesData();
 }
 
 /**
@@ -1906,7 +2025,32 @@ bool FileFormat::getXByte(std::uint64_t address, std::uint64_t x, std::uint64_t
 	const auto secOffset = address - secSeg->getAddress();
 	const auto offset = secSeg->getOffset() + secOffset;
 	return (secOffset + x > secSeg->getLoadedSize() || offset + x > getLoadedFileLength()) ?
-		false : createValueFromBytes(*loadedBytes, res, e, offset, x);
+		false : createValueFromBytes(getLoadedBytesData(), getLoadedFileLength(), res, e, offset, x);
+}
+
+/**
+ * Get view of @a x bytes located at specified address without copying them
+ * @param address Address of the first byte
+ * @param x Number of bytes
+ * @return View of exactly @a x bytes or empty view if they are not all loaded
+ *    from file (valid as long as this instance exists)
+ */
+llvm::ArrayRef<std::uint8_t> FileFormat::getXBytesView(std::uint64_t address, std::uint64_t x) const
+{
+	const auto *secSeg = getSectionOrSegmentFromAddress(address);
+	if(!secSeg)
+	{
+		return {};
+	}
+
+	const auto secOffset = address - secSeg->getAddress();
+	const auto offset = secSeg->getOffset() + secOffset;
+	if(secOffset + x > secSeg->getLoadedSize() || offset + x > getLoadedFileLength())
+	{
+		return {};
+	}
+
+	return llvm::ArrayRef<std::uint8_t>(getLoadedBytesData() + offset, x);
 }
 
 /**
@@ -2046,7 +2190,7 @@ bool FileFormat::getXByteOffset(std::uint64_t offset, std::uint64_t x, std::uint
 		return true;
 	}
 
-	return createValueFromBytes(*loadedBytes, res, e, offset, x);
+	return createValueFromBytes(getLoadedBytesData(), getLoadedFileLength(), res, e, offset, x);
 }
 
 /**
@@ -2061,7 +2205,7 @@ bool FileFormat::getXBytesOffset(std::uint64_t offset, std::uint64_t x, std::vec
 	res.clear();
 	if(offset + x <= getLoadedFileLength())
 	{
-		res.assign(loadedBytes->begin() + offset, loadedBytes->begin() + offset + x);
+		res.assign(getLoadedBytesData() + offset, getLoadedBytesData() + offset + x);
 		return res.size() == x;
 	}
 
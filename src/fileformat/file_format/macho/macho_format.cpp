@@ -67,7 +67,8 @@ std::string getVersionFromDWord(const std::uint32_t version)
  * @param loadFlags Load flags
  */
 MachOFormat::MachOFormat(std::string pathToFile, LoadFlags loadFlags) : FileFormat(pathToFile, loadFlags),
-	fileBuffer(MemoryBuffer::getFile(Twine(filePath))), file(nullptr), fatFile(nullptr)
+	fileBuffer(MemoryBuffer::getMemBuffer(StringRef(reinterpret_cast<const char*>(getBytesData()), getFileLength()), filePath, false)),
+	file(nullptr), fatFile(nullptr)
 {
 	initStructures();
 }
@@ -122,7 +123,6 @@ bool MachOFormat::chooseArchitecture(const llvm::object::MachOUniversalBinary::o
 
 		chosenArchOffset = itr->getOffset();
 		chosenArchSize = itr->getSize();
-		chosenArchBytes.assign(getLoadedBytes().begin() + chosenArchOffset, getLoadedBytes().begin() + chosenArchOffset + chosenArchSize);
 		return true;
 	}
 
@@ -513,7 +513,7 @@ void PeFormat::loadRichHeader()
 	}
 
 	std::string plainText;
-	bytesToString(bytes, plainText, getMzHeaderSize(), getPeHeaderOffset() - getMzHeaderSize());
+	bytesToString(getBytesData(), getFileLength(), plainText, getMzHeaderSize(), getPeHeaderOffset() - getMzHeaderSize());
 	auto offset = getRichHeaderOffset(plainText);
 	auto standardOffset = (offset == STANDARD_RICH_HEADER_OFFSET);
 	if(offset >= getPeHeaderOffset())
@@ -1362,12 +1362,12 @@ std::vector<std::tuple<const std::uint8_t*, std::size_t>> PeFormat::getDigestRan
 	for (auto& offsetSize : offsets)
 	{
 		// If the length of the range is bigger than the amount of data we have available, then sanitize the length
-		if (offsetSize.second > bytes.size())
-			offsetSize.second = bytes.size();
+		if (offsetSize.second > getFileLength())
+			offsetSize.second = getFileLength();
 
 		// If the range overlaps the end of the file, then sanitize the length
-		if (offsetSize.first + offsetSize.second > bytes.size())
-			offsetSize.second = bytes.size() - offsetSize.first;
+		if (offsetSize.first + offsetSize.second > getFileLength())
+			offsetSize.second = getFileLength() - offsetSize.first;
 
 		// This offsetSize is completely covered by the last offset so ignore it
 		if (offsetSize.first + offsetSize.second <= lastOffset)
@@ -1381,13 +1381,13 @@ std::vector<std::tuple<const std::uint8_t*, std::size_t>> PeFormat::getDigestRan
 			offsetSize.first = lastOffset;
 		}
 
-		result.emplace_back(bytes.data() + lastOffset, offsetSize.first - lastOffset);
+		result.emplace_back(getBytesData() + lastOffset, offsetSize.first - lastOffset);
 		lastOffset = offsetSize.first + offsetSize.second;
 	}
 
 	// Finish off the data if the last offset didn't end at the end of all data
-	if (lastOffset != bytes.size())
-		result.emplace_back(bytes.data() + lastOffset, bytes.size() - lastOffset);
+	if (lastOffset != getFileLength())
+		result.emplace_back(getBytesData() + lastOffset, getFileLength() - lastOffset);
 
 	return result;
 }
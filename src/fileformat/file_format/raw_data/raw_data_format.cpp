@@ -53,8 +53,8 @@ void RawDataFormat::initStructures()
 	section->setOffset(0);
 	section->setAddress(0);
 	section->setMemory(true);
-	section->setSizeInFile(bytes.size());
-	section->setSizeInMemory(bytes.size());
+	section->setSizeInFile(getFileLength());
+	section->setSizeInMemory(getFileLength());
 	section->load(this);
 	sections.push_back(section);
 	computeSectionTableHashes();
@@ -72,7 +72,7 @@ std::size_t RawDataFormat::initSectionTableHashOffsets()
  */
 bool RawDataFormat::isEntryPointValid() const
 {
-	if((epAddress >= section->getAddress()) && (epAddress < section->getAddress() + bytes.size()))
+	if((epAddress >= section->getAddress()) && (epAddress < section->getAddress() + getFileLength()))
 	{
 		return true;
 	}
@@ -256,6 +256,7 @@ void RawDataFormat::setEntryPoint(Address entryPoint)
 void RawDataFormat::setBaseAddress(Address baseAddress)
 {
 	section->setAddress(baseAddress);
+	invalidateAddressIndex();
 }
 
 /**
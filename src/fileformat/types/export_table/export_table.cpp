@@ -4,7 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
-#include "retdec/crypto/crypto.h"
+#include "retdec/crypto/multi_hash.h"
 #include "retdec/utils/string.h"
 #include "retdec/utils/conversion.h"
 #include "retdec/fileformat/types/export_table/export_table.h"
@@ -179,9 +179,11 @@ void ExportTable::computeHashes()
 		}
 	}
 
-	expHashCrc32 = retdec::crypto::getCrc32(expHashBytes.data(), expHashBytes.size());
-	expHashMd5 = retdec::crypto::getMd5(expHashBytes.data(), expHashBytes.size());
-	expHashSha256 = retdec::crypto::getSha256(expHashBytes.data(), expHashBytes.size());
+	auto digests = retdec::crypto::computeDigests(expHashBytes.data(), expHashBytes.size(),
+			retdec::crypto::DIGEST_CRC32 | retdec::crypto::DIGEST_MD5 | retdec::crypto::DIGEST_SHA256);
+	expHashCrc32 = std::move(digests.crc32);
+	expHashMd5 = std::move(digests.md5);
+	expHashSha256 = std::move(digests.sha256);
 }
 
 /**
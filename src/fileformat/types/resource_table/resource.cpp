@@ -6,7 +6,7 @@
 
 #include <algorithm>
 
-#include "retdec/crypto/crypto.h"
+#include "retdec/crypto/multi_hash.h"
 #include "retdec/utils/conversion.h"
 #include "retdec/fileformat/file_format/file_format.h"
 #include "retdec/fileformat/types/resource_table/resource.h"
@@ -446,9 +446,11 @@ void Resource::load(const FileFormat *rOwner)
 
 	if (!(rOwner->getLoadFlags() & LoadFlags::NO_VERBOSE_HASHES))
 	{
-		crc32 = retdec::crypto::getCrc32(origBytes, bytes.size());
-		md5 = retdec::crypto::getMd5(origBytes, bytes.size());
-		sha256 = retdec::crypto::getSha256(origBytes, bytes.size());
+		auto digests = retdec::crypto::computeDigests(origBytes, bytes.size(),
+				retdec::crypto::DIGEST_CRC32 | retdec::crypto::DIGEST_MD5 | retdec::crypto::DIGEST_SHA256);
+		crc32 = std::move(digests.crc32);
+		md5 = std::move(digests.md5);
+		sha256 = std::move(digests.sha256);
 	}
 }
 
@@ -7,7 +7,7 @@
 #include <sstream>
 #include <iostream>
 
-#include "retdec/crypto/crypto.h"
+#include "retdec/crypto/multi_hash.h"
 #include "retdec/utils/conversion.h"
 #include "retdec/fileformat/types/resource_table/resource_table.h"
 #include "retdec/fileformat/types/resource_table/bitmap_image.h"
@@ -335,9 +335,11 @@ void ResourceTable::computeIconHashes()
 		return;
 	}
 
-	iconHashCrc32 = retdec::crypto::getCrc32(iconHashBytes.data(), iconHashBytes.size());
-	iconHashMd5 = retdec::crypto::getMd5(iconHashBytes.data(), iconHashBytes.size());
-	iconHashSha256 = retdec::crypto::getSha256(iconHashBytes.data(), iconHashBytes.size());
+	auto digests = retdec::crypto::computeDigests(iconHashBytes.data(), iconHashBytes.size(),
+			retdec::crypto::DIGEST_CRC32 | retdec::crypto::DIGEST_MD5 | retdec::crypto::DIGEST_SHA256);
+	iconHashCrc32 = std::move(digests.crc32);
+	iconHashMd5 = std::move(digests.md5);
+	iconHashSha256 = std::move(digests.sha256);
 	iconPerceptualAvgHash = computePerceptualAvgHash(*priorIcon);
 }
 
@@ -6,7 +6,7 @@
 
 #include <sstream>
 
-#include "retdec/crypto/crypto.h"
+#include "retdec/crypto/multi_hash.h"
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/string.h"
 #include "retdec/fileformat/file_format/file_format.h"
@@ -45,9 +45,11 @@ SecSeg::~SecSeg()
 void SecSeg::computeHashes()
 {
 	const auto *hashData = reinterpret_cast<const unsigned char*>(bytes.data());
-	crc32 = retdec::crypto::getCrc32(hashData, bytes.size());
-	md5 = retdec::crypto::getMd5(hashData, bytes.size());
-	sha256 = retdec::crypto::getSha256(hashData, bytes.size());
+	auto digests = retdec::crypto::computeDigests(hashData, bytes.size(),
+			retdec::crypto::DIGEST_CRC32 | retdec::crypto::DIGEST_MD5 | retdec::crypto::DIGEST_SHA256);
+	crc32 = std::move(digests.crc32);
+	md5 = std::move(digests.md5);
+	sha256 = std::move(digests.sha256);
 }
 
 /**
@@ -34,33 +34,29 @@ std::ios_base& hexWithPrefix(std::ios_base &str)
  */
 void separateStrings(std::string &str, std::vector<std::string> &words)
 {
-	str += '\0';
+	separateStrings(llvm::StringRef(str), words);
+}
+
+/**
+ * Divide @a str into individual strings separated by a null character ('\0')
+ * @param str Input string (e.g. content of section, which is not copied)
+ * @param words Into this parameter the separated strings are saved
+ *
+ * Behaves in the same way as the overload for @c std::string.
+ */
+void separateStrings(llvm::StringRef str, std::vector<std::string> &words)
+{
 	words.clear();
-	std::string tmp;
-	const auto strLen = str.length();
 
-	for(std::size_t i = 0, lastPos = 0; i < strLen; ++i)
+	for(std::size_t pos = 0, len = str.size(); pos < len;)
 	{
-		if(str[i] == '\0')
+		const auto end = std::min(str.find('\0', pos), len);
+		if(end > pos)
 		{
-			tmp = str.substr(lastPos, i + 1 - lastPos);
-			lastPos = i;
-			if(tmp != std::string(tmp.length(), '\0'))
-			{
-				if(tmp[0] == '\0')
-				{
-					tmp.erase(0, 1);
-				}
-				if(tmp[tmp.length() - 1] == '\0')
-				{
-					tmp.erase(tmp.length() - 1, 1);
-				}
-				words.push_back(tmp);
-			}
+			words.push_back(str.substr(pos, end - pos).str());
 		}
+		pos = end + 1;
 	}
-
-	str.erase(strLen - 1, 1);
 }
 
 } // namespace fileformat
@@ -67,8 +67,8 @@ void presentIfNotEmpty(const std::string &key, const std::string &value, Json::V
 /**
  * Constructor
  */
-JsonPresentation::JsonPresentation(FileInformation &fileinfo_, bool verbose_) :
-	FilePresentation(fileinfo_), verbose(verbose_)
+JsonPresentation::JsonPresentation(FileInformation &fileinfo_, bool verbose_, bool compact_, std::ostream &out_) :
+	FilePresentation(fileinfo_), verbose(verbose_), compact(compact_), out(out_)
 {
 
 }
@@ -749,7 +749,11 @@ bool JsonPresentation::present()
 	presentIterativeSubtitle(root, StringsJsonGetter(fileinfo));
 
 	StreamWriterBuilder builder;
-	std::cout << writeString(builder, root) << std::endl;
+	if(compact)
+	{
+		builder["indentation"] = "";
+	}
+	out << writeString(builder, root) << std::endl;
 	return true;
 }
 
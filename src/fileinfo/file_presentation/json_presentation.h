@@ -7,6 +7,8 @@
 #ifndef FILEINFO_FILE_PRESENTATION_JSON_PRESENTATION_H
 #define FILEINFO_FILE_PRESENTATION_JSON_PRESENTATION_H
 
+#include <iostream>
+
 #include "fileinfo/file_presentation/file_presentation.h"
 #include "fileinfo/file_presentation/getters/iterative_getter/iterative_subtitle_getter/iterative_subtitle_getter.h"
 
@@ -18,7 +20,9 @@ namespace fileinfo {
 class JsonPresentation : public FilePresentation
 {
 	private:
-		bool verbose; ///< @c true - print all information about file
+		bool verbose;      ///< @c true - print all information about file
+		bool compact;      ///< @c true - print whole document on one line
+		std::ostream &out; ///< output stream
 
 		/// @name Auxiliary presentation methods
 		/// @{
@@ -39,7 +43,7 @@ class JsonPresentation : public FilePresentation
 		void presentIterativeSubtitle(Json::Value &root, const IterativeSubtitleGetter &getter) const;
 		/// @}
 	public:
-		JsonPresentation(FileInformation &fileinfo_, bool verbose_);
+		JsonPresentation(FileInformation &fileinfo_, bool verbose_, bool compact_ = false, std::ostream &out_ = std::cout);
 		virtual ~JsonPresentation() override;
 
 		virtual bool present() override;
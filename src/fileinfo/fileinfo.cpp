@@ -4,19 +4,29 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include <regex>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 #include <llvm/Support/ErrorHandling.h>
 
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/memory.h"
+#include "retdec/utils/os.h"
 #include "retdec/utils/string.h"
 #include "retdec/ar-extractor/detection.h"
 #include "retdec/cpdetect/errors.h"
 #include "retdec/cpdetect/settings.h"
 #include "retdec/fileformat/utils/format_detection.h"
 #include "retdec/fileformat/utils/other.h"
+#include "retdec/yara-support/rules_cache.h"
 #include "fileinfo/file_detector/detector_factory.h"
 #include "fileinfo/file_detector/macho_detector.h"
 #include "fileinfo/file_presentation/config_presentation.h"
@@ -24,6 +34,11 @@
 #include "fileinfo/file_presentation/plain_presentation.h"
 #include "fileinfo/pattern_detector/pattern_detector.h"
 
+#ifdef OS_POSIX
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 using namespace retdec::utils;
 using namespace retdec::ar_extractor;
 using namespace retdec::cpdetect;
@@ -33,6 +48,17 @@ using namespace fileinfo;
 namespace
 {
 
+/// Maximal number of threads which can scan by the same YARA rules at once.
+const std::size_t MAX_BATCH_THREADS = 32;
+
+/// Guards standard output in batch mode.
+std::mutex outputMutex;
+
+#ifdef OS_POSIX
+/// Pipe into which a batch worker process writes indices of finished files.
+int finishedFilesPipe = -1;
+#endif
+
 /**
  * Program parameters
  */
@@ -50,10 +76,14 @@ struct ProgParams
 	std::set<std::string> yaraMalwarePaths; ///< paths to YARA malware rules
 	std::set<std::string> yaraCryptoPaths;  ///< paths to YARA crypto rules
 	std::set<std::string> yaraOtherPaths;   ///< paths to YARA other rules
+	std::string yaraCacheDir;               ///< directory for precompiled YARA rules
 	std::size_t maxMemory;                  ///< maximal memory
 	bool maxMemoryHalfRAM;                  ///< limit maximal memory to half of system RAM
 	std::size_t epBytesCount;               ///< number of bytes to load from entry point
 	LoadFlags loadFlags;                    ///< load flags for `fileformat`
+	bool batchMode;                         ///< analyze many files, print JSON Lines
+	std::vector<std::string> batchPaths;    ///< input files in batch mode (read from stdin if empty)
+	std::size_t threads;                    ///< number of threads in batch mode (0 means number of cores)
 
 	ProgParams() : searchMode(SearchType::EXACT_MATCH),
 					internalDatabase(true),
@@ -65,7 +95,9 @@ struct ProgParams
 					maxMemory(0),
 					maxMemoryHalfRAM(false),
 					epBytesCount(EP_BYTES_SIZE),
-					loadFlags(LoadFlags::NONE) {}
+					loadFlags(LoadFlags::NONE),
+					batchMode(false),
+					threads(0) {}
 };
 
 /**
@@ -73,30 +105,87 @@ struct ProgParams
  */
 struct ErrorHandlerInfo
 {
-	ProgParams* params;
+	const ProgParams* params;
 	FileInformation* fileinfo;
+	std::size_t batchIndex; ///< index of file in batch mode
 };
 
 /**
- * LLVM fatal error handler
- * @param user_data Data necessary for error handling
- * @param reason Unused
- * @param gen_crash_diag Unused
+ * File which is analyzed by the current thread
  */
-void fatalErrorHandler(void *user_data, const std::string& /*reason*/, bool /*gen_crash_diag*/)
-{
-	ProgParams* params = static_cast<ErrorHandlerInfo*>(user_data)->params;
-	FileInformation *fileinfo = static_cast<ErrorHandlerInfo*>(user_data)->fileinfo;
-
-	fileinfo->setStatus(ReturnCode::FORMAT_PARSER_PROBLEM);
+thread_local ErrorHandlerInfo errorHandlerInfo = { nullptr, nullptr, 0 };
 
-	if(params->plainText)
+/**
+ * Print gathered information about file on standard output
+ * @param params Program parameters
+ * @param fileinfo Information about file
+ */
+void presentFileInformation(const ProgParams &params, FileInformation &fileinfo)
+{
+	if(params.plainText)
 	{
-		PlainPresentation(*fileinfo, params->verbose, params->explanatory).present();
+		PlainPresentation(fileinfo, params.verbose, params.explanatory).present();
 	}
 	else
 	{
-		JsonPresentation(*fileinfo, params->verbose).present();
+		JsonPresentation(fileinfo, params.verbose).present();
+	}
+}
+
+/**
+ * Print gathered information about file in batch mode on standard output
+ * as one line of JSON and mark the file as finished
+ * @param params Program parameters
+ * @param fileinfo Information about file
+ * @param index Index of file in batch
+ */
+void presentBatchFileInformation(const ProgParams &params, FileInformation &fileinfo, std::size_t index)
+{
+	// Whole record is printed at once, so that records of files analyzed
+	// by different threads are not interleaved.
+	std::ostringstream record;
+	JsonPresentation(fileinfo, params.verbose, true, record).present();
+	std::lock_guard<std::mutex> lock(outputMutex);
+	std::cout << record.str() << std::flush;
+#ifdef OS_POSIX
+	if(finishedFilesPipe >= 0)
+	{
+		// Writes of at most PIPE_BUF bytes are atomic.
+		if(write(finishedFilesPipe, &index, sizeof(index)) != sizeof(index))
+		{
+			std::_Exit(static_cast<int>(ReturnCode::FILE_PROBLEM));
+		}
+	}
+#else
+	(void)index;
+#endif
+}
+
+/**
+ * LLVM fatal error handler
+ * @param user_data Unused
+ * @param reason Unused
+ * @param gen_crash_diag Unused
+ *
+ * The file analyzed by the current thread is reported as broken and the
+ * process ends. LLVM is built without exceptions, so the error cannot be
+ * propagated through its frames. In batch mode, the process is a worker
+ * started by @c analyzeFilesInBatch(), which analyzes unfinished files in a
+ * new worker.
+ */
+void fatalErrorHandler(void* /*user_data*/, const std::string& /*reason*/, bool /*gen_crash_diag*/)
+{
+	if(errorHandlerInfo.params && errorHandlerInfo.fileinfo)
+	{
+		errorHandlerInfo.fileinfo->setStatus(ReturnCode::FORMAT_PARSER_PROBLEM);
+		if(errorHandlerInfo.params->batchMode)
+		{
+			presentBatchFileInformation(*errorHandlerInfo.params, *errorHandlerInfo.fileinfo, errorHandlerInfo.batchIndex);
+			// Other threads may still use static objects, so they must not
+			// be destroyed.
+			std::_Exit(static_cast<int>(ReturnCode::FORMAT_PARSER_PROBLEM));
+		}
+		presentFileInformation(*errorHandlerInfo.params, *errorHandlerInfo.fileinfo);
 	}
 
 	exit(static_cast<int>(ReturnCode::FORMAT_PARSER_PROBLEM));
@@ -111,7 +200,8 @@ void printHelp()
 				<< "For compiler detection, program looks in the input file for YARA patterns.\n"
 				<< "According to them, it determines compiler or packer used for file creation.\n"
 				<< "Supported file formats are: " + joinStrings(getSupportedFileFormats()) + ".\n\n"
-				<< "Usage: fileinfo [options] file\n\n"
+				<< "Usage: fileinfo [options] file\n"
+				<< "       fileinfo --batch [options] [file ...]\n\n"
 				<< "Options list:\n"
 				<< "    --help, -h            Display this help.\n"
 				<< "\n"
@@ -143,6 +233,8 @@ void printHelp()
 				<< "                          and functions.\n"
 				<< "    --other=fileOrDir, -o=fileOrDir\n"
 				<< "                          Path to other YARA rules.\n"
+				<< "    --yara-cache=dir      Store precompiled versions of external YARA rules\n"
+				<< "                          into existing directory and reuse them in next runs.\n"
 				<< "\n"
 				<< "Options for specifying output format:\n"
 				<< "  From this group, only one option can be used. If no option is used, program\n"
@@ -172,7 +264,17 @@ void printHelp()
 				<< "    --max-memory=N\n"
 				<< "                          Limit maximal memory to N bytes (0 means no limit).\n"
 				<< "    --max-memory-half-ram\n"
-				<< "                          Limit maximal memory to half of system RAM.\n";
+				<< "                          Limit maximal memory to half of system RAM.\n"
+				<< "\n"
+				<< "Options for batch processing:\n"
+				<< "    --batch               Analyze all given files. If no file is given, paths\n"
+				<< "                          are read from standard input (one per line).\n"
+				<< "                          Information about every file is printed as one line\n"
+				<< "                          of JSON (JSON Lines). Config cannot be generated.\n"
+				<< "                          A file which cannot be parsed at all is reported\n"
+				<< "                          as broken and the batch continues (except on Windows).\n"
+				<< "    --threads=N           Number of files analyzed at once in batch mode.\n"
+				<< "                          (Default: number of CPU cores, at most " << MAX_BATCH_THREADS << ")\n";
 }
 
 std::string getParamOrDie(std::vector<std::string> &argv, std::size_t &i)
@@ -211,7 +313,8 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 	std::vector<std::string> argv;
 
 	std::set<std::string> withArgs = {"malware", "m", "crypto", "C", "other",
-			"o", "config", "c", "no-hashes", "max-memory", "ep-bytes"};
+			"o", "yara-cache", "config", "c", "no-hashes", "max-memory", "ep-bytes",
+			"threads"};
 	for (int i = 1; i < argc; ++i)
 	{
 		std::string a = _argv[i];
@@ -236,6 +339,7 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 		argv.push_back(a);
 	}
 
+	std::vector<std::string> filePaths;
 	for (std::size_t i = 0; i < argv.size(); ++i)
 	{
 		std::string c = argv[i];
@@ -303,6 +407,10 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 		{
 			params.yaraOtherPaths.insert(getParamOrDie(argv, i));
 		}
+		else if (c == "--yara-cache")
+		{
+			params.yaraCacheDir = getParamOrDie(argv, i);
+		}
 		else if (c == "--max-memory")
 		{
 			auto maxMemoryString = getParamOrDie(argv, i);
@@ -353,21 +461,35 @@ bool doParams(int argc, char **_argv, ProgParams &params)
 			if (!strToNum(epBytesCountString, params.epBytesCount))
 				return false;
 		}
-		else if (params.filePath.empty())
+		else if (c == "--batch")
 		{
-			params.filePath = argv[i];
+			params.batchMode = true;
+		}
+		else if (c == "--threads")
+		{
+			auto threadsString = getParamOrDie(argv, i);
+			if (!strToNum(threadsString, params.threads))
+				return false;
 		}
 		else
 		{
-			return false;
+			filePaths.push_back(argv[i]);
 		}
 	}
 
-	if(params.filePath.empty())
+	if(params.batchMode)
+	{
+		params.plainText = false;
+		params.batchPaths = filePaths;
+		return !params.generateConfigFile;
+	}
+
+	if(filePaths.size() != 1)
 	{
 		return false;
 	}
 
+	params.filePath = filePaths.front();
 	return true;
 }
 
@@ -389,6 +511,255 @@ void limitMaximalMemoryIfRequested(const ProgParams& params)
 	}
 }
 
+/**
+ * Gather information about input file
+ * @param params Program parameters
+ * @param filePath Path to input file
+ * @param config Config of input file or @c nullptr if it is not used
+ * @param searchPar Parameters for detection of used compiler
+ * @param fileinfo Structure for storing information
+ * @return Detector of input file or @c nullptr if it could not be created.
+ *    Detector has to live as long as @a fileinfo is used.
+ */
+std::unique_ptr<FileDetector> analyzeFile(
+		const ProgParams &params,
+		const std::string &filePath,
+		retdec::config::Config *config,
+		DetectParams &searchPar,
+		FileInformation &fileinfo)
+{
+	const auto fileFormat = detectFileFormat(filePath, config);
+	fileinfo.setPathToFile(filePath);
+	fileinfo.setFileFormatEnum(fileFormat);
+	if(fileFormat == Format::UNDETECTABLE)
+	{
+		fileinfo.setStatus(ReturnCode::FILE_NOT_EXIST);
+		return nullptr;
+	}
+
+	std::unique_ptr<FileDetector> fileDetector(createFileDetector(filePath, fileFormat, fileinfo, searchPar, params.loadFlags));
+	if(fileDetector)
+	{
+		if(!fileDetector->getFileParser()->isInValidState())
+		{
+			// Check if Mach-O is archive.
+			if (fileFormat == Format::MACHO)
+			{
+				auto machoDetecor = static_cast<MachODetector*>(fileDetector.get());
+				if (machoDetecor->isMachoUniversalArchive())
+				{
+					fileinfo.setStatus(ReturnCode::MACHO_AR_DETECTED);
+					return fileDetector;
+				}
+			}
+
+			fileinfo.setStatus(ReturnCode::FORMAT_PARSER_PROBLEM);
+			return fileDetector;
+		}
+
+		if(config)
+		{
+			fileDetector->setConfigFile(*config);
+		}
+		fileDetector->getAllInformation();
+	}
+	else
+	{
+		if(isArchive(filePath))
+		{
+			fileinfo.setStatus(ReturnCode::ARCHIVE_DETECTED);
+		}
+		else
+		{
+			fileinfo.setStatus(ReturnCode::UNKNOWN_FORMAT);
+		}
+	}
+	PatternDetector patternDetector(fileDetector ? fileDetector->getFileParser() : nullptr, fileinfo);
+	patternDetector.addFilePaths("malware", params.yaraMalwarePaths);
+	patternDetector.addFilePaths("crypto", params.yaraCryptoPaths);
+	patternDetector.addFilePaths("other", params.yaraOtherPaths);
+	patternDetector.analyze();
+
+	return fileDetector;
+}
+
+/**
+ * Read paths to input files of batch from standard input, one per line
+ * @return Paths to input files
+ */
+std::vector<std::string> readBatchPathsFromInput()
+{
+	std::vector<std::string> paths;
+	std::string path;
+	while(std::getline(std::cin, path))
+	{
+		if(!path.empty() && path.back() == '\r')
+		{
+			path.pop_back();
+		}
+		if(!path.empty())
+		{
+			paths.push_back(path);
+		}
+	}
+	return paths;
+}
+
+/**
+ * Analyze input files in several threads and print information about them
+ * on standard output, one line of JSON per file
+ *
+ * Signature databases and compiled YARA rules are shared by all files, so
+ * they are prepared only once.
+ *
+ * @param params Program parameters
+ * @param paths Paths to all input files of batch
+ * @param indices Indices of files from @a paths to analyze
+ * @param threadsCount Number of threads
+ */
+void analyzeFilesInThreads(
+		const ProgParams &params,
+		const std::vector<std::string> &paths,
+		const std::vector<std::size_t> &indices,
+		std::size_t threadsCount)
+{
+	std::mutex inputMutex;
+	std::size_t next = 0;
+	auto getNextIndex = [&](std::size_t &index)
+	{
+		std::lock_guard<std::mutex> lock(inputMutex);
+		if(next >= indices.size())
+		{
+			return false;
+		}
+		index = indices[next++];
+		return true;
+	};
+
+	auto analyzeFiles = [&]()
+	{
+		DetectParams searchPar(params.searchMode, params.internalDatabase, params.externalDatabase, params.epBytesCount);
+		std::size_t index;
+		while(getNextIndex(index))
+		{
+			FileInformation fileinfo;
+			errorHandlerInfo = { &params, &fileinfo, index };
+			auto fileDetector = analyzeFile(params, paths[index], nullptr, searchPar, fileinfo);
+			presentBatchFileInformation(params, fileinfo, index);
+			errorHandlerInfo = { nullptr, nullptr, 0 };
+		}
+	};
+
+	std::vector<std::thread> workers;
+	for(std::size_t i = 1; i < threadsCount; ++i)
+	{
+		workers.emplace_back(analyzeFiles);
+	}
+	analyzeFiles();
+	for(auto &worker : workers)
+	{
+		worker.join();
+	}
+}
+
+/**
+ * Analyze input files of batch and print information about them on standard
+ * output, one line of JSON per file
+ *
+ * On POSIX systems, files are analyzed by a worker process. When a file
+ * causes a fatal error, the worker reports it as broken and ends, and the
+ * files it has not finished are analyzed by a new worker. When a worker
+ * crashes without finishing any file, the next one uses a single thread, so
+ * the file which crashes it can be found and skipped. On other systems,
+ * a fatal error ends the whole batch.
+ *
+ * @param params Program parameters
+ * @return Status of batch
+ */
+ReturnCode analyzeFilesInBatch(const ProgParams &params)
+{
+	const auto paths = params.batchPaths.empty()
+			? readBatchPathsFromInput()
+			: params.batchPaths;
+	std::vector<std::size_t> unfinished(paths.size());
+	std::iota(unfinished.begin(), unfinished.end(), 0);
+	auto threadsCount = params.threads
+			? params.threads
+			: std::max(std::thread::hardware_concurrency(), 1u);
+	threadsCount = std::min(threadsCount, MAX_BATCH_THREADS);
+
+#ifdef OS_POSIX
+	auto result = ReturnCode::OK;
+	bool isolate = false;
+	while(!unfinished.empty())
+	{
+		int fds[2];
+		if(pipe(fds) != 0)
+		{
+			return ReturnCode::FILE_PROBLEM;
+		}
+
+		std::cout.flush();
+		const auto pid = fork();
+		if(pid < 0)
+		{
+			close(fds[0]);
+			close(fds[1]);
+			return ReturnCode::FILE_PROBLEM;
+		}
+		if(pid == 0)
+		{
+			close(fds[0]);
+			finishedFilesPipe = fds[1];
+			analyzeFilesInThreads(params, paths, unfinished, isolate ? 1 : threadsCount);
+			std::cout.flush();
+			std::_Exit(static_cast<int>(ReturnCode::OK));
+		}
+
+		close(fds[1]);
+		std::vector<bool> finished(paths.size(), false);
+		std::size_t index;
+		while(read(fds[0], &index, sizeof(index)) == sizeof(index))
+		{
+			if(index < finished.size())
+			{
+				finished[index] = true;
+			}
+		}
+		close(fds[0]);
+		waitpid(pid, nullptr, 0);
+
+		const auto unfinishedCount = unfinished.size();
+		unfinished.erase(std::remove_if(unfinished.begin(), unfinished.end(),
+				[&](std::size_t i) { return finished[i]; }), unfinished.end());
+		if(unfinished.size() != unfinishedCount)
+		{
+			isolate = false;
+		}
+		else if(!isolate)
+		{
+			// Worker crashed before finishing any file. Any of the files
+			// it was analyzing may be the cause.
+			isolate = true;
+		}
+		else
+		{
+			// Single-threaded worker crashed on its first file.
+			std::cerr << "Error: analysis of " << paths[unfinished.front()]
+				<< " crashed\n";
+			unfinished.erase(unfinished.begin());
+			result = ReturnCode::FORMAT_PARSER_PROBLEM;
+			isolate = false;
+		}
+	}
+
+	return result;
+#else
+	analyzeFilesInThreads(params, paths, unfinished, threadsCount);
+	return ReturnCode::OK;
+#endif
+}
+
 } // anonymous namespace
 
 /**
@@ -408,6 +779,13 @@ int main(int argc, char* argv[])
 	}
 
 	limitMaximalMemoryIfRequested(params);
+	retdec::yara_support::RulesCache::getInstance().setCacheDirectory(params.yaraCacheDir);
+	llvm::install_fatal_error_handler(fatalErrorHandler, nullptr);
+
+	if(params.batchMode)
+	{
+		return static_cast<int>(analyzeFilesInBatch(params));
+	}
 
 	bool useConfig = true;
 	retdec::config::Config config;
@@ -428,76 +806,12 @@ int main(int argc, char* argv[])
 	}
 
 	DetectParams searchPar(params.searchMode, params.internalDatabase, params.externalDatabase, params.epBytesCount);
-	const auto fileFormat = detectFileFormat(params.filePath, useConfig ? &config : nullptr);
 	FileInformation fileinfo;
-	FileDetector *fileDetector = nullptr;
-	fileinfo.setPathToFile(params.filePath);
-	fileinfo.setFileFormatEnum(fileFormat);
-	ErrorHandlerInfo hInfo { &params, &fileinfo };
-	llvm::install_fatal_error_handler(fatalErrorHandler, &hInfo);
-	switch(fileFormat)
-	{
-		case Format::UNDETECTABLE:
-		{
-			fileinfo.setStatus(ReturnCode::FILE_NOT_EXIST);
-			break;
-		}
-		default:
-		{
-			fileDetector = createFileDetector(params.filePath, fileFormat, fileinfo, searchPar, params.loadFlags);
-			if(fileDetector)
-			{
-				if(!fileDetector->getFileParser()->isInValidState())
-				{
-					// Check if Mach-O is archive.
-					if (fileFormat == Format::MACHO)
-					{
-						auto machoDetecor = static_cast<MachODetector*>(fileDetector);
-						if (machoDetecor->isMachoUniversalArchive())
-						{
-							fileinfo.setStatus(ReturnCode::MACHO_AR_DETECTED);
-							break;
-						}
-					}
-
-					fileinfo.setStatus(ReturnCode::FORMAT_PARSER_PROBLEM);
-					break;
-				}
-
-				if(useConfig)
-				{
-					fileDetector->setConfigFile(config);
-				}
-				fileDetector->getAllInformation();
-			}
-			else
-			{
-				if(isArchive(params.filePath))
-				{
-					fileinfo.setStatus(ReturnCode::ARCHIVE_DETECTED);
-				}
-				else
-				{
-					fileinfo.setStatus(ReturnCode::UNKNOWN_FORMAT);
-				}
-			}
-			PatternDetector patternDetector(fileDetector ? fileDetector->getFileParser() : nullptr, fileinfo);
-			patternDetector.addFilePaths("malware", params.yaraMalwarePaths);
-			patternDetector.addFilePaths("crypto", params.yaraCryptoPaths);
-			patternDetector.addFilePaths("other", params.yaraOtherPaths);
-			patternDetector.analyze();
-		}
-	}
+	errorHandlerInfo = { &params, &fileinfo };
+	const auto fileDetector = analyzeFile(params, params.filePath, useConfig ? &config : nullptr, searchPar, fileinfo);
 
 	// print results on standard output
-	if(params.plainText)
-	{
-		PlainPresentation(fileinfo, params.verbose, params.explanatory).present();
-	}
-	else
-	{
-		JsonPresentation(fileinfo, params.verbose).present();
-	}
+	presentFileInformation(params, fileinfo);
 
 	// generate configuration file
 	auto res = fileinfo.getStatus();
@@ -511,6 +825,5 @@ int main(int argc, char* argv[])
 		}
 	}
 
-	delete fileDetector;
 	return isFatalError(res) ? static_cast<int>(res) : static_cast<int>(ReturnCode::OK);
 }
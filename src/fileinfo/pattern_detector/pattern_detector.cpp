@@ -12,7 +12,7 @@
 #include "fileinfo/pattern_detector/pattern_detector.h"
 
 using namespace retdec::utils;
-using namespace yaracpp;
+using namespace retdec::yara_support;
 
 namespace fileinfo {
 
@@ -58,7 +58,7 @@ PatternDetector::patternCategoriesIterator PatternDetector::end() const
  * @param pattern Into this parameter is stored resulted pattern
  * @param rule Detected YARA rule
  */
-void PatternDetector::createPatternFromRule(Pattern &pattern, const yaracpp::YaraRule &rule)
+void PatternDetector::createPatternFromRule(Pattern &pattern, const retdec::yara_support::YaraRule &rule)
 {
 	const auto name = rule.getName();
 	pattern.setName(name);
@@ -104,7 +104,7 @@ void PatternDetector::createPatternFromRule(Pattern &pattern, const yaracpp::Yar
  * Save detected cryptography rule
  * @param rule Detected cryptography rule
  */
-void PatternDetector::saveCryptoRule(const yaracpp::YaraRule &rule)
+void PatternDetector::saveCryptoRule(const retdec::yara_support::YaraRule &rule)
 {
 	const auto name = rule.getName();
 	Pattern pattern;
@@ -271,7 +271,7 @@ void PatternDetector::saveCryptoRule(const yaracpp::YaraRule &rule)
  * Save detected cryptography rule
  * @param rule Detected cryptography rule
  */
-void PatternDetector::saveMalwareRule(const yaracpp::YaraRule &rule)
+void PatternDetector::saveMalwareRule(const retdec::yara_support::YaraRule &rule)
 {
 	Pattern pattern;
 	createPatternFromRule(pattern, rule);
@@ -282,7 +282,7 @@ void PatternDetector::saveMalwareRule(const yaracpp::YaraRule &rule)
  * Save detected cryptography rule
  * @param rule Detected cryptography rule
  */
-void PatternDetector::saveOtherRule(const yaracpp::YaraRule &rule)
+void PatternDetector::saveOtherRule(const retdec::yara_support::YaraRule &rule)
 {
 	Pattern pattern;
 	createPatternFromRule(pattern, rule);
@@ -337,34 +337,43 @@ void PatternDetector::addFilePaths(const std::string &category, const std::set<s
 
 /**
  * Analyze input file and try to find YARA patterns
+ *
+ * Rules of all categories are compiled into one set with category names used
+ * as namespaces, so that input file is scanned only once.
  */
 void PatternDetector::analyze()
 {
+	YaraDetector yara;
 	for(const auto &category : categories)
 	{
-		YaraDetector yara;
-
 		for(const auto &item : category.second)
 		{
-			yara.addRuleFile(item);
+			yara.addRuleFile(item, category.first);
 		}
+	}
 
+	if(fileParser && fileParser->isInValidState())
+	{
+		yara.analyze(fileParser->getBytesData(), fileParser->getFileLength());
+	}
+	else
+	{
 		yara.analyze(fileinfo.getPathToFile());
+	}
 
-		for(const auto &rule : yara.getDetectedRules())
+	for(const auto &rule : yara.getDetectedRules())
+	{
+		if(rule.getNamespace() == "crypto")
 		{
-			if(category.first == "crypto")
-			{
-				saveCryptoRule(rule);
-			}
-			else if(category.first == "malware")
-			{
-				saveMalwareRule(rule);
-			}
-			else
-			{
-				saveOtherRule(rule);
-			}
+			saveCryptoRule(rule);
+		}
+		else if(rule.getNamespace() == "malware")
+		{
+			saveMalwareRule(rule);
+		}
+		else
+		{
+			saveOtherRule(rule);
 		}
 	}
 
@@ -11,7 +11,7 @@
 #include <string>
 #include <vector>
 
-#include "yaracpp/yara_detector/yara_detector.h"
+#include "retdec/yara-support/yara_detector.h"
 #include "fileinfo/file_information/file_information.h"
 
 namespace fileinfo {
@@ -35,10 +35,10 @@ class PatternDetector
 
 		/// @name Auxiliary methods
 		/// @{
-		void createPatternFromRule(Pattern &pattern, const yaracpp::YaraRule &rule);
-		void saveCryptoRule(const yaracpp::YaraRule &rule);
-		void saveMalwareRule(const yaracpp::YaraRule &rule);
-		void saveOtherRule(const yaracpp::YaraRule &rule);
+		void createPatternFromRule(Pattern &pattern, const retdec::yara_support::YaraRule &rule);
+		void saveCryptoRule(const retdec::yara_support::YaraRule &rule);
+		void saveMalwareRule(const retdec::yara_support::YaraRule &rule);
+		void saveOtherRule(const retdec::yara_support::YaraRule &rule);
 		/// @}
 	public:
 		PatternDetector(const retdec::fileformat::FileFormat *fparser, FileInformation &finfo);
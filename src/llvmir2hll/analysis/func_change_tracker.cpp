@@ -0,0 +1,456 @@
+/**
+* @file src/llvmir2hll/analysis/func_change_tracker.cpp
+* @brief Implementation of FuncChangeTracker.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <functional>
+
+#include <llvm/ADT/APFloat.h>
+#include <llvm/ADT/APInt.h>
+#include <llvm/ADT/Hashing.h>
+
+#include "retdec/llvmir2hll/analysis/func_change_tracker.h"
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/address_op_expr.h"
+#include "retdec/llvmir2hll/ir/and_op_expr.h"
+#include "retdec/llvmir2hll/ir/array_index_op_expr.h"
+#include "retdec/llvmir2hll/ir/assign_op_expr.h"
+#include "retdec/llvmir2hll/ir/bit_and_op_expr.h"
+#include "retdec/llvmir2hll/ir/bit_cast_expr.h"
+#include "retdec/llvmir2hll/ir/bit_or_op_expr.h"
+#include "retdec/llvmir2hll/ir/bit_shl_op_expr.h"
+#include "retdec/llvmir2hll/ir/bit_shr_op_expr.h"
+#include "retdec/llvmir2hll/ir/bit_xor_op_expr.h"
+#include "retdec/llvmir2hll/ir/call_expr.h"
+#include "retdec/llvmir2hll/ir/comma_op_expr.h"
+#include "retdec/llvmir2hll/ir/const_array.h"
+#include "retdec/llvmir2hll/ir/const_bool.h"
+#include "retdec/llvmir2hll/ir/const_float.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/const_null_pointer.h"
+#include "retdec/llvmir2hll/ir/const_string.h"
+#include "retdec/llvmir2hll/ir/const_struct.h"
+#include "retdec/llvmir2hll/ir/const_symbol.h"
+#include "retdec/llvmir2hll/ir/deref_op_expr.h"
+#include "retdec/llvmir2hll/ir/div_op_expr.h"
+#include "retdec/llvmir2hll/ir/eq_op_expr.h"
+#include "retdec/llvmir2hll/ir/ext_cast_expr.h"
+#include "retdec/llvmir2hll/ir/fp_to_int_cast_expr.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/global_var_def.h"
+#include "retdec/llvmir2hll/ir/goto_stmt.h"
+#include "retdec/llvmir2hll/ir/gt_eq_op_expr.h"
+#include "retdec/llvmir2hll/ir/gt_op_expr.h"
+#include "retdec/llvmir2hll/ir/int_to_fp_cast_expr.h"
+#include "retdec/llvmir2hll/ir/int_to_ptr_cast_expr.h"
+#include "retdec/llvmir2hll/ir/lt_eq_op_expr.h"
+#include "retdec/llvmir2hll/ir/lt_op_expr.h"
+#include "retdec/llvmir2hll/ir/mod_op_expr.h"
+#include "retdec/llvmir2hll/ir/module.h"
+#include "retdec/llvmir2hll/ir/mul_op_expr.h"
+#include "retdec/llvmir2hll/ir/neg_op_expr.h"
+#include "retdec/llvmir2hll/ir/neq_op_expr.h"
+#include "retdec/llvmir2hll/ir/not_op_expr.h"
+#include "retdec/llvmir2hll/ir/or_op_expr.h"
+#include "retdec/llvmir2hll/ir/ptr_to_int_cast_expr.h"
+#include "retdec/llvmir2hll/ir/statement.h"
+#include "retdec/llvmir2hll/ir/struct_index_op_expr.h"
+#include "retdec/llvmir2hll/ir/sub_op_expr.h"
+#include "retdec/llvmir2hll/ir/ternary_op_expr.h"
+#include "retdec/llvmir2hll/ir/trunc_cast_expr.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/llvmir2hll/support/visitors/ordered_all_visitor.h"
+#include "retdec/utils/container.h"
+
+using retdec::utils::hasItem;
+
+namespace retdec {
+namespace llvmir2hll {
+
+namespace {
+
+/**
+* @brief Mixes @a value into @a hash (the same as @c boost::hash_combine()).
+*/
+void combine(std::size_t &hash, std::size_t value) {
+	hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+}
+
+/**
+* @brief Computes fingerprints of functions.
+*
+* Statements are visited in order and every statement contributes its address
+* and the address of its successor, so moving a statement into or out of a
+* compound statement also changes the fingerprint.
+*/
+class FingerprintComputer: private OrderedAllVisitor,
+		private retdec::utils::NonCopyable {
+public:
+	/**
+	* @brief Implementation of FuncChangeTracker::getFingerprint().
+	*/
+	static std::size_t compute(ShPtr<Function> func) {
+		FingerprintComputer computer;
+		computer.add(func.get());
+		for (const auto &param : func->getParams()) {
+			computer.add(param.get());
+		}
+		computer.visitStmt(func->getBody());
+		return computer.fingerprint;
+	}
+
+private:
+	FingerprintComputer(): OrderedAllVisitor(), fingerprint(0) {}
+
+	/**
+	* @brief Mixes the address @a p into the fingerprint.
+	*/
+	void add(const void *p) {
+		combine(fingerprint, std::hash<const void *>()(p));
+	}
+
+	virtual void visitStmt(ShPtr<Statement> stmt, bool visitSuccessors = true,
+			bool visitNestedStmts = true) override {
+		if (stmt) {
+			add(stmt.get());
+			add(stmt->getSuccessor().get());
+		}
+		OrderedAllVisitor::visitStmt(stmt, visitSuccessors, visitNestedStmts);
+	}
+
+	/// @name Visitor Interface
+	/// @{
+	using OrderedAllVisitor::visit;
+	virtual void visit(const ShPtr<GotoStmt> &stmt) override {
+		add(stmt->getTarget().get());
+		OrderedAllVisitor::visit(stmt);
+	}
+	virtual void visit(const ShPtr<Variable> &var) override {
+		add(var.get());
+	}
+	virtual void visit(const ShPtr<AddressOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<AssignOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<ArrayIndexOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<StructIndexOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<DerefOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<NotOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<NegOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<EqOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<NeqOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<LtEqOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<GtEqOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<LtOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<GtOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<AddOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<SubOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<MulOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<ModOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<DivOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<AndOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<OrOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<BitAndOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<BitOrOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<BitXorOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<BitShlOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<BitShrOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<TernaryOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<CallExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<CommaOpExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	// Casts
+	virtual void visit(const ShPtr<BitCastExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<ExtCastExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<TruncCastExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<FPToIntCastExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<IntToFPCastExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<IntToPtrCastExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	virtual void visit(const ShPtr<PtrToIntCastExpr> &expr) override {
+		add(expr.get());
+		OrderedAllVisitor::visit(expr);
+	}
+	// Constants
+	// A constant may be reallocated at the address of a freed constant, so
+	// values of scalar constants are also taken into account.
+	virtual void visit(const ShPtr<ConstBool> &constant) override {
+		add(constant.get());
+		combine(fingerprint, constant->getValue());
+	}
+	virtual void visit(const ShPtr<ConstFloat> &constant) override {
+		add(constant.get());
+		combine(fingerprint, llvm::hash_value(constant->getValue()));
+	}
+	virtual void visit(const ShPtr<ConstInt> &constant) override {
+		add(constant.get());
+		combine(fingerprint, llvm::hash_value(constant->getValue()));
+	}
+	virtual void visit(const ShPtr<ConstNullPointer> &constant) override {
+		add(constant.get());
+	}
+	virtual void visit(const ShPtr<ConstString> &constant) override {
+		add(constant.get());
+	}
+	virtual void visit(const ShPtr<ConstArray> &constant) override {
+		add(constant.get());
+		OrderedAllVisitor::visit(constant);
+	}
+	virtual void visit(const ShPtr<ConstStruct> &constant) override {
+		add(constant.get());
+		OrderedAllVisitor::visit(constant);
+	}
+	virtual void visit(const ShPtr<ConstSymbol> &constant) override {
+		add(constant.get());
+		OrderedAllVisitor::visit(constant);
+	}
+	/// @}
+
+private:
+	/// The computed fingerprint.
+	std::size_t fingerprint;
+};
+
+} // anonymous namespace
+
+/**
+* @brief Constructs a new tracker.
+*
+* See create() for the description of parameters.
+*/
+FuncChangeTracker::FuncChangeTracker(ShPtr<Module> module,
+		bool trackGlobalVars):
+	module(module), trackGlobalVars(trackGlobalVars), upToDateFuncs() {}
+
+/**
+* @brief Creates a new tracker of functions in @a module.
+*
+* @param[in] module Module whose functions are tracked.
+* @param[in] trackGlobalVars If @c true, all functions are considered changed
+*                            whenever a global variable is added, removed, or
+*                            gets a different initializer.
+*
+* Initially, all functions are considered changed.
+*
+* @par Preconditions
+*  - @a module is non-null
+*/
+ShPtr<FuncChangeTracker> FuncChangeTracker::create(ShPtr<Module> module,
+		bool trackGlobalVars) {
+	PRECONDITION_NON_NULL(module);
+
+	return ShPtr<FuncChangeTracker>(new FuncChangeTracker(module,
+		trackGlobalVars));
+}
+
+/**
+* @brief Returns functions of the module (both definitions and declarations)
+*        that have changed since they were marked as up to date.
+*
+* Functions that have never been marked as up to date are also returned.
+*/
+FuncSet FuncChangeTracker::getChangedFuncs() const {
+	const auto globalVarsFingerprint = getGlobalVarsFingerprint();
+	FuncSet changedFuncs;
+	for (auto i = module->func_begin(), e = module->func_end(); i != e; ++i) {
+		if (hasChanged(*i, globalVarsFingerprint)) {
+			changedFuncs.insert(*i);
+		}
+	}
+	return changedFuncs;
+}
+
+/**
+* @brief Returns @c true if @a func has changed since it was marked as up to
+*        date (or if it has never been marked), @c false otherwise.
+*
+* @par Preconditions
+*  - @a func is non-null
+*/
+bool FuncChangeTracker::hasChanged(ShPtr<Function> func) const {
+	PRECONDITION_NON_NULL(func);
+
+	return hasChanged(func, getGlobalVarsFingerprint());
+}
+
+/**
+* @brief Marks all functions in @a funcs as up to date.
+*
+* Functions that are no longer in the module are forgotten.
+*/
+void FuncChangeTracker::markAsUpToDate(const FuncSet &funcs) {
+	const auto globalVarsFingerprint = getGlobalVarsFingerprint();
+	for (const auto &func : funcs) {
+		upToDateFuncs[func] = {getFingerprint(func), globalVarsFingerprint};
+	}
+
+	const FuncSet moduleFuncs(module->func_begin(), module->func_end());
+	for (auto i = upToDateFuncs.begin(); i != upToDateFuncs.end();) {
+		if (hasItem(moduleFuncs, i->first)) {
+			++i;
+		} else {
+			i = upToDateFuncs.erase(i);
+		}
+	}
+}
+
+/**
+* @brief Marks all functions in @a funcs as changed.
+*/
+void FuncChangeTracker::markAsChanged(const FuncSet &funcs) {
+	for (const auto &func : funcs) {
+		upToDateFuncs.erase(func);
+	}
+}
+
+/**
+* @brief Returns a fingerprint of @a func.
+*
+* Two fingerprints of a function differ if anything in the function has been
+* added, removed, moved, or replaced with a different statement, expression, or
+* constant.
+*
+* @par Preconditions
+*  - @a func is non-null
+*/
+std::size_t FuncChangeTracker::getFingerprint(ShPtr<Function> func) {
+	PRECONDITION_NON_NULL(func);
+
+	return FingerprintComputer::compute(func);
+}
+
+/**
+* @brief Returns a fingerprint of global variables in the module.
+*
+* If global variables are not tracked, it returns @c 0.
+*/
+std::size_t FuncChangeTracker::getGlobalVarsFingerprint() const {
+	std::size_t fingerprint = 0;
+	if (!trackGlobalVars) {
+		return fingerprint;
+	}
+
+	for (auto i = module->global_var_begin(), e = module->global_var_end();
+			i != e; ++i) {
+		combine(fingerprint, std::hash<const void *>()((*i)->getVar().get()));
+		combine(fingerprint, std::hash<const void *>()(
+			(*i)->getInitializer().get()));
+	}
+	return fingerprint;
+}
+
+/**
+* @brief Returns @c true if @a func has changed since it was marked as up to
+*        date, provided that the current fingerprint of global variables is
+*        @a globalVarsFingerprint.
+*/
+bool FuncChangeTracker::hasChanged(ShPtr<Function> func,
+		std::size_t globalVarsFingerprint) const {
+	auto i = upToDateFuncs.find(func);
+	return i == upToDateFuncs.end() ||
+		i->second.globalVars != globalVarsFingerprint ||
+		i->second.func != getFingerprint(func);
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
@@ -310,7 +310,7 @@ ShPtr<UsedTypes> UsedTypesVisitor::getUsedTypes(ShPtr<Module> module) {
 // Visits
 //
 
-void UsedTypesVisitor::visit(ShPtr<Function> func) {
+void UsedTypesVisitor::visit(const ShPtr<Function> &func) {
 	// Return type.
 	func->getRetType()->accept(this);
 
@@ -318,11 +318,11 @@ void UsedTypesVisitor::visit(ShPtr<Function> func) {
 	OrderedAllVisitor::visit(func);
 }
 
-void UsedTypesVisitor::visit(ShPtr<Variable> var) {
+void UsedTypesVisitor::visit(const ShPtr<Variable> &var) {
 	var->getType()->accept(this);
 }
 
-void UsedTypesVisitor::visit(ShPtr<ConstBool> constant) {
+void UsedTypesVisitor::visit(const ShPtr<ConstBool> &constant) {
 	usedTypes->usedBool = true;
 }
 
@@ -330,37 +330,37 @@ void UsedTypesVisitor::visit(ShPtr<ConstBool> constant) {
 // Casts
 //
 
-void UsedTypesVisitor::visit(ShPtr<BitCastExpr> expr) {
+void UsedTypesVisitor::visit(const ShPtr<BitCastExpr> &expr) {
 	expr->getType()->accept(this);
 	OrderedAllVisitor::visit(expr);
 }
 
-void UsedTypesVisitor::visit(ShPtr<ExtCastExpr> expr) {
+void UsedTypesVisitor::visit(const ShPtr<ExtCastExpr> &expr) {
 	expr->getType()->accept(this);
 	OrderedAllVisitor::visit(expr);
 }
 
-void UsedTypesVisitor::visit(ShPtr<TruncCastExpr> expr) {
+void UsedTypesVisitor::visit(const ShPtr<TruncCastExpr> &expr) {
 	expr->getType()->accept(this);
 	OrderedAllVisitor::visit(expr);
 }
 
-void UsedTypesVisitor::visit(ShPtr<FPToIntCastExpr> expr) {
+void UsedTypesVisitor::visit(const ShPtr<FPToIntCastExpr> &expr) {
 	expr->getType()->accept(this);
 	OrderedAllVisitor::visit(expr);
 }
 
-void UsedTypesVisitor::visit(ShPtr<IntToFPCastExpr> expr) {
+void UsedTypesVisitor::visit(const ShPtr<IntToFPCastExpr> &expr) {
 	expr->getType()->accept(this);
 	OrderedAllVisitor::visit(expr);
 }
 
-void UsedTypesVisitor::visit(ShPtr<IntToPtrCastExpr> expr) {
+void UsedTypesVisitor::visit(const ShPtr<IntToPtrCastExpr> &expr) {
 	expr->getType()->accept(this);
 	OrderedAllVisitor::visit(expr);
 }
 
-void UsedTypesVisitor::visit(ShPtr<PtrToIntCastExpr> expr) {
+void UsedTypesVisitor::visit(const ShPtr<PtrToIntCastExpr> &expr) {
 	expr->getType()->accept(this);
 	OrderedAllVisitor::visit(expr);
 }
@@ -369,11 +369,11 @@ void UsedTypesVisitor::visit(ShPtr<PtrToIntCastExpr> expr) {
 // Types
 //
 
-void UsedTypesVisitor::visit(ShPtr<FloatType> type) {
+void UsedTypesVisitor::visit(const ShPtr<FloatType> &type) {
 	usedTypes->floatTypes.insert(type);
 }
 
-void UsedTypesVisitor::visit(ShPtr<IntType> type) {
+void UsedTypesVisitor::visit(const ShPtr<IntType> &type) {
 	// If int type is has size 1, it is bool.
 	if (type->isBool()) {
 		usedTypes->usedBool = true;
@@ -385,35 +385,35 @@ void UsedTypesVisitor::visit(ShPtr<IntType> type) {
 	}
 }
 
-void UsedTypesVisitor::visit(ShPtr<PointerType> type) {
+void UsedTypesVisitor::visit(const ShPtr<PointerType> &type) {
 	usedTypes->otherTypes.insert(type);
 	OrderedAllVisitor::visit(type);
 }
 
-void UsedTypesVisitor::visit(ShPtr<StringType> type) {
+void UsedTypesVisitor::visit(const ShPtr<StringType> &type) {
 	usedTypes->otherTypes.insert(type);
 }
 
-void UsedTypesVisitor::visit(ShPtr<ArrayType> type) {
+void UsedTypesVisitor::visit(const ShPtr<ArrayType> &type) {
 	usedTypes->otherTypes.insert(type);
 	OrderedAllVisitor::visit(type);
 }
 
-void UsedTypesVisitor::visit(ShPtr<StructType> type) {
+void UsedTypesVisitor::visit(const ShPtr<StructType> &type) {
 	usedTypes->structTypes.insert(type);
 	OrderedAllVisitor::visit(type);
 }
 
-void UsedTypesVisitor::visit(ShPtr<FunctionType> type) {
+void UsedTypesVisitor::visit(const ShPtr<FunctionType> &type) {
 	usedTypes->otherTypes.insert(type);
 	OrderedAllVisitor::visit(type);
 }
 
-void UsedTypesVisitor::visit(ShPtr<VoidType> type) {
+void UsedTypesVisitor::visit(const ShPtr<VoidType> &type) {
 	usedTypes->otherTypes.insert(type);
 }
 
-void UsedTypesVisitor::visit(ShPtr<UnknownType> type) {
+void UsedTypesVisitor::visit(const ShPtr<UnknownType> &type) {
 	usedTypes->otherTypes.insert(type);
 }
 
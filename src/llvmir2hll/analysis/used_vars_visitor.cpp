@@ -285,13 +285,13 @@ ShPtr<UsedVars> UsedVarsVisitor::getUsedVars(ShPtr<Value> value,
 	return visitor->getUsedVars_(value);
 }
 
-void UsedVarsVisitor::visit(ShPtr<Function> func) {
+void UsedVarsVisitor::visit(const ShPtr<Function> &func) {
 	if (func->isDefinition()) {
 		visitStmt(func->getBody());
 	}
 }
 
-void UsedVarsVisitor::visit(ShPtr<Variable> var) {
+void UsedVarsVisitor::visit(const ShPtr<Variable> &var) {
 	if (writing) {
 		usedVars->writtenVars.insert(var);
 	} else {
@@ -301,7 +301,7 @@ void UsedVarsVisitor::visit(ShPtr<Variable> var) {
 	usedVars->numOfVarUses[var]++;
 }
 
-void UsedVarsVisitor::visit(ShPtr<ArrayIndexOpExpr> expr) {
+void UsedVarsVisitor::visit(const ShPtr<ArrayIndexOpExpr> &expr) {
 	// We consider a in a[1] = 5 to be just read (not written). This allows a
 	// much simpler implementation of various optimizations.
 	bool oldWriting = writing;
@@ -311,7 +311,7 @@ void UsedVarsVisitor::visit(ShPtr<ArrayIndexOpExpr> expr) {
 	writing = oldWriting;
 }
 
-void UsedVarsVisitor::visit(ShPtr<StructIndexOpExpr> expr) {
+void UsedVarsVisitor::visit(const ShPtr<StructIndexOpExpr> &expr) {
 	// We consider a in a['1'] = 5 to be just read (not written). This allows a
 	// much simpler implementation of various optimizations.
 	bool oldWriting = writing;
@@ -321,7 +321,7 @@ void UsedVarsVisitor::visit(ShPtr<StructIndexOpExpr> expr) {
 	writing = oldWriting;
 }
 
-void UsedVarsVisitor::visit(ShPtr<DerefOpExpr> expr) {
+void UsedVarsVisitor::visit(const ShPtr<DerefOpExpr> &expr) {
 	// We consider a in *a = 5 to be just read (not written). This allows a
 	// much simpler implementation of various optimizations.
 	bool oldWriting = writing;
@@ -330,7 +330,7 @@ void UsedVarsVisitor::visit(ShPtr<DerefOpExpr> expr) {
 	writing = oldWriting;
 }
 
-void UsedVarsVisitor::visit(ShPtr<AssignStmt> stmt) {
+void UsedVarsVisitor::visit(const ShPtr<AssignStmt> &stmt) {
 	writing = true;
 	stmt->getLhs()->accept(this);
 	writing = false;
@@ -341,7 +341,7 @@ void UsedVarsVisitor::visit(ShPtr<AssignStmt> stmt) {
 	}
 }
 
-void UsedVarsVisitor::visit(ShPtr<VarDefStmt> stmt) {
+void UsedVarsVisitor::visit(const ShPtr<VarDefStmt> &stmt) {
 	writing = true;
 	stmt->getVar()->accept(this);
 	writing = false;
@@ -354,7 +354,7 @@ void UsedVarsVisitor::visit(ShPtr<VarDefStmt> stmt) {
 	}
 }
 
-void UsedVarsVisitor::visit(ShPtr<ForLoopStmt> stmt) {
+void UsedVarsVisitor::visit(const ShPtr<ForLoopStmt> &stmt) {
 	writing = true;
 	stmt->getIndVar()->accept(this);
 	writing = false;
@@ -660,6 +660,16 @@ void ValueAnalysis::initAliasAnalysis(ShPtr<Module> module) {
 	aliasAnalysis->init(module);
 }
 
+/**
+* @brief Returns the underlying alias analysis.
+*
+* It can be used to create another value analysis sharing the alias analysis,
+* e.g. for a thread optimizing functions in parallel.
+*/
+ShPtr<AliasAnalysis> ValueAnalysis::getAliasAnalysis() const {
+	return aliasAnalysis;
+}
+
 /**
 * @brief Returns the set of variables to which @a var may point to.
 *
@@ -835,7 +845,7 @@ void ValueAnalysis::computeAndStoreIndirectlyUsedVars(ShPtr<DerefOpExpr> expr) {
 	}
 }
 
-void ValueAnalysis::visit(ShPtr<Function> func) {
+void ValueAnalysis::visit(const ShPtr<Function> &func) {
 	//
 	// Caching
 	//
@@ -848,7 +858,7 @@ void ValueAnalysis::visit(ShPtr<Function> func) {
 	}
 }
 
-void ValueAnalysis::visit(ShPtr<AssignStmt> stmt) {
+void ValueAnalysis::visit(const ShPtr<AssignStmt> &stmt) {
 	//
 	// Caching
 	//
@@ -867,7 +877,7 @@ void ValueAnalysis::visit(ShPtr<AssignStmt> stmt) {
 	stmt->getRhs()->accept(this);
 }
 
-void ValueAnalysis::visit(ShPtr<BreakStmt> stmt) {
+void ValueAnalysis::visit(const ShPtr<BreakStmt> &stmt) {
 	//
 	// Caching
 	//
@@ -878,7 +888,7 @@ void ValueAnalysis::visit(ShPtr<BreakStmt> stmt) {
 	OrderedAllVisitor::visit(stmt);
 }
 
-void ValueAnalysis::visit(ShPtr<CallStmt> stmt) {
+void ValueAnalysis::visit(const ShPtr<CallStmt> &stmt) {
 	//
 	// Caching
 	//
@@ -889,7 +899,7 @@ void ValueAnalysis::visit(ShPtr<CallStmt> stmt) {
 	OrderedAllVisitor::visit(stmt);
 }
 
-void ValueAnalysis::visit(ShPtr<ContinueStmt> stmt) {
+void ValueAnalysis::visit(const ShPtr<ContinueStmt> &stmt) {
 	//
 	// Caching
 	//
@@ -900,7 +910,7 @@ void ValueAnalysis::visit(ShPtr<ContinueStmt> stmt) {
 	OrderedAllVisitor::visit(stmt);
 }
 
-void ValueAnalysis::visit(ShPtr<EmptyStmt> stmt) {
+void ValueAnalysis::visit(const ShPtr<EmptyStmt> &stmt) {
 	//
 	// Caching
 	//
@@ -911,7 +921,7 @@ void ValueAnalysis::visit(ShPtr<EmptyStmt> stmt) {
 	OrderedAllVisitor::visit(stmt);
 }
 
-void ValueAnalysis::visit(ShPtr<ForLoopStmt> stmt) {
+void ValueAnalysis::visit(const ShPtr<ForLoopStmt> &stmt) {
 	//
 	// Caching
 	//
@@ -932,7 +942,7 @@ void ValueAnalysis::visit(ShPtr<ForLoopStmt> stmt) {
 	stmt->getStep()->accept(this);
 }
 
-void ValueAnalysis::visit(ShPtr<UForLoopStmt> stmt) {
+void ValueAnalysis::visit(const ShPtr<UForLoopStmt> &stmt) {
 	//
 	// Caching
 	//
@@ -956,7 +966,7 @@ void ValueAnalysis::visit(ShPtr<UForLoopStmt> stmt) {
 	}
 }
 
-void ValueAnalysis::visit(ShPtr<GotoStmt> stmt) {
+void ValueAnalysis::visit(const ShPtr<GotoStmt> &stmt) {
 	//
 	// Caching
 	//
@@ -967,7 +977,7 @@ void ValueAnalysis::visit(ShPtr<GotoStmt> stmt) {
 	OrderedAllVisitor::visit(stmt);
 }
 
-void ValueAnalysis::visit(ShPtr<IfStmt> stmt) {
+void ValueAnalysis::visit(const ShPtr<IfStmt> &stmt) {
 	//
 	// Caching
 	//
@@ -978,7 +988,7 @@ void ValueAnalysis::visit(ShPtr<IfStmt> stmt) {
 	OrderedAllVisitor::visit(stmt);
 }
 
-void ValueAnalysis::visit(ShPtr<ReturnStmt> stmt) {
+void ValueAnalysis::visit(const ShPtr<ReturnStmt> &stmt) {
 	//
 	// Caching
 	//
@@ -989,7 +999,7 @@ void ValueAnalysis::visit(ShPtr<ReturnStmt> stmt) {
 	OrderedAllVisitor::visit(stmt);
 }
 
-void ValueAnalysis::visit(ShPtr<SwitchStmt> stmt) {
+void ValueAnalysis::visit(const ShPtr<SwitchStmt> &stmt) {
 	//
 	// Caching
 	//
@@ -1000,7 +1010,7 @@ void ValueAnalysis::visit(ShPtr<SwitchStmt> stmt) {
 	OrderedAllVisitor::visit(stmt);
 }
 
-void ValueAnalysis::visit(ShPtr<UnreachableStmt> stmt) {
+void ValueAnalysis::visit(const ShPtr<UnreachableStmt> &stmt) {
 	//
 	// Caching
 	//
@@ -1011,7 +1021,7 @@ void ValueAnalysis::visit(ShPtr<UnreachableStmt> stmt) {
 	OrderedAllVisitor::visit(stmt);
 }
 
-void ValueAnalysis::visit(ShPtr<VarDefStmt> stmt) {
+void ValueAnalysis::visit(const ShPtr<VarDefStmt> &stmt) {
 	//
 	// Caching
 	//
@@ -1032,7 +1042,7 @@ void ValueAnalysis::visit(ShPtr<VarDefStmt> stmt) {
 	}
 }
 
-void ValueAnalysis::visit(ShPtr<WhileLoopStmt> stmt) {
+void ValueAnalysis::visit(const ShPtr<WhileLoopStmt> &stmt) {
 	//
 	// Caching
 	//
@@ -1043,7 +1053,7 @@ void ValueAnalysis::visit(ShPtr<WhileLoopStmt> stmt) {
 	OrderedAllVisitor::visit(stmt);
 }
 
-void ValueAnalysis::visit(ShPtr<AddOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<AddOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1054,7 +1064,7 @@ void ValueAnalysis::visit(ShPtr<AddOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<AddressOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<AddressOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1074,7 +1084,7 @@ void ValueAnalysis::visit(ShPtr<AddressOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<AndOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<AndOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1085,7 +1095,7 @@ void ValueAnalysis::visit(ShPtr<AndOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<ArrayIndexOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<ArrayIndexOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1111,7 +1121,7 @@ void ValueAnalysis::visit(ShPtr<ArrayIndexOpExpr> expr) {
 	writing = oldWriting;
 }
 
-void ValueAnalysis::visit(ShPtr<AssignOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<AssignOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1130,7 +1140,7 @@ void ValueAnalysis::visit(ShPtr<AssignOpExpr> expr) {
 	expr->getSecondOperand()->accept(this);
 }
 
-void ValueAnalysis::visit(ShPtr<StructIndexOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<StructIndexOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1156,7 +1166,7 @@ void ValueAnalysis::visit(ShPtr<StructIndexOpExpr> expr) {
 	writing = oldWriting;
 }
 
-void ValueAnalysis::visit(ShPtr<BitAndOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<BitAndOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1167,7 +1177,7 @@ void ValueAnalysis::visit(ShPtr<BitAndOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<BitOrOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<BitOrOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1178,7 +1188,7 @@ void ValueAnalysis::visit(ShPtr<BitOrOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<BitShlOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<BitShlOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1189,7 +1199,7 @@ void ValueAnalysis::visit(ShPtr<BitShlOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<BitShrOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<BitShrOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1200,7 +1210,7 @@ void ValueAnalysis::visit(ShPtr<BitShrOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<BitXorOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<BitXorOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1211,7 +1221,7 @@ void ValueAnalysis::visit(ShPtr<BitXorOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<CallExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<CallExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1229,7 +1239,7 @@ void ValueAnalysis::visit(ShPtr<CallExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<CommaOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<CommaOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1240,7 +1250,7 @@ void ValueAnalysis::visit(ShPtr<CommaOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<DerefOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<DerefOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1269,7 +1279,7 @@ void ValueAnalysis::visit(ShPtr<DerefOpExpr> expr) {
 	// do this instead of just calling expr->getOperand()->accept(this) is that
 	// if we did this, we would also compute indirectly used variables for all
 	// sub-dereferences, which might give us invalid results. Indeed, recall
-	// that in every call to <tt>visit(ShPtr<DerefOpExpr> expr)</tt>, we
+	// that in every call to <tt>visit(const ShPtr<DerefOpExpr> &expr)</tt>, we
 	// compute indirectly used variables.
 	ShPtr<Expression> firstNonDerefExpr(expr->getOperand());
 	while (isa<DerefOpExpr>(firstNonDerefExpr)) {
@@ -1283,7 +1293,7 @@ void ValueAnalysis::visit(ShPtr<DerefOpExpr> expr) {
 	writing = oldWriting;
 }
 
-void ValueAnalysis::visit(ShPtr<DivOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<DivOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1294,7 +1304,7 @@ void ValueAnalysis::visit(ShPtr<DivOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<EqOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<EqOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1305,7 +1315,7 @@ void ValueAnalysis::visit(ShPtr<EqOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<GtEqOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<GtEqOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1316,7 +1326,7 @@ void ValueAnalysis::visit(ShPtr<GtEqOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<GtOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<GtOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1327,7 +1337,7 @@ void ValueAnalysis::visit(ShPtr<GtOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<LtEqOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<LtEqOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1338,7 +1348,7 @@ void ValueAnalysis::visit(ShPtr<LtEqOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<LtOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<LtOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1349,7 +1359,7 @@ void ValueAnalysis::visit(ShPtr<LtOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<ModOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<ModOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1360,7 +1370,7 @@ void ValueAnalysis::visit(ShPtr<ModOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<MulOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<MulOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1371,7 +1381,7 @@ void ValueAnalysis::visit(ShPtr<MulOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<NegOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<NegOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1382,7 +1392,7 @@ void ValueAnalysis::visit(ShPtr<NegOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<NeqOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<NeqOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1393,7 +1403,7 @@ void ValueAnalysis::visit(ShPtr<NeqOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<NotOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<NotOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1404,7 +1414,7 @@ void ValueAnalysis::visit(ShPtr<NotOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<OrOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<OrOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1415,7 +1425,7 @@ void ValueAnalysis::visit(ShPtr<OrOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<SubOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<SubOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1426,7 +1436,7 @@ void ValueAnalysis::visit(ShPtr<SubOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<TernaryOpExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<TernaryOpExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1437,7 +1447,7 @@ void ValueAnalysis::visit(ShPtr<TernaryOpExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<Variable> var) {
+void ValueAnalysis::visit(const ShPtr<Variable> &var) {
 	//
 	// Caching
 	//
@@ -1459,7 +1469,7 @@ void ValueAnalysis::visit(ShPtr<Variable> var) {
 	valueData->dirNumOfVarUses[var]++;
 }
 
-void ValueAnalysis::visit(ShPtr<BitCastExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<BitCastExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1470,7 +1480,7 @@ void ValueAnalysis::visit(ShPtr<BitCastExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<ExtCastExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<ExtCastExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1481,7 +1491,7 @@ void ValueAnalysis::visit(ShPtr<ExtCastExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<FPToIntCastExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<FPToIntCastExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1492,7 +1502,7 @@ void ValueAnalysis::visit(ShPtr<FPToIntCastExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<IntToFPCastExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<IntToFPCastExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1503,7 +1513,7 @@ void ValueAnalysis::visit(ShPtr<IntToFPCastExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<IntToPtrCastExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<IntToPtrCastExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1514,7 +1524,7 @@ void ValueAnalysis::visit(ShPtr<IntToPtrCastExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<PtrToIntCastExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<PtrToIntCastExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1525,7 +1535,7 @@ void ValueAnalysis::visit(ShPtr<PtrToIntCastExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<TruncCastExpr> expr) {
+void ValueAnalysis::visit(const ShPtr<TruncCastExpr> &expr) {
 	//
 	// Caching
 	//
@@ -1536,7 +1546,7 @@ void ValueAnalysis::visit(ShPtr<TruncCastExpr> expr) {
 	OrderedAllVisitor::visit(expr);
 }
 
-void ValueAnalysis::visit(ShPtr<ConstArray> constant) {
+void ValueAnalysis::visit(const ShPtr<ConstArray> &constant) {
 	//
 	// Caching
 	//
@@ -1547,7 +1557,7 @@ void ValueAnalysis::visit(ShPtr<ConstArray> constant) {
 	OrderedAllVisitor::visit(constant);
 }
 
-void ValueAnalysis::visit(ShPtr<ConstBool> constant) {
+void ValueAnalysis::visit(const ShPtr<ConstBool> &constant) {
 	//
 	// Caching
 	//
@@ -1558,7 +1568,7 @@ void ValueAnalysis::visit(ShPtr<ConstBool> constant) {
 	OrderedAllVisitor::visit(constant);
 }
 
-void ValueAnalysis::visit(ShPtr<ConstFloat> constant) {
+void ValueAnalysis::visit(const ShPtr<ConstFloat> &constant) {
 	//
 	// Caching
 	//
@@ -1569,7 +1579,7 @@ void ValueAnalysis::visit(ShPtr<ConstFloat> constant) {
 	OrderedAllVisitor::visit(constant);
 }
 
-void ValueAnalysis::visit(ShPtr<ConstInt> constant) {
+void ValueAnalysis::visit(const ShPtr<ConstInt> &constant) {
 	//
 	// Caching
 	//
@@ -1580,7 +1590,7 @@ void ValueAnalysis::visit(ShPtr<ConstInt> constant) {
 	OrderedAllVisitor::visit(constant);
 }
 
-void ValueAnalysis::visit(ShPtr<ConstNullPointer> constant) {
+void ValueAnalysis::visit(const ShPtr<ConstNullPointer> &constant) {
 	//
 	// Caching
 	//
@@ -1591,7 +1601,7 @@ void ValueAnalysis::visit(ShPtr<ConstNullPointer> constant) {
 	OrderedAllVisitor::visit(constant);
 }
 
-void ValueAnalysis::visit(ShPtr<ConstString> constant) {
+void ValueAnalysis::visit(const ShPtr<ConstString> &constant) {
 	//
 	// Caching
 	//
@@ -1602,7 +1612,7 @@ void ValueAnalysis::visit(ShPtr<ConstString> constant) {
 	OrderedAllVisitor::visit(constant);
 }
 
-void ValueAnalysis::visit(ShPtr<ConstStruct> constant) {
+void ValueAnalysis::visit(const ShPtr<ConstStruct> &constant) {
 	//
 	// Caching
 	//
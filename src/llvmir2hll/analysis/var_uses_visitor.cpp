@@ -329,6 +329,8 @@ void VarUsesVisitor::stmtHasBeenRemoved(ShPtr<Statement> stmt,
 * up subsequent calls to getUses().
 * @param[in] module If non-null, this function pre-computes information for
 *                   every function and variable in the module.
+* @param[in] funcs If @a module is non-null and @a funcs is non-empty,
+*                  information is pre-computed only for functions in @a funcs.
 *
 * @par Preconditions
 *  - @a va is non-null
@@ -338,7 +340,7 @@ void VarUsesVisitor::stmtHasBeenRemoved(ShPtr<Statement> stmt,
 * All methods of this class leave @a va in a valid state.
 */
 ShPtr<VarUsesVisitor> VarUsesVisitor::create(ShPtr<ValueAnalysis> va,
-		bool enableCaching, ShPtr<Module> module) {
+		bool enableCaching, ShPtr<Module> module, const FuncSet &funcs) {
 	PRECONDITION_NON_NULL(va);
 	PRECONDITION(!module || enableCaching,
 		"when module is non-null, caching has to be enabled");
@@ -348,7 +350,7 @@ ShPtr<VarUsesVisitor> VarUsesVisitor::create(ShPtr<ValueAnalysis> va,
 
 	// Pre-compute everything if requested.
 	if (module) {
-		visitor->precomputeEverything(module);
+		visitor->precomputeEverything(module, funcs);
 	}
 
 	return visitor;
@@ -356,13 +358,21 @@ ShPtr<VarUsesVisitor> VarUsesVisitor::create(ShPtr<ValueAnalysis> va,
 
 /**
 * @brief Pre-computes uses of variables in all functions of the given module.
+*
+* If @a funcs is non-empty, only functions in @a funcs are considered. Uses in
+* other functions are computed on demand.
 */
-void VarUsesVisitor::precomputeEverything(ShPtr<Module> module) {
+void VarUsesVisitor::precomputeEverything(ShPtr<Module> module,
+		const FuncSet &funcs) {
 	precomputing = true;
 
 	// For every function in the module...
 	for (auto i = module->func_definition_begin(),
 			e = module->func_definition_end(); i != e; ++i) {
+		if (!funcs.empty() && !hasItem(funcs, *i)) {
+			continue;
+		}
+
 		func = *i;
 
 		// If a global variable is not used in a function, we normally wouldn't
@@ -457,72 +467,72 @@ void VarUsesVisitor::dumpCache() {
 	llvm::errs() << "\n";
 }
 
-void VarUsesVisitor::visit(ShPtr<AssignStmt> stmt) {
+void VarUsesVisitor::visit(const ShPtr<AssignStmt> &stmt) {
 	findAndStoreUses(stmt);
 	OrderedAllVisitor::visit(stmt);
 }
 
-void VarUsesVisitor::visit(ShPtr<VarDefStmt> stmt) {
+void VarUsesVisitor::visit(const ShPtr<VarDefStmt> &stmt) {
 	findAndStoreUses(stmt);
 	OrderedAllVisitor::visit(stmt);
 }
 
-void VarUsesVisitor::visit(ShPtr<CallStmt> stmt) {
+void VarUsesVisitor::visit(const ShPtr<CallStmt> &stmt) {
 	findAndStoreUses(stmt);
 	OrderedAllVisitor::visit(stmt);
 }
 
-void VarUsesVisitor::visit(ShPtr<ReturnStmt> stmt) {
+void VarUsesVisitor::visit(const ShPtr<ReturnStmt> &stmt) {
 	findAndStoreUses(stmt);
 	OrderedAllVisitor::visit(stmt);
 }
 
-void VarUsesVisitor::visit(ShPtr<EmptyStmt> stmt) {
+void VarUsesVisitor::visit(const ShPtr<EmptyStmt> &stmt) {
 	findAndStoreUses(stmt);
 	OrderedAllVisitor::visit(stmt);
 }
 
-void VarUsesVisitor::visit(ShPtr<IfStmt> stmt) {
+void VarUsesVisitor::visit(const ShPtr<IfStmt> &stmt) {
 	findAndStoreUses(stmt);
 	OrderedAllVisitor::visit(stmt);
 }
 
-void VarUsesVisitor::visit(ShPtr<SwitchStmt> stmt) {
+void VarUsesVisitor::visit(const ShPtr<SwitchStmt> &stmt) {
 	findAndStoreUses(stmt);
 	OrderedAllVisitor::visit(stmt);
 }
 
-void VarUsesVisitor::visit(ShPtr<WhileLoopStmt> stmt) {
+void VarUsesVisitor::visit(const ShPtr<WhileLoopStmt> &stmt) {
 	findAndStoreUses(stmt);
 	OrderedAllVisitor::visit(stmt);
 }
 
-void VarUsesVisitor::visit(ShPtr<ForLoopStmt> stmt) {
+void VarUsesVisitor::visit(const ShPtr<ForLoopStmt> &stmt) {
 	findAndStoreUses(stmt);
 	OrderedAllVisitor::visit(stmt);
 }
 
-void VarUsesVisitor::visit(ShPtr<UForLoopStmt> stmt) {
+void VarUsesVisitor::visit(const ShPtr<UForLoopStmt> &stmt) {
 	findAndStoreUses(stmt);
 	OrderedAllVisitor::visit(stmt);
 }
 
-void VarUsesVisitor::visit(ShPtr<BreakStmt> stmt) {
+void VarUsesVisitor::visit(const ShPtr<BreakStmt> &stmt) {
 	findAndStoreUses(stmt);
 	OrderedAllVisitor::visit(stmt);
 }
 
-void VarUsesVisitor::visit(ShPtr<ContinueStmt> stmt) {
+void VarUsesVisitor::visit(const ShPtr<ContinueStmt> &stmt) {
 	findAndStoreUses(stmt);
 	OrderedAllVisitor::visit(stmt);
 }
 
-void VarUsesVisitor::visit(ShPtr<GotoStmt> stmt) {
+void VarUsesVisitor::visit(const ShPtr<GotoStmt> &stmt) {
 	findAndStoreUses(stmt);
 	OrderedAllVisitor::visit(stmt);
 }
 
-void VarUsesVisitor::visit(ShPtr<UnreachableStmt> stmt) {
+void VarUsesVisitor::visit(const ShPtr<UnreachableStmt> &stmt) {
 	findAndStoreUses(stmt);
 	OrderedAllVisitor::visit(stmt);
 }
@@ -59,31 +59,31 @@ VarSet WrittenIntoGlobalsVisitor::getWrittenIntoGlobals(ShPtr<Function> func,
 	return visitor->writtenIntoGlobals;
 }
 
-void WrittenIntoGlobalsVisitor::visit(ShPtr<Variable> var) {
+void WrittenIntoGlobalsVisitor::visit(const ShPtr<Variable> &var) {
 	if (writing && hasItem(globalVars, var)) {
 		writtenIntoGlobals.insert(var);
 	}
 }
 
-void WrittenIntoGlobalsVisitor::visit(ShPtr<ArrayIndexOpExpr> expr) {
+void WrittenIntoGlobalsVisitor::visit(const ShPtr<ArrayIndexOpExpr> &expr) {
 	// We consider a in a[1] = 5 to be just read (not written). To this end, we
 	// now can stop the computation since inside the indexed expression, there
 	// can be only read variables.
 }
 
-void WrittenIntoGlobalsVisitor::visit(ShPtr<StructIndexOpExpr> expr) {
+void WrittenIntoGlobalsVisitor::visit(const ShPtr<StructIndexOpExpr> &expr) {
 	// We consider a in a['1'] = 5 to be just read (not written). To this end,
 	// we now can stop the computation since inside the indexed expression,
 	// there can be only read variables.
 }
 
-void WrittenIntoGlobalsVisitor::visit(ShPtr<DerefOpExpr> expr) {
+void WrittenIntoGlobalsVisitor::visit(const ShPtr<DerefOpExpr> &expr) {
 	// We consider a in *a = 5 to be just read (not written). To this end, we
 	// now can stop the computation since inside the dereferenced expression,
 	// there can be only read variables.
 }
 
-void WrittenIntoGlobalsVisitor::visit(ShPtr<AssignStmt> stmt) {
+void WrittenIntoGlobalsVisitor::visit(const ShPtr<AssignStmt> &stmt) {
 	writing = true;
 	stmt->getLhs()->accept(this);
 	writing = false;
@@ -92,7 +92,7 @@ void WrittenIntoGlobalsVisitor::visit(ShPtr<AssignStmt> stmt) {
 	visitStmt(stmt->getSuccessor());
 }
 
-void WrittenIntoGlobalsVisitor::visit(ShPtr<VarDefStmt> stmt) {
+void WrittenIntoGlobalsVisitor::visit(const ShPtr<VarDefStmt> &stmt) {
 	writing = true;
 	stmt->getVar()->accept(this);
 	writing = false;
@@ -101,7 +101,7 @@ void WrittenIntoGlobalsVisitor::visit(ShPtr<VarDefStmt> stmt) {
 	visitStmt(stmt->getSuccessor());
 }
 
-void WrittenIntoGlobalsVisitor::visit(ShPtr<ForLoopStmt> stmt) {
+void WrittenIntoGlobalsVisitor::visit(const ShPtr<ForLoopStmt> &stmt) {
 	writing = true;
 	stmt->getIndVar()->accept(this);
 	writing = false;
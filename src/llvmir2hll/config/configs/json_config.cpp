@@ -152,6 +152,18 @@ UPtr<JSONConfig> JSONConfig::fromString(const std::string &str) {
 	return config;
 }
 
+/**
+* @brief Returns a config wrapping a copy of the given already parsed config.
+*
+* This allows to pass the config from the front-end without serializing it.
+*/
+UPtr<JSONConfig> JSONConfig::fromConfig(const retdec::config::Config &config) {
+	// We cannot use std::make_unique() because JSONConfig() is private.
+	auto jsonConfig = UPtr<JSONConfig>(new JSONConfig());
+	jsonConfig->impl->config = config;
+	return jsonConfig;
+}
+
 /**
 * @brief Returns an empty config.
 */
@@ -0,0 +1,797 @@
+/**
+* @file src/llvmir2hll/decompiler.cpp
+* @brief Conversion of LLVM IR into the target high-level language.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+#include <fstream>
+
+#include <llvm/Analysis/LoopInfo.h>
+#include <llvm/Analysis/ScalarEvolution.h>
+
+#include "retdec/llvmir2hll/analysis/alias_analysis/alias_analysis.h"
+#include "retdec/llvmir2hll/analysis/alias_analysis/alias_analysis_factory.h"
+#include "retdec/llvmir2hll/analysis/value_analysis.h"
+#include "retdec/llvmir2hll/config/configs/json_config.h"
+#include "retdec/llvmir2hll/decompiler.h"
+#include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
+#include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator_factory.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_builders/non_recursive_cfg_builder.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_writer.h"
+#include "retdec/llvmir2hll/graphs/cfg/cfg_writer_factory.h"
+#include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
+#include "retdec/llvmir2hll/graphs/cg/cg_writer.h"
+#include "retdec/llvmir2hll/graphs/cg/cg_writer_factory.h"
+#include "retdec/llvmir2hll/hll/hll_writer.h"
+#include "retdec/llvmir2hll/hll/hll_writer_factory.h"
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/module.h"
+#include "retdec/llvmir2hll/llvm/llvm_debug_info_obtainer.h"
+#include "retdec/llvmir2hll/llvm/llvm_intrinsic_converter.h"
+#include "retdec/llvmir2hll/llvm/llvmir2bir_converter.h"
+#include "retdec/llvmir2hll/llvm/llvmir2bir_converter_factory.h"
+#include "retdec/llvmir2hll/obtainer/call_info_obtainer.h"
+#include "retdec/llvmir2hll/obtainer/call_info_obtainer_factory.h"
+#include "retdec/llvmir2hll/optimizer/optimizer_manager.h"
+#include "retdec/llvmir2hll/pattern/pattern_finder_factory.h"
+#include "retdec/llvmir2hll/pattern/pattern_finder_runners/cli_pattern_finder_runner.h"
+#include "retdec/llvmir2hll/pattern/pattern_finder_runners/no_action_pattern_finder_runner.h"
+#include "retdec/llvmir2hll/semantics/semantics/compound_semantics_builder.h"
+#include "retdec/llvmir2hll/semantics/semantics/default_semantics.h"
+#include "retdec/llvmir2hll/support/const_symbol_converter.h"
+#include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/llvmir2hll/support/expr_types_fixer.h"
+#include "retdec/llvmir2hll/support/funcs_with_prefix_remover.h"
+#include "retdec/llvmir2hll/support/library_funcs_remover.h"
+#include "retdec/llvmir2hll/support/profiling.h"
+#include "retdec/llvmir2hll/support/unreachable_code_in_cfg_remover.h"
+#include "retdec/llvmir2hll/utils/ir.h"
+#include "retdec/llvmir2hll/utils/string.h"
+#include "retdec/llvmir2hll/validator/validator.h"
+#include "retdec/llvmir2hll/validator/validator_factory.h"
+#include "retdec/llvmir2hll/var_name_gen/var_name_gen_factory.h"
+#include "retdec/llvmir2hll/var_renamer/var_renamer.h"
+#include "retdec/llvmir2hll/var_renamer/var_renamer_factory.h"
+#include "retdec/llvm-support/diagnostics.h"
+#include "retdec/utils/container.h"
+#include "retdec/utils/memory.h"
+#include "retdec/utils/string.h"
+
+using namespace llvm;
+
+using retdec::utils::hasItem;
+using retdec::utils::joinStrings;
+using retdec::utils::limitSystemMemory;
+using retdec::utils::limitSystemMemoryToHalfOfTotalSystemMemory;
+using retdec::utils::split;
+
+namespace retdec {
+namespace llvmir2hll {
+
+namespace {
+
+/**
+* @brief Returns a list of all supported objects by the given factory.
+*
+* @tparam FactoryType Type of the factory in whose objects we are interested in.
+*
+* The list is comma separated and has no beginning or trailing whitespace.
+*/
+template<typename FactoryType>
+std::string getListOfSupportedObjects() {
+	return joinStrings(FactoryType::getInstance().getRegisteredObjects());
+}
+
+/**
+* @brief Prints an error message concerning the situation when an unsupported
+*        object has been selected from the given factory.
+*
+* @param[in] typeOfObjectsSingular A human-readable description of the type of
+*                                  objects the factory provides. In the
+*                                  singular form, e.g. "HLL writer".
+* @param[in] typeOfObjectsPlural A human-readable description of the type of
+*                                objects the factory provides. In the plural
+*                                form, e.g. "HLL writers".
+*
+* @tparam FactoryType Type of the factory in whose objects we are interested in.
+*/
+template<typename FactoryType>
+void printErrorUnsupportedObject(const std::string &typeOfObjectsSingular,
+		const std::string &typeOfObjectsPlural) {
+	std::string supportedObjects(getListOfSupportedObjects<FactoryType>());
+	if (!supportedObjects.empty()) {
+		retdec::llvm_support::printErrorMessage("Invalid name of the ",
+			typeOfObjectsSingular, " (supported names are: ", supportedObjects,
+			").");
+	} else {
+		retdec::llvm_support::printErrorMessage("There are no available ",
+			typeOfObjectsPlural, ". Please, recompile the backend and try it"
+			" again.");
+	}
+}
+
+} // anonymous namespace
+
+// Static variables and constants initialization.
+char Decompiler::ID = 0;
+
+/**
+* @brief Constructs a new decompiler.
+*
+* @param[in] out Output stream into which the generated HLL code will be
+*                emitted.
+* @param[in] options Options of the decompilation.
+* @param[in] config Config of the module. If it is the null pointer, the config
+*                   is loaded from @c options.configPath.
+*/
+Decompiler::Decompiler(raw_pwrite_stream &out,
+		const DecompilerOptions &options, ShPtr<Config> config):
+	ModulePass(ID), out(out), options(options), llvmModule(nullptr),
+	resModule(), semantics(), config(config), configGiven(config != nullptr),
+	hllWriter(), aliasAnalysis(), cio(), arithmExprEvaluator(),
+	varNameGen(), varRenamer(), llvm2BIRConverter(), phaseRunning(false),
+	succeeded(false) {}
+
+void Decompiler::getAnalysisUsage(AnalysisUsage &au) const {
+	au.addRequired<LoopInfoWrapperPass>();
+	au.addRequired<ScalarEvolutionWrapperPass>();
+	au.setPreservesAll();
+}
+
+bool Decompiler::runOnModule(llvm::Module &m) {
+	succeeded = false;
+	startPhase("initialization");
+
+	bool decompilationShouldContinue = initialize(m);
+	if (!decompilationShouldContinue) {
+		endPhase();
+		return false;
+	}
+
+	startPhase("conversion of LLVM IR into BIR");
+	convertLLVMIRToBIR();
+
+	StringSet funcPrefixes(getPrefixesOfFuncsToBeRemoved());
+	startPhase("removing functions prefixed with [" + joinStrings(funcPrefixes) + "]");
+	removeFuncsPrefixedWith(funcPrefixes);
+
+	if (!options.keepLibraryFunctions) {
+		startPhase("removing functions from standard libraries");
+		removeLibraryFuncs();
+	}
+
+	// The following phase needs to be done right after the conversion because
+	// there may be code that is not reachable in a CFG. This happens because
+	// the conversion of LLVM IR to BIR is not perfect, so it may introduce
+	// unreachable code. This causes problems later during optimizations
+	// because the code exists in BIR, but not in a CFG.
+	startPhase("removing code that is not reachable in a CFG");
+	removeCodeUnreachableInCFG();
+
+	startPhase("signed/unsigned types fixing");
+	fixSignedUnsignedTypes();
+
+	startPhase("converting LLVM intrinsic functions to standard functions");
+	convertLLVMIntrinsicFunctions();
+
+	if (resModule->isDebugInfoAvailable()) {
+		startPhase("obtaining debug information");
+		obtainDebugInfo();
+	}
+
+	if (!options.noOpts) {
+		startPhase("alias analysis [" + aliasAnalysis->getId() + "]");
+		initAliasAnalysis();
+
+		startPhase("optimizations [" + getTypeOfRunOptimizations() + "]");
+		runOptimizations();
+	}
+
+	if (!options.noVarRenaming) {
+		startPhase("variable renaming [" + varRenamer->getId() + "]");
+		renameVariables();
+	}
+
+	if (!options.noSymbolicNames) {
+		startPhase("converting constants to symbolic names");
+		convertConstantsToSymbolicNames();
+	}
+
+	if (options.validateModule) {
+		startPhase("module validation");
+		validateResultingModule();
+	}
+
+	if (!options.findPatterns.empty()) {
+		startPhase("finding patterns");
+		findPatterns();
+	}
+
+	if (options.emitCfgs) {
+		startPhase("emission of control-flow graphs");
+		emitCFGs();
+	}
+
+	if (options.emitCg) {
+		startPhase("emission of a call graph");
+		emitCG();
+	}
+
+	startPhase("emission of the target code [" + hllWriter->getId() + "]");
+	emitTargetHLLCode();
+
+	startPhase("finalization");
+	finalize();
+
+	startPhase("cleanup");
+	cleanup();
+	endPhase();
+
+	succeeded = true;
+	return false;
+}
+
+/**
+* @brief Returns @c true if the last run of the decompilation has finished
+*        successfully, @c false otherwise.
+*
+* runOnModule() always returns @c false because it does not modify the LLVM
+* module, so this is the only way how to find out whether it failed.
+*/
+bool Decompiler::hasSucceeded() const {
+	return succeeded;
+}
+
+/**
+* @brief Starts a new phase of the decompilation called @a phase.
+*
+* The phase is printed if debug messages are enabled. If there is a profiler
+* in the options, the previous phase is ended and the new one is recorded in
+* it.
+*/
+void Decompiler::startPhase(const std::string &phase) {
+	if (options.debug) {
+		retdec::llvm_support::printPhase(phase);
+	}
+
+	if (options.profiler) {
+		auto size = getModuleSize(resModule);
+		if (phaseRunning) {
+			options.profiler->stop(size);
+		}
+		options.profiler->start(phase, size);
+		phaseRunning = true;
+	}
+}
+
+/**
+* @brief Ends the last phase started by startPhase().
+*/
+void Decompiler::endPhase() {
+	if (options.profiler && phaseRunning) {
+		options.profiler->stop(getModuleSize(resModule));
+		phaseRunning = false;
+	}
+}
+
+/**
+* @brief Initializes all the needed private variables.
+*
+* @return @c true if the decompilation should continue (the initialization went
+*         OK), @c false otherwise.
+*/
+bool Decompiler::initialize(llvm::Module &m) {
+	llvmModule = &m;
+
+	// Maximal memory limitation.
+	bool memoryLimitationSucceeded = limitMaximalMemoryIfRequested();
+	if (!memoryLimitationSucceeded) {
+		return false;
+	}
+
+	// Instantiate the requested HLL writer and make sure it exists. We need to
+	// explicitly specify template parameters because raw_pwrite_stream has
+	// a private copy constructor, so it needs to be passed by reference.
+	if (options.debug) retdec::llvm_support::printSubPhase("creating the used HLL writer [" + options.targetHll + "]");
+	hllWriter = HLLWriterFactory::getInstance().createObject<
+		raw_pwrite_stream &>(options.targetHll, out);
+	if (!hllWriter) {
+		printErrorUnsupportedObject<HLLWriterFactory>(
+			"target HLL", "target HLLs");
+		return false;
+	}
+
+	// Instantiate the requested alias analysis and make sure it exists.
+	if (options.debug) retdec::llvm_support::printSubPhase("creating the used alias analysis [" + options.aliasAnalysis + "]");
+	aliasAnalysis = AliasAnalysisFactory::getInstance().createObject(
+		options.aliasAnalysis);
+	if (!aliasAnalysis) {
+		printErrorUnsupportedObject<AliasAnalysisFactory>(
+			"alias analysis", "alias analyses");
+		return false;
+	}
+
+	// Instantiate the requested obtainer of information about function
+	// calls and make sure it exists.
+	if (options.debug) retdec::llvm_support::printSubPhase("creating the used call info obtainer [" + options.callInfoObtainer + "]");
+	cio = CallInfoObtainerFactory::getInstance().createObject(
+		options.callInfoObtainer);
+	if (!cio) {
+		printErrorUnsupportedObject<CallInfoObtainerFactory>(
+			"call info obtainer", "call info obtainers");
+		return false;
+	}
+
+	// Instantiate the requested evaluator of arithmetical expressions and make
+	// sure it exists.
+	if (options.debug) retdec::llvm_support::printSubPhase("creating the used evaluator of arithmetical expressions [" +
+		options.arithmExprEvaluator + "]");
+	arithmExprEvaluator = ArithmExprEvaluatorFactory::getInstance().createObject(
+		options.arithmExprEvaluator);
+	if (!arithmExprEvaluator) {
+		printErrorUnsupportedObject<ArithmExprEvaluatorFactory>(
+			"evaluator of arithmetical expressions", "evaluators of arithmetical expressions");
+		return false;
+	}
+
+	// Instantiate the requested variable names generator and make sure it
+	// exists.
+	if (options.debug) retdec::llvm_support::printSubPhase("creating the used variable names generator [" + options.varNameGen + "]");
+	varNameGen = VarNameGenFactory::getInstance().createObject(
+		options.varNameGen, options.varNameGenPrefix);
+	if (!varNameGen) {
+		printErrorUnsupportedObject<VarNameGenFactory>(
+			"variable names generator", "variable names generators");
+		return false;
+	}
+
+	// Instantiate the requested variable renamer and make sure it exists.
+	if (options.debug) retdec::llvm_support::printSubPhase("creating the used variable renamer [" + options.varRenamer + "]");
+	varRenamer = VarRenamerFactory::getInstance().createObject(
+		options.varRenamer, varNameGen, true);
+	if (!varRenamer) {
+		printErrorUnsupportedObject<VarRenamerFactory>(
+			"renamer of variables", "renamers of variables");
+		return false;
+	}
+
+	// Instantiate the requested converter of LLVM IR to BIR and make sure it
+	// exists.
+	if (options.debug) retdec::llvm_support::printSubPhase("creating the used LLVM IR to BIR converter [" + options.llvmir2BirConverter + "]");
+	llvm2BIRConverter = LLVMIR2BIRConverterFactory::getInstance().createObject(
+		options.llvmir2BirConverter, this);
+	if (!llvm2BIRConverter) {
+		printErrorUnsupportedObject<LLVMIR2BIRConverterFactory>(
+			"converter of LLVM IR to BIR", "converters of LLVM IR to BIR");
+		return false;
+	}
+	// Options
+	llvm2BIRConverter->setOptionStrictFPUSemantics(options.strictFpuSemantics);
+
+	createSemantics();
+
+	bool configLoaded = loadConfig();
+	if (!configLoaded) {
+		return false;
+	}
+
+	// Everything went OK.
+	return true;
+}
+
+/**
+* @brief Limits the maximal memory of the tool based on the command-line
+*        parameters.
+*/
+bool Decompiler::limitMaximalMemoryIfRequested() {
+	if (options.maxMemoryLimitHalfRam) {
+		auto limitationSucceeded = limitSystemMemoryToHalfOfTotalSystemMemory();
+		if (!limitationSucceeded) {
+			retdec::llvm_support::printErrorMessage(
+				"Failed to limit maximal memory to half of system RAM."
+			);
+			return false;
+		}
+	} else if (options.maxMemoryLimit > 0) {
+		auto limitationSucceeded = limitSystemMemory(options.maxMemoryLimit);
+		if (!limitationSucceeded) {
+			retdec::llvm_support::printErrorMessage(
+				"Failed to limit maximal memory to " + std::to_string(options.maxMemoryLimit) + "."
+			);
+		}
+	}
+
+	return true;
+}
+
+/**
+* @brief Creates the used semantics.
+*/
+void Decompiler::createSemantics() {
+	if (!options.semantics.empty()) {
+		// The user has requested some concrete semantics, so use it.
+		createSemanticsFromParameter();
+	} else {
+		// The user didn't request any semantics, so create it based on the
+		// data in the input LLVM IR.
+		createSemanticsFromLLVMIR();
+	}
+}
+
+/**
+* @brief Creates the used semantics as requested by the user.
+*/
+void Decompiler::createSemanticsFromParameter() {
+	if (options.semantics.empty() || options.semantics == "-") {
+		// Do no use any semantics.
+		if (options.debug) retdec::llvm_support::printSubPhase("creating the used semantics [none]");
+		semantics = DefaultSemantics::create();
+	} else {
+		// Use the given semantics.
+		if (options.debug) retdec::llvm_support::printSubPhase("creating the used semantics [" + options.semantics + "]");
+		semantics = CompoundSemanticsBuilder::build(split(options.semantics, ','));
+	}
+}
+
+/**
+* @brief Creates the used semantics based on the data in the input LLVM IR.
+*/
+void Decompiler::createSemanticsFromLLVMIR() {
+	// Create a list of the semantics to be used.
+	// TODO Use some data from the input LLVM IR, like the used compiler.
+	std::string usedSemantics("libc,gcc-general,win-api");
+
+	// Use the list to create the semantics.
+	if (options.debug) retdec::llvm_support::printSubPhase("creating the used semantics [" + usedSemantics + "]");
+	semantics = CompoundSemanticsBuilder::build(split(usedSemantics, ','));
+}
+
+/**
+* @brief Loads a config for the module.
+*
+* @return @a true if the config was loaded successfully, @c false otherwise.
+*/
+bool Decompiler::loadConfig() {
+	if (configGiven) {
+		if (options.debug) retdec::llvm_support::printSubPhase("using the given config");
+		return true;
+	}
+
+	// Currently, we always use the JSON config.
+	if (options.configPath.empty()) {
+		if (options.debug) retdec::llvm_support::printSubPhase("creating a new config");
+		config = JSONConfig::empty();
+		return true;
+	}
+
+	if (options.debug) retdec::llvm_support::printSubPhase("loading the input config");
+	try {
+		config = JSONConfig::fromFile(options.configPath);
+		return true;
+	} catch (const ConfigError &ex) {
+		retdec::llvm_support::printErrorMessage(
+			"Loading of the config failed: " + ex.getMessage() + "."
+		);
+		return false;
+	}
+}
+
+/**
+* @brief Saves the config file.
+*/
+void Decompiler::saveConfig() {
+	if (!configGiven && !options.configPath.empty()) {
+		config->saveTo(options.configPath);
+	}
+}
+
+/**
+* @brief Convert the LLVM IR module into a BIR module using the instantiated
+*        converter.
+*/
+void Decompiler::convertLLVMIRToBIR() {
+	std::string moduleName = options.forcedModuleName.empty() ?
+		llvmModule->getModuleIdentifier() : options.forcedModuleName;
+	resModule = llvm2BIRConverter->convert(llvmModule, moduleName,
+		semantics, config, options.debug);
+}
+
+/**
+* @brief Removes defined functions which are from some standard library whose
+*        header file has to be included because of some function declarations.
+*/
+void Decompiler::removeLibraryFuncs() {
+	FuncVector removedFuncs(LibraryFuncsRemover::removeFuncs(
+		resModule));
+
+	if (options.debug) {
+		// Emit the functions that were turned into declarations. Before that,
+		// however, sort them by name to provide a more deterministic output.
+		sortByName(removedFuncs);
+		for (const auto &func : removedFuncs) {
+			retdec::llvm_support::printSubPhase("removing " + func->getName() + "()");
+		}
+	}
+}
+
+/**
+* @brief Removes code from all the functions in the module that is unreachable
+*        in the CFG.
+*/
+void Decompiler::removeCodeUnreachableInCFG() {
+	UnreachableCodeInCFGRemover::removeCode(resModule);
+}
+
+/**
+* @brief Removes functions with the given prefix.
+*/
+void Decompiler::removeFuncsPrefixedWith(const StringSet &prefixes) {
+	FuncsWithPrefixRemover::removeFuncs(resModule, prefixes);
+}
+
+/**
+* @brief Fixes signed and unsigned types in the resulting module.
+*/
+void Decompiler::fixSignedUnsignedTypes() {
+	ExprTypesFixer::fixTypes(resModule);
+}
+
+/**
+* @brief Converts LLVM intrinsic functions to functions from the standard
+*        library.
+*/
+void Decompiler::convertLLVMIntrinsicFunctions() {
+	LLVMIntrinsicConverter::convert(resModule);
+}
+
+/**
+* @brief When available, obtains debugging information.
+*/
+void Decompiler::obtainDebugInfo() {
+	LLVMDebugInfoObtainer::obtainVarNames(resModule);
+}
+
+/**
+* @brief Initializes the alias analysis.
+*/
+void Decompiler::initAliasAnalysis() {
+	aliasAnalysis->init(resModule);
+}
+
+/**
+* @brief Runs the optimizations over the resulting module.
+*/
+void Decompiler::runOptimizations() {
+	ShPtr<OptimizerManager> optManager(new OptimizerManager(
+		parseListOfOpts(options.enabledOpts), parseListOfOpts(options.disabledOpts),
+		hllWriter, ValueAnalysis::create(aliasAnalysis, true), cio,
+		arithmExprEvaluator, options.aggressiveOpts, options.debug,
+		options.profiler, options.threads));
+	optManager->optimize(resModule);
+}
+
+/**
+* @brief Renames variables in the resulting module by using the selected
+*        variable renamer.
+*/
+void Decompiler::renameVariables() {
+	varRenamer->renameVars(resModule);
+}
+
+/**
+* @brief Converts constants in function calls to symbolic names.
+*/
+void Decompiler::convertConstantsToSymbolicNames() {
+	ConstSymbolConverter::convert(resModule);
+}
+
+/**
+* @brief Validates the resulting module.
+*/
+void Decompiler::validateResultingModule() {
+	// Run all the registered validators over the resulting module, sorted by
+	// name.
+	StringVector regValidatorIDs(
+		ValidatorFactory::getInstance().getRegisteredObjects());
+	std::sort(regValidatorIDs.begin(), regValidatorIDs.end());
+	for (const auto &id : regValidatorIDs) {
+		if (options.debug) retdec::llvm_support::printSubPhase("running " + id + "Validator");
+		ShPtr<Validator> validator(
+			ValidatorFactory::getInstance().createObject(id));
+		validator->validate(resModule, true);
+	}
+}
+
+/**
+* @brief Finds patterns in the resulting module.
+*/
+void Decompiler::findPatterns() {
+	StringVector pfsIds(getIdsOfPatternFindersToBeRun());
+	PatternFinderRunner::PatternFinders pfs(instantiatePatternFinders(pfsIds));
+	ShPtr<PatternFinderRunner> pfr(instantiatePatternFinderRunner());
+	pfr->run(pfs, resModule);
+}
+
+/**
+* @brief Emits the target HLL code.
+*/
+void Decompiler::emitTargetHLLCode() {
+	hllWriter->setOptionEmitDebugComments(options.emitDebugComments);
+	hllWriter->setOptionKeepAllBrackets(options.keepAllBrackets);
+	hllWriter->setOptionEmitTimeVaryingInfo(!options.noTimeVaryingInfo);
+	hllWriter->setOptionUseCompoundOperators(!options.noCompoundOperators);
+	hllWriter->emitTargetCode(resModule);
+}
+
+/**
+* @brief Finalizes the run of the back-end part.
+*/
+void Decompiler::finalize() {
+	saveConfig();
+}
+
+/**
+* @brief Cleanup.
+*/
+void Decompiler::cleanup() {
+	// Nothing to do.
+
+	// Note: Do not remove this phase, even if there is nothing to do. The
+	// presence of this phase is needed for the analyzing scripts in
+	// scripts/decompiler_tests (it marks the very last phase of a successful
+	// decompilation).
+}
+
+/**
+* @brief Emits a control-flow graph (CFG) for each function in the resulting
+*        module.
+*/
+void Decompiler::emitCFGs() {
+	// Make sure that the requested CFG writer exists.
+	StringVector availCFGWriters(
+		CFGWriterFactory::getInstance().getRegisteredObjects());
+	if (!hasItem(availCFGWriters, std::string(options.cfgWriter))) {
+		printErrorUnsupportedObject<CFGWriterFactory>(
+			"CFG writer", "CFG writers");
+		return;
+	}
+
+	// Instantiate a CFG builder.
+	ShPtr<CFGBuilder> cfgBuilder(NonRecursiveCFGBuilder::create());
+
+	// Get the extension of the files that will be written (we use the CFG
+	// writer's name for this purpose).
+	std::string fileExt(options.cfgWriter);
+
+	// For each function in the resulting module...
+	for (auto i = resModule->func_definition_begin(),
+			e = resModule->func_definition_end(); i != e; ++i) {
+		// Open the output file.
+		std::string fileName(options.outputFile + ".cfg." + (*i)->getName() + "." + fileExt);
+		std::ofstream out(fileName.c_str());
+		if (!out) {
+			retdec::llvm_support::printErrorMessage("Cannot open " + fileName + " for writing.");
+			return;
+		}
+		// Create a CFG for the current function and emit it into the opened
+		// file.
+		ShPtr<CFGWriter> writer(CFGWriterFactory::getInstance(
+			).createObject<ShPtr<CFG>, std::ostream &>(
+				options.cfgWriter, cfgBuilder->getCFG(*i), out));
+		ASSERT_MSG(writer, "instantiation of the requested CFG writer `"
+			<< options.cfgWriter << "` failed");
+		writer->emitCFG();
+	}
+}
+
+/**
+* @brief Emits a call graph (CG) for the resulting module.
+*/
+void Decompiler::emitCG() {
+	// Make sure that the requested CG writer exists.
+	StringVector availCGWriters(
+		CGWriterFactory::getInstance().getRegisteredObjects());
+	if (!hasItem(availCGWriters, std::string(options.cgWriter))) {
+		printErrorUnsupportedObject<CGWriterFactory>(
+			"CG writer", "CG writers");
+		return;
+	}
+
+	// Get the extension of the file that will be written (we use the CG
+	// writer's name for this purpose).
+	std::string fileExt(options.cgWriter);
+
+	// Open the output file.
+	std::string fileName(options.outputFile + ".cg." + fileExt);
+	std::ofstream out(fileName.c_str());
+	if (!out) {
+		retdec::llvm_support::printErrorMessage("Cannot open " + fileName + " for writing.");
+		return;
+	}
+
+	// Create a CG for the current module and emit it into the opened file.
+	ShPtr<CGWriter> writer(CGWriterFactory::getInstance(
+		).createObject<ShPtr<CG>, std::ostream &>(
+			options.cgWriter, CGBuilder::getCG(resModule), out));
+	ASSERT_MSG(writer,
+		"instantiation of the requested CG writer `" << options.cgWriter << "` failed");
+	writer->emitCG();
+}
+
+/**
+* @brief Parses the given list of optimizations.
+*
+* @a opts should be a list of strings separated by a comma.
+*/
+StringSet Decompiler::parseListOfOpts(const std::string &opts) const {
+	StringVector parsedOpts(split(opts, ','));
+	return StringSet(parsedOpts.begin(), parsedOpts.end());
+}
+
+/**
+* @brief Returns the type of optimizations that should be run (as a string).
+*/
+std::string Decompiler::getTypeOfRunOptimizations() const {
+	return options.aggressiveOpts ? "aggressive" : "normal";
+}
+
+/**
+* @brief Returns the IDs of pattern finders to be run.
+*/
+StringVector Decompiler::getIdsOfPatternFindersToBeRun() const {
+	if (options.findPatterns == "all") {
+		// Get all of them.
+		return PatternFinderFactory::getInstance().getRegisteredObjects();
+	} else {
+		// Get only the selected IDs.
+		return split(options.findPatterns, ',');
+	}
+}
+
+/**
+* @brief Instantiates and returns the pattern finders described by their ID.
+*
+* If a pattern finder cannot be instantiated, a warning message is emitted.
+*/
+PatternFinderRunner::PatternFinders Decompiler::instantiatePatternFinders(
+		const StringVector &pfsIds) {
+	// Pattern finders need a value analysis, so create it.
+	initAliasAnalysis();
+	ShPtr<ValueAnalysis> va(ValueAnalysis::create(aliasAnalysis, true));
+
+	// Re-initialize cio to be sure its up-to-date.
+	cio->init(CGBuilder::getCG(resModule), va);
+
+	PatternFinderRunner::PatternFinders pfs;
+	for (const auto pfId : pfsIds) {
+		ShPtr<PatternFinder> pf(
+			PatternFinderFactory::getInstance().createObject(pfId, va, cio));
+		if (!pf && options.debug) {
+			retdec::llvm_support::printWarningMessage("the requested pattern finder '" + pfId + "' does not exist");
+		} else {
+			pfs.push_back(pf);
+		}
+	}
+	return pfs;
+}
+
+/**
+* @brief Instantiates and returns a proper PatternFinderRunner.
+*/
+ShPtr<PatternFinderRunner> Decompiler::instantiatePatternFinderRunner() const {
+	if (options.debug) {
+		return ShPtr<PatternFinderRunner>(new CLIPatternFinderRunner(llvm::errs()));
+	}
+	return ShPtr<PatternFinderRunner>(new NoActionPatternFinderRunner());
+}
+
+/**
+* @brief Returns the prefixes of functions to be removed.
+*/
+StringSet Decompiler::getPrefixesOfFuncsToBeRemoved() const {
+	return config->getPrefixesOfFuncsToBeRemoved();
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
@@ -166,23 +166,23 @@ Maybe<bool> ArithmExprEvaluator::toBool(ShPtr<Expression> expr, VarConstMap
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<AddressOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<AddressOpExpr> &expr) {
 	canBeEvaluated = false;
 }
 
-void ArithmExprEvaluator::visit(ShPtr<ArrayIndexOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<ArrayIndexOpExpr> &expr) {
 	canBeEvaluated = false;
 }
 
-void ArithmExprEvaluator::visit(ShPtr<StructIndexOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<StructIndexOpExpr> &expr) {
 	canBeEvaluated = false;
 }
 
-void ArithmExprEvaluator::visit(ShPtr<DerefOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<DerefOpExpr> &expr) {
 	canBeEvaluated = false;
 }
 
-void ArithmExprEvaluator::visit(ShPtr<NotOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<NotOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -209,7 +209,7 @@ void ArithmExprEvaluator::visit(ShPtr<NotOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<NegOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<NegOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -235,7 +235,7 @@ void ArithmExprEvaluator::visit(ShPtr<NegOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<EqOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<EqOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -266,7 +266,7 @@ void ArithmExprEvaluator::visit(ShPtr<EqOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<NeqOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<NeqOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -297,7 +297,7 @@ void ArithmExprEvaluator::visit(ShPtr<NeqOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<LtEqOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<LtEqOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -325,7 +325,7 @@ void ArithmExprEvaluator::visit(ShPtr<LtEqOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<GtEqOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<GtEqOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -353,7 +353,7 @@ void ArithmExprEvaluator::visit(ShPtr<GtEqOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<LtOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<LtOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -380,7 +380,7 @@ void ArithmExprEvaluator::visit(ShPtr<LtOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<GtOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<GtOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -407,7 +407,7 @@ void ArithmExprEvaluator::visit(ShPtr<GtOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<AddOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<AddOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -437,7 +437,7 @@ void ArithmExprEvaluator::visit(ShPtr<AddOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<SubOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<SubOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -467,7 +467,7 @@ void ArithmExprEvaluator::visit(ShPtr<SubOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<MulOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<MulOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -497,7 +497,7 @@ void ArithmExprEvaluator::visit(ShPtr<MulOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<ModOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<ModOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -525,7 +525,7 @@ void ArithmExprEvaluator::visit(ShPtr<ModOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<DivOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<DivOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -555,7 +555,7 @@ void ArithmExprEvaluator::visit(ShPtr<DivOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<AndOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<AndOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -586,7 +586,7 @@ void ArithmExprEvaluator::visit(ShPtr<AndOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<OrOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<OrOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -617,7 +617,7 @@ void ArithmExprEvaluator::visit(ShPtr<OrOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<BitAndOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<BitAndOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -639,7 +639,7 @@ void ArithmExprEvaluator::visit(ShPtr<BitAndOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<BitOrOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<BitOrOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -661,7 +661,7 @@ void ArithmExprEvaluator::visit(ShPtr<BitOrOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<BitXorOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<BitXorOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -683,7 +683,7 @@ void ArithmExprEvaluator::visit(ShPtr<BitXorOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<BitShlOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<BitShlOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -709,7 +709,7 @@ void ArithmExprEvaluator::visit(ShPtr<BitShlOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<BitShrOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<BitShrOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -745,7 +745,7 @@ void ArithmExprEvaluator::visit(ShPtr<BitShrOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<TernaryOpExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<TernaryOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -769,11 +769,11 @@ void ArithmExprEvaluator::visit(ShPtr<TernaryOpExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<CallExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<CallExpr> &expr) {
 	canBeEvaluated = false;
 }
 
-void ArithmExprEvaluator::visit(ShPtr<BitCastExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<BitCastExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -783,7 +783,7 @@ void ArithmExprEvaluator::visit(ShPtr<BitCastExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<ExtCastExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<ExtCastExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -793,7 +793,7 @@ void ArithmExprEvaluator::visit(ShPtr<ExtCastExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<TruncCastExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<TruncCastExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -803,7 +803,7 @@ void ArithmExprEvaluator::visit(ShPtr<TruncCastExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<FPToIntCastExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<FPToIntCastExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -813,7 +813,7 @@ void ArithmExprEvaluator::visit(ShPtr<FPToIntCastExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<IntToFPCastExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<IntToFPCastExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (canBeEvaluated) {
@@ -823,47 +823,47 @@ void ArithmExprEvaluator::visit(ShPtr<IntToFPCastExpr> expr) {
 	}
 }
 
-void ArithmExprEvaluator::visit(ShPtr<IntToPtrCastExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<IntToPtrCastExpr> &expr) {
 	canBeEvaluated = false;
 }
 
-void ArithmExprEvaluator::visit(ShPtr<PtrToIntCastExpr> expr) {
+void ArithmExprEvaluator::visit(const ShPtr<PtrToIntCastExpr> &expr) {
 	canBeEvaluated = false;
 }
 
-void ArithmExprEvaluator::visit(ShPtr<ConstBool> constant) {
+void ArithmExprEvaluator::visit(const ShPtr<ConstBool> &constant) {
 	stackOfResults.push(constant);
 }
 
-void ArithmExprEvaluator::visit(ShPtr<ConstFloat> constant) {
+void ArithmExprEvaluator::visit(const ShPtr<ConstFloat> &constant) {
 	stackOfResults.push(constant);
 }
 
-void ArithmExprEvaluator::visit(ShPtr<ConstInt> constant) {
+void ArithmExprEvaluator::visit(const ShPtr<ConstInt> &constant) {
 	stackOfResults.push(constant);
 }
 
-void ArithmExprEvaluator::visit(ShPtr<ConstSymbol> constant) {
+void ArithmExprEvaluator::visit(const ShPtr<ConstSymbol> &constant) {
 	stackOfResults.push(constant->getValue());
 }
 
-void ArithmExprEvaluator::visit(ShPtr<ConstNullPointer> constant) {
+void ArithmExprEvaluator::visit(const ShPtr<ConstNullPointer> &constant) {
 	canBeEvaluated = false;
 }
 
-void ArithmExprEvaluator::visit(ShPtr<ConstString> constant) {
+void ArithmExprEvaluator::visit(const ShPtr<ConstString> &constant) {
 	canBeEvaluated = false;
 }
 
-void ArithmExprEvaluator::visit(ShPtr<ConstArray> constant) {
+void ArithmExprEvaluator::visit(const ShPtr<ConstArray> &constant) {
 	canBeEvaluated = false;
 }
 
-void ArithmExprEvaluator::visit(ShPtr<ConstStruct> constant) {
+void ArithmExprEvaluator::visit(const ShPtr<ConstStruct> &constant) {
 	canBeEvaluated = false;
 }
 
-void ArithmExprEvaluator::visit(ShPtr<Variable> var) {
+void ArithmExprEvaluator::visit(const ShPtr<Variable> &var) {
 	auto it = varValues->find(var);
 	if (it != varValues->end()) {
 		stackOfResults.push(it->second);
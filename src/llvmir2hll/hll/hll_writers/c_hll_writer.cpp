@@ -480,7 +480,7 @@ bool CHLLWriter::emitExternalFunction(ShPtr<Function> func) {
 	return true;
 }
 
-void CHLLWriter::visit(ShPtr<GlobalVarDef> varDef) {
+void CHLLWriter::visit(const ShPtr<GlobalVarDef> &varDef) {
 	ShPtr<Variable> var(varDef->getVar());
 	ShPtr<Expression> init(varDef->getInitializer());
 
@@ -515,7 +515,7 @@ void CHLLWriter::visit(ShPtr<GlobalVarDef> varDef) {
 	out << "\n";
 }
 
-void CHLLWriter::visit(ShPtr<Function> func) {
+void CHLLWriter::visit(const ShPtr<Function> &func) {
 	if (func->isDeclaration()) {
 		emitFunctionPrototype(func);
 	} else {
@@ -539,19 +539,19 @@ bool CHLLWriter::emitTargetCode(ShPtr<Module> module) {
 	return HLLWriter::emitTargetCode(module);
 }
 
-void CHLLWriter::visit(ShPtr<Variable> var) {
+void CHLLWriter::visit(const ShPtr<Variable> &var) {
 	out << var->getName();
 }
 
-void CHLLWriter::visit(ShPtr<AddressOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<AddressOpExpr> &expr) {
 	emitUnaryOpExpr("&", expr);
 }
 
-void CHLLWriter::visit(ShPtr<AssignOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<AssignOpExpr> &expr) {
 	emitAssignment(expr->getFirstOperand(), expr->getSecondOperand());
 }
 
-void CHLLWriter::visit(ShPtr<ArrayIndexOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<ArrayIndexOpExpr> &expr) {
 	// Base.
 	emitExprWithBracketsIfNeeded(expr->getBase());
 
@@ -561,7 +561,7 @@ void CHLLWriter::visit(ShPtr<ArrayIndexOpExpr> expr) {
 	out << "]";
 }
 
-void CHLLWriter::visit(ShPtr<StructIndexOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<StructIndexOpExpr> &expr) {
 	// Base.
 	ShPtr<Expression> base(expr->getFirstOperand());
 	emitExprWithBracketsIfNeeded(base);
@@ -574,43 +574,43 @@ void CHLLWriter::visit(ShPtr<StructIndexOpExpr> expr) {
 	expr->getSecondOperand()->accept(this);
 }
 
-void CHLLWriter::visit(ShPtr<DerefOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<DerefOpExpr> &expr) {
 	emitUnaryOpExpr("*", expr);
 }
 
-void CHLLWriter::visit(ShPtr<NotOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<NotOpExpr> &expr) {
 	emitUnaryOpExpr("!", expr);
 }
 
-void CHLLWriter::visit(ShPtr<NegOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<NegOpExpr> &expr) {
 	emitUnaryOpExpr("-", expr);
 }
 
-void CHLLWriter::visit(ShPtr<EqOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<EqOpExpr> &expr) {
 	emitBinaryOpExpr(" == ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<NeqOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<NeqOpExpr> &expr) {
 	emitBinaryOpExpr(" != ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<LtOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<LtOpExpr> &expr) {
 	emitBinaryOpExpr(" < ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<GtOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<GtOpExpr> &expr) {
 	emitBinaryOpExpr(" > ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<LtEqOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<LtEqOpExpr> &expr) {
 	emitBinaryOpExpr(" <= ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<GtEqOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<GtEqOpExpr> &expr) {
 	emitBinaryOpExpr(" >= ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<TernaryOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<TernaryOpExpr> &expr) {
 	bool bracketsAreNeeded = bracketsManager->areBracketsNeeded(expr);
 	if (bracketsAreNeeded) {
 		out << "(";
@@ -625,58 +625,58 @@ void CHLLWriter::visit(ShPtr<TernaryOpExpr> expr) {
 	}
 }
 
-void CHLLWriter::visit(ShPtr<AddOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<AddOpExpr> &expr) {
 	emitBinaryOpExpr(" + ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<SubOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<SubOpExpr> &expr) {
 	emitBinaryOpExpr(" - ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<MulOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<MulOpExpr> &expr) {
 	emitBinaryOpExpr(" * ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<ModOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<ModOpExpr> &expr) {
 	emitBinaryOpExpr(" % ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<DivOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<DivOpExpr> &expr) {
 	emitBinaryOpExpr(" / ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<AndOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<AndOpExpr> &expr) {
 	emitBinaryOpExpr(" && ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<OrOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<OrOpExpr> &expr) {
 	emitBinaryOpExpr(" || ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<BitAndOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<BitAndOpExpr> &expr) {
 	emitBinaryOpExpr(" & ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<BitOrOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<BitOrOpExpr> &expr) {
 	emitBinaryOpExpr(" | ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<BitXorOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<BitXorOpExpr> &expr) {
 	emitBinaryOpExpr(" ^ ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<BitShlOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<BitShlOpExpr> &expr) {
 	emitBinaryOpExpr(" << ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<BitShrOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<BitShrOpExpr> &expr) {
 	// TODO Distinguish between logical and arithmetical shifts (recall that if
 	// the first operand is of a signed type with a negative value, it is
 	// implementation-defined whether >> is logical or arithmetical).
 	emitBinaryOpExpr(" >> ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<CallExpr> expr) {
+void CHLLWriter::visit(const ShPtr<CallExpr> &expr) {
 	// Called expression.
 	emitExprWithBracketsIfNeeded(expr->getCalledExpr());
 
@@ -686,19 +686,19 @@ void CHLLWriter::visit(ShPtr<CallExpr> expr) {
 	out << ")";
 }
 
-void CHLLWriter::visit(ShPtr<CommaOpExpr> expr) {
+void CHLLWriter::visit(const ShPtr<CommaOpExpr> &expr) {
 	emitBinaryOpExpr(", ", expr);
 }
 
-void CHLLWriter::visit(ShPtr<BitCastExpr> expr) {
+void CHLLWriter::visit(const ShPtr<BitCastExpr> &expr) {
 	emitCastInStandardWay(expr);
 }
 
-void CHLLWriter::visit(ShPtr<ExtCastExpr> expr) {
+void CHLLWriter::visit(const ShPtr<ExtCastExpr> &expr) {
 	emitCastInStandardWay(expr);
 }
 
-void CHLLWriter::visit(ShPtr<TruncCastExpr> expr) {
+void CHLLWriter::visit(const ShPtr<TruncCastExpr> &expr) {
 	// Specific property, see the LLVM reference manual.
 	if (isa<IntType>(expr->getType()) &&
 			(cast<IntType>(expr->getType())->isBool())) {
@@ -710,7 +710,7 @@ void CHLLWriter::visit(ShPtr<TruncCastExpr> expr) {
 	}
 }
 
-void CHLLWriter::visit(ShPtr<FPToIntCastExpr> expr) {
+void CHLLWriter::visit(const ShPtr<FPToIntCastExpr> &expr) {
 	out << "(";
 	ShPtr<IntType> type = cast<IntType>(expr->getType());
 	if (type->isBool()) {
@@ -722,23 +722,23 @@ void CHLLWriter::visit(ShPtr<FPToIntCastExpr> expr) {
 	expr->getOperand()->accept(this);
 }
 
-void CHLLWriter::visit(ShPtr<IntToFPCastExpr> expr) {
+void CHLLWriter::visit(const ShPtr<IntToFPCastExpr> &expr) {
 	emitCastInStandardWay(expr);
 }
 
-void CHLLWriter::visit(ShPtr<IntToPtrCastExpr> expr) {
+void CHLLWriter::visit(const ShPtr<IntToPtrCastExpr> &expr) {
 	emitCastInStandardWay(expr);
 }
 
-void CHLLWriter::visit(ShPtr<PtrToIntCastExpr> expr) {
+void CHLLWriter::visit(const ShPtr<PtrToIntCastExpr> &expr) {
 	emitCastInStandardWay(expr);
 }
 
-void CHLLWriter::visit(ShPtr<ConstBool> constant) {
+void CHLLWriter::visit(const ShPtr<ConstBool> &constant) {
 	out << (constant->getValue() ? "true" : "false"); // from stdbool.h
 }
 
-void CHLLWriter::visit(ShPtr<ConstFloat> constant) {
+void CHLLWriter::visit(const ShPtr<ConstFloat> &constant) {
 	ConstFloat::Type value(constant->getValue());
 	// Special values, like inf or nan, have to treated specifically.
 	if (value.isInfinity()) {
@@ -757,7 +757,7 @@ void CHLLWriter::visit(ShPtr<ConstFloat> constant) {
 	}
 }
 
-void CHLLWriter::visit(ShPtr<ConstInt> constant) {
+void CHLLWriter::visit(const ShPtr<ConstInt> &constant) {
 	if (shouldBeEmittedInHexa(constant)) {
 		out << constant->toString(16, "0x");
 	} else {
@@ -765,11 +765,11 @@ void CHLLWriter::visit(ShPtr<ConstInt> constant) {
 	}
 }
 
-void CHLLWriter::visit(ShPtr<ConstNullPointer> constant) {
+void CHLLWriter::visit(const ShPtr<ConstNullPointer> &constant) {
 	out << getConstNullPointerTextRepr();
 }
 
-void CHLLWriter::visit(ShPtr<ConstString> constant) {
+void CHLLWriter::visit(const ShPtr<ConstString> &constant) {
 	if (constant->isWideString()) {
 		out << "L";
 	}
@@ -779,7 +779,7 @@ void CHLLWriter::visit(ShPtr<ConstString> constant) {
 	out << "\"";
 }
 
-void CHLLWriter::visit(ShPtr<ConstArray> constant) {
+void CHLLWriter::visit(const ShPtr<ConstArray> &constant) {
 	if (constant->isInitialized()) {
 		emitInitializedConstArray(constant);
 	} else {
@@ -787,15 +787,15 @@ void CHLLWriter::visit(ShPtr<ConstArray> constant) {
 	}
 }
 
-void CHLLWriter::visit(ShPtr<ConstStruct> constant) {
+void CHLLWriter::visit(const ShPtr<ConstStruct> &constant) {
 	emitConstStruct(constant);
 }
 
-void CHLLWriter::visit(ShPtr<ConstSymbol> constant) {
+void CHLLWriter::visit(const ShPtr<ConstSymbol> &constant) {
 	out << constant->getName();
 }
 
-void CHLLWriter::visit(ShPtr<AssignStmt> stmt) {
+void CHLLWriter::visit(const ShPtr<AssignStmt> &stmt) {
 	// Special treatment of constant arrays.
 	if (ShPtr<ConstArray> constArray = cast<ConstArray>(stmt->getRhs())) {
 		if (!constArray->isInitialized()) {
@@ -861,7 +861,7 @@ void CHLLWriter::emitInitVarDefWhenNeeded(ShPtr<UForLoopStmt> loop) {
 }
 
 // Only here is variables type emitted.
-void CHLLWriter::visit(ShPtr<VarDefStmt> stmt) {
+void CHLLWriter::visit(const ShPtr<VarDefStmt> &stmt) {
 	out << getCurrentIndent();
 	emitVarWithType(stmt->getVar());
 
@@ -886,13 +886,13 @@ void CHLLWriter::visit(ShPtr<VarDefStmt> stmt) {
 	out << "\n";
 }
 
-void CHLLWriter::visit(ShPtr<CallStmt> stmt) {
+void CHLLWriter::visit(const ShPtr<CallStmt> &stmt) {
 	out << getCurrentIndent();
 	stmt->getCall()->accept(this);
 	out << ";\n";
 }
 
-void CHLLWriter::visit(ShPtr<ReturnStmt> stmt) {
+void CHLLWriter::visit(const ShPtr<ReturnStmt> &stmt) {
 	out << getCurrentIndent() << "return";
 	if (ShPtr<Expression> retVal = stmt->getRetVal()) {
 		out << " ";
@@ -901,11 +901,11 @@ void CHLLWriter::visit(ShPtr<ReturnStmt> stmt) {
 	out << ";\n";
 }
 
-void CHLLWriter::visit(ShPtr<EmptyStmt> stmt) {
+void CHLLWriter::visit(const ShPtr<EmptyStmt> &stmt) {
 	// Nothing to be emitted.
 }
 
-void CHLLWriter::visit(ShPtr<IfStmt> stmt) {
+void CHLLWriter::visit(const ShPtr<IfStmt> &stmt) {
 	// Emit the first if clause and other else-if clauses (if any).
 	for (auto i = stmt->clause_begin(), e = stmt->clause_end(); i != e; ++i) {
 		out << getCurrentIndent();
@@ -925,7 +925,7 @@ void CHLLWriter::visit(ShPtr<IfStmt> stmt) {
 	out << "\n";
 }
 
-void CHLLWriter::visit(ShPtr<SwitchStmt> stmt) {
+void CHLLWriter::visit(const ShPtr<SwitchStmt> &stmt) {
 	out << getCurrentIndent();
 	out << "switch (";
 	stmt->getControlExpr()->accept(this);
@@ -950,7 +950,7 @@ void CHLLWriter::visit(ShPtr<SwitchStmt> stmt) {
 	out << getCurrentIndent() << "}\n";
 }
 
-void CHLLWriter::visit(ShPtr<WhileLoopStmt> stmt) {
+void CHLLWriter::visit(const ShPtr<WhileLoopStmt> &stmt) {
 	out << getCurrentIndent() << "while (";
 	stmt->getCondition()->accept(this);
 	out << ") ";
@@ -958,7 +958,7 @@ void CHLLWriter::visit(ShPtr<WhileLoopStmt> stmt) {
 	out << "\n";
 }
 
-void CHLLWriter::visit(ShPtr<ForLoopStmt> stmt) {
+void CHLLWriter::visit(const ShPtr<ForLoopStmt> &stmt) {
 	out << getCurrentIndent() << "for (";
 	stmt->getIndVar()->getType()->accept(this);
 	out << " ";
@@ -1002,7 +1002,7 @@ void CHLLWriter::visit(ShPtr<ForLoopStmt> stmt) {
 	out << "\n";
 }
 
-void CHLLWriter::visit(ShPtr<UForLoopStmt> stmt) {
+void CHLLWriter::visit(const ShPtr<UForLoopStmt> &stmt) {
 	out << getCurrentIndent() << "for (";
 	if (auto init = stmt->getInit()) {
 		emitInitVarDefWhenNeeded(stmt);
@@ -1023,30 +1023,30 @@ void CHLLWriter::visit(ShPtr<UForLoopStmt> stmt) {
 	out << "\n";
 }
 
-void CHLLWriter::visit(ShPtr<BreakStmt> stmt) {
+void CHLLWriter::visit(const ShPtr<BreakStmt> &stmt) {
 	out << getCurrentIndent() << "break;\n";
 }
 
-void CHLLWriter::visit(ShPtr<ContinueStmt> stmt) {
+void CHLLWriter::visit(const ShPtr<ContinueStmt> &stmt) {
 	out << getCurrentIndent() << "continue;\n";
 }
 
-void CHLLWriter::visit(ShPtr<GotoStmt> stmt) {
+void CHLLWriter::visit(const ShPtr<GotoStmt> &stmt) {
 	out << getCurrentIndent() << "goto " << getGotoLabel(stmt->getTarget())
 		<< ";\n";
 }
 
-void CHLLWriter::visit(ShPtr<UnreachableStmt> stmt) {
+void CHLLWriter::visit(const ShPtr<UnreachableStmt> &stmt) {
 	out << getCurrentIndent() << comment("UNREACHABLE") << "\n";
 }
 
-void CHLLWriter::visit(ShPtr<FloatType> type) {
+void CHLLWriter::visit(const ShPtr<FloatType> &type) {
 	out << "float";
 	out << type->getSize();
 	out << "_t";
 }
 
-void CHLLWriter::visit(ShPtr<IntType> type) {
+void CHLLWriter::visit(const ShPtr<IntType> &type) {
 	if (type->isBool()) {
 		out << "bool";
 		return;
@@ -1068,7 +1068,7 @@ void CHLLWriter::visit(ShPtr<IntType> type) {
 	out << "int" << type->getSize() << "_t";
 }
 
-void CHLLWriter::visit(ShPtr<PointerType> type) {
+void CHLLWriter::visit(const ShPtr<PointerType> &type) {
 	// Pointers to functions have to emitted in a special way because of C
 	// syntax.
 	if (isPointerToFunc(type)) {
@@ -1102,14 +1102,14 @@ void CHLLWriter::visit(ShPtr<PointerType> type) {
 	}
 }
 
-void CHLLWriter::visit(ShPtr<StringType> type) {
+void CHLLWriter::visit(const ShPtr<StringType> &type) {
 }
 
-void CHLLWriter::visit(ShPtr<ArrayType> type) {
+void CHLLWriter::visit(const ShPtr<ArrayType> &type) {
 	emitTypeOfElementsInArray(type);
 }
 
-void CHLLWriter::visit(ShPtr<StructType> type) {
+void CHLLWriter::visit(const ShPtr<StructType> &type) {
 	// Named structures can be emitted by using their name, unnamed structures
 	// are emitted inline including their full type.
 	auto i = structNames.find(type);
@@ -1122,7 +1122,7 @@ void CHLLWriter::visit(ShPtr<StructType> type) {
 	}
 }
 
-void CHLLWriter::visit(ShPtr<FunctionType> type) {
+void CHLLWriter::visit(const ShPtr<FunctionType> &type) {
 	// Due to C syntax, function type has to be handled outside of this visit.
 	// The reason is that in C, only a pointer to a function is correct, and a
 	// pointer to a function has code before '*' and after '*'. This is why we
@@ -1130,11 +1130,11 @@ void CHLLWriter::visit(ShPtr<FunctionType> type) {
 	FAIL("FunctionType should be handled outside of visit(ShPtr<FunctionType>)");
 }
 
-void CHLLWriter::visit(ShPtr<VoidType> type) {
+void CHLLWriter::visit(const ShPtr<VoidType> &type) {
 	out << "void";
 }
 
-void CHLLWriter::visit(ShPtr<UnknownType> type) {
+void CHLLWriter::visit(const ShPtr<UnknownType> &type) {
 	out << "unknown";
 }
 
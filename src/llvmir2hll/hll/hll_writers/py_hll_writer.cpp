@@ -165,7 +165,7 @@ bool PyHLLWriter::emitTargetCode(ShPtr<Module> module) {
 	return HLLWriter::emitTargetCode(module);
 }
 
-void PyHLLWriter::visit(ShPtr<GlobalVarDef> varDef) {
+void PyHLLWriter::visit(const ShPtr<GlobalVarDef> &varDef) {
 	out << getCurrentIndent();
 	ShPtr<Variable> var(varDef->getVar());
 	var->accept(this);
@@ -185,7 +185,7 @@ void PyHLLWriter::visit(ShPtr<GlobalVarDef> varDef) {
 	out << "\n";
 }
 
-void PyHLLWriter::visit(ShPtr<Function> func) {
+void PyHLLWriter::visit(const ShPtr<Function> &func) {
 	if (func->isDeclaration()) {
 		emitExternalFunction(func);
 	} else {
@@ -193,19 +193,19 @@ void PyHLLWriter::visit(ShPtr<Function> func) {
 	}
 }
 
-void PyHLLWriter::visit(ShPtr<Variable> var) {
+void PyHLLWriter::visit(const ShPtr<Variable> &var) {
 	out << var->getName();
 }
 
-void PyHLLWriter::visit(ShPtr<AddressOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<AddressOpExpr> &expr) {
 	emitUnaryOpExpr("&", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<AssignOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<AssignOpExpr> &expr) {
 	emitBinaryOpExpr(" = ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<ArrayIndexOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<ArrayIndexOpExpr> &expr) {
 	// Base.
 	emitExprWithBracketsIfNeeded(expr->getBase());
 
@@ -215,7 +215,7 @@ void PyHLLWriter::visit(ShPtr<ArrayIndexOpExpr> expr) {
 	out << "]";
 }
 
-void PyHLLWriter::visit(ShPtr<StructIndexOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<StructIndexOpExpr> &expr) {
 	// Base.
 	emitExprWithBracketsIfNeeded(expr->getFirstOperand());
 
@@ -225,43 +225,43 @@ void PyHLLWriter::visit(ShPtr<StructIndexOpExpr> expr) {
 	out << "']";
 }
 
-void PyHLLWriter::visit(ShPtr<DerefOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<DerefOpExpr> &expr) {
 	emitUnaryOpExpr("*", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<NotOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<NotOpExpr> &expr) {
 	emitUnaryOpExpr("not ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<NegOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<NegOpExpr> &expr) {
 	emitUnaryOpExpr("-", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<EqOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<EqOpExpr> &expr) {
 	emitBinaryOpExpr(" == ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<NeqOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<NeqOpExpr> &expr) {
 	emitBinaryOpExpr(" != ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<LtOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<LtOpExpr> &expr) {
 	emitBinaryOpExpr(" < ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<GtOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<GtOpExpr> &expr) {
 	emitBinaryOpExpr(" > ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<LtEqOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<LtEqOpExpr> &expr) {
 	emitBinaryOpExpr(" <= ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<GtEqOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<GtEqOpExpr> &expr) {
 	emitBinaryOpExpr(" >= ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<TernaryOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<TernaryOpExpr> &expr) {
 	bool bracketsAreNeeded = bracketsManager->areBracketsNeeded(expr);
 	if (bracketsAreNeeded) {
 		out << "(";
@@ -276,51 +276,51 @@ void PyHLLWriter::visit(ShPtr<TernaryOpExpr> expr) {
 	}
 }
 
-void PyHLLWriter::visit(ShPtr<AddOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<AddOpExpr> &expr) {
 	emitBinaryOpExpr(" + ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<SubOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<SubOpExpr> &expr) {
 	emitBinaryOpExpr(" - ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<MulOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<MulOpExpr> &expr) {
 	emitBinaryOpExpr(" * ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<ModOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<ModOpExpr> &expr) {
 	emitBinaryOpExpr(" % ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<DivOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<DivOpExpr> &expr) {
 	emitBinaryOpExpr(" / ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<AndOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<AndOpExpr> &expr) {
 	emitBinaryOpExpr(" and ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<OrOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<OrOpExpr> &expr) {
 	emitBinaryOpExpr(" or ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<BitAndOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<BitAndOpExpr> &expr) {
 	emitBinaryOpExpr(" & ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<BitOrOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<BitOrOpExpr> &expr) {
 	emitBinaryOpExpr(" | ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<BitXorOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<BitXorOpExpr> &expr) {
 	emitBinaryOpExpr(" ^ ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<BitShlOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<BitShlOpExpr> &expr) {
 	emitBinaryOpExpr(" << ", expr);
 }
 
-void PyHLLWriter::visit(ShPtr<BitShrOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<BitShrOpExpr> &expr) {
 	// Recall that the right shift operator in Python is arithmetical. If the
 	// shift is logical, we have to emit a custom function.
 	if (expr->isArithmetical()) {
@@ -334,7 +334,7 @@ void PyHLLWriter::visit(ShPtr<BitShrOpExpr> expr) {
 	}
 }
 
-void PyHLLWriter::visit(ShPtr<CallExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<CallExpr> &expr) {
 	// Called expression.
 	emitExprWithBracketsIfNeeded(expr->getCalledExpr());
 
@@ -344,45 +344,45 @@ void PyHLLWriter::visit(ShPtr<CallExpr> expr) {
 	out << ")";
 }
 
-void PyHLLWriter::visit(ShPtr<CommaOpExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<CommaOpExpr> &expr) {
 	emitBinaryOpExpr(", ", expr);
 }
 
 // Casts -- we ignore them in this HLL.
-void PyHLLWriter::visit(ShPtr<BitCastExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<BitCastExpr> &expr) {
 	emitOperandOfCast(expr);
 }
 
-void PyHLLWriter::visit(ShPtr<ExtCastExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<ExtCastExpr> &expr) {
 	emitOperandOfCast(expr);
 }
 
-void PyHLLWriter::visit(ShPtr<TruncCastExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<TruncCastExpr> &expr) {
 	emitOperandOfCast(expr);
 }
 
-void PyHLLWriter::visit(ShPtr<FPToIntCastExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<FPToIntCastExpr> &expr) {
 	emitOperandOfCast(expr);
 }
 
-void PyHLLWriter::visit(ShPtr<IntToFPCastExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<IntToFPCastExpr> &expr) {
 	emitOperandOfCast(expr);
 }
 
-void PyHLLWriter::visit(ShPtr<IntToPtrCastExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<IntToPtrCastExpr> &expr) {
 	emitOperandOfCast(expr);
 }
 
-void PyHLLWriter::visit(ShPtr<PtrToIntCastExpr> expr) {
+void PyHLLWriter::visit(const ShPtr<PtrToIntCastExpr> &expr) {
 	emitOperandOfCast(expr);
 }
 // End of casts.
 
-void PyHLLWriter::visit(ShPtr<ConstBool> constant) {
+void PyHLLWriter::visit(const ShPtr<ConstBool> &constant) {
 	out << (constant->getValue() ? "True" : "False");
 }
 
-void PyHLLWriter::visit(ShPtr<ConstFloat> constant) {
+void PyHLLWriter::visit(const ShPtr<ConstFloat> &constant) {
 	ConstFloat::Type value(constant->getValue());
 	// Special values, like inf or nan, have to treated specifically.
 	if (value.isInfinity() || value.isNaN()) {
@@ -394,7 +394,7 @@ void PyHLLWriter::visit(ShPtr<ConstFloat> constant) {
 	}
 }
 
-void PyHLLWriter::visit(ShPtr<ConstInt> constant) {
+void PyHLLWriter::visit(const ShPtr<ConstInt> &constant) {
 	if (shouldBeEmittedInHexa(constant)) {
 		out << constant->toString(16, "0x");
 	} else {
@@ -402,11 +402,11 @@ void PyHLLWriter::visit(ShPtr<ConstInt> constant) {
 	}
 }
 
-void PyHLLWriter::visit(ShPtr<ConstNullPointer> constant) {
+void PyHLLWriter::visit(const ShPtr<ConstNullPointer> &constant) {
 	out << getConstNullPointerTextRepr();
 }
 
-void PyHLLWriter::visit(ShPtr<ConstString> constant) {
+void PyHLLWriter::visit(const ShPtr<ConstString> &constant) {
 	// Contrary to C, in Python, we emit wide string literals the same way we
 	// emit 8-bit string literals.
 	out << "\"";
@@ -414,7 +414,7 @@ void PyHLLWriter::visit(ShPtr<ConstString> constant) {
 	out << "\"";
 }
 
-void PyHLLWriter::visit(ShPtr<ConstArray> constant) {
+void PyHLLWriter::visit(const ShPtr<ConstArray> &constant) {
 	if (constant->isInitialized()) {
 		emitInitializedConstArray(constant);
 	} else {
@@ -422,7 +422,7 @@ void PyHLLWriter::visit(ShPtr<ConstArray> constant) {
 	}
 }
 
-void PyHLLWriter::visit(ShPtr<ConstStruct> constant) {
+void PyHLLWriter::visit(const ShPtr<ConstStruct> &constant) {
 	bool emitInStructuredWay = shouldBeEmittedInStructuredWay(constant);
 
 	out << "{";
@@ -458,11 +458,11 @@ void PyHLLWriter::visit(ShPtr<ConstStruct> constant) {
 	out << "}";
 }
 
-void PyHLLWriter::visit(ShPtr<ConstSymbol> constant) {
+void PyHLLWriter::visit(const ShPtr<ConstSymbol> &constant) {
 	out << constant->getName();
 }
 
-void PyHLLWriter::visit(ShPtr<AssignStmt> stmt) {
+void PyHLLWriter::visit(const ShPtr<AssignStmt> &stmt) {
 	CompoundOpManager::CompoundOp compoundOp(
 		compoundOpManager->tryOptimizeToCompoundOp(stmt));
 	out << getCurrentIndent();
@@ -476,7 +476,7 @@ void PyHLLWriter::visit(ShPtr<AssignStmt> stmt) {
 	out << "\n";
 }
 
-void PyHLLWriter::visit(ShPtr<VarDefStmt> stmt) {
+void PyHLLWriter::visit(const ShPtr<VarDefStmt> &stmt) {
 	// Emit the definition statement only if there is an initializer;
 	// otherwise, it makes no sense (recall that in Python, no declarations are
 	// needed).
@@ -498,13 +498,13 @@ void PyHLLWriter::visit(ShPtr<VarDefStmt> stmt) {
 	out << "\n";
 }
 
-void PyHLLWriter::visit(ShPtr<CallStmt> stmt) {
+void PyHLLWriter::visit(const ShPtr<CallStmt> &stmt) {
 	out << getCurrentIndent();
 	stmt->getCall()->accept(this);
 	out << "\n";
 }
 
-void PyHLLWriter::visit(ShPtr<ReturnStmt> stmt) {
+void PyHLLWriter::visit(const ShPtr<ReturnStmt> &stmt) {
 	out << getCurrentIndent() << "return";
 	if (ShPtr<Expression> retVal = stmt->getRetVal()) {
 		out << " ";
@@ -513,11 +513,11 @@ void PyHLLWriter::visit(ShPtr<ReturnStmt> stmt) {
 	out << "\n";
 }
 
-void PyHLLWriter::visit(ShPtr<EmptyStmt> stmt) {
+void PyHLLWriter::visit(const ShPtr<EmptyStmt> &stmt) {
 	// Nada nada nada.
 }
 
-void PyHLLWriter::visit(ShPtr<IfStmt> stmt) {
+void PyHLLWriter::visit(const ShPtr<IfStmt> &stmt) {
 	// Emit the first if clause and other else-if clauses (if any).
 	for (auto i = stmt->clause_begin(), e = stmt->clause_end(); i != e; ++i) {
 		out << getCurrentIndent();
@@ -534,7 +534,7 @@ void PyHLLWriter::visit(ShPtr<IfStmt> stmt) {
 	}
 }
 
-void PyHLLWriter::visit(ShPtr<SwitchStmt> stmt) {
+void PyHLLWriter::visit(const ShPtr<SwitchStmt> &stmt) {
 	out << getCurrentIndent();
 	out << "switch ";
 	stmt->getControlExpr()->accept(this);
@@ -555,14 +555,14 @@ void PyHLLWriter::visit(ShPtr<SwitchStmt> stmt) {
 	decreaseIndentLevel();
 }
 
-void PyHLLWriter::visit(ShPtr<WhileLoopStmt> stmt) {
+void PyHLLWriter::visit(const ShPtr<WhileLoopStmt> &stmt) {
 	out << getCurrentIndent() << "while ";
 	stmt->getCondition()->accept(this);
 	out << ":\n";
 	emitBody(stmt->getBody());
 }
 
-void PyHLLWriter::visit(ShPtr<ForLoopStmt> stmt) {
+void PyHLLWriter::visit(const ShPtr<ForLoopStmt> &stmt) {
 	out << getCurrentIndent() << "for ";
 	stmt->getIndVar()->accept(this);
 	out << " in range(";
@@ -591,47 +591,47 @@ void PyHLLWriter::visit(ShPtr<ForLoopStmt> stmt) {
 	emitBody(stmt->getBody());
 }
 
-void PyHLLWriter::visit(ShPtr<UForLoopStmt> stmt) {
+void PyHLLWriter::visit(const ShPtr<UForLoopStmt> &stmt) {
 	FAIL("universal for loops are not supported in Python");
 }
 
-void PyHLLWriter::visit(ShPtr<BreakStmt> stmt) {
+void PyHLLWriter::visit(const ShPtr<BreakStmt> &stmt) {
 	out << getCurrentIndent() << "break\n";
 }
 
-void PyHLLWriter::visit(ShPtr<ContinueStmt> stmt) {
+void PyHLLWriter::visit(const ShPtr<ContinueStmt> &stmt) {
 	out << getCurrentIndent() << "continue\n";
 }
 
-void PyHLLWriter::visit(ShPtr<GotoStmt> stmt) {
+void PyHLLWriter::visit(const ShPtr<GotoStmt> &stmt) {
 	out << getCurrentIndent() << "goto " << getGotoLabel(stmt->getTarget()) << "\n";
 }
 
-void PyHLLWriter::visit(ShPtr<UnreachableStmt> stmt) {
+void PyHLLWriter::visit(const ShPtr<UnreachableStmt> &stmt) {
 	out << getCurrentIndent() << comment("UNREACHABLE") << "\n";
 }
 
-void PyHLLWriter::visit(ShPtr<FloatType> type) {
+void PyHLLWriter::visit(const ShPtr<FloatType> &type) {
 	// Emit the default initializer.
 	out << "0.0";
 }
 
-void PyHLLWriter::visit(ShPtr<IntType> type) {
+void PyHLLWriter::visit(const ShPtr<IntType> &type) {
 	// Emit the default initializer.
 	out << "0";
 }
 
-void PyHLLWriter::visit(ShPtr<PointerType> type) {
+void PyHLLWriter::visit(const ShPtr<PointerType> &type) {
 	// Emit the default initializer.
 	out << getConstNullPointerTextRepr();
 }
 
-void PyHLLWriter::visit(ShPtr<StringType> type) {
+void PyHLLWriter::visit(const ShPtr<StringType> &type) {
 	// Emit the default initializer.
 	out << "\"\"";
 }
 
-void PyHLLWriter::visit(ShPtr<ArrayType> type) {
+void PyHLLWriter::visit(const ShPtr<ArrayType> &type) {
 	// Emit the default initializer.
 	out << "array(";
 	bool first = true;
@@ -645,7 +645,7 @@ void PyHLLWriter::visit(ShPtr<ArrayType> type) {
 	out << ")";
 }
 
-void PyHLLWriter::visit(ShPtr<StructType> type) {
+void PyHLLWriter::visit(const ShPtr<StructType> &type) {
 	// Emit the default initializer.
 	out << "{";
 	unsigned structElementIndex = 0;
@@ -663,17 +663,17 @@ void PyHLLWriter::visit(ShPtr<StructType> type) {
 	out << "}";
 }
 
-void PyHLLWriter::visit(ShPtr<FunctionType> type) {
+void PyHLLWriter::visit(const ShPtr<FunctionType> &type) {
 	// Emit the default initializer.
 	out << "None";
 }
 
-void PyHLLWriter::visit(ShPtr<VoidType> type) {
+void PyHLLWriter::visit(const ShPtr<VoidType> &type) {
 	// Emit the default initializer.
 	out << "None";
 }
 
-void PyHLLWriter::visit(ShPtr<UnknownType> type) {
+void PyHLLWriter::visit(const ShPtr<UnknownType> &type) {
 	// Emit the default initializer.
 	out << "None";
 }
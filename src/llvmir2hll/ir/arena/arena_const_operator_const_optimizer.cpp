@@ -0,0 +1,110 @@
+/**
+* @file src/llvmir2hll/ir/arena/arena_const_operator_const_optimizer.cpp
+* @brief Implementation of ArenaConstOperatorConstOptimizer.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/llvmir2hll/ir/arena/arena_const_operator_const_optimizer.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+namespace {
+
+/**
+* @brief Evaluates the binary operator @a kind on @a op1 and @a op2.
+*
+* @return @c true if the result has been stored into @a result, @c false if
+*         the operator cannot be evaluated.
+*/
+bool evaluate(ExprArena::Kind kind, const llvm::APSInt &op1,
+		const llvm::APSInt &op2, llvm::APSInt &result) {
+	if (op1.getBitWidth() != op2.getBitWidth() ||
+			op1.isSigned() != op2.isSigned()) {
+		return false;
+	}
+
+	bool overflow = false;
+	bool isSigned = op1.isSigned();
+	switch (kind) {
+		case ExprArena::Kind::Add:
+			result = llvm::APSInt(isSigned ? op1.sadd_ov(op2, overflow) :
+				op1.uadd_ov(op2, overflow), !isSigned);
+			break;
+		case ExprArena::Kind::Sub:
+			result = llvm::APSInt(isSigned ? op1.ssub_ov(op2, overflow) :
+				op1.usub_ov(op2, overflow), !isSigned);
+			break;
+		case ExprArena::Kind::Mul:
+			result = llvm::APSInt(isSigned ? op1.smul_ov(op2, overflow) :
+				op1.umul_ov(op2, overflow), !isSigned);
+			break;
+		case ExprArena::Kind::BitAnd:
+			result = op1 & op2;
+			break;
+		case ExprArena::Kind::BitOr:
+			result = op1 | op2;
+			break;
+		case ExprArena::Kind::BitXor:
+			result = op1 ^ op2;
+			break;
+		default:
+			return false;
+	}
+	return !overflow;
+}
+
+} // anonymous namespace
+
+/**
+* @brief Constructs a new optimizer of expressions in @a arena.
+*/
+ArenaConstOperatorConstOptimizer::ArenaConstOperatorConstOptimizer(
+		ExprArena &arena): ArenaVisitor(arena), root() {}
+
+/**
+* @brief Evaluates all operators with constant operands in @a expr stored in
+*        @a arena.
+*
+* @return Handle of the optimized expression. It differs from @a expr if the
+*         whole @a expr has been evaluated.
+*/
+ExprHandle ArenaConstOperatorConstOptimizer::optimize(ExprArena &arena,
+		ExprHandle expr) {
+	ArenaConstOperatorConstOptimizer optimizer(arena);
+	optimizer.root = expr;
+	optimizer.visit(expr);
+	return optimizer.root;
+}
+
+void ArenaConstOperatorConstOptimizer::visitBinaryOp(ExprHandle expr) {
+	ArenaVisitor::visitBinaryOp(expr);
+
+	auto op1 = arena.getOperand(expr, 0);
+	auto op2 = arena.getOperand(expr, 1);
+	if (arena.getKind(op1) != ExprArena::Kind::ConstInt ||
+			arena.getKind(op2) != ExprArena::Kind::ConstInt) {
+		return;
+	}
+
+	llvm::APSInt result;
+	if (evaluate(arena.getKind(expr), arena.getConstInt(op1),
+			arena.getConstInt(op2), result)) {
+		replaceWithConstInt(expr, result);
+	}
+}
+
+/**
+* @brief Replaces @a expr with a constant of the given @a value.
+*/
+void ArenaConstOperatorConstOptimizer::replaceWithConstInt(ExprHandle expr,
+		const llvm::APSInt &value) {
+	auto newExpr = arena.createConstInt(value);
+	arena.replace(expr, newExpr);
+	if (expr == root) {
+		root = newExpr;
+	}
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
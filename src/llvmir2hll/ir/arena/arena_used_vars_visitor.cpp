@@ -0,0 +1,43 @@
+/**
+* @file src/llvmir2hll/ir/arena/arena_used_vars_visitor.cpp
+* @brief Implementation of ArenaUsedVarsVisitor.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/llvmir2hll/analysis/used_vars_visitor.h"
+#include "retdec/llvmir2hll/ir/arena/arena_used_vars_visitor.h"
+#include "retdec/llvmir2hll/ir/expression.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/utils/container.h"
+
+using retdec::utils::addToSet;
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief Constructs a new visitor of expressions in @a arena.
+*/
+ArenaUsedVarsVisitor::ArenaUsedVarsVisitor(ExprArena &arena):
+	ArenaVisitor(arena), usedVars() {}
+
+/**
+* @brief Returns all variables used in @a expr stored in @a arena.
+*/
+VarSet ArenaUsedVarsVisitor::getUsedVars(ExprArena &arena, ExprHandle expr) {
+	ArenaUsedVarsVisitor visitor(arena);
+	visitor.visit(expr);
+	return visitor.usedVars;
+}
+
+void ArenaUsedVarsVisitor::visitVariable(ExprHandle expr) {
+	usedVars.insert(arena.getVariable(expr));
+}
+
+void ArenaUsedVarsVisitor::visitOpaque(ExprHandle expr) {
+	addToSet(UsedVarsVisitor::getUsedVars(arena.getOpaque(expr))->getAllVars(),
+		usedVars);
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
@@ -0,0 +1,63 @@
+/**
+* @file src/llvmir2hll/ir/arena/arena_visitor.cpp
+* @brief Implementation of ArenaVisitor.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/llvmir2hll/ir/arena/arena_visitor.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief Constructs a visitor of expressions in @a arena.
+*/
+ArenaVisitor::ArenaVisitor(ExprArena &arena): arena(arena) {}
+
+/**
+* @brief Destructs the visitor.
+*/
+ArenaVisitor::~ArenaVisitor() {}
+
+/**
+* @brief Visits @a expr by calling the member function for its kind.
+*/
+void ArenaVisitor::visit(ExprHandle expr) {
+	auto kind = arena.getKind(expr);
+	switch (kind) {
+		case ExprArena::Kind::Variable:
+			visitVariable(expr);
+			break;
+		case ExprArena::Kind::ConstInt:
+			visitConstInt(expr);
+			break;
+		case ExprArena::Kind::Opaque:
+			visitOpaque(expr);
+			break;
+		default:
+			if (ExprArena::isUnaryOp(kind)) {
+				visitUnaryOp(expr);
+			} else {
+				visitBinaryOp(expr);
+			}
+			break;
+	}
+}
+
+void ArenaVisitor::visitVariable(ExprHandle expr) {}
+
+void ArenaVisitor::visitConstInt(ExprHandle expr) {}
+
+void ArenaVisitor::visitBinaryOp(ExprHandle expr) {
+	visit(arena.getOperand(expr, 0));
+	visit(arena.getOperand(expr, 1));
+}
+
+void ArenaVisitor::visitUnaryOp(ExprHandle expr) {
+	visit(arena.getOperand(expr, 0));
+}
+
+void ArenaVisitor::visitOpaque(ExprHandle expr) {}
+
+} // namespace llvmir2hll
+} // namespace retdec
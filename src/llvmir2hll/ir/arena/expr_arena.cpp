@@ -0,0 +1,330 @@
+/**
+* @file src/llvmir2hll/ir/arena/expr_arena.cpp
+* @brief Implementation of ExprArena.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <algorithm>
+
+#include "retdec/llvmir2hll/ir/arena/expr_arena.h"
+#include "retdec/llvmir2hll/ir/expression.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/support/debug.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+namespace {
+
+/// Uses of variables which are not used in the arena.
+const ExprArena::ExprHandles NO_USES;
+
+} // anonymous namespace
+
+/**
+* @brief Constructs an empty arena.
+*/
+ExprArena::ExprArena():
+	nodes(), vars(), varIndexes(), varUses(), ints(), opaques() {}
+
+/**
+* @brief Destructs the arena, including all its expressions.
+*/
+ExprArena::~ExprArena() {}
+
+/**
+* @brief Creates a use of the given variable.
+*
+* @par Preconditions
+*  - @a var is non-null
+*/
+ExprHandle ExprArena::createVariable(ShPtr<Variable> var) {
+	PRECONDITION_NON_NULL(var);
+
+	auto i = varIndexes.find(var.get());
+	if (i == varIndexes.end()) {
+		i = varIndexes.emplace(var.get(), vars.size()).first;
+		vars.push_back(var);
+		varUses.emplace_back();
+	}
+	auto expr = addNode(Kind::Variable, ExprHandle(), ExprHandle(), i->second);
+	varUses[i->second].push_back(expr);
+	return expr;
+}
+
+/**
+* @brief Creates an integer constant with the given @a value.
+*/
+ExprHandle ExprArena::createConstInt(const llvm::APSInt &value) {
+	ints.push_back(value);
+	return addNode(Kind::ConstInt, ExprHandle(), ExprHandle(), ints.size() - 1);
+}
+
+/**
+* @brief Creates a binary operator of the given @a kind.
+*
+* @par Preconditions
+*  - @a kind is a binary operator (see isBinaryOp())
+*  - @a op1 and @a op2 are valid and have no parents
+*/
+ExprHandle ExprArena::createBinaryOp(Kind kind, ExprHandle op1,
+		ExprHandle op2) {
+	PRECONDITION(isBinaryOp(kind), "not a binary operator");
+	PRECONDITION(!getParent(op1).isValid(), "op1 already has a parent");
+	PRECONDITION(!getParent(op2).isValid(), "op2 already has a parent");
+
+	auto expr = addNode(kind, op1, op2, 0);
+	setParent(op1, expr);
+	setParent(op2, expr);
+	return expr;
+}
+
+/**
+* @brief Creates a unary operator of the given @a kind.
+*
+* @par Preconditions
+*  - @a kind is a unary operator (see isUnaryOp())
+*  - @a op is valid and has no parent
+*/
+ExprHandle ExprArena::createUnaryOp(Kind kind, ExprHandle op) {
+	PRECONDITION(isUnaryOp(kind), "not a unary operator");
+	PRECONDITION(!getParent(op).isValid(), "op already has a parent");
+
+	auto expr = addNode(kind, op, ExprHandle(), 0);
+	setParent(op, expr);
+	return expr;
+}
+
+/**
+* @brief Creates an opaque expression keeping @a expr.
+*
+* @par Preconditions
+*  - @a expr is non-null
+*/
+ExprHandle ExprArena::createOpaque(ShPtr<Expression> expr) {
+	PRECONDITION_NON_NULL(expr);
+
+	opaques.push_back(expr);
+	return addNode(Kind::Opaque, ExprHandle(), ExprHandle(), opaques.size() - 1);
+}
+
+/**
+* @brief Returns the kind of @a expr.
+*/
+ExprArena::Kind ExprArena::getKind(ExprHandle expr) const {
+	return getNode(expr).kind;
+}
+
+/**
+* @brief Returns the number of operands of @a expr.
+*/
+std::size_t ExprArena::getNumOfOperands(ExprHandle expr) const {
+	auto kind = getKind(expr);
+	return isBinaryOp(kind) ? 2 : isUnaryOp(kind) ? 1 : 0;
+}
+
+/**
+* @brief Returns the @a n-th operand of @a expr (starting from 0).
+*
+* @par Preconditions
+*  - <tt>n < getNumOfOperands(expr)</tt>
+*/
+ExprHandle ExprArena::getOperand(ExprHandle expr, std::size_t n) const {
+	PRECONDITION(n < getNumOfOperands(expr), "n `" << n << "` is out of range");
+
+	return getNode(expr).ops[n];
+}
+
+/**
+* @brief Returns the parent of @a expr.
+*
+* If @a expr has no parent, the returned handle is invalid.
+*/
+ExprHandle ExprArena::getParent(ExprHandle expr) const {
+	return getNode(expr).parent;
+}
+
+/**
+* @brief Returns the variable used by @a expr.
+*
+* @par Preconditions
+*  - @a expr is a variable
+*/
+ShPtr<Variable> ExprArena::getVariable(ExprHandle expr) const {
+	const auto &node = getNode(expr);
+	PRECONDITION(node.kind == Kind::Variable, "not a variable");
+
+	return vars[node.data];
+}
+
+/**
+* @brief Returns the value of @a expr.
+*
+* @par Preconditions
+*  - @a expr is an integer constant
+*/
+const llvm::APSInt &ExprArena::getConstInt(ExprHandle expr) const {
+	const auto &node = getNode(expr);
+	PRECONDITION(node.kind == Kind::ConstInt, "not an integer constant");
+
+	return ints[node.data];
+}
+
+/**
+* @brief Returns the original expression of @a expr.
+*
+* @par Preconditions
+*  - @a expr is an opaque expression
+*/
+ShPtr<Expression> ExprArena::getOpaque(ExprHandle expr) const {
+	const auto &node = getNode(expr);
+	PRECONDITION(node.kind == Kind::Opaque, "not an opaque expression");
+
+	return opaques[node.data];
+}
+
+/**
+* @brief Returns all uses of @a var in expressions that have not been replaced.
+*/
+const ExprArena::ExprHandles &ExprArena::getUses(ShPtr<Variable> var) const {
+	auto i = varIndexes.find(var.get());
+	return i != varIndexes.end() ? varUses[i->second] : NO_USES;
+}
+
+/**
+* @brief Replaces @a oldExpr with @a newExpr in the parent of @a oldExpr.
+*
+* The uses of variables in @a oldExpr are removed. If @a oldExpr has no
+* parent, only the uses are removed.
+*
+* @par Preconditions
+*  - @a newExpr has no parent
+*/
+void ExprArena::replace(ExprHandle oldExpr, ExprHandle newExpr) {
+	PRECONDITION(!getParent(newExpr).isValid(), "newExpr already has a parent");
+
+	auto parent = getParent(oldExpr);
+	if (parent.isValid()) {
+		auto &parentNode = getNode(parent);
+		for (auto &op : parentNode.ops) {
+			if (op == oldExpr) {
+				op = newExpr;
+			}
+		}
+		setParent(newExpr, parent);
+		setParent(oldExpr, ExprHandle());
+	}
+	removeUses(oldExpr);
+}
+
+/**
+* @brief Returns the number of expressions in the arena, including replaced
+*        ones.
+*/
+std::size_t ExprArena::getNumOfExprs() const {
+	return nodes.size();
+}
+
+/**
+* @brief Returns the number of bytes allocated by the arena.
+*
+* Memory of the original expressions of opaque expressions, of variables, and
+* of large integer constants is not included.
+*/
+std::size_t ExprArena::getMemoryUsage() const {
+	std::size_t usage = nodes.capacity() * sizeof(Node) +
+		vars.capacity() * sizeof(ShPtr<Variable>) +
+		varIndexes.bucket_count() * sizeof(void *) +
+		varIndexes.size() * (sizeof(Variable *) + sizeof(std::uint32_t) +
+			sizeof(void *)) +
+		varUses.capacity() * sizeof(ExprHandles) +
+		ints.capacity() * sizeof(llvm::APSInt) +
+		opaques.capacity() * sizeof(ShPtr<Expression>);
+	for (const auto &uses : varUses) {
+		usage += uses.capacity() * sizeof(ExprHandle);
+	}
+	return usage;
+}
+
+/**
+* @brief Returns @c true if @a kind is a binary operator, @c false otherwise.
+*/
+bool ExprArena::isBinaryOp(Kind kind) {
+	switch (kind) {
+		case Kind::Add:
+		case Kind::Sub:
+		case Kind::Mul:
+		case Kind::BitAnd:
+		case Kind::BitOr:
+		case Kind::BitXor:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/**
+* @brief Returns @c true if @a kind is a unary operator, @c false otherwise.
+*/
+bool ExprArena::isUnaryOp(Kind kind) {
+	return kind == Kind::Neg;
+}
+
+/**
+* @brief Appends a new expression to the arena and returns its handle.
+*/
+ExprHandle ExprArena::addNode(Kind kind, ExprHandle op1, ExprHandle op2,
+		std::uint32_t data) {
+	nodes.push_back(Node{kind, ExprHandle(), {op1, op2}, data});
+	return ExprHandle(nodes.size() - 1);
+}
+
+/**
+* @brief Returns the stored expression of @a expr.
+*
+* @par Preconditions
+*  - @a expr is a valid handle of an expression in this arena
+*/
+const ExprArena::Node &ExprArena::getNode(ExprHandle expr) const {
+	PRECONDITION(expr.getIndex() < nodes.size(), "invalid handle");
+
+	return nodes[expr.getIndex()];
+}
+
+/**
+* @brief Returns the stored expression of @a expr.
+*
+* @par Preconditions
+*  - @a expr is a valid handle of an expression in this arena
+*/
+ExprArena::Node &ExprArena::getNode(ExprHandle expr) {
+	PRECONDITION(expr.getIndex() < nodes.size(), "invalid handle");
+
+	return nodes[expr.getIndex()];
+}
+
+/**
+* @brief Sets the parent of @a expr to @a parent.
+*/
+void ExprArena::setParent(ExprHandle expr, ExprHandle parent) {
+	getNode(expr).parent = parent;
+}
+
+/**
+* @brief Removes the uses of variables in @a expr and its operands.
+*/
+void ExprArena::removeUses(ExprHandle expr) {
+	const auto &node = getNode(expr);
+	if (node.kind == Kind::Variable) {
+		auto &uses = varUses[node.data];
+		uses.erase(std::remove(uses.begin(), uses.end(), expr), uses.end());
+		return;
+	}
+
+	for (std::size_t i = 0, e = getNumOfOperands(expr); i < e; ++i) {
+		removeUses(node.ops[i]);
+	}
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
@@ -0,0 +1,138 @@
+/**
+* @file src/llvmir2hll/ir/arena/expr_arena_converter.cpp
+* @brief Implementation of ExprArenaConverter.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/arena/expr_arena_converter.h"
+#include "retdec/llvmir2hll/ir/bit_and_op_expr.h"
+#include "retdec/llvmir2hll/ir/bit_or_op_expr.h"
+#include "retdec/llvmir2hll/ir/bit_xor_op_expr.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/mul_op_expr.h"
+#include "retdec/llvmir2hll/ir/neg_op_expr.h"
+#include "retdec/llvmir2hll/ir/sub_op_expr.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/support/debug.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+namespace {
+
+/**
+* @brief Returns the kind of @a expr in ExprArena, or ExprArena::Kind::Opaque
+*        if it has no kind there.
+*/
+ExprArena::Kind getKind(const ShPtr<Expression> &expr) {
+	if (isa<Variable>(expr)) {
+		return ExprArena::Kind::Variable;
+	} else if (isa<ConstInt>(expr)) {
+		return ExprArena::Kind::ConstInt;
+	} else if (isa<AddOpExpr>(expr)) {
+		return ExprArena::Kind::Add;
+	} else if (isa<SubOpExpr>(expr)) {
+		return ExprArena::Kind::Sub;
+	} else if (isa<MulOpExpr>(expr)) {
+		return ExprArena::Kind::Mul;
+	} else if (isa<BitAndOpExpr>(expr)) {
+		return ExprArena::Kind::BitAnd;
+	} else if (isa<BitOrOpExpr>(expr)) {
+		return ExprArena::Kind::BitOr;
+	} else if (isa<BitXorOpExpr>(expr)) {
+		return ExprArena::Kind::BitXor;
+	} else if (isa<NegOpExpr>(expr)) {
+		return ExprArena::Kind::Neg;
+	}
+	return ExprArena::Kind::Opaque;
+}
+
+/**
+* @brief Creates a binary operator of the given @a kind in the backend IR.
+*/
+ShPtr<Expression> createBinaryOpExpr(ExprArena::Kind kind,
+		ShPtr<Expression> op1, ShPtr<Expression> op2) {
+	switch (kind) {
+		case ExprArena::Kind::Add:
+			return AddOpExpr::create(op1, op2);
+		case ExprArena::Kind::Sub:
+			return SubOpExpr::create(op1, op2);
+		case ExprArena::Kind::Mul:
+			return MulOpExpr::create(op1, op2);
+		case ExprArena::Kind::BitAnd:
+			return BitAndOpExpr::create(op1, op2);
+		case ExprArena::Kind::BitOr:
+			return BitOrOpExpr::create(op1, op2);
+		case ExprArena::Kind::BitXor:
+			return BitXorOpExpr::create(op1, op2);
+		default:
+			FAIL("unsupported binary operator");
+			return ShPtr<Expression>();
+	}
+}
+
+} // anonymous namespace
+
+/**
+* @brief Stores @a expr into @a arena and returns its handle.
+*
+* Operands of @a expr are stored as well. The expressions of the backend IR
+* are not changed.
+*
+* @par Preconditions
+*  - @a expr is non-null
+*/
+ExprHandle ExprArenaConverter::toArena(ExprArena &arena,
+		ShPtr<Expression> expr) {
+	PRECONDITION_NON_NULL(expr);
+
+	auto kind = getKind(expr);
+	switch (kind) {
+		case ExprArena::Kind::Variable:
+			return arena.createVariable(cast<Variable>(expr));
+		case ExprArena::Kind::ConstInt:
+			return arena.createConstInt(cast<ConstInt>(expr)->getValue());
+		case ExprArena::Kind::Neg:
+			return arena.createUnaryOp(kind,
+				toArena(arena, cast<NegOpExpr>(expr)->getOperand()));
+		case ExprArena::Kind::Opaque:
+			return arena.createOpaque(expr);
+		default: {
+			auto binaryOpExpr = cast<BinaryOpExpr>(expr);
+			auto op1 = toArena(arena, binaryOpExpr->getFirstOperand());
+			auto op2 = toArena(arena, binaryOpExpr->getSecondOperand());
+			return arena.createBinaryOp(kind, op1, op2);
+		}
+	}
+}
+
+/**
+* @brief Creates an expression of the backend IR from @a expr stored in
+*        @a arena.
+*
+* Variables and the original expressions of opaque expressions are not
+* copied.
+*/
+ShPtr<Expression> ExprArenaConverter::toExpression(const ExprArena &arena,
+		ExprHandle expr) {
+	auto kind = arena.getKind(expr);
+	switch (kind) {
+		case ExprArena::Kind::Variable:
+			return arena.getVariable(expr);
+		case ExprArena::Kind::ConstInt:
+			return ConstInt::create(arena.getConstInt(expr));
+		case ExprArena::Kind::Neg:
+			return NegOpExpr::create(
+				toExpression(arena, arena.getOperand(expr, 0)));
+		case ExprArena::Kind::Opaque:
+			return arena.getOpaque(expr);
+		default:
+			return createBinaryOpExpr(kind,
+				toExpression(arena, arena.getOperand(expr, 0)),
+				toExpression(arena, arena.getOperand(expr, 1)));
+	}
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
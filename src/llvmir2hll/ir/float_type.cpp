@@ -51,6 +51,7 @@ unsigned FloatType::getSize() const {
 * @return Returns true if exists type, else false.
 */
 bool FloatType::existsFloatTypeWith(unsigned size) const {
+	std::lock_guard<std::mutex> lock(createdTypesMutex);
 	return createdTypes.find(size) != createdTypes.end();
 }
 
@@ -60,6 +61,7 @@ bool FloatType::existsFloatTypeWith(unsigned size) const {
 * @return Returns true if exists float type, else false.
 */
 bool FloatType::existsFloatType() const {
+	std::lock_guard<std::mutex> lock(createdTypesMutex);
 	if (createdTypes.empty()) {
 		return false;
 	}
@@ -74,6 +76,8 @@ bool FloatType::existsFloatType() const {
 ShPtr<FloatType> FloatType::create(unsigned size) {
 	PRECONDITION(size > 0, "invalid size " << size);
 
+	std::lock_guard<std::mutex> lock(createdTypesMutex);
+
 	// To reduce the amount of created types, we use a set of already created
 	// float types of the given size. If the wanted type has already been
 	// created, reuse it.
@@ -94,6 +98,7 @@ void FloatType::accept(Visitor *v) {
 
 // Static variables and constants definitions.
 std::map<unsigned, ShPtr<FloatType>> FloatType::createdTypes;
+std::mutex FloatType::createdTypesMutex;
 
 } // namespace llvmir2hll
 } // namespace retdec
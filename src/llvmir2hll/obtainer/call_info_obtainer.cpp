@@ -6,6 +6,7 @@
 
 #include <cstddef>
 
+#include "retdec/llvmir2hll/analysis/func_change_tracker.h"
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_builders/non_recursive_cfg_builder.h"
 #include "retdec/llvmir2hll/ir/call_expr.h"
@@ -73,7 +74,7 @@ ShPtr<Function> FuncInfo::getFunc() const {
 */
 CallInfoObtainer::CallInfoObtainer():
 	module(), cg(), va(), funcCFGMap(),
-	cfgBuilder(NonRecursiveCFGBuilder::create()) {}
+	cfgBuilder(NonRecursiveCFGBuilder::create()), cfgTracker() {}
 
 /**
 * @brief Destructs the obtainer.
@@ -116,22 +117,41 @@ ShPtr<CFG> CallInfoObtainer::getCFGForFunc(ShPtr<Function> func) const {
 *  - both @a va and @a cg are non-null
 *  - @a va is in a valid state
 *
+* CFGs of functions that have not changed since the previous initialization
+* with the same module are reused, so repeated initializations are cheap when
+* only a few functions have been changed in the meantime.
+*
 * This function leaves @a va in a valid state.
 */
 void CallInfoObtainer::init(ShPtr<CG> cg, ShPtr<ValueAnalysis> va) {
 	PRECONDITION_NON_NULL(cg);
 	PRECONDITION(va->isInValidState(), "it is not in a valid state");
 
+	ShPtr<Module> newModule(cg->getCorrespondingModule());
+	if (!cfgTracker || newModule != module) {
+		cfgTracker = FuncChangeTracker::create(newModule);
+		funcCFGMap.clear();
+	}
+
 	this->cg = cg;
 	this->va = va;
-	module = cg->getCorrespondingModule();
-	funcCFGMap.clear();
+	module = newModule;
 
 	// To speedup the initialization, compute and store the CFG for each
-	// function.
+	// function. The CFG of a function is rebuilt only if the function has
+	// changed.
+	FuncSet changedFuncs(cfgTracker->getChangedFuncs());
+	FuncCFGMap oldFuncCFGMap;
+	oldFuncCFGMap.swap(funcCFGMap);
 	for (auto i = module->func_begin(), e = module->func_end(); i != e; ++i) {
-		funcCFGMap[*i] = cfgBuilder->getCFG(*i);
+		auto oldCFG = oldFuncCFGMap.find(*i);
+		if (oldCFG != oldFuncCFGMap.end() && !hasItem(changedFuncs, *i)) {
+			funcCFGMap[*i] = oldCFG->second;
+		} else {
+			funcCFGMap[*i] = cfgBuilder->getCFG(*i);
+		}
 	}
+	cfgTracker->markAsUpToDate(changedFuncs);
 }
 
 /**
@@ -21,7 +21,7 @@ namespace llvmir2hll {
 *  - @a module is non-null
 */
 FuncOptimizer::FuncOptimizer(ShPtr<Module> module):
-	Optimizer(module), currFunc() {
+	Optimizer(module), currFunc(), onlyFunc() {
 		PRECONDITION_NON_NULL(module);
 	}
 
@@ -30,15 +30,41 @@ FuncOptimizer::FuncOptimizer(ShPtr<Module> module):
 */
 FuncOptimizer::~FuncOptimizer() {}
 
+/**
+* @brief Performs the optimization only on the given function.
+*
+* @param[in,out] func Function to be optimized.
+*
+* Like optimize(), this function calls doInitialization(), doOptimization(),
+* and doFinalization(), but doOptimization() of this class calls
+* runOnFunction() only for @a func. It is used to run function-local
+* optimizations of different functions in parallel (see OptimizerManager), so
+* overrides of the three functions have to touch only @a func (and data of the
+* optimizer), and overrides of doOptimization() have to call
+* FuncOptimizer::doOptimization() instead of iterating over functions by
+* themselves.
+*/
+void FuncOptimizer::optimizeFunction(ShPtr<Function> func) {
+	onlyFunc = func;
+	optimize();
+	onlyFunc.reset();
+}
+
 /**
 * @brief Performs the optimization on all functions in the module.
 *
-* This function calls runOnFunction() for each function in the module.
+* This function calls runOnFunction() for each function in the module (or
+* only for the function passed to optimizeFunction()).
 *
 * Only redefine if you want to prescribe the order in which functions are
 * optimized; otherwise, just override runOnFunction().
 */
 void FuncOptimizer::doOptimization() {
+	if (onlyFunc) {
+		runOnFunction(onlyFunc);
+		return;
+	}
+
 	// For each function in the module...
 	for (auto i = module->func_begin(), e = module->func_end(); i != e; ++i) {
 		runOnFunction(*i);
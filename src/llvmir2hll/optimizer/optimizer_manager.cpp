@@ -4,10 +4,17 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <mutex>
+
+#include "retdec/llvmir2hll/analysis/func_change_tracker.h"
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
+#include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
+#include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator_factory.h"
 #include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
 #include "retdec/llvmir2hll/hll/hll_writer.h"
+#include "retdec/llvmir2hll/ir/module.h"
 #include "retdec/llvmir2hll/obtainer/call_info_obtainer.h"
+#include "retdec/llvmir2hll/optimizer/func_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizer_manager.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/aggressive_deref_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/aggressive_global_to_local_optimizer.h"
@@ -44,6 +51,8 @@
 #include "retdec/llvmir2hll/optimizer/optimizers/while_true_to_ufor_loop_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/while_true_to_while_cond_optimizer.h"
 #include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/llvmir2hll/support/profiling.h"
+#include "retdec/llvmir2hll/support/subject.h"
 #include "retdec/utils/container.h"
 #include "retdec/utils/string.h"
 #include "retdec/utils/system.h"
@@ -65,6 +74,39 @@ const std::string OPT_SUFFIX = "Optimizer";
 /// Prefix of aggressive optimizations.
 const std::string AGGRESSIVE_OPTS_PREFIX = "Aggressive";
 
+/// Optimizations which change only the optimized function, do not need any
+/// module-level preparation, and use no analysis of the whole module (value
+/// analysis and arithmetical expression evaluator are private to every
+/// thread). They can optimize different functions in parallel.
+///
+/// Functions are then optimized by FuncOptimizer::optimizeFunction(), which
+/// runs doInitialization(), doOptimization(), and doFinalization() of the
+/// optimizer for every function. Their overrides (IfBeforeLoop, VarDefStmt,
+/// and WhileTrueToForLoop override doOptimization() to clear and invalidate
+/// the cache of the value analysis) have to touch only the optimized function
+/// and the analyses of the thread. If you add an optimization whose hooks do
+/// anything else, do not put it here.
+const StringSet FUNC_LOCAL_OPTS = {
+	"AggressiveDeref",
+	"BitOpToLogOp",
+	"BreakContinueReturn",
+	"DeadCode",
+	"DerefAddress",
+	"EmptyStmt",
+	"IfBeforeLoop",
+	"IfStructure",
+	"IfToSwitch",
+	"LoopLastContinue",
+	"RemoveAllCasts",
+	"RemoveUselessCasts",
+	"SelfAssign",
+	"VarDefForLoop",
+	"VarDefStmt",
+	"VoidReturn",
+	"WhileTrueToForLoop",
+	"WhileTrueToWhileCond",
+};
+
 /**
 * @brief Trims the optional suffix "Optimizer" from all optimization names in
 *        @a opts.
@@ -100,6 +142,11 @@ StringSet trimOptimizerSuffix(const StringSet &opts) {
 * @param[in] arithmExprEvaluator Used evaluator of arithmetical expressions.
 * @param[in] enableAggressiveOpts Enables aggressive optimizations.
 * @param[in] enableDebug Enables emission of debug messages.
+* @param[in] profiler If non-null, every run optimization is recorded in it as
+*                     a phase.
+* @param[in] threadCount Number of threads running function-local
+*                        optimizations. If it is @c 0, the number of CPU
+*                        cores is used.
 *
 * To perform the actual optimizations, call optimize(). To get a list of
 * available optimizations and their names, see our wiki.
@@ -123,17 +170,24 @@ OptimizerManager::OptimizerManager(const StringSet &enabledOpts,
 	const StringSet &disabledOpts, ShPtr<HLLWriter> hllWriter,
 	ShPtr<ValueAnalysis> va, ShPtr<CallInfoObtainer> cio,
 	ShPtr<ArithmExprEvaluator> arithmExprEvaluator,
-	bool enableAggressiveOpts, bool enableDebug):
+	bool enableAggressiveOpts, bool enableDebug,
+	retdec::utils::Profiler *profiler, std::size_t threadCount):
 		enabledOpts(trimOptimizerSuffix(enabledOpts)),
 		disabledOpts(trimOptimizerSuffix(disabledOpts)),
 		hllWriter(hllWriter), va(va), cio(cio),
 		arithmExprEvaluator(arithmExprEvaluator),
 		enableAggressiveOpts(enableAggressiveOpts), enableDebug(enableDebug),
-		recoverFromOutOfMemory(true), backendRunOpts() {
+		profiler(profiler), recoverFromOutOfMemory(true), backendRunOpts(),
+		threadPool(), scheduledFuncOpts() {
 			PRECONDITION_NON_NULL(hllWriter);
 			PRECONDITION_NON_NULL(va);
 			PRECONDITION_NON_NULL(cio);
 			PRECONDITION_NON_NULL(arithmExprEvaluator);
+
+			if (threadCount != 1) {
+				threadPool = std::make_unique<retdec::utils::ThreadPool>(
+					threadCount);
+			}
 		}
 
 /**
@@ -180,10 +234,13 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	// Data-flow optimizations.
 	// The following optimizations should be run before CopyPropagation to
 	// speed it up.
+	// The tracker makes the second run of CopyPropagation optimize only
+	// functions changed since the first run.
+	auto copyPropagationTracker = FuncChangeTracker::create(m, true);
 	run<UnusedGlobalVarOptimizer>(m);
 	run<DeadLocalAssignOptimizer>(m, va);
 	run<SimpleCopyPropagationOptimizer>(m, va, cio);
-	run<CopyPropagationOptimizer>(m, va, cio);
+	run<CopyPropagationOptimizer>(m, va, cio, copyPropagationTracker);
 	// AuxiliaryVariablesOptimizer should be run after CopyPropagationOptimizer.
 	run<AuxiliaryVariablesOptimizer>(m, va, cio);
 
@@ -238,7 +295,7 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 		run<UnusedGlobalVarOptimizer>(m);
 		run<DeadLocalAssignOptimizer>(m, va);
 		run<SimpleCopyPropagationOptimizer>(m, va, cio);
-		run<CopyPropagationOptimizer>(m, va, cio);
+		run<CopyPropagationOptimizer>(m, va, cio, copyPropagationTracker);
 	}
 
 	// This is best to be run after DeadLocalAssignOptimizer and
@@ -278,6 +335,8 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 		// Optimizations for Python'.
 		run<NoInitVarDefOptimizer>(m);
 	}
+
+	runScheduledFuncOptimizers(m);
 }
 
 /**
@@ -304,9 +363,10 @@ bool OptimizerManager::optShouldBeRun(const std::string &optId) const {
 }
 
 /**
-* @brief Runs the given optimizer provided that it should be run.
+* @brief Runs the given optimizer of @a m provided that it should be run.
 */
-void OptimizerManager::runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimizer) {
+void OptimizerManager::runOptimizerProvidedItShouldBeRun(ShPtr<Module> m,
+		ShPtr<Optimizer> optimizer) {
 	const std::string OPT_ID = optimizer->getId();
 	if (!optShouldBeRun(OPT_ID)) {
 		return;
@@ -314,6 +374,10 @@ void OptimizerManager::runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimi
 
 	printOptimization(OPT_ID);
 
+	if (profiler) {
+		profiler->start(OPT_ID + OPT_SUFFIX, getModuleSize(m));
+	}
+
 	if (recoverFromOutOfMemory) {
 		// Some optimizations, most notable CopyPropagation, may run out of
 		// memory on huge inputs. We try to recover from such situations by
@@ -332,6 +396,10 @@ void OptimizerManager::runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimi
 		optimizer->optimize();
 	}
 
+	if (profiler) {
+		profiler->stop(getModuleSize(m));
+	}
+
 	backendRunOpts.insert(OPT_ID);
 }
 
@@ -386,9 +454,161 @@ bool OptimizerManager::shouldSecondCopyPropagationBeRun() const {
 */
 template<typename Optimization, typename... Args>
 void OptimizerManager::run(ShPtr<Module> m, Args &&... args) {
-	auto optimizer = std::make_shared<Optimization>(m,
-		std::forward<Args>(args)...);
-	runOptimizerProvidedItShouldBeRun(optimizer);
+	auto optimizer = std::make_shared<Optimization>(m, args...);
+	if (threadPool && isFunctionLocal(optimizer->getId())) {
+		scheduleFuncOptimizer(optimizer->getId(),
+			[m, args...](FuncOptContext &context) {
+				// All function-local optimizers are function optimizers, so
+				// the cast always succeeds.
+				return cast<FuncOptimizer>(std::make_shared<Optimization>(m,
+					forContext(args, context)...));
+			}
+		);
+		return;
+	}
+
+	// The optimization may use the whole module, so all functions have to be
+	// optimized by the preceding function-local optimizations.
+	runScheduledFuncOptimizers(m);
+	runOptimizerProvidedItShouldBeRun(m, optimizer);
+}
+
+/**
+* @brief Returns @c true if the optimization with @a optId can optimize
+*        different functions in parallel, @c false otherwise.
+*/
+bool OptimizerManager::isFunctionLocal(const std::string &optId) {
+	return hasItem(FUNC_LOCAL_OPTS, optId);
+}
+
+/**
+* @brief Schedules the function-local optimization with @a optId provided that
+*        it should be run.
+*
+* @param[in] optId ID of the optimization.
+* @param[in] create Creates an instance of the optimizer for a thread.
+*
+* Scheduled optimizations are run by runScheduledFuncOptimizers().
+*/
+void OptimizerManager::scheduleFuncOptimizer(const std::string &optId,
+		FuncOptCreator create) {
+	if (!optShouldBeRun(optId)) {
+		return;
+	}
+
+	scheduledFuncOpts.push_back({optId, create});
+	backendRunOpts.insert(optId);
+}
+
+/**
+* @brief Runs all scheduled function-local optimizations over all functions in
+*        @a m.
+*
+* Functions are distributed among threads. Every function is optimized by all
+* the scheduled optimizations in the order of their scheduling.
+*/
+void OptimizerManager::runScheduledFuncOptimizers(ShPtr<Module> m) {
+	if (scheduledFuncOpts.empty()) {
+		return;
+	}
+
+	std::string phase;
+	for (const auto &opt : scheduledFuncOpts) {
+		printOptimization(opt.id);
+		phase += (phase.empty() ? "" : "+") + opt.id + OPT_SUFFIX;
+	}
+
+	if (profiler) {
+		profiler->start(phase, getModuleSize(m));
+	}
+
+	// Contexts are reused by tasks, so there are at most as many contexts as
+	// there are threads.
+	FuncVector funcs(m->func_begin(), m->func_end());
+	std::vector<UPtr<FuncOptContext>> contexts;
+	std::mutex contextsMutex;
+	auto optimizeFunc = [&](std::size_t i) {
+		UPtr<FuncOptContext> context;
+		{
+			std::lock_guard<std::mutex> lock(contextsMutex);
+			if (!contexts.empty()) {
+				context = std::move(contexts.back());
+				contexts.pop_back();
+			}
+		}
+		if (!context) {
+			context = createFuncOptContext();
+		}
+
+		for (const auto &optimizer : context->optimizers) {
+			// The previous optimization may have changed the function.
+			context->va->clearCache();
+			optimizer->optimizeFunction(funcs[i]);
+		}
+
+		std::lock_guard<std::mutex> lock(contextsMutex);
+		contexts.push_back(std::move(context));
+	};
+
+	{
+		// Values used in several functions (e.g. global variables) may get or
+		// lose observers in several threads at once.
+		ObserversLocking observersLocking;
+		if (recoverFromOutOfMemory) {
+			// See runOptimizerProvidedItShouldBeRun().
+			try {
+				threadPool->parallelFor(funcs.size(), optimizeFunc);
+			} catch (const std::bad_alloc &) {
+				printWarningMessage("out of memory; trying to recover");
+				sleep(1);
+			}
+		} else {
+			threadPool->parallelFor(funcs.size(), optimizeFunc);
+		}
+	}
+	scheduledFuncOpts.clear();
+
+	// The shared value analysis has not seen the changes.
+	va->invalidateState();
+
+	if (profiler) {
+		profiler->stop(getModuleSize(m));
+	}
+}
+
+/**
+* @brief Creates analyses and instances of the scheduled optimizers for one
+*        thread.
+*/
+UPtr<OptimizerManager::FuncOptContext>
+		OptimizerManager::createFuncOptContext() const {
+	auto context = std::make_unique<FuncOptContext>();
+	context->va = ValueAnalysis::create(va->getAliasAnalysis(),
+		va->isCachingEnabled());
+	context->arithmExprEvaluator = ArithmExprEvaluatorFactory::getInstance()
+		.createObject(arithmExprEvaluator->getId());
+	for (const auto &opt : scheduledFuncOpts) {
+		context->optimizers.push_back(opt.create(*context));
+	}
+	return context;
+}
+
+/**
+* @brief Returns the value analysis of the thread using @a context instead of
+*        the shared one.
+*/
+ShPtr<ValueAnalysis> OptimizerManager::forContext(
+		const ShPtr<ValueAnalysis> &, FuncOptContext &context) {
+	return context.va;
+}
+
+/**
+* @brief Returns the evaluator of the thread using @a context instead of the
+*        shared one.
+*/
+ShPtr<ArithmExprEvaluator> OptimizerManager::forContext(
+		const ShPtr<ArithmExprEvaluator> &, FuncOptContext &context) {
+	return context.arithmExprEvaluator;
 }
 
 } // namespace llvmir2hll
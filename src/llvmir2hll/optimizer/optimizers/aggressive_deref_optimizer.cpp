@@ -50,7 +50,7 @@ void AggressiveDerefOptimizer::tryToOptimizeStmt(ShPtr<Statement> stmt,
 	}
 }
 
-void AggressiveDerefOptimizer::visit(ShPtr<DerefOpExpr> expr) {
+void AggressiveDerefOptimizer::visit(const ShPtr<DerefOpExpr> &expr) {
 	// First, visit nested expressions.
 	FuncOptimizer::visit(expr);
 
@@ -62,14 +62,14 @@ void AggressiveDerefOptimizer::visit(ShPtr<DerefOpExpr> expr) {
 	}
 }
 
-void AggressiveDerefOptimizer::visit(ShPtr<AssignStmt> stmt) {
+void AggressiveDerefOptimizer::visit(const ShPtr<AssignStmt> &stmt) {
 	// First, visit nested/subsequent statements.
 	FuncOptimizer::visit(stmt);
 
 	tryToOptimizeStmt(stmt, stmt->getLhs(), stmt->getRhs());
 }
 
-void AggressiveDerefOptimizer::visit(ShPtr<VarDefStmt> stmt) {
+void AggressiveDerefOptimizer::visit(const ShPtr<VarDefStmt> &stmt) {
 	// First, visit nested/subsequent statements.
 	FuncOptimizer::visit(stmt);
 
@@ -76,7 +76,7 @@ void AuxiliaryVariablesOptimizer::runOnFunction(ShPtr<Function> func) {
 	visitStmt(func->getBody());
 }
 
-void AuxiliaryVariablesOptimizer::visit(ShPtr<AssignStmt> stmt) {
+void AuxiliaryVariablesOptimizer::visit(const ShPtr<AssignStmt> &stmt) {
 	// To optimize the statement, it should be of the form
 	//
 	//    a = b
@@ -101,7 +101,7 @@ void AuxiliaryVariablesOptimizer::visit(ShPtr<AssignStmt> stmt) {
 	FuncOptimizer::visit(stmt);
 }
 
-void AuxiliaryVariablesOptimizer::visit(ShPtr<VarDefStmt> stmt) {
+void AuxiliaryVariablesOptimizer::visit(const ShPtr<VarDefStmt> &stmt) {
 	// To optimize the statement, it should be of the form
 	//
 	//    a (= b)
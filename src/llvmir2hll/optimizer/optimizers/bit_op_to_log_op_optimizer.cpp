@@ -45,7 +45,7 @@ BitOpToLogOpOptimizer::BitOpToLogOpOptimizer(ShPtr<Module> module,
 */
 BitOpToLogOpOptimizer::~BitOpToLogOpOptimizer() {}
 
-void BitOpToLogOpOptimizer::visit(ShPtr<IfStmt> stmt) {
+void BitOpToLogOpOptimizer::visit(const ShPtr<IfStmt> &stmt) {
 	// First of all, visit nested and subsequent statements.
 	FuncOptimizer::visit(stmt);
 
@@ -57,7 +57,7 @@ void BitOpToLogOpOptimizer::visit(ShPtr<IfStmt> stmt) {
 	}
 }
 
-void BitOpToLogOpOptimizer::visit(ShPtr<SwitchStmt> stmt) {
+void BitOpToLogOpOptimizer::visit(const ShPtr<SwitchStmt> &stmt) {
 	// First of all, visit nested and subsequent statements.
 	FuncOptimizer::visit(stmt);
 
@@ -65,7 +65,7 @@ void BitOpToLogOpOptimizer::visit(ShPtr<SwitchStmt> stmt) {
 	tryOptimizeCond(stmt->getControlExpr());
 }
 
-void BitOpToLogOpOptimizer::visit(ShPtr<WhileLoopStmt> stmt) {
+void BitOpToLogOpOptimizer::visit(const ShPtr<WhileLoopStmt> &stmt) {
 	// First of all, visit nested and subsequent statements.
 	FuncOptimizer::visit(stmt);
 
@@ -73,7 +73,7 @@ void BitOpToLogOpOptimizer::visit(ShPtr<WhileLoopStmt> stmt) {
 	tryOptimizeCond(stmt->getCondition());
 }
 
-void BitOpToLogOpOptimizer::visit(ShPtr<BitAndOpExpr> expr) {
+void BitOpToLogOpOptimizer::visit(const ShPtr<BitAndOpExpr> &expr) {
 	// BitAnd which is not in condition.
 	if (!isCondition) {
 		return;
@@ -107,7 +107,7 @@ void BitOpToLogOpOptimizer::visit(ShPtr<BitAndOpExpr> expr) {
 	}
 }
 
-void BitOpToLogOpOptimizer::visit(ShPtr<BitOrOpExpr> expr) {
+void BitOpToLogOpOptimizer::visit(const ShPtr<BitOrOpExpr> &expr) {
 	// BitAnd which is not in condition.
 	if (!isCondition) {
 		return;
@@ -124,7 +124,7 @@ void BitOpToLogOpOptimizer::visit(ShPtr<BitOrOpExpr> expr) {
 	}
 }
 
-void BitOpToLogOpOptimizer::visit(ShPtr<DivOpExpr> expr) {
+void BitOpToLogOpOptimizer::visit(const ShPtr<DivOpExpr> &expr) {
 	// BitAnd which is not in condition.
 	if (!isCondition) {
 		return;
@@ -135,7 +135,7 @@ void BitOpToLogOpOptimizer::visit(ShPtr<DivOpExpr> expr) {
 	}
 }
 
-void BitOpToLogOpOptimizer::visit(ShPtr<ModOpExpr> expr) {
+void BitOpToLogOpOptimizer::visit(const ShPtr<ModOpExpr> &expr) {
 	// BitAnd which is not in condition.
 	if (!isCondition) {
 		return;
@@ -146,7 +146,7 @@ void BitOpToLogOpOptimizer::visit(ShPtr<ModOpExpr> expr) {
 	}
 }
 
-void BitOpToLogOpOptimizer::visit(ShPtr<MulOpExpr> expr) {
+void BitOpToLogOpOptimizer::visit(const ShPtr<MulOpExpr> &expr) {
 	// BitAnd which is not in condition.
 	if (!isCondition) {
 		return;
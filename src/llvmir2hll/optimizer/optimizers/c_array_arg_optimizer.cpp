@@ -72,7 +72,7 @@ CArrayArgOptimizer::CArrayArgOptimizer(ShPtr<Module> module):
 */
 CArrayArgOptimizer::~CArrayArgOptimizer() {}
 
-void CArrayArgOptimizer::visit(ShPtr<CallExpr> expr) {
+void CArrayArgOptimizer::visit(const ShPtr<CallExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	// Check each argument whether it can be optimized, and if so, do it.
@@ -5,14 +5,18 @@
 */
 
 #include <cstddef>
+#include <map>
+#include <vector>
 
 #include "retdec/llvmir2hll/analysis/def_use_analysis.h"
+#include "retdec/llvmir2hll/analysis/func_change_tracker.h"
 #include "retdec/llvmir2hll/analysis/use_def_analysis.h"
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
 #include "retdec/llvmir2hll/analysis/var_uses_visitor.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_traversals/no_var_def_cfg_traversal.h"
 #include "retdec/llvmir2hll/graphs/cfg/cfg_traversals/var_def_cfg_traversal.h"
+#include "retdec/llvmir2hll/graphs/cg/cg.h"
 #include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
 #include "retdec/llvmir2hll/ir/assign_stmt.h"
 #include "retdec/llvmir2hll/ir/call_expr.h"
@@ -32,7 +36,10 @@
 #include "retdec/llvmir2hll/utils/ir.h"
 #include "retdec/utils/container.h"
 
+using retdec::utils::addToSet;
 using retdec::utils::hasItem;
+using retdec::utils::setDifference;
+using retdec::utils::setIntersection;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -164,6 +171,45 @@ auto ordered(const DefUseChains::DefUseChain &du) {
 	return v;
 }
 
+/**
+* @brief Returns functions that directly or indirectly call a function from
+*        @a funcs.
+*
+* The optimization of a function depends on information about its callees, so
+* these are the functions that may be optimized further when functions from
+* @a funcs change. Functions calling a function by a pointer are considered to
+* call every function.
+*/
+FuncSet getCallersOf(const FuncSet &funcs, ShPtr<CG> cg) {
+	FuncSet callers;
+	if (funcs.empty()) {
+		return callers;
+	}
+
+	// Mapping of a function into functions that call it.
+	std::map<ShPtr<Function>, FuncSet> calleeCallersMap;
+	std::vector<ShPtr<Function>> toVisit(funcs.begin(), funcs.end());
+	for (auto i = cg->caller_begin(), e = cg->caller_end(); i != e; ++i) {
+		for (const auto &callee : i->second->callees) {
+			calleeCallersMap[callee].insert(i->first);
+		}
+		if (i->second->callsByPointer && callers.insert(i->first).second) {
+			toVisit.push_back(i->first);
+		}
+	}
+
+	while (!toVisit.empty()) {
+		auto func = toVisit.back();
+		toVisit.pop_back();
+		for (const auto &caller : calleeCallersMap[func]) {
+			if (callers.insert(caller).second) {
+				toVisit.push_back(caller);
+			}
+		}
+	}
+	return callers;
+}
+
 } // anonymous namespace
 
 /**
@@ -172,13 +218,18 @@ auto ordered(const DefUseChains::DefUseChain &du) {
 * @param[in] module Module to be optimized.
 * @param[in] va Analysis of values.
 * @param[in] cio Obtainer of information about function calls.
+* @param[in] tracker If non-null, only functions that have changed since the
+*                    previous run with the same tracker (or whose callees have
+*                    changed) are optimized.
 *
 * @par Preconditions
 *  - @a module, @a va, and @a cio are non-null
 */
 CopyPropagationOptimizer::CopyPropagationOptimizer(ShPtr<Module> module,
-	ShPtr<ValueAnalysis> va, ShPtr<CallInfoObtainer> cio):
-		FuncOptimizer(module), va(va), cio(cio), vuv(), dua(), uda(),
+	ShPtr<ValueAnalysis> va, ShPtr<CallInfoObtainer> cio,
+	ShPtr<FuncChangeTracker> tracker):
+		FuncOptimizer(module), va(va), cio(cio), tracker(tracker),
+		funcsToOptimize(), changedFuncs(), vuv(), dua(), uda(),
 		ducs(), udcs(), globalVars(module->getGlobalVars()),
 		toEntirelyRemoveStmts(), toRemoveStmtsPreserveCalls(), modifiedStmts(),
 		codeChanged(false) {
@@ -198,15 +249,35 @@ void CopyPropagationOptimizer::doOptimization() {
 	// surprisingly speeds up the optimization).
 	va->clearCache();
 	va->initAliasAnalysis(module);
-	cio->init(CGBuilder::getCG(module), va);
-	vuv = VarUsesVisitor::create(va, true, module);
+	ShPtr<CG> cg(CGBuilder::getCG(module));
+	funcsToOptimize = getFuncsToOptimize(cg);
+	if (funcsToOptimize.empty()) {
+		return;
+	}
+	cio->init(cg, va);
+	vuv = VarUsesVisitor::create(va, true, module, funcsToOptimize);
 	dua = DefUseAnalysis::create(module, va, vuv);
 	uda = UseDefAnalysis::create(module);
+	changedFuncs.clear();
 
 	FuncOptimizer::doOptimization();
+
+	if (tracker) {
+		// The optimized functions cannot be optimized any further unless they
+		// or their callees change. However, callers of functions changed in
+		// this run may be optimized further in the next run.
+		FuncSet funcsToReoptimize(getCallersOf(changedFuncs, cg));
+		tracker->markAsUpToDate(setDifference(funcsToOptimize,
+			funcsToReoptimize));
+		tracker->markAsChanged(funcsToReoptimize);
+	}
 }
 
 void CopyPropagationOptimizer::runOnFunction(ShPtr<Function> func) {
+	if (!hasItem(funcsToOptimize, func)) {
+		return;
+	}
+
 	// Keep optimizing until there are no changes.
 	do {
 		ducs = dua->getDefUseChains(
@@ -219,9 +290,31 @@ void CopyPropagationOptimizer::runOnFunction(ShPtr<Function> func) {
 		udcs = uda->getUseDefChains(func, ducs);
 		codeChanged = false;
 		performOptimization();
+		if (codeChanged) {
+			changedFuncs.insert(func);
+		}
 	} while (codeChanged);
 }
 
+/**
+* @brief Returns function definitions that should be optimized in this run.
+*
+* Without a tracker, all function definitions are optimized. Otherwise, only
+* functions that have changed since the previous run and functions calling them
+* are optimized.
+*/
+FuncSet CopyPropagationOptimizer::getFuncsToOptimize(ShPtr<CG> cg) const {
+	FuncSet funcs(module->func_definition_begin(),
+		module->func_definition_end());
+	if (!tracker) {
+		return funcs;
+	}
+
+	FuncSet outdatedFuncs(tracker->getChangedFuncs());
+	addToSet(getCallersOf(outdatedFuncs, cg), outdatedFuncs);
+	return setIntersection(funcs, outdatedFuncs);
+}
+
 /**
 * @brief Performs the copy propagation optimization.
 *
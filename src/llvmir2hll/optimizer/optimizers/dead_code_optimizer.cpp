@@ -44,7 +44,7 @@ DeadCodeOptimizer::DeadCodeOptimizer(ShPtr<Module> module,
 */
 DeadCodeOptimizer::~DeadCodeOptimizer() {}
 
-void DeadCodeOptimizer::visit(ShPtr<IfStmt> stmt) {
+void DeadCodeOptimizer::visit(const ShPtr<IfStmt> &stmt) {
 	FuncOptimizer::visit(stmt);
 
 	tryToOptimizeIfStmt(stmt);
@@ -225,7 +225,7 @@ void DeadCodeOptimizer::correctIfStmtDueToPresenceOfFalseClauses(
 	}
 }
 
-void DeadCodeOptimizer::visit(ShPtr<SwitchStmt> stmt) {
+void DeadCodeOptimizer::visit(const ShPtr<SwitchStmt> &stmt) {
 	FuncOptimizer::visit(stmt);
 
 	tryToOptimizeSwitchStmt(stmt);
@@ -386,7 +386,7 @@ void DeadCodeOptimizer::optimizeSwitchStmt(ShPtr<SwitchStmt> stmt,
 	}
 }
 
-void DeadCodeOptimizer::visit(ShPtr<WhileLoopStmt> stmt) {
+void DeadCodeOptimizer::visit(const ShPtr<WhileLoopStmt> &stmt) {
 	FuncOptimizer::visit(stmt);
 
 	tryToOptimizeWhileLoopStmt(stmt);
@@ -416,7 +416,7 @@ void DeadCodeOptimizer::tryToOptimizeWhileLoopStmt(ShPtr<WhileLoopStmt> stmt) {
 	}
 }
 
-void DeadCodeOptimizer::visit(ShPtr<ForLoopStmt> stmt) {
+void DeadCodeOptimizer::visit(const ShPtr<ForLoopStmt> &stmt) {
 	FuncOptimizer::visit(stmt);
 
 	tryToOptimizeForLoopStmt(stmt);
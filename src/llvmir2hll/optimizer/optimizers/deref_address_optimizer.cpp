@@ -30,7 +30,7 @@ DerefAddressOptimizer::DerefAddressOptimizer(ShPtr<Module> module):
 */
 DerefAddressOptimizer::~DerefAddressOptimizer() {}
 
-void DerefAddressOptimizer::visit(ShPtr<DerefOpExpr> expr) {
+void DerefAddressOptimizer::visit(const ShPtr<DerefOpExpr> &expr) {
 	expr->getOperand()->accept(this);
 
 	// Check whether we're dereferencing an address operator. If so, then
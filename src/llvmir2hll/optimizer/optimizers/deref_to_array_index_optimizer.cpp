@@ -53,7 +53,7 @@ void DerefToArrayIndexOptimizer::doOptimization() {
 	}
 }
 
-void DerefToArrayIndexOptimizer::visit(ShPtr<DerefOpExpr> expr) {
+void DerefToArrayIndexOptimizer::visit(const ShPtr<DerefOpExpr> &expr) {
 	// First, visit (and possibly optimize) nested expressions.
 	Optimizer::visit(expr);
 
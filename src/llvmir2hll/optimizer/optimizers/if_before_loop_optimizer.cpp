@@ -41,6 +41,13 @@ IfBeforeLoopOptimizer::IfBeforeLoopOptimizer(ShPtr<Module> module,
 */
 IfBeforeLoopOptimizer::~IfBeforeLoopOptimizer() {}
 
+/**
+* @brief Optimizes all functions in the module.
+*
+* When functions are optimized in parallel, this function is not called.
+* OptimizerManager then clears and invalidates the value analysis itself (see
+* @c FUNC_LOCAL_OPTS in optimizer_manager.cpp).
+*/
 void IfBeforeLoopOptimizer::doOptimization() {
 	if (!va->isInValidState()) {
 		va->clearCache();
@@ -54,7 +61,7 @@ void IfBeforeLoopOptimizer::doOptimization() {
 	va->invalidateState();
 }
 
-void IfBeforeLoopOptimizer::visit(ShPtr<IfStmt> stmt) {
+void IfBeforeLoopOptimizer::visit(const ShPtr<IfStmt> &stmt) {
 	// First of all, visit nested and subsequent statements.
 	FuncOptimizer::visit(stmt);
 
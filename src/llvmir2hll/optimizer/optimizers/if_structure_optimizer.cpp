@@ -47,7 +47,7 @@ IfStructureOptimizer::IfStructureOptimizer(ShPtr<Module> module):
 */
 IfStructureOptimizer::~IfStructureOptimizer() {}
 
-void IfStructureOptimizer::visit(ShPtr<IfStmt> stmt) {
+void IfStructureOptimizer::visit(const ShPtr<IfStmt> &stmt) {
 	// First of all, visit nested and subsequent statements.
 	FuncOptimizer::visit(stmt);
 
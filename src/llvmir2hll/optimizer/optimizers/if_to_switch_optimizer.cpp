@@ -41,7 +41,7 @@ IfToSwitchOptimizer::IfToSwitchOptimizer(ShPtr<Module> module,
 */
 IfToSwitchOptimizer::~IfToSwitchOptimizer() {}
 
-void IfToSwitchOptimizer::visit(ShPtr<IfStmt> stmt) {
+void IfToSwitchOptimizer::visit(const ShPtr<IfStmt> &stmt) {
 	ShPtr<Expression> controlExpr(getControlExprIfConvertibleToSwitch(stmt));
 	if (!controlExpr) {
 		return;
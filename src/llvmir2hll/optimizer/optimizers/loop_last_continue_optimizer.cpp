@@ -31,13 +31,13 @@ LoopLastContinueOptimizer::LoopLastContinueOptimizer(ShPtr<Module> module):
 */
 LoopLastContinueOptimizer::~LoopLastContinueOptimizer() {}
 
-void LoopLastContinueOptimizer::visit(ShPtr<ForLoopStmt> stmt) {
+void LoopLastContinueOptimizer::visit(const ShPtr<ForLoopStmt> &stmt) {
 	tryToOptimize(stmt);
 
 	FuncOptimizer::visit(stmt);
 }
 
-void LoopLastContinueOptimizer::visit(ShPtr<WhileLoopStmt> stmt) {
+void LoopLastContinueOptimizer::visit(const ShPtr<WhileLoopStmt> &stmt) {
 	tryToOptimize(stmt);
 
 	FuncOptimizer::visit(stmt);
@@ -29,7 +29,7 @@ NoInitVarDefOptimizer::NoInitVarDefOptimizer(ShPtr<Module> module):
 */
 NoInitVarDefOptimizer::~NoInitVarDefOptimizer() {}
 
-void NoInitVarDefOptimizer::visit(ShPtr<VarDefStmt> stmt) {
+void NoInitVarDefOptimizer::visit(const ShPtr<VarDefStmt> &stmt) {
 	if (stmt->hasInitializer()) {
 		// There is an initializer, so keep traversing.
 		visitStmt(stmt->getSuccessor());
@@ -34,7 +34,7 @@ RemoveUselessCastsOptimizer::RemoveUselessCastsOptimizer(ShPtr<Module> module):
 */
 RemoveUselessCastsOptimizer::~RemoveUselessCastsOptimizer() {}
 
-void RemoveUselessCastsOptimizer::visit(ShPtr<AssignStmt> stmt) {
+void RemoveUselessCastsOptimizer::visit(const ShPtr<AssignStmt> &stmt) {
 	if (tryOptimizationCase1(stmt)) {
 		return;
 	}
@@ -30,7 +30,7 @@ SelfAssignOptimizer::SelfAssignOptimizer(ShPtr<Module> module):
 */
 SelfAssignOptimizer::~SelfAssignOptimizer() {}
 
-void SelfAssignOptimizer::visit(ShPtr<AssignStmt> stmt) {
+void SelfAssignOptimizer::visit(const ShPtr<AssignStmt> &stmt) {
 	// First, visit the successor so that when there is a list of self
 	// assignments, they are all properly removed.
 	visitStmt(stmt->getSuccessor());
@@ -46,7 +46,7 @@ std::string ChangeOrderOfOperandsSubOptimizer::getId() const {
 	return CHANGE_ORDER_OF_OPERANDS_SUB_OPTIMIZER_ID;
 }
 
-void ChangeOrderOfOperandsSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
+void ChangeOrderOfOperandsSubOptimizer::visit(const ShPtr<MulOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	// Optimization like "a * 3(ConstInt/ConstFloat)" -> optimized to "3 * a".
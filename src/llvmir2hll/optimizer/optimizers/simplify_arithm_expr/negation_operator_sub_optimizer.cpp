@@ -47,7 +47,7 @@ std::string NegationOperatorSubOptimizer::getId() const {
 	return NEGATION_OPERATOR_SUB_OPTIMIZER_ID;
 }
 
-void NegationOperatorSubOptimizer::visit(ShPtr<NotOpExpr> expr) {
+void NegationOperatorSubOptimizer::visit(const ShPtr<NotOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	ShPtr<Expression> negatedExpr(ExpressionNegater::negate(expr->getOperand()));
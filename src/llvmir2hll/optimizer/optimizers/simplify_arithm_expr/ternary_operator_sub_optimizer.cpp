@@ -47,7 +47,7 @@ std::string TernaryOperatorSubOptimizer::getId() const {
 	return TERNARY_OPERATOR_SUB_OPTIMIZER_ID;
 }
 
-void TernaryOperatorSubOptimizer::visit(ShPtr<TernaryOpExpr> expr) {
+void TernaryOperatorSubOptimizer::visit(const ShPtr<TernaryOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	ShPtr<ConstBool> constBool(cast<ConstBool>(expr->getCondition()));
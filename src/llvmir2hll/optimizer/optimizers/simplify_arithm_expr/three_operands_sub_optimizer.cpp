@@ -75,7 +75,7 @@ std::string ThreeOperandsSubOptimizer::getId() const {
 	return OP_OPER_OP_OPER_OP_SUB_OPTIMIZER_ID;
 }
 
-void ThreeOperandsSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
+void ThreeOperandsSubOptimizer::visit(const ShPtr<AddOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	// Optimizations dependent on the first Constant operand or on the second
@@ -198,7 +198,7 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 	}
 }
 
-void ThreeOperandsSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
+void ThreeOperandsSubOptimizer::visit(const ShPtr<SubOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	// Optimizations dependent on the first Constant operand.
@@ -379,7 +379,7 @@ bool ThreeOperandsSubOptimizer::analyzeOpOperOp(ShPtr<Expression> &constant,
 	return true;
 }
 
-void ThreeOperandsSubOptimizer::visit(ShPtr<LtOpExpr> expr) {
+void ThreeOperandsSubOptimizer::visit(const ShPtr<LtOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
@@ -388,7 +388,7 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<LtOpExpr> expr) {
 	}
 }
 
-void ThreeOperandsSubOptimizer::visit(ShPtr<LtEqOpExpr> expr) {
+void ThreeOperandsSubOptimizer::visit(const ShPtr<LtEqOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
@@ -397,7 +397,7 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<LtEqOpExpr> expr) {
 	}
 }
 
-void ThreeOperandsSubOptimizer::visit(ShPtr<GtOpExpr> expr) {
+void ThreeOperandsSubOptimizer::visit(const ShPtr<GtOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
@@ -406,7 +406,7 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<GtOpExpr> expr) {
 	}
 }
 
-void ThreeOperandsSubOptimizer::visit(ShPtr<GtEqOpExpr> expr) {
+void ThreeOperandsSubOptimizer::visit(const ShPtr<GtEqOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
@@ -415,7 +415,7 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<GtEqOpExpr> expr) {
 	}
 }
 
-void ThreeOperandsSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
+void ThreeOperandsSubOptimizer::visit(const ShPtr<EqOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
@@ -424,7 +424,7 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
 	}
 }
 
-void ThreeOperandsSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
+void ThreeOperandsSubOptimizer::visit(const ShPtr<NeqOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	Maybe<ExprPair> exprPair(tryOptimizeExpressionWithRelationalOperator(expr));
@@ -433,13 +433,13 @@ void ThreeOperandsSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
 	}
 }
 
-void ThreeOperandsSubOptimizer::visit(ShPtr<BitXorOpExpr> expr) {
+void ThreeOperandsSubOptimizer::visit(const ShPtr<BitXorOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	tryOptimizeBitXorOpWithRelationalOperator(expr);
 }
 
-void ThreeOperandsSubOptimizer::visit(ShPtr<OrOpExpr> expr) {
+void ThreeOperandsSubOptimizer::visit(const ShPtr<OrOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	tryOptimizeOrOpExprWithRelOperators(expr);
@@ -55,7 +55,7 @@ std::string ZeroSubOptimizer::getId() const {
 	return ZERO_SUB_OPTIMIZER_ID;
 }
 
-void ZeroSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
+void ZeroSubOptimizer::visit(const ShPtr<AddOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (isOpZero(expr->getFirstOperand())) {
@@ -67,7 +67,7 @@ void ZeroSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 	}
 }
 
-void ZeroSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
+void ZeroSubOptimizer::visit(const ShPtr<SubOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	ShPtr<ConstInt> secOpConstInt(cast<ConstInt>(expr->getSecondOperand()));
@@ -104,7 +104,7 @@ void ZeroSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
 	}
 }
 
-void ZeroSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
+void ZeroSubOptimizer::visit(const ShPtr<MulOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (isOpZero(expr->getFirstOperand())) {
@@ -116,7 +116,7 @@ void ZeroSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
 	}
 }
 
-void ZeroSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
+void ZeroSubOptimizer::visit(const ShPtr<DivOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (isOpZero(expr->getFirstOperand())) {
@@ -125,7 +125,7 @@ void ZeroSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
 	}
 }
 
-void ZeroSubOptimizer::visit(ShPtr<ModOpExpr> expr) {
+void ZeroSubOptimizer::visit(const ShPtr<ModOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (isOpZero(expr->getFirstOperand())) {
@@ -134,7 +134,7 @@ void ZeroSubOptimizer::visit(ShPtr<ModOpExpr> expr) {
 	}
 }
 
-void ZeroSubOptimizer::visit(ShPtr<BitAndOpExpr> expr) {
+void ZeroSubOptimizer::visit(const ShPtr<BitAndOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (isConstIntZero(expr->getFirstOperand())) {
@@ -146,7 +146,7 @@ void ZeroSubOptimizer::visit(ShPtr<BitAndOpExpr> expr) {
 	}
 }
 
-void ZeroSubOptimizer::visit(ShPtr<BitOrOpExpr> expr) {
+void ZeroSubOptimizer::visit(const ShPtr<BitOrOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (isConstIntZero(expr->getFirstOperand())) {
@@ -159,7 +159,7 @@ void ZeroSubOptimizer::visit(ShPtr<BitOrOpExpr> expr) {
 
 }
 
-void ZeroSubOptimizer::visit(ShPtr<BitXorOpExpr> expr) {
+void ZeroSubOptimizer::visit(const ShPtr<BitXorOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	if (isConstIntZero(expr->getFirstOperand())) {
@@ -53,6 +53,13 @@ VarDefStmtOptimizer::VarDefStmtOptimizer(ShPtr<Module> module,
 */
 VarDefStmtOptimizer::~VarDefStmtOptimizer() {}
 
+/**
+* @brief Optimizes all functions in the module.
+*
+* Only the cache of the value analysis is cleared here, so it is safe that
+* OptimizerManager skips this function when optimizing functions in parallel;
+* it clears the cache of every thread's value analysis before each function.
+*/
 void VarDefStmtOptimizer::doOptimization() {
 	// Clear the cache of va because other optimizations may have left it in an
 	// invalid state.
@@ -55,6 +55,13 @@ WhileTrueToForLoopOptimizer::WhileTrueToForLoopOptimizer(ShPtr<Module> module,
 */
 WhileTrueToForLoopOptimizer::~WhileTrueToForLoopOptimizer() {}
 
+/**
+* @brief Optimizes all functions in the module.
+*
+* This function only prepares and invalidates the value analysis around the
+* optimization of all functions. OptimizerManager does the same when it
+* optimizes functions in parallel without calling it.
+*/
 void WhileTrueToForLoopOptimizer::doOptimization() {
 	if (!va->isInValidState()) {
 		va->clearCache();
@@ -69,7 +76,7 @@ void WhileTrueToForLoopOptimizer::doOptimization() {
 	va->invalidateState();
 }
 
-void WhileTrueToForLoopOptimizer::visit(ShPtr<WhileLoopStmt> stmt) {
+void WhileTrueToForLoopOptimizer::visit(const ShPtr<WhileLoopStmt> &stmt) {
 	// First of all, visit nested and subsequent statements.
 	FuncOptimizer::visit(stmt);
 
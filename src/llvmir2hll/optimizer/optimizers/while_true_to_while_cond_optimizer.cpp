@@ -41,7 +41,7 @@ WhileTrueToWhileCondOptimizer::WhileTrueToWhileCondOptimizer(ShPtr<Module> modul
 */
 WhileTrueToWhileCondOptimizer::~WhileTrueToWhileCondOptimizer() {}
 
-void WhileTrueToWhileCondOptimizer::visit(ShPtr<WhileLoopStmt> stmt) {
+void WhileTrueToWhileCondOptimizer::visit(const ShPtr<WhileLoopStmt> &stmt) {
 	// First of all, visit nested and subsequent statements.
 	FuncOptimizer::visit(stmt);
 
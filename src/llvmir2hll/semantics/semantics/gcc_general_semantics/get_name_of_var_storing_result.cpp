@@ -16,8 +16,8 @@ namespace gcc_general {
 namespace {
 
 /**
-* @brief This function is used to initialize FUNC_VAR_NAME_MAP later in the
-*        file.
+* @brief This function is used to initialize the mapping returned by
+*        getFuncVarNameMap().
 */
 const StringStringUMap &initFuncVarNameMap() {
 	static StringStringUMap m;
@@ -41,8 +41,17 @@ const StringStringUMap &initFuncVarNameMap() {
 	return m;
 }
 
-/// Mapping of function names to their corresponding names of variables.
-const StringStringUMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
+/**
+* @brief Returns a mapping of function names to their corresponding names of
+*        variables.
+*
+* The mapping is initialized upon the first call rather than when the
+* decompiler starts.
+*/
+const StringStringUMap &getFuncVarNameMap() {
+	static const StringStringUMap &funcVarNameMap(initFuncVarNameMap());
+	return funcVarNameMap;
+}
 
 } // anonymous namespace
 
@@ -52,7 +61,7 @@ const StringStringUMap &FUNC_VAR_NAME_MAP(initFuncVarNameMap());
 * See its description for more details.
 */
 Maybe<std::string> getNameOfVarStoringResult(const std::string &funcName) {
-	return getNameOfVarStoringResultFromMap(funcName, FUNC_VAR_NAME_MAP);
+	return getNameOfVarStoringResultFromMap(funcName, getFuncVarNameMap());
 }
 
 } // namespace gcc_general
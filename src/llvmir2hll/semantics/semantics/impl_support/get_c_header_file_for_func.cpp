@@ -4,6 +4,9 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+#include <cstring>
+
 #include "retdec/llvmir2hll/semantics/semantics/impl_support/get_c_header_file_for_func.h"
 
 namespace retdec {
@@ -11,12 +14,18 @@ namespace llvmir2hll {
 namespace semantics {
 
 /**
-* @brief Returns the header name for the given function from the given map.
+* @brief Returns the header name for the given function from the given sorted
+*        table <tt>[begin, end)</tt>.
 */
-Maybe<std::string> getCHeaderFileForFuncFromMap(const std::string &funcName,
-		const StringStringUMap &map) {
-	auto i = map.find(funcName);
-	return i != map.end() ? Just(i->second) : Nothing<std::string>();
+Maybe<std::string> getCHeaderFileForFuncFromTable(const std::string &funcName,
+		const FuncCHeader *begin, const FuncCHeader *end) {
+	auto i = std::lower_bound(begin, end, funcName.c_str(),
+		[](const FuncCHeader &entry, const char *funcName) {
+			return std::strcmp(entry.funcName, funcName) < 0;
+		}
+	);
+	return i != end && funcName == i->funcName ?
+		Just(std::string(i->header)) : Nothing<std::string>();
 }
 
 } // namespace semantics
@@ -4,6 +4,9 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
+#include <cstring>
+
 #include "retdec/llvmir2hll/semantics/semantics/impl_support/get_name_of_param.h"
 
 namespace retdec {
@@ -11,13 +14,18 @@ namespace llvmir2hll {
 namespace semantics {
 
 /**
-* @brief Returns the name of the given parameter from the given map.
+* @brief Returns the name of the given parameter from the given sorted table.
 */
-Maybe<std::string> getNameOfParamFromMap(const std::string &funcName,
-		unsigned paramPos, const FuncParamNamesMap &map) {
-	auto funcParamIter = map.find(FuncParamPosPair(funcName, paramPos));
-	return funcParamIter != map.end() ?
-		Just(funcParamIter->second) : Nothing<std::string>();
+Maybe<std::string> getNameOfParamFromTable(const std::string &funcName,
+		unsigned paramPos, const FuncParamNamesTable &table) {
+	auto i = std::lower_bound(table.begin, table.end, funcName.c_str(),
+		[paramPos](const FuncParamName &entry, const char *funcName) {
+			int result = std::strcmp(entry.funcName, funcName);
+			return result < 0 || (result == 0 && entry.paramPos < paramPos);
+		}
+	);
+	return i != table.end && funcName == i->funcName && i->paramPos == paramPos ?
+		Just(std::string(i->paramName)) : Nothing<std::string>();
 }
 
 } // namespace semantics
@@ -43,60 +43,52 @@ namespace win_api {
 
 namespace {
 
-/**
-* @brief This function is used to initialize FUNC_PARAM_NAMES_MAP later in the
-*        file.
-*/
-const FuncParamNamesMap &initFuncParamNamesMap() {
-	static FuncParamNamesMap funcParamNamesMap;
-
-	//
-	// The base of the information for this type of semantics has been obtained
-	// by using the
-	// scripts/backend/semantics/func_var_names/gen_winapi_semantics_from_includes.py
-	// script with includes mingw32-x86-pe/i686-w64-mingw32/includes/win*.h.
-	// The resulting semantics has been updated manually. Useless mappings have
-	// been commented out.
-	//
+//
+// The base of the information for this type of semantics has been obtained
+// by using the
+// scripts/backend/semantics/func_var_names/gen_winapi_semantics_from_includes.py
+// script with includes mingw32-x86-pe/i686-w64-mingw32/includes/win*.h.
+// The resulting semantics has been updated manually. Useless mappings have
+// been commented out.
+//
+// To keep the modules of a reasonable size, the tables are split into several
+// modules by the first letters of the names of functions.
+//
 
-	// Since having 10 000 lines in a single file was found impossible to
-	// compile by using gcc in a reasonable amount of time and memory (even
-	// using -fno-var-tracking), we had to split the initialization into
-	// several modules.
-	initFuncParamNamesMap_A(funcParamNamesMap);
-	initFuncParamNamesMap_B(funcParamNamesMap);
-	initFuncParamNamesMap_C1(funcParamNamesMap);
-	initFuncParamNamesMap_C2(funcParamNamesMap);
-	initFuncParamNamesMap_D(funcParamNamesMap);
-	initFuncParamNamesMap_E(funcParamNamesMap);
-	initFuncParamNamesMap_F(funcParamNamesMap);
-	initFuncParamNamesMap_G1(funcParamNamesMap);
-	initFuncParamNamesMap_G2(funcParamNamesMap);
-	initFuncParamNamesMap_H(funcParamNamesMap);
-	initFuncParamNamesMap_I(funcParamNamesMap);
-	initFuncParamNamesMap_J(funcParamNamesMap);
-	initFuncParamNamesMap_K(funcParamNamesMap);
-	initFuncParamNamesMap_L(funcParamNamesMap);
-	initFuncParamNamesMap_M(funcParamNamesMap);
-	initFuncParamNamesMap_N(funcParamNamesMap);
-	initFuncParamNamesMap_O(funcParamNamesMap);
-	initFuncParamNamesMap_P(funcParamNamesMap);
-	initFuncParamNamesMap_Q(funcParamNamesMap);
-	initFuncParamNamesMap_R(funcParamNamesMap);
-	initFuncParamNamesMap_S(funcParamNamesMap);
-	initFuncParamNamesMap_T(funcParamNamesMap);
-	initFuncParamNamesMap_U(funcParamNamesMap);
-	initFuncParamNamesMap_V(funcParamNamesMap);
-	initFuncParamNamesMap_W(funcParamNamesMap);
-	initFuncParamNamesMap_X(funcParamNamesMap);
-	initFuncParamNamesMap_Y(funcParamNamesMap);
-	initFuncParamNamesMap_Z(funcParamNamesMap);
-
-	return funcParamNamesMap;
-}
+/// A function returning a table of parameter names.
+using FuncParamNamesTableGetter = FuncParamNamesTable (*)();
 
-/// Mapping of function parameter positions into the names of parameters.
-const FuncParamNamesMap &FUNC_PARAM_NAMES_MAP(initFuncParamNamesMap());
+/// Getters of all the tables of parameter names.
+const FuncParamNamesTableGetter FUNC_PARAM_NAMES_TABLE_GETTERS[] = {
+	&getFuncParamNamesTable_A,
+	&getFuncParamNamesTable_B,
+	&getFuncParamNamesTable_C1,
+	&getFuncParamNamesTable_C2,
+	&getFuncParamNamesTable_D,
+	&getFuncParamNamesTable_E,
+	&getFuncParamNamesTable_F,
+	&getFuncParamNamesTable_G1,
+	&getFuncParamNamesTable_G2,
+	&getFuncParamNamesTable_H,
+	&getFuncParamNamesTable_I,
+	&getFuncParamNamesTable_J,
+	&getFuncParamNamesTable_K,
+	&getFuncParamNamesTable_L,
+	&getFuncParamNamesTable_M,
+	&getFuncParamNamesTable_N,
+	&getFuncParamNamesTable_O,
+	&getFuncParamNamesTable_P,
+	&getFuncParamNamesTable_Q,
+	&getFuncParamNamesTable_R,
+	&getFuncParamNamesTable_S,
+	&getFuncParamNamesTable_T,
+	&getFuncParamNamesTable_U,
+	&getFuncParamNamesTable_V,
+	&getFuncParamNamesTable_W,
+	&getFuncParamNamesTable_X,
+	&getFuncParamNamesTable_Y,
+	&getFuncParamNamesTable_Z,
+};
 
 } // anonymous namespace
 
@@ -107,7 +99,24 @@ const FuncParamNamesMap &FUNC_PARAM_NAMES_MAP(initFuncParamNamesMap());
 */
 Maybe<std::string> getNameOfParam(const std::string &funcName,
 		unsigned paramPos) {
-	return getNameOfParamFromMap(funcName, paramPos, FUNC_PARAM_NAMES_MAP);
+	for (auto getTable : FUNC_PARAM_NAMES_TABLE_GETTERS) {
+		auto paramName = getNameOfParamFromTable(funcName, paramPos, getTable());
+		if (paramName) {
+			return paramName;
+		}
+	}
+	return Nothing<std::string>();
+}
+
+/**
+* @brief Returns all the tables searched by getNameOfParam().
+*/
+std::vector<FuncParamNamesTable> getFuncParamNamesTables() {
+	std::vector<FuncParamNamesTable> tables;
+	for (auto getTable : FUNC_PARAM_NAMES_TABLE_GETTERS) {
+		tables.push_back(getTable());
+	}
+	return tables;
 }
 
 } // namespace win_api
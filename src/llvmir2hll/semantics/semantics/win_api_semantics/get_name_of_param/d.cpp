@@ -1,6 +1,6 @@
 /**
 * @file src/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/d.cpp
-* @brief Implementation of the initialization of WinAPI functions.
+* @brief Names of parameters of WinAPI functions.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -11,519 +11,525 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
+/// Names of parameters of functions from windows.h.
+constexpr FuncParamName FUNC_PARAM_NAMES_TABLE[] = {
+	{"DPtoLP", 1, "hdc"}, // HDC
+	{"DPtoLP", 2, "lppt"}, // LPPOINT
+	{"DPtoLP", 3, "c"}, // int
+	{"DeactivateActCtx", 1, "dwFlags"}, // DWORD
+	{"DeactivateActCtx", 2, "ulCookie"}, // ULONG_PTR
+	{"DebugActiveProcess", 1, "dwProcessId"}, // DWORD
+	{"DebugActiveProcessStop", 1, "dwProcessId"}, // DWORD
+	{"DebugBreakProcess", 1, "Process"}, // HANDLE
+	{"DebugSetProcessKillOnExit", 1, "KillOnExit"}, // WINBOOL
+	{"DecodePointer", 1, "Ptr"}, // PVOID
+	{"DecodeSystemPointer", 1, "Ptr"}, // PVOID
+	{"DecryptFileA", 1, "lpFileName"}, // LPCSTR
+	{"DecryptFileA", 2, "dwReserved"}, // DWORD
+	{"DecryptFileW", 1, "lpFileName"}, // LPCWSTR
+	{"DecryptFileW", 2, "dwReserved"}, // DWORD
+	{"DefDlgProcA", 1, "hDlg"}, // HWND
+	{"DefDlgProcA", 2, "Msg"}, // UINT
+	{"DefDlgProcA", 3, "wParam"}, // WPARAM
+	{"DefDlgProcA", 4, "lParam"}, // LPARAM
+	{"DefDlgProcW", 1, "hDlg"}, // HWND
+	{"DefDlgProcW", 2, "Msg"}, // UINT
+	{"DefDlgProcW", 3, "wParam"}, // WPARAM
+	{"DefDlgProcW", 4, "lParam"}, // LPARAM
+	{"DefFrameProcA", 1, "hWnd"}, // HWND
+	{"DefFrameProcA", 2, "hWndMDIClient"}, // HWND
+	{"DefFrameProcA", 3, "uMsg"}, // UINT
+	{"DefFrameProcA", 4, "wParam"}, // WPARAM
+	{"DefFrameProcA", 5, "lParam"}, // LPARAM
+	{"DefFrameProcW", 1, "hWnd"}, // HWND
+	{"DefFrameProcW", 2, "hWndMDIClient"}, // HWND
+	{"DefFrameProcW", 3, "uMsg"}, // UINT
+	{"DefFrameProcW", 4, "wParam"}, // WPARAM
+	{"DefFrameProcW", 5, "lParam"}, // LPARAM
+	{"DefMDIChildProcA", 1, "hWnd"}, // HWND
+	{"DefMDIChildProcA", 2, "uMsg"}, // UINT
+	{"DefMDIChildProcA", 3, "wParam"}, // WPARAM
+	{"DefMDIChildProcA", 4, "lParam"}, // LPARAM
+	{"DefMDIChildProcW", 1, "hWnd"}, // HWND
+	{"DefMDIChildProcW", 2, "uMsg"}, // UINT
+	{"DefMDIChildProcW", 3, "wParam"}, // WPARAM
+	{"DefMDIChildProcW", 4, "lParam"}, // LPARAM
+	{"DefRawInputProc", 1, "paRawInput"}, // PRAWINPUT *
+	{"DefRawInputProc", 2, "nInput"}, // INT
+	{"DefRawInputProc", 3, "cbSizeHeader"}, // UINT
+	{"DefWindowProcA", 1, "hWnd"}, // HWND
+	{"DefWindowProcA", 2, "Msg"}, // UINT
+	{"DefWindowProcA", 3, "wParam"}, // WPARAM
+	{"DefWindowProcA", 4, "lParam"}, // LPARAM
+	{"DefWindowProcW", 1, "hWnd"}, // HWND
+	{"DefWindowProcW", 2, "Msg"}, // UINT
+	{"DefWindowProcW", 3, "wParam"}, // WPARAM
+	{"DefWindowProcW", 4, "lParam"}, // LPARAM
+	{"DeferWindowPos", 1, "hWinPosInfo"}, // HDWP
+	{"DeferWindowPos", 2, "hWnd"}, // HWND
+	{"DeferWindowPos", 3, "hWndInsertAfter"}, // HWND
+	{"DeferWindowPos", 4, "x"}, // int
+	{"DeferWindowPos", 5, "y"}, // int
+	{"DeferWindowPos", 6, "cx"}, // int
+	{"DeferWindowPos", 7, "cy"}, // int
+	{"DeferWindowPos", 8, "uFlags"}, // UINT
+	{"DefineDosDeviceA", 1, "dwFlags"}, // DWORD
+	{"DefineDosDeviceA", 2, "lpDeviceName"}, // LPCSTR
+	{"DefineDosDeviceA", 3, "lpTargetPath"}, // LPCSTR
+	{"DefineDosDeviceW", 1, "dwFlags"}, // DWORD
+	{"DefineDosDeviceW", 2, "lpDeviceName"}, // LPCWSTR
+	{"DefineDosDeviceW", 3, "lpTargetPath"}, // LPCWSTR
+	{"DeleteAce", 1, "pAcl"}, // PACL
+	{"DeleteAce", 2, "dwAceIndex"}, // DWORD
+	{"DeleteAtom", 1, "nAtom"}, // ATOM
+	{"DeleteBoundaryDescriptor", 1, "BoundaryDescriptor"}, // HANDLE
+	{"DeleteColorSpace", 1, "hcs"}, // HCOLORSPACE
+	{"DeleteCriticalSection", 1, "lpCriticalSection"}, // LPCRITICAL_SECTION
+	{"DeleteDC", 1, "hdc"}, // HDC
+	{"DeleteEnhMetaFile", 1, "hmf"}, // HENHMETAFILE
+	{"DeleteFiber", 1, "lpFiber"}, // LPVOID
+	{"DeleteFileA", 1, "lpFileName"}, // LPCSTR
+	{"DeleteFileTransactedA", 1, "lpFileName"}, // LPCSTR
+	{"DeleteFileTransactedA", 2, "hTransaction"}, // HANDLE
+	{"DeleteFileTransactedW", 1, "lpFileName"}, // LPCWSTR
+	{"DeleteFileTransactedW", 2, "hTransaction"}, // HANDLE
+	{"DeleteFileW", 1, "lpFileName"}, // LPCWSTR
+	{"DeleteFormA", 1, "hPrinter"}, // HANDLE
+	{"DeleteFormA", 2, "pFormName"}, // LPSTR
+	{"DeleteFormW", 1, "hPrinter"}, // HANDLE
+	{"DeleteFormW", 2, "pFormName"}, // LPWSTR
+	{"DeleteIE3Cache", 1, "hWnd"}, // HWND
+	{"DeleteIE3Cache", 2, "hInst"}, // HINSTANCE
+	{"DeleteIE3Cache", 3, "lpszCmdLine"}, // LPSTR
+	{"DeleteIE3Cache", 4, "nCmdShow"}, // int
+	{"DeleteMenu", 1, "hMenu"}, // HMENU
+	{"DeleteMenu", 2, "uPosition"}, // UINT
+	{"DeleteMenu", 3, "uFlags"}, // UINT
+	{"DeleteMetaFile", 1, "hmf"}, // HMETAFILE
+	{"DeleteMonitorA", 1, "pName"}, // LPSTR
+	{"DeleteMonitorA", 2, "pEnvironment"}, // LPSTR
+	{"DeleteMonitorA", 3, "pMonitorName"}, // LPSTR
+	{"DeleteMonitorW", 1, "pName"}, // LPWSTR
+	{"DeleteMonitorW", 2, "pEnvironment"}, // LPWSTR
+	{"DeleteMonitorW", 3, "pMonitorName"}, // LPWSTR
+	{"DeleteObject", 1, "ho"}, // HGDIOBJ
+	{"DeletePortA", 1, "pName"}, // LPSTR
+	{"DeletePortA", 2, "hWnd"}, // HWND
+	{"DeletePortA", 3, "pPortName"}, // LPSTR
+	{"DeletePortW", 1, "pName"}, // LPWSTR
+	{"DeletePortW", 2, "hWnd"}, // HWND
+	{"DeletePortW", 3, "pPortName"}, // LPWSTR
+	{"DeletePrintProcessorA", 1, "pName"}, // LPSTR
+	{"DeletePrintProcessorA", 2, "pEnvironment"}, // LPSTR
+	{"DeletePrintProcessorA", 3, "pPrintProcessorName"}, // LPSTR
+	{"DeletePrintProcessorW", 1, "pName"}, // LPWSTR
+	{"DeletePrintProcessorW", 2, "pEnvironment"}, // LPWSTR
+	{"DeletePrintProcessorW", 3, "pPrintProcessorName"}, // LPWSTR
+	{"DeletePrintProvidorA", 1, "pName"}, // LPSTR
+	{"DeletePrintProvidorA", 2, "pEnvironment"}, // LPSTR
+	{"DeletePrintProvidorA", 3, "pPrintProvidorName"}, // LPSTR
+	{"DeletePrintProvidorW", 1, "pName"}, // LPWSTR
+	{"DeletePrintProvidorW", 2, "pEnvironment"}, // LPWSTR
+	{"DeletePrintProvidorW", 3, "pPrintProvidorName"}, // LPWSTR
+	{"DeletePrinter", 1, "hPrinter"}, // HANDLE
+	{"DeletePrinterConnectionA", 1, "pName"}, // LPSTR
+	{"DeletePrinterConnectionW", 1, "pName"}, // LPWSTR
+	{"DeletePrinterDataA", 1, "hPrinter"}, // HANDLE
+	{"DeletePrinterDataA", 2, "pValueName"}, // LPSTR
+	{"DeletePrinterDataExA", 1, "hPrinter"}, // HANDLE
+	{"DeletePrinterDataExA", 2, "pKeyName"}, // LPCSTR
+	{"DeletePrinterDataExA", 3, "pValueName"}, // LPCSTR
+	{"DeletePrinterDataExW", 1, "hPrinter"}, // HANDLE
+	{"DeletePrinterDataExW", 2, "pKeyName"}, // LPCWSTR
+	{"DeletePrinterDataExW", 3, "pValueName"}, // LPCWSTR
+	{"DeletePrinterDataW", 1, "hPrinter"}, // HANDLE
+	{"DeletePrinterDataW", 2, "pValueName"}, // LPWSTR
+	{"DeletePrinterDriverA", 1, "pName"}, // LPSTR
+	{"DeletePrinterDriverA", 2, "pEnvironment"}, // LPSTR
+	{"DeletePrinterDriverA", 3, "pDriverName"}, // LPSTR
+	{"DeletePrinterDriverExA", 1, "pName"}, // LPSTR
+	{"DeletePrinterDriverExA", 2, "pEnvironment"}, // LPSTR
+	{"DeletePrinterDriverExA", 3, "pDriverName"}, // LPSTR
+	{"DeletePrinterDriverExA", 4, "dwDeleteFlag"}, // DWORD
+	{"DeletePrinterDriverExA", 5, "dwVersionFlag"}, // DWORD
+	{"DeletePrinterDriverExW", 1, "pName"}, // LPWSTR
+	{"DeletePrinterDriverExW", 2, "pEnvironment"}, // LPWSTR
+	{"DeletePrinterDriverExW", 3, "pDriverName"}, // LPWSTR
+	{"DeletePrinterDriverExW", 4, "dwDeleteFlag"}, // DWORD
+	{"DeletePrinterDriverExW", 5, "dwVersionFlag"}, // DWORD
+	{"DeletePrinterDriverPackageA", 1, "pszServer"}, // LPCSTR
+	{"DeletePrinterDriverPackageA", 2, "pszInfPath"}, // LPCSTR
+	{"DeletePrinterDriverPackageA", 3, "pszEnvironment"}, // LPCSTR
+	{"DeletePrinterDriverPackageW", 1, "pszServer"}, // LPCWSTR
+	{"DeletePrinterDriverPackageW", 2, "pszInfPath"}, // LPCWSTR
+	{"DeletePrinterDriverPackageW", 3, "pszEnvironment"}, // LPCWSTR
+	{"DeletePrinterDriverW", 1, "pName"}, // LPWSTR
+	{"DeletePrinterDriverW", 2, "pEnvironment"}, // LPWSTR
+	{"DeletePrinterDriverW", 3, "pDriverName"}, // LPWSTR
+	{"DeletePrinterIC", 1, "hPrinterIC"}, // HANDLE
+	{"DeletePrinterKeyA", 1, "hPrinter"}, // HANDLE
+	{"DeletePrinterKeyA", 2, "pKeyName"}, // LPCSTR
+	{"DeletePrinterKeyW", 1, "hPrinter"}, // HANDLE
+	{"DeletePrinterKeyW", 2, "pKeyName"}, // LPCWSTR
+	{"DeleteService", 1, "hService"}, // SC_HANDLE
+	{"DeleteTimerQueue", 1, "TimerQueue"}, // HANDLE
+	{"DeleteTimerQueueEx", 1, "TimerQueue"}, // HANDLE
+	{"DeleteTimerQueueEx", 2, "CompletionEvent"}, // HANDLE
+	{"DeleteTimerQueueTimer", 1, "TimerQueue"}, // HANDLE
+	{"DeleteTimerQueueTimer", 2, "Timer"}, // HANDLE
+	{"DeleteTimerQueueTimer", 3, "CompletionEvent"}, // HANDLE
+	{"DeleteVolumeMountPointA", 1, "lpszVolumeMountPoint"}, // LPCSTR
+	{"DeleteVolumeMountPointW", 1, "lpszVolumeMountPoint"}, // LPCWSTR
+	{"DeregisterEventSource", 1, "hEventLog"}, // HANDLE
+	{"DeregisterShellHookWindow", 1, "hWnd"}, // HWND
+	{"DescribePixelFormat", 1, "hdc"}, // HDC
+	{"DescribePixelFormat", 2, "iPixelFormat"}, // int
+	{"DescribePixelFormat", 3, "nBytes"}, // UINT
+	{"DescribePixelFormat", 4, "ppfd"}, // LPPIXELFORMATDESCRIPTOR
+	{"DestroyAcceleratorTable", 1, "hAccel"}, // HACCEL
+	{"DestroyCursor", 1, "hCursor"}, // HCURSOR
+	{"DestroyIcon", 1, "hIcon"}, // HICON
+	{"DestroyMenu", 1, "hMenu"}, // HMENU
+	{"DestroyPrivateObjectSecurity", 1, "ObjectDescriptor"}, // PSECURITY_DESCRIPTOR *
+	{"DestroyThreadpoolEnvironment", 1, "pcbe"}, // PTP_CALLBACK_ENVIRON
+	{"DestroyWindow", 1, "hWnd"}, // HWND
+	{"DevQueryPrint", 1, "hPrinter"}, // HANDLE
+	{"DevQueryPrint", 2, "pDevMode"}, // LPDEVMODEW
+	{"DevQueryPrint", 3, "pResID"}, // DWORD *
+	{"DeviceCapabilitiesA", 1, "pDevice"}, // LPCSTR
+	{"DeviceCapabilitiesA", 2, "pPort"}, // LPCSTR
+	{"DeviceCapabilitiesA", 3, "fwCapability"}, // WORD
+	{"DeviceCapabilitiesA", 4, "pOutput"}, // LPSTR
+	{"DeviceCapabilitiesA", 5, "pDevMode"}, // CONST DEVMODEA *
+	{"DeviceCapabilitiesW", 1, "pDevice"}, // LPCWSTR
+	{"DeviceCapabilitiesW", 2, "pPort"}, // LPCWSTR
+	{"DeviceCapabilitiesW", 3, "fwCapability"}, // WORD
+	{"DeviceCapabilitiesW", 4, "pOutput"}, // LPWSTR
+	{"DeviceCapabilitiesW", 5, "pDevMode"}, // CONST DEVMODEW *
+	{"DeviceIoControl", 1, "hDevice"}, // HANDLE
+	{"DeviceIoControl", 2, "dwIoControlCode"}, // DWORD
+	{"DeviceIoControl", 3, "lpInBuffer"}, // LPVOID
+	{"DeviceIoControl", 4, "nInBufferSize"}, // DWORD
+	{"DeviceIoControl", 5, "lpOutBuffer"}, // LPVOID
+	{"DeviceIoControl", 6, "nOutBufferSize"}, // DWORD
+	{"DeviceIoControl", 7, "lpBytesReturned"}, // LPDWORD
+	{"DeviceIoControl", 8, "lpOverlapped"}, // LPOVERLAPPED
+	{"DialogBoxIndirectParamA", 1, "hInstance"}, // HINSTANCE
+	{"DialogBoxIndirectParamA", 2, "hDialogTemplate"}, // LPCDLGTEMPLATEA
+	{"DialogBoxIndirectParamA", 3, "hWndParent"}, // HWND
+	{"DialogBoxIndirectParamA", 4, "lpDialogFunc"}, // DLGPROC
+	{"DialogBoxIndirectParamA", 5, "dwInitParam"}, // LPARAM
+	{"DialogBoxIndirectParamW", 1, "hInstance"}, // HINSTANCE
+	{"DialogBoxIndirectParamW", 2, "hDialogTemplate"}, // LPCDLGTEMPLATEW
+	{"DialogBoxIndirectParamW", 3, "hWndParent"}, // HWND
+	{"DialogBoxIndirectParamW", 4, "lpDialogFunc"}, // DLGPROC
+	{"DialogBoxIndirectParamW", 5, "dwInitParam"}, // LPARAM
+	{"DialogBoxParamA", 1, "hInstance"}, // HINSTANCE
+	{"DialogBoxParamA", 2, "lpTemplateName"}, // LPCSTR
+	{"DialogBoxParamA", 3, "hWndParent"}, // HWND
+	{"DialogBoxParamA", 4, "lpDialogFunc"}, // DLGPROC
+	{"DialogBoxParamA", 5, "dwInitParam"}, // LPARAM
+	{"DialogBoxParamW", 1, "hInstance"}, // HINSTANCE
+	{"DialogBoxParamW", 2, "lpTemplateName"}, // LPCWSTR
+	{"DialogBoxParamW", 3, "hWndParent"}, // HWND
+	{"DialogBoxParamW", 4, "lpDialogFunc"}, // DLGPROC
+	{"DialogBoxParamW", 5, "dwInitParam"}, // LPARAM
+	{"DisableThreadLibraryCalls", 1, "hLibModule"}, // HMODULE
+	{"DisassociateCurrentThreadFromCallback", 1, "pci"}, // PTP_CALLBACK_INSTANCE
+	{"DisconnectNamedPipe", 1, "hNamedPipe"}, // HANDLE
+	{"DispatchMessageA", 1, "lpMsg"}, // CONST MSG *
+	{"DispatchMessageW", 1, "lpMsg"}, // CONST MSG *
+	{"DlgDirListA", 1, "hDlg"}, // HWND
+	{"DlgDirListA", 2, "lpPathSpec"}, // LPSTR
+	{"DlgDirListA", 3, "nIDListBox"}, // int
+	{"DlgDirListA", 4, "nIDStaticPath"}, // int
+	{"DlgDirListA", 5, "uFileType"}, // UINT
+	{"DlgDirListComboBoxA", 1, "hDlg"}, // HWND
+	{"DlgDirListComboBoxA", 2, "lpPathSpec"}, // LPSTR
+	{"DlgDirListComboBoxA", 3, "nIDComboBox"}, // int
+	{"DlgDirListComboBoxA", 4, "nIDStaticPath"}, // int
+	{"DlgDirListComboBoxA", 5, "uFiletype"}, // UINT
+	{"DlgDirListComboBoxW", 1, "hDlg"}, // HWND
+	{"DlgDirListComboBoxW", 2, "lpPathSpec"}, // LPWSTR
+	{"DlgDirListComboBoxW", 3, "nIDComboBox"}, // int
+	{"DlgDirListComboBoxW", 4, "nIDStaticPath"}, // int
+	{"DlgDirListComboBoxW", 5, "uFiletype"}, // UINT
+	{"DlgDirListW", 1, "hDlg"}, // HWND
+	{"DlgDirListW", 2, "lpPathSpec"}, // LPWSTR
+	{"DlgDirListW", 3, "nIDListBox"}, // int
+	{"DlgDirListW", 4, "nIDStaticPath"}, // int
+	{"DlgDirListW", 5, "uFileType"}, // UINT
+	{"DlgDirSelectComboBoxExA", 1, "hwndDlg"}, // HWND
+	{"DlgDirSelectComboBoxExA", 2, "lpString"}, // LPSTR
+	{"DlgDirSelectComboBoxExA", 3, "cchOut"}, // int
+	{"DlgDirSelectComboBoxExA", 4, "idComboBox"}, // int
+	{"DlgDirSelectComboBoxExW", 1, "hwndDlg"}, // HWND
+	{"DlgDirSelectComboBoxExW", 2, "lpString"}, // LPWSTR
+	{"DlgDirSelectComboBoxExW", 3, "cchOut"}, // int
+	{"DlgDirSelectComboBoxExW", 4, "idComboBox"}, // int
+	{"DlgDirSelectExA", 1, "hwndDlg"}, // HWND
+	{"DlgDirSelectExA", 2, "lpString"}, // LPSTR
+	{"DlgDirSelectExA", 3, "chCount"}, // int
+	{"DlgDirSelectExA", 4, "idListBox"}, // int
+	{"DlgDirSelectExW", 1, "hwndDlg"}, // HWND
+	{"DlgDirSelectExW", 2, "lpString"}, // LPWSTR
+	{"DlgDirSelectExW", 3, "chCount"}, // int
+	{"DlgDirSelectExW", 4, "idListBox"}, // int
+	{"DnsAcquireContextHandle_A", 1, "CredentialFlags"}, // DWORD
+	{"DnsAcquireContextHandle_A", 2, "pCredentials"}, // PVOID
+	{"DnsAcquireContextHandle_A", 3, "pContextHandle"}, // PHANDLE
+	{"DnsAcquireContextHandle_W", 1, "CredentialFlags"}, // DWORD
+	{"DnsAcquireContextHandle_W", 2, "pCredentials"}, // PVOID
+	{"DnsAcquireContextHandle_W", 3, "pContextHandle"}, // PHANDLE
+	{"DnsExtractRecordsFromMessage_UTF8", 1, "pDnsBuffer"}, // PDNS_MESSAGE_BUFFER
+	{"DnsExtractRecordsFromMessage_UTF8", 2, "wMessageLength"}, // WORD
+	{"DnsExtractRecordsFromMessage_UTF8", 3, "ppRecord"}, // PDNS_RECORD *
+	{"DnsExtractRecordsFromMessage_W", 1, "pDnsBuffer"}, // PDNS_MESSAGE_BUFFER
+	{"DnsExtractRecordsFromMessage_W", 2, "wMessageLength"}, // WORD
+	{"DnsExtractRecordsFromMessage_W", 3, "ppRecord"}, // PDNS_RECORD *
+	{"DnsFree", 1, "pData"}, // PVOID
+	{"DnsFree", 2, "FreeType"}, // DNS_FREE_TYPE
+	{"DnsHostnameToComputerNameA", 1, "Hostname"}, // LPCSTR
+	{"DnsHostnameToComputerNameA", 2, "ComputerName"}, // LPSTR
+	{"DnsHostnameToComputerNameA", 3, "nSize"}, // LPDWORD
+	{"DnsHostnameToComputerNameW", 1, "Hostname"}, // LPCWSTR
+	{"DnsHostnameToComputerNameW", 2, "ComputerName"}, // LPWSTR
+	{"DnsHostnameToComputerNameW", 3, "nSize"}, // LPDWORD
+	{"DnsModifyRecordsInSet_A", 1, "pAddRecords"}, // PDNS_RECORD
+	{"DnsModifyRecordsInSet_A", 2, "pDeleteRecords"}, // PDNS_RECORD
+	{"DnsModifyRecordsInSet_A", 3, "Options"}, // DWORD
+	{"DnsModifyRecordsInSet_A", 4, "hContext"}, // HANDLE
+	{"DnsModifyRecordsInSet_A", 5, "pServerList"}, // PIP4_ARRAY
+	{"DnsModifyRecordsInSet_A", 6, "pReserved"}, // PVOID
+	{"DnsModifyRecordsInSet_UTF8", 1, "pAddRecords"}, // PDNS_RECORD
+	{"DnsModifyRecordsInSet_UTF8", 2, "pDeleteRecords"}, // PDNS_RECORD
+	{"DnsModifyRecordsInSet_UTF8", 3, "Options"}, // DWORD
+	{"DnsModifyRecordsInSet_UTF8", 4, "hContext"}, // HANDLE
+	{"DnsModifyRecordsInSet_UTF8", 5, "pServerList"}, // PIP4_ARRAY
+	{"DnsModifyRecordsInSet_UTF8", 6, "pReserved"}, // PVOID
+	{"DnsModifyRecordsInSet_W", 1, "pAddRecords"}, // PDNS_RECORD
+	{"DnsModifyRecordsInSet_W", 2, "pDeleteRecords"}, // PDNS_RECORD
+	{"DnsModifyRecordsInSet_W", 3, "Options"}, // DWORD
+	{"DnsModifyRecordsInSet_W", 4, "hContext"}, // HANDLE
+	{"DnsModifyRecordsInSet_W", 5, "pServerList"}, // PIP4_ARRAY
+	{"DnsModifyRecordsInSet_W", 6, "pReserved"}, // PVOID
+	{"DnsNameCompare_A", 1, "pName1"}, // LPSTR
+	{"DnsNameCompare_A", 2, "pName2"}, // LPSTR
+	{"DnsNameCompare_W", 1, "pName1"}, // LPWSTR
+	{"DnsNameCompare_W", 2, "pName2"}, // LPWSTR
+	{"DnsQueryConfig", 1, "Config"}, // DNS_CONFIG_TYPE
+	{"DnsQueryConfig", 2, "Flag"}, // DWORD
+	{"DnsQueryConfig", 3, "pwsAdapterName"}, // PWSTR
+	{"DnsQueryConfig", 4, "pReserved"}, // PVOID
+	{"DnsQueryConfig", 5, "pBuffer"}, // PVOID
+	{"DnsQueryConfig", 6, "pBufferLength"}, // PDWORD
+	{"DnsQuery_A", 1, "pszName"}, // PCSTR
+	{"DnsQuery_A", 2, "wType"}, // WORD
+	{"DnsQuery_A", 3, "Options"}, // DWORD
+	{"DnsQuery_A", 4, "aipServers"}, // PIP4_ARRAY
+	{"DnsQuery_A", 5, "ppQueryResults"}, // PDNS_RECORD *
+	{"DnsQuery_A", 6, "pReserved"}, // PVOID *
+	{"DnsQuery_UTF8", 1, "pszName"}, // PCSTR
+	{"DnsQuery_UTF8", 2, "wType"}, // WORD
+	{"DnsQuery_UTF8", 3, "Options"}, // DWORD
+	{"DnsQuery_UTF8", 4, "aipServers"}, // PIP4_ARRAY
+	{"DnsQuery_UTF8", 5, "ppQueryResults"}, // PDNS_RECORD *
+	{"DnsQuery_UTF8", 6, "pReserved"}, // PVOID *
+	{"DnsQuery_W", 1, "pszName"}, // PCWSTR
+	{"DnsQuery_W", 2, "wType"}, // WORD
+	{"DnsQuery_W", 3, "Options"}, // DWORD
+	{"DnsQuery_W", 4, "aipServers"}, // PIP4_ARRAY
+	{"DnsQuery_W", 5, "ppQueryResults"}, // PDNS_RECORD *
+	{"DnsQuery_W", 6, "pReserved"}, // PVOID *
+	{"DnsRecordCompare", 1, "pRecord1"}, // PDNS_RECORD
+	{"DnsRecordCompare", 2, "pRecord2"}, // PDNS_RECORD
+	{"DnsRecordCopyEx", 1, "pRecord"}, // PDNS_RECORD
+	{"DnsRecordCopyEx", 2, "CharSetIn"}, // DNS_CHARSET
+	{"DnsRecordCopyEx", 3, "CharSetOut"}, // DNS_CHARSET
+	{"DnsRecordListFree", 1, "pRecordList"}, // PDNS_RECORD
+	{"DnsRecordListFree", 2, "FreeType"}, // DNS_FREE_TYPE
+	{"DnsRecordSetCompare", 1, "pRR1"}, // PDNS_RECORD
+	{"DnsRecordSetCompare", 2, "pRR2"}, // PDNS_RECORD
+	{"DnsRecordSetCompare", 3, "ppDiff1"}, // PDNS_RECORD *
+	{"DnsRecordSetCompare", 4, "ppDiff2"}, // PDNS_RECORD *
+	{"DnsRecordSetCopyEx", 1, "pRecordSet"}, // PDNS_RECORD
+	{"DnsRecordSetCopyEx", 2, "CharSetIn"}, // DNS_CHARSET
+	{"DnsRecordSetCopyEx", 3, "CharSetOut"}, // DNS_CHARSET
+	{"DnsReleaseContextHandle", 1, "hContext"}, // HANDLE
+	{"DnsReplaceRecordSetA", 1, "pNewSet"}, // PDNS_RECORD
+	{"DnsReplaceRecordSetA", 2, "Options"}, // DWORD
+	{"DnsReplaceRecordSetA", 3, "hContext"}, // HANDLE
+	{"DnsReplaceRecordSetA", 4, "pServerList"}, // PIP4_ARRAY
+	{"DnsReplaceRecordSetA", 5, "pReserved"}, // PVOID
+	{"DnsReplaceRecordSetUTF8", 1, "pNewSet"}, // PDNS_RECORD
+	{"DnsReplaceRecordSetUTF8", 2, "Options"}, // DWORD
+	{"DnsReplaceRecordSetUTF8", 3, "hContext"}, // HANDLE
+	{"DnsReplaceRecordSetUTF8", 4, "pServerList"}, // PIP4_ARRAY
+	{"DnsReplaceRecordSetUTF8", 5, "pReserved"}, // PVOID
+	{"DnsReplaceRecordSetW", 1, "pNewSet"}, // PDNS_RECORD
+	{"DnsReplaceRecordSetW", 2, "Options"}, // DWORD
+	{"DnsReplaceRecordSetW", 3, "hContext"}, // HANDLE
+	{"DnsReplaceRecordSetW", 4, "pServerList"}, // PIP4_ARRAY
+	{"DnsReplaceRecordSetW", 5, "pReserved"}, // PVOID
+	{"DnsWriteQuestionToBuffer_UTF8", 1, "pDnsBuffer"}, // PDNS_MESSAGE_BUFFER
+	{"DnsWriteQuestionToBuffer_UTF8", 2, "pdwBufferSize"}, // LPDWORD
+	{"DnsWriteQuestionToBuffer_UTF8", 3, "pszName"}, // LPSTR
+	{"DnsWriteQuestionToBuffer_UTF8", 4, "wType"}, // WORD
+	{"DnsWriteQuestionToBuffer_UTF8", 5, "Xid"}, // WORD
+	{"DnsWriteQuestionToBuffer_UTF8", 6, "fRecursionDesired"}, // WINBOOL
+	{"DnsWriteQuestionToBuffer_W", 1, "pDnsBuffer"}, // PDNS_MESSAGE_BUFFER
+	{"DnsWriteQuestionToBuffer_W", 2, "pdwBufferSize"}, // PDWORD
+	{"DnsWriteQuestionToBuffer_W", 3, "pszName"}, // LPWSTR
+	{"DnsWriteQuestionToBuffer_W", 4, "wType"}, // WORD
+	{"DnsWriteQuestionToBuffer_W", 5, "Xid"}, // WORD
+	{"DnsWriteQuestionToBuffer_W", 6, "fRecursionDesired"}, // WINBOOL
+	{"DocumentPropertiesA", 1, "hWnd"}, // HWND
+	{"DocumentPropertiesA", 2, "hPrinter"}, // HANDLE
+	{"DocumentPropertiesA", 3, "pDeviceName"}, // LPSTR
+	{"DocumentPropertiesA", 4, "pDevModeOutput"}, // PDEVMODEA
+	{"DocumentPropertiesA", 5, "pDevModeInput"}, // PDEVMODEA
+	{"DocumentPropertiesA", 6, "fMode"}, // DWORD
+	{"DocumentPropertiesW", 1, "hWnd"}, // HWND
+	{"DocumentPropertiesW", 2, "hPrinter"}, // HANDLE
+	{"DocumentPropertiesW", 3, "pDeviceName"}, // LPWSTR
+	{"DocumentPropertiesW", 4, "pDevModeOutput"}, // PDEVMODEW
+	{"DocumentPropertiesW", 5, "pDevModeInput"}, // PDEVMODEW
+	{"DocumentPropertiesW", 6, "fMode"}, // DWORD
+	{"DosDateTimeToFileTime", 1, "wFatDate"}, // WORD
+	{"DosDateTimeToFileTime", 2, "wFatTime"}, // WORD
+	{"DosDateTimeToFileTime", 3, "lpFileTime"}, // LPFILETIME
+	{"DragDetect", 1, "hWnd"}, // HWND
+	{"DragDetect", 2, "pt"}, // POINT
+	{"DragObject", 1, "hwndParent"}, // HWND
+	{"DragObject", 2, "hwndFrom"}, // HWND
+	{"DragObject", 3, "fmt"}, // UINT
+	{"DragObject", 4, "data"}, // ULONG_PTR
+	{"DragObject", 5, "hcur"}, // HCURSOR
+	{"DrawAnimatedRects", 1, "hWnd"}, // HWND
+	{"DrawAnimatedRects", 2, "idAni"}, // int
+	{"DrawAnimatedRects", 3, "lprcFrom"}, // CONST RECT *
+	{"DrawAnimatedRects", 4, "lprcTo"}, // CONST RECT *
+	{"DrawCaption", 1, "hWnd"}, // HWND
+	{"DrawCaption", 2, "hdc"}, // HDC
+	{"DrawCaption", 3, "lprect"}, // CONST RECT *
+	{"DrawCaption", 4, "flags"}, // UINT
+	{"DrawEdge", 1, "hdc"}, // HDC
+	{"DrawEdge", 2, "qrc"}, // LPRECT
+	{"DrawEdge", 3, "edge"}, // UINT
+	{"DrawEdge", 4, "grfFlags"}, // UINT
+	{"DrawEscape", 1, "hdc"}, // HDC
+	{"DrawEscape", 2, "iEscape"}, // int
+	{"DrawEscape", 3, "cjIn"}, // int
+	{"DrawEscape", 4, "lpIn"}, // LPCSTR
+	{"DrawFocusRect", 1, "hDC"}, // HDC
+	{"DrawFocusRect", 2, "lprc"}, // CONST RECT *
+	{"DrawFrameControl", 1, "hdc"}, // HDC
+	{"DrawFrameControl", 2, "lprc"}, // LPRECT
+	{"DrawFrameControl", 3, "uType"}, // UINT
+	{"DrawFrameControl", 4, "uState"}, // UINT
+	{"DrawIcon", 1, "hDC"}, // HDC
+	{"DrawIcon", 2, "X"}, // int
+	{"DrawIcon", 3, "Y"}, // int
+	{"DrawIcon", 4, "hIcon"}, // HICON
+	{"DrawIconEx", 1, "hdc"}, // HDC
+	{"DrawIconEx", 2, "xLeft"}, // int
+	{"DrawIconEx", 3, "yTop"}, // int
+	{"DrawIconEx", 4, "hIcon"}, // HICON
+	{"DrawIconEx", 5, "cxWidth"}, // int
+	{"DrawIconEx", 6, "cyWidth"}, // int
+	{"DrawIconEx", 7, "istepIfAniCur"}, // UINT
+	{"DrawIconEx", 8, "hbrFlickerFreeDraw"}, // HBRUSH
+	{"DrawIconEx", 9, "diFlags"}, // UINT
+	{"DrawMenuBar", 1, "hWnd"}, // HWND
+	{"DrawStateA", 1, "hdc"}, // HDC
+	{"DrawStateA", 2, "hbrFore"}, // HBRUSH
+	{"DrawStateA", 3, "qfnCallBack"}, // DRAWSTATEPROC
+	{"DrawStateA", 4, "lData"}, // LPARAM
+	{"DrawStateA", 5, "wData"}, // WPARAM
+	{"DrawStateA", 6, "x"}, // int
+	{"DrawStateA", 7, "y"}, // int
+	{"DrawStateA", 8, "cx"}, // int
+	{"DrawStateA", 9, "cy"}, // int
+	{"DrawStateA", 10, "uFlags"}, // UINT
+	{"DrawStateW", 1, "hdc"}, // HDC
+	{"DrawStateW", 2, "hbrFore"}, // HBRUSH
+	{"DrawStateW", 3, "qfnCallBack"}, // DRAWSTATEPROC
+	{"DrawStateW", 4, "lData"}, // LPARAM
+	{"DrawStateW", 5, "wData"}, // WPARAM
+	{"DrawStateW", 6, "x"}, // int
+	{"DrawStateW", 7, "y"}, // int
+	{"DrawStateW", 8, "cx"}, // int
+	{"DrawStateW", 9, "cy"}, // int
+	{"DrawStateW", 10, "uFlags"}, // UINT
+	{"DrawTextA", 1, "hdc"}, // HDC
+	{"DrawTextA", 2, "lpchText"}, // LPCSTR
+	{"DrawTextA", 3, "cchText"}, // int
+	{"DrawTextA", 4, "lprc"}, // LPRECT
+	{"DrawTextA", 5, "format"}, // UINT
+	{"DrawTextExA", 1, "hdc"}, // HDC
+	{"DrawTextExA", 2, "lpchText"}, // LPSTR
+	{"DrawTextExA", 3, "cchText"}, // int
+	{"DrawTextExA", 4, "lprc"}, // LPRECT
+	{"DrawTextExA", 5, "format"}, // UINT
+	{"DrawTextExA", 6, "lpdtp"}, // LPDRAWTEXTPARAMS
+	{"DrawTextExW", 1, "hdc"}, // HDC
+	{"DrawTextExW", 2, "lpchText"}, // LPWSTR
+	{"DrawTextExW", 3, "cchText"}, // int
+	{"DrawTextExW", 4, "lprc"}, // LPRECT
+	{"DrawTextExW", 5, "format"}, // UINT
+	{"DrawTextExW", 6, "lpdtp"}, // LPDRAWTEXTPARAMS
+	{"DrawTextW", 1, "hdc"}, // HDC
+	{"DrawTextW", 2, "lpchText"}, // LPCWSTR
+	{"DrawTextW", 3, "cchText"}, // int
+	{"DrawTextW", 4, "lprc"}, // LPRECT
+	{"DrawTextW", 5, "format"}, // UINT
+	{"DrvDocumentEvent", 1, "hPrinter"}, // HANDLE
+	{"DrvDocumentEvent", 2, "hdc"}, // HDC
+	{"DrvDocumentEvent", 3, "iEsc"}, // int
+	{"DrvDocumentEvent", 4, "cbIn"}, // ULONG
+	{"DrvDocumentEvent", 5, "pvIn"}, // PVOID
+	{"DrvDocumentEvent", 6, "cbOut"}, // ULONG
+	{"DrvDocumentEvent", 7, "pvOut"}, // PVOID
+	{"DrvDriverEvent", 1, "dwDriverEvent"}, // DWORD
+	{"DrvDriverEvent", 2, "dwLevel"}, // DWORD
+	{"DrvDriverEvent", 3, "pDriverInfo"}, // LPBYTE
+	{"DrvDriverEvent", 4, "lParam"}, // LPARAM
+	{"DrvPrinterEvent", 1, "pPrinterName"}, // LPWSTR
+	{"DrvPrinterEvent", 2, "DriverEvent"}, // int
+	{"DrvPrinterEvent", 3, "Flags"}, // DWORD
+	{"DrvPrinterEvent", 4, "lParam"}, // LPARAM
+	{"DuplicateEncryptionInfoFile", 1, "SrcFileName"}, // LPCWSTR
+	{"DuplicateEncryptionInfoFile", 2, "DstFileName"}, // LPCWSTR
+	{"DuplicateEncryptionInfoFile", 3, "dwCreationDistribution"}, // DWORD
+	{"DuplicateEncryptionInfoFile", 4, "dwAttributes"}, // DWORD
+	{"DuplicateEncryptionInfoFile", 5, "lpSecurityAttributes"}, // CONST LPSECURITY_ATTRIBUTES
+	{"DuplicateHandle", 1, "hSourceProcessHandle"}, // HANDLE
+	{"DuplicateHandle", 2, "hSourceHandle"}, // HANDLE
+	{"DuplicateHandle", 3, "hTargetProcessHandle"}, // HANDLE
+	{"DuplicateHandle", 4, "lpTargetHandle"}, // LPHANDLE
+	{"DuplicateHandle", 5, "dwDesiredAccess"}, // DWORD
+	{"DuplicateHandle", 6, "bInheritHandle"}, // WINBOOL
+	{"DuplicateHandle", 7, "dwOptions"}, // DWORD
+	{"DuplicateToken", 1, "ExistingTokenHandle"}, // HANDLE
+	{"DuplicateToken", 2, "ImpersonationLevel"}, // SECURITY_IMPERSONATION_LEVEL
+	{"DuplicateToken", 3, "DuplicateTokenHandle"}, // PHANDLE
+	{"DuplicateTokenEx", 1, "hExistingToken"}, // HANDLE
+	{"DuplicateTokenEx", 2, "dwDesiredAccess"}, // DWORD
+	{"DuplicateTokenEx", 3, "lpTokenAttributes"}, // LPSECURITY_ATTRIBUTES
+	{"DuplicateTokenEx", 4, "ImpersonationLevel"}, // SECURITY_IMPERSONATION_LEVEL
+	{"DuplicateTokenEx", 5, "TokenType"}, // TOKEN_TYPE
+	{"DuplicateTokenEx", 6, "phNewToken"}, // PHANDLE
+};
+
+} // anonymous namespace
+
 /**
-* @brief Initializes the given map with info about functions starting with D.
+* @brief Returns a table with info about functions starting with D.
 */
-void initFuncParamNamesMap_D(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
-	ADD_PARAM_NAME("DPtoLP", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("DPtoLP", 2, "lppt"); // LPPOINT
-	ADD_PARAM_NAME("DPtoLP", 3, "c"); // int
-	ADD_PARAM_NAME("DeactivateActCtx", 1, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("DeactivateActCtx", 2, "ulCookie"); // ULONG_PTR
-	ADD_PARAM_NAME("DebugActiveProcess", 1, "dwProcessId"); // DWORD
-	ADD_PARAM_NAME("DebugActiveProcessStop", 1, "dwProcessId"); // DWORD
-	ADD_PARAM_NAME("DebugBreakProcess", 1, "Process"); // HANDLE
-	ADD_PARAM_NAME("DebugSetProcessKillOnExit", 1, "KillOnExit"); // WINBOOL
-	ADD_PARAM_NAME("DecodePointer", 1, "Ptr"); // PVOID
-	ADD_PARAM_NAME("DecodeSystemPointer", 1, "Ptr"); // PVOID
-	ADD_PARAM_NAME("DecryptFileA", 1, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("DecryptFileA", 2, "dwReserved"); // DWORD
-	ADD_PARAM_NAME("DecryptFileW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("DecryptFileW", 2, "dwReserved"); // DWORD
-	ADD_PARAM_NAME("DefDlgProcA", 1, "hDlg"); // HWND
-	ADD_PARAM_NAME("DefDlgProcA", 2, "Msg"); // UINT
-	ADD_PARAM_NAME("DefDlgProcA", 3, "wParam"); // WPARAM
-	ADD_PARAM_NAME("DefDlgProcA", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("DefDlgProcW", 1, "hDlg"); // HWND
-	ADD_PARAM_NAME("DefDlgProcW", 2, "Msg"); // UINT
-	ADD_PARAM_NAME("DefDlgProcW", 3, "wParam"); // WPARAM
-	ADD_PARAM_NAME("DefDlgProcW", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("DefFrameProcA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("DefFrameProcA", 2, "hWndMDIClient"); // HWND
-	ADD_PARAM_NAME("DefFrameProcA", 3, "uMsg"); // UINT
-	ADD_PARAM_NAME("DefFrameProcA", 4, "wParam"); // WPARAM
-	ADD_PARAM_NAME("DefFrameProcA", 5, "lParam"); // LPARAM
-	ADD_PARAM_NAME("DefFrameProcW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("DefFrameProcW", 2, "hWndMDIClient"); // HWND
-	ADD_PARAM_NAME("DefFrameProcW", 3, "uMsg"); // UINT
-	ADD_PARAM_NAME("DefFrameProcW", 4, "wParam"); // WPARAM
-	ADD_PARAM_NAME("DefFrameProcW", 5, "lParam"); // LPARAM
-	ADD_PARAM_NAME("DefMDIChildProcA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("DefMDIChildProcA", 2, "uMsg"); // UINT
-	ADD_PARAM_NAME("DefMDIChildProcA", 3, "wParam"); // WPARAM
-	ADD_PARAM_NAME("DefMDIChildProcA", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("DefMDIChildProcW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("DefMDIChildProcW", 2, "uMsg"); // UINT
-	ADD_PARAM_NAME("DefMDIChildProcW", 3, "wParam"); // WPARAM
-	ADD_PARAM_NAME("DefMDIChildProcW", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("DefRawInputProc", 1, "paRawInput"); // PRAWINPUT *
-	ADD_PARAM_NAME("DefRawInputProc", 2, "nInput"); // INT
-	ADD_PARAM_NAME("DefRawInputProc", 3, "cbSizeHeader"); // UINT
-	ADD_PARAM_NAME("DefWindowProcA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("DefWindowProcA", 2, "Msg"); // UINT
-	ADD_PARAM_NAME("DefWindowProcA", 3, "wParam"); // WPARAM
-	ADD_PARAM_NAME("DefWindowProcA", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("DefWindowProcW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("DefWindowProcW", 2, "Msg"); // UINT
-	ADD_PARAM_NAME("DefWindowProcW", 3, "wParam"); // WPARAM
-	ADD_PARAM_NAME("DefWindowProcW", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("DeferWindowPos", 1, "hWinPosInfo"); // HDWP
-	ADD_PARAM_NAME("DeferWindowPos", 2, "hWnd"); // HWND
-	ADD_PARAM_NAME("DeferWindowPos", 3, "hWndInsertAfter"); // HWND
-	ADD_PARAM_NAME("DeferWindowPos", 4, "x"); // int
-	ADD_PARAM_NAME("DeferWindowPos", 5, "y"); // int
-	ADD_PARAM_NAME("DeferWindowPos", 6, "cx"); // int
-	ADD_PARAM_NAME("DeferWindowPos", 7, "cy"); // int
-	ADD_PARAM_NAME("DeferWindowPos", 8, "uFlags"); // UINT
-	ADD_PARAM_NAME("DefineDosDeviceA", 1, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("DefineDosDeviceA", 2, "lpDeviceName"); // LPCSTR
-	ADD_PARAM_NAME("DefineDosDeviceA", 3, "lpTargetPath"); // LPCSTR
-	ADD_PARAM_NAME("DefineDosDeviceW", 1, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("DefineDosDeviceW", 2, "lpDeviceName"); // LPCWSTR
-	ADD_PARAM_NAME("DefineDosDeviceW", 3, "lpTargetPath"); // LPCWSTR
-	ADD_PARAM_NAME("DeleteAce", 1, "pAcl"); // PACL
-	ADD_PARAM_NAME("DeleteAce", 2, "dwAceIndex"); // DWORD
-	ADD_PARAM_NAME("DeleteAtom", 1, "nAtom"); // ATOM
-	ADD_PARAM_NAME("DeleteBoundaryDescriptor", 1, "BoundaryDescriptor"); // HANDLE
-	ADD_PARAM_NAME("DeleteColorSpace", 1, "hcs"); // HCOLORSPACE
-	ADD_PARAM_NAME("DeleteCriticalSection", 1, "lpCriticalSection"); // LPCRITICAL_SECTION
-	ADD_PARAM_NAME("DeleteDC", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("DeleteEnhMetaFile", 1, "hmf"); // HENHMETAFILE
-	ADD_PARAM_NAME("DeleteFiber", 1, "lpFiber"); // LPVOID
-	ADD_PARAM_NAME("DeleteFileA", 1, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("DeleteFileTransactedA", 1, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("DeleteFileTransactedA", 2, "hTransaction"); // HANDLE
-	ADD_PARAM_NAME("DeleteFileTransactedW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("DeleteFileTransactedW", 2, "hTransaction"); // HANDLE
-	ADD_PARAM_NAME("DeleteFileW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("DeleteFormA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("DeleteFormA", 2, "pFormName"); // LPSTR
-	ADD_PARAM_NAME("DeleteFormW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("DeleteFormW", 2, "pFormName"); // LPWSTR
-	ADD_PARAM_NAME("DeleteIE3Cache", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("DeleteIE3Cache", 2, "hInst"); // HINSTANCE
-	ADD_PARAM_NAME("DeleteIE3Cache", 3, "lpszCmdLine"); // LPSTR
-	ADD_PARAM_NAME("DeleteIE3Cache", 4, "nCmdShow"); // int
-	ADD_PARAM_NAME("DeleteMenu", 1, "hMenu"); // HMENU
-	ADD_PARAM_NAME("DeleteMenu", 2, "uPosition"); // UINT
-	ADD_PARAM_NAME("DeleteMenu", 3, "uFlags"); // UINT
-	ADD_PARAM_NAME("DeleteMetaFile", 1, "hmf"); // HMETAFILE
-	ADD_PARAM_NAME("DeleteMonitorA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("DeleteMonitorA", 2, "pEnvironment"); // LPSTR
-	ADD_PARAM_NAME("DeleteMonitorA", 3, "pMonitorName"); // LPSTR
-	ADD_PARAM_NAME("DeleteMonitorW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("DeleteMonitorW", 2, "pEnvironment"); // LPWSTR
-	ADD_PARAM_NAME("DeleteMonitorW", 3, "pMonitorName"); // LPWSTR
-	ADD_PARAM_NAME("DeleteObject", 1, "ho"); // HGDIOBJ
-	ADD_PARAM_NAME("DeletePortA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("DeletePortA", 2, "hWnd"); // HWND
-	ADD_PARAM_NAME("DeletePortA", 3, "pPortName"); // LPSTR
-	ADD_PARAM_NAME("DeletePortW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("DeletePortW", 2, "hWnd"); // HWND
-	ADD_PARAM_NAME("DeletePortW", 3, "pPortName"); // LPWSTR
-	ADD_PARAM_NAME("DeletePrintProcessorA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("DeletePrintProcessorA", 2, "pEnvironment"); // LPSTR
-	ADD_PARAM_NAME("DeletePrintProcessorA", 3, "pPrintProcessorName"); // LPSTR
-	ADD_PARAM_NAME("DeletePrintProcessorW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("DeletePrintProcessorW", 2, "pEnvironment"); // LPWSTR
-	ADD_PARAM_NAME("DeletePrintProcessorW", 3, "pPrintProcessorName"); // LPWSTR
-	ADD_PARAM_NAME("DeletePrintProvidorA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("DeletePrintProvidorA", 2, "pEnvironment"); // LPSTR
-	ADD_PARAM_NAME("DeletePrintProvidorA", 3, "pPrintProvidorName"); // LPSTR
-	ADD_PARAM_NAME("DeletePrintProvidorW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("DeletePrintProvidorW", 2, "pEnvironment"); // LPWSTR
-	ADD_PARAM_NAME("DeletePrintProvidorW", 3, "pPrintProvidorName"); // LPWSTR
-	ADD_PARAM_NAME("DeletePrinter", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("DeletePrinterConnectionA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("DeletePrinterConnectionW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("DeletePrinterDataA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("DeletePrinterDataA", 2, "pValueName"); // LPSTR
-	ADD_PARAM_NAME("DeletePrinterDataExA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("DeletePrinterDataExA", 2, "pKeyName"); // LPCSTR
-	ADD_PARAM_NAME("DeletePrinterDataExA", 3, "pValueName"); // LPCSTR
-	ADD_PARAM_NAME("DeletePrinterDataExW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("DeletePrinterDataExW", 2, "pKeyName"); // LPCWSTR
-	ADD_PARAM_NAME("DeletePrinterDataExW", 3, "pValueName"); // LPCWSTR
-	ADD_PARAM_NAME("DeletePrinterDataW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("DeletePrinterDataW", 2, "pValueName"); // LPWSTR
-	ADD_PARAM_NAME("DeletePrinterDriverA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("DeletePrinterDriverA", 2, "pEnvironment"); // LPSTR
-	ADD_PARAM_NAME("DeletePrinterDriverA", 3, "pDriverName"); // LPSTR
-	ADD_PARAM_NAME("DeletePrinterDriverExA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("DeletePrinterDriverExA", 2, "pEnvironment"); // LPSTR
-	ADD_PARAM_NAME("DeletePrinterDriverExA", 3, "pDriverName"); // LPSTR
-	ADD_PARAM_NAME("DeletePrinterDriverExA", 4, "dwDeleteFlag"); // DWORD
-	ADD_PARAM_NAME("DeletePrinterDriverExA", 5, "dwVersionFlag"); // DWORD
-	ADD_PARAM_NAME("DeletePrinterDriverExW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("DeletePrinterDriverExW", 2, "pEnvironment"); // LPWSTR
-	ADD_PARAM_NAME("DeletePrinterDriverExW", 3, "pDriverName"); // LPWSTR
-	ADD_PARAM_NAME("DeletePrinterDriverExW", 4, "dwDeleteFlag"); // DWORD
-	ADD_PARAM_NAME("DeletePrinterDriverExW", 5, "dwVersionFlag"); // DWORD
-	ADD_PARAM_NAME("DeletePrinterDriverPackageA", 1, "pszServer"); // LPCSTR
-	ADD_PARAM_NAME("DeletePrinterDriverPackageA", 2, "pszInfPath"); // LPCSTR
-	ADD_PARAM_NAME("DeletePrinterDriverPackageA", 3, "pszEnvironment"); // LPCSTR
-	ADD_PARAM_NAME("DeletePrinterDriverPackageW", 1, "pszServer"); // LPCWSTR
-	ADD_PARAM_NAME("DeletePrinterDriverPackageW", 2, "pszInfPath"); // LPCWSTR
-	ADD_PARAM_NAME("DeletePrinterDriverPackageW", 3, "pszEnvironment"); // LPCWSTR
-	ADD_PARAM_NAME("DeletePrinterDriverW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("DeletePrinterDriverW", 2, "pEnvironment"); // LPWSTR
-	ADD_PARAM_NAME("DeletePrinterDriverW", 3, "pDriverName"); // LPWSTR
-	ADD_PARAM_NAME("DeletePrinterIC", 1, "hPrinterIC"); // HANDLE
-	ADD_PARAM_NAME("DeletePrinterKeyA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("DeletePrinterKeyA", 2, "pKeyName"); // LPCSTR
-	ADD_PARAM_NAME("DeletePrinterKeyW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("DeletePrinterKeyW", 2, "pKeyName"); // LPCWSTR
-	ADD_PARAM_NAME("DeleteService", 1, "hService"); // SC_HANDLE
-	ADD_PARAM_NAME("DeleteTimerQueue", 1, "TimerQueue"); // HANDLE
-	ADD_PARAM_NAME("DeleteTimerQueueEx", 1, "TimerQueue"); // HANDLE
-	ADD_PARAM_NAME("DeleteTimerQueueEx", 2, "CompletionEvent"); // HANDLE
-	ADD_PARAM_NAME("DeleteTimerQueueTimer", 1, "TimerQueue"); // HANDLE
-	ADD_PARAM_NAME("DeleteTimerQueueTimer", 2, "Timer"); // HANDLE
-	ADD_PARAM_NAME("DeleteTimerQueueTimer", 3, "CompletionEvent"); // HANDLE
-	ADD_PARAM_NAME("DeleteVolumeMountPointA", 1, "lpszVolumeMountPoint"); // LPCSTR
-	ADD_PARAM_NAME("DeleteVolumeMountPointW", 1, "lpszVolumeMountPoint"); // LPCWSTR
-	ADD_PARAM_NAME("DeregisterEventSource", 1, "hEventLog"); // HANDLE
-	ADD_PARAM_NAME("DeregisterShellHookWindow", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("DescribePixelFormat", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("DescribePixelFormat", 2, "iPixelFormat"); // int
-	ADD_PARAM_NAME("DescribePixelFormat", 3, "nBytes"); // UINT
-	ADD_PARAM_NAME("DescribePixelFormat", 4, "ppfd"); // LPPIXELFORMATDESCRIPTOR
-	ADD_PARAM_NAME("DestroyAcceleratorTable", 1, "hAccel"); // HACCEL
-	ADD_PARAM_NAME("DestroyCursor", 1, "hCursor"); // HCURSOR
-	ADD_PARAM_NAME("DestroyIcon", 1, "hIcon"); // HICON
-	ADD_PARAM_NAME("DestroyMenu", 1, "hMenu"); // HMENU
-	ADD_PARAM_NAME("DestroyPrivateObjectSecurity", 1, "ObjectDescriptor"); // PSECURITY_DESCRIPTOR *
-	ADD_PARAM_NAME("DestroyThreadpoolEnvironment", 1, "pcbe"); // PTP_CALLBACK_ENVIRON
-	ADD_PARAM_NAME("DestroyWindow", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("DevQueryPrint", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("DevQueryPrint", 2, "pDevMode"); // LPDEVMODEW
-	ADD_PARAM_NAME("DevQueryPrint", 3, "pResID"); // DWORD *
-	ADD_PARAM_NAME("DeviceCapabilitiesA", 1, "pDevice"); // LPCSTR
-	ADD_PARAM_NAME("DeviceCapabilitiesA", 2, "pPort"); // LPCSTR
-	ADD_PARAM_NAME("DeviceCapabilitiesA", 3, "fwCapability"); // WORD
-	ADD_PARAM_NAME("DeviceCapabilitiesA", 4, "pOutput"); // LPSTR
-	ADD_PARAM_NAME("DeviceCapabilitiesA", 5, "pDevMode"); // CONST DEVMODEA *
-	ADD_PARAM_NAME("DeviceCapabilitiesW", 1, "pDevice"); // LPCWSTR
-	ADD_PARAM_NAME("DeviceCapabilitiesW", 2, "pPort"); // LPCWSTR
-	ADD_PARAM_NAME("DeviceCapabilitiesW", 3, "fwCapability"); // WORD
-	ADD_PARAM_NAME("DeviceCapabilitiesW", 4, "pOutput"); // LPWSTR
-	ADD_PARAM_NAME("DeviceCapabilitiesW", 5, "pDevMode"); // CONST DEVMODEW *
-	ADD_PARAM_NAME("DeviceIoControl", 1, "hDevice"); // HANDLE
-	ADD_PARAM_NAME("DeviceIoControl", 2, "dwIoControlCode"); // DWORD
-	ADD_PARAM_NAME("DeviceIoControl", 3, "lpInBuffer"); // LPVOID
-	ADD_PARAM_NAME("DeviceIoControl", 4, "nInBufferSize"); // DWORD
-	ADD_PARAM_NAME("DeviceIoControl", 5, "lpOutBuffer"); // LPVOID
-	ADD_PARAM_NAME("DeviceIoControl", 6, "nOutBufferSize"); // DWORD
-	ADD_PARAM_NAME("DeviceIoControl", 7, "lpBytesReturned"); // LPDWORD
-	ADD_PARAM_NAME("DeviceIoControl", 8, "lpOverlapped"); // LPOVERLAPPED
-	ADD_PARAM_NAME("DialogBoxIndirectParamA", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("DialogBoxIndirectParamA", 2, "hDialogTemplate"); // LPCDLGTEMPLATEA
-	ADD_PARAM_NAME("DialogBoxIndirectParamA", 3, "hWndParent"); // HWND
-	ADD_PARAM_NAME("DialogBoxIndirectParamA", 4, "lpDialogFunc"); // DLGPROC
-	ADD_PARAM_NAME("DialogBoxIndirectParamA", 5, "dwInitParam"); // LPARAM
-	ADD_PARAM_NAME("DialogBoxIndirectParamW", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("DialogBoxIndirectParamW", 2, "hDialogTemplate"); // LPCDLGTEMPLATEW
-	ADD_PARAM_NAME("DialogBoxIndirectParamW", 3, "hWndParent"); // HWND
-	ADD_PARAM_NAME("DialogBoxIndirectParamW", 4, "lpDialogFunc"); // DLGPROC
-	ADD_PARAM_NAME("DialogBoxIndirectParamW", 5, "dwInitParam"); // LPARAM
-	ADD_PARAM_NAME("DialogBoxParamA", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("DialogBoxParamA", 2, "lpTemplateName"); // LPCSTR
-	ADD_PARAM_NAME("DialogBoxParamA", 3, "hWndParent"); // HWND
-	ADD_PARAM_NAME("DialogBoxParamA", 4, "lpDialogFunc"); // DLGPROC
-	ADD_PARAM_NAME("DialogBoxParamA", 5, "dwInitParam"); // LPARAM
-	ADD_PARAM_NAME("DialogBoxParamW", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("DialogBoxParamW", 2, "lpTemplateName"); // LPCWSTR
-	ADD_PARAM_NAME("DialogBoxParamW", 3, "hWndParent"); // HWND
-	ADD_PARAM_NAME("DialogBoxParamW", 4, "lpDialogFunc"); // DLGPROC
-	ADD_PARAM_NAME("DialogBoxParamW", 5, "dwInitParam"); // LPARAM
-	ADD_PARAM_NAME("DisableThreadLibraryCalls", 1, "hLibModule"); // HMODULE
-	ADD_PARAM_NAME("DisassociateCurrentThreadFromCallback", 1, "pci"); // PTP_CALLBACK_INSTANCE
-	ADD_PARAM_NAME("DisconnectNamedPipe", 1, "hNamedPipe"); // HANDLE
-	ADD_PARAM_NAME("DispatchMessageA", 1, "lpMsg"); // CONST MSG *
-	ADD_PARAM_NAME("DispatchMessageW", 1, "lpMsg"); // CONST MSG *
-	ADD_PARAM_NAME("DlgDirListA", 1, "hDlg"); // HWND
-	ADD_PARAM_NAME("DlgDirListA", 2, "lpPathSpec"); // LPSTR
-	ADD_PARAM_NAME("DlgDirListA", 3, "nIDListBox"); // int
-	ADD_PARAM_NAME("DlgDirListA", 4, "nIDStaticPath"); // int
-	ADD_PARAM_NAME("DlgDirListA", 5, "uFileType"); // UINT
-	ADD_PARAM_NAME("DlgDirListComboBoxA", 1, "hDlg"); // HWND
-	ADD_PARAM_NAME("DlgDirListComboBoxA", 2, "lpPathSpec"); // LPSTR
-	ADD_PARAM_NAME("DlgDirListComboBoxA", 3, "nIDComboBox"); // int
-	ADD_PARAM_NAME("DlgDirListComboBoxA", 4, "nIDStaticPath"); // int
-	ADD_PARAM_NAME("DlgDirListComboBoxA", 5, "uFiletype"); // UINT
-	ADD_PARAM_NAME("DlgDirListComboBoxW", 1, "hDlg"); // HWND
-	ADD_PARAM_NAME("DlgDirListComboBoxW", 2, "lpPathSpec"); // LPWSTR
-	ADD_PARAM_NAME("DlgDirListComboBoxW", 3, "nIDComboBox"); // int
-	ADD_PARAM_NAME("DlgDirListComboBoxW", 4, "nIDStaticPath"); // int
-	ADD_PARAM_NAME("DlgDirListComboBoxW", 5, "uFiletype"); // UINT
-	ADD_PARAM_NAME("DlgDirListW", 1, "hDlg"); // HWND
-	ADD_PARAM_NAME("DlgDirListW", 2, "lpPathSpec"); // LPWSTR
-	ADD_PARAM_NAME("DlgDirListW", 3, "nIDListBox"); // int
-	ADD_PARAM_NAME("DlgDirListW", 4, "nIDStaticPath"); // int
-	ADD_PARAM_NAME("DlgDirListW", 5, "uFileType"); // UINT
-	ADD_PARAM_NAME("DlgDirSelectComboBoxExA", 1, "hwndDlg"); // HWND
-	ADD_PARAM_NAME("DlgDirSelectComboBoxExA", 2, "lpString"); // LPSTR
-	ADD_PARAM_NAME("DlgDirSelectComboBoxExA", 3, "cchOut"); // int
-	ADD_PARAM_NAME("DlgDirSelectComboBoxExA", 4, "idComboBox"); // int
-	ADD_PARAM_NAME("DlgDirSelectComboBoxExW", 1, "hwndDlg"); // HWND
-	ADD_PARAM_NAME("DlgDirSelectComboBoxExW", 2, "lpString"); // LPWSTR
-	ADD_PARAM_NAME("DlgDirSelectComboBoxExW", 3, "cchOut"); // int
-	ADD_PARAM_NAME("DlgDirSelectComboBoxExW", 4, "idComboBox"); // int
-	ADD_PARAM_NAME("DlgDirSelectExA", 1, "hwndDlg"); // HWND
-	ADD_PARAM_NAME("DlgDirSelectExA", 2, "lpString"); // LPSTR
-	ADD_PARAM_NAME("DlgDirSelectExA", 3, "chCount"); // int
-	ADD_PARAM_NAME("DlgDirSelectExA", 4, "idListBox"); // int
-	ADD_PARAM_NAME("DlgDirSelectExW", 1, "hwndDlg"); // HWND
-	ADD_PARAM_NAME("DlgDirSelectExW", 2, "lpString"); // LPWSTR
-	ADD_PARAM_NAME("DlgDirSelectExW", 3, "chCount"); // int
-	ADD_PARAM_NAME("DlgDirSelectExW", 4, "idListBox"); // int
-	ADD_PARAM_NAME("DnsAcquireContextHandle_A", 1, "CredentialFlags"); // DWORD
-	ADD_PARAM_NAME("DnsAcquireContextHandle_A", 2, "pCredentials"); // PVOID
-	ADD_PARAM_NAME("DnsAcquireContextHandle_A", 3, "pContextHandle"); // PHANDLE
-	ADD_PARAM_NAME("DnsAcquireContextHandle_W", 1, "CredentialFlags"); // DWORD
-	ADD_PARAM_NAME("DnsAcquireContextHandle_W", 2, "pCredentials"); // PVOID
-	ADD_PARAM_NAME("DnsAcquireContextHandle_W", 3, "pContextHandle"); // PHANDLE
-	ADD_PARAM_NAME("DnsExtractRecordsFromMessage_UTF8", 1, "pDnsBuffer"); // PDNS_MESSAGE_BUFFER
-	ADD_PARAM_NAME("DnsExtractRecordsFromMessage_UTF8", 2, "wMessageLength"); // WORD
-	ADD_PARAM_NAME("DnsExtractRecordsFromMessage_UTF8", 3, "ppRecord"); // PDNS_RECORD *
-	ADD_PARAM_NAME("DnsExtractRecordsFromMessage_W", 1, "pDnsBuffer"); // PDNS_MESSAGE_BUFFER
-	ADD_PARAM_NAME("DnsExtractRecordsFromMessage_W", 2, "wMessageLength"); // WORD
-	ADD_PARAM_NAME("DnsExtractRecordsFromMessage_W", 3, "ppRecord"); // PDNS_RECORD *
-	ADD_PARAM_NAME("DnsFree", 1, "pData"); // PVOID
-	ADD_PARAM_NAME("DnsFree", 2, "FreeType"); // DNS_FREE_TYPE
-	ADD_PARAM_NAME("DnsHostnameToComputerNameA", 1, "Hostname"); // LPCSTR
-	ADD_PARAM_NAME("DnsHostnameToComputerNameA", 2, "ComputerName"); // LPSTR
-	ADD_PARAM_NAME("DnsHostnameToComputerNameA", 3, "nSize"); // LPDWORD
-	ADD_PARAM_NAME("DnsHostnameToComputerNameW", 1, "Hostname"); // LPCWSTR
-	ADD_PARAM_NAME("DnsHostnameToComputerNameW", 2, "ComputerName"); // LPWSTR
-	ADD_PARAM_NAME("DnsHostnameToComputerNameW", 3, "nSize"); // LPDWORD
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_A", 1, "pAddRecords"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_A", 2, "pDeleteRecords"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_A", 3, "Options"); // DWORD
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_A", 4, "hContext"); // HANDLE
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_A", 5, "pServerList"); // PIP4_ARRAY
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_A", 6, "pReserved"); // PVOID
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_UTF8", 1, "pAddRecords"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_UTF8", 2, "pDeleteRecords"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_UTF8", 3, "Options"); // DWORD
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_UTF8", 4, "hContext"); // HANDLE
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_UTF8", 5, "pServerList"); // PIP4_ARRAY
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_UTF8", 6, "pReserved"); // PVOID
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_W", 1, "pAddRecords"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_W", 2, "pDeleteRecords"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_W", 3, "Options"); // DWORD
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_W", 4, "hContext"); // HANDLE
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_W", 5, "pServerList"); // PIP4_ARRAY
-	ADD_PARAM_NAME("DnsModifyRecordsInSet_W", 6, "pReserved"); // PVOID
-	ADD_PARAM_NAME("DnsNameCompare_A", 1, "pName1"); // LPSTR
-	ADD_PARAM_NAME("DnsNameCompare_A", 2, "pName2"); // LPSTR
-	ADD_PARAM_NAME("DnsNameCompare_W", 1, "pName1"); // LPWSTR
-	ADD_PARAM_NAME("DnsNameCompare_W", 2, "pName2"); // LPWSTR
-	ADD_PARAM_NAME("DnsQueryConfig", 1, "Config"); // DNS_CONFIG_TYPE
-	ADD_PARAM_NAME("DnsQueryConfig", 2, "Flag"); // DWORD
-	ADD_PARAM_NAME("DnsQueryConfig", 3, "pwsAdapterName"); // PWSTR
-	ADD_PARAM_NAME("DnsQueryConfig", 4, "pReserved"); // PVOID
-	ADD_PARAM_NAME("DnsQueryConfig", 5, "pBuffer"); // PVOID
-	ADD_PARAM_NAME("DnsQueryConfig", 6, "pBufferLength"); // PDWORD
-	ADD_PARAM_NAME("DnsQuery_A", 1, "pszName"); // PCSTR
-	ADD_PARAM_NAME("DnsQuery_A", 2, "wType"); // WORD
-	ADD_PARAM_NAME("DnsQuery_A", 3, "Options"); // DWORD
-	ADD_PARAM_NAME("DnsQuery_A", 4, "aipServers"); // PIP4_ARRAY
-	ADD_PARAM_NAME("DnsQuery_A", 5, "ppQueryResults"); // PDNS_RECORD *
-	ADD_PARAM_NAME("DnsQuery_A", 6, "pReserved"); // PVOID *
-	ADD_PARAM_NAME("DnsQuery_UTF8", 1, "pszName"); // PCSTR
-	ADD_PARAM_NAME("DnsQuery_UTF8", 2, "wType"); // WORD
-	ADD_PARAM_NAME("DnsQuery_UTF8", 3, "Options"); // DWORD
-	ADD_PARAM_NAME("DnsQuery_UTF8", 4, "aipServers"); // PIP4_ARRAY
-	ADD_PARAM_NAME("DnsQuery_UTF8", 5, "ppQueryResults"); // PDNS_RECORD *
-	ADD_PARAM_NAME("DnsQuery_UTF8", 6, "pReserved"); // PVOID *
-	ADD_PARAM_NAME("DnsQuery_W", 1, "pszName"); // PCWSTR
-	ADD_PARAM_NAME("DnsQuery_W", 2, "wType"); // WORD
-	ADD_PARAM_NAME("DnsQuery_W", 3, "Options"); // DWORD
-	ADD_PARAM_NAME("DnsQuery_W", 4, "aipServers"); // PIP4_ARRAY
-	ADD_PARAM_NAME("DnsQuery_W", 5, "ppQueryResults"); // PDNS_RECORD *
-	ADD_PARAM_NAME("DnsQuery_W", 6, "pReserved"); // PVOID *
-	ADD_PARAM_NAME("DnsRecordCompare", 1, "pRecord1"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsRecordCompare", 2, "pRecord2"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsRecordCopyEx", 1, "pRecord"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsRecordCopyEx", 2, "CharSetIn"); // DNS_CHARSET
-	ADD_PARAM_NAME("DnsRecordCopyEx", 3, "CharSetOut"); // DNS_CHARSET
-	ADD_PARAM_NAME("DnsRecordListFree", 1, "pRecordList"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsRecordListFree", 2, "FreeType"); // DNS_FREE_TYPE
-	ADD_PARAM_NAME("DnsRecordSetCompare", 1, "pRR1"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsRecordSetCompare", 2, "pRR2"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsRecordSetCompare", 3, "ppDiff1"); // PDNS_RECORD *
-	ADD_PARAM_NAME("DnsRecordSetCompare", 4, "ppDiff2"); // PDNS_RECORD *
-	ADD_PARAM_NAME("DnsRecordSetCopyEx", 1, "pRecordSet"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsRecordSetCopyEx", 2, "CharSetIn"); // DNS_CHARSET
-	ADD_PARAM_NAME("DnsRecordSetCopyEx", 3, "CharSetOut"); // DNS_CHARSET
-	ADD_PARAM_NAME("DnsReleaseContextHandle", 1, "hContext"); // HANDLE
-	ADD_PARAM_NAME("DnsReplaceRecordSetA", 1, "pNewSet"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsReplaceRecordSetA", 2, "Options"); // DWORD
-	ADD_PARAM_NAME("DnsReplaceRecordSetA", 3, "hContext"); // HANDLE
-	ADD_PARAM_NAME("DnsReplaceRecordSetA", 4, "pServerList"); // PIP4_ARRAY
-	ADD_PARAM_NAME("DnsReplaceRecordSetA", 5, "pReserved"); // PVOID
-	ADD_PARAM_NAME("DnsReplaceRecordSetUTF8", 1, "pNewSet"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsReplaceRecordSetUTF8", 2, "Options"); // DWORD
-	ADD_PARAM_NAME("DnsReplaceRecordSetUTF8", 3, "hContext"); // HANDLE
-	ADD_PARAM_NAME("DnsReplaceRecordSetUTF8", 4, "pServerList"); // PIP4_ARRAY
-	ADD_PARAM_NAME("DnsReplaceRecordSetUTF8", 5, "pReserved"); // PVOID
-	ADD_PARAM_NAME("DnsReplaceRecordSetW", 1, "pNewSet"); // PDNS_RECORD
-	ADD_PARAM_NAME("DnsReplaceRecordSetW", 2, "Options"); // DWORD
-	ADD_PARAM_NAME("DnsReplaceRecordSetW", 3, "hContext"); // HANDLE
-	ADD_PARAM_NAME("DnsReplaceRecordSetW", 4, "pServerList"); // PIP4_ARRAY
-	ADD_PARAM_NAME("DnsReplaceRecordSetW", 5, "pReserved"); // PVOID
-	ADD_PARAM_NAME("DnsWriteQuestionToBuffer_UTF8", 1, "pDnsBuffer"); // PDNS_MESSAGE_BUFFER
-	ADD_PARAM_NAME("DnsWriteQuestionToBuffer_UTF8", 2, "pdwBufferSize"); // LPDWORD
-	ADD_PARAM_NAME("DnsWriteQuestionToBuffer_UTF8", 3, "pszName"); // LPSTR
-	ADD_PARAM_NAME("DnsWriteQuestionToBuffer_UTF8", 4, "wType"); // WORD
-	ADD_PARAM_NAME("DnsWriteQuestionToBuffer_UTF8", 5, "Xid"); // WORD
-	ADD_PARAM_NAME("DnsWriteQuestionToBuffer_UTF8", 6, "fRecursionDesired"); // WINBOOL
-	ADD_PARAM_NAME("DnsWriteQuestionToBuffer_W", 1, "pDnsBuffer"); // PDNS_MESSAGE_BUFFER
-	ADD_PARAM_NAME("DnsWriteQuestionToBuffer_W", 2, "pdwBufferSize"); // PDWORD
-	ADD_PARAM_NAME("DnsWriteQuestionToBuffer_W", 3, "pszName"); // LPWSTR
-	ADD_PARAM_NAME("DnsWriteQuestionToBuffer_W", 4, "wType"); // WORD
-	ADD_PARAM_NAME("DnsWriteQuestionToBuffer_W", 5, "Xid"); // WORD
-	ADD_PARAM_NAME("DnsWriteQuestionToBuffer_W", 6, "fRecursionDesired"); // WINBOOL
-	ADD_PARAM_NAME("DocumentPropertiesA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("DocumentPropertiesA", 2, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("DocumentPropertiesA", 3, "pDeviceName"); // LPSTR
-	ADD_PARAM_NAME("DocumentPropertiesA", 4, "pDevModeOutput"); // PDEVMODEA
-	ADD_PARAM_NAME("DocumentPropertiesA", 5, "pDevModeInput"); // PDEVMODEA
-	ADD_PARAM_NAME("DocumentPropertiesA", 6, "fMode"); // DWORD
-	ADD_PARAM_NAME("DocumentPropertiesW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("DocumentPropertiesW", 2, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("DocumentPropertiesW", 3, "pDeviceName"); // LPWSTR
-	ADD_PARAM_NAME("DocumentPropertiesW", 4, "pDevModeOutput"); // PDEVMODEW
-	ADD_PARAM_NAME("DocumentPropertiesW", 5, "pDevModeInput"); // PDEVMODEW
-	ADD_PARAM_NAME("DocumentPropertiesW", 6, "fMode"); // DWORD
-	ADD_PARAM_NAME("DosDateTimeToFileTime", 1, "wFatDate"); // WORD
-	ADD_PARAM_NAME("DosDateTimeToFileTime", 2, "wFatTime"); // WORD
-	ADD_PARAM_NAME("DosDateTimeToFileTime", 3, "lpFileTime"); // LPFILETIME
-	ADD_PARAM_NAME("DragDetect", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("DragDetect", 2, "pt"); // POINT
-	ADD_PARAM_NAME("DragObject", 1, "hwndParent"); // HWND
-	ADD_PARAM_NAME("DragObject", 2, "hwndFrom"); // HWND
-	ADD_PARAM_NAME("DragObject", 3, "fmt"); // UINT
-	ADD_PARAM_NAME("DragObject", 4, "data"); // ULONG_PTR
-	ADD_PARAM_NAME("DragObject", 5, "hcur"); // HCURSOR
-	ADD_PARAM_NAME("DrawAnimatedRects", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("DrawAnimatedRects", 2, "idAni"); // int
-	ADD_PARAM_NAME("DrawAnimatedRects", 3, "lprcFrom"); // CONST RECT *
-	ADD_PARAM_NAME("DrawAnimatedRects", 4, "lprcTo"); // CONST RECT *
-	ADD_PARAM_NAME("DrawCaption", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("DrawCaption", 2, "hdc"); // HDC
-	ADD_PARAM_NAME("DrawCaption", 3, "lprect"); // CONST RECT *
-	ADD_PARAM_NAME("DrawCaption", 4, "flags"); // UINT
-	ADD_PARAM_NAME("DrawEdge", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("DrawEdge", 2, "qrc"); // LPRECT
-	ADD_PARAM_NAME("DrawEdge", 3, "edge"); // UINT
-	ADD_PARAM_NAME("DrawEdge", 4, "grfFlags"); // UINT
-	ADD_PARAM_NAME("DrawEscape", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("DrawEscape", 2, "iEscape"); // int
-	ADD_PARAM_NAME("DrawEscape", 3, "cjIn"); // int
-	ADD_PARAM_NAME("DrawEscape", 4, "lpIn"); // LPCSTR
-	ADD_PARAM_NAME("DrawFocusRect", 1, "hDC"); // HDC
-	ADD_PARAM_NAME("DrawFocusRect", 2, "lprc"); // CONST RECT *
-	ADD_PARAM_NAME("DrawFrameControl", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("DrawFrameControl", 2, "lprc"); // LPRECT
-	ADD_PARAM_NAME("DrawFrameControl", 3, "uType"); // UINT
-	ADD_PARAM_NAME("DrawFrameControl", 4, "uState"); // UINT
-	ADD_PARAM_NAME("DrawIcon", 1, "hDC"); // HDC
-	ADD_PARAM_NAME("DrawIcon", 2, "X"); // int
-	ADD_PARAM_NAME("DrawIcon", 3, "Y"); // int
-	ADD_PARAM_NAME("DrawIcon", 4, "hIcon"); // HICON
-	ADD_PARAM_NAME("DrawIconEx", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("DrawIconEx", 2, "xLeft"); // int
-	ADD_PARAM_NAME("DrawIconEx", 3, "yTop"); // int
-	ADD_PARAM_NAME("DrawIconEx", 4, "hIcon"); // HICON
-	ADD_PARAM_NAME("DrawIconEx", 5, "cxWidth"); // int
-	ADD_PARAM_NAME("DrawIconEx", 6, "cyWidth"); // int
-	ADD_PARAM_NAME("DrawIconEx", 7, "istepIfAniCur"); // UINT
-	ADD_PARAM_NAME("DrawIconEx", 8, "hbrFlickerFreeDraw"); // HBRUSH
-	ADD_PARAM_NAME("DrawIconEx", 9, "diFlags"); // UINT
-	ADD_PARAM_NAME("DrawMenuBar", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("DrawStateA", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("DrawStateA", 2, "hbrFore"); // HBRUSH
-	ADD_PARAM_NAME("DrawStateA", 3, "qfnCallBack"); // DRAWSTATEPROC
-	ADD_PARAM_NAME("DrawStateA", 4, "lData"); // LPARAM
-	ADD_PARAM_NAME("DrawStateA", 5, "wData"); // WPARAM
-	ADD_PARAM_NAME("DrawStateA", 6, "x"); // int
-	ADD_PARAM_NAME("DrawStateA", 7, "y"); // int
-	ADD_PARAM_NAME("DrawStateA", 8, "cx"); // int
-	ADD_PARAM_NAME("DrawStateA", 9, "cy"); // int
-	ADD_PARAM_NAME("DrawStateA", 10, "uFlags"); // UINT
-	ADD_PARAM_NAME("DrawStateW", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("DrawStateW", 2, "hbrFore"); // HBRUSH
-	ADD_PARAM_NAME("DrawStateW", 3, "qfnCallBack"); // DRAWSTATEPROC
-	ADD_PARAM_NAME("DrawStateW", 4, "lData"); // LPARAM
-	ADD_PARAM_NAME("DrawStateW", 5, "wData"); // WPARAM
-	ADD_PARAM_NAME("DrawStateW", 6, "x"); // int
-	ADD_PARAM_NAME("DrawStateW", 7, "y"); // int
-	ADD_PARAM_NAME("DrawStateW", 8, "cx"); // int
-	ADD_PARAM_NAME("DrawStateW", 9, "cy"); // int
-	ADD_PARAM_NAME("DrawStateW", 10, "uFlags"); // UINT
-	ADD_PARAM_NAME("DrawTextA", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("DrawTextA", 2, "lpchText"); // LPCSTR
-	ADD_PARAM_NAME("DrawTextA", 3, "cchText"); // int
-	ADD_PARAM_NAME("DrawTextA", 4, "lprc"); // LPRECT
-	ADD_PARAM_NAME("DrawTextA", 5, "format"); // UINT
-	ADD_PARAM_NAME("DrawTextExA", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("DrawTextExA", 2, "lpchText"); // LPSTR
-	ADD_PARAM_NAME("DrawTextExA", 3, "cchText"); // int
-	ADD_PARAM_NAME("DrawTextExA", 4, "lprc"); // LPRECT
-	ADD_PARAM_NAME("DrawTextExA", 5, "format"); // UINT
-	ADD_PARAM_NAME("DrawTextExA", 6, "lpdtp"); // LPDRAWTEXTPARAMS
-	ADD_PARAM_NAME("DrawTextExW", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("DrawTextExW", 2, "lpchText"); // LPWSTR
-	ADD_PARAM_NAME("DrawTextExW", 3, "cchText"); // int
-	ADD_PARAM_NAME("DrawTextExW", 4, "lprc"); // LPRECT
-	ADD_PARAM_NAME("DrawTextExW", 5, "format"); // UINT
-	ADD_PARAM_NAME("DrawTextExW", 6, "lpdtp"); // LPDRAWTEXTPARAMS
-	ADD_PARAM_NAME("DrawTextW", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("DrawTextW", 2, "lpchText"); // LPCWSTR
-	ADD_PARAM_NAME("DrawTextW", 3, "cchText"); // int
-	ADD_PARAM_NAME("DrawTextW", 4, "lprc"); // LPRECT
-	ADD_PARAM_NAME("DrawTextW", 5, "format"); // UINT
-	ADD_PARAM_NAME("DrvDocumentEvent", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("DrvDocumentEvent", 2, "hdc"); // HDC
-	ADD_PARAM_NAME("DrvDocumentEvent", 3, "iEsc"); // int
-	ADD_PARAM_NAME("DrvDocumentEvent", 4, "cbIn"); // ULONG
-	ADD_PARAM_NAME("DrvDocumentEvent", 5, "pvIn"); // PVOID
-	ADD_PARAM_NAME("DrvDocumentEvent", 6, "cbOut"); // ULONG
-	ADD_PARAM_NAME("DrvDocumentEvent", 7, "pvOut"); // PVOID
-	ADD_PARAM_NAME("DrvDriverEvent", 1, "dwDriverEvent"); // DWORD
-	ADD_PARAM_NAME("DrvDriverEvent", 2, "dwLevel"); // DWORD
-	ADD_PARAM_NAME("DrvDriverEvent", 3, "pDriverInfo"); // LPBYTE
-	ADD_PARAM_NAME("DrvDriverEvent", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("DrvPrinterEvent", 1, "pPrinterName"); // LPWSTR
-	ADD_PARAM_NAME("DrvPrinterEvent", 2, "DriverEvent"); // int
-	ADD_PARAM_NAME("DrvPrinterEvent", 3, "Flags"); // DWORD
-	ADD_PARAM_NAME("DrvPrinterEvent", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("DuplicateEncryptionInfoFile", 1, "SrcFileName"); // LPCWSTR
-	ADD_PARAM_NAME("DuplicateEncryptionInfoFile", 2, "DstFileName"); // LPCWSTR
-	ADD_PARAM_NAME("DuplicateEncryptionInfoFile", 3, "dwCreationDistribution"); // DWORD
-	ADD_PARAM_NAME("DuplicateEncryptionInfoFile", 4, "dwAttributes"); // DWORD
-	ADD_PARAM_NAME("DuplicateEncryptionInfoFile", 5, "lpSecurityAttributes"); // CONST LPSECURITY_ATTRIBUTES
-	ADD_PARAM_NAME("DuplicateHandle", 1, "hSourceProcessHandle"); // HANDLE
-	ADD_PARAM_NAME("DuplicateHandle", 2, "hSourceHandle"); // HANDLE
-	ADD_PARAM_NAME("DuplicateHandle", 3, "hTargetProcessHandle"); // HANDLE
-	ADD_PARAM_NAME("DuplicateHandle", 4, "lpTargetHandle"); // LPHANDLE
-	ADD_PARAM_NAME("DuplicateHandle", 5, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("DuplicateHandle", 6, "bInheritHandle"); // WINBOOL
-	ADD_PARAM_NAME("DuplicateHandle", 7, "dwOptions"); // DWORD
-	ADD_PARAM_NAME("DuplicateToken", 1, "ExistingTokenHandle"); // HANDLE
-	ADD_PARAM_NAME("DuplicateToken", 2, "ImpersonationLevel"); // SECURITY_IMPERSONATION_LEVEL
-	ADD_PARAM_NAME("DuplicateToken", 3, "DuplicateTokenHandle"); // PHANDLE
-	ADD_PARAM_NAME("DuplicateTokenEx", 1, "hExistingToken"); // HANDLE
-	ADD_PARAM_NAME("DuplicateTokenEx", 2, "dwDesiredAccess"); // DWORD
-	ADD_PARAM_NAME("DuplicateTokenEx", 3, "lpTokenAttributes"); // LPSECURITY_ATTRIBUTES
-	ADD_PARAM_NAME("DuplicateTokenEx", 4, "ImpersonationLevel"); // SECURITY_IMPERSONATION_LEVEL
-	ADD_PARAM_NAME("DuplicateTokenEx", 5, "TokenType"); // TOKEN_TYPE
-	ADD_PARAM_NAME("DuplicateTokenEx", 6, "phNewToken"); // PHANDLE
+FuncParamNamesTable getFuncParamNamesTable_D() {
+	return makeFuncParamNamesTable(FUNC_PARAM_NAMES_TABLE);
 }
 
 } // namespace win_api
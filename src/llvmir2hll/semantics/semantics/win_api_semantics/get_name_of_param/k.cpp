@@ -1,6 +1,6 @@
 /**
 * @file src/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/k.cpp
-* @brief Implementation of the initialization of WinAPI functions.
+* @brief Names of parameters of WinAPI functions.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -11,20 +11,25 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
+/// Names of parameters of functions from windows.h.
+constexpr FuncParamName FUNC_PARAM_NAMES_TABLE[] = {
+	{"KillTimer", 1, "hWnd"}, // HWND
+	{"KillTimer", 2, "uIDEvent"}, // UINT_PTR
+	{"keybd_event", 1, "bVk"}, // BYTE
+	{"keybd_event", 2, "bScan"}, // BYTE
+	{"keybd_event", 3, "dwFlags"}, // DWORD
+	{"keybd_event", 4, "dwExtraInfo"}, // ULONG_PTR
+};
+
+} // anonymous namespace
+
 /**
-* @brief Initializes the given map with info about functions starting with K.
+* @brief Returns a table with info about functions starting with K.
 */
-void initFuncParamNamesMap_K(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
-	ADD_PARAM_NAME("KillTimer", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("KillTimer", 2, "uIDEvent"); // UINT_PTR
-
-	ADD_PARAM_NAME("keybd_event", 1, "bVk"); // BYTE
-	ADD_PARAM_NAME("keybd_event", 2, "bScan"); // BYTE
-	ADD_PARAM_NAME("keybd_event", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("keybd_event", 4, "dwExtraInfo"); // ULONG_PTR
+FuncParamNamesTable getFuncParamNamesTable_K() {
+	return makeFuncParamNamesTable(FUNC_PARAM_NAMES_TABLE);
 }
 
 } // namespace win_api
@@ -1,6 +1,6 @@
 /**
 * @file src/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/l.cpp
-* @brief Implementation of the initialization of WinAPI functions.
+* @brief Names of parameters of WinAPI functions.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -11,262 +11,267 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
+/// Names of parameters of functions from windows.h.
+constexpr FuncParamName FUNC_PARAM_NAMES_TABLE[] = {
+	{"LCIDToLocaleName", 1, "Locale"}, // LCID
+	{"LCIDToLocaleName", 2, "lpName"}, // LPWSTR
+	{"LCIDToLocaleName", 3, "cchName"}, // int
+	{"LCIDToLocaleName", 4, "dwFlags"}, // DWORD
+	{"LCMapStringA", 1, "Locale"}, // LCID
+	{"LCMapStringA", 2, "dwMapFlags"}, // DWORD
+	{"LCMapStringA", 3, "lpSrcStr"}, // LPCSTR
+	{"LCMapStringA", 4, "cchSrc"}, // int
+	{"LCMapStringA", 5, "lpDestStr"}, // LPSTR
+	{"LCMapStringA", 6, "cchDest"}, // int
+	{"LCMapStringEx", 1, "lpLocaleName"}, // LPCWSTR
+	{"LCMapStringEx", 2, "dwMapFlags"}, // DWORD
+	{"LCMapStringEx", 3, "lpSrcStr"}, // LPCWSTR
+	{"LCMapStringEx", 4, "cchSrc"}, // int
+	{"LCMapStringEx", 5, "lpDestStr"}, // LPWSTR
+	{"LCMapStringEx", 6, "cchDest"}, // int
+	{"LCMapStringEx", 7, "lpVersionInformation"}, // LPNLSVERSIONINFO
+	{"LCMapStringEx", 8, "lpReserved"}, // LPVOID
+	{"LCMapStringEx", 9, "lParam"}, // LPARAM
+	{"LCMapStringW", 1, "Locale"}, // LCID
+	{"LCMapStringW", 2, "dwMapFlags"}, // DWORD
+	{"LCMapStringW", 3, "lpSrcStr"}, // LPCWSTR
+	{"LCMapStringW", 4, "cchSrc"}, // int
+	{"LCMapStringW", 5, "lpDestStr"}, // LPWSTR
+	{"LCMapStringW", 6, "cchDest"}, // int
+	{"LPtoDP", 1, "hdc"}, // HDC
+	{"LPtoDP", 2, "lppt"}, // LPPOINT
+	{"LPtoDP", 3, "c"}, // int
+	{"LeaveCriticalSection", 1, "lpCriticalSection"}, // LPCRITICAL_SECTION
+	{"LeaveCriticalSectionWhenCallbackReturns", 1, "pci"}, // PTP_CALLBACK_INSTANCE
+	{"LeaveCriticalSectionWhenCallbackReturns", 2, "pcs"}, // PCRITICAL_SECTION
+	{"LineDDA", 1, "xStart"}, // int
+	{"LineDDA", 2, "yStart"}, // int
+	{"LineDDA", 3, "xEnd"}, // int
+	{"LineDDA", 4, "yEnd"}, // int
+	{"LineDDA", 5, "lpProc"}, // LINEDDAPROC
+	{"LineDDA", 6, "data"}, // LPARAM
+	{"LineTo", 1, "hdc"}, // HDC
+	{"LineTo", 2, "x"}, // int
+	{"LineTo", 3, "y"}, // int
+	{"LoadAcceleratorsA", 1, "hInstance"}, // HINSTANCE
+	{"LoadAcceleratorsA", 2, "lpTableName"}, // LPCSTR
+	{"LoadAcceleratorsW", 1, "hInstance"}, // HINSTANCE
+	{"LoadAcceleratorsW", 2, "lpTableName"}, // LPCWSTR
+	{"LoadBitmapA", 1, "hInstance"}, // HINSTANCE
+	{"LoadBitmapA", 2, "lpBitmapName"}, // LPCSTR
+	{"LoadBitmapW", 1, "hInstance"}, // HINSTANCE
+	{"LoadBitmapW", 2, "lpBitmapName"}, // LPCWSTR
+	{"LoadCursorA", 1, "hInstance"}, // HINSTANCE
+	{"LoadCursorA", 2, "lpCursorName"}, // LPCSTR
+	{"LoadCursorFromFileA", 1, "lpFileName"}, // LPCSTR
+	{"LoadCursorFromFileW", 1, "lpFileName"}, // LPCWSTR
+	{"LoadCursorW", 1, "hInstance"}, // HINSTANCE
+	{"LoadCursorW", 2, "lpCursorName"}, // LPCWSTR
+	{"LoadIconA", 1, "hInstance"}, // HINSTANCE
+	{"LoadIconA", 2, "lpIconName"}, // LPCSTR
+	{"LoadIconW", 1, "hInstance"}, // HINSTANCE
+	{"LoadIconW", 2, "lpIconName"}, // LPCWSTR
+	{"LoadImageA", 1, "hInst"}, // HINSTANCE
+	{"LoadImageA", 2, "name"}, // LPCSTR
+	{"LoadImageA", 3, "type"}, // UINT
+	{"LoadImageA", 4, "cx"}, // int
+	{"LoadImageA", 5, "cy"}, // int
+	{"LoadImageA", 6, "fuLoad"}, // UINT
+	{"LoadImageW", 1, "hInst"}, // HINSTANCE
+	{"LoadImageW", 2, "name"}, // LPCWSTR
+	{"LoadImageW", 3, "type"}, // UINT
+	{"LoadImageW", 4, "cx"}, // int
+	{"LoadImageW", 5, "cy"}, // int
+	{"LoadImageW", 6, "fuLoad"}, // UINT
+	{"LoadKeyboardLayoutA", 1, "pwszKLID"}, // LPCSTR
+	{"LoadKeyboardLayoutA", 2, "Flags"}, // UINT
+	{"LoadKeyboardLayoutW", 1, "pwszKLID"}, // LPCWSTR
+	{"LoadKeyboardLayoutW", 2, "Flags"}, // UINT
+	{"LoadLibraryA", 1, "lpLibFileName"}, // LPCSTR
+	{"LoadLibraryExA", 1, "lpLibFileName"}, // LPCSTR
+	{"LoadLibraryExA", 2, "hFile"}, // HANDLE
+	{"LoadLibraryExA", 3, "dwFlags"}, // DWORD
+	{"LoadLibraryExW", 1, "lpLibFileName"}, // LPCWSTR
+	{"LoadLibraryExW", 2, "hFile"}, // HANDLE
+	{"LoadLibraryExW", 3, "dwFlags"}, // DWORD
+	{"LoadLibraryW", 1, "lpLibFileName"}, // LPCWSTR
+	{"LoadMenuA", 1, "hInstance"}, // HINSTANCE
+	{"LoadMenuA", 2, "lpMenuName"}, // LPCSTR
+	{"LoadMenuIndirectA", 1, "lpMenuTemplate"}, // CONST MENUTEMPLATEA *
+	{"LoadMenuIndirectW", 1, "lpMenuTemplate"}, // CONST MENUTEMPLATEW *
+	{"LoadMenuW", 1, "hInstance"}, // HINSTANCE
+	{"LoadMenuW", 2, "lpMenuName"}, // LPCWSTR
+	{"LoadModule", 1, "lpModuleName"}, // LPCSTR
+	{"LoadModule", 2, "lpParameterBlock"}, // LPVOID
+	{"LoadResource", 1, "hModule"}, // HMODULE
+	{"LoadResource", 2, "hResInfo"}, // HRSRC
+	{"LoadStringA", 1, "hInstance"}, // HINSTANCE
+	{"LoadStringA", 2, "uID"}, // UINT
+	{"LoadStringA", 3, "lpBuffer"}, // LPSTR
+	{"LoadStringA", 4, "cchBufferMax"}, // int
+	{"LoadStringW", 1, "hInstance"}, // HINSTANCE
+	{"LoadStringW", 2, "uID"}, // UINT
+	{"LoadStringW", 3, "lpBuffer"}, // LPWSTR
+	{"LoadStringW", 4, "cchBufferMax"}, // int
+	{"LocalAlloc", 1, "uFlags"}, // UINT
+	{"LocalAlloc", 2, "uBytes"}, // SIZE_T
+	{"LocalCompact", 1, "uMinFree"}, // UINT
+	{"LocalFileTimeToFileTime", 1, "lpLocalFileTime"}, // CONST FILETIME *
+	{"LocalFileTimeToFileTime", 2, "lpFileTime"}, // LPFILETIME
+	{"LocalFlags", 1, "hMem"}, // HLOCAL
+	{"LocalFree", 1, "hMem"}, // HLOCAL
+	{"LocalHandle", 1, "pMem"}, // LPCVOID
+	{"LocalLock", 1, "hMem"}, // HLOCAL
+	{"LocalReAlloc", 1, "hMem"}, // HLOCAL
+	{"LocalReAlloc", 2, "uBytes"}, // SIZE_T
+	{"LocalReAlloc", 3, "uFlags"}, // UINT
+	{"LocalShrink", 1, "hMem"}, // HLOCAL
+	{"LocalShrink", 2, "cbNewSize"}, // UINT
+	{"LocalSize", 1, "hMem"}, // HLOCAL
+	{"LocalUnlock", 1, "hMem"}, // HLOCAL
+	{"LocaleNameToLCID", 1, "lpName"}, // LPCWSTR
+	{"LocaleNameToLCID", 2, "dwFlags"}, // DWORD
+	{"LockFile", 1, "hFile"}, // HANDLE
+	{"LockFile", 2, "dwFileOffsetLow"}, // DWORD
+	{"LockFile", 3, "dwFileOffsetHigh"}, // DWORD
+	{"LockFile", 4, "nNumberOfBytesToLockLow"}, // DWORD
+	{"LockFile", 5, "nNumberOfBytesToLockHigh"}, // DWORD
+	{"LockFileEx", 1, "hFile"}, // HANDLE
+	{"LockFileEx", 2, "dwFlags"}, // DWORD
+	{"LockFileEx", 3, "dwReserved"}, // DWORD
+	{"LockFileEx", 4, "nNumberOfBytesToLockLow"}, // DWORD
+	{"LockFileEx", 5, "nNumberOfBytesToLockHigh"}, // DWORD
+	{"LockFileEx", 6, "lpOverlapped"}, // LPOVERLAPPED
+	{"LockResource", 1, "hResData"}, // HGLOBAL
+	{"LockServiceDatabase", 1, "hSCManager"}, // SC_HANDLE
+	{"LockSetForegroundWindow", 1, "uLockCode"}, // UINT
+	{"LockWindowUpdate", 1, "hWndLock"}, // HWND
+	{"LogonUserA", 1, "lpszUsername"}, // LPCSTR
+	{"LogonUserA", 2, "lpszDomain"}, // LPCSTR
+	{"LogonUserA", 3, "lpszPassword"}, // LPCSTR
+	{"LogonUserA", 4, "dwLogonType"}, // DWORD
+	{"LogonUserA", 5, "dwLogonProvider"}, // DWORD
+	{"LogonUserA", 6, "phToken"}, // PHANDLE
+	{"LogonUserExA", 1, "lpszUsername"}, // LPCSTR
+	{"LogonUserExA", 2, "lpszDomain"}, // LPCSTR
+	{"LogonUserExA", 3, "lpszPassword"}, // LPCSTR
+	{"LogonUserExA", 4, "dwLogonType"}, // DWORD
+	{"LogonUserExA", 5, "dwLogonProvider"}, // DWORD
+	{"LogonUserExA", 6, "phToken"}, // PHANDLE
+	{"LogonUserExA", 7, "ppLogonSid"}, // PSID *
+	{"LogonUserExA", 8, "ppProfileBuffer"}, // PVOID *
+	{"LogonUserExA", 9, "pdwProfileLength"}, // LPDWORD
+	{"LogonUserExA", 10, "pQuotaLimits"}, // PQUOTA_LIMITS
+	{"LogonUserExW", 1, "lpszUsername"}, // LPCWSTR
+	{"LogonUserExW", 2, "lpszDomain"}, // LPCWSTR
+	{"LogonUserExW", 3, "lpszPassword"}, // LPCWSTR
+	{"LogonUserExW", 4, "dwLogonType"}, // DWORD
+	{"LogonUserExW", 5, "dwLogonProvider"}, // DWORD
+	{"LogonUserExW", 6, "phToken"}, // PHANDLE
+	{"LogonUserExW", 7, "ppLogonSid"}, // PSID *
+	{"LogonUserExW", 8, "ppProfileBuffer"}, // PVOID *
+	{"LogonUserExW", 9, "pdwProfileLength"}, // LPDWORD
+	{"LogonUserExW", 10, "pQuotaLimits"}, // PQUOTA_LIMITS
+	{"LogonUserW", 1, "lpszUsername"}, // LPCWSTR
+	{"LogonUserW", 2, "lpszDomain"}, // LPCWSTR
+	{"LogonUserW", 3, "lpszPassword"}, // LPCWSTR
+	{"LogonUserW", 4, "dwLogonType"}, // DWORD
+	{"LogonUserW", 5, "dwLogonProvider"}, // DWORD
+	{"LogonUserW", 6, "phToken"}, // PHANDLE
+	{"LookupAccountNameA", 1, "lpSystemName"}, // LPCSTR
+	{"LookupAccountNameA", 2, "lpAccountName"}, // LPCSTR
+	{"LookupAccountNameA", 3, "Sid"}, // PSID
+	{"LookupAccountNameA", 4, "cbSid"}, // LPDWORD
+	{"LookupAccountNameA", 5, "ReferencedDomainName"}, // LPSTR
+	{"LookupAccountNameA", 6, "cchReferencedDomainName"}, // LPDWORD
+	{"LookupAccountNameA", 7, "peUse"}, // PSID_NAME_USE
+	{"LookupAccountNameW", 1, "lpSystemName"}, // LPCWSTR
+	{"LookupAccountNameW", 2, "lpAccountName"}, // LPCWSTR
+	{"LookupAccountNameW", 3, "Sid"}, // PSID
+	{"LookupAccountNameW", 4, "cbSid"}, // LPDWORD
+	{"LookupAccountNameW", 5, "ReferencedDomainName"}, // LPWSTR
+	{"LookupAccountNameW", 6, "cchReferencedDomainName"}, // LPDWORD
+	{"LookupAccountNameW", 7, "peUse"}, // PSID_NAME_USE
+	{"LookupAccountSidA", 1, "lpSystemName"}, // LPCSTR
+	{"LookupAccountSidA", 2, "Sid"}, // PSID
+	{"LookupAccountSidA", 3, "Name"}, // LPSTR
+	{"LookupAccountSidA", 4, "cchName"}, // LPDWORD
+	{"LookupAccountSidA", 5, "ReferencedDomainName"}, // LPSTR
+	{"LookupAccountSidA", 6, "cchReferencedDomainName"}, // LPDWORD
+	{"LookupAccountSidA", 7, "peUse"}, // PSID_NAME_USE
+	{"LookupAccountSidW", 1, "lpSystemName"}, // LPCWSTR
+	{"LookupAccountSidW", 2, "Sid"}, // PSID
+	{"LookupAccountSidW", 3, "Name"}, // LPWSTR
+	{"LookupAccountSidW", 4, "cchName"}, // LPDWORD
+	{"LookupAccountSidW", 5, "ReferencedDomainName"}, // LPWSTR
+	{"LookupAccountSidW", 6, "cchReferencedDomainName"}, // LPDWORD
+	{"LookupAccountSidW", 7, "peUse"}, // PSID_NAME_USE
+	{"LookupIconIdFromDirectory", 1, "presbits"}, // PBYTE
+	{"LookupIconIdFromDirectory", 2, "fIcon"}, // WINBOOL
+	{"LookupIconIdFromDirectoryEx", 1, "presbits"}, // PBYTE
+	{"LookupIconIdFromDirectoryEx", 2, "fIcon"}, // WINBOOL
+	{"LookupIconIdFromDirectoryEx", 3, "cxDesired"}, // int
+	{"LookupIconIdFromDirectoryEx", 4, "cyDesired"}, // int
+	{"LookupIconIdFromDirectoryEx", 5, "Flags"}, // UINT
+	{"LookupPrivilegeDisplayNameA", 1, "lpSystemName"}, // LPCSTR
+	{"LookupPrivilegeDisplayNameA", 2, "lpName"}, // LPCSTR
+	{"LookupPrivilegeDisplayNameA", 3, "lpDisplayName"}, // LPSTR
+	{"LookupPrivilegeDisplayNameA", 4, "cchDisplayName"}, // LPDWORD
+	{"LookupPrivilegeDisplayNameA", 5, "lpLanguageId"}, // LPDWORD
+	{"LookupPrivilegeDisplayNameW", 1, "lpSystemName"}, // LPCWSTR
+	{"LookupPrivilegeDisplayNameW", 2, "lpName"}, // LPCWSTR
+	{"LookupPrivilegeDisplayNameW", 3, "lpDisplayName"}, // LPWSTR
+	{"LookupPrivilegeDisplayNameW", 4, "cchDisplayName"}, // LPDWORD
+	{"LookupPrivilegeDisplayNameW", 5, "lpLanguageId"}, // LPDWORD
+	{"LookupPrivilegeNameA", 1, "lpSystemName"}, // LPCSTR
+	{"LookupPrivilegeNameA", 2, "lpLuid"}, // PLUID
+	{"LookupPrivilegeNameA", 3, "lpName"}, // LPSTR
+	{"LookupPrivilegeNameA", 4, "cchName"}, // LPDWORD
+	{"LookupPrivilegeNameW", 1, "lpSystemName"}, // LPCWSTR
+	{"LookupPrivilegeNameW", 2, "lpLuid"}, // PLUID
+	{"LookupPrivilegeNameW", 3, "lpName"}, // LPWSTR
+	{"LookupPrivilegeNameW", 4, "cchName"}, // LPDWORD
+	{"LookupPrivilegeValueA", 1, "lpSystemName"}, // LPCSTR
+	{"LookupPrivilegeValueA", 2, "lpName"}, // LPCSTR
+	{"LookupPrivilegeValueA", 3, "lpLuid"}, // PLUID
+	{"LookupPrivilegeValueW", 1, "lpSystemName"}, // LPCWSTR
+	{"LookupPrivilegeValueW", 2, "lpName"}, // LPCWSTR
+	{"LookupPrivilegeValueW", 3, "lpLuid"}, // PLUID
+	{"lstrcatA", 1, "lpString1"}, // LPSTR
+	{"lstrcatA", 2, "lpString2"}, // LPCSTR
+	{"lstrcatW", 1, "lpString1"}, // LPWSTR
+	{"lstrcatW", 2, "lpString2"}, // LPCWSTR
+	{"lstrcmpA", 1, "lpString1"}, // LPCSTR
+	{"lstrcmpA", 2, "lpString2"}, // LPCSTR
+	{"lstrcmpW", 1, "lpString1"}, // LPCWSTR
+	{"lstrcmpW", 2, "lpString2"}, // LPCWSTR
+	{"lstrcmpiA", 1, "lpString1"}, // LPCSTR
+	{"lstrcmpiA", 2, "lpString2"}, // LPCSTR
+	{"lstrcmpiW", 1, "lpString1"}, // LPCWSTR
+	{"lstrcmpiW", 2, "lpString2"}, // LPCWSTR
+	{"lstrcpyA", 1, "lpString1"}, // LPSTR
+	{"lstrcpyA", 2, "lpString2"}, // LPCSTR
+	{"lstrcpyW", 1, "lpString1"}, // LPWSTR
+	{"lstrcpyW", 2, "lpString2"}, // LPCWSTR
+	{"lstrcpynA", 1, "lpString1"}, // LPSTR
+	{"lstrcpynA", 2, "lpString2"}, // LPCSTR
+	{"lstrcpynA", 3, "iMaxLength"}, // int
+	{"lstrcpynW", 1, "lpString1"}, // LPWSTR
+	{"lstrcpynW", 2, "lpString2"}, // LPCWSTR
+	{"lstrcpynW", 3, "iMaxLength"}, // int
+	{"lstrlenA", 1, "lpString"}, // LPCSTR
+	{"lstrlenW", 1, "lpString"}, // LPCWSTR
+};
+
+} // anonymous namespace
+
 /**
-* @brief Initializes the given map with info about functions starting with L.
+* @brief Returns a table with info about functions starting with L.
 */
-void initFuncParamNamesMap_L(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
-	ADD_PARAM_NAME("LCIDToLocaleName", 1, "Locale"); // LCID
-	ADD_PARAM_NAME("LCIDToLocaleName", 2, "lpName"); // LPWSTR
-	ADD_PARAM_NAME("LCIDToLocaleName", 3, "cchName"); // int
-	ADD_PARAM_NAME("LCIDToLocaleName", 4, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("LCMapStringA", 1, "Locale"); // LCID
-	ADD_PARAM_NAME("LCMapStringA", 2, "dwMapFlags"); // DWORD
-	ADD_PARAM_NAME("LCMapStringA", 3, "lpSrcStr"); // LPCSTR
-	ADD_PARAM_NAME("LCMapStringA", 4, "cchSrc"); // int
-	ADD_PARAM_NAME("LCMapStringA", 5, "lpDestStr"); // LPSTR
-	ADD_PARAM_NAME("LCMapStringA", 6, "cchDest"); // int
-	ADD_PARAM_NAME("LCMapStringEx", 1, "lpLocaleName"); // LPCWSTR
-	ADD_PARAM_NAME("LCMapStringEx", 2, "dwMapFlags"); // DWORD
-	ADD_PARAM_NAME("LCMapStringEx", 3, "lpSrcStr"); // LPCWSTR
-	ADD_PARAM_NAME("LCMapStringEx", 4, "cchSrc"); // int
-	ADD_PARAM_NAME("LCMapStringEx", 5, "lpDestStr"); // LPWSTR
-	ADD_PARAM_NAME("LCMapStringEx", 6, "cchDest"); // int
-	ADD_PARAM_NAME("LCMapStringEx", 7, "lpVersionInformation"); // LPNLSVERSIONINFO
-	ADD_PARAM_NAME("LCMapStringEx", 8, "lpReserved"); // LPVOID
-	ADD_PARAM_NAME("LCMapStringEx", 9, "lParam"); // LPARAM
-	ADD_PARAM_NAME("LCMapStringW", 1, "Locale"); // LCID
-	ADD_PARAM_NAME("LCMapStringW", 2, "dwMapFlags"); // DWORD
-	ADD_PARAM_NAME("LCMapStringW", 3, "lpSrcStr"); // LPCWSTR
-	ADD_PARAM_NAME("LCMapStringW", 4, "cchSrc"); // int
-	ADD_PARAM_NAME("LCMapStringW", 5, "lpDestStr"); // LPWSTR
-	ADD_PARAM_NAME("LCMapStringW", 6, "cchDest"); // int
-	ADD_PARAM_NAME("LPtoDP", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("LPtoDP", 2, "lppt"); // LPPOINT
-	ADD_PARAM_NAME("LPtoDP", 3, "c"); // int
-	ADD_PARAM_NAME("LeaveCriticalSection", 1, "lpCriticalSection"); // LPCRITICAL_SECTION
-	ADD_PARAM_NAME("LeaveCriticalSectionWhenCallbackReturns", 1, "pci"); // PTP_CALLBACK_INSTANCE
-	ADD_PARAM_NAME("LeaveCriticalSectionWhenCallbackReturns", 2, "pcs"); // PCRITICAL_SECTION
-	ADD_PARAM_NAME("LineDDA", 1, "xStart"); // int
-	ADD_PARAM_NAME("LineDDA", 2, "yStart"); // int
-	ADD_PARAM_NAME("LineDDA", 3, "xEnd"); // int
-	ADD_PARAM_NAME("LineDDA", 4, "yEnd"); // int
-	ADD_PARAM_NAME("LineDDA", 5, "lpProc"); // LINEDDAPROC
-	ADD_PARAM_NAME("LineDDA", 6, "data"); // LPARAM
-	ADD_PARAM_NAME("LineTo", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("LineTo", 2, "x"); // int
-	ADD_PARAM_NAME("LineTo", 3, "y"); // int
-	ADD_PARAM_NAME("LoadAcceleratorsA", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("LoadAcceleratorsA", 2, "lpTableName"); // LPCSTR
-	ADD_PARAM_NAME("LoadAcceleratorsW", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("LoadAcceleratorsW", 2, "lpTableName"); // LPCWSTR
-	ADD_PARAM_NAME("LoadBitmapA", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("LoadBitmapA", 2, "lpBitmapName"); // LPCSTR
-	ADD_PARAM_NAME("LoadBitmapW", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("LoadBitmapW", 2, "lpBitmapName"); // LPCWSTR
-	ADD_PARAM_NAME("LoadCursorA", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("LoadCursorA", 2, "lpCursorName"); // LPCSTR
-	ADD_PARAM_NAME("LoadCursorFromFileA", 1, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("LoadCursorFromFileW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("LoadCursorW", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("LoadCursorW", 2, "lpCursorName"); // LPCWSTR
-	ADD_PARAM_NAME("LoadIconA", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("LoadIconA", 2, "lpIconName"); // LPCSTR
-	ADD_PARAM_NAME("LoadIconW", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("LoadIconW", 2, "lpIconName"); // LPCWSTR
-	ADD_PARAM_NAME("LoadImageA", 1, "hInst"); // HINSTANCE
-	ADD_PARAM_NAME("LoadImageA", 2, "name"); // LPCSTR
-	ADD_PARAM_NAME("LoadImageA", 3, "type"); // UINT
-	ADD_PARAM_NAME("LoadImageA", 4, "cx"); // int
-	ADD_PARAM_NAME("LoadImageA", 5, "cy"); // int
-	ADD_PARAM_NAME("LoadImageA", 6, "fuLoad"); // UINT
-	ADD_PARAM_NAME("LoadImageW", 1, "hInst"); // HINSTANCE
-	ADD_PARAM_NAME("LoadImageW", 2, "name"); // LPCWSTR
-	ADD_PARAM_NAME("LoadImageW", 3, "type"); // UINT
-	ADD_PARAM_NAME("LoadImageW", 4, "cx"); // int
-	ADD_PARAM_NAME("LoadImageW", 5, "cy"); // int
-	ADD_PARAM_NAME("LoadImageW", 6, "fuLoad"); // UINT
-	ADD_PARAM_NAME("LoadKeyboardLayoutA", 1, "pwszKLID"); // LPCSTR
-	ADD_PARAM_NAME("LoadKeyboardLayoutA", 2, "Flags"); // UINT
-	ADD_PARAM_NAME("LoadKeyboardLayoutW", 1, "pwszKLID"); // LPCWSTR
-	ADD_PARAM_NAME("LoadKeyboardLayoutW", 2, "Flags"); // UINT
-	ADD_PARAM_NAME("LoadLibraryA", 1, "lpLibFileName"); // LPCSTR
-	ADD_PARAM_NAME("LoadLibraryExA", 1, "lpLibFileName"); // LPCSTR
-	ADD_PARAM_NAME("LoadLibraryExA", 2, "hFile"); // HANDLE
-	ADD_PARAM_NAME("LoadLibraryExA", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("LoadLibraryExW", 1, "lpLibFileName"); // LPCWSTR
-	ADD_PARAM_NAME("LoadLibraryExW", 2, "hFile"); // HANDLE
-	ADD_PARAM_NAME("LoadLibraryExW", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("LoadLibraryW", 1, "lpLibFileName"); // LPCWSTR
-	ADD_PARAM_NAME("LoadMenuA", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("LoadMenuA", 2, "lpMenuName"); // LPCSTR
-	ADD_PARAM_NAME("LoadMenuIndirectA", 1, "lpMenuTemplate"); // CONST MENUTEMPLATEA *
-	ADD_PARAM_NAME("LoadMenuIndirectW", 1, "lpMenuTemplate"); // CONST MENUTEMPLATEW *
-	ADD_PARAM_NAME("LoadMenuW", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("LoadMenuW", 2, "lpMenuName"); // LPCWSTR
-	ADD_PARAM_NAME("LoadModule", 1, "lpModuleName"); // LPCSTR
-	ADD_PARAM_NAME("LoadModule", 2, "lpParameterBlock"); // LPVOID
-	ADD_PARAM_NAME("LoadResource", 1, "hModule"); // HMODULE
-	ADD_PARAM_NAME("LoadResource", 2, "hResInfo"); // HRSRC
-	ADD_PARAM_NAME("LoadStringA", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("LoadStringA", 2, "uID"); // UINT
-	ADD_PARAM_NAME("LoadStringA", 3, "lpBuffer"); // LPSTR
-	ADD_PARAM_NAME("LoadStringA", 4, "cchBufferMax"); // int
-	ADD_PARAM_NAME("LoadStringW", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("LoadStringW", 2, "uID"); // UINT
-	ADD_PARAM_NAME("LoadStringW", 3, "lpBuffer"); // LPWSTR
-	ADD_PARAM_NAME("LoadStringW", 4, "cchBufferMax"); // int
-	ADD_PARAM_NAME("LocalAlloc", 1, "uFlags"); // UINT
-	ADD_PARAM_NAME("LocalAlloc", 2, "uBytes"); // SIZE_T
-	ADD_PARAM_NAME("LocalCompact", 1, "uMinFree"); // UINT
-	ADD_PARAM_NAME("LocalFileTimeToFileTime", 1, "lpLocalFileTime"); // CONST FILETIME *
-	ADD_PARAM_NAME("LocalFileTimeToFileTime", 2, "lpFileTime"); // LPFILETIME
-	ADD_PARAM_NAME("LocalFlags", 1, "hMem"); // HLOCAL
-	ADD_PARAM_NAME("LocalFree", 1, "hMem"); // HLOCAL
-	ADD_PARAM_NAME("LocalHandle", 1, "pMem"); // LPCVOID
-	ADD_PARAM_NAME("LocalLock", 1, "hMem"); // HLOCAL
-	ADD_PARAM_NAME("LocalReAlloc", 1, "hMem"); // HLOCAL
-	ADD_PARAM_NAME("LocalReAlloc", 2, "uBytes"); // SIZE_T
-	ADD_PARAM_NAME("LocalReAlloc", 3, "uFlags"); // UINT
-	ADD_PARAM_NAME("LocalShrink", 1, "hMem"); // HLOCAL
-	ADD_PARAM_NAME("LocalShrink", 2, "cbNewSize"); // UINT
-	ADD_PARAM_NAME("LocalSize", 1, "hMem"); // HLOCAL
-	ADD_PARAM_NAME("LocalUnlock", 1, "hMem"); // HLOCAL
-	ADD_PARAM_NAME("LocaleNameToLCID", 1, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("LocaleNameToLCID", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("LockFile", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("LockFile", 2, "dwFileOffsetLow"); // DWORD
-	ADD_PARAM_NAME("LockFile", 3, "dwFileOffsetHigh"); // DWORD
-	ADD_PARAM_NAME("LockFile", 4, "nNumberOfBytesToLockLow"); // DWORD
-	ADD_PARAM_NAME("LockFile", 5, "nNumberOfBytesToLockHigh"); // DWORD
-	ADD_PARAM_NAME("LockFileEx", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("LockFileEx", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("LockFileEx", 3, "dwReserved"); // DWORD
-	ADD_PARAM_NAME("LockFileEx", 4, "nNumberOfBytesToLockLow"); // DWORD
-	ADD_PARAM_NAME("LockFileEx", 5, "nNumberOfBytesToLockHigh"); // DWORD
-	ADD_PARAM_NAME("LockFileEx", 6, "lpOverlapped"); // LPOVERLAPPED
-	ADD_PARAM_NAME("LockResource", 1, "hResData"); // HGLOBAL
-	ADD_PARAM_NAME("LockServiceDatabase", 1, "hSCManager"); // SC_HANDLE
-	ADD_PARAM_NAME("LockSetForegroundWindow", 1, "uLockCode"); // UINT
-	ADD_PARAM_NAME("LockWindowUpdate", 1, "hWndLock"); // HWND
-	ADD_PARAM_NAME("LogonUserA", 1, "lpszUsername"); // LPCSTR
-	ADD_PARAM_NAME("LogonUserA", 2, "lpszDomain"); // LPCSTR
-	ADD_PARAM_NAME("LogonUserA", 3, "lpszPassword"); // LPCSTR
-	ADD_PARAM_NAME("LogonUserA", 4, "dwLogonType"); // DWORD
-	ADD_PARAM_NAME("LogonUserA", 5, "dwLogonProvider"); // DWORD
-	ADD_PARAM_NAME("LogonUserA", 6, "phToken"); // PHANDLE
-	ADD_PARAM_NAME("LogonUserExA", 1, "lpszUsername"); // LPCSTR
-	ADD_PARAM_NAME("LogonUserExA", 2, "lpszDomain"); // LPCSTR
-	ADD_PARAM_NAME("LogonUserExA", 3, "lpszPassword"); // LPCSTR
-	ADD_PARAM_NAME("LogonUserExA", 4, "dwLogonType"); // DWORD
-	ADD_PARAM_NAME("LogonUserExA", 5, "dwLogonProvider"); // DWORD
-	ADD_PARAM_NAME("LogonUserExA", 6, "phToken"); // PHANDLE
-	ADD_PARAM_NAME("LogonUserExA", 7, "ppLogonSid"); // PSID *
-	ADD_PARAM_NAME("LogonUserExA", 8, "ppProfileBuffer"); // PVOID *
-	ADD_PARAM_NAME("LogonUserExA", 9, "pdwProfileLength"); // LPDWORD
-	ADD_PARAM_NAME("LogonUserExA", 10, "pQuotaLimits"); // PQUOTA_LIMITS
-	ADD_PARAM_NAME("LogonUserExW", 1, "lpszUsername"); // LPCWSTR
-	ADD_PARAM_NAME("LogonUserExW", 2, "lpszDomain"); // LPCWSTR
-	ADD_PARAM_NAME("LogonUserExW", 3, "lpszPassword"); // LPCWSTR
-	ADD_PARAM_NAME("LogonUserExW", 4, "dwLogonType"); // DWORD
-	ADD_PARAM_NAME("LogonUserExW", 5, "dwLogonProvider"); // DWORD
-	ADD_PARAM_NAME("LogonUserExW", 6, "phToken"); // PHANDLE
-	ADD_PARAM_NAME("LogonUserExW", 7, "ppLogonSid"); // PSID *
-	ADD_PARAM_NAME("LogonUserExW", 8, "ppProfileBuffer"); // PVOID *
-	ADD_PARAM_NAME("LogonUserExW", 9, "pdwProfileLength"); // LPDWORD
-	ADD_PARAM_NAME("LogonUserExW", 10, "pQuotaLimits"); // PQUOTA_LIMITS
-	ADD_PARAM_NAME("LogonUserW", 1, "lpszUsername"); // LPCWSTR
-	ADD_PARAM_NAME("LogonUserW", 2, "lpszDomain"); // LPCWSTR
-	ADD_PARAM_NAME("LogonUserW", 3, "lpszPassword"); // LPCWSTR
-	ADD_PARAM_NAME("LogonUserW", 4, "dwLogonType"); // DWORD
-	ADD_PARAM_NAME("LogonUserW", 5, "dwLogonProvider"); // DWORD
-	ADD_PARAM_NAME("LogonUserW", 6, "phToken"); // PHANDLE
-	ADD_PARAM_NAME("LookupAccountNameA", 1, "lpSystemName"); // LPCSTR
-	ADD_PARAM_NAME("LookupAccountNameA", 2, "lpAccountName"); // LPCSTR
-	ADD_PARAM_NAME("LookupAccountNameA", 3, "Sid"); // PSID
-	ADD_PARAM_NAME("LookupAccountNameA", 4, "cbSid"); // LPDWORD
-	ADD_PARAM_NAME("LookupAccountNameA", 5, "ReferencedDomainName"); // LPSTR
-	ADD_PARAM_NAME("LookupAccountNameA", 6, "cchReferencedDomainName"); // LPDWORD
-	ADD_PARAM_NAME("LookupAccountNameA", 7, "peUse"); // PSID_NAME_USE
-	ADD_PARAM_NAME("LookupAccountNameW", 1, "lpSystemName"); // LPCWSTR
-	ADD_PARAM_NAME("LookupAccountNameW", 2, "lpAccountName"); // LPCWSTR
-	ADD_PARAM_NAME("LookupAccountNameW", 3, "Sid"); // PSID
-	ADD_PARAM_NAME("LookupAccountNameW", 4, "cbSid"); // LPDWORD
-	ADD_PARAM_NAME("LookupAccountNameW", 5, "ReferencedDomainName"); // LPWSTR
-	ADD_PARAM_NAME("LookupAccountNameW", 6, "cchReferencedDomainName"); // LPDWORD
-	ADD_PARAM_NAME("LookupAccountNameW", 7, "peUse"); // PSID_NAME_USE
-	ADD_PARAM_NAME("LookupAccountSidA", 1, "lpSystemName"); // LPCSTR
-	ADD_PARAM_NAME("LookupAccountSidA", 2, "Sid"); // PSID
-	ADD_PARAM_NAME("LookupAccountSidA", 3, "Name"); // LPSTR
-	ADD_PARAM_NAME("LookupAccountSidA", 4, "cchName"); // LPDWORD
-	ADD_PARAM_NAME("LookupAccountSidA", 5, "ReferencedDomainName"); // LPSTR
-	ADD_PARAM_NAME("LookupAccountSidA", 6, "cchReferencedDomainName"); // LPDWORD
-	ADD_PARAM_NAME("LookupAccountSidA", 7, "peUse"); // PSID_NAME_USE
-	ADD_PARAM_NAME("LookupAccountSidW", 1, "lpSystemName"); // LPCWSTR
-	ADD_PARAM_NAME("LookupAccountSidW", 2, "Sid"); // PSID
-	ADD_PARAM_NAME("LookupAccountSidW", 3, "Name"); // LPWSTR
-	ADD_PARAM_NAME("LookupAccountSidW", 4, "cchName"); // LPDWORD
-	ADD_PARAM_NAME("LookupAccountSidW", 5, "ReferencedDomainName"); // LPWSTR
-	ADD_PARAM_NAME("LookupAccountSidW", 6, "cchReferencedDomainName"); // LPDWORD
-	ADD_PARAM_NAME("LookupAccountSidW", 7, "peUse"); // PSID_NAME_USE
-	ADD_PARAM_NAME("LookupIconIdFromDirectory", 1, "presbits"); // PBYTE
-	ADD_PARAM_NAME("LookupIconIdFromDirectory", 2, "fIcon"); // WINBOOL
-	ADD_PARAM_NAME("LookupIconIdFromDirectoryEx", 1, "presbits"); // PBYTE
-	ADD_PARAM_NAME("LookupIconIdFromDirectoryEx", 2, "fIcon"); // WINBOOL
-	ADD_PARAM_NAME("LookupIconIdFromDirectoryEx", 3, "cxDesired"); // int
-	ADD_PARAM_NAME("LookupIconIdFromDirectoryEx", 4, "cyDesired"); // int
-	ADD_PARAM_NAME("LookupIconIdFromDirectoryEx", 5, "Flags"); // UINT
-	ADD_PARAM_NAME("LookupPrivilegeDisplayNameA", 1, "lpSystemName"); // LPCSTR
-	ADD_PARAM_NAME("LookupPrivilegeDisplayNameA", 2, "lpName"); // LPCSTR
-	ADD_PARAM_NAME("LookupPrivilegeDisplayNameA", 3, "lpDisplayName"); // LPSTR
-	ADD_PARAM_NAME("LookupPrivilegeDisplayNameA", 4, "cchDisplayName"); // LPDWORD
-	ADD_PARAM_NAME("LookupPrivilegeDisplayNameA", 5, "lpLanguageId"); // LPDWORD
-	ADD_PARAM_NAME("LookupPrivilegeDisplayNameW", 1, "lpSystemName"); // LPCWSTR
-	ADD_PARAM_NAME("LookupPrivilegeDisplayNameW", 2, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("LookupPrivilegeDisplayNameW", 3, "lpDisplayName"); // LPWSTR
-	ADD_PARAM_NAME("LookupPrivilegeDisplayNameW", 4, "cchDisplayName"); // LPDWORD
-	ADD_PARAM_NAME("LookupPrivilegeDisplayNameW", 5, "lpLanguageId"); // LPDWORD
-	ADD_PARAM_NAME("LookupPrivilegeNameA", 1, "lpSystemName"); // LPCSTR
-	ADD_PARAM_NAME("LookupPrivilegeNameA", 2, "lpLuid"); // PLUID
-	ADD_PARAM_NAME("LookupPrivilegeNameA", 3, "lpName"); // LPSTR
-	ADD_PARAM_NAME("LookupPrivilegeNameA", 4, "cchName"); // LPDWORD
-	ADD_PARAM_NAME("LookupPrivilegeNameW", 1, "lpSystemName"); // LPCWSTR
-	ADD_PARAM_NAME("LookupPrivilegeNameW", 2, "lpLuid"); // PLUID
-	ADD_PARAM_NAME("LookupPrivilegeNameW", 3, "lpName"); // LPWSTR
-	ADD_PARAM_NAME("LookupPrivilegeNameW", 4, "cchName"); // LPDWORD
-	ADD_PARAM_NAME("LookupPrivilegeValueA", 1, "lpSystemName"); // LPCSTR
-	ADD_PARAM_NAME("LookupPrivilegeValueA", 2, "lpName"); // LPCSTR
-	ADD_PARAM_NAME("LookupPrivilegeValueA", 3, "lpLuid"); // PLUID
-	ADD_PARAM_NAME("LookupPrivilegeValueW", 1, "lpSystemName"); // LPCWSTR
-	ADD_PARAM_NAME("LookupPrivilegeValueW", 2, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("LookupPrivilegeValueW", 3, "lpLuid"); // PLUID
-
-	ADD_PARAM_NAME("lstrcatA", 1, "lpString1"); // LPSTR
-	ADD_PARAM_NAME("lstrcatA", 2, "lpString2"); // LPCSTR
-	ADD_PARAM_NAME("lstrcatW", 1, "lpString1"); // LPWSTR
-	ADD_PARAM_NAME("lstrcatW", 2, "lpString2"); // LPCWSTR
-	ADD_PARAM_NAME("lstrcmpA", 1, "lpString1"); // LPCSTR
-	ADD_PARAM_NAME("lstrcmpA", 2, "lpString2"); // LPCSTR
-	ADD_PARAM_NAME("lstrcmpW", 1, "lpString1"); // LPCWSTR
-	ADD_PARAM_NAME("lstrcmpW", 2, "lpString2"); // LPCWSTR
-	ADD_PARAM_NAME("lstrcmpiA", 1, "lpString1"); // LPCSTR
-	ADD_PARAM_NAME("lstrcmpiA", 2, "lpString2"); // LPCSTR
-	ADD_PARAM_NAME("lstrcmpiW", 1, "lpString1"); // LPCWSTR
-	ADD_PARAM_NAME("lstrcmpiW", 2, "lpString2"); // LPCWSTR
-	ADD_PARAM_NAME("lstrcpyA", 1, "lpString1"); // LPSTR
-	ADD_PARAM_NAME("lstrcpyA", 2, "lpString2"); // LPCSTR
-	ADD_PARAM_NAME("lstrcpyW", 1, "lpString1"); // LPWSTR
-	ADD_PARAM_NAME("lstrcpyW", 2, "lpString2"); // LPCWSTR
-	ADD_PARAM_NAME("lstrcpynA", 1, "lpString1"); // LPSTR
-	ADD_PARAM_NAME("lstrcpynA", 2, "lpString2"); // LPCSTR
-	ADD_PARAM_NAME("lstrcpynA", 3, "iMaxLength"); // int
-	ADD_PARAM_NAME("lstrcpynW", 1, "lpString1"); // LPWSTR
-	ADD_PARAM_NAME("lstrcpynW", 2, "lpString2"); // LPCWSTR
-	ADD_PARAM_NAME("lstrcpynW", 3, "iMaxLength"); // int
-	ADD_PARAM_NAME("lstrlenA", 1, "lpString"); // LPCSTR
-	ADD_PARAM_NAME("lstrlenW", 1, "lpString"); // LPCWSTR
+FuncParamNamesTable getFuncParamNamesTable_L() {
+	return makeFuncParamNamesTable(FUNC_PARAM_NAMES_TABLE);
 }
 
 } // namespace win_api
@@ -1,6 +1,6 @@
 /**
 * @file src/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/s.cpp
-* @brief Implementation of the initialization of WinAPI functions.
+* @brief Names of parameters of WinAPI functions.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -11,1337 +11,1343 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
+/// Names of parameters of functions from windows.h.
+constexpr FuncParamName FUNC_PARAM_NAMES_TABLE[] = {
+	{"SCardAddReaderToGroupA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardAddReaderToGroupA", 2, "szReaderName"}, // LPCSTR
+	{"SCardAddReaderToGroupA", 3, "szGroupName"}, // LPCSTR
+	{"SCardAddReaderToGroupW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardAddReaderToGroupW", 2, "szReaderName"}, // LPCWSTR
+	{"SCardAddReaderToGroupW", 3, "szGroupName"}, // LPCWSTR
+	{"SCardBeginTransaction", 1, "hCard"}, // SCARDHANDLE
+	{"SCardCancel", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardCancelTransaction", 1, "hCard"}, // SCARDHANDLE
+	{"SCardConnectA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardConnectA", 2, "szReader"}, // LPCSTR
+	{"SCardConnectA", 3, "dwShareMode"}, // DWORD
+	{"SCardConnectA", 4, "dwPreferredProtocols"}, // DWORD
+	{"SCardConnectA", 5, "phCard"}, // LPSCARDHANDLE
+	{"SCardConnectA", 6, "pdwActiveProtocol"}, // LPDWORD
+	{"SCardConnectW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardConnectW", 2, "szReader"}, // LPCWSTR
+	{"SCardConnectW", 3, "dwShareMode"}, // DWORD
+	{"SCardConnectW", 4, "dwPreferredProtocols"}, // DWORD
+	{"SCardConnectW", 5, "phCard"}, // LPSCARDHANDLE
+	{"SCardConnectW", 6, "pdwActiveProtocol"}, // LPDWORD
+	{"SCardControl", 1, "hCard"}, // SCARDHANDLE
+	{"SCardControl", 2, "dwControlCode"}, // DWORD
+	{"SCardControl", 3, "lpInBuffer"}, // LPCVOID
+	{"SCardControl", 4, "nInBufferSize"}, // DWORD
+	{"SCardControl", 5, "lpOutBuffer"}, // LPVOID
+	{"SCardControl", 6, "nOutBufferSize"}, // DWORD
+	{"SCardControl", 7, "lpBytesReturned"}, // LPDWORD
+	{"SCardDisconnect", 1, "hCard"}, // SCARDHANDLE
+	{"SCardDisconnect", 2, "dwDisposition"}, // DWORD
+	{"SCardEndTransaction", 1, "hCard"}, // SCARDHANDLE
+	{"SCardEndTransaction", 2, "dwDisposition"}, // DWORD
+	{"SCardEstablishContext", 1, "dwScope"}, // DWORD
+	{"SCardEstablishContext", 2, "pvReserved1"}, // LPCVOID
+	{"SCardEstablishContext", 3, "pvReserved2"}, // LPCVOID
+	{"SCardEstablishContext", 4, "phContext"}, // LPSCARDCONTEXT
+	{"SCardForgetCardTypeA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardForgetCardTypeA", 2, "szCardName"}, // LPCSTR
+	{"SCardForgetCardTypeW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardForgetCardTypeW", 2, "szCardName"}, // LPCWSTR
+	{"SCardForgetReaderA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardForgetReaderA", 2, "szReaderName"}, // LPCSTR
+	{"SCardForgetReaderGroupA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardForgetReaderGroupA", 2, "szGroupName"}, // LPCSTR
+	{"SCardForgetReaderGroupW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardForgetReaderGroupW", 2, "szGroupName"}, // LPCWSTR
+	{"SCardForgetReaderW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardForgetReaderW", 2, "szReaderName"}, // LPCWSTR
+	{"SCardFreeMemory", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardFreeMemory", 2, "pvMem"}, // LPCVOID
+	{"SCardGetAttrib", 1, "hCard"}, // SCARDHANDLE
+	{"SCardGetAttrib", 2, "dwAttrId"}, // DWORD
+	{"SCardGetAttrib", 3, "pbAttr"}, // LPBYTE
+	{"SCardGetAttrib", 4, "pcbAttrLen"}, // LPDWORD
+	{"SCardGetCardTypeProviderNameA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardGetCardTypeProviderNameA", 2, "szCardName"}, // LPCSTR
+	{"SCardGetCardTypeProviderNameA", 3, "dwProviderId"}, // DWORD
+	{"SCardGetCardTypeProviderNameA", 4, "szProvider"}, // LPSTR
+	{"SCardGetCardTypeProviderNameA", 5, "pcchProvider"}, // LPDWORD
+	{"SCardGetCardTypeProviderNameW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardGetCardTypeProviderNameW", 2, "szCardName"}, // LPCWSTR
+	{"SCardGetCardTypeProviderNameW", 3, "dwProviderId"}, // DWORD
+	{"SCardGetCardTypeProviderNameW", 4, "szProvider"}, // LPWSTR
+	{"SCardGetCardTypeProviderNameW", 5, "pcchProvider"}, // LPDWORD
+	{"SCardGetProviderIdA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardGetProviderIdA", 2, "szCard"}, // LPCSTR
+	{"SCardGetProviderIdA", 3, "pguidProviderId"}, // LPGUID
+	{"SCardGetProviderIdW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardGetProviderIdW", 2, "szCard"}, // LPCWSTR
+	{"SCardGetProviderIdW", 3, "pguidProviderId"}, // LPGUID
+	{"SCardGetStatusChangeA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardGetStatusChangeA", 2, "dwTimeout"}, // DWORD
+	{"SCardGetStatusChangeA", 3, "rgReaderStates"}, // LPSCARD_READERSTATEA
+	{"SCardGetStatusChangeA", 4, "cReaders"}, // DWORD
+	{"SCardGetStatusChangeW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardGetStatusChangeW", 2, "dwTimeout"}, // DWORD
+	{"SCardGetStatusChangeW", 3, "rgReaderStates"}, // LPSCARD_READERSTATEW
+	{"SCardGetStatusChangeW", 4, "cReaders"}, // DWORD
+	{"SCardGetTransmitCount", 1, "hCard"}, // SCARDHANDLE
+	{"SCardGetTransmitCount", 2, "pcTransmitCount"}, // LPDWORD
+	{"SCardIntroduceCardTypeA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardIntroduceCardTypeA", 2, "szCardName"}, // LPCSTR
+	{"SCardIntroduceCardTypeA", 3, "pguidPrimaryProvider"}, // LPCGUID
+	{"SCardIntroduceCardTypeA", 4, "rgguidInterfaces"}, // LPCGUID
+	{"SCardIntroduceCardTypeA", 5, "dwInterfaceCount"}, // DWORD
+	{"SCardIntroduceCardTypeA", 6, "pbAtr"}, // LPCBYTE
+	{"SCardIntroduceCardTypeA", 7, "pbAtrMask"}, // LPCBYTE
+	{"SCardIntroduceCardTypeA", 8, "cbAtrLen"}, // DWORD
+	{"SCardIntroduceCardTypeW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardIntroduceCardTypeW", 2, "szCardName"}, // LPCWSTR
+	{"SCardIntroduceCardTypeW", 3, "pguidPrimaryProvider"}, // LPCGUID
+	{"SCardIntroduceCardTypeW", 4, "rgguidInterfaces"}, // LPCGUID
+	{"SCardIntroduceCardTypeW", 5, "dwInterfaceCount"}, // DWORD
+	{"SCardIntroduceCardTypeW", 6, "pbAtr"}, // LPCBYTE
+	{"SCardIntroduceCardTypeW", 7, "pbAtrMask"}, // LPCBYTE
+	{"SCardIntroduceCardTypeW", 8, "cbAtrLen"}, // DWORD
+	{"SCardIntroduceReaderA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardIntroduceReaderA", 2, "szReaderName"}, // LPCSTR
+	{"SCardIntroduceReaderA", 3, "szDeviceName"}, // LPCSTR
+	{"SCardIntroduceReaderGroupA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardIntroduceReaderGroupA", 2, "szGroupName"}, // LPCSTR
+	{"SCardIntroduceReaderGroupW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardIntroduceReaderGroupW", 2, "szGroupName"}, // LPCWSTR
+	{"SCardIntroduceReaderW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardIntroduceReaderW", 2, "szReaderName"}, // LPCWSTR
+	{"SCardIntroduceReaderW", 3, "szDeviceName"}, // LPCWSTR
+	{"SCardIsValidContext", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardListCardsA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardListCardsA", 2, "pbAtr"}, // LPCBYTE
+	{"SCardListCardsA", 3, "rgquidInterfaces"}, // LPCGUID
+	{"SCardListCardsA", 4, "cguidInterfaceCount"}, // DWORD
+	{"SCardListCardsA", 5, "mszCards"}, // LPSTR
+	{"SCardListCardsA", 6, "pcchCards"}, // LPDWORD
+	{"SCardListCardsW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardListCardsW", 2, "pbAtr"}, // LPCBYTE
+	{"SCardListCardsW", 3, "rgquidInterfaces"}, // LPCGUID
+	{"SCardListCardsW", 4, "cguidInterfaceCount"}, // DWORD
+	{"SCardListCardsW", 5, "mszCards"}, // LPWSTR
+	{"SCardListCardsW", 6, "pcchCards"}, // LPDWORD
+	{"SCardListInterfacesA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardListInterfacesA", 2, "szCard"}, // LPCSTR
+	{"SCardListInterfacesA", 3, "pguidInterfaces"}, // LPGUID
+	{"SCardListInterfacesA", 4, "pcguidInterfaces"}, // LPDWORD
+	{"SCardListInterfacesW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardListInterfacesW", 2, "szCard"}, // LPCWSTR
+	{"SCardListInterfacesW", 3, "pguidInterfaces"}, // LPGUID
+	{"SCardListInterfacesW", 4, "pcguidInterfaces"}, // LPDWORD
+	{"SCardListReaderGroupsA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardListReaderGroupsA", 2, "mszGroups"}, // LPSTR
+	{"SCardListReaderGroupsA", 3, "pcchGroups"}, // LPDWORD
+	{"SCardListReaderGroupsW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardListReaderGroupsW", 2, "mszGroups"}, // LPWSTR
+	{"SCardListReaderGroupsW", 3, "pcchGroups"}, // LPDWORD
+	{"SCardListReadersA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardListReadersA", 2, "mszGroups"}, // LPCSTR
+	{"SCardListReadersA", 3, "mszReaders"}, // LPSTR
+	{"SCardListReadersA", 4, "pcchReaders"}, // LPDWORD
+	{"SCardListReadersW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardListReadersW", 2, "mszGroups"}, // LPCWSTR
+	{"SCardListReadersW", 3, "mszReaders"}, // LPWSTR
+	{"SCardListReadersW", 4, "pcchReaders"}, // LPDWORD
+	{"SCardLocateCardsA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardLocateCardsA", 2, "mszCards"}, // LPCSTR
+	{"SCardLocateCardsA", 3, "rgReaderStates"}, // LPSCARD_READERSTATEA
+	{"SCardLocateCardsA", 4, "cReaders"}, // DWORD
+	{"SCardLocateCardsByATRA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardLocateCardsByATRA", 2, "rgAtrMasks"}, // LPSCARD_ATRMASK
+	{"SCardLocateCardsByATRA", 3, "cAtrs"}, // DWORD
+	{"SCardLocateCardsByATRA", 4, "rgReaderStates"}, // LPSCARD_READERSTATEA
+	{"SCardLocateCardsByATRA", 5, "cReaders"}, // DWORD
+	{"SCardLocateCardsByATRW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardLocateCardsByATRW", 2, "rgAtrMasks"}, // LPSCARD_ATRMASK
+	{"SCardLocateCardsByATRW", 3, "cAtrs"}, // DWORD
+	{"SCardLocateCardsByATRW", 4, "rgReaderStates"}, // LPSCARD_READERSTATEW
+	{"SCardLocateCardsByATRW", 5, "cReaders"}, // DWORD
+	{"SCardLocateCardsW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardLocateCardsW", 2, "mszCards"}, // LPCWSTR
+	{"SCardLocateCardsW", 3, "rgReaderStates"}, // LPSCARD_READERSTATEW
+	{"SCardLocateCardsW", 4, "cReaders"}, // DWORD
+	{"SCardReadCacheA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardReadCacheA", 2, "CardIdentifier"}, // UUID *
+	{"SCardReadCacheA", 3, "FreshnessCounter"}, // DWORD
+	{"SCardReadCacheA", 4, "LookupName"}, // LPSTR
+	{"SCardReadCacheA", 5, "Data"}, // PBYTE
+	{"SCardReadCacheA", 6, "DataLen"}, // DWORD *
+	{"SCardReadCacheW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardReadCacheW", 2, "CardIdentifier"}, // UUID *
+	{"SCardReadCacheW", 3, "FreshnessCounter"}, // DWORD
+	{"SCardReadCacheW", 4, "LookupName"}, // LPWSTR
+	{"SCardReadCacheW", 5, "Data"}, // PBYTE
+	{"SCardReadCacheW", 6, "DataLen"}, // DWORD *
+	{"SCardReconnect", 1, "hCard"}, // SCARDHANDLE
+	{"SCardReconnect", 2, "dwShareMode"}, // DWORD
+	{"SCardReconnect", 3, "dwPreferredProtocols"}, // DWORD
+	{"SCardReconnect", 4, "dwInitialization"}, // DWORD
+	{"SCardReconnect", 5, "pdwActiveProtocol"}, // LPDWORD
+	{"SCardReleaseContext", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardRemoveReaderFromGroupA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardRemoveReaderFromGroupA", 2, "szReaderName"}, // LPCSTR
+	{"SCardRemoveReaderFromGroupA", 3, "szGroupName"}, // LPCSTR
+	{"SCardRemoveReaderFromGroupW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardRemoveReaderFromGroupW", 2, "szReaderName"}, // LPCWSTR
+	{"SCardRemoveReaderFromGroupW", 3, "szGroupName"}, // LPCWSTR
+	{"SCardSetAttrib", 1, "hCard"}, // SCARDHANDLE
+	{"SCardSetAttrib", 2, "dwAttrId"}, // DWORD
+	{"SCardSetAttrib", 3, "pbAttr"}, // LPCBYTE
+	{"SCardSetAttrib", 4, "cbAttrLen"}, // DWORD
+	{"SCardSetCardTypeProviderNameA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardSetCardTypeProviderNameA", 2, "szCardName"}, // LPCSTR
+	{"SCardSetCardTypeProviderNameA", 3, "dwProviderId"}, // DWORD
+	{"SCardSetCardTypeProviderNameA", 4, "szProvider"}, // LPCSTR
+	{"SCardSetCardTypeProviderNameW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardSetCardTypeProviderNameW", 2, "szCardName"}, // LPCWSTR
+	{"SCardSetCardTypeProviderNameW", 3, "dwProviderId"}, // DWORD
+	{"SCardSetCardTypeProviderNameW", 4, "szProvider"}, // LPCWSTR
+	{"SCardState", 1, "hCard"}, // SCARDHANDLE
+	{"SCardState", 2, "pdwState"}, // LPDWORD
+	{"SCardState", 3, "pdwProtocol"}, // LPDWORD
+	{"SCardState", 4, "pbAtr"}, // LPBYTE
+	{"SCardState", 5, "pcbAtrLen"}, // LPDWORD
+	{"SCardStatusA", 1, "hCard"}, // SCARDHANDLE
+	{"SCardStatusA", 2, "szReaderName"}, // LPSTR
+	{"SCardStatusA", 3, "pcchReaderLen"}, // LPDWORD
+	{"SCardStatusA", 4, "pdwState"}, // LPDWORD
+	{"SCardStatusA", 5, "pdwProtocol"}, // LPDWORD
+	{"SCardStatusA", 6, "pbAtr"}, // LPBYTE
+	{"SCardStatusA", 7, "pcbAtrLen"}, // LPDWORD
+	{"SCardStatusW", 1, "hCard"}, // SCARDHANDLE
+	{"SCardStatusW", 2, "szReaderName"}, // LPWSTR
+	{"SCardStatusW", 3, "pcchReaderLen"}, // LPDWORD
+	{"SCardStatusW", 4, "pdwState"}, // LPDWORD
+	{"SCardStatusW", 5, "pdwProtocol"}, // LPDWORD
+	{"SCardStatusW", 6, "pbAtr"}, // LPBYTE
+	{"SCardStatusW", 7, "pcbAtrLen"}, // LPDWORD
+	{"SCardTransmit", 1, "hCard"}, // SCARDHANDLE
+	{"SCardTransmit", 2, "pioSendPci"}, // LPCSCARD_IO_REQUEST
+	{"SCardTransmit", 3, "pbSendBuffer"}, // LPCBYTE
+	{"SCardTransmit", 4, "cbSendLength"}, // DWORD
+	{"SCardTransmit", 5, "pioRecvPci"}, // LPSCARD_IO_REQUEST
+	{"SCardTransmit", 6, "pbRecvBuffer"}, // LPBYTE
+	{"SCardTransmit", 7, "pcbRecvLength"}, // LPDWORD
+	{"SCardUIDlgSelectCardA", 1, "pDlgStruc"}, // LPOPENCARDNAMEA_EX
+	{"SCardUIDlgSelectCardW", 1, "pDlgStruc"}, // LPOPENCARDNAMEW_EX
+	{"SCardWriteCacheA", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardWriteCacheA", 2, "CardIdentifier"}, // UUID *
+	{"SCardWriteCacheA", 3, "FreshnessCounter"}, // DWORD
+	{"SCardWriteCacheA", 4, "LookupName"}, // LPSTR
+	{"SCardWriteCacheA", 5, "Data"}, // PBYTE
+	{"SCardWriteCacheA", 6, "DataLen"}, // DWORD
+	{"SCardWriteCacheW", 1, "hContext"}, // SCARDCONTEXT
+	{"SCardWriteCacheW", 2, "CardIdentifier"}, // UUID *
+	{"SCardWriteCacheW", 3, "FreshnessCounter"}, // DWORD
+	{"SCardWriteCacheW", 4, "LookupName"}, // LPWSTR
+	{"SCardWriteCacheW", 5, "Data"}, // PBYTE
+	{"SCardWriteCacheW", 6, "DataLen"}, // DWORD
+	{"SaferCloseLevel", 1, "hLevelHandle"}, // SAFER_LEVEL_HANDLE
+	{"SaferComputeTokenFromLevel", 1, "LevelHandle"}, // SAFER_LEVEL_HANDLE
+	{"SaferComputeTokenFromLevel", 2, "InAccessToken"}, // HANDLE
+	{"SaferComputeTokenFromLevel", 3, "OutAccessToken"}, // PHANDLE
+	{"SaferComputeTokenFromLevel", 4, "dwFlags"}, // DWORD
+	{"SaferComputeTokenFromLevel", 5, "lpReserved"}, // LPVOID
+	{"SaferCreateLevel", 1, "dwScopeId"}, // DWORD
+	{"SaferCreateLevel", 2, "dwLevelId"}, // DWORD
+	{"SaferCreateLevel", 3, "OpenFlags"}, // DWORD
+	{"SaferCreateLevel", 4, "pLevelHandle"}, // SAFER_LEVEL_HANDLE *
+	{"SaferCreateLevel", 5, "lpReserved"}, // LPVOID
+	{"SaferGetLevelInformation", 1, "LevelHandle"}, // SAFER_LEVEL_HANDLE
+	{"SaferGetLevelInformation", 2, "dwInfoType"}, // SAFER_OBJECT_INFO_CLASS
+	{"SaferGetLevelInformation", 3, "lpQueryBuffer"}, // LPVOID
+	{"SaferGetLevelInformation", 4, "dwInBufferSize"}, // DWORD
+	{"SaferGetLevelInformation", 5, "lpdwOutBufferSize"}, // LPDWORD
+	{"SaferGetPolicyInformation", 1, "dwScopeId"}, // DWORD
+	{"SaferGetPolicyInformation", 2, "SaferPolicyInfoClass"}, // SAFER_POLICY_INFO_CLASS
+	{"SaferGetPolicyInformation", 3, "InfoBufferSize"}, // DWORD
+	{"SaferGetPolicyInformation", 4, "InfoBuffer"}, // PVOID
+	{"SaferGetPolicyInformation", 5, "InfoBufferRetSize"}, // PDWORD
+	{"SaferGetPolicyInformation", 6, "lpReserved"}, // LPVOID
+	{"SaferIdentifyLevel", 1, "dwNumProperties"}, // DWORD
+	{"SaferIdentifyLevel", 2, "pCodeProperties"}, // PSAFER_CODE_PROPERTIES
+	{"SaferIdentifyLevel", 3, "pLevelHandle"}, // SAFER_LEVEL_HANDLE *
+	{"SaferIdentifyLevel", 4, "lpReserved"}, // LPVOID
+	{"SaferRecordEventLogEntry", 1, "hLevel"}, // SAFER_LEVEL_HANDLE
+	{"SaferRecordEventLogEntry", 2, "szTargetPath"}, // LPCWSTR
+	{"SaferRecordEventLogEntry", 3, "lpReserved"}, // LPVOID
+	{"SaferSetLevelInformation", 1, "LevelHandle"}, // SAFER_LEVEL_HANDLE
+	{"SaferSetLevelInformation", 2, "dwInfoType"}, // SAFER_OBJECT_INFO_CLASS
+	{"SaferSetLevelInformation", 3, "lpQueryBuffer"}, // LPVOID
+	{"SaferSetLevelInformation", 4, "dwInBufferSize"}, // DWORD
+	{"SaferSetPolicyInformation", 1, "dwScopeId"}, // DWORD
+	{"SaferSetPolicyInformation", 2, "SaferPolicyInfoClass"}, // SAFER_POLICY_INFO_CLASS
+	{"SaferSetPolicyInformation", 3, "InfoBufferSize"}, // DWORD
+	{"SaferSetPolicyInformation", 4, "InfoBuffer"}, // PVOID
+	{"SaferSetPolicyInformation", 5, "lpReserved"}, // LPVOID
+	{"SaferiIsExecutableFileType", 1, "szFullPathname"}, // LPCWSTR
+	{"SaferiIsExecutableFileType", 2, "bFromShellExecute"}, // BOOLEAN
+	{"SaveDC", 1, "hdc"}, // HDC
+	{"ScaleViewportExtEx", 1, "hdc"}, // HDC
+	{"ScaleViewportExtEx", 2, "xn"}, // int
+	{"ScaleViewportExtEx", 3, "dx"}, // int
+	{"ScaleViewportExtEx", 4, "yn"}, // int
+	{"ScaleViewportExtEx", 5, "yd"}, // int
+	{"ScaleViewportExtEx", 6, "lpsz"}, // LPSIZE
+	{"ScaleWindowExtEx", 1, "hdc"}, // HDC
+	{"ScaleWindowExtEx", 2, "xn"}, // int
+	{"ScaleWindowExtEx", 3, "xd"}, // int
+	{"ScaleWindowExtEx", 4, "yn"}, // int
+	{"ScaleWindowExtEx", 5, "yd"}, // int
+	{"ScaleWindowExtEx", 6, "lpsz"}, // LPSIZE
+	{"ScheduleJob", 1, "hPrinter"}, // HANDLE
+	{"ScheduleJob", 2, "JobId"}, // DWORD
+	{"ScreenToClient", 1, "hWnd"}, // HWND
+	{"ScreenToClient", 2, "lpPoint"}, // LPPOINT
+	{"ScrollConsoleScreenBufferA", 1, "hConsoleOutput"}, // HANDLE
+	{"ScrollConsoleScreenBufferA", 2, "lpScrollRectangle"}, // CONST SMALL_RECT *
+	{"ScrollConsoleScreenBufferA", 3, "lpClipRectangle"}, // CONST SMALL_RECT *
+	{"ScrollConsoleScreenBufferA", 4, "dwDestinationOrigin"}, // COORD
+	{"ScrollConsoleScreenBufferA", 5, "lpFill"}, // CONST CHAR_INFO *
+	{"ScrollConsoleScreenBufferW", 1, "hConsoleOutput"}, // HANDLE
+	{"ScrollConsoleScreenBufferW", 2, "lpScrollRectangle"}, // CONST SMALL_RECT *
+	{"ScrollConsoleScreenBufferW", 3, "lpClipRectangle"}, // CONST SMALL_RECT *
+	{"ScrollConsoleScreenBufferW", 4, "dwDestinationOrigin"}, // COORD
+	{"ScrollConsoleScreenBufferW", 5, "lpFill"}, // CONST CHAR_INFO *
+	{"ScrollDC", 1, "hDC"}, // HDC
+	{"ScrollDC", 2, "dx"}, // int
+	{"ScrollDC", 3, "dy"}, // int
+	{"ScrollDC", 4, "lprcScroll"}, // CONST RECT *
+	{"ScrollDC", 5, "lprcClip"}, // CONST RECT *
+	{"ScrollDC", 6, "hrgnUpdate"}, // HRGN
+	{"ScrollDC", 7, "lprcUpdate"}, // LPRECT
+	{"ScrollWindow", 1, "hWnd"}, // HWND
+	{"ScrollWindow", 2, "XAmount"}, // int
+	{"ScrollWindow", 3, "YAmount"}, // int
+	{"ScrollWindow", 4, "lpRect"}, // CONST RECT *
+	{"ScrollWindow", 5, "lpClipRect"}, // CONST RECT *
+	{"ScrollWindowEx", 1, "hWnd"}, // HWND
+	{"ScrollWindowEx", 2, "dx"}, // int
+	{"ScrollWindowEx", 3, "dy"}, // int
+	{"ScrollWindowEx", 4, "prcScroll"}, // CONST RECT *
+	{"ScrollWindowEx", 5, "prcClip"}, // CONST RECT *
+	{"ScrollWindowEx", 6, "hrgnUpdate"}, // HRGN
+	{"ScrollWindowEx", 7, "prcUpdate"}, // LPRECT
+	{"ScrollWindowEx", 8, "flags"}, // UINT
+	{"SearchPathA", 1, "lpPath"}, // LPCSTR
+	{"SearchPathA", 2, "lpFileName"}, // LPCSTR
+	{"SearchPathA", 3, "lpExtension"}, // LPCSTR
+	{"SearchPathA", 4, "nBufferLength"}, // DWORD
+	{"SearchPathA", 5, "lpBuffer"}, // LPSTR
+	{"SearchPathA", 6, "lpFilePart"}, // LPSTR *
+	{"SearchPathW", 1, "lpPath"}, // LPCWSTR
+	{"SearchPathW", 2, "lpFileName"}, // LPCWSTR
+	{"SearchPathW", 3, "lpExtension"}, // LPCWSTR
+	{"SearchPathW", 4, "nBufferLength"}, // DWORD
+	{"SearchPathW", 5, "lpBuffer"}, // LPWSTR
+	{"SearchPathW", 6, "lpFilePart"}, // LPWSTR *
+	{"SelectClipPath", 1, "hdc"}, // HDC
+	{"SelectClipPath", 2, "mode"}, // int
+	{"SelectClipRgn", 1, "hdc"}, // HDC
+	{"SelectClipRgn", 2, "hrgn"}, // HRGN
+	{"SelectObject", 1, "hdc"}, // HDC
+	{"SelectObject", 2, "h"}, // HGDIOBJ
+	{"SelectPalette", 1, "hdc"}, // HDC
+	{"SelectPalette", 2, "hPal"}, // HPALETTE
+	{"SelectPalette", 3, "bForceBkgd"}, // WINBOOL
+	{"SendDlgItemMessageA", 1, "hDlg"}, // HWND
+	{"SendDlgItemMessageA", 2, "nIDDlgItem"}, // int
+	{"SendDlgItemMessageA", 3, "Msg"}, // UINT
+	{"SendDlgItemMessageA", 4, "wParam"}, // WPARAM
+	{"SendDlgItemMessageA", 5, "lParam"}, // LPARAM
+	{"SendDlgItemMessageW", 1, "hDlg"}, // HWND
+	{"SendDlgItemMessageW", 2, "nIDDlgItem"}, // int
+	{"SendDlgItemMessageW", 3, "Msg"}, // UINT
+	{"SendDlgItemMessageW", 4, "wParam"}, // WPARAM
+	{"SendDlgItemMessageW", 5, "lParam"}, // LPARAM
+	{"SendInput", 1, "cInputs"}, // UINT
+	{"SendInput", 2, "pInputs"}, // LPINPUT
+	{"SendInput", 3, "cbSize"}, // int
+	{"SendMessageA", 1, "hWnd"}, // HWND
+	{"SendMessageA", 2, "Msg"}, // UINT
+	{"SendMessageA", 3, "wParam"}, // WPARAM
+	{"SendMessageA", 4, "lParam"}, // LPARAM
+	{"SendMessageCallbackA", 1, "hWnd"}, // HWND
+	{"SendMessageCallbackA", 2, "Msg"}, // UINT
+	{"SendMessageCallbackA", 3, "wParam"}, // WPARAM
+	{"SendMessageCallbackA", 4, "lParam"}, // LPARAM
+	{"SendMessageCallbackA", 5, "lpResultCallBack"}, // SENDASYNCPROC
+	{"SendMessageCallbackA", 6, "dwData"}, // ULONG_PTR
+	{"SendMessageCallbackW", 1, "hWnd"}, // HWND
+	{"SendMessageCallbackW", 2, "Msg"}, // UINT
+	{"SendMessageCallbackW", 3, "wParam"}, // WPARAM
+	{"SendMessageCallbackW", 4, "lParam"}, // LPARAM
+	{"SendMessageCallbackW", 5, "lpResultCallBack"}, // SENDASYNCPROC
+	{"SendMessageCallbackW", 6, "dwData"}, // ULONG_PTR
+	{"SendMessageTimeoutA", 1, "hWnd"}, // HWND
+	{"SendMessageTimeoutA", 2, "Msg"}, // UINT
+	{"SendMessageTimeoutA", 3, "wParam"}, // WPARAM
+	{"SendMessageTimeoutA", 4, "lParam"}, // LPARAM
+	{"SendMessageTimeoutA", 5, "fuFlags"}, // UINT
+	{"SendMessageTimeoutA", 6, "uTimeout"}, // UINT
+	{"SendMessageTimeoutA", 7, "lpdwResult"}, // PDWORD_PTR
+	{"SendMessageTimeoutW", 1, "hWnd"}, // HWND
+	{"SendMessageTimeoutW", 2, "Msg"}, // UINT
+	{"SendMessageTimeoutW", 3, "wParam"}, // WPARAM
+	{"SendMessageTimeoutW", 4, "lParam"}, // LPARAM
+	{"SendMessageTimeoutW", 5, "fuFlags"}, // UINT
+	{"SendMessageTimeoutW", 6, "uTimeout"}, // UINT
+	{"SendMessageTimeoutW", 7, "lpdwResult"}, // PDWORD_PTR
+	{"SendMessageW", 1, "hWnd"}, // HWND
+	{"SendMessageW", 2, "Msg"}, // UINT
+	{"SendMessageW", 3, "wParam"}, // WPARAM
+	{"SendMessageW", 4, "lParam"}, // LPARAM
+	{"SendNotifyMessageA", 1, "hWnd"}, // HWND
+	{"SendNotifyMessageA", 2, "Msg"}, // UINT
+	{"SendNotifyMessageA", 3, "wParam"}, // WPARAM
+	{"SendNotifyMessageA", 4, "lParam"}, // LPARAM
+	{"SendNotifyMessageW", 1, "hWnd"}, // HWND
+	{"SendNotifyMessageW", 2, "Msg"}, // UINT
+	{"SendNotifyMessageW", 3, "wParam"}, // WPARAM
+	{"SendNotifyMessageW", 4, "lParam"}, // LPARAM
+	{"SetAbortProc", 1, "hdc"}, // HDC
+	{"SetAbortProc", 2, "lpProc"}, // ABORTPROC
+	{"SetAclInformation", 1, "pAcl"}, // PACL
+	{"SetAclInformation", 2, "pAclInformation"}, // LPVOID
+	{"SetAclInformation", 3, "nAclInformationLength"}, // DWORD
+	{"SetAclInformation", 4, "dwAclInformationClass"}, // ACL_INFORMATION_CLASS
+	{"SetActiveWindow", 1, "hWnd"}, // HWND
+	{"SetArcDirection", 1, "hdc"}, // HDC
+	{"SetArcDirection", 2, "dir"}, // int
+	{"SetBitmapBits", 1, "hbm"}, // HBITMAP
+	{"SetBitmapBits", 2, "cb"}, // DWORD
+	{"SetBitmapBits", 3, "pvBits"}, // CONST VOID *
+	{"SetBitmapDimensionEx", 1, "hbm"}, // HBITMAP
+	{"SetBitmapDimensionEx", 2, "w"}, // int
+	{"SetBitmapDimensionEx", 3, "h"}, // int
+	{"SetBitmapDimensionEx", 4, "lpsz"}, // LPSIZE
+	{"SetBkColor", 1, "hdc"}, // HDC
+	{"SetBkColor", 2, "color"}, // COLORREF
+	{"SetBkMode", 1, "hdc"}, // HDC
+	{"SetBkMode", 2, "mode"}, // int
+	{"SetBoundsRect", 1, "hdc"}, // HDC
+	{"SetBoundsRect", 2, "lprect"}, // CONST RECT *
+	{"SetBoundsRect", 3, "flags"}, // UINT
+	{"SetBrushOrgEx", 1, "hdc"}, // HDC
+	{"SetBrushOrgEx", 2, "x"}, // int
+	{"SetBrushOrgEx", 3, "y"}, // int
+	{"SetBrushOrgEx", 4, "lppt"}, // LPPOINT
+	{"SetCalendarInfoA", 1, "Locale"}, // LCID
+	{"SetCalendarInfoA", 2, "Calendar"}, // CALID
+	{"SetCalendarInfoA", 3, "CalType"}, // CALTYPE
+	{"SetCalendarInfoA", 4, "lpCalData"}, // LPCSTR
+	{"SetCalendarInfoW", 1, "Locale"}, // LCID
+	{"SetCalendarInfoW", 2, "Calendar"}, // CALID
+	{"SetCalendarInfoW", 3, "CalType"}, // CALTYPE
+	{"SetCalendarInfoW", 4, "lpCalData"}, // LPCWSTR
+	{"SetCapture", 1, "hWnd"}, // HWND
+	{"SetCaretBlinkTime", 1, "uMSeconds"}, // UINT
+	{"SetCaretPos", 1, "X"}, // int
+	{"SetCaretPos", 2, "Y"}, // int
+	{"SetClassLongA", 1, "hWnd"}, // HWND
+	{"SetClassLongA", 2, "nIndex"}, // int
+	{"SetClassLongA", 3, "dwNewLong"}, // LONG
+	{"SetClassLongPtrA", 1, "hWnd"}, // HWND
+	{"SetClassLongPtrA", 2, "nIndex"}, // int
+	{"SetClassLongPtrA", 3, "dwNewLong"}, // LONG_PTR
+	{"SetClassLongPtrW", 1, "hWnd"}, // HWND
+	{"SetClassLongPtrW", 2, "nIndex"}, // int
+	{"SetClassLongPtrW", 3, "dwNewLong"}, // LONG_PTR
+	{"SetClassLongW", 1, "hWnd"}, // HWND
+	{"SetClassLongW", 2, "nIndex"}, // int
+	{"SetClassLongW", 3, "dwNewLong"}, // LONG
+	{"SetClassWord", 1, "hWnd"}, // HWND
+	{"SetClassWord", 2, "nIndex"}, // int
+	{"SetClassWord", 3, "wNewWord"}, // WORD
+	{"SetClipboardData", 1, "uFormat"}, // UINT
+	{"SetClipboardData", 2, "hMem"}, // HANDLE
+	{"SetClipboardViewer", 1, "hWndNewViewer"}, // HWND
+	{"SetColorAdjustment", 1, "hdc"}, // HDC
+	{"SetColorAdjustment", 2, "lpca"}, // CONST COLORADJUSTMENT *
+	{"SetColorSpace", 1, "hdc"}, // HDC
+	{"SetColorSpace", 2, "hcs"}, // HCOLORSPACE
+	{"SetCommBreak", 1, "hFile"}, // HANDLE
+	{"SetCommConfig", 1, "hCommDev"}, // HANDLE
+	{"SetCommConfig", 2, "lpCC"}, // LPCOMMCONFIG
+	{"SetCommConfig", 3, "dwSize"}, // DWORD
+	{"SetCommMask", 1, "hFile"}, // HANDLE
+	{"SetCommMask", 2, "dwEvtMask"}, // DWORD
+	{"SetCommState", 1, "hFile"}, // HANDLE
+	{"SetCommState", 2, "lpDCB"}, // LPDCB
+	{"SetCommTimeouts", 1, "hFile"}, // HANDLE
+	{"SetCommTimeouts", 2, "lpCommTimeouts"}, // LPCOMMTIMEOUTS
+	{"SetComputerNameA", 1, "lpComputerName"}, // LPCSTR
+	{"SetComputerNameExA", 1, "NameType"}, // COMPUTER_NAME_FORMAT
+	{"SetComputerNameExA", 2, "lpBuffer"}, // LPCSTR
+	{"SetComputerNameExW", 1, "NameType"}, // COMPUTER_NAME_FORMAT
+	{"SetComputerNameExW", 2, "lpBuffer"}, // LPCWSTR
+	{"SetComputerNameW", 1, "lpComputerName"}, // LPCWSTR
+	{"SetConsoleActiveScreenBuffer", 1, "hConsoleOutput"}, // HANDLE
+	{"SetConsoleCP", 1, "wCodePageID"}, // UINT
+	{"SetConsoleCtrlHandler", 1, "HandlerRoutine"}, // PHANDLER_ROUTINE
+	{"SetConsoleCtrlHandler", 2, "Add"}, // WINBOOL
+	{"SetConsoleCursorInfo", 1, "hConsoleOutput"}, // HANDLE
+	{"SetConsoleCursorInfo", 2, "lpConsoleCursorInfo"}, // CONST CONSOLE_CURSOR_INFO *
+	{"SetConsoleCursorPosition", 1, "hConsoleOutput"}, // HANDLE
+	{"SetConsoleCursorPosition", 2, "dwCursorPosition"}, // COORD
+	{"SetConsoleDisplayMode", 1, "hConsoleOutput"}, // HANDLE
+	{"SetConsoleDisplayMode", 2, "dwFlags"}, // DWORD
+	{"SetConsoleDisplayMode", 3, "lpNewScreenBufferDimensions"}, // PCOORD
+	{"SetConsoleHistoryInfo", 1, "lpConsoleHistoryInfo"}, // PCONSOLE_HISTORY_INFO
+	{"SetConsoleMode", 1, "hConsoleHandle"}, // HANDLE
+	{"SetConsoleMode", 2, "dwMode"}, // DWORD
+	{"SetConsoleOutputCP", 1, "wCodePageID"}, // UINT
+	{"SetConsoleScreenBufferInfoEx", 1, "hConsoleOutput"}, // HANDLE
+	{"SetConsoleScreenBufferInfoEx", 2, "lpConsoleScreenBufferInfoEx"}, // PCONSOLE_SCREEN_BUFFER_INFOEX
+	{"SetConsoleScreenBufferSize", 1, "hConsoleOutput"}, // HANDLE
+	{"SetConsoleScreenBufferSize", 2, "dwSize"}, // COORD
+	{"SetConsoleTextAttribute", 1, "hConsoleOutput"}, // HANDLE
+	{"SetConsoleTextAttribute", 2, "wAttributes"}, // WORD
+	{"SetConsoleTitleA", 1, "lpConsoleTitle"}, // LPCSTR
+	{"SetConsoleTitleW", 1, "lpConsoleTitle"}, // LPCWSTR
+	{"SetConsoleWindowInfo", 1, "hConsoleOutput"}, // HANDLE
+	{"SetConsoleWindowInfo", 2, "bAbsolute"}, // WINBOOL
+	{"SetConsoleWindowInfo", 3, "lpConsoleWindow"}, // CONST SMALL_RECT *
+	{"SetCriticalSectionSpinCount", 1, "lpCriticalSection"}, // LPCRITICAL_SECTION
+	{"SetCriticalSectionSpinCount", 2, "dwSpinCount"}, // DWORD
+	{"SetCurrentConsoleFontEx", 1, "hConsoleOutput"}, // HANDLE
+	{"SetCurrentConsoleFontEx", 2, "bMaximumWindow"}, // WINBOOL
+	{"SetCurrentConsoleFontEx", 3, "lpConsoleCurrentFontEx"}, // PCONSOLE_FONT_INFOEX
+	{"SetCurrentDirectoryA", 1, "lpPathName"}, // LPCSTR
+	{"SetCurrentDirectoryW", 1, "lpPathName"}, // LPCWSTR
+	{"SetCursor", 1, "hCursor"}, // HCURSOR
+	{"SetCursorPos", 1, "X"}, // int
+	{"SetCursorPos", 2, "Y"}, // int
+	{"SetDCBrushColor", 1, "hdc"}, // HDC
+	{"SetDCBrushColor", 2, "color"}, // COLORREF
+	{"SetDCPenColor", 1, "hdc"}, // HDC
+	{"SetDCPenColor", 2, "color"}, // COLORREF
+	{"SetDIBColorTable", 1, "hdc"}, // HDC
+	{"SetDIBColorTable", 2, "iStart"}, // UINT
+	{"SetDIBColorTable", 3, "cEntries"}, // UINT
+	{"SetDIBColorTable", 4, "prgbq"}, // CONST RGBQUAD *
+	{"SetDIBits", 1, "hdc"}, // HDC
+	{"SetDIBits", 2, "hbm"}, // HBITMAP
+	{"SetDIBits", 3, "start"}, // UINT
+	{"SetDIBits", 4, "cLines"}, // UINT
+	{"SetDIBits", 5, "lpBits"}, // CONST VOID *
+	{"SetDIBits", 6, "lpbmi"}, // CONST BITMAPINFO *
+	{"SetDIBits", 7, "ColorUse"}, // UINT
+	{"SetDIBitsToDevice", 1, "hdc"}, // HDC
+	{"SetDIBitsToDevice", 2, "xDest"}, // int
+	{"SetDIBitsToDevice", 3, "yDest"}, // int
+	{"SetDIBitsToDevice", 4, "w"}, // DWORD
+	{"SetDIBitsToDevice", 5, "h"}, // DWORD
+	{"SetDIBitsToDevice", 6, "xSrc"}, // int
+	{"SetDIBitsToDevice", 7, "ySrc"}, // int
+	{"SetDIBitsToDevice", 8, "StartScan"}, // UINT
+	{"SetDIBitsToDevice", 9, "cLines"}, // UINT
+	{"SetDIBitsToDevice", 10, "lpvBits"}, // CONST VOID *
+	{"SetDIBitsToDevice", 11, "lpbmi"}, // CONST BITMAPINFO *
+	{"SetDIBitsToDevice", 12, "ColorUse"}, // UINT
+	{"SetDebugErrorLevel", 1, "dwLevel"}, // DWORD
+	{"SetDefaultCommConfigA", 1, "lpszName"}, // LPCSTR
+	{"SetDefaultCommConfigA", 2, "lpCC"}, // LPCOMMCONFIG
+	{"SetDefaultCommConfigA", 3, "dwSize"}, // DWORD
+	{"SetDefaultCommConfigW", 1, "lpszName"}, // LPCWSTR
+	{"SetDefaultCommConfigW", 2, "lpCC"}, // LPCOMMCONFIG
+	{"SetDefaultCommConfigW", 3, "dwSize"}, // DWORD
+	{"SetDefaultPrinterA", 1, "pszPrinter"}, // LPCSTR
+	{"SetDefaultPrinterW", 1, "pszPrinter"}, // LPCWSTR
+	{"SetDeviceGammaRamp", 1, "hdc"}, // HDC
+	{"SetDeviceGammaRamp", 2, "lpRamp"}, // LPVOID
+	{"SetDlgItemInt", 1, "hDlg"}, // HWND
+	{"SetDlgItemInt", 2, "nIDDlgItem"}, // int
+	{"SetDlgItemInt", 3, "uValue"}, // UINT
+	{"SetDlgItemInt", 4, "bSigned"}, // WINBOOL
+	{"SetDlgItemTextA", 1, "hDlg"}, // HWND
+	{"SetDlgItemTextA", 2, "nIDDlgItem"}, // int
+	{"SetDlgItemTextA", 3, "lpString"}, // LPCSTR
+	{"SetDlgItemTextW", 1, "hDlg"}, // HWND
+	{"SetDlgItemTextW", 2, "nIDDlgItem"}, // int
+	{"SetDlgItemTextW", 3, "lpString"}, // LPCWSTR
+	{"SetDllDirectoryA", 1, "lpPathName"}, // LPCSTR
+	{"SetDllDirectoryW", 1, "lpPathName"}, // LPCWSTR
+	{"SetDoubleClickTime", 1, "uInterval"}, // UINT
+	{"SetDynamicTimeZoneInformation", 1, "lpTimeZoneInformation"}, // const DYNAMIC_TIME_ZONE_INFORMATION *
+	{"SetEndOfFile", 1, "hFile"}, // HANDLE
+	{"SetEnhMetaFileBits", 1, "nSize"}, // UINT
+	{"SetEnhMetaFileBits", 2, "pb"}, // CONST BYTE *
+	{"SetEnvironmentStringsA", 1, "NewEnvironment"}, // LPCH
+	{"SetEnvironmentStringsW", 1, "NewEnvironment"}, // LPWCH
+	{"SetEnvironmentVariableA", 1, "lpName"}, // LPCSTR
+	{"SetEnvironmentVariableA", 2, "lpValue"}, // LPCSTR
+	{"SetEnvironmentVariableW", 1, "lpName"}, // LPCWSTR
+	{"SetEnvironmentVariableW", 2, "lpValue"}, // LPCWSTR
+	{"SetErrorMode", 1, "uMode"}, // UINT
+	{"SetEvent", 1, "hEvent"}, // HANDLE
+	{"SetEventWhenCallbackReturns", 1, "pci"}, // PTP_CALLBACK_INSTANCE
+	{"SetEventWhenCallbackReturns", 2, "evt"}, // HANDLE
+	{"SetFileAttributesA", 1, "lpFileName"}, // LPCSTR
+	{"SetFileAttributesA", 2, "dwFileAttributes"}, // DWORD
+	{"SetFileAttributesTransactedA", 1, "lpFileName"}, // LPCSTR
+	{"SetFileAttributesTransactedA", 2, "dwFileAttributes"}, // DWORD
+	{"SetFileAttributesTransactedA", 3, "hTransaction"}, // HANDLE
+	{"SetFileAttributesTransactedW", 1, "lpFileName"}, // LPCWSTR
+	{"SetFileAttributesTransactedW", 2, "dwFileAttributes"}, // DWORD
+	{"SetFileAttributesTransactedW", 3, "hTransaction"}, // HANDLE
+	{"SetFileAttributesW", 1, "lpFileName"}, // LPCWSTR
+	{"SetFileAttributesW", 2, "dwFileAttributes"}, // DWORD
+	{"SetFileBandwidthReservation", 1, "hFile"}, // HANDLE
+	{"SetFileBandwidthReservation", 2, "nPeriodMilliseconds"}, // DWORD
+	{"SetFileBandwidthReservation", 3, "nBytesPerPeriod"}, // DWORD
+	{"SetFileBandwidthReservation", 4, "bDiscardable"}, // WINBOOL
+	{"SetFileBandwidthReservation", 5, "lpTransferSize"}, // LPDWORD
+	{"SetFileBandwidthReservation", 6, "lpNumOutstandingRequests"}, // LPDWORD
+	{"SetFileCompletionNotificationModes", 1, "FileHandle"}, // HANDLE
+	{"SetFileCompletionNotificationModes", 2, "Flags"}, // UCHAR
+	{"SetFileInformationByHandle", 1, "hFile"}, // HANDLE
+	{"SetFileInformationByHandle", 2, "FileInformationClass"}, // FILE_INFO_BY_HANDLE_CLASS
+	{"SetFileInformationByHandle", 3, "lpFileInformation"}, // LPVOID
+	{"SetFileInformationByHandle", 4, "dwBufferSize"}, // DWORD
+	{"SetFileIoOverlappedRange", 1, "FileHandle"}, // HANDLE
+	{"SetFileIoOverlappedRange", 2, "OverlappedRangeStart"}, // PUCHAR
+	{"SetFileIoOverlappedRange", 3, "Length"}, // ULONG
+	{"SetFilePointer", 1, "hFile"}, // HANDLE
+	{"SetFilePointer", 2, "lDistanceToMove"}, // LONG
+	{"SetFilePointer", 3, "lpDistanceToMoveHigh"}, // PLONG
+	{"SetFilePointer", 4, "dwMoveMethod"}, // DWORD
+	{"SetFilePointerEx", 1, "hFile"}, // HANDLE
+	{"SetFilePointerEx", 2, "liDistanceToMove"}, // LARGE_INTEGER
+	{"SetFilePointerEx", 3, "lpNewFilePointer"}, // PLARGE_INTEGER
+	{"SetFilePointerEx", 4, "dwMoveMethod"}, // DWORD
+	{"SetFileSecurityA", 1, "lpFileName"}, // LPCSTR
+	{"SetFileSecurityA", 2, "SecurityInformation"}, // SECURITY_INFORMATION
+	{"SetFileSecurityA", 3, "pSecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"SetFileSecurityW", 1, "lpFileName"}, // LPCWSTR
+	{"SetFileSecurityW", 2, "SecurityInformation"}, // SECURITY_INFORMATION
+	{"SetFileSecurityW", 3, "pSecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"SetFileShortNameA", 1, "hFile"}, // HANDLE
+	{"SetFileShortNameA", 2, "lpShortName"}, // LPCSTR
+	{"SetFileShortNameW", 1, "hFile"}, // HANDLE
+	{"SetFileShortNameW", 2, "lpShortName"}, // LPCWSTR
+	{"SetFileTime", 1, "hFile"}, // HANDLE
+	{"SetFileTime", 2, "lpCreationTime"}, // CONST FILETIME *
+	{"SetFileTime", 3, "lpLastAccessTime"}, // CONST FILETIME *
+	{"SetFileTime", 4, "lpLastWriteTime"}, // CONST FILETIME *
+	{"SetFileValidData", 1, "hFile"}, // HANDLE
+	{"SetFileValidData", 2, "ValidDataLength"}, // LONGLONG
+	{"SetFirmwareEnvironmentVariableA", 1, "lpName"}, // LPCSTR
+	{"SetFirmwareEnvironmentVariableA", 2, "lpGuid"}, // LPCSTR
+	{"SetFirmwareEnvironmentVariableA", 3, "pValue"}, // PVOID
+	{"SetFirmwareEnvironmentVariableA", 4, "nSize"}, // DWORD
+	{"SetFirmwareEnvironmentVariableW", 1, "lpName"}, // LPCWSTR
+	{"SetFirmwareEnvironmentVariableW", 2, "lpGuid"}, // LPCWSTR
+	{"SetFirmwareEnvironmentVariableW", 3, "pValue"}, // PVOID
+	{"SetFirmwareEnvironmentVariableW", 4, "nSize"}, // DWORD
+	{"SetFocus", 1, "hWnd"}, // HWND
+	{"SetForegroundWindow", 1, "hWnd"}, // HWND
+	{"SetFormA", 1, "hPrinter"}, // HANDLE
+	{"SetFormA", 2, "pFormName"}, // LPSTR
+	{"SetFormA", 3, "Level"}, // DWORD
+	{"SetFormA", 4, "pForm"}, // LPBYTE
+	{"SetFormW", 1, "hPrinter"}, // HANDLE
+	{"SetFormW", 2, "pFormName"}, // LPWSTR
+	{"SetFormW", 3, "Level"}, // DWORD
+	{"SetFormW", 4, "pForm"}, // LPBYTE
+	{"SetGestureConfig", 1, "hWnd"}, // HWND
+	{"SetGestureConfig", 2, "dwReserved"}, // DWORD
+	{"SetGestureConfig", 3, "cIDs"}, // UINT
+	{"SetGestureConfig", 4, "pGestureConfig"}, // PGESTURECONFIG
+	{"SetGestureConfig", 5, "cbSize"}, // UINT
+	{"SetGraphicsMode", 1, "hdc"}, // HDC
+	{"SetGraphicsMode", 2, "iMode"}, // int
+	{"SetHandleCount", 1, "uNumber"}, // UINT
+	{"SetHandleInformation", 1, "hObject"}, // HANDLE
+	{"SetHandleInformation", 2, "dwMask"}, // DWORD
+	{"SetHandleInformation", 3, "dwFlags"}, // DWORD
+	{"SetICMMode", 1, "hdc"}, // HDC
+	{"SetICMMode", 2, "mode"}, // int
+	{"SetICMProfileA", 1, "hdc"}, // HDC
+	{"SetICMProfileA", 2, "lpFileName"}, // LPSTR
+	{"SetICMProfileW", 1, "hdc"}, // HDC
+	{"SetICMProfileW", 2, "lpFileName"}, // LPWSTR
+	{"SetInformationJobObject", 1, "hJob"}, // HANDLE
+	{"SetInformationJobObject", 2, "JobObjectInformationClass"}, // JOBOBJECTINFOCLASS
+	{"SetInformationJobObject", 3, "lpJobObjectInformation"}, // LPVOID
+	{"SetInformationJobObject", 4, "cbJobObjectInformationLength"}, // DWORD
+	{"SetJobA", 1, "hPrinter"}, // HANDLE
+	{"SetJobA", 2, "JobId"}, // DWORD
+	{"SetJobA", 3, "Level"}, // DWORD
+	{"SetJobA", 4, "pJob"}, // LPBYTE
+	{"SetJobA", 5, "Command"}, // DWORD
+	{"SetJobW", 1, "hPrinter"}, // HANDLE
+	{"SetJobW", 2, "JobId"}, // DWORD
+	{"SetJobW", 3, "Level"}, // DWORD
+	{"SetJobW", 4, "pJob"}, // LPBYTE
+	{"SetJobW", 5, "Command"}, // DWORD
+	{"SetKernelObjectSecurity", 1, "Handle"}, // HANDLE
+	{"SetKernelObjectSecurity", 2, "SecurityInformation"}, // SECURITY_INFORMATION
+	{"SetKernelObjectSecurity", 3, "SecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"SetKeyboardState", 1, "lpKeyState"}, // LPBYTE
+	{"SetLastError", 1, "dwErrCode"}, // DWORD
+	{"SetLastErrorEx", 1, "dwErrCode"}, // DWORD
+	{"SetLastErrorEx", 2, "dwType"}, // DWORD
+	{"SetLayeredWindowAttributes", 1, "hWnd"}, // HWND
+	{"SetLayeredWindowAttributes", 2, "crKey"}, // COLORREF
+	{"SetLayeredWindowAttributes", 3, "bAlpha"}, // BYTE
+	{"SetLayeredWindowAttributes", 4, "dwFlags"}, // DWORD
+	{"SetLayout", 1, "hdc"}, // HDC
+	{"SetLayout", 2, "l"}, // DWORD
+	{"SetLocalTime", 1, "lpSystemTime"}, // CONST SYSTEMTIME *
+	{"SetLocaleInfoA", 1, "Locale"}, // LCID
+	{"SetLocaleInfoA", 2, "LCType"}, // LCTYPE
+	{"SetLocaleInfoA", 3, "lpLCData"}, // LPCSTR
+	{"SetLocaleInfoW", 1, "Locale"}, // LCID
+	{"SetLocaleInfoW", 2, "LCType"}, // LCTYPE
+	{"SetLocaleInfoW", 3, "lpLCData"}, // LPCWSTR
+	{"SetMailslotInfo", 1, "hMailslot"}, // HANDLE
+	{"SetMailslotInfo", 2, "lReadTimeout"}, // DWORD
+	{"SetMapMode", 1, "hdc"}, // HDC
+	{"SetMapMode", 2, "iMode"}, // int
+	{"SetMapperFlags", 1, "hdc"}, // HDC
+	{"SetMapperFlags", 2, "flags"}, // DWORD
+	{"SetMenu", 1, "hWnd"}, // HWND
+	{"SetMenu", 2, "hMenu"}, // HMENU
+	{"SetMenuContextHelpId", 1, "hmenu"}, // HMENU
+	{"SetMenuContextHelpId", 2, "dwContextHelpId"}, // DWORD
+	{"SetMenuDefaultItem", 1, "hMenu"}, // HMENU
+	{"SetMenuDefaultItem", 2, "uItem"}, // UINT
+	{"SetMenuDefaultItem", 3, "fByPos"}, // UINT
+	{"SetMenuInfo", 1, "hmenu"}, // HMENU
+	{"SetMenuInfo", 2, "lpcmi"}, // LPCMENUINFO
+	{"SetMenuItemBitmaps", 1, "hMenu"}, // HMENU
+	{"SetMenuItemBitmaps", 2, "uPosition"}, // UINT
+	{"SetMenuItemBitmaps", 3, "uFlags"}, // UINT
+	{"SetMenuItemBitmaps", 4, "hBitmapUnchecked"}, // HBITMAP
+	{"SetMenuItemBitmaps", 5, "hBitmapChecked"}, // HBITMAP
+	{"SetMenuItemInfoA", 1, "hmenu"}, // HMENU
+	{"SetMenuItemInfoA", 2, "item"}, // UINT
+	{"SetMenuItemInfoA", 3, "fByPositon"}, // WINBOOL
+	{"SetMenuItemInfoA", 4, "lpmii"}, // LPCMENUITEMINFOA
+	{"SetMenuItemInfoW", 1, "hmenu"}, // HMENU
+	{"SetMenuItemInfoW", 2, "item"}, // UINT
+	{"SetMenuItemInfoW", 3, "fByPositon"}, // WINBOOL
+	{"SetMenuItemInfoW", 4, "lpmii"}, // LPCMENUITEMINFOW
+	{"SetMessageExtraInfo", 1, "lParam"}, // LPARAM
+	{"SetMessageQueue", 1, "cMessagesMax"}, // int
+	{"SetMessageWaitingIndicator", 1, "hMsgIndicator"}, // HANDLE
+	{"SetMessageWaitingIndicator", 2, "ulMsgCount"}, // ULONG
+	{"SetMetaFileBitsEx", 1, "cbBuffer"}, // UINT
+	{"SetMetaFileBitsEx", 2, "lpData"}, // CONST BYTE *
+	{"SetMetaRgn", 1, "hdc"}, // HDC
+	{"SetMiterLimit", 1, "hdc"}, // HDC
+	{"SetMiterLimit", 2, "limit"}, // FLOAT
+	{"SetMiterLimit", 3, "old"}, // PFLOAT
+	{"SetNamedPipeHandleState", 1, "hNamedPipe"}, // HANDLE
+	{"SetNamedPipeHandleState", 2, "lpMode"}, // LPDWORD
+	{"SetNamedPipeHandleState", 3, "lpMaxCollectionCount"}, // LPDWORD
+	{"SetNamedPipeHandleState", 4, "lpCollectDataTimeout"}, // LPDWORD
+	{"SetPaletteEntries", 1, "hpal"}, // HPALETTE
+	{"SetPaletteEntries", 2, "iStart"}, // UINT
+	{"SetPaletteEntries", 3, "cEntries"}, // UINT
+	{"SetPaletteEntries", 4, "pPalEntries"}, // CONST PALETTEENTRY *
+	{"SetParent", 1, "hWndChild"}, // HWND
+	{"SetParent", 2, "hWndNewParent"}, // HWND
+	{"SetPixel", 1, "hdc"}, // HDC
+	{"SetPixel", 2, "x"}, // int
+	{"SetPixel", 3, "y"}, // int
+	{"SetPixel", 4, "color"}, // COLORREF
+	{"SetPixelFormat", 1, "hdc"}, // HDC
+	{"SetPixelFormat", 2, "format"}, // int
+	{"SetPixelFormat", 3, "ppfd"}, // CONST PIXELFORMATDESCRIPTOR *
+	{"SetPixelV", 1, "hdc"}, // HDC
+	{"SetPixelV", 2, "x"}, // int
+	{"SetPixelV", 3, "y"}, // int
+	{"SetPixelV", 4, "color"}, // COLORREF
+	{"SetPolyFillMode", 1, "hdc"}, // HDC
+	{"SetPolyFillMode", 2, "mode"}, // int
+	{"SetPortA", 1, "pName"}, // LPSTR
+	{"SetPortA", 2, "pPortName"}, // LPSTR
+	{"SetPortA", 3, "dwLevel"}, // DWORD
+	{"SetPortA", 4, "pPortInfo"}, // LPBYTE
+	{"SetPortW", 1, "pName"}, // LPWSTR
+	{"SetPortW", 2, "pPortName"}, // LPWSTR
+	{"SetPortW", 3, "dwLevel"}, // DWORD
+	{"SetPortW", 4, "pPortInfo"}, // LPBYTE
+	{"SetPrinterA", 1, "hPrinter"}, // HANDLE
+	{"SetPrinterA", 2, "Level"}, // DWORD
+	{"SetPrinterA", 3, "pPrinter"}, // LPBYTE
+	{"SetPrinterA", 4, "Command"}, // DWORD
+	{"SetPrinterDataA", 1, "hPrinter"}, // HANDLE
+	{"SetPrinterDataA", 2, "pValueName"}, // LPSTR
+	{"SetPrinterDataA", 3, "Type"}, // DWORD
+	{"SetPrinterDataA", 4, "pData"}, // LPBYTE
+	{"SetPrinterDataA", 5, "cbData"}, // DWORD
+	{"SetPrinterDataExA", 1, "hPrinter"}, // HANDLE
+	{"SetPrinterDataExA", 2, "pKeyName"}, // LPCSTR
+	{"SetPrinterDataExA", 3, "pValueName"}, // LPCSTR
+	{"SetPrinterDataExA", 4, "Type"}, // DWORD
+	{"SetPrinterDataExA", 5, "pData"}, // LPBYTE
+	{"SetPrinterDataExA", 6, "cbData"}, // DWORD
+	{"SetPrinterDataExW", 1, "hPrinter"}, // HANDLE
+	{"SetPrinterDataExW", 2, "pKeyName"}, // LPCWSTR
+	{"SetPrinterDataExW", 3, "pValueName"}, // LPCWSTR
+	{"SetPrinterDataExW", 4, "Type"}, // DWORD
+	{"SetPrinterDataExW", 5, "pData"}, // LPBYTE
+	{"SetPrinterDataExW", 6, "cbData"}, // DWORD
+	{"SetPrinterDataW", 1, "hPrinter"}, // HANDLE
+	{"SetPrinterDataW", 2, "pValueName"}, // LPWSTR
+	{"SetPrinterDataW", 3, "Type"}, // DWORD
+	{"SetPrinterDataW", 4, "pData"}, // LPBYTE
+	{"SetPrinterDataW", 5, "cbData"}, // DWORD
+	{"SetPrinterToken", 1, "hToken"}, // HANDLE
+	{"SetPrinterW", 1, "hPrinter"}, // HANDLE
+	{"SetPrinterW", 2, "Level"}, // DWORD
+	{"SetPrinterW", 3, "pPrinter"}, // LPBYTE
+	{"SetPrinterW", 4, "Command"}, // DWORD
+	{"SetPriorityClass", 1, "hProcess"}, // HANDLE
+	{"SetPriorityClass", 2, "dwPriorityClass"}, // DWORD
+	{"SetPrivateObjectSecurity", 1, "SecurityInformation"}, // SECURITY_INFORMATION
+	{"SetPrivateObjectSecurity", 2, "ModificationDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"SetPrivateObjectSecurity", 3, "ObjectsSecurityDescriptor"}, // PSECURITY_DESCRIPTOR *
+	{"SetPrivateObjectSecurity", 4, "GenericMapping"}, // PGENERIC_MAPPING
+	{"SetPrivateObjectSecurity", 5, "Token"}, // HANDLE
+	{"SetPrivateObjectSecurityEx", 1, "SecurityInformation"}, // SECURITY_INFORMATION
+	{"SetPrivateObjectSecurityEx", 2, "ModificationDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"SetPrivateObjectSecurityEx", 3, "ObjectsSecurityDescriptor"}, // PSECURITY_DESCRIPTOR *
+	{"SetPrivateObjectSecurityEx", 4, "AutoInheritFlags"}, // ULONG
+	{"SetPrivateObjectSecurityEx", 5, "GenericMapping"}, // PGENERIC_MAPPING
+	{"SetPrivateObjectSecurityEx", 6, "Token"}, // HANDLE
+	{"SetProcessAffinityMask", 1, "hProcess"}, // HANDLE
+	{"SetProcessAffinityMask", 2, "dwProcessAffinityMask"}, // DWORD_PTR
+	{"SetProcessAffinityUpdateMode", 1, "ProcessHandle"}, // HANDLE
+	{"SetProcessAffinityUpdateMode", 2, "dwFlags"}, // DWORD
+	{"SetProcessDEPPolicy", 1, "dwFlags"}, // DWORD
+	{"SetProcessDefaultLayout", 1, "dwDefaultLayout"}, // DWORD
+	{"SetProcessPriorityBoost", 1, "hProcess"}, // HANDLE
+	{"SetProcessPriorityBoost", 2, "bDisablePriorityBoost"}, // WINBOOL
+	{"SetProcessShutdownParameters", 1, "dwLevel"}, // DWORD
+	{"SetProcessShutdownParameters", 2, "dwFlags"}, // DWORD
+	{"SetProcessWindowStation", 1, "hWinSta"}, // HWINSTA
+	{"SetProcessWorkingSetSize", 1, "hProcess"}, // HANDLE
+	{"SetProcessWorkingSetSize", 2, "dwMinimumWorkingSetSize"}, // SIZE_T
+	{"SetProcessWorkingSetSize", 3, "dwMaximumWorkingSetSize"}, // SIZE_T
+	{"SetProcessWorkingSetSizeEx", 1, "hProcess"}, // HANDLE
+	{"SetProcessWorkingSetSizeEx", 2, "dwMinimumWorkingSetSize"}, // SIZE_T
+	{"SetProcessWorkingSetSizeEx", 3, "dwMaximumWorkingSetSize"}, // SIZE_T
+	{"SetProcessWorkingSetSizeEx", 4, "Flags"}, // DWORD
+	{"SetPropA", 1, "hWnd"}, // HWND
+	{"SetPropA", 2, "lpString"}, // LPCSTR
+	{"SetPropA", 3, "hData"}, // HANDLE
+	{"SetPropW", 1, "hWnd"}, // HWND
+	{"SetPropW", 2, "lpString"}, // LPCWSTR
+	{"SetPropW", 3, "hData"}, // HANDLE
+	{"SetROP2", 1, "hdc"}, // HDC
+	{"SetROP2", 2, "rop2"}, // int
+	{"SetRect", 1, "lprc"}, // LPRECT
+	{"SetRect", 2, "xLeft"}, // int
+	{"SetRect", 3, "yTop"}, // int
+	{"SetRect", 4, "xRight"}, // int
+	{"SetRect", 5, "yBottom"}, // int
+	{"SetRectEmpty", 1, "lprc"}, // LPRECT
+	{"SetRectRgn", 1, "hrgn"}, // HRGN
+	{"SetRectRgn", 2, "left"}, // int
+	{"SetRectRgn", 3, "top"}, // int
+	{"SetRectRgn", 4, "right"}, // int
+	{"SetRectRgn", 5, "bottom"}, // int
+	{"SetScrollInfo", 1, "hWnd"}, // HWND
+	{"SetScrollInfo", 2, "nBar"}, // int
+	{"SetScrollInfo", 3, "lpsi"}, // LPCSCROLLINFO
+	{"SetScrollInfo", 4, "redraw"}, // WINBOOL
+	{"SetScrollPos", 1, "hWnd"}, // HWND
+	{"SetScrollPos", 2, "nBar"}, // int
+	{"SetScrollPos", 3, "nPos"}, // int
+	{"SetScrollPos", 4, "bRedraw"}, // WINBOOL
+	{"SetScrollRange", 1, "hWnd"}, // HWND
+	{"SetScrollRange", 2, "nBar"}, // int
+	{"SetScrollRange", 3, "nMinPos"}, // int
+	{"SetScrollRange", 4, "nMaxPos"}, // int
+	{"SetScrollRange", 5, "bRedraw"}, // WINBOOL
+	{"SetSecurityAccessMask", 1, "SecurityInformation"}, // SECURITY_INFORMATION
+	{"SetSecurityAccessMask", 2, "DesiredAccess"}, // LPDWORD
+	{"SetSecurityDescriptorControl", 1, "pSecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"SetSecurityDescriptorControl", 2, "ControlBitsOfInterest"}, // SECURITY_DESCRIPTOR_CONTROL
+	{"SetSecurityDescriptorControl", 3, "ControlBitsToSet"}, // SECURITY_DESCRIPTOR_CONTROL
+	{"SetSecurityDescriptorDacl", 1, "pSecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"SetSecurityDescriptorDacl", 2, "bDaclPresent"}, // WINBOOL
+	{"SetSecurityDescriptorDacl", 3, "pDacl"}, // PACL
+	{"SetSecurityDescriptorDacl", 4, "bDaclDefaulted"}, // WINBOOL
+	{"SetSecurityDescriptorGroup", 1, "pSecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"SetSecurityDescriptorGroup", 2, "pGroup"}, // PSID
+	{"SetSecurityDescriptorGroup", 3, "bGroupDefaulted"}, // WINBOOL
+	{"SetSecurityDescriptorOwner", 1, "pSecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"SetSecurityDescriptorOwner", 2, "pOwner"}, // PSID
+	{"SetSecurityDescriptorOwner", 3, "bOwnerDefaulted"}, // WINBOOL
+	{"SetSecurityDescriptorRMControl", 1, "SecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"SetSecurityDescriptorRMControl", 2, "RMControl"}, // PUCHAR
+	{"SetSecurityDescriptorSacl", 1, "pSecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"SetSecurityDescriptorSacl", 2, "bSaclPresent"}, // WINBOOL
+	{"SetSecurityDescriptorSacl", 3, "pSacl"}, // PACL
+	{"SetSecurityDescriptorSacl", 4, "bSaclDefaulted"}, // WINBOOL
+	{"SetServiceObjectSecurity", 1, "hService"}, // SC_HANDLE
+	{"SetServiceObjectSecurity", 2, "dwSecurityInformation"}, // SECURITY_INFORMATION
+	{"SetServiceObjectSecurity", 3, "lpSecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"SetServiceStatus", 1, "hServiceStatus"}, // SERVICE_STATUS_HANDLE
+	{"SetServiceStatus", 2, "lpServiceStatus"}, // LPSERVICE_STATUS
+	{"SetStdHandle", 1, "nStdHandle"}, // DWORD
+	{"SetStdHandle", 2, "hHandle"}, // HANDLE
+	{"SetStretchBltMode", 1, "hdc"}, // HDC
+	{"SetStretchBltMode", 2, "mode"}, // int
+	{"SetSysColors", 1, "cElements"}, // int
+	{"SetSysColors", 2, "lpaElements"}, // CONST INT *
+	{"SetSysColors", 3, "lpaRgbValues"}, // CONST COLORREF *
+	{"SetSystemCursor", 1, "hcur"}, // HCURSOR
+	{"SetSystemCursor", 2, "id"}, // DWORD
+	{"SetSystemFileCacheSize", 1, "MinimumFileCacheSize"}, // SIZE_T
+	{"SetSystemFileCacheSize", 2, "MaximumFileCacheSize"}, // SIZE_T
+	{"SetSystemFileCacheSize", 3, "Flags"}, // DWORD
+	{"SetSystemPaletteUse", 1, "hdc"}, // HDC
+	{"SetSystemPaletteUse", 2, "use"}, // UINT
+	{"SetSystemPowerState", 1, "fSuspend"}, // WINBOOL
+	{"SetSystemPowerState", 2, "fForce"}, // WINBOOL
+	{"SetSystemTime", 1, "lpSystemTime"}, // CONST SYSTEMTIME *
+	{"SetSystemTimeAdjustment", 1, "dwTimeAdjustment"}, // DWORD
+	{"SetSystemTimeAdjustment", 2, "bTimeAdjustmentDisabled"}, // WINBOOL
+	{"SetTapeParameters", 1, "hDevice"}, // HANDLE
+	{"SetTapeParameters", 2, "dwOperation"}, // DWORD
+	{"SetTapeParameters", 3, "lpTapeInformation"}, // LPVOID
+	{"SetTapePosition", 1, "hDevice"}, // HANDLE
+	{"SetTapePosition", 2, "dwPositionMethod"}, // DWORD
+	{"SetTapePosition", 3, "dwPartition"}, // DWORD
+	{"SetTapePosition", 4, "dwOffsetLow"}, // DWORD
+	{"SetTapePosition", 5, "dwOffsetHigh"}, // DWORD
+	{"SetTapePosition", 6, "bImmediate"}, // WINBOOL
+	{"SetTextAlign", 1, "hdc"}, // HDC
+	{"SetTextAlign", 2, "align"}, // UINT
+	{"SetTextCharacterExtra", 1, "hdc"}, // HDC
+	{"SetTextCharacterExtra", 2, "extra"}, // int
+	{"SetTextColor", 1, "hdc"}, // HDC
+	{"SetTextColor", 2, "color"}, // COLORREF
+	{"SetTextJustification", 1, "hdc"}, // HDC
+	{"SetTextJustification", 2, "extra"}, // int
+	{"SetTextJustification", 3, "count"}, // int
+	{"SetThreadAffinityMask", 1, "hThread"}, // HANDLE
+	{"SetThreadAffinityMask", 2, "dwThreadAffinityMask"}, // DWORD_PTR
+	{"SetThreadContext", 1, "hThread"}, // HANDLE
+	{"SetThreadContext", 2, "lpContext"}, // CONST CONTEXT *
+	{"SetThreadDesktop", 1, "hDesktop"}, // HDESK
+	{"SetThreadExecutionState", 1, "esFlags"}, // EXECUTION_STATE
+	{"SetThreadIdealProcessor", 1, "hThread"}, // HANDLE
+	{"SetThreadIdealProcessor", 2, "dwIdealProcessor"}, // DWORD
+	{"SetThreadLocale", 1, "Locale"}, // LCID
+	{"SetThreadPreferredUILanguages", 1, "dwFlags"}, // DWORD
+	{"SetThreadPreferredUILanguages", 2, "pwszLanguagesBuffer"}, // PCZZWSTR
+	{"SetThreadPreferredUILanguages", 3, "pulNumLanguages"}, // PULONG
+	{"SetThreadPriority", 1, "hThread"}, // HANDLE
+	{"SetThreadPriority", 2, "nPriority"}, // int
+	{"SetThreadPriorityBoost", 1, "hThread"}, // HANDLE
+	{"SetThreadPriorityBoost", 2, "bDisablePriorityBoost"}, // WINBOOL
+	{"SetThreadStackGuarantee", 1, "StackSizeInBytes"}, // PULONG
+	{"SetThreadToken", 1, "Thread"}, // PHANDLE
+	{"SetThreadToken", 2, "Token"}, // HANDLE
+	{"SetThreadUILanguage", 1, "LangId"}, // LANGID
+	{"SetThreadpoolThreadMaximum", 1, "ptpp"}, // PTP_POOL
+	{"SetThreadpoolThreadMaximum", 2, "cthrdMost"}, // DWORD
+	{"SetThreadpoolThreadMinimum", 1, "ptpp"}, // PTP_POOL
+	{"SetThreadpoolThreadMinimum", 2, "cthrdMic"}, // DWORD
+	{"SetThreadpoolTimer", 1, "pti"}, // PTP_TIMER
+	{"SetThreadpoolTimer", 2, "pftDueTime"}, // PFILETIME
+	{"SetThreadpoolTimer", 3, "msPeriod"}, // DWORD
+	{"SetThreadpoolTimer", 4, "msWindowLength"}, // DWORD
+	{"SetThreadpoolWait", 1, "pwa"}, // PTP_WAIT
+	{"SetThreadpoolWait", 2, "h"}, // HANDLE
+	{"SetThreadpoolWait", 3, "pftTimeout"}, // PFILETIME
+	{"SetTimeZoneInformation", 1, "lpTimeZoneInformation"}, // CONST TIME_ZONE_INFORMATION *
+	{"SetTimer", 1, "hWnd"}, // HWND
+	{"SetTimer", 2, "nIDEvent"}, // UINT_PTR
+	{"SetTimer", 3, "uElapse"}, // UINT
+	{"SetTimer", 4, "lpTimerFunc"}, // TIMERPROC
+	{"SetTimerQueueTimer", 1, "TimerQueue"}, // HANDLE
+	{"SetTimerQueueTimer", 2, "Callback"}, // WAITORTIMERCALLBACK
+	{"SetTimerQueueTimer", 3, "Parameter"}, // PVOID
+	{"SetTimerQueueTimer", 4, "DueTime"}, // DWORD
+	{"SetTimerQueueTimer", 5, "Period"}, // DWORD
+	{"SetTimerQueueTimer", 6, "PreferIo"}, // WINBOOL
+	{"SetTokenInformation", 1, "TokenHandle"}, // HANDLE
+	{"SetTokenInformation", 2, "TokenInformationClass"}, // TOKEN_INFORMATION_CLASS
+	{"SetTokenInformation", 3, "TokenInformation"}, // LPVOID
+	{"SetTokenInformation", 4, "TokenInformationLength"}, // DWORD
+	{"SetUnhandledExceptionFilter", 1, "lpTopLevelExceptionFilter"}, // LPTOP_LEVEL_EXCEPTION_FILTER
+	{"SetUrlCacheConfigInfoA", 1, "lpCacheConfigInfo"}, // LPINTERNET_CACHE_CONFIG_INFOA
+	{"SetUrlCacheConfigInfoA", 2, "dwFieldControl"}, // DWORD
+	{"SetUrlCacheConfigInfoW", 1, "lpCacheConfigInfo"}, // LPINTERNET_CACHE_CONFIG_INFOA
+	{"SetUrlCacheConfigInfoW", 2, "dwFieldControl"}, // DWORD
+	{"SetUserFileEncryptionKey", 1, "pEncryptionCertificate"}, // PENCRYPTION_CERTIFICATE
+	{"SetUserGeoID", 1, "GeoId"}, // GEOID
+	{"SetUserObjectInformationA", 1, "hObj"}, // HANDLE
+	{"SetUserObjectInformationA", 2, "nIndex"}, // int
+	{"SetUserObjectInformationA", 3, "pvInfo"}, // PVOID
+	{"SetUserObjectInformationA", 4, "nLength"}, // DWORD
+	{"SetUserObjectInformationW", 1, "hObj"}, // HANDLE
+	{"SetUserObjectInformationW", 2, "nIndex"}, // int
+	{"SetUserObjectInformationW", 3, "pvInfo"}, // PVOID
+	{"SetUserObjectInformationW", 4, "nLength"}, // DWORD
+	{"SetUserObjectSecurity", 1, "hObj"}, // HANDLE
+	{"SetUserObjectSecurity", 2, "pSIRequested"}, // PSECURITY_INFORMATION
+	{"SetUserObjectSecurity", 3, "pSID"}, // PSECURITY_DESCRIPTOR
+	{"SetViewportExtEx", 1, "hdc"}, // HDC
+	{"SetViewportExtEx", 2, "x"}, // int
+	{"SetViewportExtEx", 3, "y"}, // int
+	{"SetViewportExtEx", 4, "lpsz"}, // LPSIZE
+	{"SetViewportOrgEx", 1, "hdc"}, // HDC
+	{"SetViewportOrgEx", 2, "x"}, // int
+	{"SetViewportOrgEx", 3, "y"}, // int
+	{"SetViewportOrgEx", 4, "lppt"}, // LPPOINT
+	{"SetVolumeLabelA", 1, "lpRootPathName"}, // LPCSTR
+	{"SetVolumeLabelA", 2, "lpVolumeName"}, // LPCSTR
+	{"SetVolumeLabelW", 1, "lpRootPathName"}, // LPCWSTR
+	{"SetVolumeLabelW", 2, "lpVolumeName"}, // LPCWSTR
+	{"SetVolumeMountPointA", 1, "lpszVolumeMountPoint"}, // LPCSTR
+	{"SetVolumeMountPointA", 2, "lpszVolumeName"}, // LPCSTR
+	{"SetVolumeMountPointW", 1, "lpszVolumeMountPoint"}, // LPCWSTR
+	{"SetVolumeMountPointW", 2, "lpszVolumeName"}, // LPCWSTR
+	{"SetWaitableTimer", 1, "hTimer"}, // HANDLE
+	{"SetWaitableTimer", 2, "lpDueTime"}, // const LARGE_INTEGER *
+	{"SetWaitableTimer", 3, "lPeriod"}, // LONG
+	{"SetWaitableTimer", 4, "pfnCompletionRoutine"}, // PTIMERAPCROUTINE
+	{"SetWaitableTimer", 5, "lpArgToCompletionRoutine"}, // LPVOID
+	{"SetWaitableTimer", 6, "fResume"}, // WINBOOL
+	{"SetWinEventHook", 1, "eventMin"}, // DWORD
+	{"SetWinEventHook", 2, "eventMax"}, // DWORD
+	{"SetWinEventHook", 3, "hmodWinEventProc"}, // HMODULE
+	{"SetWinEventHook", 4, "pfnWinEventProc"}, // WINEVENTPROC
+	{"SetWinEventHook", 5, "idProcess"}, // DWORD
+	{"SetWinEventHook", 6, "idThread"}, // DWORD
+	{"SetWinEventHook", 7, "dwFlags"}, // DWORD
+	{"SetWinMetaFileBits", 1, "nSize"}, // UINT
+	{"SetWinMetaFileBits", 2, "lpMeta16Data"}, // CONST BYTE *
+	{"SetWinMetaFileBits", 3, "hdcRef"}, // HDC
+	{"SetWinMetaFileBits", 4, "lpMFP"}, // CONST METAFILEPICT *
+	{"SetWindowContextHelpId", 1, "hWnd"}, // HWND
+	{"SetWindowContextHelpId", 2, "dwContextHelpId"}, // DWORD
+	{"SetWindowExtEx", 1, "hdc"}, // HDC
+	{"SetWindowExtEx", 2, "x"}, // int
+	{"SetWindowExtEx", 3, "y"}, // int
+	{"SetWindowExtEx", 4, "lpsz"}, // LPSIZE
+	{"SetWindowLongA", 1, "hWnd"}, // HWND
+	{"SetWindowLongA", 2, "nIndex"}, // int
+	{"SetWindowLongA", 3, "dwNewLong"}, // LONG
+	{"SetWindowLongPtrA", 1, "hWnd"}, // HWND
+	{"SetWindowLongPtrA", 2, "nIndex"}, // int
+	{"SetWindowLongPtrA", 3, "dwNewLong"}, // LONG_PTR
+	{"SetWindowLongPtrW", 1, "hWnd"}, // HWND
+	{"SetWindowLongPtrW", 2, "nIndex"}, // int
+	{"SetWindowLongPtrW", 3, "dwNewLong"}, // LONG_PTR
+	{"SetWindowLongW", 1, "hWnd"}, // HWND
+	{"SetWindowLongW", 2, "nIndex"}, // int
+	{"SetWindowLongW", 3, "dwNewLong"}, // LONG
+	{"SetWindowOrgEx", 1, "hdc"}, // HDC
+	{"SetWindowOrgEx", 2, "x"}, // int
+	{"SetWindowOrgEx", 3, "y"}, // int
+	{"SetWindowOrgEx", 4, "lppt"}, // LPPOINT
+	{"SetWindowPlacement", 1, "hWnd"}, // HWND
+	{"SetWindowPlacement", 2, "lpwndpl"}, // CONST WINDOWPLACEMENT *
+	{"SetWindowPos", 1, "hWnd"}, // HWND
+	{"SetWindowPos", 2, "hWndInsertAfter"}, // HWND
+	{"SetWindowPos", 3, "X"}, // int
+	{"SetWindowPos", 4, "Y"}, // int
+	{"SetWindowPos", 5, "cx"}, // int
+	{"SetWindowPos", 6, "cy"}, // int
+	{"SetWindowPos", 7, "uFlags"}, // UINT
+	{"SetWindowRgn", 1, "hWnd"}, // HWND
+	{"SetWindowRgn", 2, "hRgn"}, // HRGN
+	{"SetWindowRgn", 3, "bRedraw"}, // WINBOOL
+	{"SetWindowTextA", 1, "hWnd"}, // HWND
+	{"SetWindowTextA", 2, "lpString"}, // LPCSTR
+	{"SetWindowTextW", 1, "hWnd"}, // HWND
+	{"SetWindowTextW", 2, "lpString"}, // LPCWSTR
+	{"SetWindowWord", 1, "hWnd"}, // HWND
+	{"SetWindowWord", 2, "nIndex"}, // int
+	{"SetWindowWord", 3, "wNewWord"}, // WORD
+	{"SetWindowsHookA", 1, "nFilterType"}, // int
+	{"SetWindowsHookA", 2, "pfnFilterProc"}, // HOOKPROC
+	{"SetWindowsHookExA", 1, "idHook"}, // int
+	{"SetWindowsHookExA", 2, "lpfn"}, // HOOKPROC
+	{"SetWindowsHookExA", 3, "hmod"}, // HINSTANCE
+	{"SetWindowsHookExA", 4, "dwThreadId"}, // DWORD
+	{"SetWindowsHookExW", 1, "idHook"}, // int
+	{"SetWindowsHookExW", 2, "lpfn"}, // HOOKPROC
+	{"SetWindowsHookExW", 3, "hmod"}, // HINSTANCE
+	{"SetWindowsHookExW", 4, "dwThreadId"}, // DWORD
+	{"SetWindowsHookW", 1, "nFilterType"}, // int
+	{"SetWindowsHookW", 2, "pfnFilterProc"}, // HOOKPROC
+	{"SetWorldTransform", 1, "hdc"}, // HDC
+	{"SetWorldTransform", 2, "lpxf"}, // CONST XFORM *
+	{"SetupComm", 1, "hFile"}, // HANDLE
+	{"SetupComm", 2, "dwInQueue"}, // DWORD
+	{"SetupComm", 3, "dwOutQueue"}, // DWORD
+	{"ShowCaret", 1, "hWnd"}, // HWND
+	{"ShowCursor", 1, "bShow"}, // WINBOOL
+	{"ShowOwnedPopups", 1, "hWnd"}, // HWND
+	{"ShowOwnedPopups", 2, "fShow"}, // WINBOOL
+	{"ShowScrollBar", 1, "hWnd"}, // HWND
+	{"ShowScrollBar", 2, "wBar"}, // int
+	{"ShowScrollBar", 3, "bShow"}, // WINBOOL
+	{"ShowWindow", 1, "hWnd"}, // HWND
+	{"ShowWindow", 2, "nCmdShow"}, // int
+	{"ShowWindowAsync", 1, "hWnd"}, // HWND
+	{"ShowWindowAsync", 2, "nCmdShow"}, // int
+	{"ShutdownBlockReasonCreate", 1, "hWnd"}, // HWND
+	{"ShutdownBlockReasonCreate", 2, "pwszReason"}, // LPCWSTR
+	{"ShutdownBlockReasonDestroy", 1, "hWnd"}, // HWND
+	{"ShutdownBlockReasonQuery", 1, "hWnd"}, // HWND
+	{"ShutdownBlockReasonQuery", 2, "pwszBuff"}, // LPWSTR
+	{"ShutdownBlockReasonQuery", 3, "pcchBuff"}, // DWORD *
+	{"SignalObjectAndWait", 1, "hObjectToSignal"}, // HANDLE
+	{"SignalObjectAndWait", 2, "hObjectToWaitOn"}, // HANDLE
+	{"SignalObjectAndWait", 3, "dwMilliseconds"}, // DWORD
+	{"SignalObjectAndWait", 4, "bAlertable"}, // WINBOOL
+	{"SizeofResource", 1, "hModule"}, // HMODULE
+	{"SizeofResource", 2, "hResInfo"}, // HRSRC
+	{"Sleep", 1, "dwMilliseconds"}, // DWORD
+	{"SleepConditionVariableCS", 1, "ConditionVariable"}, // PCONDITION_VARIABLE
+	{"SleepConditionVariableCS", 2, "CriticalSection"}, // PCRITICAL_SECTION
+	{"SleepConditionVariableCS", 3, "dwMilliseconds"}, // DWORD
+	{"SleepConditionVariableSRW", 1, "ConditionVariable"}, // PCONDITION_VARIABLE
+	{"SleepConditionVariableSRW", 2, "SRWLock"}, // PSRWLOCK
+	{"SleepConditionVariableSRW", 3, "dwMilliseconds"}, // DWORD
+	{"SleepConditionVariableSRW", 4, "Flags"}, // ULONG
+	{"SleepEx", 1, "dwMilliseconds"}, // DWORD
+	{"SleepEx", 2, "bAlertable"}, // WINBOOL
+	{"SnmpCancelMsg", 1, "session"}, // HSNMP_SESSION
+	{"SnmpCancelMsg", 2, "reqId"}, // smiINT32
+	{"SnmpClose", 1, "session"}, // HSNMP_SESSION
+	{"SnmpContextToStr", 1, "context"}, // HSNMP_CONTEXT
+	{"SnmpContextToStr", 2, "string"}, // smiLPOCTETS
+	{"SnmpCountVbl", 1, "vbl"}, // HSNMP_VBL
+	{"SnmpCreatePdu", 1, "session"}, // HSNMP_SESSION
+	{"SnmpCreatePdu", 2, "PDU_type"}, // smiINT
+	{"SnmpCreatePdu", 3, "request_id"}, // smiINT32
+	{"SnmpCreatePdu", 4, "error_status"}, // smiINT
+	{"SnmpCreatePdu", 5, "error_index"}, // smiINT
+	{"SnmpCreatePdu", 6, "varbindlist"}, // HSNMP_VBL
+	{"SnmpCreateSession", 1, "hWnd"}, // HWND
+	{"SnmpCreateSession", 2, "wMsg"}, // UINT
+	{"SnmpCreateSession", 3, "fCallBack"}, // SNMPAPI_CALLBACK
+	{"SnmpCreateSession", 4, "lpClientData"}, // LPVOID
+	{"SnmpCreateVbl", 1, "session"}, // HSNMP_SESSION
+	{"SnmpCreateVbl", 2, "name"}, // smiLPCOID
+	{"SnmpCreateVbl", 3, "value"}, // smiLPCVALUE
+	{"SnmpDecodeMsg", 1, "session"}, // HSNMP_SESSION
+	{"SnmpDecodeMsg", 2, "srcEntity"}, // LPHSNMP_ENTITY
+	{"SnmpDecodeMsg", 3, "dstEntity"}, // LPHSNMP_ENTITY
+	{"SnmpDecodeMsg", 4, "context"}, // LPHSNMP_CONTEXT
+	{"SnmpDecodeMsg", 5, "pdu"}, // LPHSNMP_PDU
+	{"SnmpDecodeMsg", 6, "msgBufDesc"}, // smiLPCOCTETS
+	{"SnmpDeleteVb", 1, "vbl"}, // HSNMP_VBL
+	{"SnmpDeleteVb", 2, "index"}, // smiUINT32
+	{"SnmpDuplicatePdu", 1, "session"}, // HSNMP_SESSION
+	{"SnmpDuplicatePdu", 2, "PDU"}, // HSNMP_PDU
+	{"SnmpDuplicateVbl", 1, "session"}, // HSNMP_SESSION
+	{"SnmpDuplicateVbl", 2, "vbl"}, // HSNMP_VBL
+	{"SnmpEncodeMsg", 1, "session"}, // HSNMP_SESSION
+	{"SnmpEncodeMsg", 2, "srcEntity"}, // HSNMP_ENTITY
+	{"SnmpEncodeMsg", 3, "dstEntity"}, // HSNMP_ENTITY
+	{"SnmpEncodeMsg", 4, "context"}, // HSNMP_CONTEXT
+	{"SnmpEncodeMsg", 5, "pdu"}, // HSNMP_PDU
+	{"SnmpEncodeMsg", 6, "msgBufDesc"}, // smiLPOCTETS
+	{"SnmpEntityToStr", 1, "entity"}, // HSNMP_ENTITY
+	{"SnmpEntityToStr", 2, "size"}, // smiUINT32
+	{"SnmpEntityToStr", 3, "string"}, // LPSTR
+	{"SnmpFreeContext", 1, "context"}, // HSNMP_CONTEXT
+	{"SnmpFreeDescriptor", 1, "syntax"}, // smiUINT32
+	{"SnmpFreeDescriptor", 2, "descriptor"}, // smiLPOPAQUE
+	{"SnmpFreeEntity", 1, "entity"}, // HSNMP_ENTITY
+	{"SnmpFreePdu", 1, "PDU"}, // HSNMP_PDU
+	{"SnmpFreeVbl", 1, "vbl"}, // HSNMP_VBL
+	{"SnmpGetLastError", 1, "session"}, // HSNMP_SESSION
+	{"SnmpGetPduData", 1, "PDU"}, // HSNMP_PDU
+	{"SnmpGetPduData", 2, "PDU_type"}, // smiLPINT
+	{"SnmpGetPduData", 3, "request_id"}, // smiLPINT32
+	{"SnmpGetPduData", 4, "error_status"}, // smiLPINT
+	{"SnmpGetPduData", 5, "error_index"}, // smiLPINT
+	{"SnmpGetPduData", 6, "varbindlist"}, // LPHSNMP_VBL
+	{"SnmpGetRetransmitMode", 1, "nRetransmitMode"}, // smiLPUINT32
+	{"SnmpGetRetry", 1, "hEntity"}, // HSNMP_ENTITY
+	{"SnmpGetRetry", 2, "nPolicyRetry"}, // smiLPUINT32
+	{"SnmpGetRetry", 3, "nActualRetry"}, // smiLPUINT32
+	{"SnmpGetTimeout", 1, "hEntity"}, // HSNMP_ENTITY
+	{"SnmpGetTimeout", 2, "nPolicyTimeout"}, // smiLPTIMETICKS
+	{"SnmpGetTimeout", 3, "nActualTimeout"}, // smiLPTIMETICKS
+	{"SnmpGetTranslateMode", 1, "nTranslateMode"}, // smiLPUINT32
+	{"SnmpGetVb", 1, "vbl"}, // HSNMP_VBL
+	{"SnmpGetVb", 2, "index"}, // smiUINT32
+	{"SnmpGetVb", 3, "name"}, // smiLPOID
+	{"SnmpGetVb", 4, "value"}, // smiLPVALUE
+	{"SnmpGetVendorInfo", 1, "vendorInfo"}, // smiLPVENDORINFO
+	{"SnmpListen", 1, "hEntity"}, // HSNMP_ENTITY
+	{"SnmpListen", 2, "lStatus"}, // SNMPAPI_STATUS
+	{"SnmpOidCompare", 1, "xOID"}, // smiLPCOID
+	{"SnmpOidCompare", 2, "yOID"}, // smiLPCOID
+	{"SnmpOidCompare", 3, "maxlen"}, // smiUINT32
+	{"SnmpOidCompare", 4, "result"}, // smiLPINT
+	{"SnmpOidCopy", 1, "srcOID"}, // smiLPCOID
+	{"SnmpOidCopy", 2, "dstOID"}, // smiLPOID
+	{"SnmpOidToStr", 1, "srcOID"}, // smiLPCOID
+	{"SnmpOidToStr", 2, "size"}, // smiUINT32
+	{"SnmpOidToStr", 3, "string"}, // LPSTR
+	{"SnmpOpen", 1, "hWnd"}, // HWND
+	{"SnmpOpen", 2, "wMsg"}, // UINT
+	{"SnmpRecvMsg", 1, "session"}, // HSNMP_SESSION
+	{"SnmpRecvMsg", 2, "srcEntity"}, // LPHSNMP_ENTITY
+	{"SnmpRecvMsg", 3, "dstEntity"}, // LPHSNMP_ENTITY
+	{"SnmpRecvMsg", 4, "context"}, // LPHSNMP_CONTEXT
+	{"SnmpRecvMsg", 5, "PDU"}, // LPHSNMP_PDU
+	{"SnmpRegister", 1, "session"}, // HSNMP_SESSION
+	{"SnmpRegister", 2, "srcEntity"}, // HSNMP_ENTITY
+	{"SnmpRegister", 3, "dstEntity"}, // HSNMP_ENTITY
+	{"SnmpRegister", 4, "context"}, // HSNMP_CONTEXT
+	{"SnmpRegister", 5, "notification"}, // smiLPCOID
+	{"SnmpRegister", 6, "state"}, // smiUINT32
+	{"SnmpSendMsg", 1, "session"}, // HSNMP_SESSION
+	{"SnmpSendMsg", 2, "srcEntity"}, // HSNMP_ENTITY
+	{"SnmpSendMsg", 3, "dstEntity"}, // HSNMP_ENTITY
+	{"SnmpSendMsg", 4, "context"}, // HSNMP_CONTEXT
+	{"SnmpSendMsg", 5, "PDU"}, // HSNMP_PDU
+	{"SnmpSetPduData", 1, "PDU"}, // HSNMP_PDU
+	{"SnmpSetPduData", 2, "PDU_type"}, // const smiINT *
+	{"SnmpSetPduData", 3, "request_id"}, // const smiINT32 *
+	{"SnmpSetPduData", 4, "non_repeaters"}, // const smiINT *
+	{"SnmpSetPduData", 5, "max_repetitions"}, // const smiINT *
+	{"SnmpSetPduData", 6, "varbindlist"}, // const HSNMP_VBL *
+	{"SnmpSetPort", 1, "hEntity"}, // HSNMP_ENTITY
+	{"SnmpSetPort", 2, "nPort"}, // UINT
+	{"SnmpSetRetransmitMode", 1, "nRetransmitMode"}, // smiUINT32
+	{"SnmpSetRetry", 1, "hEntity"}, // HSNMP_ENTITY
+	{"SnmpSetRetry", 2, "nPolicyRetry"}, // smiUINT32
+	{"SnmpSetTimeout", 1, "hEntity"}, // HSNMP_ENTITY
+	{"SnmpSetTimeout", 2, "nPolicyTimeout"}, // smiTIMETICKS
+	{"SnmpSetTranslateMode", 1, "nTranslateMode"}, // smiUINT32
+	{"SnmpSetVb", 1, "vbl"}, // HSNMP_VBL
+	{"SnmpSetVb", 2, "index"}, // smiUINT32
+	{"SnmpSetVb", 3, "name"}, // smiLPCOID
+	{"SnmpSetVb", 4, "value"}, // smiLPCVALUE
+	{"SnmpStartup", 1, "nMajorVersion"}, // smiLPUINT32
+	{"SnmpStartup", 2, "nMinorVersion"}, // smiLPUINT32
+	{"SnmpStartup", 3, "nLevel"}, // smiLPUINT32
+	{"SnmpStartup", 4, "nTranslateMode"}, // smiLPUINT32
+	{"SnmpStartup", 5, "nRetransmitMode"}, // smiLPUINT32
+	{"SnmpStartupEx", 1, "nMajorVersion"}, // smiLPUINT32
+	{"SnmpStartupEx", 2, "nMinorVersion"}, // smiLPUINT32
+	{"SnmpStartupEx", 3, "nLevel"}, // smiLPUINT32
+	{"SnmpStartupEx", 4, "nTranslateMode"}, // smiLPUINT32
+	{"SnmpStartupEx", 5, "nRetransmitMode"}, // smiLPUINT32
+	{"SnmpStrToContext", 1, "session"}, // HSNMP_SESSION
+	{"SnmpStrToContext", 2, "string"}, // smiLPCOCTETS
+	{"SnmpStrToEntity", 1, "session"}, // HSNMP_SESSION
+	{"SnmpStrToEntity", 2, "string"}, // LPCSTR
+	{"SnmpStrToOid", 1, "string"}, // LPCSTR
+	{"SnmpStrToOid", 2, "dstOID"}, // smiLPOID
+	{"SpoolerFindClosePrinterChangeNotification", 1, "hPrinter"}, // HANDLE
+	{"SpoolerFindFirstPrinterChangeNotification", 1, "hPrinter"}, // HANDLE
+	{"SpoolerFindFirstPrinterChangeNotification", 2, "fdwFlags"}, // DWORD
+	{"SpoolerFindFirstPrinterChangeNotification", 3, "fdwOptions"}, // DWORD
+	{"SpoolerFindFirstPrinterChangeNotification", 4, "phEvent"}, // PHANDLE
+	{"SpoolerFindFirstPrinterChangeNotification", 5, "pPrinterNotifyOptions"}, // PVOID
+	{"SpoolerFindFirstPrinterChangeNotification", 6, "pvReserved"}, // PVOID
+	{"SpoolerFindNextPrinterChangeNotification", 1, "hPrinter"}, // HANDLE
+	{"SpoolerFindNextPrinterChangeNotification", 2, "pfdwChange"}, // LPDWORD
+	{"SpoolerFindNextPrinterChangeNotification", 3, "pvReserved0"}, // PVOID
+	{"SpoolerFindNextPrinterChangeNotification", 4, "ppPrinterNotifyInfo"}, // PVOID
+	{"SpoolerFreePrinterNotifyInfo", 1, "pInfo"}, // PPRINTER_NOTIFY_INFO
+	{"SpoolerRefreshPrinterChangeNotification", 1, "hPrinter"}, // HANDLE
+	{"SpoolerRefreshPrinterChangeNotification", 2, "dwColor"}, // DWORD
+	{"SpoolerRefreshPrinterChangeNotification", 3, "pOptions"}, // PPRINTER_NOTIFY_OPTIONS
+	{"SpoolerRefreshPrinterChangeNotification", 4, "ppInfo"}, // PPRINTER_NOTIFY_INFO *
+	{"StartDocA", 1, "hdc"}, // HDC
+	{"StartDocA", 2, "lpdi"}, // CONST DOCINFOA *
+	{"StartDocPrinterA", 1, "hPrinter"}, // HANDLE
+	{"StartDocPrinterA", 2, "Level"}, // DWORD
+	{"StartDocPrinterA", 3, "pDocInfo"}, // LPBYTE
+	{"StartDocPrinterW", 1, "hPrinter"}, // HANDLE
+	{"StartDocPrinterW", 2, "Level"}, // DWORD
+	{"StartDocPrinterW", 3, "pDocInfo"}, // LPBYTE
+	{"StartDocW", 1, "hdc"}, // HDC
+	{"StartDocW", 2, "lpdi"}, // CONST DOCINFOW *
+	{"StartPage", 1, "hdc"}, // HDC
+	{"StartPagePrinter", 1, "hPrinter"}, // HANDLE
+	{"StartServiceA", 1, "hService"}, // SC_HANDLE
+	{"StartServiceA", 2, "dwNumServiceArgs"}, // DWORD
+	{"StartServiceA", 3, "lpServiceArgVectors"}, // LPCSTR *
+	{"StartServiceCtrlDispatcherA", 1, "lpServiceStartTable"}, // CONST SERVICE_TABLE_ENTRYA *
+	{"StartServiceCtrlDispatcherW", 1, "lpServiceStartTable"}, // CONST SERVICE_TABLE_ENTRYW *
+	{"StartServiceW", 1, "hService"}, // SC_HANDLE
+	{"StartServiceW", 2, "dwNumServiceArgs"}, // DWORD
+	{"StartServiceW", 3, "lpServiceArgVectors"}, // LPCWSTR *
+	{"StartThreadpoolIo", 1, "pio"}, // PTP_IO
+	{"StretchBlt", 1, "hdcDest"}, // HDC
+	{"StretchBlt", 2, "xDest"}, // int
+	{"StretchBlt", 3, "yDest"}, // int
+	{"StretchBlt", 4, "wDest"}, // int
+	{"StretchBlt", 5, "hDest"}, // int
+	{"StretchBlt", 6, "hdcSrc"}, // HDC
+	{"StretchBlt", 7, "xSrc"}, // int
+	{"StretchBlt", 8, "ySrc"}, // int
+	{"StretchBlt", 9, "wSrc"}, // int
+	{"StretchBlt", 10, "hSrc"}, // int
+	{"StretchBlt", 11, "rop"}, // DWORD
+	{"StretchDIBits", 1, "hdc"}, // HDC
+	{"StretchDIBits", 2, "xDest"}, // int
+	{"StretchDIBits", 3, "yDest"}, // int
+	{"StretchDIBits", 4, "DestWidth"}, // int
+	{"StretchDIBits", 5, "DestHeight"}, // int
+	{"StretchDIBits", 6, "xSrc"}, // int
+	{"StretchDIBits", 7, "ySrc"}, // int
+	{"StretchDIBits", 8, "SrcWidth"}, // int
+	{"StretchDIBits", 9, "SrcHeight"}, // int
+	{"StretchDIBits", 10, "lpBits"}, // CONST VOID *
+	{"StretchDIBits", 11, "lpbmi"}, // CONST BITMAPINFO *
+	{"StretchDIBits", 12, "iUsage"}, // UINT
+	{"StretchDIBits", 13, "rop"}, // DWORD
+	{"StrokeAndFillPath", 1, "hdc"}, // HDC
+	{"StrokePath", 1, "hdc"}, // HDC
+	{"SubmitThreadpoolWork", 1, "pwk"}, // PTP_WORK
+	{"SubtractRect", 1, "lprcDst"}, // LPRECT
+	{"SubtractRect", 2, "lprcSrc1"}, // CONST RECT *
+	{"SubtractRect", 3, "lprcSrc2"}, // CONST RECT *
+	{"SuspendThread", 1, "hThread"}, // HANDLE
+	{"SwapBuffers", 1, "hdc"}, // HDC
+	{"SwapMouseButton", 1, "fSwap"}, // WINBOOL
+	{"SwitchDesktop", 1, "hDesktop"}, // HDESK
+	{"SwitchToFiber", 1, "lpFiber"}, // LPVOID
+	{"SwitchToThisWindow", 1, "hWnd"}, // HWND
+	{"SwitchToThisWindow", 2, "fUnknown"}, // WINBOOL
+	{"SystemParametersInfoA", 1, "uiAction"}, // UINT
+	{"SystemParametersInfoA", 2, "uiParam"}, // UINT
+	{"SystemParametersInfoA", 3, "pvParam"}, // PVOID
+	{"SystemParametersInfoA", 4, "fWinIni"}, // UINT
+	{"SystemParametersInfoW", 1, "uiAction"}, // UINT
+	{"SystemParametersInfoW", 2, "uiParam"}, // UINT
+	{"SystemParametersInfoW", 3, "pvParam"}, // PVOID
+	{"SystemParametersInfoW", 4, "fWinIni"}, // UINT
+	{"SystemTimeToFileTime", 1, "lpSystemTime"}, // CONST SYSTEMTIME *
+	{"SystemTimeToFileTime", 2, "lpFileTime"}, // LPFILETIME
+	{"SystemTimeToTzSpecificLocalTime", 1, "lpTimeZoneInformation"}, // LPTIME_ZONE_INFORMATION
+	{"SystemTimeToTzSpecificLocalTime", 2, "lpUniversalTime"}, // LPSYSTEMTIME
+	{"SystemTimeToTzSpecificLocalTime", 3, "lpLocalTime"}, // LPSYSTEMTIME
+};
+
+} // anonymous namespace
+
 /**
-* @brief Initializes the given map with info about functions starting with S.
+* @brief Returns a table with info about functions starting with S.
 */
-void initFuncParamNamesMap_S(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
-	ADD_PARAM_NAME("SCardAddReaderToGroupA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardAddReaderToGroupA", 2, "szReaderName"); // LPCSTR
-	ADD_PARAM_NAME("SCardAddReaderToGroupA", 3, "szGroupName"); // LPCSTR
-	ADD_PARAM_NAME("SCardAddReaderToGroupW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardAddReaderToGroupW", 2, "szReaderName"); // LPCWSTR
-	ADD_PARAM_NAME("SCardAddReaderToGroupW", 3, "szGroupName"); // LPCWSTR
-	ADD_PARAM_NAME("SCardBeginTransaction", 1, "hCard"); // SCARDHANDLE
-	ADD_PARAM_NAME("SCardCancel", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardCancelTransaction", 1, "hCard"); // SCARDHANDLE
-	ADD_PARAM_NAME("SCardConnectA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardConnectA", 2, "szReader"); // LPCSTR
-	ADD_PARAM_NAME("SCardConnectA", 3, "dwShareMode"); // DWORD
-	ADD_PARAM_NAME("SCardConnectA", 4, "dwPreferredProtocols"); // DWORD
-	ADD_PARAM_NAME("SCardConnectA", 5, "phCard"); // LPSCARDHANDLE
-	ADD_PARAM_NAME("SCardConnectA", 6, "pdwActiveProtocol"); // LPDWORD
-	ADD_PARAM_NAME("SCardConnectW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardConnectW", 2, "szReader"); // LPCWSTR
-	ADD_PARAM_NAME("SCardConnectW", 3, "dwShareMode"); // DWORD
-	ADD_PARAM_NAME("SCardConnectW", 4, "dwPreferredProtocols"); // DWORD
-	ADD_PARAM_NAME("SCardConnectW", 5, "phCard"); // LPSCARDHANDLE
-	ADD_PARAM_NAME("SCardConnectW", 6, "pdwActiveProtocol"); // LPDWORD
-	ADD_PARAM_NAME("SCardControl", 1, "hCard"); // SCARDHANDLE
-	ADD_PARAM_NAME("SCardControl", 2, "dwControlCode"); // DWORD
-	ADD_PARAM_NAME("SCardControl", 3, "lpInBuffer"); // LPCVOID
-	ADD_PARAM_NAME("SCardControl", 4, "nInBufferSize"); // DWORD
-	ADD_PARAM_NAME("SCardControl", 5, "lpOutBuffer"); // LPVOID
-	ADD_PARAM_NAME("SCardControl", 6, "nOutBufferSize"); // DWORD
-	ADD_PARAM_NAME("SCardControl", 7, "lpBytesReturned"); // LPDWORD
-	ADD_PARAM_NAME("SCardDisconnect", 1, "hCard"); // SCARDHANDLE
-	ADD_PARAM_NAME("SCardDisconnect", 2, "dwDisposition"); // DWORD
-	ADD_PARAM_NAME("SCardEndTransaction", 1, "hCard"); // SCARDHANDLE
-	ADD_PARAM_NAME("SCardEndTransaction", 2, "dwDisposition"); // DWORD
-	ADD_PARAM_NAME("SCardEstablishContext", 1, "dwScope"); // DWORD
-	ADD_PARAM_NAME("SCardEstablishContext", 2, "pvReserved1"); // LPCVOID
-	ADD_PARAM_NAME("SCardEstablishContext", 3, "pvReserved2"); // LPCVOID
-	ADD_PARAM_NAME("SCardEstablishContext", 4, "phContext"); // LPSCARDCONTEXT
-	ADD_PARAM_NAME("SCardForgetCardTypeA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardForgetCardTypeA", 2, "szCardName"); // LPCSTR
-	ADD_PARAM_NAME("SCardForgetCardTypeW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardForgetCardTypeW", 2, "szCardName"); // LPCWSTR
-	ADD_PARAM_NAME("SCardForgetReaderA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardForgetReaderA", 2, "szReaderName"); // LPCSTR
-	ADD_PARAM_NAME("SCardForgetReaderGroupA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardForgetReaderGroupA", 2, "szGroupName"); // LPCSTR
-	ADD_PARAM_NAME("SCardForgetReaderGroupW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardForgetReaderGroupW", 2, "szGroupName"); // LPCWSTR
-	ADD_PARAM_NAME("SCardForgetReaderW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardForgetReaderW", 2, "szReaderName"); // LPCWSTR
-	ADD_PARAM_NAME("SCardFreeMemory", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardFreeMemory", 2, "pvMem"); // LPCVOID
-	ADD_PARAM_NAME("SCardGetAttrib", 1, "hCard"); // SCARDHANDLE
-	ADD_PARAM_NAME("SCardGetAttrib", 2, "dwAttrId"); // DWORD
-	ADD_PARAM_NAME("SCardGetAttrib", 3, "pbAttr"); // LPBYTE
-	ADD_PARAM_NAME("SCardGetAttrib", 4, "pcbAttrLen"); // LPDWORD
-	ADD_PARAM_NAME("SCardGetCardTypeProviderNameA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardGetCardTypeProviderNameA", 2, "szCardName"); // LPCSTR
-	ADD_PARAM_NAME("SCardGetCardTypeProviderNameA", 3, "dwProviderId"); // DWORD
-	ADD_PARAM_NAME("SCardGetCardTypeProviderNameA", 4, "szProvider"); // LPSTR
-	ADD_PARAM_NAME("SCardGetCardTypeProviderNameA", 5, "pcchProvider"); // LPDWORD
-	ADD_PARAM_NAME("SCardGetCardTypeProviderNameW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardGetCardTypeProviderNameW", 2, "szCardName"); // LPCWSTR
-	ADD_PARAM_NAME("SCardGetCardTypeProviderNameW", 3, "dwProviderId"); // DWORD
-	ADD_PARAM_NAME("SCardGetCardTypeProviderNameW", 4, "szProvider"); // LPWSTR
-	ADD_PARAM_NAME("SCardGetCardTypeProviderNameW", 5, "pcchProvider"); // LPDWORD
-	ADD_PARAM_NAME("SCardGetProviderIdA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardGetProviderIdA", 2, "szCard"); // LPCSTR
-	ADD_PARAM_NAME("SCardGetProviderIdA", 3, "pguidProviderId"); // LPGUID
-	ADD_PARAM_NAME("SCardGetProviderIdW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardGetProviderIdW", 2, "szCard"); // LPCWSTR
-	ADD_PARAM_NAME("SCardGetProviderIdW", 3, "pguidProviderId"); // LPGUID
-	ADD_PARAM_NAME("SCardGetStatusChangeA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardGetStatusChangeA", 2, "dwTimeout"); // DWORD
-	ADD_PARAM_NAME("SCardGetStatusChangeA", 3, "rgReaderStates"); // LPSCARD_READERSTATEA
-	ADD_PARAM_NAME("SCardGetStatusChangeA", 4, "cReaders"); // DWORD
-	ADD_PARAM_NAME("SCardGetStatusChangeW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardGetStatusChangeW", 2, "dwTimeout"); // DWORD
-	ADD_PARAM_NAME("SCardGetStatusChangeW", 3, "rgReaderStates"); // LPSCARD_READERSTATEW
-	ADD_PARAM_NAME("SCardGetStatusChangeW", 4, "cReaders"); // DWORD
-	ADD_PARAM_NAME("SCardGetTransmitCount", 1, "hCard"); // SCARDHANDLE
-	ADD_PARAM_NAME("SCardGetTransmitCount", 2, "pcTransmitCount"); // LPDWORD
-	ADD_PARAM_NAME("SCardIntroduceCardTypeA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardIntroduceCardTypeA", 2, "szCardName"); // LPCSTR
-	ADD_PARAM_NAME("SCardIntroduceCardTypeA", 3, "pguidPrimaryProvider"); // LPCGUID
-	ADD_PARAM_NAME("SCardIntroduceCardTypeA", 4, "rgguidInterfaces"); // LPCGUID
-	ADD_PARAM_NAME("SCardIntroduceCardTypeA", 5, "dwInterfaceCount"); // DWORD
-	ADD_PARAM_NAME("SCardIntroduceCardTypeA", 6, "pbAtr"); // LPCBYTE
-	ADD_PARAM_NAME("SCardIntroduceCardTypeA", 7, "pbAtrMask"); // LPCBYTE
-	ADD_PARAM_NAME("SCardIntroduceCardTypeA", 8, "cbAtrLen"); // DWORD
-	ADD_PARAM_NAME("SCardIntroduceCardTypeW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardIntroduceCardTypeW", 2, "szCardName"); // LPCWSTR
-	ADD_PARAM_NAME("SCardIntroduceCardTypeW", 3, "pguidPrimaryProvider"); // LPCGUID
-	ADD_PARAM_NAME("SCardIntroduceCardTypeW", 4, "rgguidInterfaces"); // LPCGUID
-	ADD_PARAM_NAME("SCardIntroduceCardTypeW", 5, "dwInterfaceCount"); // DWORD
-	ADD_PARAM_NAME("SCardIntroduceCardTypeW", 6, "pbAtr"); // LPCBYTE
-	ADD_PARAM_NAME("SCardIntroduceCardTypeW", 7, "pbAtrMask"); // LPCBYTE
-	ADD_PARAM_NAME("SCardIntroduceCardTypeW", 8, "cbAtrLen"); // DWORD
-	ADD_PARAM_NAME("SCardIntroduceReaderA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardIntroduceReaderA", 2, "szReaderName"); // LPCSTR
-	ADD_PARAM_NAME("SCardIntroduceReaderA", 3, "szDeviceName"); // LPCSTR
-	ADD_PARAM_NAME("SCardIntroduceReaderGroupA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardIntroduceReaderGroupA", 2, "szGroupName"); // LPCSTR
-	ADD_PARAM_NAME("SCardIntroduceReaderGroupW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardIntroduceReaderGroupW", 2, "szGroupName"); // LPCWSTR
-	ADD_PARAM_NAME("SCardIntroduceReaderW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardIntroduceReaderW", 2, "szReaderName"); // LPCWSTR
-	ADD_PARAM_NAME("SCardIntroduceReaderW", 3, "szDeviceName"); // LPCWSTR
-	ADD_PARAM_NAME("SCardIsValidContext", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardListCardsA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardListCardsA", 2, "pbAtr"); // LPCBYTE
-	ADD_PARAM_NAME("SCardListCardsA", 3, "rgquidInterfaces"); // LPCGUID
-	ADD_PARAM_NAME("SCardListCardsA", 4, "cguidInterfaceCount"); // DWORD
-	ADD_PARAM_NAME("SCardListCardsA", 5, "mszCards"); // LPSTR
-	ADD_PARAM_NAME("SCardListCardsA", 6, "pcchCards"); // LPDWORD
-	ADD_PARAM_NAME("SCardListCardsW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardListCardsW", 2, "pbAtr"); // LPCBYTE
-	ADD_PARAM_NAME("SCardListCardsW", 3, "rgquidInterfaces"); // LPCGUID
-	ADD_PARAM_NAME("SCardListCardsW", 4, "cguidInterfaceCount"); // DWORD
-	ADD_PARAM_NAME("SCardListCardsW", 5, "mszCards"); // LPWSTR
-	ADD_PARAM_NAME("SCardListCardsW", 6, "pcchCards"); // LPDWORD
-	ADD_PARAM_NAME("SCardListInterfacesA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardListInterfacesA", 2, "szCard"); // LPCSTR
-	ADD_PARAM_NAME("SCardListInterfacesA", 3, "pguidInterfaces"); // LPGUID
-	ADD_PARAM_NAME("SCardListInterfacesA", 4, "pcguidInterfaces"); // LPDWORD
-	ADD_PARAM_NAME("SCardListInterfacesW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardListInterfacesW", 2, "szCard"); // LPCWSTR
-	ADD_PARAM_NAME("SCardListInterfacesW", 3, "pguidInterfaces"); // LPGUID
-	ADD_PARAM_NAME("SCardListInterfacesW", 4, "pcguidInterfaces"); // LPDWORD
-	ADD_PARAM_NAME("SCardListReaderGroupsA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardListReaderGroupsA", 2, "mszGroups"); // LPSTR
-	ADD_PARAM_NAME("SCardListReaderGroupsA", 3, "pcchGroups"); // LPDWORD
-	ADD_PARAM_NAME("SCardListReaderGroupsW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardListReaderGroupsW", 2, "mszGroups"); // LPWSTR
-	ADD_PARAM_NAME("SCardListReaderGroupsW", 3, "pcchGroups"); // LPDWORD
-	ADD_PARAM_NAME("SCardListReadersA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardListReadersA", 2, "mszGroups"); // LPCSTR
-	ADD_PARAM_NAME("SCardListReadersA", 3, "mszReaders"); // LPSTR
-	ADD_PARAM_NAME("SCardListReadersA", 4, "pcchReaders"); // LPDWORD
-	ADD_PARAM_NAME("SCardListReadersW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardListReadersW", 2, "mszGroups"); // LPCWSTR
-	ADD_PARAM_NAME("SCardListReadersW", 3, "mszReaders"); // LPWSTR
-	ADD_PARAM_NAME("SCardListReadersW", 4, "pcchReaders"); // LPDWORD
-	ADD_PARAM_NAME("SCardLocateCardsA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardLocateCardsA", 2, "mszCards"); // LPCSTR
-	ADD_PARAM_NAME("SCardLocateCardsA", 3, "rgReaderStates"); // LPSCARD_READERSTATEA
-	ADD_PARAM_NAME("SCardLocateCardsA", 4, "cReaders"); // DWORD
-	ADD_PARAM_NAME("SCardLocateCardsByATRA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardLocateCardsByATRA", 2, "rgAtrMasks"); // LPSCARD_ATRMASK
-	ADD_PARAM_NAME("SCardLocateCardsByATRA", 3, "cAtrs"); // DWORD
-	ADD_PARAM_NAME("SCardLocateCardsByATRA", 4, "rgReaderStates"); // LPSCARD_READERSTATEA
-	ADD_PARAM_NAME("SCardLocateCardsByATRA", 5, "cReaders"); // DWORD
-	ADD_PARAM_NAME("SCardLocateCardsByATRW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardLocateCardsByATRW", 2, "rgAtrMasks"); // LPSCARD_ATRMASK
-	ADD_PARAM_NAME("SCardLocateCardsByATRW", 3, "cAtrs"); // DWORD
-	ADD_PARAM_NAME("SCardLocateCardsByATRW", 4, "rgReaderStates"); // LPSCARD_READERSTATEW
-	ADD_PARAM_NAME("SCardLocateCardsByATRW", 5, "cReaders"); // DWORD
-	ADD_PARAM_NAME("SCardLocateCardsW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardLocateCardsW", 2, "mszCards"); // LPCWSTR
-	ADD_PARAM_NAME("SCardLocateCardsW", 3, "rgReaderStates"); // LPSCARD_READERSTATEW
-	ADD_PARAM_NAME("SCardLocateCardsW", 4, "cReaders"); // DWORD
-	ADD_PARAM_NAME("SCardReadCacheA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardReadCacheA", 2, "CardIdentifier"); // UUID *
-	ADD_PARAM_NAME("SCardReadCacheA", 3, "FreshnessCounter"); // DWORD
-	ADD_PARAM_NAME("SCardReadCacheA", 4, "LookupName"); // LPSTR
-	ADD_PARAM_NAME("SCardReadCacheA", 5, "Data"); // PBYTE
-	ADD_PARAM_NAME("SCardReadCacheA", 6, "DataLen"); // DWORD *
-	ADD_PARAM_NAME("SCardReadCacheW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardReadCacheW", 2, "CardIdentifier"); // UUID *
-	ADD_PARAM_NAME("SCardReadCacheW", 3, "FreshnessCounter"); // DWORD
-	ADD_PARAM_NAME("SCardReadCacheW", 4, "LookupName"); // LPWSTR
-	ADD_PARAM_NAME("SCardReadCacheW", 5, "Data"); // PBYTE
-	ADD_PARAM_NAME("SCardReadCacheW", 6, "DataLen"); // DWORD *
-	ADD_PARAM_NAME("SCardReconnect", 1, "hCard"); // SCARDHANDLE
-	ADD_PARAM_NAME("SCardReconnect", 2, "dwShareMode"); // DWORD
-	ADD_PARAM_NAME("SCardReconnect", 3, "dwPreferredProtocols"); // DWORD
-	ADD_PARAM_NAME("SCardReconnect", 4, "dwInitialization"); // DWORD
-	ADD_PARAM_NAME("SCardReconnect", 5, "pdwActiveProtocol"); // LPDWORD
-	ADD_PARAM_NAME("SCardReleaseContext", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardRemoveReaderFromGroupA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardRemoveReaderFromGroupA", 2, "szReaderName"); // LPCSTR
-	ADD_PARAM_NAME("SCardRemoveReaderFromGroupA", 3, "szGroupName"); // LPCSTR
-	ADD_PARAM_NAME("SCardRemoveReaderFromGroupW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardRemoveReaderFromGroupW", 2, "szReaderName"); // LPCWSTR
-	ADD_PARAM_NAME("SCardRemoveReaderFromGroupW", 3, "szGroupName"); // LPCWSTR
-	ADD_PARAM_NAME("SCardSetAttrib", 1, "hCard"); // SCARDHANDLE
-	ADD_PARAM_NAME("SCardSetAttrib", 2, "dwAttrId"); // DWORD
-	ADD_PARAM_NAME("SCardSetAttrib", 3, "pbAttr"); // LPCBYTE
-	ADD_PARAM_NAME("SCardSetAttrib", 4, "cbAttrLen"); // DWORD
-	ADD_PARAM_NAME("SCardSetCardTypeProviderNameA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardSetCardTypeProviderNameA", 2, "szCardName"); // LPCSTR
-	ADD_PARAM_NAME("SCardSetCardTypeProviderNameA", 3, "dwProviderId"); // DWORD
-	ADD_PARAM_NAME("SCardSetCardTypeProviderNameA", 4, "szProvider"); // LPCSTR
-	ADD_PARAM_NAME("SCardSetCardTypeProviderNameW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardSetCardTypeProviderNameW", 2, "szCardName"); // LPCWSTR
-	ADD_PARAM_NAME("SCardSetCardTypeProviderNameW", 3, "dwProviderId"); // DWORD
-	ADD_PARAM_NAME("SCardSetCardTypeProviderNameW", 4, "szProvider"); // LPCWSTR
-	ADD_PARAM_NAME("SCardState", 1, "hCard"); // SCARDHANDLE
-	ADD_PARAM_NAME("SCardState", 2, "pdwState"); // LPDWORD
-	ADD_PARAM_NAME("SCardState", 3, "pdwProtocol"); // LPDWORD
-	ADD_PARAM_NAME("SCardState", 4, "pbAtr"); // LPBYTE
-	ADD_PARAM_NAME("SCardState", 5, "pcbAtrLen"); // LPDWORD
-	ADD_PARAM_NAME("SCardStatusA", 1, "hCard"); // SCARDHANDLE
-	ADD_PARAM_NAME("SCardStatusA", 2, "szReaderName"); // LPSTR
-	ADD_PARAM_NAME("SCardStatusA", 3, "pcchReaderLen"); // LPDWORD
-	ADD_PARAM_NAME("SCardStatusA", 4, "pdwState"); // LPDWORD
-	ADD_PARAM_NAME("SCardStatusA", 5, "pdwProtocol"); // LPDWORD
-	ADD_PARAM_NAME("SCardStatusA", 6, "pbAtr"); // LPBYTE
-	ADD_PARAM_NAME("SCardStatusA", 7, "pcbAtrLen"); // LPDWORD
-	ADD_PARAM_NAME("SCardStatusW", 1, "hCard"); // SCARDHANDLE
-	ADD_PARAM_NAME("SCardStatusW", 2, "szReaderName"); // LPWSTR
-	ADD_PARAM_NAME("SCardStatusW", 3, "pcchReaderLen"); // LPDWORD
-	ADD_PARAM_NAME("SCardStatusW", 4, "pdwState"); // LPDWORD
-	ADD_PARAM_NAME("SCardStatusW", 5, "pdwProtocol"); // LPDWORD
-	ADD_PARAM_NAME("SCardStatusW", 6, "pbAtr"); // LPBYTE
-	ADD_PARAM_NAME("SCardStatusW", 7, "pcbAtrLen"); // LPDWORD
-	ADD_PARAM_NAME("SCardTransmit", 1, "hCard"); // SCARDHANDLE
-	ADD_PARAM_NAME("SCardTransmit", 2, "pioSendPci"); // LPCSCARD_IO_REQUEST
-	ADD_PARAM_NAME("SCardTransmit", 3, "pbSendBuffer"); // LPCBYTE
-	ADD_PARAM_NAME("SCardTransmit", 4, "cbSendLength"); // DWORD
-	ADD_PARAM_NAME("SCardTransmit", 5, "pioRecvPci"); // LPSCARD_IO_REQUEST
-	ADD_PARAM_NAME("SCardTransmit", 6, "pbRecvBuffer"); // LPBYTE
-	ADD_PARAM_NAME("SCardTransmit", 7, "pcbRecvLength"); // LPDWORD
-	ADD_PARAM_NAME("SCardUIDlgSelectCardA", 1, "pDlgStruc"); // LPOPENCARDNAMEA_EX
-	ADD_PARAM_NAME("SCardUIDlgSelectCardW", 1, "pDlgStruc"); // LPOPENCARDNAMEW_EX
-	ADD_PARAM_NAME("SCardWriteCacheA", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardWriteCacheA", 2, "CardIdentifier"); // UUID *
-	ADD_PARAM_NAME("SCardWriteCacheA", 3, "FreshnessCounter"); // DWORD
-	ADD_PARAM_NAME("SCardWriteCacheA", 4, "LookupName"); // LPSTR
-	ADD_PARAM_NAME("SCardWriteCacheA", 5, "Data"); // PBYTE
-	ADD_PARAM_NAME("SCardWriteCacheA", 6, "DataLen"); // DWORD
-	ADD_PARAM_NAME("SCardWriteCacheW", 1, "hContext"); // SCARDCONTEXT
-	ADD_PARAM_NAME("SCardWriteCacheW", 2, "CardIdentifier"); // UUID *
-	ADD_PARAM_NAME("SCardWriteCacheW", 3, "FreshnessCounter"); // DWORD
-	ADD_PARAM_NAME("SCardWriteCacheW", 4, "LookupName"); // LPWSTR
-	ADD_PARAM_NAME("SCardWriteCacheW", 5, "Data"); // PBYTE
-	ADD_PARAM_NAME("SCardWriteCacheW", 6, "DataLen"); // DWORD
-	ADD_PARAM_NAME("SaferCloseLevel", 1, "hLevelHandle"); // SAFER_LEVEL_HANDLE
-	ADD_PARAM_NAME("SaferComputeTokenFromLevel", 1, "LevelHandle"); // SAFER_LEVEL_HANDLE
-	ADD_PARAM_NAME("SaferComputeTokenFromLevel", 2, "InAccessToken"); // HANDLE
-	ADD_PARAM_NAME("SaferComputeTokenFromLevel", 3, "OutAccessToken"); // PHANDLE
-	ADD_PARAM_NAME("SaferComputeTokenFromLevel", 4, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("SaferComputeTokenFromLevel", 5, "lpReserved"); // LPVOID
-	ADD_PARAM_NAME("SaferCreateLevel", 1, "dwScopeId"); // DWORD
-	ADD_PARAM_NAME("SaferCreateLevel", 2, "dwLevelId"); // DWORD
-	ADD_PARAM_NAME("SaferCreateLevel", 3, "OpenFlags"); // DWORD
-	ADD_PARAM_NAME("SaferCreateLevel", 4, "pLevelHandle"); // SAFER_LEVEL_HANDLE *
-	ADD_PARAM_NAME("SaferCreateLevel", 5, "lpReserved"); // LPVOID
-	ADD_PARAM_NAME("SaferGetLevelInformation", 1, "LevelHandle"); // SAFER_LEVEL_HANDLE
-	ADD_PARAM_NAME("SaferGetLevelInformation", 2, "dwInfoType"); // SAFER_OBJECT_INFO_CLASS
-	ADD_PARAM_NAME("SaferGetLevelInformation", 3, "lpQueryBuffer"); // LPVOID
-	ADD_PARAM_NAME("SaferGetLevelInformation", 4, "dwInBufferSize"); // DWORD
-	ADD_PARAM_NAME("SaferGetLevelInformation", 5, "lpdwOutBufferSize"); // LPDWORD
-	ADD_PARAM_NAME("SaferGetPolicyInformation", 1, "dwScopeId"); // DWORD
-	ADD_PARAM_NAME("SaferGetPolicyInformation", 2, "SaferPolicyInfoClass"); // SAFER_POLICY_INFO_CLASS
-	ADD_PARAM_NAME("SaferGetPolicyInformation", 3, "InfoBufferSize"); // DWORD
-	ADD_PARAM_NAME("SaferGetPolicyInformation", 4, "InfoBuffer"); // PVOID
-	ADD_PARAM_NAME("SaferGetPolicyInformation", 5, "InfoBufferRetSize"); // PDWORD
-	ADD_PARAM_NAME("SaferGetPolicyInformation", 6, "lpReserved"); // LPVOID
-	ADD_PARAM_NAME("SaferIdentifyLevel", 1, "dwNumProperties"); // DWORD
-	ADD_PARAM_NAME("SaferIdentifyLevel", 2, "pCodeProperties"); // PSAFER_CODE_PROPERTIES
-	ADD_PARAM_NAME("SaferIdentifyLevel", 3, "pLevelHandle"); // SAFER_LEVEL_HANDLE *
-	ADD_PARAM_NAME("SaferIdentifyLevel", 4, "lpReserved"); // LPVOID
-	ADD_PARAM_NAME("SaferRecordEventLogEntry", 1, "hLevel"); // SAFER_LEVEL_HANDLE
-	ADD_PARAM_NAME("SaferRecordEventLogEntry", 2, "szTargetPath"); // LPCWSTR
-	ADD_PARAM_NAME("SaferRecordEventLogEntry", 3, "lpReserved"); // LPVOID
-	ADD_PARAM_NAME("SaferSetLevelInformation", 1, "LevelHandle"); // SAFER_LEVEL_HANDLE
-	ADD_PARAM_NAME("SaferSetLevelInformation", 2, "dwInfoType"); // SAFER_OBJECT_INFO_CLASS
-	ADD_PARAM_NAME("SaferSetLevelInformation", 3, "lpQueryBuffer"); // LPVOID
-	ADD_PARAM_NAME("SaferSetLevelInformation", 4, "dwInBufferSize"); // DWORD
-	ADD_PARAM_NAME("SaferSetPolicyInformation", 1, "dwScopeId"); // DWORD
-	ADD_PARAM_NAME("SaferSetPolicyInformation", 2, "SaferPolicyInfoClass"); // SAFER_POLICY_INFO_CLASS
-	ADD_PARAM_NAME("SaferSetPolicyInformation", 3, "InfoBufferSize"); // DWORD
-	ADD_PARAM_NAME("SaferSetPolicyInformation", 4, "InfoBuffer"); // PVOID
-	ADD_PARAM_NAME("SaferSetPolicyInformation", 5, "lpReserved"); // LPVOID
-	ADD_PARAM_NAME("SaferiIsExecutableFileType", 1, "szFullPathname"); // LPCWSTR
-	ADD_PARAM_NAME("SaferiIsExecutableFileType", 2, "bFromShellExecute"); // BOOLEAN
-	ADD_PARAM_NAME("SaveDC", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("ScaleViewportExtEx", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("ScaleViewportExtEx", 2, "xn"); // int
-	ADD_PARAM_NAME("ScaleViewportExtEx", 3, "dx"); // int
-	ADD_PARAM_NAME("ScaleViewportExtEx", 4, "yn"); // int
-	ADD_PARAM_NAME("ScaleViewportExtEx", 5, "yd"); // int
-	ADD_PARAM_NAME("ScaleViewportExtEx", 6, "lpsz"); // LPSIZE
-	ADD_PARAM_NAME("ScaleWindowExtEx", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("ScaleWindowExtEx", 2, "xn"); // int
-	ADD_PARAM_NAME("ScaleWindowExtEx", 3, "xd"); // int
-	ADD_PARAM_NAME("ScaleWindowExtEx", 4, "yn"); // int
-	ADD_PARAM_NAME("ScaleWindowExtEx", 5, "yd"); // int
-	ADD_PARAM_NAME("ScaleWindowExtEx", 6, "lpsz"); // LPSIZE
-	ADD_PARAM_NAME("ScheduleJob", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("ScheduleJob", 2, "JobId"); // DWORD
-	ADD_PARAM_NAME("ScreenToClient", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("ScreenToClient", 2, "lpPoint"); // LPPOINT
-	ADD_PARAM_NAME("ScrollConsoleScreenBufferA", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("ScrollConsoleScreenBufferA", 2, "lpScrollRectangle"); // CONST SMALL_RECT *
-	ADD_PARAM_NAME("ScrollConsoleScreenBufferA", 3, "lpClipRectangle"); // CONST SMALL_RECT *
-	ADD_PARAM_NAME("ScrollConsoleScreenBufferA", 4, "dwDestinationOrigin"); // COORD
-	ADD_PARAM_NAME("ScrollConsoleScreenBufferA", 5, "lpFill"); // CONST CHAR_INFO *
-	ADD_PARAM_NAME("ScrollConsoleScreenBufferW", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("ScrollConsoleScreenBufferW", 2, "lpScrollRectangle"); // CONST SMALL_RECT *
-	ADD_PARAM_NAME("ScrollConsoleScreenBufferW", 3, "lpClipRectangle"); // CONST SMALL_RECT *
-	ADD_PARAM_NAME("ScrollConsoleScreenBufferW", 4, "dwDestinationOrigin"); // COORD
-	ADD_PARAM_NAME("ScrollConsoleScreenBufferW", 5, "lpFill"); // CONST CHAR_INFO *
-	ADD_PARAM_NAME("ScrollDC", 1, "hDC"); // HDC
-	ADD_PARAM_NAME("ScrollDC", 2, "dx"); // int
-	ADD_PARAM_NAME("ScrollDC", 3, "dy"); // int
-	ADD_PARAM_NAME("ScrollDC", 4, "lprcScroll"); // CONST RECT *
-	ADD_PARAM_NAME("ScrollDC", 5, "lprcClip"); // CONST RECT *
-	ADD_PARAM_NAME("ScrollDC", 6, "hrgnUpdate"); // HRGN
-	ADD_PARAM_NAME("ScrollDC", 7, "lprcUpdate"); // LPRECT
-	ADD_PARAM_NAME("ScrollWindow", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("ScrollWindow", 2, "XAmount"); // int
-	ADD_PARAM_NAME("ScrollWindow", 3, "YAmount"); // int
-	ADD_PARAM_NAME("ScrollWindow", 4, "lpRect"); // CONST RECT *
-	ADD_PARAM_NAME("ScrollWindow", 5, "lpClipRect"); // CONST RECT *
-	ADD_PARAM_NAME("ScrollWindowEx", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("ScrollWindowEx", 2, "dx"); // int
-	ADD_PARAM_NAME("ScrollWindowEx", 3, "dy"); // int
-	ADD_PARAM_NAME("ScrollWindowEx", 4, "prcScroll"); // CONST RECT *
-	ADD_PARAM_NAME("ScrollWindowEx", 5, "prcClip"); // CONST RECT *
-	ADD_PARAM_NAME("ScrollWindowEx", 6, "hrgnUpdate"); // HRGN
-	ADD_PARAM_NAME("ScrollWindowEx", 7, "prcUpdate"); // LPRECT
-	ADD_PARAM_NAME("ScrollWindowEx", 8, "flags"); // UINT
-	ADD_PARAM_NAME("SearchPathA", 1, "lpPath"); // LPCSTR
-	ADD_PARAM_NAME("SearchPathA", 2, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("SearchPathA", 3, "lpExtension"); // LPCSTR
-	ADD_PARAM_NAME("SearchPathA", 4, "nBufferLength"); // DWORD
-	ADD_PARAM_NAME("SearchPathA", 5, "lpBuffer"); // LPSTR
-	ADD_PARAM_NAME("SearchPathA", 6, "lpFilePart"); // LPSTR *
-	ADD_PARAM_NAME("SearchPathW", 1, "lpPath"); // LPCWSTR
-	ADD_PARAM_NAME("SearchPathW", 2, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("SearchPathW", 3, "lpExtension"); // LPCWSTR
-	ADD_PARAM_NAME("SearchPathW", 4, "nBufferLength"); // DWORD
-	ADD_PARAM_NAME("SearchPathW", 5, "lpBuffer"); // LPWSTR
-	ADD_PARAM_NAME("SearchPathW", 6, "lpFilePart"); // LPWSTR *
-	ADD_PARAM_NAME("SelectClipPath", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SelectClipPath", 2, "mode"); // int
-	ADD_PARAM_NAME("SelectClipRgn", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SelectClipRgn", 2, "hrgn"); // HRGN
-	ADD_PARAM_NAME("SelectObject", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SelectObject", 2, "h"); // HGDIOBJ
-	ADD_PARAM_NAME("SelectPalette", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SelectPalette", 2, "hPal"); // HPALETTE
-	ADD_PARAM_NAME("SelectPalette", 3, "bForceBkgd"); // WINBOOL
-	ADD_PARAM_NAME("SendDlgItemMessageA", 1, "hDlg"); // HWND
-	ADD_PARAM_NAME("SendDlgItemMessageA", 2, "nIDDlgItem"); // int
-	ADD_PARAM_NAME("SendDlgItemMessageA", 3, "Msg"); // UINT
-	ADD_PARAM_NAME("SendDlgItemMessageA", 4, "wParam"); // WPARAM
-	ADD_PARAM_NAME("SendDlgItemMessageA", 5, "lParam"); // LPARAM
-	ADD_PARAM_NAME("SendDlgItemMessageW", 1, "hDlg"); // HWND
-	ADD_PARAM_NAME("SendDlgItemMessageW", 2, "nIDDlgItem"); // int
-	ADD_PARAM_NAME("SendDlgItemMessageW", 3, "Msg"); // UINT
-	ADD_PARAM_NAME("SendDlgItemMessageW", 4, "wParam"); // WPARAM
-	ADD_PARAM_NAME("SendDlgItemMessageW", 5, "lParam"); // LPARAM
-	ADD_PARAM_NAME("SendInput", 1, "cInputs"); // UINT
-	ADD_PARAM_NAME("SendInput", 2, "pInputs"); // LPINPUT
-	ADD_PARAM_NAME("SendInput", 3, "cbSize"); // int
-	ADD_PARAM_NAME("SendMessageA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SendMessageA", 2, "Msg"); // UINT
-	ADD_PARAM_NAME("SendMessageA", 3, "wParam"); // WPARAM
-	ADD_PARAM_NAME("SendMessageA", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("SendMessageCallbackA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SendMessageCallbackA", 2, "Msg"); // UINT
-	ADD_PARAM_NAME("SendMessageCallbackA", 3, "wParam"); // WPARAM
-	ADD_PARAM_NAME("SendMessageCallbackA", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("SendMessageCallbackA", 5, "lpResultCallBack"); // SENDASYNCPROC
-	ADD_PARAM_NAME("SendMessageCallbackA", 6, "dwData"); // ULONG_PTR
-	ADD_PARAM_NAME("SendMessageCallbackW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SendMessageCallbackW", 2, "Msg"); // UINT
-	ADD_PARAM_NAME("SendMessageCallbackW", 3, "wParam"); // WPARAM
-	ADD_PARAM_NAME("SendMessageCallbackW", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("SendMessageCallbackW", 5, "lpResultCallBack"); // SENDASYNCPROC
-	ADD_PARAM_NAME("SendMessageCallbackW", 6, "dwData"); // ULONG_PTR
-	ADD_PARAM_NAME("SendMessageTimeoutA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SendMessageTimeoutA", 2, "Msg"); // UINT
-	ADD_PARAM_NAME("SendMessageTimeoutA", 3, "wParam"); // WPARAM
-	ADD_PARAM_NAME("SendMessageTimeoutA", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("SendMessageTimeoutA", 5, "fuFlags"); // UINT
-	ADD_PARAM_NAME("SendMessageTimeoutA", 6, "uTimeout"); // UINT
-	ADD_PARAM_NAME("SendMessageTimeoutA", 7, "lpdwResult"); // PDWORD_PTR
-	ADD_PARAM_NAME("SendMessageTimeoutW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SendMessageTimeoutW", 2, "Msg"); // UINT
-	ADD_PARAM_NAME("SendMessageTimeoutW", 3, "wParam"); // WPARAM
-	ADD_PARAM_NAME("SendMessageTimeoutW", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("SendMessageTimeoutW", 5, "fuFlags"); // UINT
-	ADD_PARAM_NAME("SendMessageTimeoutW", 6, "uTimeout"); // UINT
-	ADD_PARAM_NAME("SendMessageTimeoutW", 7, "lpdwResult"); // PDWORD_PTR
-	ADD_PARAM_NAME("SendMessageW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SendMessageW", 2, "Msg"); // UINT
-	ADD_PARAM_NAME("SendMessageW", 3, "wParam"); // WPARAM
-	ADD_PARAM_NAME("SendMessageW", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("SendNotifyMessageA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SendNotifyMessageA", 2, "Msg"); // UINT
-	ADD_PARAM_NAME("SendNotifyMessageA", 3, "wParam"); // WPARAM
-	ADD_PARAM_NAME("SendNotifyMessageA", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("SendNotifyMessageW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SendNotifyMessageW", 2, "Msg"); // UINT
-	ADD_PARAM_NAME("SendNotifyMessageW", 3, "wParam"); // WPARAM
-	ADD_PARAM_NAME("SendNotifyMessageW", 4, "lParam"); // LPARAM
-	ADD_PARAM_NAME("SetAbortProc", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetAbortProc", 2, "lpProc"); // ABORTPROC
-	ADD_PARAM_NAME("SetAclInformation", 1, "pAcl"); // PACL
-	ADD_PARAM_NAME("SetAclInformation", 2, "pAclInformation"); // LPVOID
-	ADD_PARAM_NAME("SetAclInformation", 3, "nAclInformationLength"); // DWORD
-	ADD_PARAM_NAME("SetAclInformation", 4, "dwAclInformationClass"); // ACL_INFORMATION_CLASS
-	ADD_PARAM_NAME("SetActiveWindow", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetArcDirection", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetArcDirection", 2, "dir"); // int
-	ADD_PARAM_NAME("SetBitmapBits", 1, "hbm"); // HBITMAP
-	ADD_PARAM_NAME("SetBitmapBits", 2, "cb"); // DWORD
-	ADD_PARAM_NAME("SetBitmapBits", 3, "pvBits"); // CONST VOID *
-	ADD_PARAM_NAME("SetBitmapDimensionEx", 1, "hbm"); // HBITMAP
-	ADD_PARAM_NAME("SetBitmapDimensionEx", 2, "w"); // int
-	ADD_PARAM_NAME("SetBitmapDimensionEx", 3, "h"); // int
-	ADD_PARAM_NAME("SetBitmapDimensionEx", 4, "lpsz"); // LPSIZE
-	ADD_PARAM_NAME("SetBkColor", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetBkColor", 2, "color"); // COLORREF
-	ADD_PARAM_NAME("SetBkMode", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetBkMode", 2, "mode"); // int
-	ADD_PARAM_NAME("SetBoundsRect", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetBoundsRect", 2, "lprect"); // CONST RECT *
-	ADD_PARAM_NAME("SetBoundsRect", 3, "flags"); // UINT
-	ADD_PARAM_NAME("SetBrushOrgEx", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetBrushOrgEx", 2, "x"); // int
-	ADD_PARAM_NAME("SetBrushOrgEx", 3, "y"); // int
-	ADD_PARAM_NAME("SetBrushOrgEx", 4, "lppt"); // LPPOINT
-	ADD_PARAM_NAME("SetCalendarInfoA", 1, "Locale"); // LCID
-	ADD_PARAM_NAME("SetCalendarInfoA", 2, "Calendar"); // CALID
-	ADD_PARAM_NAME("SetCalendarInfoA", 3, "CalType"); // CALTYPE
-	ADD_PARAM_NAME("SetCalendarInfoA", 4, "lpCalData"); // LPCSTR
-	ADD_PARAM_NAME("SetCalendarInfoW", 1, "Locale"); // LCID
-	ADD_PARAM_NAME("SetCalendarInfoW", 2, "Calendar"); // CALID
-	ADD_PARAM_NAME("SetCalendarInfoW", 3, "CalType"); // CALTYPE
-	ADD_PARAM_NAME("SetCalendarInfoW", 4, "lpCalData"); // LPCWSTR
-	ADD_PARAM_NAME("SetCapture", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetCaretBlinkTime", 1, "uMSeconds"); // UINT
-	ADD_PARAM_NAME("SetCaretPos", 1, "X"); // int
-	ADD_PARAM_NAME("SetCaretPos", 2, "Y"); // int
-	ADD_PARAM_NAME("SetClassLongA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetClassLongA", 2, "nIndex"); // int
-	ADD_PARAM_NAME("SetClassLongA", 3, "dwNewLong"); // LONG
-	ADD_PARAM_NAME("SetClassLongPtrA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetClassLongPtrA", 2, "nIndex"); // int
-	ADD_PARAM_NAME("SetClassLongPtrA", 3, "dwNewLong"); // LONG_PTR
-	ADD_PARAM_NAME("SetClassLongPtrW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetClassLongPtrW", 2, "nIndex"); // int
-	ADD_PARAM_NAME("SetClassLongPtrW", 3, "dwNewLong"); // LONG_PTR
-	ADD_PARAM_NAME("SetClassLongW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetClassLongW", 2, "nIndex"); // int
-	ADD_PARAM_NAME("SetClassLongW", 3, "dwNewLong"); // LONG
-	ADD_PARAM_NAME("SetClassWord", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetClassWord", 2, "nIndex"); // int
-	ADD_PARAM_NAME("SetClassWord", 3, "wNewWord"); // WORD
-	ADD_PARAM_NAME("SetClipboardData", 1, "uFormat"); // UINT
-	ADD_PARAM_NAME("SetClipboardData", 2, "hMem"); // HANDLE
-	ADD_PARAM_NAME("SetClipboardViewer", 1, "hWndNewViewer"); // HWND
-	ADD_PARAM_NAME("SetColorAdjustment", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetColorAdjustment", 2, "lpca"); // CONST COLORADJUSTMENT *
-	ADD_PARAM_NAME("SetColorSpace", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetColorSpace", 2, "hcs"); // HCOLORSPACE
-	ADD_PARAM_NAME("SetCommBreak", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("SetCommConfig", 1, "hCommDev"); // HANDLE
-	ADD_PARAM_NAME("SetCommConfig", 2, "lpCC"); // LPCOMMCONFIG
-	ADD_PARAM_NAME("SetCommConfig", 3, "dwSize"); // DWORD
-	ADD_PARAM_NAME("SetCommMask", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("SetCommMask", 2, "dwEvtMask"); // DWORD
-	ADD_PARAM_NAME("SetCommState", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("SetCommState", 2, "lpDCB"); // LPDCB
-	ADD_PARAM_NAME("SetCommTimeouts", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("SetCommTimeouts", 2, "lpCommTimeouts"); // LPCOMMTIMEOUTS
-	ADD_PARAM_NAME("SetComputerNameA", 1, "lpComputerName"); // LPCSTR
-	ADD_PARAM_NAME("SetComputerNameExA", 1, "NameType"); // COMPUTER_NAME_FORMAT
-	ADD_PARAM_NAME("SetComputerNameExA", 2, "lpBuffer"); // LPCSTR
-	ADD_PARAM_NAME("SetComputerNameExW", 1, "NameType"); // COMPUTER_NAME_FORMAT
-	ADD_PARAM_NAME("SetComputerNameExW", 2, "lpBuffer"); // LPCWSTR
-	ADD_PARAM_NAME("SetComputerNameW", 1, "lpComputerName"); // LPCWSTR
-	ADD_PARAM_NAME("SetConsoleActiveScreenBuffer", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("SetConsoleCP", 1, "wCodePageID"); // UINT
-	ADD_PARAM_NAME("SetConsoleCtrlHandler", 1, "HandlerRoutine"); // PHANDLER_ROUTINE
-	ADD_PARAM_NAME("SetConsoleCtrlHandler", 2, "Add"); // WINBOOL
-	ADD_PARAM_NAME("SetConsoleCursorInfo", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("SetConsoleCursorInfo", 2, "lpConsoleCursorInfo"); // CONST CONSOLE_CURSOR_INFO *
-	ADD_PARAM_NAME("SetConsoleCursorPosition", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("SetConsoleCursorPosition", 2, "dwCursorPosition"); // COORD
-	ADD_PARAM_NAME("SetConsoleDisplayMode", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("SetConsoleDisplayMode", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("SetConsoleDisplayMode", 3, "lpNewScreenBufferDimensions"); // PCOORD
-	ADD_PARAM_NAME("SetConsoleHistoryInfo", 1, "lpConsoleHistoryInfo"); // PCONSOLE_HISTORY_INFO
-	ADD_PARAM_NAME("SetConsoleMode", 1, "hConsoleHandle"); // HANDLE
-	ADD_PARAM_NAME("SetConsoleMode", 2, "dwMode"); // DWORD
-	ADD_PARAM_NAME("SetConsoleOutputCP", 1, "wCodePageID"); // UINT
-	ADD_PARAM_NAME("SetConsoleScreenBufferInfoEx", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("SetConsoleScreenBufferInfoEx", 2, "lpConsoleScreenBufferInfoEx"); // PCONSOLE_SCREEN_BUFFER_INFOEX
-	ADD_PARAM_NAME("SetConsoleScreenBufferSize", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("SetConsoleScreenBufferSize", 2, "dwSize"); // COORD
-	ADD_PARAM_NAME("SetConsoleTextAttribute", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("SetConsoleTextAttribute", 2, "wAttributes"); // WORD
-	ADD_PARAM_NAME("SetConsoleTitleA", 1, "lpConsoleTitle"); // LPCSTR
-	ADD_PARAM_NAME("SetConsoleTitleW", 1, "lpConsoleTitle"); // LPCWSTR
-	ADD_PARAM_NAME("SetConsoleWindowInfo", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("SetConsoleWindowInfo", 2, "bAbsolute"); // WINBOOL
-	ADD_PARAM_NAME("SetConsoleWindowInfo", 3, "lpConsoleWindow"); // CONST SMALL_RECT *
-	ADD_PARAM_NAME("SetCriticalSectionSpinCount", 1, "lpCriticalSection"); // LPCRITICAL_SECTION
-	ADD_PARAM_NAME("SetCriticalSectionSpinCount", 2, "dwSpinCount"); // DWORD
-	ADD_PARAM_NAME("SetCurrentConsoleFontEx", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("SetCurrentConsoleFontEx", 2, "bMaximumWindow"); // WINBOOL
-	ADD_PARAM_NAME("SetCurrentConsoleFontEx", 3, "lpConsoleCurrentFontEx"); // PCONSOLE_FONT_INFOEX
-	ADD_PARAM_NAME("SetCurrentDirectoryA", 1, "lpPathName"); // LPCSTR
-	ADD_PARAM_NAME("SetCurrentDirectoryW", 1, "lpPathName"); // LPCWSTR
-	ADD_PARAM_NAME("SetCursor", 1, "hCursor"); // HCURSOR
-	ADD_PARAM_NAME("SetCursorPos", 1, "X"); // int
-	ADD_PARAM_NAME("SetCursorPos", 2, "Y"); // int
-	ADD_PARAM_NAME("SetDCBrushColor", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetDCBrushColor", 2, "color"); // COLORREF
-	ADD_PARAM_NAME("SetDCPenColor", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetDCPenColor", 2, "color"); // COLORREF
-	ADD_PARAM_NAME("SetDIBColorTable", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetDIBColorTable", 2, "iStart"); // UINT
-	ADD_PARAM_NAME("SetDIBColorTable", 3, "cEntries"); // UINT
-	ADD_PARAM_NAME("SetDIBColorTable", 4, "prgbq"); // CONST RGBQUAD *
-	ADD_PARAM_NAME("SetDIBits", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetDIBits", 2, "hbm"); // HBITMAP
-	ADD_PARAM_NAME("SetDIBits", 3, "start"); // UINT
-	ADD_PARAM_NAME("SetDIBits", 4, "cLines"); // UINT
-	ADD_PARAM_NAME("SetDIBits", 5, "lpBits"); // CONST VOID *
-	ADD_PARAM_NAME("SetDIBits", 6, "lpbmi"); // CONST BITMAPINFO *
-	ADD_PARAM_NAME("SetDIBits", 7, "ColorUse"); // UINT
-	ADD_PARAM_NAME("SetDIBitsToDevice", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetDIBitsToDevice", 2, "xDest"); // int
-	ADD_PARAM_NAME("SetDIBitsToDevice", 3, "yDest"); // int
-	ADD_PARAM_NAME("SetDIBitsToDevice", 4, "w"); // DWORD
-	ADD_PARAM_NAME("SetDIBitsToDevice", 5, "h"); // DWORD
-	ADD_PARAM_NAME("SetDIBitsToDevice", 6, "xSrc"); // int
-	ADD_PARAM_NAME("SetDIBitsToDevice", 7, "ySrc"); // int
-	ADD_PARAM_NAME("SetDIBitsToDevice", 8, "StartScan"); // UINT
-	ADD_PARAM_NAME("SetDIBitsToDevice", 9, "cLines"); // UINT
-	ADD_PARAM_NAME("SetDIBitsToDevice", 10, "lpvBits"); // CONST VOID *
-	ADD_PARAM_NAME("SetDIBitsToDevice", 11, "lpbmi"); // CONST BITMAPINFO *
-	ADD_PARAM_NAME("SetDIBitsToDevice", 12, "ColorUse"); // UINT
-	ADD_PARAM_NAME("SetDebugErrorLevel", 1, "dwLevel"); // DWORD
-	ADD_PARAM_NAME("SetDefaultCommConfigA", 1, "lpszName"); // LPCSTR
-	ADD_PARAM_NAME("SetDefaultCommConfigA", 2, "lpCC"); // LPCOMMCONFIG
-	ADD_PARAM_NAME("SetDefaultCommConfigA", 3, "dwSize"); // DWORD
-	ADD_PARAM_NAME("SetDefaultCommConfigW", 1, "lpszName"); // LPCWSTR
-	ADD_PARAM_NAME("SetDefaultCommConfigW", 2, "lpCC"); // LPCOMMCONFIG
-	ADD_PARAM_NAME("SetDefaultCommConfigW", 3, "dwSize"); // DWORD
-	ADD_PARAM_NAME("SetDefaultPrinterA", 1, "pszPrinter"); // LPCSTR
-	ADD_PARAM_NAME("SetDefaultPrinterW", 1, "pszPrinter"); // LPCWSTR
-	ADD_PARAM_NAME("SetDeviceGammaRamp", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetDeviceGammaRamp", 2, "lpRamp"); // LPVOID
-	ADD_PARAM_NAME("SetDlgItemInt", 1, "hDlg"); // HWND
-	ADD_PARAM_NAME("SetDlgItemInt", 2, "nIDDlgItem"); // int
-	ADD_PARAM_NAME("SetDlgItemInt", 3, "uValue"); // UINT
-	ADD_PARAM_NAME("SetDlgItemInt", 4, "bSigned"); // WINBOOL
-	ADD_PARAM_NAME("SetDlgItemTextA", 1, "hDlg"); // HWND
-	ADD_PARAM_NAME("SetDlgItemTextA", 2, "nIDDlgItem"); // int
-	ADD_PARAM_NAME("SetDlgItemTextA", 3, "lpString"); // LPCSTR
-	ADD_PARAM_NAME("SetDlgItemTextW", 1, "hDlg"); // HWND
-	ADD_PARAM_NAME("SetDlgItemTextW", 2, "nIDDlgItem"); // int
-	ADD_PARAM_NAME("SetDlgItemTextW", 3, "lpString"); // LPCWSTR
-	ADD_PARAM_NAME("SetDllDirectoryA", 1, "lpPathName"); // LPCSTR
-	ADD_PARAM_NAME("SetDllDirectoryW", 1, "lpPathName"); // LPCWSTR
-	ADD_PARAM_NAME("SetDoubleClickTime", 1, "uInterval"); // UINT
-	ADD_PARAM_NAME("SetDynamicTimeZoneInformation", 1, "lpTimeZoneInformation"); // const DYNAMIC_TIME_ZONE_INFORMATION *
-	ADD_PARAM_NAME("SetEndOfFile", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("SetEnhMetaFileBits", 1, "nSize"); // UINT
-	ADD_PARAM_NAME("SetEnhMetaFileBits", 2, "pb"); // CONST BYTE *
-	ADD_PARAM_NAME("SetEnvironmentStringsA", 1, "NewEnvironment"); // LPCH
-	ADD_PARAM_NAME("SetEnvironmentStringsW", 1, "NewEnvironment"); // LPWCH
-	ADD_PARAM_NAME("SetEnvironmentVariableA", 1, "lpName"); // LPCSTR
-	ADD_PARAM_NAME("SetEnvironmentVariableA", 2, "lpValue"); // LPCSTR
-	ADD_PARAM_NAME("SetEnvironmentVariableW", 1, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("SetEnvironmentVariableW", 2, "lpValue"); // LPCWSTR
-	ADD_PARAM_NAME("SetErrorMode", 1, "uMode"); // UINT
-	ADD_PARAM_NAME("SetEvent", 1, "hEvent"); // HANDLE
-	ADD_PARAM_NAME("SetEventWhenCallbackReturns", 1, "pci"); // PTP_CALLBACK_INSTANCE
-	ADD_PARAM_NAME("SetEventWhenCallbackReturns", 2, "evt"); // HANDLE
-	ADD_PARAM_NAME("SetFileAttributesA", 1, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("SetFileAttributesA", 2, "dwFileAttributes"); // DWORD
-	ADD_PARAM_NAME("SetFileAttributesTransactedA", 1, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("SetFileAttributesTransactedA", 2, "dwFileAttributes"); // DWORD
-	ADD_PARAM_NAME("SetFileAttributesTransactedA", 3, "hTransaction"); // HANDLE
-	ADD_PARAM_NAME("SetFileAttributesTransactedW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("SetFileAttributesTransactedW", 2, "dwFileAttributes"); // DWORD
-	ADD_PARAM_NAME("SetFileAttributesTransactedW", 3, "hTransaction"); // HANDLE
-	ADD_PARAM_NAME("SetFileAttributesW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("SetFileAttributesW", 2, "dwFileAttributes"); // DWORD
-	ADD_PARAM_NAME("SetFileBandwidthReservation", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("SetFileBandwidthReservation", 2, "nPeriodMilliseconds"); // DWORD
-	ADD_PARAM_NAME("SetFileBandwidthReservation", 3, "nBytesPerPeriod"); // DWORD
-	ADD_PARAM_NAME("SetFileBandwidthReservation", 4, "bDiscardable"); // WINBOOL
-	ADD_PARAM_NAME("SetFileBandwidthReservation", 5, "lpTransferSize"); // LPDWORD
-	ADD_PARAM_NAME("SetFileBandwidthReservation", 6, "lpNumOutstandingRequests"); // LPDWORD
-	ADD_PARAM_NAME("SetFileCompletionNotificationModes", 1, "FileHandle"); // HANDLE
-	ADD_PARAM_NAME("SetFileCompletionNotificationModes", 2, "Flags"); // UCHAR
-	ADD_PARAM_NAME("SetFileInformationByHandle", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("SetFileInformationByHandle", 2, "FileInformationClass"); // FILE_INFO_BY_HANDLE_CLASS
-	ADD_PARAM_NAME("SetFileInformationByHandle", 3, "lpFileInformation"); // LPVOID
-	ADD_PARAM_NAME("SetFileInformationByHandle", 4, "dwBufferSize"); // DWORD
-	ADD_PARAM_NAME("SetFileIoOverlappedRange", 1, "FileHandle"); // HANDLE
-	ADD_PARAM_NAME("SetFileIoOverlappedRange", 2, "OverlappedRangeStart"); // PUCHAR
-	ADD_PARAM_NAME("SetFileIoOverlappedRange", 3, "Length"); // ULONG
-	ADD_PARAM_NAME("SetFilePointer", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("SetFilePointer", 2, "lDistanceToMove"); // LONG
-	ADD_PARAM_NAME("SetFilePointer", 3, "lpDistanceToMoveHigh"); // PLONG
-	ADD_PARAM_NAME("SetFilePointer", 4, "dwMoveMethod"); // DWORD
-	ADD_PARAM_NAME("SetFilePointerEx", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("SetFilePointerEx", 2, "liDistanceToMove"); // LARGE_INTEGER
-	ADD_PARAM_NAME("SetFilePointerEx", 3, "lpNewFilePointer"); // PLARGE_INTEGER
-	ADD_PARAM_NAME("SetFilePointerEx", 4, "dwMoveMethod"); // DWORD
-	ADD_PARAM_NAME("SetFileSecurityA", 1, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("SetFileSecurityA", 2, "SecurityInformation"); // SECURITY_INFORMATION
-	ADD_PARAM_NAME("SetFileSecurityA", 3, "pSecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("SetFileSecurityW", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("SetFileSecurityW", 2, "SecurityInformation"); // SECURITY_INFORMATION
-	ADD_PARAM_NAME("SetFileSecurityW", 3, "pSecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("SetFileShortNameA", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("SetFileShortNameA", 2, "lpShortName"); // LPCSTR
-	ADD_PARAM_NAME("SetFileShortNameW", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("SetFileShortNameW", 2, "lpShortName"); // LPCWSTR
-	ADD_PARAM_NAME("SetFileTime", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("SetFileTime", 2, "lpCreationTime"); // CONST FILETIME *
-	ADD_PARAM_NAME("SetFileTime", 3, "lpLastAccessTime"); // CONST FILETIME *
-	ADD_PARAM_NAME("SetFileTime", 4, "lpLastWriteTime"); // CONST FILETIME *
-	ADD_PARAM_NAME("SetFileValidData", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("SetFileValidData", 2, "ValidDataLength"); // LONGLONG
-	ADD_PARAM_NAME("SetFirmwareEnvironmentVariableA", 1, "lpName"); // LPCSTR
-	ADD_PARAM_NAME("SetFirmwareEnvironmentVariableA", 2, "lpGuid"); // LPCSTR
-	ADD_PARAM_NAME("SetFirmwareEnvironmentVariableA", 3, "pValue"); // PVOID
-	ADD_PARAM_NAME("SetFirmwareEnvironmentVariableA", 4, "nSize"); // DWORD
-	ADD_PARAM_NAME("SetFirmwareEnvironmentVariableW", 1, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("SetFirmwareEnvironmentVariableW", 2, "lpGuid"); // LPCWSTR
-	ADD_PARAM_NAME("SetFirmwareEnvironmentVariableW", 3, "pValue"); // PVOID
-	ADD_PARAM_NAME("SetFirmwareEnvironmentVariableW", 4, "nSize"); // DWORD
-	ADD_PARAM_NAME("SetFocus", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetForegroundWindow", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetFormA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("SetFormA", 2, "pFormName"); // LPSTR
-	ADD_PARAM_NAME("SetFormA", 3, "Level"); // DWORD
-	ADD_PARAM_NAME("SetFormA", 4, "pForm"); // LPBYTE
-	ADD_PARAM_NAME("SetFormW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("SetFormW", 2, "pFormName"); // LPWSTR
-	ADD_PARAM_NAME("SetFormW", 3, "Level"); // DWORD
-	ADD_PARAM_NAME("SetFormW", 4, "pForm"); // LPBYTE
-	ADD_PARAM_NAME("SetGestureConfig", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetGestureConfig", 2, "dwReserved"); // DWORD
-	ADD_PARAM_NAME("SetGestureConfig", 3, "cIDs"); // UINT
-	ADD_PARAM_NAME("SetGestureConfig", 4, "pGestureConfig"); // PGESTURECONFIG
-	ADD_PARAM_NAME("SetGestureConfig", 5, "cbSize"); // UINT
-	ADD_PARAM_NAME("SetGraphicsMode", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetGraphicsMode", 2, "iMode"); // int
-	ADD_PARAM_NAME("SetHandleCount", 1, "uNumber"); // UINT
-	ADD_PARAM_NAME("SetHandleInformation", 1, "hObject"); // HANDLE
-	ADD_PARAM_NAME("SetHandleInformation", 2, "dwMask"); // DWORD
-	ADD_PARAM_NAME("SetHandleInformation", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("SetICMMode", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetICMMode", 2, "mode"); // int
-	ADD_PARAM_NAME("SetICMProfileA", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetICMProfileA", 2, "lpFileName"); // LPSTR
-	ADD_PARAM_NAME("SetICMProfileW", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetICMProfileW", 2, "lpFileName"); // LPWSTR
-	ADD_PARAM_NAME("SetInformationJobObject", 1, "hJob"); // HANDLE
-	ADD_PARAM_NAME("SetInformationJobObject", 2, "JobObjectInformationClass"); // JOBOBJECTINFOCLASS
-	ADD_PARAM_NAME("SetInformationJobObject", 3, "lpJobObjectInformation"); // LPVOID
-	ADD_PARAM_NAME("SetInformationJobObject", 4, "cbJobObjectInformationLength"); // DWORD
-	ADD_PARAM_NAME("SetJobA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("SetJobA", 2, "JobId"); // DWORD
-	ADD_PARAM_NAME("SetJobA", 3, "Level"); // DWORD
-	ADD_PARAM_NAME("SetJobA", 4, "pJob"); // LPBYTE
-	ADD_PARAM_NAME("SetJobA", 5, "Command"); // DWORD
-	ADD_PARAM_NAME("SetJobW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("SetJobW", 2, "JobId"); // DWORD
-	ADD_PARAM_NAME("SetJobW", 3, "Level"); // DWORD
-	ADD_PARAM_NAME("SetJobW", 4, "pJob"); // LPBYTE
-	ADD_PARAM_NAME("SetJobW", 5, "Command"); // DWORD
-	ADD_PARAM_NAME("SetKernelObjectSecurity", 1, "Handle"); // HANDLE
-	ADD_PARAM_NAME("SetKernelObjectSecurity", 2, "SecurityInformation"); // SECURITY_INFORMATION
-	ADD_PARAM_NAME("SetKernelObjectSecurity", 3, "SecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("SetKeyboardState", 1, "lpKeyState"); // LPBYTE
-	ADD_PARAM_NAME("SetLastError", 1, "dwErrCode"); // DWORD
-	ADD_PARAM_NAME("SetLastErrorEx", 1, "dwErrCode"); // DWORD
-	ADD_PARAM_NAME("SetLastErrorEx", 2, "dwType"); // DWORD
-	ADD_PARAM_NAME("SetLayeredWindowAttributes", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetLayeredWindowAttributes", 2, "crKey"); // COLORREF
-	ADD_PARAM_NAME("SetLayeredWindowAttributes", 3, "bAlpha"); // BYTE
-	ADD_PARAM_NAME("SetLayeredWindowAttributes", 4, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("SetLayout", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetLayout", 2, "l"); // DWORD
-	ADD_PARAM_NAME("SetLocalTime", 1, "lpSystemTime"); // CONST SYSTEMTIME *
-	ADD_PARAM_NAME("SetLocaleInfoA", 1, "Locale"); // LCID
-	ADD_PARAM_NAME("SetLocaleInfoA", 2, "LCType"); // LCTYPE
-	ADD_PARAM_NAME("SetLocaleInfoA", 3, "lpLCData"); // LPCSTR
-	ADD_PARAM_NAME("SetLocaleInfoW", 1, "Locale"); // LCID
-	ADD_PARAM_NAME("SetLocaleInfoW", 2, "LCType"); // LCTYPE
-	ADD_PARAM_NAME("SetLocaleInfoW", 3, "lpLCData"); // LPCWSTR
-	ADD_PARAM_NAME("SetMailslotInfo", 1, "hMailslot"); // HANDLE
-	ADD_PARAM_NAME("SetMailslotInfo", 2, "lReadTimeout"); // DWORD
-	ADD_PARAM_NAME("SetMapMode", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetMapMode", 2, "iMode"); // int
-	ADD_PARAM_NAME("SetMapperFlags", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetMapperFlags", 2, "flags"); // DWORD
-	ADD_PARAM_NAME("SetMenu", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetMenu", 2, "hMenu"); // HMENU
-	ADD_PARAM_NAME("SetMenuContextHelpId", 1, "hmenu"); // HMENU
-	ADD_PARAM_NAME("SetMenuContextHelpId", 2, "dwContextHelpId"); // DWORD
-	ADD_PARAM_NAME("SetMenuDefaultItem", 1, "hMenu"); // HMENU
-	ADD_PARAM_NAME("SetMenuDefaultItem", 2, "uItem"); // UINT
-	ADD_PARAM_NAME("SetMenuDefaultItem", 3, "fByPos"); // UINT
-	ADD_PARAM_NAME("SetMenuInfo", 1, "hmenu"); // HMENU
-	ADD_PARAM_NAME("SetMenuInfo", 2, "lpcmi"); // LPCMENUINFO
-	ADD_PARAM_NAME("SetMenuItemBitmaps", 1, "hMenu"); // HMENU
-	ADD_PARAM_NAME("SetMenuItemBitmaps", 2, "uPosition"); // UINT
-	ADD_PARAM_NAME("SetMenuItemBitmaps", 3, "uFlags"); // UINT
-	ADD_PARAM_NAME("SetMenuItemBitmaps", 4, "hBitmapUnchecked"); // HBITMAP
-	ADD_PARAM_NAME("SetMenuItemBitmaps", 5, "hBitmapChecked"); // HBITMAP
-	ADD_PARAM_NAME("SetMenuItemInfoA", 1, "hmenu"); // HMENU
-	ADD_PARAM_NAME("SetMenuItemInfoA", 2, "item"); // UINT
-	ADD_PARAM_NAME("SetMenuItemInfoA", 3, "fByPositon"); // WINBOOL
-	ADD_PARAM_NAME("SetMenuItemInfoA", 4, "lpmii"); // LPCMENUITEMINFOA
-	ADD_PARAM_NAME("SetMenuItemInfoW", 1, "hmenu"); // HMENU
-	ADD_PARAM_NAME("SetMenuItemInfoW", 2, "item"); // UINT
-	ADD_PARAM_NAME("SetMenuItemInfoW", 3, "fByPositon"); // WINBOOL
-	ADD_PARAM_NAME("SetMenuItemInfoW", 4, "lpmii"); // LPCMENUITEMINFOW
-	ADD_PARAM_NAME("SetMessageExtraInfo", 1, "lParam"); // LPARAM
-	ADD_PARAM_NAME("SetMessageQueue", 1, "cMessagesMax"); // int
-	ADD_PARAM_NAME("SetMessageWaitingIndicator", 1, "hMsgIndicator"); // HANDLE
-	ADD_PARAM_NAME("SetMessageWaitingIndicator", 2, "ulMsgCount"); // ULONG
-	ADD_PARAM_NAME("SetMetaFileBitsEx", 1, "cbBuffer"); // UINT
-	ADD_PARAM_NAME("SetMetaFileBitsEx", 2, "lpData"); // CONST BYTE *
-	ADD_PARAM_NAME("SetMetaRgn", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetMiterLimit", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetMiterLimit", 2, "limit"); // FLOAT
-	ADD_PARAM_NAME("SetMiterLimit", 3, "old"); // PFLOAT
-	ADD_PARAM_NAME("SetNamedPipeHandleState", 1, "hNamedPipe"); // HANDLE
-	ADD_PARAM_NAME("SetNamedPipeHandleState", 2, "lpMode"); // LPDWORD
-	ADD_PARAM_NAME("SetNamedPipeHandleState", 3, "lpMaxCollectionCount"); // LPDWORD
-	ADD_PARAM_NAME("SetNamedPipeHandleState", 4, "lpCollectDataTimeout"); // LPDWORD
-	ADD_PARAM_NAME("SetPaletteEntries", 1, "hpal"); // HPALETTE
-	ADD_PARAM_NAME("SetPaletteEntries", 2, "iStart"); // UINT
-	ADD_PARAM_NAME("SetPaletteEntries", 3, "cEntries"); // UINT
-	ADD_PARAM_NAME("SetPaletteEntries", 4, "pPalEntries"); // CONST PALETTEENTRY *
-	ADD_PARAM_NAME("SetParent", 1, "hWndChild"); // HWND
-	ADD_PARAM_NAME("SetParent", 2, "hWndNewParent"); // HWND
-	ADD_PARAM_NAME("SetPixel", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetPixel", 2, "x"); // int
-	ADD_PARAM_NAME("SetPixel", 3, "y"); // int
-	ADD_PARAM_NAME("SetPixel", 4, "color"); // COLORREF
-	ADD_PARAM_NAME("SetPixelFormat", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetPixelFormat", 2, "format"); // int
-	ADD_PARAM_NAME("SetPixelFormat", 3, "ppfd"); // CONST PIXELFORMATDESCRIPTOR *
-	ADD_PARAM_NAME("SetPixelV", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetPixelV", 2, "x"); // int
-	ADD_PARAM_NAME("SetPixelV", 3, "y"); // int
-	ADD_PARAM_NAME("SetPixelV", 4, "color"); // COLORREF
-	ADD_PARAM_NAME("SetPolyFillMode", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetPolyFillMode", 2, "mode"); // int
-	ADD_PARAM_NAME("SetPortA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("SetPortA", 2, "pPortName"); // LPSTR
-	ADD_PARAM_NAME("SetPortA", 3, "dwLevel"); // DWORD
-	ADD_PARAM_NAME("SetPortA", 4, "pPortInfo"); // LPBYTE
-	ADD_PARAM_NAME("SetPortW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("SetPortW", 2, "pPortName"); // LPWSTR
-	ADD_PARAM_NAME("SetPortW", 3, "dwLevel"); // DWORD
-	ADD_PARAM_NAME("SetPortW", 4, "pPortInfo"); // LPBYTE
-	ADD_PARAM_NAME("SetPrinterA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("SetPrinterA", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("SetPrinterA", 3, "pPrinter"); // LPBYTE
-	ADD_PARAM_NAME("SetPrinterA", 4, "Command"); // DWORD
-	ADD_PARAM_NAME("SetPrinterDataA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("SetPrinterDataA", 2, "pValueName"); // LPSTR
-	ADD_PARAM_NAME("SetPrinterDataA", 3, "Type"); // DWORD
-	ADD_PARAM_NAME("SetPrinterDataA", 4, "pData"); // LPBYTE
-	ADD_PARAM_NAME("SetPrinterDataA", 5, "cbData"); // DWORD
-	ADD_PARAM_NAME("SetPrinterDataExA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("SetPrinterDataExA", 2, "pKeyName"); // LPCSTR
-	ADD_PARAM_NAME("SetPrinterDataExA", 3, "pValueName"); // LPCSTR
-	ADD_PARAM_NAME("SetPrinterDataExA", 4, "Type"); // DWORD
-	ADD_PARAM_NAME("SetPrinterDataExA", 5, "pData"); // LPBYTE
-	ADD_PARAM_NAME("SetPrinterDataExA", 6, "cbData"); // DWORD
-	ADD_PARAM_NAME("SetPrinterDataExW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("SetPrinterDataExW", 2, "pKeyName"); // LPCWSTR
-	ADD_PARAM_NAME("SetPrinterDataExW", 3, "pValueName"); // LPCWSTR
-	ADD_PARAM_NAME("SetPrinterDataExW", 4, "Type"); // DWORD
-	ADD_PARAM_NAME("SetPrinterDataExW", 5, "pData"); // LPBYTE
-	ADD_PARAM_NAME("SetPrinterDataExW", 6, "cbData"); // DWORD
-	ADD_PARAM_NAME("SetPrinterDataW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("SetPrinterDataW", 2, "pValueName"); // LPWSTR
-	ADD_PARAM_NAME("SetPrinterDataW", 3, "Type"); // DWORD
-	ADD_PARAM_NAME("SetPrinterDataW", 4, "pData"); // LPBYTE
-	ADD_PARAM_NAME("SetPrinterDataW", 5, "cbData"); // DWORD
-	ADD_PARAM_NAME("SetPrinterToken", 1, "hToken"); // HANDLE
-	ADD_PARAM_NAME("SetPrinterW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("SetPrinterW", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("SetPrinterW", 3, "pPrinter"); // LPBYTE
-	ADD_PARAM_NAME("SetPrinterW", 4, "Command"); // DWORD
-	ADD_PARAM_NAME("SetPriorityClass", 1, "hProcess"); // HANDLE
-	ADD_PARAM_NAME("SetPriorityClass", 2, "dwPriorityClass"); // DWORD
-	ADD_PARAM_NAME("SetPrivateObjectSecurity", 1, "SecurityInformation"); // SECURITY_INFORMATION
-	ADD_PARAM_NAME("SetPrivateObjectSecurity", 2, "ModificationDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("SetPrivateObjectSecurity", 3, "ObjectsSecurityDescriptor"); // PSECURITY_DESCRIPTOR *
-	ADD_PARAM_NAME("SetPrivateObjectSecurity", 4, "GenericMapping"); // PGENERIC_MAPPING
-	ADD_PARAM_NAME("SetPrivateObjectSecurity", 5, "Token"); // HANDLE
-	ADD_PARAM_NAME("SetPrivateObjectSecurityEx", 1, "SecurityInformation"); // SECURITY_INFORMATION
-	ADD_PARAM_NAME("SetPrivateObjectSecurityEx", 2, "ModificationDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("SetPrivateObjectSecurityEx", 3, "ObjectsSecurityDescriptor"); // PSECURITY_DESCRIPTOR *
-	ADD_PARAM_NAME("SetPrivateObjectSecurityEx", 4, "AutoInheritFlags"); // ULONG
-	ADD_PARAM_NAME("SetPrivateObjectSecurityEx", 5, "GenericMapping"); // PGENERIC_MAPPING
-	ADD_PARAM_NAME("SetPrivateObjectSecurityEx", 6, "Token"); // HANDLE
-	ADD_PARAM_NAME("SetProcessAffinityMask", 1, "hProcess"); // HANDLE
-	ADD_PARAM_NAME("SetProcessAffinityMask", 2, "dwProcessAffinityMask"); // DWORD_PTR
-	ADD_PARAM_NAME("SetProcessAffinityUpdateMode", 1, "ProcessHandle"); // HANDLE
-	ADD_PARAM_NAME("SetProcessAffinityUpdateMode", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("SetProcessDEPPolicy", 1, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("SetProcessDefaultLayout", 1, "dwDefaultLayout"); // DWORD
-	ADD_PARAM_NAME("SetProcessPriorityBoost", 1, "hProcess"); // HANDLE
-	ADD_PARAM_NAME("SetProcessPriorityBoost", 2, "bDisablePriorityBoost"); // WINBOOL
-	ADD_PARAM_NAME("SetProcessShutdownParameters", 1, "dwLevel"); // DWORD
-	ADD_PARAM_NAME("SetProcessShutdownParameters", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("SetProcessWindowStation", 1, "hWinSta"); // HWINSTA
-	ADD_PARAM_NAME("SetProcessWorkingSetSize", 1, "hProcess"); // HANDLE
-	ADD_PARAM_NAME("SetProcessWorkingSetSize", 2, "dwMinimumWorkingSetSize"); // SIZE_T
-	ADD_PARAM_NAME("SetProcessWorkingSetSize", 3, "dwMaximumWorkingSetSize"); // SIZE_T
-	ADD_PARAM_NAME("SetProcessWorkingSetSizeEx", 1, "hProcess"); // HANDLE
-	ADD_PARAM_NAME("SetProcessWorkingSetSizeEx", 2, "dwMinimumWorkingSetSize"); // SIZE_T
-	ADD_PARAM_NAME("SetProcessWorkingSetSizeEx", 3, "dwMaximumWorkingSetSize"); // SIZE_T
-	ADD_PARAM_NAME("SetProcessWorkingSetSizeEx", 4, "Flags"); // DWORD
-	ADD_PARAM_NAME("SetPropA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetPropA", 2, "lpString"); // LPCSTR
-	ADD_PARAM_NAME("SetPropA", 3, "hData"); // HANDLE
-	ADD_PARAM_NAME("SetPropW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetPropW", 2, "lpString"); // LPCWSTR
-	ADD_PARAM_NAME("SetPropW", 3, "hData"); // HANDLE
-	ADD_PARAM_NAME("SetROP2", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetROP2", 2, "rop2"); // int
-	ADD_PARAM_NAME("SetRect", 1, "lprc"); // LPRECT
-	ADD_PARAM_NAME("SetRect", 2, "xLeft"); // int
-	ADD_PARAM_NAME("SetRect", 3, "yTop"); // int
-	ADD_PARAM_NAME("SetRect", 4, "xRight"); // int
-	ADD_PARAM_NAME("SetRect", 5, "yBottom"); // int
-	ADD_PARAM_NAME("SetRectEmpty", 1, "lprc"); // LPRECT
-	ADD_PARAM_NAME("SetRectRgn", 1, "hrgn"); // HRGN
-	ADD_PARAM_NAME("SetRectRgn", 2, "left"); // int
-	ADD_PARAM_NAME("SetRectRgn", 3, "top"); // int
-	ADD_PARAM_NAME("SetRectRgn", 4, "right"); // int
-	ADD_PARAM_NAME("SetRectRgn", 5, "bottom"); // int
-	ADD_PARAM_NAME("SetScrollInfo", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetScrollInfo", 2, "nBar"); // int
-	ADD_PARAM_NAME("SetScrollInfo", 3, "lpsi"); // LPCSCROLLINFO
-	ADD_PARAM_NAME("SetScrollInfo", 4, "redraw"); // WINBOOL
-	ADD_PARAM_NAME("SetScrollPos", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetScrollPos", 2, "nBar"); // int
-	ADD_PARAM_NAME("SetScrollPos", 3, "nPos"); // int
-	ADD_PARAM_NAME("SetScrollPos", 4, "bRedraw"); // WINBOOL
-	ADD_PARAM_NAME("SetScrollRange", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetScrollRange", 2, "nBar"); // int
-	ADD_PARAM_NAME("SetScrollRange", 3, "nMinPos"); // int
-	ADD_PARAM_NAME("SetScrollRange", 4, "nMaxPos"); // int
-	ADD_PARAM_NAME("SetScrollRange", 5, "bRedraw"); // WINBOOL
-	ADD_PARAM_NAME("SetSecurityAccessMask", 1, "SecurityInformation"); // SECURITY_INFORMATION
-	ADD_PARAM_NAME("SetSecurityAccessMask", 2, "DesiredAccess"); // LPDWORD
-	ADD_PARAM_NAME("SetSecurityDescriptorControl", 1, "pSecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("SetSecurityDescriptorControl", 2, "ControlBitsOfInterest"); // SECURITY_DESCRIPTOR_CONTROL
-	ADD_PARAM_NAME("SetSecurityDescriptorControl", 3, "ControlBitsToSet"); // SECURITY_DESCRIPTOR_CONTROL
-	ADD_PARAM_NAME("SetSecurityDescriptorDacl", 1, "pSecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("SetSecurityDescriptorDacl", 2, "bDaclPresent"); // WINBOOL
-	ADD_PARAM_NAME("SetSecurityDescriptorDacl", 3, "pDacl"); // PACL
-	ADD_PARAM_NAME("SetSecurityDescriptorDacl", 4, "bDaclDefaulted"); // WINBOOL
-	ADD_PARAM_NAME("SetSecurityDescriptorGroup", 1, "pSecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("SetSecurityDescriptorGroup", 2, "pGroup"); // PSID
-	ADD_PARAM_NAME("SetSecurityDescriptorGroup", 3, "bGroupDefaulted"); // WINBOOL
-	ADD_PARAM_NAME("SetSecurityDescriptorOwner", 1, "pSecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("SetSecurityDescriptorOwner", 2, "pOwner"); // PSID
-	ADD_PARAM_NAME("SetSecurityDescriptorOwner", 3, "bOwnerDefaulted"); // WINBOOL
-	ADD_PARAM_NAME("SetSecurityDescriptorRMControl", 1, "SecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("SetSecurityDescriptorRMControl", 2, "RMControl"); // PUCHAR
-	ADD_PARAM_NAME("SetSecurityDescriptorSacl", 1, "pSecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("SetSecurityDescriptorSacl", 2, "bSaclPresent"); // WINBOOL
-	ADD_PARAM_NAME("SetSecurityDescriptorSacl", 3, "pSacl"); // PACL
-	ADD_PARAM_NAME("SetSecurityDescriptorSacl", 4, "bSaclDefaulted"); // WINBOOL
-	ADD_PARAM_NAME("SetServiceObjectSecurity", 1, "hService"); // SC_HANDLE
-	ADD_PARAM_NAME("SetServiceObjectSecurity", 2, "dwSecurityInformation"); // SECURITY_INFORMATION
-	ADD_PARAM_NAME("SetServiceObjectSecurity", 3, "lpSecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("SetServiceStatus", 1, "hServiceStatus"); // SERVICE_STATUS_HANDLE
-	ADD_PARAM_NAME("SetServiceStatus", 2, "lpServiceStatus"); // LPSERVICE_STATUS
-	ADD_PARAM_NAME("SetStdHandle", 1, "nStdHandle"); // DWORD
-	ADD_PARAM_NAME("SetStdHandle", 2, "hHandle"); // HANDLE
-	ADD_PARAM_NAME("SetStretchBltMode", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetStretchBltMode", 2, "mode"); // int
-	ADD_PARAM_NAME("SetSysColors", 1, "cElements"); // int
-	ADD_PARAM_NAME("SetSysColors", 2, "lpaElements"); // CONST INT *
-	ADD_PARAM_NAME("SetSysColors", 3, "lpaRgbValues"); // CONST COLORREF *
-	ADD_PARAM_NAME("SetSystemCursor", 1, "hcur"); // HCURSOR
-	ADD_PARAM_NAME("SetSystemCursor", 2, "id"); // DWORD
-	ADD_PARAM_NAME("SetSystemFileCacheSize", 1, "MinimumFileCacheSize"); // SIZE_T
-	ADD_PARAM_NAME("SetSystemFileCacheSize", 2, "MaximumFileCacheSize"); // SIZE_T
-	ADD_PARAM_NAME("SetSystemFileCacheSize", 3, "Flags"); // DWORD
-	ADD_PARAM_NAME("SetSystemPaletteUse", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetSystemPaletteUse", 2, "use"); // UINT
-	ADD_PARAM_NAME("SetSystemPowerState", 1, "fSuspend"); // WINBOOL
-	ADD_PARAM_NAME("SetSystemPowerState", 2, "fForce"); // WINBOOL
-	ADD_PARAM_NAME("SetSystemTime", 1, "lpSystemTime"); // CONST SYSTEMTIME *
-	ADD_PARAM_NAME("SetSystemTimeAdjustment", 1, "dwTimeAdjustment"); // DWORD
-	ADD_PARAM_NAME("SetSystemTimeAdjustment", 2, "bTimeAdjustmentDisabled"); // WINBOOL
-	ADD_PARAM_NAME("SetTapeParameters", 1, "hDevice"); // HANDLE
-	ADD_PARAM_NAME("SetTapeParameters", 2, "dwOperation"); // DWORD
-	ADD_PARAM_NAME("SetTapeParameters", 3, "lpTapeInformation"); // LPVOID
-	ADD_PARAM_NAME("SetTapePosition", 1, "hDevice"); // HANDLE
-	ADD_PARAM_NAME("SetTapePosition", 2, "dwPositionMethod"); // DWORD
-	ADD_PARAM_NAME("SetTapePosition", 3, "dwPartition"); // DWORD
-	ADD_PARAM_NAME("SetTapePosition", 4, "dwOffsetLow"); // DWORD
-	ADD_PARAM_NAME("SetTapePosition", 5, "dwOffsetHigh"); // DWORD
-	ADD_PARAM_NAME("SetTapePosition", 6, "bImmediate"); // WINBOOL
-	ADD_PARAM_NAME("SetTextAlign", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetTextAlign", 2, "align"); // UINT
-	ADD_PARAM_NAME("SetTextCharacterExtra", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetTextCharacterExtra", 2, "extra"); // int
-	ADD_PARAM_NAME("SetTextColor", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetTextColor", 2, "color"); // COLORREF
-	ADD_PARAM_NAME("SetTextJustification", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetTextJustification", 2, "extra"); // int
-	ADD_PARAM_NAME("SetTextJustification", 3, "count"); // int
-	ADD_PARAM_NAME("SetThreadAffinityMask", 1, "hThread"); // HANDLE
-	ADD_PARAM_NAME("SetThreadAffinityMask", 2, "dwThreadAffinityMask"); // DWORD_PTR
-	ADD_PARAM_NAME("SetThreadContext", 1, "hThread"); // HANDLE
-	ADD_PARAM_NAME("SetThreadContext", 2, "lpContext"); // CONST CONTEXT *
-	ADD_PARAM_NAME("SetThreadDesktop", 1, "hDesktop"); // HDESK
-	ADD_PARAM_NAME("SetThreadExecutionState", 1, "esFlags"); // EXECUTION_STATE
-	ADD_PARAM_NAME("SetThreadIdealProcessor", 1, "hThread"); // HANDLE
-	ADD_PARAM_NAME("SetThreadIdealProcessor", 2, "dwIdealProcessor"); // DWORD
-	ADD_PARAM_NAME("SetThreadLocale", 1, "Locale"); // LCID
-	ADD_PARAM_NAME("SetThreadPreferredUILanguages", 1, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("SetThreadPreferredUILanguages", 2, "pwszLanguagesBuffer"); // PCZZWSTR
-	ADD_PARAM_NAME("SetThreadPreferredUILanguages", 3, "pulNumLanguages"); // PULONG
-	ADD_PARAM_NAME("SetThreadPriority", 1, "hThread"); // HANDLE
-	ADD_PARAM_NAME("SetThreadPriority", 2, "nPriority"); // int
-	ADD_PARAM_NAME("SetThreadPriorityBoost", 1, "hThread"); // HANDLE
-	ADD_PARAM_NAME("SetThreadPriorityBoost", 2, "bDisablePriorityBoost"); // WINBOOL
-	ADD_PARAM_NAME("SetThreadStackGuarantee", 1, "StackSizeInBytes"); // PULONG
-	ADD_PARAM_NAME("SetThreadToken", 1, "Thread"); // PHANDLE
-	ADD_PARAM_NAME("SetThreadToken", 2, "Token"); // HANDLE
-	ADD_PARAM_NAME("SetThreadUILanguage", 1, "LangId"); // LANGID
-	ADD_PARAM_NAME("SetThreadpoolThreadMaximum", 1, "ptpp"); // PTP_POOL
-	ADD_PARAM_NAME("SetThreadpoolThreadMaximum", 2, "cthrdMost"); // DWORD
-	ADD_PARAM_NAME("SetThreadpoolThreadMinimum", 1, "ptpp"); // PTP_POOL
-	ADD_PARAM_NAME("SetThreadpoolThreadMinimum", 2, "cthrdMic"); // DWORD
-	ADD_PARAM_NAME("SetThreadpoolTimer", 1, "pti"); // PTP_TIMER
-	ADD_PARAM_NAME("SetThreadpoolTimer", 2, "pftDueTime"); // PFILETIME
-	ADD_PARAM_NAME("SetThreadpoolTimer", 3, "msPeriod"); // DWORD
-	ADD_PARAM_NAME("SetThreadpoolTimer", 4, "msWindowLength"); // DWORD
-	ADD_PARAM_NAME("SetThreadpoolWait", 1, "pwa"); // PTP_WAIT
-	ADD_PARAM_NAME("SetThreadpoolWait", 2, "h"); // HANDLE
-	ADD_PARAM_NAME("SetThreadpoolWait", 3, "pftTimeout"); // PFILETIME
-	ADD_PARAM_NAME("SetTimeZoneInformation", 1, "lpTimeZoneInformation"); // CONST TIME_ZONE_INFORMATION *
-	ADD_PARAM_NAME("SetTimer", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetTimer", 2, "nIDEvent"); // UINT_PTR
-	ADD_PARAM_NAME("SetTimer", 3, "uElapse"); // UINT
-	ADD_PARAM_NAME("SetTimer", 4, "lpTimerFunc"); // TIMERPROC
-	ADD_PARAM_NAME("SetTimerQueueTimer", 1, "TimerQueue"); // HANDLE
-	ADD_PARAM_NAME("SetTimerQueueTimer", 2, "Callback"); // WAITORTIMERCALLBACK
-	ADD_PARAM_NAME("SetTimerQueueTimer", 3, "Parameter"); // PVOID
-	ADD_PARAM_NAME("SetTimerQueueTimer", 4, "DueTime"); // DWORD
-	ADD_PARAM_NAME("SetTimerQueueTimer", 5, "Period"); // DWORD
-	ADD_PARAM_NAME("SetTimerQueueTimer", 6, "PreferIo"); // WINBOOL
-	ADD_PARAM_NAME("SetTokenInformation", 1, "TokenHandle"); // HANDLE
-	ADD_PARAM_NAME("SetTokenInformation", 2, "TokenInformationClass"); // TOKEN_INFORMATION_CLASS
-	ADD_PARAM_NAME("SetTokenInformation", 3, "TokenInformation"); // LPVOID
-	ADD_PARAM_NAME("SetTokenInformation", 4, "TokenInformationLength"); // DWORD
-	ADD_PARAM_NAME("SetUnhandledExceptionFilter", 1, "lpTopLevelExceptionFilter"); // LPTOP_LEVEL_EXCEPTION_FILTER
-	ADD_PARAM_NAME("SetUrlCacheConfigInfoA", 1, "lpCacheConfigInfo"); // LPINTERNET_CACHE_CONFIG_INFOA
-	ADD_PARAM_NAME("SetUrlCacheConfigInfoA", 2, "dwFieldControl"); // DWORD
-	ADD_PARAM_NAME("SetUrlCacheConfigInfoW", 1, "lpCacheConfigInfo"); // LPINTERNET_CACHE_CONFIG_INFOA
-	ADD_PARAM_NAME("SetUrlCacheConfigInfoW", 2, "dwFieldControl"); // DWORD
-	ADD_PARAM_NAME("SetUserFileEncryptionKey", 1, "pEncryptionCertificate"); // PENCRYPTION_CERTIFICATE
-	ADD_PARAM_NAME("SetUserGeoID", 1, "GeoId"); // GEOID
-	ADD_PARAM_NAME("SetUserObjectInformationA", 1, "hObj"); // HANDLE
-	ADD_PARAM_NAME("SetUserObjectInformationA", 2, "nIndex"); // int
-	ADD_PARAM_NAME("SetUserObjectInformationA", 3, "pvInfo"); // PVOID
-	ADD_PARAM_NAME("SetUserObjectInformationA", 4, "nLength"); // DWORD
-	ADD_PARAM_NAME("SetUserObjectInformationW", 1, "hObj"); // HANDLE
-	ADD_PARAM_NAME("SetUserObjectInformationW", 2, "nIndex"); // int
-	ADD_PARAM_NAME("SetUserObjectInformationW", 3, "pvInfo"); // PVOID
-	ADD_PARAM_NAME("SetUserObjectInformationW", 4, "nLength"); // DWORD
-	ADD_PARAM_NAME("SetUserObjectSecurity", 1, "hObj"); // HANDLE
-	ADD_PARAM_NAME("SetUserObjectSecurity", 2, "pSIRequested"); // PSECURITY_INFORMATION
-	ADD_PARAM_NAME("SetUserObjectSecurity", 3, "pSID"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("SetViewportExtEx", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetViewportExtEx", 2, "x"); // int
-	ADD_PARAM_NAME("SetViewportExtEx", 3, "y"); // int
-	ADD_PARAM_NAME("SetViewportExtEx", 4, "lpsz"); // LPSIZE
-	ADD_PARAM_NAME("SetViewportOrgEx", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetViewportOrgEx", 2, "x"); // int
-	ADD_PARAM_NAME("SetViewportOrgEx", 3, "y"); // int
-	ADD_PARAM_NAME("SetViewportOrgEx", 4, "lppt"); // LPPOINT
-	ADD_PARAM_NAME("SetVolumeLabelA", 1, "lpRootPathName"); // LPCSTR
-	ADD_PARAM_NAME("SetVolumeLabelA", 2, "lpVolumeName"); // LPCSTR
-	ADD_PARAM_NAME("SetVolumeLabelW", 1, "lpRootPathName"); // LPCWSTR
-	ADD_PARAM_NAME("SetVolumeLabelW", 2, "lpVolumeName"); // LPCWSTR
-	ADD_PARAM_NAME("SetVolumeMountPointA", 1, "lpszVolumeMountPoint"); // LPCSTR
-	ADD_PARAM_NAME("SetVolumeMountPointA", 2, "lpszVolumeName"); // LPCSTR
-	ADD_PARAM_NAME("SetVolumeMountPointW", 1, "lpszVolumeMountPoint"); // LPCWSTR
-	ADD_PARAM_NAME("SetVolumeMountPointW", 2, "lpszVolumeName"); // LPCWSTR
-	ADD_PARAM_NAME("SetWaitableTimer", 1, "hTimer"); // HANDLE
-	ADD_PARAM_NAME("SetWaitableTimer", 2, "lpDueTime"); // const LARGE_INTEGER *
-	ADD_PARAM_NAME("SetWaitableTimer", 3, "lPeriod"); // LONG
-	ADD_PARAM_NAME("SetWaitableTimer", 4, "pfnCompletionRoutine"); // PTIMERAPCROUTINE
-	ADD_PARAM_NAME("SetWaitableTimer", 5, "lpArgToCompletionRoutine"); // LPVOID
-	ADD_PARAM_NAME("SetWaitableTimer", 6, "fResume"); // WINBOOL
-	ADD_PARAM_NAME("SetWinEventHook", 1, "eventMin"); // DWORD
-	ADD_PARAM_NAME("SetWinEventHook", 2, "eventMax"); // DWORD
-	ADD_PARAM_NAME("SetWinEventHook", 3, "hmodWinEventProc"); // HMODULE
-	ADD_PARAM_NAME("SetWinEventHook", 4, "pfnWinEventProc"); // WINEVENTPROC
-	ADD_PARAM_NAME("SetWinEventHook", 5, "idProcess"); // DWORD
-	ADD_PARAM_NAME("SetWinEventHook", 6, "idThread"); // DWORD
-	ADD_PARAM_NAME("SetWinEventHook", 7, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("SetWinMetaFileBits", 1, "nSize"); // UINT
-	ADD_PARAM_NAME("SetWinMetaFileBits", 2, "lpMeta16Data"); // CONST BYTE *
-	ADD_PARAM_NAME("SetWinMetaFileBits", 3, "hdcRef"); // HDC
-	ADD_PARAM_NAME("SetWinMetaFileBits", 4, "lpMFP"); // CONST METAFILEPICT *
-	ADD_PARAM_NAME("SetWindowContextHelpId", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetWindowContextHelpId", 2, "dwContextHelpId"); // DWORD
-	ADD_PARAM_NAME("SetWindowExtEx", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetWindowExtEx", 2, "x"); // int
-	ADD_PARAM_NAME("SetWindowExtEx", 3, "y"); // int
-	ADD_PARAM_NAME("SetWindowExtEx", 4, "lpsz"); // LPSIZE
-	ADD_PARAM_NAME("SetWindowLongA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetWindowLongA", 2, "nIndex"); // int
-	ADD_PARAM_NAME("SetWindowLongA", 3, "dwNewLong"); // LONG
-	ADD_PARAM_NAME("SetWindowLongPtrA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetWindowLongPtrA", 2, "nIndex"); // int
-	ADD_PARAM_NAME("SetWindowLongPtrA", 3, "dwNewLong"); // LONG_PTR
-	ADD_PARAM_NAME("SetWindowLongPtrW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetWindowLongPtrW", 2, "nIndex"); // int
-	ADD_PARAM_NAME("SetWindowLongPtrW", 3, "dwNewLong"); // LONG_PTR
-	ADD_PARAM_NAME("SetWindowLongW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetWindowLongW", 2, "nIndex"); // int
-	ADD_PARAM_NAME("SetWindowLongW", 3, "dwNewLong"); // LONG
-	ADD_PARAM_NAME("SetWindowOrgEx", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetWindowOrgEx", 2, "x"); // int
-	ADD_PARAM_NAME("SetWindowOrgEx", 3, "y"); // int
-	ADD_PARAM_NAME("SetWindowOrgEx", 4, "lppt"); // LPPOINT
-	ADD_PARAM_NAME("SetWindowPlacement", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetWindowPlacement", 2, "lpwndpl"); // CONST WINDOWPLACEMENT *
-	ADD_PARAM_NAME("SetWindowPos", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetWindowPos", 2, "hWndInsertAfter"); // HWND
-	ADD_PARAM_NAME("SetWindowPos", 3, "X"); // int
-	ADD_PARAM_NAME("SetWindowPos", 4, "Y"); // int
-	ADD_PARAM_NAME("SetWindowPos", 5, "cx"); // int
-	ADD_PARAM_NAME("SetWindowPos", 6, "cy"); // int
-	ADD_PARAM_NAME("SetWindowPos", 7, "uFlags"); // UINT
-	ADD_PARAM_NAME("SetWindowRgn", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetWindowRgn", 2, "hRgn"); // HRGN
-	ADD_PARAM_NAME("SetWindowRgn", 3, "bRedraw"); // WINBOOL
-	ADD_PARAM_NAME("SetWindowTextA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetWindowTextA", 2, "lpString"); // LPCSTR
-	ADD_PARAM_NAME("SetWindowTextW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetWindowTextW", 2, "lpString"); // LPCWSTR
-	ADD_PARAM_NAME("SetWindowWord", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SetWindowWord", 2, "nIndex"); // int
-	ADD_PARAM_NAME("SetWindowWord", 3, "wNewWord"); // WORD
-	ADD_PARAM_NAME("SetWindowsHookA", 1, "nFilterType"); // int
-	ADD_PARAM_NAME("SetWindowsHookA", 2, "pfnFilterProc"); // HOOKPROC
-	ADD_PARAM_NAME("SetWindowsHookExA", 1, "idHook"); // int
-	ADD_PARAM_NAME("SetWindowsHookExA", 2, "lpfn"); // HOOKPROC
-	ADD_PARAM_NAME("SetWindowsHookExA", 3, "hmod"); // HINSTANCE
-	ADD_PARAM_NAME("SetWindowsHookExA", 4, "dwThreadId"); // DWORD
-	ADD_PARAM_NAME("SetWindowsHookExW", 1, "idHook"); // int
-	ADD_PARAM_NAME("SetWindowsHookExW", 2, "lpfn"); // HOOKPROC
-	ADD_PARAM_NAME("SetWindowsHookExW", 3, "hmod"); // HINSTANCE
-	ADD_PARAM_NAME("SetWindowsHookExW", 4, "dwThreadId"); // DWORD
-	ADD_PARAM_NAME("SetWindowsHookW", 1, "nFilterType"); // int
-	ADD_PARAM_NAME("SetWindowsHookW", 2, "pfnFilterProc"); // HOOKPROC
-	ADD_PARAM_NAME("SetWorldTransform", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SetWorldTransform", 2, "lpxf"); // CONST XFORM *
-	ADD_PARAM_NAME("SetupComm", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("SetupComm", 2, "dwInQueue"); // DWORD
-	ADD_PARAM_NAME("SetupComm", 3, "dwOutQueue"); // DWORD
-	ADD_PARAM_NAME("ShowCaret", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("ShowCursor", 1, "bShow"); // WINBOOL
-	ADD_PARAM_NAME("ShowOwnedPopups", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("ShowOwnedPopups", 2, "fShow"); // WINBOOL
-	ADD_PARAM_NAME("ShowScrollBar", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("ShowScrollBar", 2, "wBar"); // int
-	ADD_PARAM_NAME("ShowScrollBar", 3, "bShow"); // WINBOOL
-	ADD_PARAM_NAME("ShowWindow", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("ShowWindow", 2, "nCmdShow"); // int
-	ADD_PARAM_NAME("ShowWindowAsync", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("ShowWindowAsync", 2, "nCmdShow"); // int
-	ADD_PARAM_NAME("ShutdownBlockReasonCreate", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("ShutdownBlockReasonCreate", 2, "pwszReason"); // LPCWSTR
-	ADD_PARAM_NAME("ShutdownBlockReasonDestroy", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("ShutdownBlockReasonQuery", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("ShutdownBlockReasonQuery", 2, "pwszBuff"); // LPWSTR
-	ADD_PARAM_NAME("ShutdownBlockReasonQuery", 3, "pcchBuff"); // DWORD *
-	ADD_PARAM_NAME("SignalObjectAndWait", 1, "hObjectToSignal"); // HANDLE
-	ADD_PARAM_NAME("SignalObjectAndWait", 2, "hObjectToWaitOn"); // HANDLE
-	ADD_PARAM_NAME("SignalObjectAndWait", 3, "dwMilliseconds"); // DWORD
-	ADD_PARAM_NAME("SignalObjectAndWait", 4, "bAlertable"); // WINBOOL
-	ADD_PARAM_NAME("SizeofResource", 1, "hModule"); // HMODULE
-	ADD_PARAM_NAME("SizeofResource", 2, "hResInfo"); // HRSRC
-	ADD_PARAM_NAME("Sleep", 1, "dwMilliseconds"); // DWORD
-	ADD_PARAM_NAME("SleepConditionVariableCS", 1, "ConditionVariable"); // PCONDITION_VARIABLE
-	ADD_PARAM_NAME("SleepConditionVariableCS", 2, "CriticalSection"); // PCRITICAL_SECTION
-	ADD_PARAM_NAME("SleepConditionVariableCS", 3, "dwMilliseconds"); // DWORD
-	ADD_PARAM_NAME("SleepConditionVariableSRW", 1, "ConditionVariable"); // PCONDITION_VARIABLE
-	ADD_PARAM_NAME("SleepConditionVariableSRW", 2, "SRWLock"); // PSRWLOCK
-	ADD_PARAM_NAME("SleepConditionVariableSRW", 3, "dwMilliseconds"); // DWORD
-	ADD_PARAM_NAME("SleepConditionVariableSRW", 4, "Flags"); // ULONG
-	ADD_PARAM_NAME("SleepEx", 1, "dwMilliseconds"); // DWORD
-	ADD_PARAM_NAME("SleepEx", 2, "bAlertable"); // WINBOOL
-	ADD_PARAM_NAME("SnmpCancelMsg", 1, "session"); // HSNMP_SESSION
-	ADD_PARAM_NAME("SnmpCancelMsg", 2, "reqId"); // smiINT32
-	ADD_PARAM_NAME("SnmpClose", 1, "session"); // HSNMP_SESSION
-	ADD_PARAM_NAME("SnmpContextToStr", 1, "context"); // HSNMP_CONTEXT
-	ADD_PARAM_NAME("SnmpContextToStr", 2, "string"); // smiLPOCTETS
-	ADD_PARAM_NAME("SnmpCountVbl", 1, "vbl"); // HSNMP_VBL
-	ADD_PARAM_NAME("SnmpCreatePdu", 1, "session"); // HSNMP_SESSION
-	ADD_PARAM_NAME("SnmpCreatePdu", 2, "PDU_type"); // smiINT
-	ADD_PARAM_NAME("SnmpCreatePdu", 3, "request_id"); // smiINT32
-	ADD_PARAM_NAME("SnmpCreatePdu", 4, "error_status"); // smiINT
-	ADD_PARAM_NAME("SnmpCreatePdu", 5, "error_index"); // smiINT
-	ADD_PARAM_NAME("SnmpCreatePdu", 6, "varbindlist"); // HSNMP_VBL
-	ADD_PARAM_NAME("SnmpCreateSession", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SnmpCreateSession", 2, "wMsg"); // UINT
-	ADD_PARAM_NAME("SnmpCreateSession", 3, "fCallBack"); // SNMPAPI_CALLBACK
-	ADD_PARAM_NAME("SnmpCreateSession", 4, "lpClientData"); // LPVOID
-	ADD_PARAM_NAME("SnmpCreateVbl", 1, "session"); // HSNMP_SESSION
-	ADD_PARAM_NAME("SnmpCreateVbl", 2, "name"); // smiLPCOID
-	ADD_PARAM_NAME("SnmpCreateVbl", 3, "value"); // smiLPCVALUE
-	ADD_PARAM_NAME("SnmpDecodeMsg", 1, "session"); // HSNMP_SESSION
-	ADD_PARAM_NAME("SnmpDecodeMsg", 2, "srcEntity"); // LPHSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpDecodeMsg", 3, "dstEntity"); // LPHSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpDecodeMsg", 4, "context"); // LPHSNMP_CONTEXT
-	ADD_PARAM_NAME("SnmpDecodeMsg", 5, "pdu"); // LPHSNMP_PDU
-	ADD_PARAM_NAME("SnmpDecodeMsg", 6, "msgBufDesc"); // smiLPCOCTETS
-	ADD_PARAM_NAME("SnmpDeleteVb", 1, "vbl"); // HSNMP_VBL
-	ADD_PARAM_NAME("SnmpDeleteVb", 2, "index"); // smiUINT32
-	ADD_PARAM_NAME("SnmpDuplicatePdu", 1, "session"); // HSNMP_SESSION
-	ADD_PARAM_NAME("SnmpDuplicatePdu", 2, "PDU"); // HSNMP_PDU
-	ADD_PARAM_NAME("SnmpDuplicateVbl", 1, "session"); // HSNMP_SESSION
-	ADD_PARAM_NAME("SnmpDuplicateVbl", 2, "vbl"); // HSNMP_VBL
-	ADD_PARAM_NAME("SnmpEncodeMsg", 1, "session"); // HSNMP_SESSION
-	ADD_PARAM_NAME("SnmpEncodeMsg", 2, "srcEntity"); // HSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpEncodeMsg", 3, "dstEntity"); // HSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpEncodeMsg", 4, "context"); // HSNMP_CONTEXT
-	ADD_PARAM_NAME("SnmpEncodeMsg", 5, "pdu"); // HSNMP_PDU
-	ADD_PARAM_NAME("SnmpEncodeMsg", 6, "msgBufDesc"); // smiLPOCTETS
-	ADD_PARAM_NAME("SnmpEntityToStr", 1, "entity"); // HSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpEntityToStr", 2, "size"); // smiUINT32
-	ADD_PARAM_NAME("SnmpEntityToStr", 3, "string"); // LPSTR
-	ADD_PARAM_NAME("SnmpFreeContext", 1, "context"); // HSNMP_CONTEXT
-	ADD_PARAM_NAME("SnmpFreeDescriptor", 1, "syntax"); // smiUINT32
-	ADD_PARAM_NAME("SnmpFreeDescriptor", 2, "descriptor"); // smiLPOPAQUE
-	ADD_PARAM_NAME("SnmpFreeEntity", 1, "entity"); // HSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpFreePdu", 1, "PDU"); // HSNMP_PDU
-	ADD_PARAM_NAME("SnmpFreeVbl", 1, "vbl"); // HSNMP_VBL
-	ADD_PARAM_NAME("SnmpGetLastError", 1, "session"); // HSNMP_SESSION
-	ADD_PARAM_NAME("SnmpGetPduData", 1, "PDU"); // HSNMP_PDU
-	ADD_PARAM_NAME("SnmpGetPduData", 2, "PDU_type"); // smiLPINT
-	ADD_PARAM_NAME("SnmpGetPduData", 3, "request_id"); // smiLPINT32
-	ADD_PARAM_NAME("SnmpGetPduData", 4, "error_status"); // smiLPINT
-	ADD_PARAM_NAME("SnmpGetPduData", 5, "error_index"); // smiLPINT
-	ADD_PARAM_NAME("SnmpGetPduData", 6, "varbindlist"); // LPHSNMP_VBL
-	ADD_PARAM_NAME("SnmpGetRetransmitMode", 1, "nRetransmitMode"); // smiLPUINT32
-	ADD_PARAM_NAME("SnmpGetRetry", 1, "hEntity"); // HSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpGetRetry", 2, "nPolicyRetry"); // smiLPUINT32
-	ADD_PARAM_NAME("SnmpGetRetry", 3, "nActualRetry"); // smiLPUINT32
-	ADD_PARAM_NAME("SnmpGetTimeout", 1, "hEntity"); // HSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpGetTimeout", 2, "nPolicyTimeout"); // smiLPTIMETICKS
-	ADD_PARAM_NAME("SnmpGetTimeout", 3, "nActualTimeout"); // smiLPTIMETICKS
-	ADD_PARAM_NAME("SnmpGetTranslateMode", 1, "nTranslateMode"); // smiLPUINT32
-	ADD_PARAM_NAME("SnmpGetVb", 1, "vbl"); // HSNMP_VBL
-	ADD_PARAM_NAME("SnmpGetVb", 2, "index"); // smiUINT32
-	ADD_PARAM_NAME("SnmpGetVb", 3, "name"); // smiLPOID
-	ADD_PARAM_NAME("SnmpGetVb", 4, "value"); // smiLPVALUE
-	ADD_PARAM_NAME("SnmpGetVendorInfo", 1, "vendorInfo"); // smiLPVENDORINFO
-	ADD_PARAM_NAME("SnmpListen", 1, "hEntity"); // HSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpListen", 2, "lStatus"); // SNMPAPI_STATUS
-	ADD_PARAM_NAME("SnmpOidCompare", 1, "xOID"); // smiLPCOID
-	ADD_PARAM_NAME("SnmpOidCompare", 2, "yOID"); // smiLPCOID
-	ADD_PARAM_NAME("SnmpOidCompare", 3, "maxlen"); // smiUINT32
-	ADD_PARAM_NAME("SnmpOidCompare", 4, "result"); // smiLPINT
-	ADD_PARAM_NAME("SnmpOidCopy", 1, "srcOID"); // smiLPCOID
-	ADD_PARAM_NAME("SnmpOidCopy", 2, "dstOID"); // smiLPOID
-	ADD_PARAM_NAME("SnmpOidToStr", 1, "srcOID"); // smiLPCOID
-	ADD_PARAM_NAME("SnmpOidToStr", 2, "size"); // smiUINT32
-	ADD_PARAM_NAME("SnmpOidToStr", 3, "string"); // LPSTR
-	ADD_PARAM_NAME("SnmpOpen", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SnmpOpen", 2, "wMsg"); // UINT
-	ADD_PARAM_NAME("SnmpRecvMsg", 1, "session"); // HSNMP_SESSION
-	ADD_PARAM_NAME("SnmpRecvMsg", 2, "srcEntity"); // LPHSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpRecvMsg", 3, "dstEntity"); // LPHSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpRecvMsg", 4, "context"); // LPHSNMP_CONTEXT
-	ADD_PARAM_NAME("SnmpRecvMsg", 5, "PDU"); // LPHSNMP_PDU
-	ADD_PARAM_NAME("SnmpRegister", 1, "session"); // HSNMP_SESSION
-	ADD_PARAM_NAME("SnmpRegister", 2, "srcEntity"); // HSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpRegister", 3, "dstEntity"); // HSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpRegister", 4, "context"); // HSNMP_CONTEXT
-	ADD_PARAM_NAME("SnmpRegister", 5, "notification"); // smiLPCOID
-	ADD_PARAM_NAME("SnmpRegister", 6, "state"); // smiUINT32
-	ADD_PARAM_NAME("SnmpSendMsg", 1, "session"); // HSNMP_SESSION
-	ADD_PARAM_NAME("SnmpSendMsg", 2, "srcEntity"); // HSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpSendMsg", 3, "dstEntity"); // HSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpSendMsg", 4, "context"); // HSNMP_CONTEXT
-	ADD_PARAM_NAME("SnmpSendMsg", 5, "PDU"); // HSNMP_PDU
-	ADD_PARAM_NAME("SnmpSetPduData", 1, "PDU"); // HSNMP_PDU
-	ADD_PARAM_NAME("SnmpSetPduData", 2, "PDU_type"); // const smiINT *
-	ADD_PARAM_NAME("SnmpSetPduData", 3, "request_id"); // const smiINT32 *
-	ADD_PARAM_NAME("SnmpSetPduData", 4, "non_repeaters"); // const smiINT *
-	ADD_PARAM_NAME("SnmpSetPduData", 5, "max_repetitions"); // const smiINT *
-	ADD_PARAM_NAME("SnmpSetPduData", 6, "varbindlist"); // const HSNMP_VBL *
-	ADD_PARAM_NAME("SnmpSetPort", 1, "hEntity"); // HSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpSetPort", 2, "nPort"); // UINT
-	ADD_PARAM_NAME("SnmpSetRetransmitMode", 1, "nRetransmitMode"); // smiUINT32
-	ADD_PARAM_NAME("SnmpSetRetry", 1, "hEntity"); // HSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpSetRetry", 2, "nPolicyRetry"); // smiUINT32
-	ADD_PARAM_NAME("SnmpSetTimeout", 1, "hEntity"); // HSNMP_ENTITY
-	ADD_PARAM_NAME("SnmpSetTimeout", 2, "nPolicyTimeout"); // smiTIMETICKS
-	ADD_PARAM_NAME("SnmpSetTranslateMode", 1, "nTranslateMode"); // smiUINT32
-	ADD_PARAM_NAME("SnmpSetVb", 1, "vbl"); // HSNMP_VBL
-	ADD_PARAM_NAME("SnmpSetVb", 2, "index"); // smiUINT32
-	ADD_PARAM_NAME("SnmpSetVb", 3, "name"); // smiLPCOID
-	ADD_PARAM_NAME("SnmpSetVb", 4, "value"); // smiLPCVALUE
-	ADD_PARAM_NAME("SnmpStartup", 1, "nMajorVersion"); // smiLPUINT32
-	ADD_PARAM_NAME("SnmpStartup", 2, "nMinorVersion"); // smiLPUINT32
-	ADD_PARAM_NAME("SnmpStartup", 3, "nLevel"); // smiLPUINT32
-	ADD_PARAM_NAME("SnmpStartup", 4, "nTranslateMode"); // smiLPUINT32
-	ADD_PARAM_NAME("SnmpStartup", 5, "nRetransmitMode"); // smiLPUINT32
-	ADD_PARAM_NAME("SnmpStartupEx", 1, "nMajorVersion"); // smiLPUINT32
-	ADD_PARAM_NAME("SnmpStartupEx", 2, "nMinorVersion"); // smiLPUINT32
-	ADD_PARAM_NAME("SnmpStartupEx", 3, "nLevel"); // smiLPUINT32
-	ADD_PARAM_NAME("SnmpStartupEx", 4, "nTranslateMode"); // smiLPUINT32
-	ADD_PARAM_NAME("SnmpStartupEx", 5, "nRetransmitMode"); // smiLPUINT32
-	ADD_PARAM_NAME("SnmpStrToContext", 1, "session"); // HSNMP_SESSION
-	ADD_PARAM_NAME("SnmpStrToContext", 2, "string"); // smiLPCOCTETS
-	ADD_PARAM_NAME("SnmpStrToEntity", 1, "session"); // HSNMP_SESSION
-	ADD_PARAM_NAME("SnmpStrToEntity", 2, "string"); // LPCSTR
-	ADD_PARAM_NAME("SnmpStrToOid", 1, "string"); // LPCSTR
-	ADD_PARAM_NAME("SnmpStrToOid", 2, "dstOID"); // smiLPOID
-	ADD_PARAM_NAME("SpoolerFindClosePrinterChangeNotification", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("SpoolerFindFirstPrinterChangeNotification", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("SpoolerFindFirstPrinterChangeNotification", 2, "fdwFlags"); // DWORD
-	ADD_PARAM_NAME("SpoolerFindFirstPrinterChangeNotification", 3, "fdwOptions"); // DWORD
-	ADD_PARAM_NAME("SpoolerFindFirstPrinterChangeNotification", 4, "phEvent"); // PHANDLE
-	ADD_PARAM_NAME("SpoolerFindFirstPrinterChangeNotification", 5, "pPrinterNotifyOptions"); // PVOID
-	ADD_PARAM_NAME("SpoolerFindFirstPrinterChangeNotification", 6, "pvReserved"); // PVOID
-	ADD_PARAM_NAME("SpoolerFindNextPrinterChangeNotification", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("SpoolerFindNextPrinterChangeNotification", 2, "pfdwChange"); // LPDWORD
-	ADD_PARAM_NAME("SpoolerFindNextPrinterChangeNotification", 3, "pvReserved0"); // PVOID
-	ADD_PARAM_NAME("SpoolerFindNextPrinterChangeNotification", 4, "ppPrinterNotifyInfo"); // PVOID
-	ADD_PARAM_NAME("SpoolerFreePrinterNotifyInfo", 1, "pInfo"); // PPRINTER_NOTIFY_INFO
-	ADD_PARAM_NAME("SpoolerRefreshPrinterChangeNotification", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("SpoolerRefreshPrinterChangeNotification", 2, "dwColor"); // DWORD
-	ADD_PARAM_NAME("SpoolerRefreshPrinterChangeNotification", 3, "pOptions"); // PPRINTER_NOTIFY_OPTIONS
-	ADD_PARAM_NAME("SpoolerRefreshPrinterChangeNotification", 4, "ppInfo"); // PPRINTER_NOTIFY_INFO *
-	ADD_PARAM_NAME("StartDocA", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("StartDocA", 2, "lpdi"); // CONST DOCINFOA *
-	ADD_PARAM_NAME("StartDocPrinterA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("StartDocPrinterA", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("StartDocPrinterA", 3, "pDocInfo"); // LPBYTE
-	ADD_PARAM_NAME("StartDocPrinterW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("StartDocPrinterW", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("StartDocPrinterW", 3, "pDocInfo"); // LPBYTE
-	ADD_PARAM_NAME("StartDocW", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("StartDocW", 2, "lpdi"); // CONST DOCINFOW *
-	ADD_PARAM_NAME("StartPage", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("StartPagePrinter", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("StartServiceA", 1, "hService"); // SC_HANDLE
-	ADD_PARAM_NAME("StartServiceA", 2, "dwNumServiceArgs"); // DWORD
-	ADD_PARAM_NAME("StartServiceA", 3, "lpServiceArgVectors"); // LPCSTR *
-	ADD_PARAM_NAME("StartServiceCtrlDispatcherA", 1, "lpServiceStartTable"); // CONST SERVICE_TABLE_ENTRYA *
-	ADD_PARAM_NAME("StartServiceCtrlDispatcherW", 1, "lpServiceStartTable"); // CONST SERVICE_TABLE_ENTRYW *
-	ADD_PARAM_NAME("StartServiceW", 1, "hService"); // SC_HANDLE
-	ADD_PARAM_NAME("StartServiceW", 2, "dwNumServiceArgs"); // DWORD
-	ADD_PARAM_NAME("StartServiceW", 3, "lpServiceArgVectors"); // LPCWSTR *
-	ADD_PARAM_NAME("StartThreadpoolIo", 1, "pio"); // PTP_IO
-	ADD_PARAM_NAME("StretchBlt", 1, "hdcDest"); // HDC
-	ADD_PARAM_NAME("StretchBlt", 2, "xDest"); // int
-	ADD_PARAM_NAME("StretchBlt", 3, "yDest"); // int
-	ADD_PARAM_NAME("StretchBlt", 4, "wDest"); // int
-	ADD_PARAM_NAME("StretchBlt", 5, "hDest"); // int
-	ADD_PARAM_NAME("StretchBlt", 6, "hdcSrc"); // HDC
-	ADD_PARAM_NAME("StretchBlt", 7, "xSrc"); // int
-	ADD_PARAM_NAME("StretchBlt", 8, "ySrc"); // int
-	ADD_PARAM_NAME("StretchBlt", 9, "wSrc"); // int
-	ADD_PARAM_NAME("StretchBlt", 10, "hSrc"); // int
-	ADD_PARAM_NAME("StretchBlt", 11, "rop"); // DWORD
-	ADD_PARAM_NAME("StretchDIBits", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("StretchDIBits", 2, "xDest"); // int
-	ADD_PARAM_NAME("StretchDIBits", 3, "yDest"); // int
-	ADD_PARAM_NAME("StretchDIBits", 4, "DestWidth"); // int
-	ADD_PARAM_NAME("StretchDIBits", 5, "DestHeight"); // int
-	ADD_PARAM_NAME("StretchDIBits", 6, "xSrc"); // int
-	ADD_PARAM_NAME("StretchDIBits", 7, "ySrc"); // int
-	ADD_PARAM_NAME("StretchDIBits", 8, "SrcWidth"); // int
-	ADD_PARAM_NAME("StretchDIBits", 9, "SrcHeight"); // int
-	ADD_PARAM_NAME("StretchDIBits", 10, "lpBits"); // CONST VOID *
-	ADD_PARAM_NAME("StretchDIBits", 11, "lpbmi"); // CONST BITMAPINFO *
-	ADD_PARAM_NAME("StretchDIBits", 12, "iUsage"); // UINT
-	ADD_PARAM_NAME("StretchDIBits", 13, "rop"); // DWORD
-	ADD_PARAM_NAME("StrokeAndFillPath", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("StrokePath", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SubmitThreadpoolWork", 1, "pwk"); // PTP_WORK
-	ADD_PARAM_NAME("SubtractRect", 1, "lprcDst"); // LPRECT
-	ADD_PARAM_NAME("SubtractRect", 2, "lprcSrc1"); // CONST RECT *
-	ADD_PARAM_NAME("SubtractRect", 3, "lprcSrc2"); // CONST RECT *
-	ADD_PARAM_NAME("SuspendThread", 1, "hThread"); // HANDLE
-	ADD_PARAM_NAME("SwapBuffers", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("SwapMouseButton", 1, "fSwap"); // WINBOOL
-	ADD_PARAM_NAME("SwitchDesktop", 1, "hDesktop"); // HDESK
-	ADD_PARAM_NAME("SwitchToFiber", 1, "lpFiber"); // LPVOID
-	ADD_PARAM_NAME("SwitchToThisWindow", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("SwitchToThisWindow", 2, "fUnknown"); // WINBOOL
-	ADD_PARAM_NAME("SystemParametersInfoA", 1, "uiAction"); // UINT
-	ADD_PARAM_NAME("SystemParametersInfoA", 2, "uiParam"); // UINT
-	ADD_PARAM_NAME("SystemParametersInfoA", 3, "pvParam"); // PVOID
-	ADD_PARAM_NAME("SystemParametersInfoA", 4, "fWinIni"); // UINT
-	ADD_PARAM_NAME("SystemParametersInfoW", 1, "uiAction"); // UINT
-	ADD_PARAM_NAME("SystemParametersInfoW", 2, "uiParam"); // UINT
-	ADD_PARAM_NAME("SystemParametersInfoW", 3, "pvParam"); // PVOID
-	ADD_PARAM_NAME("SystemParametersInfoW", 4, "fWinIni"); // UINT
-	ADD_PARAM_NAME("SystemTimeToFileTime", 1, "lpSystemTime"); // CONST SYSTEMTIME *
-	ADD_PARAM_NAME("SystemTimeToFileTime", 2, "lpFileTime"); // LPFILETIME
-	ADD_PARAM_NAME("SystemTimeToTzSpecificLocalTime", 1, "lpTimeZoneInformation"); // LPTIME_ZONE_INFORMATION
-	ADD_PARAM_NAME("SystemTimeToTzSpecificLocalTime", 2, "lpUniversalTime"); // LPSYSTEMTIME
-	ADD_PARAM_NAME("SystemTimeToTzSpecificLocalTime", 3, "lpLocalTime"); // LPSYSTEMTIME
+FuncParamNamesTable getFuncParamNamesTable_S() {
+	return makeFuncParamNamesTable(FUNC_PARAM_NAMES_TABLE);
 }
 
 } // namespace win_api
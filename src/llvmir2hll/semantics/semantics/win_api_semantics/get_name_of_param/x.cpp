@@ -1,6 +1,6 @@
 /**
 * @file src/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/x.cpp
-* @brief Implementation of the initialization of WinAPI functions.
+* @brief Names of parameters of WinAPI functions.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -11,21 +11,27 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
+/// Names of parameters of functions from windows.h.
+constexpr FuncParamName FUNC_PARAM_NAMES_TABLE[] = {
+	{"XcvDataW", 1, "hXcv"}, // HANDLE
+	{"XcvDataW", 2, "pszDataName"}, // PCWSTR
+	{"XcvDataW", 3, "pInputData"}, // PBYTE
+	{"XcvDataW", 4, "cbInputData"}, // DWORD
+	{"XcvDataW", 5, "pOutputData"}, // PBYTE
+	{"XcvDataW", 6, "cbOutputData"}, // DWORD
+	{"XcvDataW", 7, "pcbOutputNeeded"}, // PDWORD
+	{"XcvDataW", 8, "pdwStatus"}, // PDWORD
+};
+
+} // anonymous namespace
+
 /**
-* @brief Initializes the given map with info about functions starting with X.
+* @brief Returns a table with info about functions starting with X.
 */
-void initFuncParamNamesMap_X(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
-	ADD_PARAM_NAME("XcvDataW", 1, "hXcv"); // HANDLE
-	ADD_PARAM_NAME("XcvDataW", 2, "pszDataName"); // PCWSTR
-	ADD_PARAM_NAME("XcvDataW", 3, "pInputData"); // PBYTE
-	ADD_PARAM_NAME("XcvDataW", 4, "cbInputData"); // DWORD
-	ADD_PARAM_NAME("XcvDataW", 5, "pOutputData"); // PBYTE
-	ADD_PARAM_NAME("XcvDataW", 6, "cbOutputData"); // DWORD
-	ADD_PARAM_NAME("XcvDataW", 7, "pcbOutputNeeded"); // PDWORD
-	ADD_PARAM_NAME("XcvDataW", 8, "pdwStatus"); // PDWORD
+FuncParamNamesTable getFuncParamNamesTable_X() {
+	return makeFuncParamNamesTable(FUNC_PARAM_NAMES_TABLE);
 }
 
 } // namespace win_api
@@ -1,6 +1,6 @@
 /**
 * @file src/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/y.cpp
-* @brief Implementation of the initialization of WinAPI functions.
+* @brief Names of parameters of WinAPI functions.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -12,12 +12,11 @@ namespace semantics {
 namespace win_api {
 
 /**
-* @brief Initializes the given map with info about functions starting with Y.
+* @brief Returns a table with info about functions starting with Y.
 */
-void initFuncParamNamesMap_Y(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
+FuncParamNamesTable getFuncParamNamesTable_Y() {
+	// There are no such functions in windows.h.
+	return FuncParamNamesTable{nullptr, nullptr};
 }
 
 } // namespace win_api
@@ -1,6 +1,6 @@
 /**
 * @file src/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/z.cpp
-* @brief Implementation of the initialization of WinAPI functions.
+* @brief Names of parameters of WinAPI functions.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -11,14 +11,20 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
+/// Names of parameters of functions from windows.h.
+constexpr FuncParamName FUNC_PARAM_NAMES_TABLE[] = {
+	{"ZombifyActCtx", 1, "hActCtx"}, // HANDLE
+};
+
+} // anonymous namespace
+
 /**
-* @brief Initializes the given map with info about functions starting with Z.
+* @brief Returns a table with info about functions starting with Z.
 */
-void initFuncParamNamesMap_Z(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
-	ADD_PARAM_NAME("ZombifyActCtx", 1, "hActCtx"); // HANDLE
+FuncParamNamesTable getFuncParamNamesTable_Z() {
+	return makeFuncParamNamesTable(FUNC_PARAM_NAMES_TABLE);
 }
 
 } // namespace win_api
@@ -146,7 +146,7 @@ bool FuncsWithPrefixRemover::shouldBeRemoved(ShPtr<Function> func) const {
 	return false;
 }
 
-void FuncsWithPrefixRemover::visit(ShPtr<CallStmt> stmt) {
+void FuncsWithPrefixRemover::visit(const ShPtr<CallStmt> &stmt) {
 	// We have to backup the statement's successor because
 	// removeStatementButKeepDebugComment() resets the successor.
 	ShPtr<Statement> stmtSucc(stmt->getSuccessor());
@@ -161,7 +161,7 @@ void FuncsWithPrefixRemover::visit(ShPtr<CallStmt> stmt) {
 	}
 }
 
-void FuncsWithPrefixRemover::visit(ShPtr<AssignStmt> stmt) {
+void FuncsWithPrefixRemover::visit(const ShPtr<AssignStmt> &stmt) {
 	// We have to backup the statement's successor because
 	// removeStatementButKeepDebugComment() resets the successor.
 	ShPtr<Statement> stmtSucc(stmt->getSuccessor());
@@ -176,7 +176,7 @@ void FuncsWithPrefixRemover::visit(ShPtr<AssignStmt> stmt) {
 	}
 }
 
-void FuncsWithPrefixRemover::visit(ShPtr<VarDefStmt> stmt) {
+void FuncsWithPrefixRemover::visit(const ShPtr<VarDefStmt> &stmt) {
 	if (isCallOfFuncToBeRemoved(stmt->getInitializer())) {
 		stmt->removeInitializer();
 	}
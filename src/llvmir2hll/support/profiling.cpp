@@ -0,0 +1,48 @@
+/**
+* @file src/llvmir2hll/support/profiling.cpp
+* @brief Implementation of the support for profiling of the decompilation
+*        phases.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <iterator>
+
+#include "retdec/llvmir2hll/ir/function.h"
+#include "retdec/llvmir2hll/ir/module.h"
+#include "retdec/llvmir2hll/support/profiling.h"
+#include "retdec/llvmir2hll/support/statements_counter.h"
+
+namespace retdec {
+namespace llvmir2hll {
+
+/**
+* @brief Returns sizes of @a module to be recorded by a profiler.
+*
+* The sizes are the number of function definitions, the number of statements
+* in their bodies, and the number of global variables. If @a module is the
+* null pointer (e.g. before the conversion of LLVM IR into BIR), no sizes are
+* returned.
+*/
+retdec::utils::Profiler::Sizes getModuleSize(ShPtr<Module> module) {
+	if (!module) {
+		return {};
+	}
+
+	std::size_t funcs = 0;
+	std::size_t stmts = 0;
+	for (auto i = module->func_definition_begin(),
+			e = module->func_definition_end(); i != e; ++i) {
+		++funcs;
+		stmts += StatementsCounter::count((*i)->getBody());
+	}
+
+	return {
+		{"functions", funcs},
+		{"statements", stmts},
+		{"global_vars", static_cast<std::size_t>(std::distance(
+			module->global_var_begin(), module->global_var_end()))}
+	};
+}
+
+} // namespace llvmir2hll
+} // namespace retdec
@@ -38,7 +38,7 @@ std::string NoGlobalVarDefValidator::getId() const {
 	return NO_GLOBAL_VAR_DEF_VALIDATOR_ID;
 }
 
-void NoGlobalVarDefValidator::visit(ShPtr<VarDefStmt> stmt) {
+void NoGlobalVarDefValidator::visit(const ShPtr<VarDefStmt> &stmt) {
 	// The left-hand side of a VarDefStmt cannot be a global variable.
 	if (module->isGlobalVar(stmt->getVar())) {
 		validationError("In ", func->getName(), "(), found a VarDefStmt `",
@@ -18,7 +18,7 @@ namespace retdec {
 namespace loader {
 
 Image::Image(const std::shared_ptr<retdec::fileformat::FileFormat>& fileFormat) : _fileFormat(fileFormat), _segments(),
-	_baseAddress(0), _namelessSegNameGen("seg", '0', 4), _statusMessage()
+	_baseAddress(0), _namelessSegNameGen("seg", '0', 4), _statusMessage(), _segmentIndex(), _segmentIndexValid(false)
 {
 }
 
@@ -322,6 +322,25 @@ std::pair<const std::uint8_t*, std::uint64_t> Image::getRawSegmentData(std::uint
 	return { rawData.first + offset, rawData.second - offset };
 }
 
+/**
+ * Returns view of bytes on the given address without copying them. The view is valid
+ * for the lifetime of the image.
+ *
+ * @param address Address of the first byte.
+ * @param size Number of bytes to view.
+ *
+ * @return View of at most @a size bytes. It is shorter if physical data of the segment
+ *         end earlier and empty if there is no segment or no physical data on @a address.
+ */
+llvm::ArrayRef<std::uint8_t> Image::getBytesView(std::uint64_t address, std::uint64_t size) const
+{
+	auto segment = getSegmentFromAddress(address);
+	if (!segment)
+		return {};
+
+	return segment->getBytesView(address - segment->getAddress(), size);
+}
+
 /**
  * Get integer (@a x bytes) located at provided address using the specified endian or default file endian
  *
@@ -340,6 +359,13 @@ bool Image::getXByte(std::uint64_t address, std::uint64_t x, std::uint64_t& res,
 		return false;
 	}
 
+	// Common case -- all bytes are physically present, read them in place
+	const auto view = seg->getBytesView(address - seg->getAddress(), x);
+	if (view.size() == x)
+	{
+		return createValueFromBytes(view.data(), view.size(), res, e);
+	}
+
 	std::vector<std::uint8_t> data;
 	if (!seg->getBytes(data, address - seg->getAddress(), x) || data.size() != x)
 	{
@@ -366,6 +392,13 @@ bool Image::getXBytes(std::uint64_t address, std::uint64_t x, std::vector<std::u
 		return false;
 	}
 
+	const auto view = seg->getBytesView(address - seg->getAddress(), x);
+	if (view.size() == x)
+	{
+		res.assign(view.begin(), view.end());
+		return true;
+	}
+
 	res.clear();
 	if (!seg->getBytes(res, address - seg->getAddress(), x) || res.size() != x)
 	{
@@ -447,6 +480,7 @@ Segment* Image::insertSegment(std::unique_ptr<Segment> segment)
 	// Now give segment name
 	Segment* retSegment = _segments.back().get();
 	nameSegment(retSegment);
+	invalidateSegmentIndex();
 	return retSegment;
 }
 
@@ -457,6 +491,7 @@ void Image::removeSegment(Segment* segment)
 		if (itr->get() == segment)
 		{
 			_segments.erase(itr);
+			invalidateSegmentIndex();
 			return;
 		}
 	}
@@ -476,6 +511,17 @@ void Image::sortSegments()
 			{
 				return seg1->getAddress() < seg2->getAddress();
 			});
+	invalidateSegmentIndex();
+}
+
+/**
+ * Marks the address lookup index as outdated. Needs to be called whenever
+ * segments are added, removed, reordered or their address ranges change.
+ * The index is rebuilt lazily by the next lookup.
+ */
+void Image::invalidateSegmentIndex()
+{
+	_segmentIndexValid = false;
 }
 
 const Segment* Image::_getSegment(std::size_t index) const
@@ -510,13 +556,33 @@ const Segment* Image::_getSegmentWithIndex(std::size_t index) const
 
 const Segment* Image::_getSegmentFromAddress(std::uint64_t address) const
 {
-	for (const auto& segment : getSegments())
+	if (!_segmentIndexValid.load(std::memory_order_acquire))
+		_buildSegmentIndex();
+
+	return _segmentIndex.find(address);
+}
+
+/**
+ * Builds index of address ranges of segments. If segments overlap, the one
+ * which comes first in the list of segments is found on the shared addresses.
+ */
+void Image::_buildSegmentIndex() const
+{
+	std::lock_guard<std::mutex> lock(_segmentIndexMutex);
+	if (_segmentIndexValid.load(std::memory_order_relaxed))
+		return;
+
+	std::vector<IntervalIndex<const Segment*>::Interval> intervals;
+	intervals.reserve(_segments.size());
+	for (const auto& segment : _segments)
 	{
-		if (segment->containsAddress(address))
-			return segment.get();
+		// Segments whose end address overflows contain no address at all
+		if (segment->getEndAddress() > segment->getAddress())
+			intervals.push_back({segment->getAddress(), segment->getEndAddress() - 1, segment.get()});
 	}
 
-	return nullptr;
+	_segmentIndex.build(intervals, [](const auto&, const auto&) { return false; });
+	_segmentIndexValid.store(true, std::memory_order_release);
 }
 
 } // namespace loader
@@ -211,6 +211,23 @@ bool Segment::getBytes(std::vector<unsigned char>& result, std::uint64_t address
 	return true;
 }
 
+/**
+ * Get view of physical content of segment without copying it.
+ *
+ * @param addressOffset First byte of the segment to be viewed (0 means first byte of segment).
+ * @param size Number of bytes to view.
+ *
+ * @return View valid as long as the input file is loaded. View is shorter than @a size
+ *         if physical data of segment end earlier and empty if there are no such data.
+ */
+llvm::ArrayRef<std::uint8_t> Segment::getBytesView(std::uint64_t addressOffset, std::uint64_t size) const
+{
+	if (addressOffset >= getSize() || !_dataSource)
+		return {};
+
+	return _dataSource->getDataView(addressOffset, std::min(size, getSize() - addressOffset));
+}
+
 /**
  * Get content of segment as bits in string representation.
  *
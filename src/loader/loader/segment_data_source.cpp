@@ -45,6 +45,24 @@ std::uint64_t SegmentDataSource::getDataSize() const
 	return _data.size();
 }
 
+/**
+ * Returns view of the data without copying them. View is valid as long as
+ * the underlying file is loaded and is clipped at the end of the data.
+ *
+ * @param viewOffset Offset of the first byte of the view.
+ * @param viewSize Requested number of bytes.
+ *
+ * @return View of the data, empty if offset is out of the data.
+ */
+llvm::ArrayRef<std::uint8_t> SegmentDataSource::getDataView(std::uint64_t viewOffset, std::uint64_t viewSize) const
+{
+	if (!isDataSet() || viewOffset >= getDataSize())
+		return {};
+
+	viewSize = std::min(viewSize, getDataSize() - viewOffset);
+	return llvm::ArrayRef<std::uint8_t>(getData() + viewOffset, viewSize);
+}
+
 void SegmentDataSource::resize(std::uint64_t newSize)
 {
 	_data = llvm::StringRef(_data.data(), std::min(getDataSize(), newSize));
@@ -73,17 +91,9 @@ bool SegmentDataSource::shrink(std::uint64_t newOffset, std::uint64_t newSize)
 
 bool SegmentDataSource::loadData(std::uint64_t loadOffset, std::uint64_t loadSize, std::vector<std::uint8_t>& data) const
 {
-	data.clear();
-
-	if (!isDataSet())
-		return false;
-
-	if (loadOffset >= getDataSize())
-		return false;
-
-	loadSize = loadOffset + loadSize >= getDataSize() ? getDataSize() - loadOffset : loadSize;
-	std::copy(_data.data() + loadOffset, _data.data() + loadOffset + loadSize, std::back_inserter(data));
-	return true;
+	const auto view = getDataView(loadOffset, loadSize);
+	data.assign(view.begin(), view.end());
+	return !view.empty();
 }
 
 bool SegmentDataSource::saveData(std::uint64_t saveOffset, std::uint64_t saveSize, const std::vector<std::uint8_t>& data)
@@ -20,7 +20,9 @@ namespace pdbparser {
 // =================================================================
 
 /**
- * Loads PDB file into memory and separates all streams.
+ * Maps PDB file into memory and separates all streams.
+ * Streams stored linearly in the file are used directly from the mapping,
+ * other streams are copied into linear memory when they are first needed.
  * Must be called before using of any method.
  * Can be called only once.
  * @param filename Name of PDB file to load.
@@ -31,22 +33,18 @@ PDBFileState PDBFile::load_pdb_file(const char *filename)
 	if (pdb_loaded)
 		return PDB_STATE_ALREADY_LOADED;
 
-	// Load PDB file into memory
+	// Map PDB file into memory
 	pdb_filename = filename;
-	FILE *fp = fopen(filename,"rb");
-	if (fp == nullptr)
+	if (!pdb_file.open(filename))
 	{
 		return PDB_STATE_ERR_FILE_OPEN;
 	}
-	fseek(fp, 0, SEEK_END);  // Determine file size
-	pdb_file_size = ftell(fp);
-	fseek(fp, 0, SEEK_SET);
-	pdb_file_data = new char[pdb_file_size]; // Allocate memory
-	size_t result = fread(pdb_file_data,1,pdb_file_size,fp); // Read the file
-	fclose(fp);
-	if (result != pdb_file_size)
+	pdb_file_size = pdb_file.getSize();
+	// The mapping is read-only, the parser never writes into the file data.
+	pdb_file_data = const_cast<char *>(reinterpret_cast<const char *>(pdb_file.getData()));
+	if (pdb_file_size < sizeof(PDB_HEADER_700))
 	{
-		return PDB_STATE_ERR_FILE_OPEN;
+		return PDB_STATE_INVALID_FILE;
 	}
 
 	// Get the version of PDB file and parse it
@@ -64,9 +62,9 @@ PDBFileState PDBFile::load_pdb_file(const char *filename)
 		pdb_version = PDB_VERSION_700;
 		state = load_pdb_v700();
 		// Get pointer to PDB info header
-		if (streams.size() > PDB_STREAM_PDB)
+		if (state == PDB_STATE_OK && streams.size() > PDB_STREAM_PDB)
 		{
-			pdb_info_v700 = reinterpret_cast<PDBInfo70 *>(streams[PDB_STREAM_PDB].data);
+			pdb_info_v700 = reinterpret_cast<PDBInfo70 *>(get_stream(PDB_STREAM_PDB)->data);
 		}
 		else
 		{
@@ -83,7 +81,8 @@ PDBFileState PDBFile::load_pdb_file(const char *filename)
 }
 
 /**
- * Processes all PDB file streams and fills data containers.
+ * Processes DBI stream and fills lists of modules and sections.
+ * Types and symbols are parsed when they are first requested by a getting method.
  * Must be called after load_pdb_file() and before any getting and printing or dumping method.
  * Can be called only once.
  * @param image_base Base address of program's virtual memory.
@@ -95,10 +94,6 @@ void PDBFile::initialize(int image_base)
 		return;
 	}
 
-	// Initialize types
-	pdb_types = new PDBTypes(&streams[PDB_STREAM_TPI]);
-	pdb_types->parse_types();
-
 	// Check if DBI stream is present
 	bool dbi_present = (num_streams > PDB_STREAM_DBI && streams[PDB_STREAM_DBI].unused == false);
 
@@ -106,7 +101,7 @@ void PDBFile::initialize(int image_base)
 	{
 		// Get DBI stream
 		unsigned int pdb_dbi_size = streams[PDB_STREAM_DBI].size;
-		char * pdb_dbi_data = streams[PDB_STREAM_DBI].data;
+		char * pdb_dbi_data = get_stream(PDB_STREAM_DBI)->data;
 
 		// Get pointer to DBI header
 		dbi_header_v700 = reinterpret_cast<NewDBIHdr *>(pdb_dbi_data);
@@ -124,17 +119,41 @@ void PDBFile::initialize(int image_base)
 		if (image_base == 0)
 			image_base = 0x400000; // Default image base
 		parse_sections(image_base);
-
-		// Initialize symbols
-		int pdb_gsi_num = dbi_header_v700->snGSSyms;
-		int pdb_psi_num = dbi_header_v700->snPSSyms;
-		int pdb_sym_num = dbi_header_v700->snSymRecs;
-		pdb_symbols = new PDBSymbols(&streams[pdb_gsi_num],&streams[pdb_psi_num],&streams[pdb_sym_num],modules,sections,pdb_types);
-		pdb_symbols->parse_symbols();
 	}
 	pdb_initialized = true;
 }
 
+/**
+ * Gets stream with the given number.
+ * Non-linear stream is copied into linear memory at the first call.
+ * @param num Number of stream.
+ * @return Stream or nullptr if there is no such stream
+ */
+PDBStream * PDBFile::get_stream(unsigned int num)
+{
+	if (num >= num_streams)
+		return nullptr;
+	PDBStream *stream = &streams[num];
+	if (!stream->unused && stream->data == nullptr)
+	{
+		int pages_per_stream = (stream->size + page_size - 1) / page_size;
+		stream->data = extract_stream(stream->pages, pages_per_stream);
+	}
+	return stream;
+}
+
+/**
+ * Determines whether stream with the given number is available in linear
+ * memory without copying it, i.e. whether it is linear in the PDB file
+ * or it was already copied by get_stream().
+ * @param num Number of stream.
+ * @return Stream is loaded
+ */
+bool PDBFile::is_stream_loaded(unsigned int num) const
+{
+	return num < num_streams && streams[num].data != nullptr;
+}
+
 /**
  * Saves all streams into separate files.
  * File names consist of input PDB file name and extension .xxx as stream number
@@ -154,7 +173,7 @@ bool PDBFile::save_streams_to_files(void)
 		if (fs == nullptr)
 			return false;
 		if (!streams[i].unused)
-			fwrite(streams[i].data,1,streams[i].size,fs);
+			fwrite(get_stream(i)->data,1,streams[i].size,fs);
 		fclose(fs);
 	}
 	return true;
@@ -240,7 +259,7 @@ void PDBFile::dump_FPO(void)
 		return;
 	}
 
-	PDBStream *pdb_fpo_stream = &streams[pdb_fpo_num];
+	PDBStream *pdb_fpo_stream = get_stream(pdb_fpo_num);
 	int fpoSize = pdb_fpo_stream->size;
 	PDB_FPO_DATA *fpo = reinterpret_cast<PDB_FPO_DATA *>(pdb_fpo_stream->data);
 
@@ -282,7 +301,7 @@ void PDBFile::dump_PE_sections(void)
 		return;
 	}
 
-	PDBStream *pdb_sect_stream = &streams[pdb_sec_num];
+	PDBStream *pdb_sect_stream = get_stream(pdb_sec_num);
 	PDB_PVOID pSect = pdb_sect_stream->data;
 	unsigned long sectSize = pdb_sect_stream->size;
 
@@ -305,12 +324,12 @@ void PDBFile::dump_PE_sections(void)
  */
 PDBFile::~PDBFile()
 {
-	if (pdb_file_data)
-		delete [] pdb_file_data;
-	// Delete all non-linear (copied) streams
+	// Delete all non-linear streams which were copied
 	for (unsigned int i = 0; i < num_streams;i++)
-		if (!streams[i].unused && !streams[i].linear)
+		if (!streams[i].linear)
 			delete [] streams[i].data;
+	if (pdb_root_dir_copied)
+		delete [] reinterpret_cast<char *>(pdb_root_dir);
 	if (pdb_types)
 		delete pdb_types;
 	if (pdb_symbols)
@@ -336,6 +355,20 @@ bool PDBFile::stream_is_linear(PDB_DWORD *pages, int num_pages)
 	return true;
 }
 
+/**
+ * Determines whether all pages used by stream lie inside of PDB file
+ * @param pages Index of pages used by stream
+ * @param num_pages Number of pages used by stream
+ * @return All pages are inside of file
+ */
+bool PDBFile::pages_are_in_file(PDB_DWORD *pages, int num_pages)
+{
+	for (int i = 0;i < num_pages;i++)
+		if (pages[i] >= pdb_header->V700.dNumPages)
+			return false;
+	return true;
+}
+
 /**
  * Extracts non-linear stream into linear memory.
  * @param pages Index of pages used by stream
@@ -353,6 +386,56 @@ char *PDBFile::extract_stream(PDB_DWORD *pages, int num_pages)
 	return stream_data;
 }
 
+/**
+ * Parses TPI stream if it was not parsed yet.
+ * @return Types container or nullptr if the file was not initialized
+ */
+PDBTypes * PDBFile::load_types(void)
+{
+	if (pdb_types == nullptr && pdb_initialized)
+	{
+		pdb_types = new PDBTypes(get_stream(PDB_STREAM_TPI));
+		pdb_types->parse_types();
+	}
+	return pdb_types;
+}
+
+/**
+ * Parses streams of all modules if they were not parsed yet. Types are parsed
+ * too because symbols refer to them. GSI and PSI streams are not needed.
+ * @return Symbols container or nullptr if the file was not initialized or
+ *         it does not contain DBI stream
+ */
+PDBSymbols * PDBFile::load_symbols(void)
+{
+	if (pdb_symbols == nullptr && pdb_initialized && dbi_header_v700 != nullptr)
+	{
+		for (auto &m : modules)
+			if (m.stream != nullptr)
+				get_stream(m.stream_num);
+		pdb_symbols = new PDBSymbols(modules,sections,load_types());
+		pdb_symbols->parse_symbols();
+	}
+	return pdb_symbols;
+}
+
+/**
+ * Parses SYM stream with global variables if it was not parsed yet.
+ * Streams of modules are parsed too because they also contain global variables.
+ * @return Symbols container or nullptr if the file was not initialized, it
+ *         does not contain DBI stream or SYM stream
+ */
+PDBSymbols * PDBFile::load_global_symbols(void)
+{
+	if (load_symbols() == nullptr)
+		return nullptr;
+	PDBStream *sym = get_stream(dbi_header_v700->snSymRecs);
+	if (sym == nullptr)
+		return nullptr;
+	pdb_symbols->parse_global_symbols(sym);
+	return pdb_symbols;
+}
+
 /**
  * Separates all streams from PDB file version 2.00.
  * Vector "streams" is filled here.
@@ -381,22 +464,34 @@ PDBFileState PDBFile::load_pdb_v700(void)
 		return PDB_STATE_INVALID_FILE;
 
 	// Get root directory
-	int pages_per_root = (pdb_header->V700.dRootSize + page_size - 1) / page_size;
+	unsigned int root_size = pdb_header->V700.dRootSize;
+	int pages_per_root = (root_size + page_size - 1) / page_size;
+	if (root_size < sizeof(PDB_DWORD) || pdb_header->V700.dRootIndexesPage >= pdb_header->V700.dNumPages
+		|| pages_per_root * sizeof(PDB_DWORD) > page_size)
+		return PDB_STATE_INVALID_FILE;
 	PDB_DWORD *root_dir_indexes = reinterpret_cast<PDB_DWORD *>(pdb_file_data + (pdb_header->V700.dRootIndexesPage) * page_size);
+	if (!pages_are_in_file(root_dir_indexes, pages_per_root))
+		return PDB_STATE_INVALID_FILE;
 	if (stream_is_linear(root_dir_indexes, pages_per_root))
 		pdb_root_dir = reinterpret_cast<PDB_ROOT *>(pdb_file_data + root_dir_indexes[0] * page_size);
 	else
+	{
 		pdb_root_dir = reinterpret_cast<PDB_ROOT *>(extract_stream(root_dir_indexes, pages_per_root));
+		pdb_root_dir_copied = true;
+	}
 
 	// Get streams
 	num_streams = pdb_root_dir->V700.dNumStreams;
+	if (num_streams >= root_size / sizeof(PDB_DWORD))
+		return PDB_STATE_INVALID_FILE;
+	unsigned int root_dwords = root_size / sizeof(PDB_DWORD) - 1;  // Without number of streams
 	// Allocate memory for streams. We need to use resize() instead of
 	// reserve() because reserve() does not increases the size of the
 	// container. That would make accesses to it in the following loop invalid.
 	streams.resize(num_streams);
 	int cur_pagedir_index = num_streams + 0;  // Skip dwords with stream sizes
 
-	// Extract each stream
+	// Find pages of each stream
 	for (unsigned int i = 0; i < num_streams;i++)
 	{
 		streams[i].size = pdb_root_dir->V700.adStreamSizes[i];
@@ -406,22 +501,27 @@ PDBFileState PDBFile::load_pdb_v700(void)
 			streams[i].unused = true;
 			streams[i].linear = false;
 			streams[i].data = nullptr;
+			streams[i].pages = nullptr;
 		}
 		// Stream is not empty
 		else
 		{
 			streams[i].unused = false;
 			int pages_per_stream = (streams[i].size + page_size - 1) / page_size;
+			streams[i].pages = &pdb_root_dir->V700.adStreamSizes[cur_pagedir_index];
+			if (unsigned(cur_pagedir_index + pages_per_stream) > root_dwords
+				|| !pages_are_in_file(streams[i].pages, pages_per_stream))
+				return PDB_STATE_INVALID_FILE;
 			// Stream is linear in pdb file, we just get a pointer to it
 			if (stream_is_linear(&pdb_root_dir->V700.adStreamSizes[cur_pagedir_index], pages_per_stream))
 			{
 				streams[i].data = pdb_file_data + pdb_root_dir->V700.adStreamSizes[cur_pagedir_index] * page_size;
 				streams[i].linear = true;
 			}
-			// Stream is not linear in pdb file, we must copy it to linear memory
+			// Stream is not linear in pdb file, it is copied to linear memory by get_stream()
 			else
 			{
-				streams[i].data = extract_stream(&pdb_root_dir->V700.adStreamSizes[cur_pagedir_index], pages_per_stream);
+				streams[i].data = nullptr;
 				streams[i].linear = false;
 			}
 			cur_pagedir_index += pages_per_stream;  // Increase index to next stream
@@ -437,7 +537,7 @@ PDBFileState PDBFile::load_pdb_v700(void)
 void PDBFile::parse_modules(void)
 {
 	// Get DBI stream size and data
-	PDBStream * pdb_dbi_stream = &streams[PDB_STREAM_DBI];
+	PDBStream * pdb_dbi_stream = get_stream(PDB_STREAM_DBI);
 	unsigned int pdb_dbi_size = pdb_dbi_stream->size;
 	char * pdb_dbi_data = pdb_dbi_stream->data;
 
@@ -473,7 +573,7 @@ void PDBFile::parse_modules(void)
 		}
 
 		// Add module into vector
-		PDBStream *s = (entry->sn == 0xffff)?nullptr:&streams[entry->sn]; // Get module stream
+		PDBStream *s = (entry->sn == 0xffff || entry->sn >= num_streams)?nullptr:&streams[entry->sn]; // Get module stream
 		PDBModule new_module =
 		{
 			reinterpret_cast<char *>(entry->rgch),  // name
@@ -497,7 +597,7 @@ void PDBFile::parse_sections(int image_base)
 		return;
 
 	// Get stream with section info
-	PDBStream * pdb_sect_stream = &streams[pdb_sec_num];
+	PDBStream * pdb_sect_stream = get_stream(pdb_sec_num);
 	unsigned int pdb_sect_size = pdb_sect_stream->size;
 	char * pdb_sect_data = pdb_sect_stream->data;
 
@@ -261,43 +261,26 @@ std::string PDBFunction::getNameWithOverloadIndex() const
 // PUBLIC METHODS
 // =================================================================
 
+/**
+ * Parses streams of all modules to find functions and global variables
+ * defined in modules. Global variables from SYM stream are parsed
+ * separately by parse_global_symbols().
+ */
 void PDBSymbols::parse_symbols(void)
 {
 	if (parsed)
 		return;
 
-	// Process SYM stream to find global variables
-	int position = 0;
-	while (unsigned(position) < pdb_sym_size)
-	{
-		PDBGeneralSymbol *symbol = reinterpret_cast<PDBGeneralSymbol *>(pdb_sym_data + position);
-		if (symbol->type == S_GDATA32 /*|| symbol->type == S_LDATA32*/)
-		{  // Global variable
-			DATASYM32 * sym = reinterpret_cast<DATASYM32 *>(symbol);
-			PDBGlobalVariable new_var =
-			{reinterpret_cast<char *>(sym->name),  // Name
-			        get_virtual_address(sym->seg, sym->off),  // Address
-			        sym->off,  // Offset
-			        sym->seg,  // Section
-			        -1,  // Module index
-			        sym->typind,  // Type index
-			        types->get_type_by_index(sym->typind),  // Type definition
-			        };
-			global_variables[new_var.address] = new_var;
-		}
-		position += symbol->size + 2;
-	}
-
 	// Map to help find overloaded functions (key is function name)
 	std::map<std::string, PDBFunction *> func_names;
 
 	// Process all modules streams to find functions and all other information
 	for (unsigned int m = 0; m < modules.size(); m++)
 	{
-		if (modules[m].stream_num == 65535)
+		if (modules[m].stream_num == 65535 || modules[m].stream == nullptr)
 			continue;
 		PDBStream *stream = modules[m].stream;
-		position = 4;
+		int position = 4;
 		int cnt = 0;
 		PDBFunction * new_function = nullptr;
 		while (position < stream->size)
@@ -404,6 +387,41 @@ void PDBSymbols::parse_symbols(void)
 	parsed = true;
 }
 
+/**
+ * Parses SYM stream to find global variables.
+ * Variables found in module streams by parse_symbols() take precedence.
+ * @param sym_stream SYM stream
+ */
+void PDBSymbols::parse_global_symbols(PDBStream *sym_stream)
+{
+	if (sym_parsed || sym_stream == nullptr)
+		return;
+
+	pdb_sym_size = sym_stream->size;
+	pdb_sym_data = sym_stream->data;
+	unsigned int position = 0;
+	while (position < pdb_sym_size)
+	{
+		PDBGeneralSymbol *symbol = reinterpret_cast<PDBGeneralSymbol *>(pdb_sym_data + position);
+		if (symbol->type == S_GDATA32 /*|| symbol->type == S_LDATA32*/)
+		{  // Global variable
+			DATASYM32 * sym = reinterpret_cast<DATASYM32 *>(symbol);
+			PDBGlobalVariable new_var =
+			{reinterpret_cast<char *>(sym->name),  // Name
+			        get_virtual_address(sym->seg, sym->off),  // Address
+			        sym->off,  // Offset
+			        sym->seg,  // Section
+			        -1,  // Module index
+			        sym->typind,  // Type index
+			        types->get_type_by_index(sym->typind),  // Type definition
+			        };
+			global_variables.insert(std::make_pair(new_var.address, new_var));
+		}
+		position += symbol->size + 2;
+	}
+	sym_parsed = true;
+}
+
 void PDBSymbols::dump_global_symbols(void)
 {
 	unsigned int position = 0;
@@ -426,7 +444,7 @@ void PDBSymbols::dump_module_symbols(int index)
 	puts("******* SYM module symbols *******");
 	printf("Module #%d Stream number: %d Module name: %s\n", index, modules[index].stream_num, modules[index].name);
 	puts("");
-	if (modules[index].stream_num == 65535)
+	if (modules[index].stream_num == 65535 || modules[index].stream == nullptr)
 	{
 		puts("Module stream is not present in PDB file.\n");
 		return;
@@ -93,28 +93,28 @@ RTTIBaseClassDescriptor* parseMsvcBaseClassDescriptor(
 		return nullptr;
 	addr += wordSize;
 
-	std::uint64_t numContainedBases = 0;
-	if (!img->get4Byte(addr, numContainedBases))
+	std::uint32_t numContainedBases = 0;
+	if (!img->getValue(addr, numContainedBases))
 		return nullptr;
 	addr += 4;
 
-	std::uint64_t mdisp = 0;
-	if (!img->get4Byte(addr, mdisp))
+	std::int32_t mdisp = 0;
+	if (!img->getValue(addr, mdisp))
 		return nullptr;
 	addr += 4;
 
-	std::uint64_t pdisp = 0;
-	if (!img->get4Byte(addr, pdisp))
+	std::int32_t pdisp = 0;
+	if (!img->getValue(addr, pdisp))
 		return nullptr;
 	addr += 4;
 
-	std::uint64_t vdisp = 0;
-	if (!img->get4Byte(addr, vdisp))
+	std::int32_t vdisp = 0;
+	if (!img->getValue(addr, vdisp))
 		return nullptr;
 	addr += 4;
 
-	std::uint64_t attributes = 0;
-	if (!img->get4Byte(addr, attributes))
+	std::uint32_t attributes = 0;
+	if (!img->getValue(addr, attributes))
 		return nullptr;
 	addr += 4;
 
@@ -164,18 +164,18 @@ RTTIClassHierarchyDescriptor* parseMsvcClassDescriptor(
 	auto addr = classDescriptorAddr;
 	size_t wordSize = img->getBytesPerWord();
 
-	std::uint64_t signature2 = 0;
-	if (!img->get4Byte(addr, signature2))
+	std::uint32_t signature2 = 0;
+	if (!img->getValue(addr, signature2))
 		return nullptr;
 	addr += 4;
 
-	std::uint64_t attributes = 0;
-	if (!img->get4Byte(addr, attributes))
+	std::uint32_t attributes = 0;
+	if (!img->getValue(addr, attributes))
 		return nullptr;
 	addr += 4;
 
-	std::uint64_t numBaseClasses = 0;
-	if (!img->get4Byte(addr, numBaseClasses))
+	std::uint32_t numBaseClasses = 0;
+	if (!img->getValue(addr, numBaseClasses))
 		return nullptr;
 	addr += 4;
 
@@ -242,18 +242,18 @@ RTTICompleteObjectLocator* parseMsvcObjectLocator(
 	size_t wordSize = img->getBytesPerWord();
 
 	Address addr = rttiAddr;
-	std::uint64_t signature1 = 0;
-	if (!img->get4Byte(addr, signature1))
+	std::uint32_t signature1 = 0;
+	if (!img->getValue(addr, signature1))
 		return nullptr;
 	addr += 4;
 
-	std::uint64_t offset = 0;
-	if (!img->get4Byte(addr, offset))
+	std::uint32_t offset = 0;
+	if (!img->getValue(addr, offset))
 		return nullptr;
 	addr += 4;
 
-	std::uint64_t cdOffset = 0;
-	if (!img->get4Byte(addr, cdOffset))
+	std::uint32_t cdOffset = 0;
+	if (!img->getValue(addr, cdOffset))
 		return nullptr;
 	addr += 4;
 
@@ -4,16 +4,19 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "retdec/stacofin/stacofin.h"
-#include "yaracpp/yara_detector/yara_detector.h"
+#include "retdec/utils/thread_pool.h"
+#include "retdec/yara-support/yara_detector.h"
 #include "retdec/loader/loader/image.h"
 
 using namespace retdec::utils;
-using namespace yaracpp;
+using namespace retdec::yara_support;
 using namespace retdec::loader;
 
 namespace retdec {
@@ -73,25 +76,74 @@ void Finder::clear()
 void Finder::search(
 	const Image &image,
 	const std::string &yaraFile)
+{
+	search(image, std::vector<std::string>{yaraFile});
+}
+
+/**
+ * Search for static code from several signature files in input file.
+ *
+ * All signature files scan the same loaded bytes of the input file. If
+ * @a threadPool is given, the files are scanned by its threads in parallel.
+ * Results are stored in the order of @a yaraFiles.
+ *
+ * @param image input file image
+ * @param yaraFiles static code signatures
+ * @param threadPool threads to scan by (@c nullptr to scan serially)
+ */
+void Finder::search(
+	const Image &image,
+	const std::vector<std::string> &yaraFiles,
+	ThreadPool *threadPool)
 {
 	// Get FileFormat instance.
 	const auto* fileFormat = image.getFileFormat();
-	if (!fileFormat) {
+	if (!fileFormat || yaraFiles.empty()) {
 		return;
 	}
 
-	// Start Yara detector.
-	YaraDetector detector;
-	detector.addRuleFile(yaraFile);
-	auto inputBytes = fileFormat->getLoadedBytes();
-	detector.analyze(inputBytes);
-	if (!detector.isInValidState()) {
-		return;
+	// Scan shared input bytes by one Yara detector per signature file.
+	const auto loadedBytes = fileFormat->getLoadedBytes();
+	std::vector<YaraDetector> detectors(yaraFiles.size());
+	auto scanFile = [&](std::size_t i) {
+		detectors[i].addRuleFile(yaraFiles[i]);
+		detectors[i].analyze(loadedBytes.data(), loadedBytes.size());
+	};
+
+	if (threadPool) {
+		threadPool->parallelFor(yaraFiles.size(), scanFile);
 	}
+	else {
+		for (std::size_t i = 0; i < yaraFiles.size(); ++i) {
+			scanFile(i);
+		}
+	}
+
+	// Offsets are converted to addresses here, as file format is not
+	// guaranteed to be thread-safe.
+	for (std::size_t i = 0; i < yaraFiles.size(); ++i) {
+		if (detectors[i].isInValidState()) {
+			storeDetections(fileFormat, yaraFiles[i],
+				detectors[i].getDetectedRules());
+		}
+	}
+}
 
+/**
+ * Store detected static code.
+ *
+ * @param fileFormat input file format
+ * @param yaraFile static code signatures
+ * @param detectedRules rules detected in input file
+ */
+void Finder::storeDetections(
+	const retdec::fileformat::FileFormat *fileFormat,
+	const std::string &yaraFile,
+	const std::vector<YaraRule> &detectedRules)
+{
 	// Iterate over detected rules.
 	isSorted = false;
-	for (const YaraRule &detectedRule : detector.getDetectedRules()) {
+	for (const YaraRule &detectedRule : detectedRules) {
 		DetectedFunction detectedFunction;
 		detectedFunction.signaturePath = yaraFile;
 
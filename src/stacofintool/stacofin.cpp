@@ -153,9 +153,7 @@ int doActions(
 
 	// Do search.
 	Finder codeFinder;
-	for (const auto &yaraPath : yaraPaths) {
-		codeFinder.search(*image.get(), yaraPath);
-	}
+	codeFinder.search(*image.get(), yaraPaths);
 
 	// Print detections.
 	if (debugOn) {
@@ -18,45 +18,44 @@ Nrv2dData::~Nrv2dData()
 {
 }
 
-bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
+template <typename BitReader> bool Nrv2dData::decompressImpl(BitReader& bitReader, DynamicBuffer& outputBuffer)
 {
-	// Reset just in case decompress() is called more times in row
-	reset();
+	const uint8_t* input = _buffer.getRawBuffer();
+	uint32_t inputSize = _buffer.getRealDataSize();
+	NrvOutput output(outputBuffer, _writePos);
 
 	int32_t lastDist = 1;
 	uint8_t bit;
 
 	while (true)
 	{
-		if (!_bitParser->getBit(bit, _buffer, _readPos))
+		if (!bitReader.getBit(bit, input, inputSize, _readPos))
 			return false;
 
 		while (bit == 1)
 		{
-			if (_writePos >= outputBuffer.getCapacity() || _readPos >= _buffer.getRealDataSize())
+			if (_readPos >= inputSize || !output.putByte(input[_readPos++]))
 				return false;
 
-			outputBuffer.write<uint8_t>(_buffer.read<uint8_t>(_readPos++), _writePos++);
-
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bitReader.getBit(bit, input, inputSize, _readPos))
 				return false;
 		}
 
 		int32_t dist = 1;
 		while (true)
 		{
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bitReader.getBit(bit, input, inputSize, _readPos))
 				return false;
 
 			dist += dist + bit;
 
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bitReader.getBit(bit, input, inputSize, _readPos))
 				return false;
 
 			if (bit == 1)
 				break;
 
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bitReader.getBit(bit, input, inputSize, _readPos))
 				return false;
 
 			dist = ((dist - 1) << 1) + bit;
@@ -67,17 +66,17 @@ bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
 		{
 			dist = lastDist;
 
-			if (!_bitParser->getBit(bit, _buffer, _readPos))
+			if (!bitReader.getBit(bit, input, inputSize, _readPos))
 				return false;
 
 			count = bit;
 		}
 		else
 		{
-			if (_readPos >= _buffer.getRealDataSize())
+			if (_readPos >= inputSize)
 				return false;
 
-			dist = ((dist - 3) << 8) | _buffer.read<uint8_t>(_readPos++);
+			dist = ((dist - 3) << 8) | input[_readPos++];
 
 			if (dist == -1)
 				return true;
@@ -87,7 +86,7 @@ bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
 			lastDist = ++dist;
 		}
 
-		if (!_bitParser->getBit(bit, _buffer, _readPos))
+		if (!bitReader.getBit(bit, input, inputSize, _readPos))
 			return false;
 
 		count += count + bit;
@@ -98,12 +97,12 @@ bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
 
 			do
 			{
-				if (!_bitParser->getBit(bit, _buffer, _readPos))
+				if (!bitReader.getBit(bit, input, inputSize, _readPos))
 					return false;
 
 				count += count + bit;
 
-				if (!_bitParser->getBit(bit, _buffer, _readPos))
+				if (!bitReader.getBit(bit, input, inputSize, _readPos))
 					return false;
 			} while (bit == 0);
 
@@ -112,17 +111,18 @@ bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
 
 		count += (dist > 0x500) + 1;
 
-		uint32_t srcPos = static_cast<int32_t>(_writePos) - dist;
-		do
-		{
-			if (_writePos >= outputBuffer.getCapacity())
-				return false;
-
-			outputBuffer.write<uint8_t>(outputBuffer.read<uint8_t>(srcPos++), _writePos++);
-		}
-		while (--count);
+		if (!output.copyMatch(static_cast<int32_t>(_writePos) - dist, count))
+			return false;
 	}
 }
 
+bool Nrv2dData::decompress(DynamicBuffer& outputBuffer)
+{
+	// Reset just in case decompress() is called more times in row
+	reset();
+
+	return visitBitReader([this, &outputBuffer](auto& bitReader) { return decompressImpl(bitReader, outputBuffer); });
+}
+
 } // namespace unpacker
 } // namespace retdec
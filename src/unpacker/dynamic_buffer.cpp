@@ -135,6 +135,17 @@ Endianness DynamicBuffer::getEndianness() const
 	return _endianness;
 }
 
+/**
+ * Sets the size of the data in the buffer. The new bytes are filled with default (0) value.
+ * The size is limited by the capacity of the buffer.
+ *
+ * @param size The new size of the data.
+ */
+void DynamicBuffer::setRealDataSize(uint32_t size)
+{
+	_data.resize(size > _capacity ? _capacity : size);
+}
+
 /**
  * Gets the size of the data that are actually written to the buffer.
  * This cannot be greater than the capacity of the buffer.
@@ -181,6 +192,17 @@ const uint8_t* DynamicBuffer::getRawBuffer() const
 	return _data.data();
 }
 
+/**
+ * Gets the raw pointer to the bytes in the buffer, which can be used for writing. Only the bytes
+ * up to the size of the real data can be accessed.
+ *
+ * @return The pointer to the bytes in the buffer.
+ */
+uint8_t* DynamicBuffer::getRawBuffer()
+{
+	return _data.data();
+}
+
 /**
  * Runs the specified function for every single byte in the DynamicBuffer.
  *
@@ -805,8 +805,32 @@ bool ByteValueStorage::getDoubleArray(std::uint64_t address, std::vector<double>
  */
 bool ByteValueStorage::createValueFromBytes(const std::vector<std::uint8_t>& data, std::uint64_t& value, Endianness endian, std::uint64_t offset/* = 0*/, std::uint64_t size/* = 0*/) const
 {
-	const std::uint64_t realSize = (!size || offset + size > data.size()) ? data.size() - offset : size;
-	if (offset >= data.size() || (size && realSize != size))
+	return createValueFromBytes(data.data(), data.size(), value, endian, offset, size);
+}
+
+/**
+ * Create integer from array of bytes
+ *
+ * @param data Array of bytes
+ * @param dataSize Size of @a data
+ * @param value Resulted value
+ * @param endian Endian - if specified it is forced, otherwise file's endian is used
+ * @param offset Offset of first byte from @a data which will be converted
+ *    (0 means first offset from @a data)
+ * @param size Number of bytes for conversion (0 means all bytes from @a offset
+ *    to end of @a data)
+ *
+ * @return @c true if conversion went OK, @c false otherwise
+ */
+bool ByteValueStorage::createValueFromBytes(const std::uint8_t* data, std::uint64_t dataSize, std::uint64_t& value, Endianness endian, std::uint64_t offset/* = 0*/, std::uint64_t size/* = 0*/) const
+{
+	if (!data || offset >= dataSize)
+	{
+		return false;
+	}
+
+	const std::uint64_t realSize = (!size || offset + size > dataSize) ? dataSize - offset : size;
+	if (size && realSize != size)
 	{
 		return false;
 	}
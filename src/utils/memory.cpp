@@ -11,6 +11,7 @@
 
 #ifdef OS_WINDOWS
 	#include <windows.h>
+	#include <psapi.h>
 #elif defined(OS_MACOS) || defined(OS_BSD)
 	#include <sys/types.h>
 	#include <sys/sysctl.h>
@@ -222,5 +223,32 @@ bool limitSystemMemoryToHalfOfTotalSystemMemory() {
 	return limitSystemMemory(totalSize / 2);
 }
 
+/**
+* @brief Returns the peak memory usage (resident set size) of the current
+*        process so far (in bytes).
+*
+* When the usage cannot be obtained, it returns @c 0.
+*/
+std::size_t getPeakMemoryUsage() {
+#ifdef OS_WINDOWS
+	PROCESS_MEMORY_COUNTERS counters;
+	bool succeeded = GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+		sizeof(counters));
+	return succeeded ? counters.PeakWorkingSetSize : 0;
+#else
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) {
+		return 0;
+	}
+	#if defined(OS_MACOS)
+		// On macOS, the size is in bytes.
+		return static_cast<std::size_t>(usage.ru_maxrss);
+	#else
+		// On Linux and *BSD, the size is in kilobytes.
+		return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+	#endif
+#endif
+}
+
 } // namespace utils
 } // namespace retdec
@@ -0,0 +1,207 @@
+/**
+ * @file src/utils/memory_mapped_file.cpp
+ * @brief Read-only view of a file mapped into memory.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <utility>
+
+#include "retdec/utils/memory_mapped_file.h"
+
+#ifdef OS_WINDOWS
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace retdec {
+namespace utils {
+
+/**
+ * Constructor. Maps the given file.
+ * @param path Path to the file to map.
+ *
+ * Use @c isOpen() to check whether the mapping succeeded.
+ */
+MemoryMappedFile::MemoryMappedFile(const std::string& path)
+{
+	open(path);
+}
+
+/**
+ * Move constructor.
+ */
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+{
+	swap(other);
+}
+
+/**
+ * Move assignment operator.
+ */
+MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+{
+	if (this != &other)
+	{
+		close();
+		swap(other);
+	}
+	return *this;
+}
+
+/**
+ * Destructor. Unmaps the file.
+ */
+MemoryMappedFile::~MemoryMappedFile()
+{
+	close();
+}
+
+/**
+ * Map the given file into memory. Previously mapped file is unmapped.
+ * @param path Path to the file to map.
+ * @return @c true if the file was mapped, @c false otherwise.
+ *
+ * Only regular files can be mapped. Opening an empty file succeeds, but
+ * @c getData() returns @c nullptr for it.
+ */
+bool MemoryMappedFile::open(const std::string& path)
+{
+	close();
+
+#ifdef OS_WINDOWS
+	auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+			nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (GetFileType(file) != FILE_TYPE_DISK || !GetFileSizeEx(file, &fileSize))
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	if (fileSize.QuadPart == 0)
+	{
+		CloseHandle(file);
+		_isOpen = true;
+		return true;
+	}
+
+	auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!mapping)
+	{
+		return false;
+	}
+
+	auto* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!view)
+	{
+		CloseHandle(mapping);
+		return false;
+	}
+
+	_mapping = mapping;
+	_data = static_cast<const std::uint8_t*>(view);
+	_size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+	auto fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		return false;
+	}
+
+	struct stat fileStat;
+	if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode))
+	{
+		::close(fd);
+		return false;
+	}
+
+	if (fileStat.st_size == 0)
+	{
+		::close(fd);
+		_isOpen = true;
+		return true;
+	}
+
+	auto* view = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (view == MAP_FAILED)
+	{
+		return false;
+	}
+
+	_data = static_cast<const std::uint8_t*>(view);
+	_size = static_cast<std::size_t>(fileStat.st_size);
+#endif
+
+	_isOpen = true;
+	return true;
+}
+
+/**
+ * Unmap the file. Does nothing when no file is mapped.
+ */
+void MemoryMappedFile::close()
+{
+	if (_data)
+	{
+#ifdef OS_WINDOWS
+		UnmapViewOfFile(_data);
+		CloseHandle(_mapping);
+		_mapping = nullptr;
+#else
+		munmap(const_cast<std::uint8_t*>(_data), _size);
+#endif
+	}
+
+	_data = nullptr;
+	_size = 0;
+	_isOpen = false;
+}
+
+/**
+ * Is a file mapped?
+ */
+bool MemoryMappedFile::isOpen() const
+{
+	return _isOpen;
+}
+
+/**
+ * Get the start of the mapped file content.
+ * @return Pointer to the content or @c nullptr if nothing is mapped.
+ */
+const std::uint8_t* MemoryMappedFile::getData() const
+{
+	return _data;
+}
+
+/**
+ * Get the size of the mapped file content.
+ */
+std::size_t MemoryMappedFile::getSize() const
+{
+	return _size;
+}
+
+void MemoryMappedFile::swap(MemoryMappedFile& other) noexcept
+{
+	std::swap(_data, other._data);
+	std::swap(_size, other._size);
+	std::swap(_isOpen, other._isOpen);
+#ifdef OS_WINDOWS
+	std::swap(_mapping, other._mapping);
+#endif
+}
+
+} // namespace utils
+} // namespace retdec
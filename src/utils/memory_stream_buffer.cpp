@@ -0,0 +1,65 @@
+/**
+ * @file src/utils/memory_stream_buffer.cpp
+ * @brief Stream buffer reading bytes from memory.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include "retdec/utils/memory_stream_buffer.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+ * Constructor.
+ * @param data Start of bytes to read.
+ * @param size Number of bytes to read.
+ */
+MemoryStreamBuffer::MemoryStreamBuffer(const std::uint8_t* data, std::size_t size)
+{
+	// The get area is never written into, std::streambuf just does not have
+	// a constant variant of it.
+	auto* begin = const_cast<char*>(reinterpret_cast<const char*>(data));
+	setg(begin, begin, begin + size);
+}
+
+MemoryStreamBuffer::pos_type MemoryStreamBuffer::seekoff(off_type off,
+		std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+	if (!(which & std::ios_base::in) || (which & std::ios_base::out))
+	{
+		return pos_type(off_type(-1));
+	}
+
+	off_type base = 0;
+	if (dir == std::ios_base::cur)
+	{
+		base = gptr() - eback();
+	}
+	else if (dir == std::ios_base::end)
+	{
+		base = egptr() - eback();
+	}
+
+	const auto pos = base + off;
+	if (pos < 0 || pos > egptr() - eback())
+	{
+		return pos_type(off_type(-1));
+	}
+
+	setg(eback(), eback() + pos, egptr());
+	return pos_type(pos);
+}
+
+MemoryStreamBuffer::pos_type MemoryStreamBuffer::seekpos(pos_type pos,
+		std::ios_base::openmode which)
+{
+	return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+std::streamsize MemoryStreamBuffer::showmanyc()
+{
+	return gptr() < egptr() ? egptr() - gptr() : -1;
+}
+
+} // namespace utils
+} // namespace retdec
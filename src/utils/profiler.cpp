@@ -0,0 +1,283 @@
+/**
+ * @file src/utils/profiler.cpp
+ * @brief Recording of time and memory used by phases of a program.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+
+#include "retdec/utils/memory.h"
+#include "retdec/utils/os.h"
+#include "retdec/utils/profiler.h"
+
+#ifdef OS_WINDOWS
+	#include <windows.h>
+#else
+	#include <sys/resource.h>
+	#include <sys/time.h>
+#endif
+
+namespace {
+
+/// Number of existing profilers. Allocations are counted only if it is
+/// non-zero.
+std::atomic<std::size_t> profilerCount(0);
+
+/// Number of heap allocations done while some profiler existed.
+std::atomic<std::size_t> allocationCount(0);
+
+/// Is the allocation hook linked into the program?
+std::atomic<bool> allocationHook(false);
+
+/**
+ * Write @a str into @a out as a JSON string.
+ */
+void writeJsonString(std::ostream& out, const std::string& str)
+{
+	out << '"';
+	for (unsigned char c : str)
+	{
+		switch (c)
+		{
+			case '"': out << "\\\""; break;
+			case '\\': out << "\\\\"; break;
+			case '\n': out << "\\n"; break;
+			case '\t': out << "\\t"; break;
+			default:
+				if (c < 0x20)
+				{
+					char buf[8];
+					std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+					out << buf;
+				}
+				else
+				{
+					out << c;
+				}
+		}
+	}
+	out << '"';
+}
+
+/**
+ * Write @a sizes into @a out as a JSON object.
+ */
+void writeJsonSizes(std::ostream& out,
+	const retdec::utils::Profiler::Sizes& sizes)
+{
+	out << "{";
+	for (std::size_t i = 0; i < sizes.size(); ++i)
+	{
+		out << (i ? ", " : " ");
+		writeJsonString(out, sizes[i].first);
+		out << ": " << sizes[i].second;
+	}
+	out << (sizes.empty() ? "}" : " }");
+}
+
+} // anonymous namespace
+
+namespace retdec {
+namespace utils {
+
+/**
+ * Constructor. Starts counting of heap allocations.
+ */
+Profiler::Profiler()
+{
+	++profilerCount;
+}
+
+/**
+ * Destructor.
+ */
+Profiler::~Profiler()
+{
+	--profilerCount;
+}
+
+/**
+ * Start a new phase called @a name. If some phase is running, the new phase
+ * is nested in it.
+ * @param name Name of the phase.
+ * @param sizesBefore Sizes of the processed data at the start of the phase.
+ */
+void Profiler::start(const std::string& name, const Sizes& sizesBefore)
+{
+	Record r;
+	r.name = name;
+	r.level = _running.size();
+	r.sizesBefore = sizesBefore;
+	_records.push_back(std::move(r));
+
+	_running.push_back({
+		_records.size() - 1,
+		std::chrono::steady_clock::now(),
+		getCpuTime(),
+		getPeakMemoryUsage(),
+		getAllocationCount()
+	});
+}
+
+/**
+ * Stop the innermost running phase.
+ * @param sizesAfter Sizes of the processed data at the end of the phase.
+ */
+void Profiler::stop(const Sizes& sizesAfter)
+{
+	if (_running.empty())
+	{
+		return;
+	}
+
+	const auto& running = _running.back();
+	auto& r = _records[running.record];
+	const std::chrono::duration<double> wallTime =
+		std::chrono::steady_clock::now() - running.wallTime;
+	r.wallTime = wallTime.count();
+	r.cpuTime = std::max(0.0, getCpuTime() - running.cpuTime);
+	auto peakMemory = getPeakMemoryUsage();
+	r.peakMemoryGrowth = peakMemory > running.peakMemory
+		? peakMemory - running.peakMemory
+		: 0;
+	r.allocations = getAllocationCount() - running.allocations;
+	r.sizesAfter = sizesAfter;
+
+	_running.pop_back();
+}
+
+/**
+ * Is some phase running?
+ */
+bool Profiler::isRunning() const
+{
+	return !_running.empty();
+}
+
+/**
+ * Get records of all started phases in the order of their starts.
+ */
+const std::vector<Profiler::Record>& Profiler::getRecords() const
+{
+	return _records;
+}
+
+/**
+ * Write records into @a out as a JSON object with a list of phases.
+ */
+void Profiler::writeJson(std::ostream& out) const
+{
+	out << "{\n\t\"phases\": [";
+	for (std::size_t i = 0; i < _records.size(); ++i)
+	{
+		const auto& r = _records[i];
+		out << (i ? "," : "") << "\n\t\t{ \"name\": ";
+		writeJsonString(out, r.name);
+		out << ", \"level\": " << r.level
+			<< ", \"wall_time\": " << r.wallTime
+			<< ", \"cpu_time\": " << r.cpuTime
+			<< ", \"peak_memory_growth\": " << r.peakMemoryGrowth;
+		if (isCountingAllocations())
+		{
+			out << ", \"allocations\": " << r.allocations;
+		}
+		out << ", \"before\": ";
+		writeJsonSizes(out, r.sizesBefore);
+		out << ", \"after\": ";
+		writeJsonSizes(out, r.sizesAfter);
+		out << " }";
+	}
+	out << "\n\t]\n}\n";
+}
+
+/**
+ * Write records into file @a path as JSON.
+ * @return @c true if the file was written, @c false otherwise.
+ */
+bool Profiler::writeJsonFile(const std::string& path) const
+{
+	std::ofstream out(path);
+	if (!out)
+	{
+		return false;
+	}
+
+	writeJson(out);
+	return out.good();
+}
+
+/**
+ * Get CPU time consumed by all threads of the process (in seconds).
+ */
+double Profiler::getCpuTime()
+{
+#ifdef OS_WINDOWS
+	FILETIME creation, exit, kernel, user;
+	if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+	{
+		return 0.0;
+	}
+	auto toSeconds = [](const FILETIME& t) {
+		ULARGE_INTEGER i;
+		i.LowPart = t.dwLowDateTime;
+		i.HighPart = t.dwHighDateTime;
+		return i.QuadPart / 1e7; // 100-nanosecond intervals
+	};
+	return toSeconds(kernel) + toSeconds(user);
+#else
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+	{
+		return 0.0;
+	}
+	auto toSeconds = [](const struct timeval& t) {
+		return t.tv_sec + t.tv_usec / 1e6;
+	};
+	return toSeconds(usage.ru_utime) + toSeconds(usage.ru_stime);
+#endif
+}
+
+/**
+ * Get the number of heap allocations done while some profiler existed.
+ */
+std::size_t Profiler::getAllocationCount()
+{
+	return allocationCount.load(std::memory_order_relaxed);
+}
+
+/**
+ * Tell profilers that heap allocations are counted. It is called by the
+ * allocation hook when the program starts.
+ */
+void Profiler::enableAllocationCounting()
+{
+	allocationHook = true;
+}
+
+/**
+ * Are heap allocations counted (i.e. is the allocation hook linked into the
+ * program)?
+ */
+bool Profiler::isCountingAllocations()
+{
+	return allocationHook;
+}
+
+/**
+ * Count one heap allocation if some profiler exists. It is called by the
+ * allocation hook, so programs without profiling pay just for one relaxed
+ * load.
+ */
+void Profiler::recordAllocation() noexcept
+{
+	if (profilerCount.load(std::memory_order_relaxed) != 0)
+	{
+		allocationCount.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+} // namespace utils
+} // namespace retdec
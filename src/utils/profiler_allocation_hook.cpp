@@ -0,0 +1,66 @@
+/**
+ * @file src/utils/profiler_allocation_hook.cpp
+ * @brief Replacement of the global allocation function for @c Profiler.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ *
+ * This file is not a part of retdec-utils. It is built as the object library
+ * @c retdec-utils-allocation-hook, which is linked only into tools that want
+ * @c Profiler to count heap allocations. Replacing the allocator of every
+ * program linking retdec-utils would be a surprise for their authors.
+ */
+
+#include <cstdlib>
+#include <new>
+
+#include "retdec/utils/profiler.h"
+
+namespace {
+
+/// Tells profilers that this hook is linked into the program.
+const bool hookInstalled =
+	(retdec::utils::Profiler::enableAllocationCounting(), true);
+
+} // anonymous namespace
+
+/**
+ * Replacement of the global allocation function counting allocations. The
+ * other forms of @c operator @c new (array, nothrow) call this one.
+ */
+void* operator new(std::size_t size)
+{
+	retdec::utils::Profiler::recordAllocation();
+
+	if (size == 0)
+	{
+		size = 1;
+	}
+	while (true)
+	{
+		if (void* p = std::malloc(size))
+		{
+			return p;
+		}
+		auto handler = std::get_new_handler();
+		if (handler == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+		handler();
+	}
+}
+
+/**
+ * Deallocation function matching the replaced @c operator @c new.
+ */
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+/**
+ * Sized deallocation function matching the replaced @c operator @c new.
+ */
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
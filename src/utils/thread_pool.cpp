@@ -0,0 +1,233 @@
+/**
+ * @file src/utils/thread_pool.cpp
+ * @brief Pool of threads running independent tasks in parallel.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+
+#include "retdec/utils/thread_pool.h"
+
+namespace retdec {
+namespace utils {
+
+namespace {
+
+/// Is the current thread running a task of some pool?
+thread_local bool insideTask = false;
+
+} // anonymous namespace
+
+/**
+ * Constructor.
+ * @param threadCount Number of threads running tasks, including the thread
+ *                    calling @c parallelFor(). If it is @c 0,
+ *                    @c getDefaultThreadCount() is used.
+ */
+ThreadPool::ThreadPool(std::size_t threadCount)
+{
+	if (threadCount == 0)
+	{
+		threadCount = getDefaultThreadCount();
+	}
+
+	for (std::size_t i = 0; i < threadCount; ++i)
+	{
+		_queues.push_back(std::make_unique<Queue>());
+	}
+	for (std::size_t i = 1; i < threadCount; ++i)
+	{
+		_threads.emplace_back(&ThreadPool::workerLoop, this, i);
+	}
+}
+
+/**
+ * Destructor. Waits for all threads to finish.
+ */
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stop = true;
+	}
+	_wakeUp.notify_all();
+
+	for (auto& t : _threads)
+	{
+		t.join();
+	}
+}
+
+/**
+ * Get the number of threads running tasks, including the calling thread.
+ */
+std::size_t ThreadPool::getThreadCount() const
+{
+	return _queues.size();
+}
+
+/**
+ * Get the number of threads the hardware can run at once (at least @c 1).
+ */
+std::size_t ThreadPool::getDefaultThreadCount()
+{
+	return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+ * Run @a task for all indexes from @c 0 to @a count - 1 and wait until all of
+ * them finish. Tasks may run in any order and in parallel.
+ *
+ * If some task throws an exception, the remaining tasks are still run and the
+ * first thrown exception is rethrown after all of them finish.
+ */
+void ThreadPool::parallelFor(std::size_t count,
+	const std::function<void(std::size_t)>& task)
+{
+	if (count == 0)
+	{
+		return;
+	}
+	if (_threads.empty() || count == 1 || insideTask)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			task(i);
+		}
+		return;
+	}
+
+	std::lock_guard<std::mutex> batchLock(_batchMutex);
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_task = &task;
+		_error = nullptr;
+		_pending = count;
+	}
+
+	// Every thread gets a contiguous range of tasks.
+	const auto queueCount = _queues.size();
+	for (std::size_t q = 0; q < queueCount; ++q)
+	{
+		auto& queue = *_queues[q];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		for (std::size_t i = q * count / queueCount,
+				e = (q + 1) * count / queueCount; i < e; ++i)
+		{
+			queue.tasks.push_back(i);
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		++_batch;
+	}
+	_wakeUp.notify_all();
+
+	runTasks(0);
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	_done.wait(lock, [this]() { return _pending == 0; });
+	_task = nullptr;
+	if (_error)
+	{
+		auto error = _error;
+		_error = nullptr;
+		std::rethrow_exception(error);
+	}
+}
+
+/**
+ * Body of thread @a id: runs tasks of every new batch.
+ */
+void ThreadPool::workerLoop(std::size_t id)
+{
+	std::size_t lastBatch = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_wakeUp.wait(lock, [&]() { return _stop || _batch != lastBatch; });
+			if (_stop)
+			{
+				return;
+			}
+			lastBatch = _batch;
+		}
+
+		runTasks(id);
+	}
+}
+
+/**
+ * Run tasks of thread @a id and then tasks stolen from other threads until
+ * there are none left.
+ */
+void ThreadPool::runTasks(std::size_t id)
+{
+	const auto wasInsideTask = insideTask;
+	insideTask = true;
+
+	std::size_t task = 0;
+	while (popTask(id, task))
+	{
+		try
+		{
+			(*_task)(task);
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (!_error)
+			{
+				_error = std::current_exception();
+			}
+		}
+
+		if (--_pending == 0)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_done.notify_all();
+		}
+	}
+
+	insideTask = wasInsideTask;
+}
+
+/**
+ * Take the next task for thread @a id: from the front of its own queue or
+ * from the back of a queue of another thread.
+ * @return @c true if a task was stored into @a task, @c false if there are no
+ *         tasks left.
+ */
+bool ThreadPool::popTask(std::size_t id, std::size_t& task)
+{
+	{
+		auto& queue = *_queues[id];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.tasks.empty())
+		{
+			task = queue.tasks.front();
+			queue.tasks.pop_front();
+			return true;
+		}
+	}
+
+	for (std::size_t i = 1; i < _queues.size(); ++i)
+	{
+		auto& queue = *_queues[(id + i) % _queues.size()];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.tasks.empty())
+		{
+			task = queue.tasks.back();
+			queue.tasks.pop_back();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+} // namespace utils
+} // namespace retdec
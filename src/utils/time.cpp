@@ -4,6 +4,7 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <ctime>
 #include <iomanip>
 #include <limits>
 #include <sstream>
@@ -49,14 +50,32 @@ std::string getTime(const std::tm *cTime) {
 	return time.str();
 }
 
+/**
+* @brief Converts @a timestamp into local time stored in @a result.
+*
+* Unlike std::localtime(), it does not use a buffer shared by all threads.
+*
+* @return Pointer to @a result or @c nullptr if the conversion failed.
+*/
+std::tm *toLocalTime(std::time_t timestamp, std::tm &result) {
+#ifdef OS_WINDOWS
+	return localtime_s(&result, &timestamp) == 0 ? &result : nullptr;
+#else
+	return localtime_r(&timestamp, &result);
+#endif
+}
+
 } // anonymous namespace
 
 /**
 * @brief Returns the current timestamp.
+*
+* The returned structure belongs to the calling thread and it is overwritten
+* by the next call from the same thread.
 */
 std::tm *getCurrentTimestamp() {
-	auto now = std::time(nullptr);
-	return std::localtime(&now);
+	static thread_local std::tm now;
+	return toLocalTime(std::time(nullptr), now);
 }
 
 /**
@@ -78,7 +97,7 @@ std::string getCurrentTime() {
 */
 std::string getCurrentYear() {
 	auto now = getCurrentTimestamp();
-	return std::to_string(now->tm_year + 1900);
+	return now ? std::to_string(now->tm_year + 1900) : "";
 }
 
 /**
@@ -107,7 +126,8 @@ std::string timestampToDate(std::tm *tm) {
 * @param timestamp Timestamp for conversion.
 */
 std::string timestampToDate(std::time_t timestamp) {
-	return timestampToDate(std::localtime(&timestamp));
+	std::tm tm;
+	return timestampToDate(toLocalTime(timestamp, tm));
 }
 
 /**
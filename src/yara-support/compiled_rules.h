@@ -0,0 +1,35 @@
+/**
+ * @file src/yara-support/compiled_rules.h
+ * @brief Owner of rules compiled by libyara.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#ifndef YARA_SUPPORT_COMPILED_RULES_H
+#define YARA_SUPPORT_COMPILED_RULES_H
+
+#include <yara.h>
+
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace yara_support {
+
+/**
+ * Compiled YARA rules. Scanning of the same rules from several threads at
+ * once is supported by libyara.
+ */
+class CompiledRules : private retdec::utils::NonCopyable
+{
+	public:
+		explicit CompiledRules(YR_RULES *yrRules) : rules(yrRules) {}
+		~CompiledRules() { yr_rules_destroy(rules); }
+
+		YR_RULES* get() const { return rules; }
+	private:
+		YR_RULES *rules; ///< rules owned by this object
+};
+
+} // namespace yara_support
+} // namespace retdec
+
+#endif
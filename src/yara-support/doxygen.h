@@ -0,0 +1,12 @@
+/**
+ * @file src/yara-support/doxygen.h
+ * @brief Doxygen documentation of the retdec::yara_support namespace.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+// As there is no better place to comment this namespace, we do this in the
+// present file.
+
+/// @file src/yara-support/doxygen.h
+/// @namespace retdec::yara_support A library for detection of YARA rules with
+///            compiled rules shared by all detectors.
@@ -0,0 +1,342 @@
+/**
+ * @file src/yara-support/rules_cache.cpp
+ * @brief Process-wide cache of compiled YARA rules.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+#include <sys/stat.h>
+
+#include "retdec/crypto/crypto.h"
+#include "retdec/utils/filesystem_path.h"
+#include "retdec/utils/os.h"
+#include "retdec/yara-support/rules_cache.h"
+#include "yara-support/compiled_rules.h"
+
+using namespace retdec::utils;
+
+namespace retdec {
+namespace yara_support {
+
+namespace {
+
+/**
+ * Load precompiled rules
+ * @param path Path to file with precompiled rules
+ * @return Loaded rules or @c nullptr if @a path is not a valid precompiled file
+ */
+std::shared_ptr<const CompiledRules> loadPrecompiledRules(const std::string &path)
+{
+	YR_RULES *rules = nullptr;
+	if(yr_rules_load(path.c_str(), &rules) != ERROR_SUCCESS || !rules)
+	{
+		return nullptr;
+	}
+
+	return std::make_shared<const CompiledRules>(rules);
+}
+
+/**
+ * Compile text rules
+ * @param files Files with text rules to compile into one set
+ * @return Compiled rules or @c nullptr if compilation failed
+ */
+std::shared_ptr<const CompiledRules> compileRules(const std::vector<RuleFile> &files)
+{
+	YR_COMPILER *compiler = nullptr;
+	if(yr_compiler_create(&compiler) != ERROR_SUCCESS)
+	{
+		return nullptr;
+	}
+
+	auto errors = 0;
+	for(const auto &ruleFile : files)
+	{
+		auto *file = std::fopen(ruleFile.path.c_str(), "r");
+		if(!file)
+		{
+			errors = 1;
+			break;
+		}
+
+		const auto *nameSpace = ruleFile.nameSpace.empty() ? nullptr : ruleFile.nameSpace.c_str();
+		errors = yr_compiler_add_file(compiler, file, nameSpace, ruleFile.path.c_str());
+		std::fclose(file);
+		if(errors)
+		{
+			break;
+		}
+	}
+
+	YR_RULES *rules = nullptr;
+	if(errors || yr_compiler_get_rules(compiler, &rules) != ERROR_SUCCESS)
+	{
+		rules = nullptr;
+	}
+	yr_compiler_destroy(compiler);
+
+	return rules ? std::make_shared<const CompiledRules>(rules) : nullptr;
+}
+
+/**
+ * Store precompiled rules into file
+ * @param rules Rules to store
+ * @param path Path to target file
+ *
+ * Rules are written into temporary file which is then renamed, so that other
+ * processes sharing the cache never load partially written file.
+ */
+void savePrecompiledRules(const CompiledRules &rules, const std::string &path)
+{
+	const auto tmpPath = path + ".tmp" + std::to_string(std::random_device()());
+	if(yr_rules_save(rules.get(), tmpPath.c_str()) != ERROR_SUCCESS
+			|| std::rename(tmpPath.c_str(), path.c_str()) != 0)
+	{
+		std::remove(tmpPath.c_str());
+	}
+}
+
+} // anonymous namespace
+
+/**
+ * Compare two versions of file
+ */
+bool RulesCache::FileStamp::operator==(const FileStamp &o) const
+{
+	return mtime == o.mtime && size == o.size;
+}
+
+/**
+ * Constructor
+ */
+RulesCache::RulesCache()
+{
+	yr_initialize();
+}
+
+/**
+ * Destructor
+ */
+RulesCache::~RulesCache()
+{
+	entries.clear();
+	yr_finalize();
+}
+
+/**
+ * Get the cache shared by the whole process
+ */
+RulesCache& RulesCache::getInstance()
+{
+	static RulesCache instance;
+	return instance;
+}
+
+/**
+ * Set directory for precompiled versions of text rules
+ * @param dir Path to existing directory. Empty string disables on-disk cache.
+ */
+void RulesCache::setCacheDirectory(const std::string &dir)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	cacheDir = dir;
+}
+
+/**
+ * Get directory for precompiled versions of text rules
+ * @return Path to directory or empty string if on-disk cache is disabled
+ */
+std::string RulesCache::getCacheDirectory() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return cacheDir;
+}
+
+/**
+ * Get compiled rules from file
+ * @param path Path to file with text or precompiled rules
+ * @return Compiled rules or @c nullptr if file cannot be loaded or compiled
+ *
+ * Rules are compiled only when they are requested for the first time or when
+ * the file was changed since then.
+ */
+std::shared_ptr<const CompiledRules> RulesCache::getRules(const std::string &path)
+{
+	return getRules(std::vector<RuleFile>{{path, ""}});
+}
+
+/**
+ * Get rules compiled from several files into one set
+ * @param files Files with rules. If there are more of them, all of them must
+ *    contain text rules. Precompiled rules cannot be merged with other rules.
+ * @return Compiled rules or @c nullptr if any of files cannot be compiled
+ *
+ * Set is compiled only when it is requested for the first time or when any
+ * of its files was changed since then.
+ */
+std::shared_ptr<const CompiledRules> RulesCache::getRules(const std::vector<RuleFile> &files)
+{
+	std::string key;
+	std::vector<FileStamp> stamps(files.size());
+	for(std::size_t i = 0, e = files.size(); i < e; ++i)
+	{
+		if(!getFileStamp(files[i].path, stamps[i]))
+		{
+			return nullptr;
+		}
+
+		key += files[i].nameSpace + '\n' + files[i].path + '\n';
+	}
+
+	std::string dir;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		auto it = entries.find(key);
+		if(it != entries.end() && it->second.stamps == stamps)
+		{
+			return it->second.rules;
+		}
+		dir = cacheDir;
+	}
+
+	// Rules are compiled without holding the lock, so that threads loading
+	// different rules do not wait for each other.
+	auto rules = loadRules(files, stamps, dir);
+	if(rules)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		entries[key] = {stamps, rules};
+	}
+	return rules;
+}
+
+/**
+ * Drop all rules from cache. Rules which are still used by detectors stay
+ * valid until they are released.
+ */
+void RulesCache::clear()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	entries.clear();
+}
+
+/**
+ * Check if file contains precompiled rules
+ * @param path Path to file
+ * @return @c true if file starts with signature of precompiled rules
+ */
+bool RulesCache::isPrecompiled(const std::string &path)
+{
+	char signature[4] = {};
+	auto *file = std::fopen(path.c_str(), "rb");
+	if(!file)
+	{
+		return false;
+	}
+
+	const auto read = std::fread(signature, 1, sizeof(signature), file);
+	std::fclose(file);
+	return read == sizeof(signature) && std::equal(signature, signature + sizeof(signature), "YARA");
+}
+
+/**
+ * Get version of file
+ * @param path Path to file
+ * @param stamp Into this parameter is stored version of file
+ * @return @c true if file exists, @c false otherwise
+ */
+bool RulesCache::getFileStamp(const std::string &path, FileStamp &stamp)
+{
+#ifdef OS_WINDOWS
+	struct _stat64 fileStat;
+	if(_stat64(path.c_str(), &fileStat) != 0)
+#else
+	struct stat fileStat;
+	if(stat(path.c_str(), &fileStat) != 0)
+#endif
+	{
+		return false;
+	}
+
+	stamp.mtime = fileStat.st_mtime;
+	stamp.size = fileStat.st_size;
+	return true;
+}
+
+/**
+ * Get path to precompiled version of text rules in on-disk cache
+ * @param files Files with text rules
+ * @param stamps Versions of files with text rules
+ * @param dir Directory of on-disk cache
+ * @return Path in cache or empty string if on-disk cache is disabled
+ */
+std::string RulesCache::getCachedFilePath(
+		const std::vector<RuleFile> &files,
+		const std::vector<FileStamp> &stamps,
+		const std::string &dir)
+{
+	if(dir.empty())
+	{
+		return {};
+	}
+
+	std::string key;
+	for(std::size_t i = 0, e = files.size(); i < e; ++i)
+	{
+		key += files[i].nameSpace + '\n'
+			+ FilesystemPath(files[i].path).getAbsolutePath() + '\n'
+			+ std::to_string(stamps[i].mtime) + '\n'
+			+ std::to_string(stamps[i].size) + '\n';
+	}
+
+	FilesystemPath cachedPath(dir);
+	cachedPath.append(retdec::crypto::getSha256(
+			reinterpret_cast<const unsigned char*>(key.data()), key.size()) + ".yarac");
+	return cachedPath.getPath();
+}
+
+/**
+ * Load or compile rules from files
+ * @param files Files with text rules or one file with precompiled rules
+ * @param stamps Versions of files
+ * @param dir Directory of on-disk cache (empty if it is disabled)
+ * @return Compiled rules or @c nullptr in case of error
+ */
+std::shared_ptr<const CompiledRules> RulesCache::loadRules(
+		const std::vector<RuleFile> &files,
+		const std::vector<FileStamp> &stamps,
+		const std::string &dir)
+{
+	if(files.empty())
+	{
+		return nullptr;
+	}
+
+	if(files.size() == 1 && isPrecompiled(files[0].path))
+	{
+		return loadPrecompiledRules(files[0].path);
+	}
+
+	const auto cachedPath = getCachedFilePath(files, stamps, dir);
+	if(!cachedPath.empty())
+	{
+		auto rules = loadPrecompiledRules(cachedPath);
+		if(rules)
+		{
+			return rules;
+		}
+	}
+
+	auto rules = compileRules(files);
+	if(rules && !cachedPath.empty())
+	{
+		savePrecompiledRules(*rules, cachedPath);
+	}
+	return rules;
+}
+
+} // namespace yara_support
+} // namespace retdec
@@ -0,0 +1,255 @@
+/**
+ * @file src/yara-support/yara_detector.cpp
+ * @brief Detection of YARA rules in files and memory buffers.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include "retdec/utils/filesystem_path.h"
+#include "retdec/utils/memory_mapped_file.h"
+#include "retdec/yara-support/yara_detector.h"
+#include "yara-support/compiled_rules.h"
+
+using namespace retdec::utils;
+
+namespace retdec {
+namespace yara_support {
+
+namespace {
+
+/**
+ * Results of one scan
+ */
+struct ScanResults
+{
+	bool storeAllRules;                     ///< store also unmatched rules
+	const std::string &nameSpace;           ///< namespace forced to rules
+	std::vector<YaraRule> &detectedRules;   ///< matched rules
+	std::vector<YaraRule> &undetectedRules; ///< unmatched rules
+};
+
+/**
+ * Convert rule reported by libyara
+ * @param rule Rule reported by libyara
+ * @param nameSpace Namespace set to rule instead of its own (if not empty)
+ * @return Converted rule with all its metas and matches
+ */
+YaraRule createRule(YR_RULE *rule, const std::string &nameSpace)
+{
+	YaraRule result;
+	result.setName(rule->identifier);
+	if(!nameSpace.empty())
+	{
+		result.setNamespace(nameSpace);
+	}
+	else if(rule->ns && rule->ns->name)
+	{
+		result.setNamespace(rule->ns->name);
+	}
+
+	YR_META *meta;
+	yr_rule_metas_foreach(rule, meta)
+	{
+		YaraMeta resultMeta;
+		resultMeta.setId(meta->identifier);
+		if(meta->type == META_TYPE_STRING)
+		{
+			resultMeta.setType(YaraMeta::Type::String);
+			resultMeta.setStringValue(meta->string);
+		}
+		else
+		{
+			resultMeta.setType(YaraMeta::Type::Int);
+			resultMeta.setIntValue(meta->integer);
+		}
+		result.addMeta(resultMeta);
+	}
+
+	YR_STRING *string;
+	yr_rule_strings_foreach(rule, string)
+	{
+		YR_MATCH *match;
+		yr_string_matches_foreach(string, match)
+		{
+			YaraMatch resultMatch;
+			resultMatch.setOffset(match->base + match->offset);
+			resultMatch.setDataSize(match->data_length);
+			result.addMatch(resultMatch);
+		}
+	}
+
+	return result;
+}
+
+/**
+ * Callback invoked by libyara during scanning
+ */
+int scanCallback(int message, void *messageData, void *userData)
+{
+	auto *results = static_cast<ScanResults*>(userData);
+	auto *rule = static_cast<YR_RULE*>(messageData);
+
+	if(message == CALLBACK_MSG_RULE_MATCHING)
+	{
+		results->detectedRules.push_back(createRule(rule, results->nameSpace));
+	}
+	else if(message == CALLBACK_MSG_RULE_NOT_MATCHING && results->storeAllRules)
+	{
+		results->undetectedRules.push_back(createRule(rule, results->nameSpace));
+	}
+
+	return CALLBACK_CONTINUE;
+}
+
+} // anonymous namespace
+
+/**
+ * Add file with rules
+ * @param pathToFile Path to file with text or precompiled rules
+ * @param nameSpace Namespace of rules from file (empty for default one)
+ * @return @c true if file can be used, @c false otherwise
+ *
+ * Text rules are compiled together with all other text rules of detector
+ * before the first scan.
+ */
+bool YaraDetector::addRuleFile(const std::string &pathToFile, const std::string &nameSpace)
+{
+	if(!RulesCache::isPrecompiled(pathToFile))
+	{
+		if(!FilesystemPath(pathToFile).isFile())
+		{
+			return false;
+		}
+
+		textRuleFiles.push_back({pathToFile, nameSpace});
+		textRules.clear();
+		return true;
+	}
+
+	auto fileRules = RulesCache::getInstance().getRules(pathToFile);
+	if(!fileRules)
+	{
+		return false;
+	}
+
+	precompiledRules.push_back({std::move(fileRules), nameSpace});
+	return true;
+}
+
+/**
+ * Scan input file
+ * @param pathToInputFile Path to input file
+ * @param storeAllRules If @c true, store also rules which were not matched
+ * @return @c true if scanning was successful, @c false otherwise
+ */
+bool YaraDetector::analyze(const std::string &pathToInputFile, bool storeAllRules)
+{
+	MemoryMappedFile file(pathToInputFile);
+	if(!file.isOpen())
+	{
+		stateIsValid = false;
+		return false;
+	}
+
+	return analyze(file.getData(), file.getSize(), storeAllRules);
+}
+
+/**
+ * Scan memory buffer
+ * @param data Start of buffer
+ * @param size Size of buffer
+ * @param storeAllRules If @c true, store also rules which were not matched
+ * @return @c true if scanning was successful, @c false otherwise
+ *
+ * Offsets of matches are relative to @a data.
+ */
+bool YaraDetector::analyze(const std::uint8_t *data, std::size_t size, bool storeAllRules)
+{
+	detectedRules.clear();
+	undetectedRules.clear();
+	if(!prepareTextRules())
+	{
+		stateIsValid = false;
+	}
+
+	for(const auto *sets : {&precompiledRules, &textRules})
+	{
+		for(const auto &ruleSet : *sets)
+		{
+			ScanResults results{storeAllRules, ruleSet.nameSpace, detectedRules, undetectedRules};
+			if(yr_rules_scan_mem(ruleSet.rules->get(), data, size, 0, scanCallback, &results, 0) != ERROR_SUCCESS)
+			{
+				stateIsValid = false;
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Compile text rule files into one set
+ * @return @c false if some files could not be compiled, @c true otherwise
+ *
+ * If files cannot be compiled together, each of them is compiled separately
+ * and files with errors are skipped.
+ */
+bool YaraDetector::prepareTextRules()
+{
+	if(!textRules.empty() || textRuleFiles.empty())
+	{
+		return true;
+	}
+
+	auto &cache = RulesCache::getInstance();
+	auto merged = cache.getRules(textRuleFiles);
+	if(merged)
+	{
+		textRules.push_back({std::move(merged), ""});
+		return true;
+	}
+
+	auto result = true;
+	for(const auto &ruleFile : textRuleFiles)
+	{
+		auto fileRules = cache.getRules(std::vector<RuleFile>{ruleFile});
+		if(fileRules)
+		{
+			textRules.push_back({std::move(fileRules), ""});
+		}
+		else
+		{
+			result = false;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * Get rules matched by last scan
+ */
+const std::vector<YaraRule>& YaraDetector::getDetectedRules() const
+{
+	return detectedRules;
+}
+
+/**
+ * Get rules not matched by last scan. They are stored only if scan was
+ * requested with @c storeAllRules.
+ */
+const std::vector<YaraRule>& YaraDetector::getUndetectedRules() const
+{
+	return undetectedRules;
+}
+
+/**
+ * Check if all rules were loaded and all scans were successful
+ */
+bool YaraDetector::isInValidState() const
+{
+	return stateIsValid;
+}
+
+} // namespace yara_support
+} // namespace retdec
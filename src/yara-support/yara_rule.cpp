@@ -0,0 +1,248 @@
+/**
+ * @file src/yara-support/yara_rule.cpp
+ * @brief Representation of YARA rules, their metas and matches.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include "retdec/yara-support/yara_rule.h"
+
+namespace retdec {
+namespace yara_support {
+
+/**
+ * Get name of meta
+ * @return Name of meta
+ */
+const std::string& YaraMeta::getId() const
+{
+	return id;
+}
+
+/**
+ * Get type of meta value
+ * @return Type of meta value
+ */
+YaraMeta::Type YaraMeta::getType() const
+{
+	return type;
+}
+
+/**
+ * Get string value of meta
+ * @return String value (empty for integral metas)
+ */
+const std::string& YaraMeta::getStringValue() const
+{
+	return strValue;
+}
+
+/**
+ * Get integral value of meta
+ * @return Integral value (zero for string metas)
+ */
+std::uint64_t YaraMeta::getIntValue() const
+{
+	return intValue;
+}
+
+/**
+ * Set name of meta
+ * @param metaId Name of meta
+ */
+void YaraMeta::setId(const std::string &metaId)
+{
+	id = metaId;
+}
+
+/**
+ * Set type of meta value
+ * @param metaType Type of meta value
+ */
+void YaraMeta::setType(YaraMeta::Type metaType)
+{
+	type = metaType;
+}
+
+/**
+ * Set string value of meta
+ * @param value String value
+ */
+void YaraMeta::setStringValue(const std::string &value)
+{
+	strValue = value;
+}
+
+/**
+ * Set integral value of meta
+ * @param value Integral value
+ */
+void YaraMeta::setIntValue(std::uint64_t value)
+{
+	intValue = value;
+}
+
+/**
+ * Get offset of match
+ * @return Offset of match in the scanned data
+ */
+std::uint64_t YaraMatch::getOffset() const
+{
+	return offset;
+}
+
+/**
+ * Get size of matched data
+ * @return Size of matched data
+ */
+std::size_t YaraMatch::getDataSize() const
+{
+	return dataSize;
+}
+
+/**
+ * Set offset of match
+ * @param matchOffset Offset of match in the scanned data
+ */
+void YaraMatch::setOffset(std::uint64_t matchOffset)
+{
+	offset = matchOffset;
+}
+
+/**
+ * Set size of matched data
+ * @param matchDataSize Size of matched data
+ */
+void YaraMatch::setDataSize(std::size_t matchDataSize)
+{
+	dataSize = matchDataSize;
+}
+
+/**
+ * Get name of rule
+ * @return Name of rule
+ */
+const std::string& YaraRule::getName() const
+{
+	return name;
+}
+
+/**
+ * Get namespace of rule
+ * @return Namespace of rule
+ */
+const std::string& YaraRule::getNamespace() const
+{
+	return nameSpace;
+}
+
+/**
+ * Get meta with selected name
+ * @param id Name of meta
+ * @return Pointer to meta or @c nullptr if rule has no such meta
+ */
+const YaraMeta* YaraRule::getMeta(const std::string &id) const
+{
+	for(const auto &meta : metas)
+	{
+		if(meta.getId() == id)
+		{
+			return &meta;
+		}
+	}
+
+	return nullptr;
+}
+
+/**
+ * Get selected match
+ * @param index Index of match (indexed from 0)
+ * @return Pointer to match or @c nullptr if @a index is out of range
+ */
+const YaraMatch* YaraRule::getMatch(std::size_t index) const
+{
+	return index < matches.size() ? &matches[index] : nullptr;
+}
+
+/**
+ * Get first match
+ * @return Pointer to first match or @c nullptr if rule has no match
+ */
+const YaraMatch* YaraRule::getFirstMatch() const
+{
+	return getMatch(0);
+}
+
+/**
+ * Get all metas
+ * @return All metas of rule
+ */
+const std::vector<YaraMeta>& YaraRule::getMetas() const
+{
+	return metas;
+}
+
+/**
+ * Get all matches
+ * @return All matches of rule
+ */
+const std::vector<YaraMatch>& YaraRule::getMatches() const
+{
+	return matches;
+}
+
+/**
+ * Get number of metas
+ * @return Number of metas
+ */
+std::size_t YaraRule::getNumberOfMetas() const
+{
+	return metas.size();
+}
+
+/**
+ * Get number of matches
+ * @return Number of matches
+ */
+std::size_t YaraRule::getNumberOfMatches() const
+{
+	return matches.size();
+}
+
+/**
+ * Set name of rule
+ * @param ruleName Name of rule
+ */
+void YaraRule::setName(const std::string &ruleName)
+{
+	name = ruleName;
+}
+
+/**
+ * Set namespace of rule
+ * @param ruleNamespace Namespace of rule
+ */
+void YaraRule::setNamespace(const std::string &ruleNamespace)
+{
+	nameSpace = ruleNamespace;
+}
+
+/**
+ * Add meta
+ * @param meta Meta to add
+ */
+void YaraRule::addMeta(const YaraMeta &meta)
+{
+	metas.push_back(meta);
+}
+
+/**
+ * Add match
+ * @param match Match to add
+ */
+void YaraRule::addMatch(const YaraMatch &match)
+{
+	matches.push_back(match);
+}
+
+} // namespace yara_support
+} // namespace retdec
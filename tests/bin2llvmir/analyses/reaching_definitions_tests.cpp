@@ -44,6 +44,38 @@ DummyTest)
 	EXPECT_EQ( nullptr, module->getGlobalVariable("glob1") );
 }
 
+TEST_F(ReachingDefinitionsTests,
+definitionsAreFoundInAllFunctions)
+{
+	parseInput(R"(
+		@glob0 = global i32 0
+		define void @func1() {
+			store i32 1, i32* @glob0
+			%x = load i32, i32* @glob0
+			ret void
+		}
+		define void @func2() {
+			store i32 2, i32* @glob0
+			br label %next
+		next:
+			%y = load i32, i32* @glob0
+			ret void
+		}
+		declare void @func3()
+	)");
+	auto* s1 = getNthInstruction<StoreInst>();
+	auto* l1 = getNthInstruction<LoadInst>();
+	auto* s2 = getNthInstruction<StoreInst>(1);
+	auto* l2 = getNthInstruction<LoadInst>(1);
+
+	RDA.runOnModule(*module);
+
+	ASSERT_EQ(1, RDA.defsFromUse(l1).size());
+	EXPECT_EQ(s1, (*RDA.defsFromUse(l1).begin())->def);
+	ASSERT_EQ(1, RDA.defsFromUse(l2).size());
+	EXPECT_EQ(s2, (*RDA.defsFromUse(l2).begin())->def);
+}
+
 } // namespace tests
 } // namespace bin2llvmir
 } // namespace retdec
@@ -0,0 +1,135 @@
+/**
+* @file tests/bin2llvmir/optimizations/llvm_fixpoint/tests/llvm_fixpoint_tests.cpp
+* @brief Tests for the @c LlvmFixpoint pass.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/bin2llvmir/optimizations/llvm_fixpoint/llvm_fixpoint.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c LlvmFixpoint pass.
+ */
+class LlvmFixpointTests: public LlvmIrTests
+{
+	protected:
+		/**
+		 * Run @c LlvmFixpoint with @a passes and return the number of
+		 * iterations it did.
+		 */
+		unsigned runFixpoint(
+				const std::vector<std::string>& passes,
+				unsigned maxIterations)
+		{
+			initializeLlvmPassRegistry();
+
+			legacy::PassManager passManager;
+			auto* pass = new LlvmFixpoint(passes, maxIterations);
+			passManager.add(pass);
+			passManager.run(*module);
+			return pass->getIterationCount();
+		}
+};
+
+TEST_F(LlvmFixpointTests, defaultPassesOptimizeFunctions)
+{
+	parseInput(R"(
+		define i32 @fnc() {
+			%a = alloca i32
+			store i32 1, i32* %a
+			%b = load i32, i32* %a
+			%c = add i32 %b, 2
+			ret i32 %c
+		}
+	)");
+
+	runOnModule<LlvmFixpoint>();
+
+	std::string exp = R"(
+		define i32 @fnc() {
+			ret i32 3
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+}
+
+TEST_F(LlvmFixpointTests, iterationsStopWhenNothingChanges)
+{
+	parseInput(R"(
+		define i32 @fnc() {
+			%a = add i32 1, 2
+			ret i32 %a
+		}
+	)");
+
+	auto iterations = runFixpoint({"instcombine"}, 10);
+
+	std::string exp = R"(
+		define i32 @fnc() {
+			ret i32 3
+		}
+	)";
+	checkModuleAgainstExpectedIr(exp);
+	EXPECT_EQ(2, iterations);
+}
+
+TEST_F(LlvmFixpointTests, optimizedModuleIsRunOnlyOnce)
+{
+	parseInput(R"(
+		define i32 @fnc(i32 %arg) {
+			ret i32 %arg
+		}
+	)");
+
+	auto iterations = runFixpoint({"instcombine", "simplifycfg"}, 10);
+
+	EXPECT_EQ(1, iterations);
+}
+
+TEST_F(LlvmFixpointTests, callersOfChangedFunctionsAreOptimizedAgain)
+{
+	parseInput(R"(
+		define i32 @callee(i32 %a) nounwind {
+			%b = add i32 %a, 1
+			ret i32 %b
+		}
+		define void @caller() {
+			%a = call i32 @callee(i32 1)
+			ret void
+		}
+	)");
+
+	// -functionattrs makes @callee readnone only after -instcombine has
+	// already been run on @caller, so the unused call can be removed only
+	// if @caller is optimized again.
+	runFixpoint({"instcombine", "functionattrs"}, 10);
+
+	auto* caller = getFunctionByName("caller");
+	ASSERT_NE(nullptr, caller);
+	EXPECT_EQ(1, caller->getEntryBlock().size());
+}
+
+TEST_F(LlvmFixpointTests, iterationsAreLimited)
+{
+	parseInput(R"(
+		define i32 @fnc() {
+			%a = add i32 1, 2
+			ret i32 %a
+		}
+	)");
+
+	auto iterations = runFixpoint({"instcombine"}, 1);
+
+	EXPECT_EQ(1, iterations);
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
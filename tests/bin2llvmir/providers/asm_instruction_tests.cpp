@@ -357,6 +357,56 @@ TEST_F(AsmInstructionTests, AsmInstructionCtorAddressConstructsValidForGoodAddre
 	EXPECT_EQ(ref, a.getLlvmToAsmInstruction());
 }
 
+TEST_F(AsmInstructionTests, AsmInstructionCtorAddressFindsAddedSpecialInstruction)
+{
+	parseInput(R"(
+		define void @fnc() {
+			store volatile i64 1234, i64* @llvm2asm
+			%a = add i32 0, 1
+			ret void
+		}
+		@llvm2asm = global i64 0
+	)");
+	auto* mapGv = getGlobalByName("llvm2asm");
+	AsmInstruction::setLlvmToAsmGlobalVariable(module.get(), mapGv);
+	auto* a = getInstructionByName("a");
+	ASSERT_EQ(1234, AsmInstruction::getInstructionAddress(a));
+
+	auto* ref = new StoreInst(
+			ConstantInt::get(Type::getInt64Ty(context), 5678),
+			mapGv,
+			true,
+			a);
+	AsmInstruction::addLlvmToAsmInstruction(ref, nullptr);
+
+	EXPECT_EQ(ref, AsmInstruction(module.get(), 5678).getLlvmToAsmInstruction());
+	EXPECT_EQ(5678, AsmInstruction::getInstructionAddress(a));
+}
+
+TEST_F(AsmInstructionTests, AsmInstructionCtorInstructionFindsPreviousAfterSpecialInstructionErased)
+{
+	parseInput(R"(
+		define void @fnc() {
+			store volatile i64 1234, i64* @llvm2asm
+			br label %bb
+		bb:
+			store volatile i64 5678, i64* @llvm2asm
+			%a = add i32 0, 1
+			ret void
+		}
+		@llvm2asm = global i64 0
+	)");
+	auto* mapGv = getGlobalByName("llvm2asm");
+	AsmInstruction::setLlvmToAsmGlobalVariable(module.get(), mapGv);
+	auto* a = getInstructionByName("a");
+	ASSERT_EQ(5678, AsmInstruction::getInstructionAddress(a));
+
+	AsmInstruction(module.get(), 5678).getLlvmToAsmInstruction()->eraseFromParent();
+
+	EXPECT_TRUE(AsmInstruction(module.get(), 5678).isInvalid());
+	EXPECT_EQ(1234, AsmInstruction::getInstructionAddress(a));
+}
+
 //
 // AsmInstruction(llvm::Function*)
 //
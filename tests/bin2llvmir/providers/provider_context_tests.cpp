@@ -0,0 +1,74 @@
+/**
+* @file tests/bin2llvmir/providers/tests/provider_context_tests.cpp
+* @brief Tests for the @c ProviderContext.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c ProviderContext.
+ */
+class ProviderContextTests: public LlvmIrTests
+{
+
+};
+
+TEST_F(ProviderContextTests, providersCreateContextOnFirstUse)
+{
+	EXPECT_EQ(nullptr, ProviderContext::get(module.get()));
+
+	auto* c = ConfigProvider::addConfigJsonString(module.get(), "{}");
+
+	auto* ctx = ProviderContext::get(module.get());
+	ASSERT_NE(nullptr, ctx);
+	EXPECT_EQ(module.get(), ctx->getModule());
+	EXPECT_EQ(c, ctx->config.get());
+	EXPECT_EQ(c, ConfigProvider::getConfig(module.get()));
+}
+
+TEST_F(ProviderContextTests, explicitContextReleasesDataWhenDestroyed)
+{
+	{
+		ProviderContext ctx(module.get());
+		auto* c = ConfigProvider::addConfigJsonString(module.get(), "{}");
+
+		EXPECT_EQ(&ctx, ProviderContext::get(module.get()));
+		EXPECT_EQ(c, ctx.config.get());
+	}
+
+	EXPECT_EQ(nullptr, ProviderContext::get(module.get()));
+	EXPECT_EQ(nullptr, ConfigProvider::getConfig(module.get()));
+}
+
+TEST_F(ProviderContextTests, contextsOfDifferentModulesAreIndependent)
+{
+	Module other("other", context);
+	ProviderContext ctx1(module.get());
+	ProviderContext ctx2(&other);
+
+	auto* c1 = ConfigProvider::addConfigJsonString(module.get(), "{}");
+	auto* c2 = ConfigProvider::addConfigJsonString(&other, "{}");
+
+	EXPECT_NE(c1, c2);
+	EXPECT_EQ(c1, ConfigProvider::getConfig(module.get()));
+	EXPECT_EQ(c2, ConfigProvider::getConfig(&other));
+
+	ConfigProvider::clear();
+
+	EXPECT_EQ(nullptr, ConfigProvider::getConfig(module.get()));
+	EXPECT_EQ(nullptr, ConfigProvider::getConfig(&other));
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
@@ -27,6 +27,7 @@
 #include "retdec/bin2llvmir/providers/demangler.h"
 #include "retdec/bin2llvmir/providers/fileimage.h"
 #include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/debug.h"
 #include "retdec/utils/string.h"
 
@@ -59,6 +60,7 @@ class LlvmIrTests : public ::testing::Test
 			FileImageProvider::clear();
 			AsmInstruction::clear();
 			LtiProvider::clear();
+			ProviderContext::clear();
 		}
 
 		/**
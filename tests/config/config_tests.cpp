@@ -80,6 +80,94 @@ TEST_F(ConfigTests, ClassesGetElementByIdReturnsNullPointerWhenThereIsNoSuchClas
 	ASSERT_EQ(nullptr, config.classes.getElementById("ClassName"));
 }
 
+TEST_F(ConfigTests, ParsingJsonWithNonObjectRootThrowsAnException)
+{
+	ASSERT_THROW(config.readJsonString("[ 1, 2 ]"), ParseException);
+}
+
+TEST_F(ConfigTests, BadValueInJsonThrowsAnExceptionAndKeepsAllConfigData)
+{
+	config.setInputFile("/input/1");
+
+	ASSERT_THROW(config.readJsonString(R"({
+		"inputFile" : "/input/2",
+		"functions" : [ { "name" : "f", "startAddr" : 1 } ]
+	})"), ParseException);
+
+	EXPECT_EQ("/input/1", config.getInputFile());
+}
+
+TEST_F(ConfigTests, GenerateJsonFileReturnsEmptyStringWhenFileCannotBeWritten)
+{
+	EXPECT_EQ("", config.generateJsonFile("/non/existing/dir/config.json"));
+}
+
+TEST_F(ConfigTests, GeneratedJsonStringCanBeReadBack)
+{
+	config.setInputFile("/input/1");
+	config.setEntryPoint(0x1000);
+	config.setIsIda(true);
+	Function f("fnc");
+	f.setStart(0x1000);
+	f.setEnd(0x1010);
+	config.functions.insert(f);
+	config.globals.insert(Object("g", Storage::inMemory(0x2000)));
+
+	auto read = Config::fromJsonString(config.generateJsonString());
+
+	EXPECT_EQ("/input/1", read.getInputFile());
+	EXPECT_EQ(0x1000, read.getEntryPoint());
+	EXPECT_TRUE(read.isIda());
+	ASSERT_NE(nullptr, read.functions.getFunctionByStartAddress(0x1000));
+	EXPECT_EQ(0x1010, read.functions.getFunctionByName("fnc")->getEnd());
+	EXPECT_NE(nullptr, read.globals.getObjectByAddress(0x2000));
+}
+
+TEST_F(ConfigTests, GeneratedBinaryStringHasTheSameContentAsGeneratedJsonString)
+{
+	config.setInputFile("/input/1");
+	config.setImageBase(0x400000);
+	config.architecture.setName("x86");
+	config.architecture.setBitSize(32);
+	config.parameters.abiPaths.insert("/abi/path");
+	Function f("fnc");
+	f.setStart(0x1000);
+	f.setEnd(0x1010);
+	config.functions.insert(f);
+	config.registers.insert("eax");
+
+	auto read = Config::fromBinaryString(config.generateBinaryString());
+
+	EXPECT_EQ(config.generateJsonString(), read.generateJsonString());
+}
+
+TEST_F(ConfigTests, BinaryStringIsSmallerThanJsonString)
+{
+	for (unsigned i = 0; i < 100; ++i)
+	{
+		Function f("fnc" + std::to_string(i));
+		f.setStart(0x1000 + i * 0x10);
+		f.setEnd(0x1000 + i * 0x10 + 0x10);
+		config.functions.insert(f);
+	}
+
+	EXPECT_LT(
+		config.generateBinaryString().size(),
+		config.generateJsonString().size() / 2);
+}
+
+TEST_F(ConfigTests, ParsingBadBinaryInputThrowsAnExceptionAndKeepsAllConfigData)
+{
+	config.setInputFile("/input/1");
+	auto data = config.generateBinaryString();
+	data.resize(data.size() - 2);
+
+	ASSERT_THROW(config.readBinaryString(data), ParseException);
+	ASSERT_THROW(config.readBinaryString("not a binary config"), ParseException);
+
+	EXPECT_EQ("/input/1", config.getInputFile());
+}
+
 } // namespace tests
 } // namespace config
 } // namespace retdec
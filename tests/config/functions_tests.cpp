@@ -90,6 +90,75 @@ TEST_F(FunctionContainerTests, TestGetFunctionByStartAddress)
 	ASSERT_TRUE(n == nullptr);
 }
 
+TEST_F(FunctionContainerTests, TestGetFunctionByRealName)
+{
+	fnc2.setRealName("real");
+	funcs.insert(fnc2);
+
+	// found
+	auto* f = funcs.getFunctionByRealName("real");
+	ASSERT_TRUE(f != nullptr);
+	EXPECT_EQ( fnc2.getName(), f->getName() );
+
+	// not found
+	auto* n = funcs.getFunctionByRealName("non-existing-name");
+	ASSERT_TRUE(n == nullptr);
+}
+
+TEST_F(FunctionContainerTests, ReinsertedFunctionIsFoundOnlyByNewStartAddressAndRealName)
+{
+	fnc2.setStart(0x5000);
+	fnc2.setRealName("real");
+	funcs.insert(fnc2);
+
+	EXPECT_EQ( nullptr, funcs.getFunctionByStartAddress(0x2000) );
+	EXPECT_EQ( funcs.getFunctionByName("fnc2"), funcs.getFunctionByStartAddress(0x5000) );
+	EXPECT_NE( funcs.getFunctionByName("fnc2"), funcs.getFunctionByRealName("") );
+	EXPECT_EQ( funcs.getFunctionByName("fnc2"), funcs.getFunctionByRealName("real") );
+}
+
+TEST_F(FunctionContainerTests, ErasedFunctionIsNotFoundByStartAddress)
+{
+	funcs.erase(fnc3.getName());
+
+	EXPECT_EQ( nullptr, funcs.getFunctionByStartAddress(fnc3.getStart()) );
+}
+
+TEST_F(FunctionContainerTests, FunctionWithSmallestNameIsFoundWhenMoreFunctionsStartAtTheSameAddress)
+{
+	Function f("fnc0");
+	f.setStart(fnc3.getStart());
+	funcs.insert(f);
+
+	auto* r = funcs.getFunctionByStartAddress(fnc3.getStart());
+	ASSERT_TRUE(r != nullptr);
+	EXPECT_EQ( "fnc0", r->getName() );
+}
+
+TEST_F(FunctionContainerTests, CopiedContainerHasWorkingIndexes)
+{
+	FunctionContainer copy = funcs;
+	funcs.clear();
+
+	auto* f = copy.getFunctionByStartAddress(fnc4.getStart());
+	ASSERT_TRUE(f != nullptr);
+	EXPECT_EQ( fnc4.getName(), f->getName() );
+	EXPECT_EQ( nullptr, funcs.getFunctionByStartAddress(fnc4.getStart()) );
+}
+
+TEST_F(FunctionContainerTests, ReadingJsonUpdatesIndexes)
+{
+	Function f("other");
+	f.setStart(0x6000);
+	FunctionContainer other;
+	other.insert(f);
+
+	funcs.readJsonValue(other.getJsonValue());
+
+	EXPECT_EQ( nullptr, funcs.getFunctionByStartAddress(fnc1.getStart()) );
+	EXPECT_NE( nullptr, funcs.getFunctionByStartAddress(0x6000) );
+}
+
 } // namespace tests
 } // namespace config
 } // namespace retdec
@@ -109,6 +109,38 @@ TEST_F(GlobalVarContainerTests, WhenGlobalVarContainerIsCopyConstructedPointersI
 	EXPECT_EQ(copy.getObjectByName("g1"), copy.getObjectByAddress(0x1000));
 }
 
+TEST_F(GlobalVarContainerTests, GlobalVarErasedByNameIsNotFoundByAddress)
+{
+	globals.insert( Object("g1", Storage::inMemory(0x1000)) );
+
+	globals.erase(std::string("g1"));
+
+	EXPECT_TRUE(globals.empty());
+	EXPECT_EQ(nullptr, globals.getObjectByAddress(0x1000));
+}
+
+TEST_F(GlobalVarContainerTests, GlobalVarInsertedOnNewAddressIsNotFoundByOldAddress)
+{
+	globals.insert( Object("g1", Storage::inMemory(0x1000)) );
+
+	globals.insert( Object("g1", Storage::inMemory(0x2000)) );
+
+	EXPECT_EQ(nullptr, globals.getObjectByAddress(0x1000));
+	EXPECT_EQ(globals.getObjectByName("g1"), globals.getObjectByAddress(0x2000));
+}
+
+TEST_F(GlobalVarContainerTests, ReadingJsonUpdatesAddressToObjectContainer)
+{
+	globals.insert( Object("g1", Storage::inMemory(0x1000)) );
+	GlobalVarContainer other;
+	other.insert( Object("g2", Storage::inMemory(0x2000)) );
+
+	globals.readJsonValue(other.getJsonValue());
+
+	EXPECT_EQ(nullptr, globals.getObjectByAddress(0x1000));
+	EXPECT_EQ(globals.getObjectByName("g2"), globals.getObjectByAddress(0x2000));
+}
+
 //
 //=============================================================================
 //  RegisterContainer
@@ -131,6 +163,25 @@ TEST_F(RegisterContainerTests, registerContainerSimpleNameInsert)
 	EXPECT_EQ("reg", registers.getObjectByName("reg")->getStorage().getRegisterName());
 }
 
+TEST_F(RegisterContainerTests, registerIsFoundByRealName)
+{
+	auto r = Object("reg", Storage::inRegister("reg"));
+	r.setRealName("real");
+	registers.insert(r);
+
+	EXPECT_EQ(registers.getObjectByName("reg"), registers.getObjectByRealName("real"));
+	EXPECT_EQ(nullptr, registers.getObjectByRealName("reg"));
+}
+
+TEST_F(RegisterContainerTests, erasedRegisterIsNotFoundByRealName)
+{
+	registers.insert("reg");
+
+	registers.erase("reg");
+
+	EXPECT_EQ(nullptr, registers.getObjectByRealName("reg"));
+}
+
 } // namespace tests
 } // namespace config
 } // namespace retdec
@@ -0,0 +1,53 @@
+/**
+ * @file tests/config/segments_tests.cpp
+ * @brief Tests for the @c segments module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <gtest/gtest.h>
+
+#include "retdec/config/segments.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace config {
+namespace tests {
+
+class SegmentContainerTests : public Test
+{
+	public:
+		SegmentContainerTests() :
+			seg1(0x1000),
+			seg2(0x3000)
+		{
+			seg1.setEnd(0x2000);
+			segs.insert(seg1);
+
+			seg2.setEnd(0x4000);
+			segs.insert(seg2);
+		}
+
+	protected:
+		Segment seg1;
+		Segment seg2;
+		SegmentContainer segs;
+};
+
+TEST_F(SegmentContainerTests, SegmentContainingAddressIsFound)
+{
+	EXPECT_EQ(seg1.getStart(), segs.getSegmentContainingAddress(0x1000)->getStart());
+	EXPECT_EQ(seg1.getStart(), segs.getSegmentContainingAddress(0x1abc)->getStart());
+	EXPECT_EQ(seg2.getStart(), segs.getSegmentContainingAddress(0x3abc)->getStart());
+}
+
+TEST_F(SegmentContainerTests, NullptrIsReturnedForAddressOutsideSegments)
+{
+	EXPECT_EQ(nullptr, segs.getSegmentContainingAddress(0x500));
+	EXPECT_EQ(nullptr, segs.getSegmentContainingAddress(0x2800));
+	EXPECT_EQ(nullptr, segs.getSegmentContainingAddress(0x5000));
+}
+
+} // namespace tests
+} // namespace config
+} // namespace retdec
@@ -0,0 +1,173 @@
+/**
+* @file tests/cpdetect/search_tests.cpp
+* @brief Tests for the @c search module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/cpdetect/compiler_detector/search/search.h"
+#include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
+
+using namespace ::testing;
+using namespace retdec::fileformat;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace cpdetect {
+namespace tests {
+
+/**
+* @brief Tests for the @c search module.
+*
+* Input files are raw data, which are x86 little endian by default.
+*/
+class SearchTests: public Test {
+	protected:
+		RawDataFormat &createFormat(const std::vector<std::uint8_t> &bytes) {
+			input.str(std::string(bytes.begin(), bytes.end()));
+			format = std::make_unique<RawDataFormat>(input);
+			return *format;
+		}
+
+		Search &createSearch() {
+			search = std::make_unique<Search>(*format);
+			return *search;
+		}
+
+		Search &createSearch(const std::vector<std::uint8_t> &bytes) {
+			createFormat(bytes);
+			return createSearch();
+		}
+
+	private:
+		std::stringstream input;
+		std::unique_ptr<RawDataFormat> format;
+		std::unique_ptr<Search> search;
+};
+
+TEST_F(SearchTests,
+UnslashedSignatureIsFound) {
+	auto &search = createSearch({0x90, 0x55, 0x8B, 0xEC, 0x90});
+
+	EXPECT_EQ(6, search.findUnslashedSignature("558BEC", 0, 4));
+	EXPECT_EQ(6, search.findUnslashedSignature("558BEC;", 0, 4));
+	EXPECT_EQ(0, search.findUnslashedSignature("558BED", 0, 4));
+}
+
+TEST_F(SearchTests,
+UnslashedSignatureShiftedByNibbleIsFound) {
+	auto &search = createSearch({0x95, 0x58, 0xBE, 0xC0});
+
+	EXPECT_EQ(6, search.findUnslashedSignature("558BEC", 0, 3));
+}
+
+TEST_F(SearchTests,
+UnslashedSignatureWithWildcardsIsFound) {
+	auto &search = createSearch({0x90, 0x55, 0x8B, 0xEC, 0x90});
+
+	EXPECT_EQ(4, search.findUnslashedSignature("55??EC", 0, 4));
+	EXPECT_EQ(5, search.findUnslashedSignature("5-8BE?9", 0, 4));
+}
+
+TEST_F(SearchTests,
+UnslashedSignatureAtEdgesOfFileIsFound) {
+	auto &search = createSearch({0x55, 0x8B, 0xEC, 0xC3});
+
+	// area ends after the first nibble of its last byte, unless it reaches
+	// beyond the end of file
+	EXPECT_EQ(4, search.findUnslashedSignature("558B", 0, 3));
+	EXPECT_EQ(0, search.findUnslashedSignature("ECC3", 0, 3));
+	EXPECT_EQ(4, search.findUnslashedSignature("ECC3", 0, 4));
+	EXPECT_EQ(8, search.findUnslashedSignature("558BECC3", 0, 4));
+	EXPECT_EQ(0, search.findUnslashedSignature("C390", 0, 4));
+}
+
+TEST_F(SearchTests,
+UnslashedSignatureOutsideOfAreaIsNotFound) {
+	auto &search = createSearch({0x55, 0x8B, 0xEC, 0x90, 0x55, 0x8B});
+
+	EXPECT_EQ(0, search.findUnslashedSignature("558BEC", 1, 5));
+	EXPECT_EQ(0, search.findUnslashedSignature("558BEC", 0, 2));
+	EXPECT_EQ(6, search.findUnslashedSignature("558BEC", 0, 3));
+	EXPECT_EQ(0, search.findUnslashedSignature("558BEC", 3, 2));
+}
+
+TEST_F(SearchTests,
+SeveralUnslashedSignaturesAreFoundInOnePass) {
+	auto &search = createSearch({0x55, 0x8B, 0xEC, 0x90, 0xC3});
+
+	auto result = search.findUnslashedSignatures(
+		SignatureMatcher({"558BEC", "90C3", "C390", "8?EC9"}), 0, 5);
+
+	EXPECT_EQ(std::vector<unsigned long long>({6, 4, 0, 4}), result);
+}
+
+TEST_F(SearchTests,
+SlashedSignatureWithShortJumpIsFound) {
+	auto &search = createSearch({0x55, 0xEB, 0x02, 0x90, 0x90, 0xC3, 0x90});
+
+	// slash is counted as average length of jump patterns (2 nibbles)
+	EXPECT_EQ(6, search.findSlashedSignature("55/C3;", 0, 6));
+	EXPECT_EQ(0, search.findSlashedSignature("55/90;", 0, 6));
+}
+
+TEST_F(SearchTests,
+SlashedSignatureWithNearJumpIsFound) {
+	auto &search = createSearch({0x55, 0xE9, 0x01, 0x00, 0x00, 0x00, 0x90, 0xC3, 0x90});
+
+	EXPECT_EQ(6, search.findSlashedSignature("55/C3;", 0, 8));
+	EXPECT_EQ(6, search.exactComparison("55/C3;", 0));
+}
+
+TEST_F(SearchTests,
+SlashedSignatureWithoutJumpIsNotFound) {
+	auto &search = createSearch({0x55, 0x90, 0xC3, 0x90});
+
+	EXPECT_EQ(0, search.findSlashedSignature("55/C3;", 0, 3));
+}
+
+TEST_F(SearchTests,
+SeveralSlashedSignaturesAreFoundInTheirAreas) {
+	auto &search = createSearch({0x90, 0x55, 0xEB, 0x00, 0xC3, 0x55, 0xEB, 0x00, 0xCC, 0x90});
+
+	auto result = search.findSlashedSignatures(
+		SignatureMatcher({"55/C3;", "55/CC;", "55/CC;"}),
+		{{0, 9}, {0, 9}, {0, 4}});
+
+	EXPECT_EQ(std::vector<unsigned long long>({6, 6, 0}), result);
+}
+
+TEST_F(SearchTests,
+BigEndianFileIsSearchedInLittleEndianWords) {
+	auto &format = createFormat({0x44, 0x33, 0x22, 0x11, 0xEC, 0x8B, 0x55, 0x90, 0xFF});
+	format.setEndianness(Endianness::BIG);
+	auto &search = createSearch();
+
+	ASSERT_TRUE(search.isFileSupported());
+	EXPECT_EQ(8, search.findUnslashedSignature("11223344", 0, 8));
+	EXPECT_EQ(8, search.findUnslashedSignature("90558BEC", 0, 8));
+	// incomplete word at the end of file is ignored
+	EXPECT_EQ(0, search.findUnslashedSignature("FF", 0, 8));
+}
+
+TEST_F(SearchTests,
+NibblesAreTakenAccordingToSizeOfByte) {
+	auto &format = createFormat({0xAB, 0xCD});
+	format.setBytesLength(16);
+	auto &search = createSearch();
+
+	ASSERT_TRUE(search.isFileSupported());
+	EXPECT_EQ(4, search.findUnslashedSignature("00AB", 0, 1));
+	EXPECT_EQ(6, search.findUnslashedSignature("AB00CD", 0, 2));
+	EXPECT_EQ(0, search.findUnslashedSignature("ABCD", 0, 2));
+}
+
+} // namespace tests
+} // namespace cpdetect
+} // namespace retdec
@@ -0,0 +1,204 @@
+/**
+* @file tests/cpdetect/signature_matcher_tests.cpp
+* @brief Tests for the @c signature_matcher module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/cpdetect/compiler_detector/search/signature_matcher.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace cpdetect {
+namespace tests {
+
+/**
+* @brief Tests for the @c signature_matcher module.
+*
+* Candidates are verified by a straightforward nibble-by-nibble comparison,
+* where @c ? matches any nibble. Every call of the verifier is recorded.
+*/
+class SignatureMatcherTests: public Test {
+	protected:
+		std::vector<bool> search(
+				const SignatureMatcher &matcher,
+				const std::vector<std::uint8_t> &data,
+				std::size_t startNibble,
+				std::size_t stopNibble) {
+			return matcher.search(data.data(), data.size(), 2, startNibble, stopNibble,
+				[&] (std::size_t index, std::size_t nibbleOffset) {
+					verified.emplace_back(index, nibbleOffset);
+					return hasPattern(matcher.getPattern(index), data, nibbleOffset);
+				}
+			);
+		}
+
+		std::vector<bool> search(
+				const SignatureMatcher &matcher,
+				const std::vector<std::uint8_t> &data) {
+			return search(matcher, data, 0, 2 * data.size());
+		}
+
+		static bool hasPattern(
+				const std::string &pattern,
+				const std::vector<std::uint8_t> &data,
+				std::size_t nibbleOffset) {
+			if (nibbleOffset + pattern.length() > 2 * data.size()) {
+				return false;
+			}
+
+			for (std::size_t i = 0; i < pattern.length(); ++i) {
+				const auto pos = nibbleOffset + i;
+				const auto byte = data[pos / 2];
+				const auto nibble = "0123456789ABCDEF"[(pos % 2 ? byte : byte >> 4) & 0x0F];
+				if (pattern[i] != '?' && pattern[i] != nibble) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/// Pairs of index of pattern and nibble offset passed to verifier.
+		std::vector<std::pair<std::size_t, std::size_t>> verified;
+};
+
+TEST_F(SignatureMatcherTests,
+PatternStartingOnHighNibbleIsFound) {
+	SignatureMatcher matcher({"AABBCC"});
+
+	auto found = search(matcher, {0x00, 0xAA, 0xBB, 0xCC, 0x00});
+
+	EXPECT_EQ(std::vector<bool>({true}), found);
+	ASSERT_EQ(1, verified.size());
+	EXPECT_EQ(2, verified[0].second);
+}
+
+TEST_F(SignatureMatcherTests,
+PatternStartingOnLowNibbleIsFound) {
+	SignatureMatcher matcher({"ABBCCD"});
+
+	auto found = search(matcher, {0x0A, 0xBB, 0xCC, 0xD0});
+
+	EXPECT_EQ(std::vector<bool>({true}), found);
+	ASSERT_EQ(1, verified.size());
+	EXPECT_EQ(1, verified[0].second);
+}
+
+TEST_F(SignatureMatcherTests,
+PatternWithWildcardsIsFound) {
+	SignatureMatcher matcher({"??5?C3D4??"});
+
+	auto found = search(matcher, {0x12, 0x56, 0xC3, 0xD4, 0xFF});
+
+	EXPECT_EQ(std::vector<bool>({true}), found);
+}
+
+TEST_F(SignatureMatcherTests,
+PatternWithAnchorAfterWildcardsIsFoundAtStartOfData) {
+	SignatureMatcher matcher({"????C3D4"});
+
+	auto found = search(matcher, {0x12, 0x34, 0xC3, 0xD4});
+
+	EXPECT_EQ(std::vector<bool>({true}), found);
+	ASSERT_EQ(1, verified.size());
+	EXPECT_EQ(0, verified[0].second);
+}
+
+TEST_F(SignatureMatcherTests,
+PatternWithoutFixedByteIsVerifiedOnEveryNibble) {
+	SignatureMatcher matcher({"?E?F"});
+	std::vector<std::uint8_t> data = {0x11, 0x22, 0x3E, 0x4F};
+
+	auto found = search(matcher, data);
+
+	EXPECT_EQ(std::vector<bool>({true}), found);
+	EXPECT_EQ(5, verified.size());
+	EXPECT_EQ(4, verified.back().second);
+}
+
+TEST_F(SignatureMatcherTests,
+PatternAtEndOfDataIsFound) {
+	SignatureMatcher matcher({"EEFF"});
+
+	auto found = search(matcher, {0x00, 0x11, 0xEE, 0xFF});
+
+	EXPECT_EQ(std::vector<bool>({true}), found);
+}
+
+TEST_F(SignatureMatcherTests,
+PatternExceedingEndOfDataIsNotFound) {
+	SignatureMatcher matcher({"EEFF11"});
+
+	auto found = search(matcher, {0x00, 0x11, 0xEE, 0xFF});
+
+	EXPECT_EQ(std::vector<bool>({false}), found);
+}
+
+TEST_F(SignatureMatcherTests,
+SlashedPatternIsAnchoredByItsPrefix) {
+	SignatureMatcher matcher({"5589/E5;"});
+
+	auto found = search(matcher, {0x90, 0x55, 0x89, 0xEB, 0x00});
+
+	EXPECT_EQ(std::vector<bool>({false}), found);
+	ASSERT_EQ(1, verified.size());
+	EXPECT_EQ(2, verified[0].second);
+}
+
+TEST_F(SignatureMatcherTests,
+SeveralPatternsAreSearchedInOnePass) {
+	SignatureMatcher matcher({"1122", "3344", "5566", "2233"});
+
+	auto found = search(matcher, {0x11, 0x22, 0x33, 0x44});
+
+	EXPECT_EQ(std::vector<bool>({true, true, false, true}), found);
+}
+
+TEST_F(SignatureMatcherTests,
+CandidatesOutsideOfAreaAreNotVerified) {
+	SignatureMatcher matcher({"AABB"});
+	std::vector<std::uint8_t> data = {0xAA, 0xBB, 0x00, 0xAA, 0xBB, 0x00, 0xAA, 0xBB};
+
+	auto found = search(matcher, data, 1, 12);
+
+	EXPECT_EQ(std::vector<bool>({true}), found);
+	ASSERT_EQ(1, verified.size());
+	EXPECT_EQ(6, verified[0].second);
+}
+
+TEST_F(SignatureMatcherTests,
+FoundPatternIsNotVerifiedAgain) {
+	SignatureMatcher matcher({"AABB"});
+
+	auto found = search(matcher, {0xAA, 0xBB, 0xAA, 0xBB});
+
+	EXPECT_EQ(std::vector<bool>({true}), found);
+	EXPECT_EQ(1, verified.size());
+}
+
+TEST_F(SignatureMatcherTests,
+EveryNibbleIsCandidateIfByteHasOtherSizeThanTwoNibbles) {
+	SignatureMatcher matcher({"AABB"});
+	std::vector<std::uint8_t> data = {0x00, 0xAA, 0xBB};
+
+	auto found = matcher.search(data.data(), data.size(), 4, 0, 12,
+		[&] (std::size_t index, std::size_t nibbleOffset) {
+			verified.emplace_back(index, nibbleOffset);
+			return false;
+		}
+	);
+
+	EXPECT_EQ(std::vector<bool>({false}), found);
+	EXPECT_EQ(12, verified.size());
+}
+
+} // namespace tests
+} // namespace cpdetect
+} // namespace retdec
@@ -0,0 +1,101 @@
+/**
+* @file tests/crypto/multi_hash_tests.cpp
+* @brief Tests for the @c multi_hash module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/crypto/crypto.h"
+#include "retdec/crypto/multi_hash.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace crypto {
+namespace tests {
+
+/**
+* @brief Tests for the @c multi_hash module.
+*/
+class MultiHashTests: public Test {
+	protected:
+		static std::vector<std::uint8_t> makeData(std::size_t size) {
+			std::vector<std::uint8_t> data(size);
+			for (std::size_t i = 0; i < size; ++i) {
+				data[i] = static_cast<std::uint8_t>(i * 7 + (i >> 11));
+			}
+			return data;
+		}
+
+		static void expectSameAsSingleDigests(const std::vector<std::uint8_t> &data) {
+			auto digests = computeDigests(data.data(), data.size(),
+				DIGEST_CRC32 | DIGEST_MD5 | DIGEST_SHA256);
+
+			EXPECT_EQ(getCrc32(data.data(), data.size()), digests.crc32);
+			EXPECT_EQ(getMd5(data.data(), data.size()), digests.md5);
+			EXPECT_EQ(getSha256(data.data(), data.size()), digests.sha256);
+			EXPECT_TRUE(digests.sha1.empty());
+		}
+};
+
+TEST_F(MultiHashTests,
+DigestsOfEmptyInputAreSameAsSingleDigests) {
+	expectSameAsSingleDigests({});
+}
+
+TEST_F(MultiHashTests,
+DigestsOfEmptyInputAreCorrect) {
+	auto digests = computeDigests(nullptr, 0);
+
+	EXPECT_EQ("d41d8cd98f00b204e9800998ecf8427e", digests.md5);
+	EXPECT_EQ("da39a3ee5e6b4b0d3255bfef95601890afd80709", digests.sha1);
+	EXPECT_EQ("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", digests.sha256);
+}
+
+TEST_F(MultiHashTests,
+DigestsOfSmallInputAreSameAsSingleDigests) {
+	expectSameAsSingleDigests(makeData(100));
+}
+
+TEST_F(MultiHashTests,
+DigestsOfInputSpanningSeveralChunksAreSameAsSingleDigests) {
+	expectSameAsSingleDigests(makeData(1000001));
+}
+
+TEST_F(MultiHashTests,
+DigestsOfLargeInputAreSameAsSingleDigests) {
+	expectSameAsSingleDigests(makeData(16 * 1024 * 1024 + 3));
+}
+
+TEST_F(MultiHashTests,
+OnlyRequestedDigestsAreComputed) {
+	auto data = makeData(100);
+	auto digests = computeDigests(data.data(), data.size(), DIGEST_SHA1);
+
+	EXPECT_TRUE(digests.crc32.empty());
+	EXPECT_TRUE(digests.md5.empty());
+	EXPECT_EQ(getSha1(data.data(), data.size()), digests.sha1);
+	EXPECT_TRUE(digests.sha256.empty());
+}
+
+TEST_F(MultiHashTests,
+ContextFedInPartsGivesSameDigestsAsSingleDigests) {
+	auto data = makeData(5000);
+	MultiHashContext context(DIGEST_CRC32 | DIGEST_MD5 | DIGEST_SHA256);
+
+	ASSERT_TRUE(context.addData(data.data(), 1234));
+	ASSERT_TRUE(context.addData(data.data() + 1234, data.size() - 1234));
+	auto digests = context.getDigests();
+
+	EXPECT_EQ(getCrc32(data.data(), data.size()), digests.crc32);
+	EXPECT_EQ(getMd5(data.data(), data.size()), digests.md5);
+	EXPECT_EQ(getSha256(data.data(), data.size()), digests.sha256);
+}
+
+} // namespace tests
+} // namespace crypto
+} // namespace retdec
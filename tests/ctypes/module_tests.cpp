@@ -84,6 +84,24 @@ AddFunctionSuccessfullyAddsNewFunction)
 	EXPECT_TRUE(module.hasFunctionWithName(f->getName()));
 }
 
+TEST_F(ModuleTests,
+ModuleWithoutFunctionsHasNoFunctionsToIterateOver)
+{
+	EXPECT_EQ(0, module.getFunctionCount());
+	EXPECT_EQ(module.function_begin(), module.function_end());
+}
+
+TEST_F(ModuleTests,
+FunctionIteratorsIterateOverAddedFunctions)
+{
+	module.addFunction(f);
+
+	ASSERT_EQ(1, module.getFunctionCount());
+	EXPECT_EQ(f->getName(), module.function_begin()->first);
+	EXPECT_EQ(f, module.function_begin()->second);
+	EXPECT_EQ(module.function_end(), std::next(module.function_begin()));
+}
+
 TEST_F(ModuleTests,
 GetContextReturnsCorrectContext)
 {
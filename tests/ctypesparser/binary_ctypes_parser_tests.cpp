@@ -0,0 +1,348 @@
+/**
+* @file tests/ctypesparser/binary_ctypes_parser_tests.cpp
+* @brief Tests for the @c binary_ctypes_parser and @c binary_ctypes_writer
+*        modules.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "retdec/ctypes/annotation_in.h"
+#include "retdec/ctypes/annotation_optional.h"
+#include "retdec/ctypes/array_type.h"
+#include "retdec/ctypes/context.h"
+#include "retdec/ctypes/enum_type.h"
+#include "retdec/ctypes/floating_point_type.h"
+#include "retdec/ctypes/function.h"
+#include "retdec/ctypes/function_declaration.h"
+#include "retdec/ctypes/function_type.h"
+#include "retdec/ctypes/header_file.h"
+#include "retdec/ctypes/integral_type.h"
+#include "retdec/ctypes/member.h"
+#include "retdec/ctypes/module.h"
+#include "retdec/ctypes/parameter.h"
+#include "retdec/ctypes/pointer_type.h"
+#include "retdec/ctypes/struct_type.h"
+#include "retdec/ctypes/typedefed_type.h"
+#include "retdec/ctypes/union_type.h"
+#include "retdec/ctypes/unknown_type.h"
+#include "retdec/ctypes/void_type.h"
+#include "retdec/ctypesparser/binary_ctypes_parser.h"
+#include "retdec/ctypesparser/binary_ctypes_writer.h"
+#include "retdec/utils/binary_path.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace ctypesparser {
+namespace tests {
+
+class BinaryCTypesParserTests : public Test
+{
+	public:
+		BinaryCTypesParserTests():
+			context(std::make_shared<retdec::ctypes::Context>()),
+			module(std::make_unique<retdec::ctypes::Module>(context)),
+			intType(retdec::ctypes::IntegralType::create(context, "int", 0)),
+			parser(64) {}
+
+	protected:
+		/// Writes @c module into a database and parses it back.
+		std::unique_ptr<retdec::ctypes::Module> writeAndParse(
+			const CTypesParser::TypeWidths &typeWidths = {},
+			const retdec::ctypes::CallConvention &callConvention = {})
+		{
+			std::stringstream db;
+			writer.write(db, *module);
+			return parser.parse(db, typeWidths, callConvention);
+		}
+
+		void addFunction(
+			const std::string &name,
+			const std::shared_ptr<retdec::ctypes::Type> &returnType,
+			const retdec::ctypes::Function::Parameters &params = {},
+			const retdec::ctypes::CallConvention &callConvention = {})
+		{
+			module->addFunction(retdec::ctypes::Function::create(
+				context, name, returnType, params, callConvention));
+		}
+
+	protected:
+		std::shared_ptr<retdec::ctypes::Context> context;
+		std::unique_ptr<retdec::ctypes::Module> module;
+		std::shared_ptr<retdec::ctypes::Type> intType;
+		BinaryCTypesWriter writer;
+		BinaryCTypesParser parser;
+};
+
+TEST_F(BinaryCTypesParserTests,
+ParsingBadInputThrowsException)
+{
+	std::stringstream db("{ \"functions\": {} }");
+
+	ASSERT_THROW(parser.parse(db), CTypesParseError);
+}
+
+TEST_F(BinaryCTypesParserTests,
+ParsingTruncatedDatabaseThrowsException)
+{
+	addFunction("f", intType);
+	std::stringstream out;
+	writer.write(out, *module);
+	auto data = out.str();
+	std::stringstream db(data.substr(0, data.size() - 1));
+
+	ASSERT_THROW(parser.parse(db), CTypesParseError);
+}
+
+TEST_F(BinaryCTypesParserTests,
+WrittenEmptyModuleIsParsedAsEmptyModule)
+{
+	auto parsed = writeAndParse();
+
+	EXPECT_EQ(0, parsed->getFunctionCount());
+}
+
+TEST_F(BinaryCTypesParserTests,
+WrittenFunctionIsParsedWithAllItsAttributes)
+{
+	auto charPtr = retdec::ctypes::PointerType::create(context,
+		retdec::ctypes::IntegralType::create(context, "char", 8), 32);
+	retdec::ctypes::Parameter::Annotations annots{
+		retdec::ctypes::AnnotationIn::create(context, "_In_opt_"),
+		retdec::ctypes::AnnotationOptional::create(context, "_In_opt_")
+	};
+	auto f = retdec::ctypes::Function::create(context, "printf", intType,
+		{retdec::ctypes::Parameter("format", charPtr, annots)},
+		retdec::ctypes::CallConvention("cdecl"),
+		retdec::ctypes::FunctionType::VarArgness::IsVarArg);
+	f->setDeclaration(retdec::ctypes::FunctionDeclaration(
+		"int printf(const char *format, ...);"));
+	f->setHeaderFile(retdec::ctypes::HeaderFile("stdio.h"));
+	module->addFunction(f);
+
+	auto parsed = writeAndParse()->getFunctionWithName("printf");
+
+	ASSERT_TRUE(parsed);
+	EXPECT_EQ("printf", parsed->getName());
+	EXPECT_EQ("int", parsed->getReturnType()->getName());
+	EXPECT_EQ(retdec::ctypes::CallConvention("cdecl"), parsed->getCallConvention());
+	EXPECT_TRUE(parsed->isVarArg());
+	EXPECT_EQ("int printf(const char *format, ...);",
+		std::string(parsed->getDeclaration()));
+	EXPECT_EQ("stdio.h", parsed->getHeaderFile().getPath());
+	ASSERT_EQ(1, parsed->getParameterCount());
+	EXPECT_EQ("format", parsed->getParameterName(1));
+	auto paramType = parsed->getParameterType(1);
+	ASSERT_TRUE(paramType->isPointer());
+	EXPECT_EQ(32, paramType->getBitWidth());
+	auto pointedType = std::static_pointer_cast<retdec::ctypes::PointerType>(
+		paramType)->getPointedType();
+	EXPECT_EQ("char", pointedType->getName());
+	EXPECT_EQ(8, pointedType->getBitWidth());
+	EXPECT_TRUE(parsed->getParameter(1).isIn());
+	EXPECT_TRUE(parsed->getParameter(1).isOptional());
+	EXPECT_FALSE(parsed->getParameter(1).isOut());
+}
+
+TEST_F(BinaryCTypesParserTests,
+UnspecifiedBitWidthsAreResolvedWhenParsing)
+{
+	auto doubleType = retdec::ctypes::FloatingPointType::create(context, "double", 0);
+	auto uintType = retdec::ctypes::IntegralType::create(context, "unsigned int", 0,
+		retdec::ctypes::IntegralType::Signess::Unsigned);
+	auto ptrType = retdec::ctypes::PointerType::create(context, intType, 0);
+	addFunction("f", doubleType, {
+		retdec::ctypes::Parameter("a", uintType),
+		retdec::ctypes::Parameter("b", ptrType)
+	});
+
+	auto parsed = writeAndParse({{"int", 32}, {"double", 64}})->getFunctionWithName("f");
+
+	ASSERT_TRUE(parsed);
+	EXPECT_EQ(64, parsed->getReturnType()->getBitWidth());
+	auto paramA = parsed->getParameterType(1);
+	EXPECT_EQ(32, paramA->getBitWidth());
+	ASSERT_TRUE(paramA->isIntegral());
+	EXPECT_TRUE(std::static_pointer_cast<retdec::ctypes::IntegralType>(
+		paramA)->isUnsigned());
+	// Pointers without a bit width in typeWidths get the default bit width.
+	EXPECT_EQ(64, parsed->getParameterType(2)->getBitWidth());
+}
+
+TEST_F(BinaryCTypesParserTests,
+UnspecifiedCallConventionIsReplacedWithDefaultOne)
+{
+	addFunction("f", intType);
+	// Function types are shared by functions with the same return and parameter
+	// types, so g() needs a different return type to get a call convention.
+	addFunction("g", retdec::ctypes::VoidType::create(), {},
+		retdec::ctypes::CallConvention("fastcall"));
+
+	auto parsed = writeAndParse({}, retdec::ctypes::CallConvention("stdcall"));
+
+	EXPECT_EQ(retdec::ctypes::CallConvention("stdcall"),
+		parsed->getFunctionWithName("f")->getCallConvention());
+	EXPECT_EQ(retdec::ctypes::CallConvention("fastcall"),
+		parsed->getFunctionWithName("g")->getCallConvention());
+}
+
+TEST_F(BinaryCTypesParserTests,
+RecursiveStructIsParsedCorrectly)
+{
+	// struct node { struct node *next; };
+	auto node = retdec::ctypes::StructType::create(context, "node", {});
+	node->setMembers({retdec::ctypes::Member("next",
+		retdec::ctypes::PointerType::create(context, node, 32))});
+	addFunction("f", node);
+
+	auto parsed = writeAndParse()->getFunctionWithName("f");
+
+	ASSERT_TRUE(parsed);
+	auto parsedNode = std::static_pointer_cast<retdec::ctypes::StructType>(
+		parsed->getReturnType());
+	ASSERT_TRUE(parsedNode->isStruct());
+	ASSERT_EQ(1, parsedNode->getMemberCount());
+	EXPECT_EQ("next", parsedNode->getMemberName(1));
+	auto next = std::static_pointer_cast<retdec::ctypes::PointerType>(
+		parsedNode->getMemberType(1));
+	EXPECT_EQ(parsedNode, next->getPointedType());
+}
+
+TEST_F(BinaryCTypesParserTests,
+OtherTypesAreParsedCorrectly)
+{
+	auto enumType = retdec::ctypes::EnumType::create(context, "color",
+		{{"RED", 0}, {"BLUE", -1}});
+	auto unionType = retdec::ctypes::UnionType::create(context, "u",
+		{retdec::ctypes::Member("i", intType)});
+	auto arrayType = retdec::ctypes::ArrayType::create(context, intType,
+		{10, retdec::ctypes::ArrayType::UNKNOWN_DIMENSION});
+	auto typedefType = retdec::ctypes::TypedefedType::create(context, "INT", intType);
+	auto funcType = retdec::ctypes::FunctionType::create(context,
+		retdec::ctypes::VoidType::create(), {intType});
+	addFunction("f", typedefType, {
+		retdec::ctypes::Parameter("a", enumType),
+		retdec::ctypes::Parameter("b", unionType),
+		retdec::ctypes::Parameter("c", arrayType),
+		retdec::ctypes::Parameter("d", retdec::ctypes::PointerType::create(context, funcType)),
+		retdec::ctypes::Parameter("e", retdec::ctypes::UnknownType::create())
+	});
+
+	auto parsed = writeAndParse()->getFunctionWithName("f");
+
+	ASSERT_TRUE(parsed);
+	auto parsedTypedef = std::static_pointer_cast<retdec::ctypes::TypedefedType>(
+		parsed->getReturnType());
+	ASSERT_TRUE(parsedTypedef->isTypedef());
+	EXPECT_EQ("INT", parsedTypedef->getName());
+	EXPECT_EQ("int", parsedTypedef->getAliasedType()->getName());
+
+	auto parsedEnum = std::static_pointer_cast<retdec::ctypes::EnumType>(
+		parsed->getParameterType(1));
+	ASSERT_TRUE(parsedEnum->isEnum());
+	ASSERT_EQ(2, parsedEnum->getValueCount());
+	EXPECT_EQ("BLUE", parsedEnum->getValue(2).getName());
+	EXPECT_EQ(-1, parsedEnum->getValue(2).getValue());
+
+	auto parsedUnion = std::static_pointer_cast<retdec::ctypes::UnionType>(
+		parsed->getParameterType(2));
+	ASSERT_TRUE(parsedUnion->isUnion());
+	EXPECT_EQ("i", parsedUnion->getMemberName(1));
+
+	auto parsedArray = std::static_pointer_cast<retdec::ctypes::ArrayType>(
+		parsed->getParameterType(3));
+	ASSERT_TRUE(parsedArray->isArray());
+	EXPECT_EQ(arrayType->getDimensions(), parsedArray->getDimensions());
+
+	auto parsedPtr = std::static_pointer_cast<retdec::ctypes::PointerType>(
+		parsed->getParameterType(4));
+	ASSERT_TRUE(parsedPtr->getPointedType()->isFunction());
+	auto parsedFuncType = std::static_pointer_cast<retdec::ctypes::FunctionType>(
+		parsedPtr->getPointedType());
+	EXPECT_TRUE(parsedFuncType->getReturnType()->isVoid());
+	EXPECT_EQ(1, parsedFuncType->getParameterCount());
+
+	EXPECT_TRUE(parsed->getParameterType(5)->isUnknown());
+}
+
+TEST_F(BinaryCTypesParserTests,
+OpenedDatabaseParsesOnlyRequestedFunctions)
+{
+	addFunction("f", intType);
+	addFunction("g", intType);
+	auto path = retdec::utils::getThisBinaryDirectoryPath().getPath()
+		+ "/binary_ctypes_parser_tests.ctdb";
+	{
+		std::ofstream db(path, std::ios::binary);
+		writer.write(db, *module);
+	}
+	auto parsedContext = std::make_shared<retdec::ctypes::Context>();
+
+	ASSERT_TRUE(parser.open(path, parsedContext));
+	EXPECT_TRUE(parser.hasFunction("f"));
+	EXPECT_FALSE(parser.hasFunction("h"));
+	EXPECT_EQ(nullptr, parser.getFunction("h"));
+	auto f = parser.getFunction("f");
+	ASSERT_TRUE(f);
+	EXPECT_EQ("f", f->getName());
+	EXPECT_EQ(f, parsedContext->getFunctionWithName("f"));
+	EXPECT_FALSE(parsedContext->hasFunctionWithName("g"));
+
+	std::remove(path.c_str());
+}
+
+TEST_F(BinaryCTypesParserTests,
+OpeningFileThatIsNotDatabaseFails)
+{
+	auto path = retdec::utils::getThisBinaryPath().getPath();
+
+	EXPECT_FALSE(parser.open(path, context));
+	EXPECT_FALSE(parser.hasFunction("f"));
+}
+
+TEST_F(BinaryCTypesParserTests,
+OpenedDatabaseHasStampOfItsSource)
+{
+	binary_ctypes::SourceStamp source;
+	source.size = 123;
+	source.modificationTime = 456;
+	auto path = retdec::utils::getThisBinaryDirectoryPath().getPath()
+		+ "/binary_ctypes_parser_tests.ctdb";
+	{
+		std::ofstream db(path, std::ios::binary);
+		writer.write(db, *module, source);
+	}
+
+	ASSERT_TRUE(parser.open(path, context));
+	EXPECT_EQ(source, parser.getSourceStamp());
+
+	std::remove(path.c_str());
+}
+
+TEST_F(BinaryCTypesParserTests,
+SourceStampOfFileContainsItsSize)
+{
+	auto path = retdec::utils::getThisBinaryDirectoryPath().getPath()
+		+ "/binary_ctypes_parser_tests.json";
+	{
+		std::ofstream json(path);
+		json << "{ \"functions\": {} }";
+	}
+	binary_ctypes::SourceStamp stamp;
+
+	ASSERT_TRUE(binary_ctypes::readSourceStamp(path, stamp));
+	EXPECT_EQ(19, stamp.size);
+	EXPECT_NE(0, stamp.modificationTime);
+
+	std::remove(path.c_str());
+	EXPECT_FALSE(binary_ctypes::readSourceStamp(path, stamp));
+}
+
+} // namespace tests
+} // namespace ctypesparser
+} // namespace retdec
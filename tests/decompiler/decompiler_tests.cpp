@@ -0,0 +1,144 @@
+/**
+ * @file tests/decompiler/decompiler_tests.cpp
+ * @brief Tests for the @c decompiler module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "retdec/decompiler/decompiler.h"
+#include "retdec/utils/binary_path.h"
+
+using namespace ::testing;
+
+namespace {
+
+/**
+ * x86 ELF executable which writes "Hi World" to the standard output and exits.
+ */
+const unsigned char elfBytes[] =
+{
+
+0x7f, 0x45, 0x4c, 0x46, 0x01, 0x01, 0x01, 0x48, 0x69, 0x20, 0x57, 0x6f, 0x72, 0x6c, 0x64, 0x0a,
+0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x80, 0x04, 0x08, 0x34, 0x00, 0x00, 0x00,
+0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x20, 0x00, 0x02, 0x00, 0x28, 0x00,
+0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x08,
+0x00, 0x80, 0x04, 0x08, 0xa2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x90, 0x04, 0x08,
+0xa4, 0x90, 0x04, 0x08, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xba, 0x09, 0x00, 0x00, 0x00, 0xb9, 0x07, 0x90, 0x04, 0x08, 0xbb, 0x01, 0x00, 0x00, 0x00, 0xb8,
+0x04, 0x00, 0x00, 0x00, 0xcd, 0x80, 0xbb, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00,
+0xcd, 0x80, 0x00, 0x00
+
+};
+
+} // anonymous namespace
+
+namespace retdec {
+namespace decompiler {
+namespace tests {
+
+/**
+ * Smoke tests of the whole in-process pipeline.
+ */
+class DecompilerTests : public Test
+{
+	protected:
+		DecompilerTests() :
+			dir(retdec::utils::getThisBinaryDirectoryPath().getPath()),
+			inputFile(dir + "/decompiler_tests.elf")
+		{
+			std::ofstream input(inputFile, std::ios::binary);
+			input.write(reinterpret_cast<const char*>(elfBytes), sizeof(elfBytes));
+
+			config.setInputFile(inputFile);
+			config.setEntryPoint(0x8048080);
+			config.architecture.setIsX86();
+			config.architecture.setIsEndianLittle();
+			config.architecture.setBitSize(32);
+			config.fileType.setIsExecutable();
+			config.fileFormat.setIsElf32();
+
+			settings.outputFile = dir + "/decompiler_tests.c";
+		}
+
+		~DecompilerTests()
+		{
+			std::remove(inputFile.c_str());
+			std::remove(settings.outputFile.c_str());
+		}
+
+		static std::string readFile(const std::string& path)
+		{
+			std::ifstream file(path);
+			return std::string(
+				std::istreambuf_iterator<char>(file),
+				std::istreambuf_iterator<char>());
+		}
+
+		std::string dir;
+		std::string inputFile;
+		retdec::config::Config config;
+		Settings settings;
+};
+
+TEST_F(DecompilerTests,
+SmallExecutableIsDecompiledIntoC)
+{
+	Decompiler decompiler(config, settings);
+
+	ASSERT_TRUE(decompiler.run()) << decompiler.getErrorMessage();
+	EXPECT_NE(nullptr, decompiler.getFileFormat());
+	EXPECT_NE(nullptr, decompiler.getModule());
+	EXPECT_FALSE(readFile(settings.outputFile).empty());
+}
+
+TEST_F(DecompilerTests,
+StatisticsAreRecordedForAllStages)
+{
+	Decompiler decompiler(config, settings);
+
+	ASSERT_TRUE(decompiler.run()) << decompiler.getErrorMessage();
+	const auto& statistics = decompiler.getStatistics();
+	ASSERT_EQ(3, statistics.size());
+	EXPECT_EQ("fileformat", statistics[0].name);
+	EXPECT_EQ("bin2llvmir", statistics[1].name);
+	EXPECT_EQ("llvmir2hll", statistics[2].name);
+	for (const auto& stage : statistics)
+	{
+		EXPECT_LE(stage.peakMemoryGrowth, stage.processPeakMemory);
+	}
+}
+
+TEST_F(DecompilerTests,
+MissingInputFileStopsDecompilationInFirstStage)
+{
+	config.setInputFile(dir + "/decompiler_tests_nonexistent.elf");
+	Decompiler decompiler(config, settings);
+
+	EXPECT_FALSE(decompiler.run());
+	EXPECT_FALSE(decompiler.getErrorMessage().empty());
+	EXPECT_EQ(1, decompiler.getStatistics().size());
+}
+
+TEST_F(DecompilerTests,
+FailureToWriteOutputConfigStopsDecompilation)
+{
+	settings.outputConfigFile = dir + "/nonexistent/decompiler_tests.json";
+	Decompiler decompiler(config, settings);
+
+	EXPECT_FALSE(decompiler.run());
+	EXPECT_EQ("cannot write " + settings.outputConfigFile,
+		decompiler.getErrorMessage());
+	EXPECT_EQ(2, decompiler.getStatistics().size());
+}
+
+} // namespace tests
+} // namespace decompiler
+} // namespace retdec
@@ -0,0 +1,620 @@
+/**
+* @file tests/dwarfparser/dwarf_file_tests.cpp
+* @brief Tests for the @c dwarf_file module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/dwarfparser/dwarf_file.h"
+#include "retdec/fileformat/file_format/elf/elf_format.h"
+#include "retdec/utils/thread_pool.h"
+
+using namespace ::testing;
+using namespace retdec::fileformat;
+
+namespace {
+
+/*
+ * x86-64 ELF files with DWARF 2 information about three compilation units.
+ * They were created by
+ *
+ *   gcc -Os -gdwarf-2 -gstrict-dwarf -fno-asynchronous-unwind-tables \
+ *       -fno-pic -no-pie -nostdlib -static -Wl,--build-id=none -Wl,-N \
+ *       -o dw a.c b.c c.c
+ *   objcopy -R .debug_frame -R .comment -R .note.GNU-stack dw dw-aranges
+ *   objcopy -R .debug_aranges dw-aranges dw-no-aranges
+ *
+ * from the following sources:
+ *
+ *   // a.c, CU at [0x4000b0, 0x4000b9)
+ *   int a_var = 1;
+ *   int a_func(int x) { return x + a_var; }
+ *
+ *   // b.c, CU at [0x4000b9, 0x4000c0)
+ *   struct b_pair { int first; int second; };
+ *   int b_func(struct b_pair *p) { return p->first * p->second; }
+ *
+ *   // c.c, CU at [0x4000c0, 0x4000c6)
+ *   int c_func(int x) { return x - 1; }
+ *   void _start(void) { for (;;) ; }
+ */
+
+const unsigned char elfWithAranges[] =
+{
+
+0x7f, 0x45, 0x4c, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x3e, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x02, 0x00, 0x40, 0x00, 0x0b, 0x00, 0x0a, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xb0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xe5, 0x74, 0x64, 0x06, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x8b, 0x05, 0x12, 0x00, 0x00, 0x00, 0x01, 0xf8, 0xc3, 0x8b, 0x07, 0x0f, 0xaf, 0x47, 0x04, 0xc3,
+0x8d, 0x47, 0xff, 0xc3, 0xeb, 0xfe, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x40, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x40, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x13, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x40, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x61, 0x2e, 0x63,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x40,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00, 0x01, 0x01,
+0x05, 0x44, 0x00, 0x00, 0x00, 0x01, 0x09, 0x03, 0xc8, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x03, 0x04, 0x05, 0x69, 0x6e, 0x74, 0x00, 0x04, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0x02, 0x05,
+0x01, 0x44, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x40,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0x08, 0x05, 0x78, 0x00, 0x01, 0x02, 0x10, 0x44, 0x00,
+0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5c, 0x00, 0x00, 0x00,
+0x08, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x62, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9,
+0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41,
+0x00, 0x00, 0x00, 0x02, 0x8d, 0x00, 0x00, 0x00, 0x08, 0x01, 0x01, 0x08, 0x59, 0x00, 0x00, 0x00,
+0x03, 0x87, 0x00, 0x00, 0x00, 0x01, 0x01, 0x15, 0x59, 0x00, 0x00, 0x00, 0x02, 0x23, 0x00, 0x03,
+0x94, 0x00, 0x00, 0x00, 0x01, 0x01, 0x20, 0x59, 0x00, 0x00, 0x00, 0x02, 0x23, 0x04, 0x00, 0x04,
+0x04, 0x05, 0x69, 0x6e, 0x74, 0x00, 0x05, 0x01, 0x9b, 0x00, 0x00, 0x00, 0x01, 0x02, 0x05, 0x01,
+0x59, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x40, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0x08, 0x92, 0x00, 0x00, 0x00, 0x06, 0x70, 0x00, 0x01, 0x02,
+0x1b, 0x92, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x07, 0x08, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x80,
+0x00, 0x00, 0x00, 0x02, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x08, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x01,
+0x63, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xc6, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x02, 0x01, 0xa2, 0x00,
+0x00, 0x00, 0x01, 0x02, 0x06, 0x01, 0xc4, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00,
+0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0x08, 0x03, 0x01, 0xa9, 0x00, 0x00, 0x00, 0x01,
+0x01, 0x05, 0x01, 0x7c, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4,
+0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0x08, 0x7c, 0x00, 0x00, 0x00, 0x04, 0x78,
+0x00, 0x01, 0x01, 0x10, 0x7c, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x05, 0x04, 0x05, 0x69, 0x6e,
+0x74, 0x00, 0x00, 0x01, 0x11, 0x01, 0x25, 0x0e, 0x13, 0x0b, 0x03, 0x08, 0x1b, 0x0e, 0x11, 0x01,
+0x12, 0x01, 0x10, 0x06, 0x00, 0x00, 0x02, 0x34, 0x00, 0x03, 0x0e, 0x3a, 0x0b, 0x3b, 0x0b, 0x39,
+0x0b, 0x49, 0x13, 0x3f, 0x0c, 0x02, 0x0a, 0x00, 0x00, 0x03, 0x24, 0x00, 0x0b, 0x0b, 0x3e, 0x0b,
+0x03, 0x08, 0x00, 0x00, 0x04, 0x2e, 0x01, 0x3f, 0x0c, 0x03, 0x0e, 0x3a, 0x0b, 0x3b, 0x0b, 0x39,
+0x0b, 0x27, 0x0c, 0x49, 0x13, 0x11, 0x01, 0x12, 0x01, 0x40, 0x0a, 0x00, 0x00, 0x05, 0x05, 0x00,
+0x03, 0x08, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x49, 0x13, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x01,
+0x11, 0x01, 0x25, 0x0e, 0x13, 0x0b, 0x03, 0x08, 0x1b, 0x0e, 0x11, 0x01, 0x12, 0x01, 0x10, 0x06,
+0x00, 0x00, 0x02, 0x13, 0x01, 0x03, 0x0e, 0x0b, 0x0b, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x01,
+0x13, 0x00, 0x00, 0x03, 0x0d, 0x00, 0x03, 0x0e, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x49, 0x13,
+0x38, 0x0a, 0x00, 0x00, 0x04, 0x24, 0x00, 0x0b, 0x0b, 0x3e, 0x0b, 0x03, 0x08, 0x00, 0x00, 0x05,
+0x2e, 0x01, 0x3f, 0x0c, 0x03, 0x0e, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x27, 0x0c, 0x49, 0x13,
+0x11, 0x01, 0x12, 0x01, 0x40, 0x0a, 0x01, 0x13, 0x00, 0x00, 0x06, 0x05, 0x00, 0x03, 0x08, 0x3a,
+0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x49, 0x13, 0x02, 0x0a, 0x00, 0x00, 0x07, 0x0f, 0x00, 0x0b, 0x0b,
+0x49, 0x13, 0x00, 0x00, 0x00, 0x01, 0x11, 0x01, 0x25, 0x0e, 0x13, 0x0b, 0x03, 0x08, 0x1b, 0x0e,
+0x11, 0x01, 0x12, 0x01, 0x10, 0x06, 0x00, 0x00, 0x02, 0x2e, 0x00, 0x3f, 0x0c, 0x03, 0x0e, 0x3a,
+0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x27, 0x0c, 0x11, 0x01, 0x12, 0x01, 0x40, 0x0a, 0x00, 0x00, 0x03,
+0x2e, 0x01, 0x3f, 0x0c, 0x03, 0x0e, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x27, 0x0c, 0x49, 0x13,
+0x11, 0x01, 0x12, 0x01, 0x40, 0x0a, 0x01, 0x13, 0x00, 0x00, 0x04, 0x05, 0x00, 0x03, 0x08, 0x3a,
+0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x49, 0x13, 0x02, 0x0a, 0x00, 0x00, 0x05, 0x24, 0x00, 0x0b, 0x0b,
+0x3e, 0x0b, 0x03, 0x08, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x00,
+0x00, 0x01, 0x01, 0xfb, 0x0e, 0x0d, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+0x00, 0x01, 0x00, 0x61, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x13, 0x00, 0x09, 0x02,
+0xb0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x05, 0x15, 0x01, 0x05, 0x1e, 0x06, 0x01,
+0x05, 0x27, 0x82, 0x02, 0x01, 0x00, 0x01, 0x01, 0x3d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1a, 0x00,
+0x00, 0x00, 0x01, 0x01, 0xfb, 0x0e, 0x0d, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x01, 0x00, 0x62, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1e, 0x00, 0x09,
+0x02, 0xb9, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x05, 0x20, 0x01, 0x05, 0x30, 0x06,
+0x01, 0x05, 0x3d, 0x66, 0x02, 0x01, 0x00, 0x01, 0x01, 0x45, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1a,
+0x00, 0x00, 0x00, 0x01, 0x01, 0xfb, 0x0e, 0x0d, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x01, 0x00, 0x63, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x13, 0x00,
+0x09, 0x02, 0xc0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x15, 0x01, 0x05, 0x1e,
+0x06, 0x01, 0x05, 0x23, 0x3c, 0x05, 0x13, 0x06, 0x21, 0x05, 0x15, 0x01, 0x01, 0x02, 0x02, 0x00,
+0x01, 0x01, 0x2f, 0x74, 0x6d, 0x70, 0x2f, 0x64, 0x77, 0x00, 0x61, 0x5f, 0x76, 0x61, 0x72, 0x00,
+0x47, 0x4e, 0x55, 0x20, 0x43, 0x31, 0x37, 0x20, 0x31, 0x32, 0x2e, 0x32, 0x2e, 0x30, 0x20, 0x2d,
+0x6d, 0x74, 0x75, 0x6e, 0x65, 0x3d, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x69, 0x63, 0x20, 0x2d, 0x6d,
+0x61, 0x72, 0x63, 0x68, 0x3d, 0x78, 0x38, 0x36, 0x2d, 0x36, 0x34, 0x20, 0x2d, 0x67, 0x64, 0x77,
+0x61, 0x72, 0x66, 0x2d, 0x32, 0x20, 0x2d, 0x67, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x2d, 0x64,
+0x77, 0x61, 0x72, 0x66, 0x20, 0x2d, 0x4f, 0x73, 0x20, 0x2d, 0x66, 0x6e, 0x6f, 0x2d, 0x61, 0x73,
+0x79, 0x6e, 0x63, 0x68, 0x72, 0x6f, 0x6e, 0x6f, 0x75, 0x73, 0x2d, 0x75, 0x6e, 0x77, 0x69, 0x6e,
+0x64, 0x2d, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x2d, 0x66, 0x6e, 0x6f, 0x2d, 0x70, 0x69,
+0x63, 0x00, 0x61, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x00, 0x66, 0x69, 0x72, 0x73, 0x74, 0x00, 0x62,
+0x5f, 0x70, 0x61, 0x69, 0x72, 0x00, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x00, 0x62, 0x5f, 0x66,
+0x75, 0x6e, 0x63, 0x00, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x00, 0x63, 0x5f, 0x66, 0x75, 0x6e,
+0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0xf1, 0xff,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+0xc8, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x26, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xc4, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+0xc0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x1a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xb0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00,
+0xcc, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x2d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xb9, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00,
+0xcc, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x3b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0xd0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x2e, 0x63, 0x00, 0x62, 0x2e, 0x63,
+0x00, 0x63, 0x2e, 0x63, 0x00, 0x61, 0x5f, 0x76, 0x61, 0x72, 0x00, 0x63, 0x5f, 0x66, 0x75, 0x6e,
+0x63, 0x00, 0x61, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x00, 0x5f, 0x5f, 0x62, 0x73, 0x73, 0x5f, 0x73,
+0x74, 0x61, 0x72, 0x74, 0x00, 0x62, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x00, 0x5f, 0x65, 0x64, 0x61,
+0x74, 0x61, 0x00, 0x5f, 0x65, 0x6e, 0x64, 0x00, 0x00, 0x2e, 0x73, 0x79, 0x6d, 0x74, 0x61, 0x62,
+0x00, 0x2e, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x2e, 0x73, 0x68, 0x73, 0x74, 0x72, 0x74,
+0x61, 0x62, 0x00, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x00, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x00, 0x2e,
+0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x61, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x00, 0x2e, 0x64,
+0x65, 0x62, 0x75, 0x67, 0x5f, 0x69, 0x6e, 0x66, 0x6f, 0x00, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67,
+0x5f, 0x61, 0x62, 0x62, 0x72, 0x65, 0x76, 0x00, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x6c,
+0x69, 0x6e, 0x65, 0x00, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x73, 0x74, 0x72, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xb0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xc8, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x27, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x36, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x97, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x42, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x34, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x5c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+
+};
+
+const unsigned char elfWithoutAranges[] =
+{
+
+0x7f, 0x45, 0x4c, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x3e, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x02, 0x00, 0x40, 0x00, 0x0a, 0x00, 0x09, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xb0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xe5, 0x74, 0x64, 0x06, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x8b, 0x05, 0x12, 0x00, 0x00, 0x00, 0x01, 0xf8, 0xc3, 0x8b, 0x07, 0x0f, 0xaf, 0x47, 0x04, 0xc3,
+0x8d, 0x47, 0xff, 0xc3, 0xeb, 0xfe, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x61, 0x2e, 0x63,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x40,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00, 0x01, 0x01,
+0x05, 0x44, 0x00, 0x00, 0x00, 0x01, 0x09, 0x03, 0xc8, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x03, 0x04, 0x05, 0x69, 0x6e, 0x74, 0x00, 0x04, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0x02, 0x05,
+0x01, 0x44, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x40,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0x08, 0x05, 0x78, 0x00, 0x01, 0x02, 0x10, 0x44, 0x00,
+0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5c, 0x00, 0x00, 0x00,
+0x08, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x62, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9,
+0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41,
+0x00, 0x00, 0x00, 0x02, 0x8d, 0x00, 0x00, 0x00, 0x08, 0x01, 0x01, 0x08, 0x59, 0x00, 0x00, 0x00,
+0x03, 0x87, 0x00, 0x00, 0x00, 0x01, 0x01, 0x15, 0x59, 0x00, 0x00, 0x00, 0x02, 0x23, 0x00, 0x03,
+0x94, 0x00, 0x00, 0x00, 0x01, 0x01, 0x20, 0x59, 0x00, 0x00, 0x00, 0x02, 0x23, 0x04, 0x00, 0x04,
+0x04, 0x05, 0x69, 0x6e, 0x74, 0x00, 0x05, 0x01, 0x9b, 0x00, 0x00, 0x00, 0x01, 0x02, 0x05, 0x01,
+0x59, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x40, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0x08, 0x92, 0x00, 0x00, 0x00, 0x06, 0x70, 0x00, 0x01, 0x02,
+0x1b, 0x92, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x07, 0x08, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x80,
+0x00, 0x00, 0x00, 0x02, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x08, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x01,
+0x63, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xc6, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x02, 0x01, 0xa2, 0x00,
+0x00, 0x00, 0x01, 0x02, 0x06, 0x01, 0xc4, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x00,
+0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0x08, 0x03, 0x01, 0xa9, 0x00, 0x00, 0x00, 0x01,
+0x01, 0x05, 0x01, 0x7c, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4,
+0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x77, 0x08, 0x7c, 0x00, 0x00, 0x00, 0x04, 0x78,
+0x00, 0x01, 0x01, 0x10, 0x7c, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 0x05, 0x04, 0x05, 0x69, 0x6e,
+0x74, 0x00, 0x00, 0x01, 0x11, 0x01, 0x25, 0x0e, 0x13, 0x0b, 0x03, 0x08, 0x1b, 0x0e, 0x11, 0x01,
+0x12, 0x01, 0x10, 0x06, 0x00, 0x00, 0x02, 0x34, 0x00, 0x03, 0x0e, 0x3a, 0x0b, 0x3b, 0x0b, 0x39,
+0x0b, 0x49, 0x13, 0x3f, 0x0c, 0x02, 0x0a, 0x00, 0x00, 0x03, 0x24, 0x00, 0x0b, 0x0b, 0x3e, 0x0b,
+0x03, 0x08, 0x00, 0x00, 0x04, 0x2e, 0x01, 0x3f, 0x0c, 0x03, 0x0e, 0x3a, 0x0b, 0x3b, 0x0b, 0x39,
+0x0b, 0x27, 0x0c, 0x49, 0x13, 0x11, 0x01, 0x12, 0x01, 0x40, 0x0a, 0x00, 0x00, 0x05, 0x05, 0x00,
+0x03, 0x08, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x49, 0x13, 0x02, 0x0a, 0x00, 0x00, 0x00, 0x01,
+0x11, 0x01, 0x25, 0x0e, 0x13, 0x0b, 0x03, 0x08, 0x1b, 0x0e, 0x11, 0x01, 0x12, 0x01, 0x10, 0x06,
+0x00, 0x00, 0x02, 0x13, 0x01, 0x03, 0x0e, 0x0b, 0x0b, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x01,
+0x13, 0x00, 0x00, 0x03, 0x0d, 0x00, 0x03, 0x0e, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x49, 0x13,
+0x38, 0x0a, 0x00, 0x00, 0x04, 0x24, 0x00, 0x0b, 0x0b, 0x3e, 0x0b, 0x03, 0x08, 0x00, 0x00, 0x05,
+0x2e, 0x01, 0x3f, 0x0c, 0x03, 0x0e, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x27, 0x0c, 0x49, 0x13,
+0x11, 0x01, 0x12, 0x01, 0x40, 0x0a, 0x01, 0x13, 0x00, 0x00, 0x06, 0x05, 0x00, 0x03, 0x08, 0x3a,
+0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x49, 0x13, 0x02, 0x0a, 0x00, 0x00, 0x07, 0x0f, 0x00, 0x0b, 0x0b,
+0x49, 0x13, 0x00, 0x00, 0x00, 0x01, 0x11, 0x01, 0x25, 0x0e, 0x13, 0x0b, 0x03, 0x08, 0x1b, 0x0e,
+0x11, 0x01, 0x12, 0x01, 0x10, 0x06, 0x00, 0x00, 0x02, 0x2e, 0x00, 0x3f, 0x0c, 0x03, 0x0e, 0x3a,
+0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x27, 0x0c, 0x11, 0x01, 0x12, 0x01, 0x40, 0x0a, 0x00, 0x00, 0x03,
+0x2e, 0x01, 0x3f, 0x0c, 0x03, 0x0e, 0x3a, 0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x27, 0x0c, 0x49, 0x13,
+0x11, 0x01, 0x12, 0x01, 0x40, 0x0a, 0x01, 0x13, 0x00, 0x00, 0x04, 0x05, 0x00, 0x03, 0x08, 0x3a,
+0x0b, 0x3b, 0x0b, 0x39, 0x0b, 0x49, 0x13, 0x02, 0x0a, 0x00, 0x00, 0x05, 0x24, 0x00, 0x0b, 0x0b,
+0x3e, 0x0b, 0x03, 0x08, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x00,
+0x00, 0x01, 0x01, 0xfb, 0x0e, 0x0d, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+0x00, 0x01, 0x00, 0x61, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x13, 0x00, 0x09, 0x02,
+0xb0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x05, 0x15, 0x01, 0x05, 0x1e, 0x06, 0x01,
+0x05, 0x27, 0x82, 0x02, 0x01, 0x00, 0x01, 0x01, 0x3d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1a, 0x00,
+0x00, 0x00, 0x01, 0x01, 0xfb, 0x0e, 0x0d, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01,
+0x00, 0x00, 0x01, 0x00, 0x62, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1e, 0x00, 0x09,
+0x02, 0xb9, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x05, 0x20, 0x01, 0x05, 0x30, 0x06,
+0x01, 0x05, 0x3d, 0x66, 0x02, 0x01, 0x00, 0x01, 0x01, 0x45, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1a,
+0x00, 0x00, 0x00, 0x01, 0x01, 0xfb, 0x0e, 0x0d, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x01, 0x00, 0x63, 0x2e, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x13, 0x00,
+0x09, 0x02, 0xc0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x15, 0x01, 0x05, 0x1e,
+0x06, 0x01, 0x05, 0x23, 0x3c, 0x05, 0x13, 0x06, 0x21, 0x05, 0x15, 0x01, 0x01, 0x02, 0x02, 0x00,
+0x01, 0x01, 0x2f, 0x74, 0x6d, 0x70, 0x2f, 0x64, 0x77, 0x00, 0x61, 0x5f, 0x76, 0x61, 0x72, 0x00,
+0x47, 0x4e, 0x55, 0x20, 0x43, 0x31, 0x37, 0x20, 0x31, 0x32, 0x2e, 0x32, 0x2e, 0x30, 0x20, 0x2d,
+0x6d, 0x74, 0x75, 0x6e, 0x65, 0x3d, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x69, 0x63, 0x20, 0x2d, 0x6d,
+0x61, 0x72, 0x63, 0x68, 0x3d, 0x78, 0x38, 0x36, 0x2d, 0x36, 0x34, 0x20, 0x2d, 0x67, 0x64, 0x77,
+0x61, 0x72, 0x66, 0x2d, 0x32, 0x20, 0x2d, 0x67, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x2d, 0x64,
+0x77, 0x61, 0x72, 0x66, 0x20, 0x2d, 0x4f, 0x73, 0x20, 0x2d, 0x66, 0x6e, 0x6f, 0x2d, 0x61, 0x73,
+0x79, 0x6e, 0x63, 0x68, 0x72, 0x6f, 0x6e, 0x6f, 0x75, 0x73, 0x2d, 0x75, 0x6e, 0x77, 0x69, 0x6e,
+0x64, 0x2d, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x2d, 0x66, 0x6e, 0x6f, 0x2d, 0x70, 0x69,
+0x63, 0x00, 0x61, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x00, 0x66, 0x69, 0x72, 0x73, 0x74, 0x00, 0x62,
+0x5f, 0x70, 0x61, 0x69, 0x72, 0x00, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x00, 0x62, 0x5f, 0x66,
+0x75, 0x6e, 0x63, 0x00, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x00, 0x63, 0x5f, 0x66, 0x75, 0x6e,
+0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0xf1, 0xff,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0xf1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+0xc8, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x26, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xc4, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00,
+0xc0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x1a, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xb0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00,
+0xcc, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x2d, 0x00, 0x00, 0x00, 0x12, 0x00, 0x01, 0x00, 0xb9, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00,
+0xcc, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x3b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0xd0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x2e, 0x63, 0x00, 0x62, 0x2e, 0x63,
+0x00, 0x63, 0x2e, 0x63, 0x00, 0x61, 0x5f, 0x76, 0x61, 0x72, 0x00, 0x63, 0x5f, 0x66, 0x75, 0x6e,
+0x63, 0x00, 0x61, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x00, 0x5f, 0x5f, 0x62, 0x73, 0x73, 0x5f, 0x73,
+0x74, 0x61, 0x72, 0x74, 0x00, 0x62, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x00, 0x5f, 0x65, 0x64, 0x61,
+0x74, 0x61, 0x00, 0x5f, 0x65, 0x6e, 0x64, 0x00, 0x00, 0x2e, 0x73, 0x79, 0x6d, 0x74, 0x61, 0x62,
+0x00, 0x2e, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x2e, 0x73, 0x68, 0x73, 0x74, 0x72, 0x74,
+0x61, 0x62, 0x00, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x00, 0x2e, 0x64, 0x61, 0x74, 0x61, 0x00, 0x2e,
+0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x69, 0x6e, 0x66, 0x6f, 0x00, 0x2e, 0x64, 0x65, 0x62, 0x75,
+0x67, 0x5f, 0x61, 0x62, 0x62, 0x72, 0x65, 0x76, 0x00, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f,
+0x6c, 0x69, 0x6e, 0x65, 0x00, 0x2e, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5f, 0x73, 0x74, 0x72, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xb0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xc8, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x27, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x97, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x34, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x41, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x4d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+
+};
+
+const Dwarf_Addr A_FUNC = 0x4000b0;
+const Dwarf_Addr B_FUNC = 0x4000b9;
+const Dwarf_Addr C_FUNC = 0x4000c0;
+const Dwarf_Addr START = 0x4000c4;
+const Dwarf_Addr A_VAR = 0x4000c8;
+
+} // anonymous namespace
+
+namespace retdec {
+namespace dwarfparser {
+namespace tests {
+
+/**
+ * Tests for the @c dwarf_file module
+ */
+class DwarfFileTests : public Test
+{
+	protected:
+		/// Parse ELF file in @a bytes. The parser lives as long as the test.
+		template <std::size_t N>
+		ElfFormat *parse(const unsigned char (&bytes)[N])
+		{
+			elfStreams.emplace_back(new std::stringstream(
+				std::string(reinterpret_cast<const char*>(bytes), N)));
+			elfParsers.emplace_back(new ElfFormat(*elfStreams.back()));
+			return elfParsers.back().get();
+		}
+
+		static std::set<std::string> functionNames(DwarfFile &dwarf)
+		{
+			std::set<std::string> names;
+			for (const auto *f : *dwarf.getFunctions())
+			{
+				names.insert(f->name);
+			}
+			return names;
+		}
+
+		static std::set<std::string> typeNames(DwarfFile &dwarf)
+		{
+			std::set<std::string> names;
+			for (const auto *t : *dwarf.getTypes())
+			{
+				names.insert(t->getName());
+			}
+			return names;
+		}
+
+	private:
+		std::vector<std::unique_ptr<std::stringstream>> elfStreams;
+		std::vector<std::unique_ptr<ElfFormat>> elfParsers;
+};
+
+TEST_F(DwarfFileTests,
+LazyFileIndexesAllCUsWithoutLoadingThem)
+{
+	DwarfFile dwarf("", parse(elfWithAranges), true);
+
+	ASSERT_TRUE(dwarf.hasDwarfInfo());
+	EXPECT_EQ(3, dwarf.getCUCount());
+	EXPECT_EQ(0, dwarf.getLoadedCUCount());
+}
+
+TEST_F(DwarfFileTests,
+EagerFileLoadsAllCUs)
+{
+	DwarfFile dwarf("", parse(elfWithAranges));
+
+	ASSERT_TRUE(dwarf.hasDwarfInfo());
+	EXPECT_EQ(3, dwarf.getCUCount());
+	EXPECT_EQ(3, dwarf.getLoadedCUCount());
+	EXPECT_EQ(4, dwarf.getFunctions()->size());
+}
+
+TEST_F(DwarfFileTests,
+LoadCUsForAddressLoadsOnlyCUCoveringAddress)
+{
+	DwarfFile dwarf("", parse(elfWithAranges), true);
+
+	EXPECT_TRUE(dwarf.loadCUsForAddress(B_FUNC + 2));
+	EXPECT_EQ(1, dwarf.getLoadedCUCount());
+}
+
+TEST_F(DwarfFileTests,
+LoadCUsForAddressDoesNotLoadCUTwice)
+{
+	DwarfFile dwarf("", parse(elfWithAranges), true);
+
+	dwarf.loadCUsForAddress(A_FUNC);
+	dwarf.loadCUsForAddress(A_FUNC + 1);
+
+	EXPECT_EQ(1, dwarf.getLoadedCUCount());
+	EXPECT_EQ(4, dwarf.getFunctions()->size());
+}
+
+TEST_F(DwarfFileTests,
+LoadCUsForAddressOutsideOfAllCUsLoadsNothing)
+{
+	DwarfFile dwarf("", parse(elfWithAranges), true);
+
+	EXPECT_FALSE(dwarf.loadCUsForAddress(0x1000));
+	EXPECT_EQ(0, dwarf.getLoadedCUCount());
+}
+
+TEST_F(DwarfFileTests,
+GetFunctionLoadsOnlyCUsCoveringAddresses)
+{
+	DwarfFile dwarf("", parse(elfWithAranges), true);
+
+	auto *start = dwarf.getFunction(START);
+	ASSERT_NE(nullptr, start);
+	EXPECT_EQ("_start", start->name);
+	EXPECT_EQ(1, dwarf.getLoadedCUCount());
+
+	auto *a = dwarf.getFunction(A_FUNC);
+	ASSERT_NE(nullptr, a);
+	EXPECT_EQ("a_func", a->name);
+	EXPECT_EQ(2, dwarf.getLoadedCUCount());
+}
+
+TEST_F(DwarfFileTests,
+GetFunctionReturnsNullptrForAddressInsideOfFunction)
+{
+	DwarfFile dwarf("", parse(elfWithAranges), true);
+
+	EXPECT_EQ(nullptr, dwarf.getFunction(C_FUNC + 1));
+}
+
+TEST_F(DwarfFileTests,
+ContainerGettersLoadAllCUsOfLazyFile)
+{
+	DwarfFile dwarf("", parse(elfWithAranges), true);
+
+	EXPECT_EQ(4, dwarf.getFunctions()->size());
+	EXPECT_EQ(3, dwarf.getLoadedCUCount());
+}
+
+TEST_F(DwarfFileTests,
+LazyAndEagerFilesLoadSameFunctions)
+{
+	DwarfFile eager("", parse(elfWithAranges));
+	const auto eagerNames = functionNames(eager);
+	DwarfFile lazy("", parse(elfWithAranges), true);
+	lazy.getFunction(C_FUNC);
+
+	EXPECT_EQ(eagerNames, functionNames(lazy));
+	EXPECT_EQ(
+		std::set<std::string>({"_start", "a_func", "b_func", "c_func"}),
+		eagerNames);
+}
+
+TEST_F(DwarfFileTests,
+CUsMissingInArangesAreIndexedByPcOfTheirDIEs)
+{
+	DwarfFile dwarf("", parse(elfWithoutAranges), true);
+
+	ASSERT_TRUE(dwarf.hasDwarfInfo());
+	EXPECT_EQ(3, dwarf.getCUCount());
+
+	auto *b = dwarf.getFunction(B_FUNC);
+	ASSERT_NE(nullptr, b);
+	EXPECT_EQ("b_func", b->name);
+	EXPECT_EQ(1, dwarf.getLoadedCUCount());
+}
+
+TEST_F(DwarfFileTests,
+GetFunctionByNameLoadsOnlyItsCU)
+{
+	DwarfFile dwarf("", parse(elfWithAranges), true);
+
+	auto *b = dwarf.getFunction("b_func");
+	ASSERT_NE(nullptr, b);
+	EXPECT_EQ(B_FUNC, b->lowAddr);
+	EXPECT_EQ(1, dwarf.getLoadedCUCount());
+}
+
+TEST_F(DwarfFileTests,
+LoadCUsForNameLoadsOnlyCUDeclaringName)
+{
+	DwarfFile dwarf("", parse(elfWithAranges), true);
+
+	EXPECT_TRUE(dwarf.loadCUsForName("c_func"));
+	EXPECT_EQ(1, dwarf.getLoadedCUCount());
+}
+
+TEST_F(DwarfFileTests,
+LoadCUsForUnknownNameLoadsNothing)
+{
+	DwarfFile dwarf("", parse(elfWithAranges), true);
+
+	EXPECT_FALSE(dwarf.loadCUsForName("d_func"));
+	EXPECT_EQ(nullptr, dwarf.getFunction("d_func"));
+	EXPECT_EQ(0, dwarf.getLoadedCUCount());
+}
+
+TEST_F(DwarfFileTests,
+LoadCUsLoadsOnlyGivenRange)
+{
+	DwarfFile dwarf("", parse(elfWithAranges), true);
+
+	dwarf.loadCUs(1, 2);
+
+	EXPECT_EQ(1, dwarf.getLoadedCUCount());
+}
+
+TEST_F(DwarfFileTests,
+GetGlobalVarLoadsOnlyCUDefiningVariable)
+{
+	DwarfFile dwarf("", parse(elfWithAranges), true);
+
+	auto *a = dwarf.getGlobalVar(A_VAR);
+	ASSERT_NE(nullptr, a);
+	EXPECT_EQ("a_var", a->name);
+	EXPECT_EQ(1, dwarf.getLoadedCUCount());
+}
+
+TEST_F(DwarfFileTests,
+GetLoadedLineNumbersDoesNotLoadCUs)
+{
+	DwarfFile dwarf("", parse(elfWithAranges), true);
+
+	EXPECT_TRUE(dwarf.getLoadedLineNumbers().empty());
+	dwarf.getFunction(A_FUNC);
+	const auto &lines = dwarf.getLoadedLineNumbers();
+
+	EXPECT_NE(lines.end(), lines.find(A_FUNC));
+	EXPECT_EQ(lines.end(), lines.find(B_FUNC));
+	EXPECT_EQ(1, dwarf.getLoadedCUCount());
+}
+
+TEST_F(DwarfFileTests,
+LoadAllCUsInParallelLoadsSameFunctionsAndTypes)
+{
+	DwarfFile eager("", parse(elfWithAranges));
+	DwarfFile lazy("", parse(elfWithAranges), true);
+	retdec::utils::ThreadPool pool(2);
+
+	lazy.loadAllCUs(&pool);
+
+	EXPECT_EQ(3, lazy.getLoadedCUCount());
+	EXPECT_EQ(functionNames(eager), functionNames(lazy));
+	EXPECT_EQ(typeNames(eager), typeNames(lazy));
+	EXPECT_EQ(1, typeNames(lazy).count("b_pair"));
+}
+
+} // namespace tests
+} // namespace dwarfparser
+} // namespace retdec
@@ -0,0 +1,166 @@
+/**
+ * @file tests/fileinfo/fileinfo_batch_tests.cpp
+ * @brief Tests for the batch mode of the @c fileinfo tool.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <json/json.h>
+
+#include "retdec/utils/binary_path.h"
+
+using namespace ::testing;
+
+namespace {
+
+/**
+ * x86 ELF executable which writes "Hi World" to the standard output and exits.
+ */
+const unsigned char elfBytes[] =
+{
+
+0x7f, 0x45, 0x4c, 0x46, 0x01, 0x01, 0x01, 0x48, 0x69, 0x20, 0x57, 0x6f, 0x72, 0x6c, 0x64, 0x0a,
+0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x80, 0x04, 0x08, 0x34, 0x00, 0x00, 0x00,
+0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x20, 0x00, 0x02, 0x00, 0x28, 0x00,
+0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x08,
+0x00, 0x80, 0x04, 0x08, 0xa2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x90, 0x04, 0x08,
+0xa4, 0x90, 0x04, 0x08, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xba, 0x09, 0x00, 0x00, 0x00, 0xb9, 0x07, 0x90, 0x04, 0x08, 0xbb, 0x01, 0x00, 0x00, 0x00, 0xb8,
+0x04, 0x00, 0x00, 0x00, 0xcd, 0x80, 0xbb, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00,
+0xcd, 0x80, 0x00, 0x00
+
+};
+
+} // anonymous namespace
+
+namespace retdec {
+namespace fileinfo {
+namespace tests {
+
+/**
+ * Tests of @c fileinfo runs with option @c --batch.
+ */
+class FileinfoBatchTests : public Test
+{
+	protected:
+		FileinfoBatchTests() :
+			dir(retdec::utils::getThisBinaryDirectoryPath().getPath()),
+			outputFile(dir + "/fileinfo_batch_tests.out")
+		{
+			for(const auto &name : {"a", "b", "c"})
+			{
+				inputFiles.push_back(dir + "/fileinfo_batch_tests_" + name + ".elf");
+				std::ofstream input(inputFiles.back(), std::ios::binary);
+				input.write(reinterpret_cast<const char*>(elfBytes), sizeof(elfBytes));
+			}
+			missingFile = dir + "/fileinfo_batch_tests_nonexistent.elf";
+		}
+
+		~FileinfoBatchTests()
+		{
+			for(const auto &file : inputFiles)
+			{
+				std::remove(file.c_str());
+			}
+			std::remove(outputFile.c_str());
+		}
+
+		/// Runs fileinfo with @a args and returns its exit code.
+		int runFileinfo(const std::string &args)
+		{
+			const auto command = "\"" + dir + "/" + RETDEC_FILEINFO_NAME + "\" --batch "
+				+ args + " > \"" + outputFile + "\"";
+			return std::system(command.c_str());
+		}
+
+		/// Parses output of the last run, one JSON object per line.
+		std::vector<Json::Value> readRecords()
+		{
+			std::vector<Json::Value> records;
+			std::ifstream output(outputFile);
+			std::string line;
+			while(std::getline(output, line))
+			{
+				Json::Value record;
+				Json::Reader reader;
+				EXPECT_TRUE(reader.parse(line, record, false)) << line;
+				EXPECT_TRUE(record.isObject()) << line;
+				records.push_back(record);
+			}
+			return records;
+		}
+
+		static std::set<std::string> getInputFiles(const std::vector<Json::Value> &records)
+		{
+			std::set<std::string> files;
+			for(const auto &record : records)
+			{
+				files.insert(record["inputFile"].asString());
+			}
+			return files;
+		}
+
+		std::string dir;
+		std::string outputFile;
+		std::vector<std::string> inputFiles;
+		std::string missingFile;
+};
+
+TEST_F(FileinfoBatchTests,
+OneJsonRecordIsPrintedPerLineForEachFileFromCommandLine)
+{
+	ASSERT_EQ(0, runFileinfo("--threads 2 \"" + inputFiles[0] + "\" \""
+		+ inputFiles[1] + "\" \"" + inputFiles[2] + "\""));
+
+	auto records = readRecords();
+	ASSERT_EQ(3, records.size());
+	std::set<std::string> expected(inputFiles.begin(), inputFiles.end());
+	EXPECT_EQ(expected, getInputFiles(records));
+	for(const auto &record : records)
+	{
+		EXPECT_EQ("ELF", record["fileFormat"].asString());
+	}
+}
+
+TEST_F(FileinfoBatchTests,
+MissingFileDoesNotStopBatch)
+{
+	ASSERT_EQ(0, runFileinfo("\"" + inputFiles[0] + "\" \""
+		+ missingFile + "\" \"" + inputFiles[1] + "\""));
+
+	auto records = readRecords();
+	ASSERT_EQ(3, records.size());
+	std::set<std::string> expected = {inputFiles[0], missingFile, inputFiles[1]};
+	EXPECT_EQ(expected, getInputFiles(records));
+}
+
+TEST_F(FileinfoBatchTests,
+PathsAreReadFromStandardInputWhenNoFileIsGiven)
+{
+	const auto listFile = dir + "/fileinfo_batch_tests.list";
+	{
+		std::ofstream list(listFile);
+		list << inputFiles[0] << "\n" << inputFiles[1] << "\r\n\n" << inputFiles[2] << "\n";
+	}
+
+	ASSERT_EQ(0, runFileinfo("--threads 2 < \"" + listFile + "\""));
+	std::remove(listFile.c_str());
+
+	auto records = readRecords();
+	ASSERT_EQ(3, records.size());
+	std::set<std::string> expected(inputFiles.begin(), inputFiles.end());
+	EXPECT_EQ(expected, getInputFiles(records));
+}
+
+} // namespace tests
+} // namespace fileinfo
+} // namespace retdec
@@ -0,0 +1,140 @@
+/**
+* @file tests/llvmir2hll/analysis/func_change_tracker_tests.cpp
+* @brief Tests for the @c func_change_tracker module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/analysis/func_change_tracker.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/if_stmt.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/support/types.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c func_change_tracker module.
+*/
+class FuncChangeTrackerTests: public TestsWithModule {};
+
+TEST_F(FuncChangeTrackerTests,
+FuncIsChangedWhenItHasNotBeenMarkedAsUpToDate) {
+	auto tracker = FuncChangeTracker::create(module);
+
+	EXPECT_TRUE(tracker->hasChanged(testFunc));
+	EXPECT_EQ(FuncSet({testFunc}), tracker->getChangedFuncs());
+}
+
+TEST_F(FuncChangeTrackerTests,
+FuncIsNotChangedAfterItHasBeenMarkedAsUpToDate) {
+	auto tracker = FuncChangeTracker::create(module);
+
+	tracker->markAsUpToDate(FuncSet({testFunc}));
+
+	EXPECT_FALSE(tracker->hasChanged(testFunc));
+	EXPECT_TRUE(tracker->getChangedFuncs().empty());
+}
+
+TEST_F(FuncChangeTrackerTests,
+FuncIsChangedAfterItHasBeenMarkedAsChanged) {
+	auto tracker = FuncChangeTracker::create(module);
+	tracker->markAsUpToDate(FuncSet({testFunc}));
+
+	tracker->markAsChanged(FuncSet({testFunc}));
+
+	EXPECT_TRUE(tracker->hasChanged(testFunc));
+}
+
+TEST_F(FuncChangeTrackerTests,
+FuncIsChangedWhenExpressionInItsBodyIsReplaced) {
+	// void test() {
+	//   a = 1;
+	// }
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	ShPtr<AssignStmt> assignA(AssignStmt::create(varA, ConstInt::create(1, 32)));
+	testFunc->setBody(assignA);
+	auto tracker = FuncChangeTracker::create(module);
+	tracker->markAsUpToDate(FuncSet({testFunc}));
+
+	assignA->setRhs(ConstInt::create(2, 32));
+
+	EXPECT_TRUE(tracker->hasChanged(testFunc));
+}
+
+TEST_F(FuncChangeTrackerTests,
+FuncIsChangedWhenStatementIsMovedIntoCompoundStatement) {
+	// void test() {
+	//   if (1) {
+	//       a = 1;
+	//   }
+	//   b = 1;
+	// }
+	//
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	testFunc->addLocalVar(varB);
+	ShPtr<AssignStmt> assignA(AssignStmt::create(varA, ConstInt::create(1, 32)));
+	ShPtr<AssignStmt> assignB(AssignStmt::create(varB, ConstInt::create(1, 32)));
+	ShPtr<IfStmt> ifStmt(IfStmt::create(ConstInt::create(1, 32), assignA));
+	ifStmt->setSuccessor(assignB);
+	testFunc->setBody(ifStmt);
+	auto fingerprintBefore = FuncChangeTracker::getFingerprint(testFunc);
+
+	// void test() {
+	//   if (1) {
+	//       a = 1;
+	//       b = 1;
+	//   }
+	// }
+	//
+	ifStmt->removeSuccessor();
+	assignA->setSuccessor(assignB);
+
+	EXPECT_NE(fingerprintBefore, FuncChangeTracker::getFingerprint(testFunc));
+}
+
+TEST_F(FuncChangeTrackerTests,
+FingerprintIsSameWhenFuncHasNotChanged) {
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+	testFunc->addLocalVar(varA);
+	testFunc->setBody(AssignStmt::create(varA, ConstInt::create(1, 32)));
+
+	EXPECT_EQ(FuncChangeTracker::getFingerprint(testFunc),
+		FuncChangeTracker::getFingerprint(testFunc));
+}
+
+TEST_F(FuncChangeTrackerTests,
+AddingGlobalVarChangesFuncsWhenGlobalVarsAreTracked) {
+	auto tracker = FuncChangeTracker::create(module, true);
+	tracker->markAsUpToDate(FuncSet({testFunc}));
+
+	module->addGlobalVar(Variable::create("g", IntType::create(32)));
+
+	EXPECT_TRUE(tracker->hasChanged(testFunc));
+}
+
+TEST_F(FuncChangeTrackerTests,
+AddingGlobalVarDoesNotChangeFuncsWhenGlobalVarsAreNotTracked) {
+	auto tracker = FuncChangeTracker::create(module);
+	tracker->markAsUpToDate(FuncSet({testFunc}));
+
+	module->addGlobalVar(Variable::create("g", IntType::create(32)));
+
+	EXPECT_FALSE(tracker->hasChanged(testFunc));
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
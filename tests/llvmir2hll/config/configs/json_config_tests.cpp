@@ -6,6 +6,7 @@
 
 #include <gtest/gtest.h>
 
+#include "retdec/config/config.h"
 #include "retdec/llvmir2hll/config/configs/json_config.h"
 #include "retdec/llvmir2hll/support/types.h"
 
@@ -41,6 +42,16 @@ ConfigFromStringRaisesJSONParsingErrorWhenJSONIsInvalid) {
 	ASSERT_THROW(JSONConfig::fromString("%"), JSONConfigParsingError);
 }
 
+TEST_F(JSONConfigTests,
+ConfigFromConfigContainsDataOfGivenConfig) {
+	retdec::config::Config origConfig;
+	origConfig.setFrontendVersion("v1.0");
+
+	auto config = JSONConfig::fromConfig(origConfig);
+
+	ASSERT_EQ("v1.0", config->getFrontendRelease());
+}
+
 //
 // isGlobalVarStoringWideString()
 //
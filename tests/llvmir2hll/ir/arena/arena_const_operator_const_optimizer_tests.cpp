@@ -0,0 +1,98 @@
+/**
+* @file tests/llvmir2hll/ir/arena/arena_const_operator_const_optimizer_tests.cpp
+* @brief Tests for the @c arena_const_operator_const_optimizer module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/arena/arena_const_operator_const_optimizer.h"
+#include "retdec/llvmir2hll/ir/arena/expr_arena_converter.h"
+#include "retdec/llvmir2hll/ir/bit_xor_op_expr.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/mul_op_expr.h"
+#include "retdec/llvmir2hll/ir/sub_op_expr.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c arena_const_operator_const_optimizer module.
+*/
+class ArenaConstOperatorConstOptimizerTests: public Test {
+protected:
+	ShPtr<Expression> optimize(ShPtr<Expression> expr);
+
+protected:
+	ExprArena arena;
+};
+
+/**
+* @brief Optimizes @a expr in the arena and returns the result in the backend
+*        IR.
+*/
+ShPtr<Expression> ArenaConstOperatorConstOptimizerTests::optimize(
+		ShPtr<Expression> expr) {
+	auto handle = ExprArenaConverter::toArena(arena, expr);
+	handle = ArenaConstOperatorConstOptimizer::optimize(arena, handle);
+	return ExprArenaConverter::toExpression(arena, handle);
+}
+
+TEST_F(ArenaConstOperatorConstOptimizerTests,
+NestedConstantOperatorsAreEvaluated) {
+	// 2 + 3 * 4 -> 14
+	auto result = optimize(AddOpExpr::create(ConstInt::create(2, 32),
+		MulOpExpr::create(ConstInt::create(3, 32), ConstInt::create(4, 32))));
+
+	auto expected = ConstInt::create(14, 32);
+	EXPECT_TRUE(result->isEqualTo(expected)) <<
+		"expected `" << expected << "`, got `" << result << "`";
+}
+
+TEST_F(ArenaConstOperatorConstOptimizerTests,
+ConstantOperandsOfOperatorWithVariableAreEvaluated) {
+	// a - (5 ^ 3) -> a - 6
+	auto varA = Variable::create("a", IntType::create(32));
+	auto result = optimize(SubOpExpr::create(varA,
+		BitXorOpExpr::create(ConstInt::create(5, 32), ConstInt::create(3, 32))));
+
+	auto expected = SubOpExpr::create(varA, ConstInt::create(6, 32));
+	EXPECT_TRUE(result->isEqualTo(expected)) <<
+		"expected `" << expected << "`, got `" << result << "`";
+	ExprArena::ExprHandles uses(arena.getUses(varA));
+	ASSERT_EQ(1, uses.size());
+	EXPECT_TRUE(arena.getParent(uses[0]).isValid());
+}
+
+TEST_F(ArenaConstOperatorConstOptimizerTests,
+OverflowingOperatorIsNotEvaluated) {
+	// 2147483647 + 1
+	auto expr = AddOpExpr::create(ConstInt::create(2147483647, 32),
+		ConstInt::create(1, 32));
+
+	auto result = optimize(expr);
+
+	EXPECT_TRUE(result->isEqualTo(expr)) <<
+		"expected `" << expr << "`, got `" << result << "`";
+}
+
+TEST_F(ArenaConstOperatorConstOptimizerTests,
+OperandsOfDifferentBitWidthsAreNotEvaluated) {
+	auto expr = AddOpExpr::create(ConstInt::create(1, 32),
+		ConstInt::create(1, 64));
+
+	auto result = optimize(expr);
+
+	EXPECT_TRUE(result->isEqualTo(expr)) <<
+		"expected `" << expr << "`, got `" << result << "`";
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
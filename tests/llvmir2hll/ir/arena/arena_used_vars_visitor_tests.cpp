@@ -0,0 +1,60 @@
+/**
+* @file tests/llvmir2hll/ir/arena/arena_used_vars_visitor_tests.cpp
+* @brief Tests for the @c arena_used_vars_visitor module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/analysis/used_vars_visitor.h"
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/arena/arena_used_vars_visitor.h"
+#include "retdec/llvmir2hll/ir/arena/expr_arena_converter.h"
+#include "retdec/llvmir2hll/ir/call_expr.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/mul_op_expr.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c arena_used_vars_visitor module.
+*/
+class ArenaUsedVarsVisitorTests: public Test {
+protected:
+	ExprArena arena;
+};
+
+TEST_F(ArenaUsedVarsVisitorTests,
+ConstantUsesNoVariables) {
+	auto expr = arena.createConstInt(llvm::APSInt(llvm::APInt(32, 1)));
+
+	EXPECT_TRUE(ArenaUsedVarsVisitor::getUsedVars(arena, expr).empty());
+}
+
+TEST_F(ArenaUsedVarsVisitorTests,
+UsedVariablesAreSameAsInBackendIR) {
+	// (a + 1) * f(b, a)
+	auto varA = Variable::create("a", IntType::create(32));
+	auto varB = Variable::create("b", IntType::create(32));
+	auto varF = Variable::create("f", IntType::create(32));
+	ShPtr<Expression> expr(MulOpExpr::create(
+		AddOpExpr::create(varA, ConstInt::create(1, 32)),
+		CallExpr::create(varF, ExprVector{varB, varA})));
+
+	auto handle = ExprArenaConverter::toArena(arena, expr);
+
+	VarSet expected{varA, varB, varF};
+	EXPECT_EQ(expected, ArenaUsedVarsVisitor::getUsedVars(arena, handle));
+	EXPECT_EQ(UsedVarsVisitor::getUsedVars(expr)->getAllVars(),
+		ArenaUsedVarsVisitor::getUsedVars(arena, handle));
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
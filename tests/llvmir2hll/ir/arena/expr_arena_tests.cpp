@@ -0,0 +1,126 @@
+/**
+* @file tests/llvmir2hll/ir/arena/expr_arena_tests.cpp
+* @brief Tests for the @c expr_arena and @c expr_arena_converter modules.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/arena/expr_arena.h"
+#include "retdec/llvmir2hll/ir/arena/expr_arena_converter.h"
+#include "retdec/llvmir2hll/ir/call_expr.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/mul_op_expr.h"
+#include "retdec/llvmir2hll/ir/neg_op_expr.h"
+#include "retdec/llvmir2hll/ir/sub_op_expr.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c expr_arena and @c expr_arena_converter modules.
+*/
+class ExprArenaTests: public Test {
+protected:
+	ExprArenaTests():
+		varA(Variable::create("a", IntType::create(32))),
+		varB(Variable::create("b", IntType::create(32))) {}
+
+protected:
+	ExprArena arena;
+	ShPtr<Variable> varA;
+	ShPtr<Variable> varB;
+};
+
+TEST_F(ExprArenaTests,
+DefaultConstructedHandleIsInvalid) {
+	EXPECT_FALSE(ExprHandle().isValid());
+}
+
+TEST_F(ExprArenaTests,
+OperandsOfCreatedOperatorHaveItAsParent) {
+	auto a = arena.createVariable(varA);
+	auto one = arena.createConstInt(llvm::APSInt(llvm::APInt(32, 1)));
+	auto add = arena.createBinaryOp(ExprArena::Kind::Add, a, one);
+
+	EXPECT_EQ(ExprArena::Kind::Add, arena.getKind(add));
+	ASSERT_EQ(2, arena.getNumOfOperands(add));
+	EXPECT_EQ(a, arena.getOperand(add, 0));
+	EXPECT_EQ(one, arena.getOperand(add, 1));
+	EXPECT_EQ(add, arena.getParent(a));
+	EXPECT_EQ(add, arena.getParent(one));
+	EXPECT_FALSE(arena.getParent(add).isValid());
+}
+
+TEST_F(ExprArenaTests,
+UsesOfVariableAreTracked) {
+	auto a1 = arena.createVariable(varA);
+	auto a2 = arena.createVariable(varA);
+	arena.createBinaryOp(ExprArena::Kind::Mul, a1, a2);
+
+	ExprArena::ExprHandles expected{a1, a2};
+	EXPECT_EQ(expected, arena.getUses(varA));
+	EXPECT_EQ(varA, arena.getVariable(a1));
+	EXPECT_TRUE(arena.getUses(varB).empty());
+}
+
+TEST_F(ExprArenaTests,
+ReplaceUpdatesParentAndRemovesUsesInReplacedExpression) {
+	auto a = arena.createVariable(varA);
+	auto b = arena.createVariable(varB);
+	auto sub = arena.createBinaryOp(ExprArena::Kind::Sub, a, b);
+	auto neg = arena.createUnaryOp(ExprArena::Kind::Neg, sub);
+	auto zero = arena.createConstInt(llvm::APSInt(llvm::APInt(32, 0)));
+
+	arena.replace(sub, zero);
+
+	EXPECT_EQ(zero, arena.getOperand(neg, 0));
+	EXPECT_EQ(neg, arena.getParent(zero));
+	EXPECT_FALSE(arena.getParent(sub).isValid());
+	EXPECT_TRUE(arena.getUses(varA).empty());
+	EXPECT_TRUE(arena.getUses(varB).empty());
+}
+
+TEST_F(ExprArenaTests,
+MemoryUsageGrowsWithNumberOfExpressions) {
+	auto emptyUsage = arena.getMemoryUsage();
+
+	auto expr = arena.createVariable(varA);
+	for (int i = 0; i < 100; ++i) {
+		expr = arena.createBinaryOp(ExprArena::Kind::Add, expr,
+			arena.createVariable(varB));
+	}
+
+	EXPECT_EQ(201, arena.getNumOfExprs());
+	EXPECT_GT(arena.getMemoryUsage(), emptyUsage);
+}
+
+TEST_F(ExprArenaTests,
+ConversionToArenaAndBackGivesEqualExpression) {
+	// -(a + 2) * (b - f(a))
+	auto call = CallExpr::create(
+		Variable::create("f", IntType::create(32)), ExprVector{varA});
+	ShPtr<Expression> expr(MulOpExpr::create(
+		NegOpExpr::create(AddOpExpr::create(varA, ConstInt::create(2, 32))),
+		SubOpExpr::create(varB, call)));
+
+	auto handle = ExprArenaConverter::toArena(arena, expr);
+	auto converted = ExprArenaConverter::toExpression(arena, handle);
+
+	EXPECT_EQ(ExprArena::Kind::Mul, arena.getKind(handle));
+	auto sub = arena.getOperand(handle, 1);
+	EXPECT_EQ(ExprArena::Kind::Opaque, arena.getKind(arena.getOperand(sub, 1)));
+	EXPECT_EQ(call, arena.getOpaque(arena.getOperand(sub, 1)));
+	EXPECT_TRUE(converted->isEqualTo(expr)) <<
+		"expected `" << expr << "`, got `" << converted << "`";
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
@@ -4,6 +4,9 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "retdec/llvmir2hll/ir/int_type.h"
@@ -69,6 +72,29 @@ IsUnsignedReturnsFalseWhenTypeIsSigned) {
 	ASSERT_FALSE(type->isUnsigned());
 }
 
+//
+// create()
+//
+
+TEST_F(IntTypeTests,
+CreateCalledFromSeveralThreadsReturnsTheSameType) {
+	const std::size_t THREAD_COUNT = 8;
+	std::vector<ShPtr<IntType>> types(THREAD_COUNT);
+	std::vector<std::thread> threads;
+	for (std::size_t i = 0; i < THREAD_COUNT; ++i) {
+		threads.emplace_back([&types, i]() {
+			types[i] = IntType::create(123, true);
+		});
+	}
+	for (auto &t : threads) {
+		t.join();
+	}
+
+	for (const auto &type : types) {
+		ASSERT_EQ(types[0], type);
+	}
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
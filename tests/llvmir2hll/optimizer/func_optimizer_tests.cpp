@@ -0,0 +1,91 @@
+/**
+* @file tests/llvmir2hll/optimizer/func_optimizer_tests.cpp
+* @brief Tests for the @c func_optimizer module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "llvmir2hll/ir/tests_with_module.h"
+#include "retdec/llvmir2hll/optimizer/func_optimizer.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+namespace {
+
+/**
+* @brief Optimizer recording calls of its hooks.
+*/
+class RecordingFuncOptimizer: public FuncOptimizer {
+public:
+	RecordingFuncOptimizer(ShPtr<Module> module): FuncOptimizer(module) {}
+
+	virtual std::string getId() const override { return "Recording"; }
+
+	/// Names of called hooks (functions are recorded by their names).
+	std::vector<std::string> calls;
+
+protected:
+	virtual void doInitialization() override {
+		calls.push_back("init");
+	}
+
+	virtual void doOptimization() override {
+		calls.push_back("optimization");
+		FuncOptimizer::doOptimization();
+	}
+
+	virtual void runOnFunction(ShPtr<Function> func) override {
+		calls.push_back(func->getName());
+	}
+
+	virtual void doFinalization() override {
+		calls.push_back("finalization");
+	}
+};
+
+} // anonymous namespace
+
+/**
+* @brief Tests for the @c func_optimizer module.
+*/
+class FuncOptimizerTests: public TestsWithModule {};
+
+TEST_F(FuncOptimizerTests,
+OptimizeRunsHooksAndOptimizesAllFunctions) {
+	addFuncDef("other");
+	ShPtr<RecordingFuncOptimizer> optimizer(new RecordingFuncOptimizer(module));
+
+	optimizer->optimize();
+
+	std::vector<std::string> expected{
+		"init", "optimization", "test", "other", "finalization"
+	};
+	EXPECT_EQ(expected, optimizer->calls);
+}
+
+TEST_F(FuncOptimizerTests,
+OptimizeFunctionRunsHooksAndOptimizesOnlyGivenFunction) {
+	auto otherFunc = addFuncDef("other");
+	ShPtr<RecordingFuncOptimizer> optimizer(new RecordingFuncOptimizer(module));
+
+	optimizer->optimizeFunction(otherFunc);
+	optimizer->optimizeFunction(testFunc);
+
+	std::vector<std::string> expected{
+		"init", "optimization", "other", "finalization",
+		"init", "optimization", "test", "finalization"
+	};
+	EXPECT_EQ(expected, optimizer->calls);
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
@@ -0,0 +1,154 @@
+/**
+* @file tests/llvmir2hll/optimizer/optimizer_manager_tests.cpp
+* @brief Tests for the @c optimizer_manager module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <string>
+
+#include <gtest/gtest.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "retdec/llvmir2hll/analysis/alias_analysis/alias_analyses/simple_alias_analysis.h"
+#include "retdec/llvmir2hll/analysis/value_analysis.h"
+#include "retdec/llvmir2hll/evaluator/arithm_expr_evaluators/c_arithm_expr_evaluator.h"
+#include "retdec/llvmir2hll/hll/hll_writers/c_hll_writer.h"
+#include "retdec/llvmir2hll/ir/module.h"
+#include "retdec/llvmir2hll/llvm/llvmir2bir_converters/orig_llvmir2bir_converter.h"
+#include "llvmir2hll/llvm/llvmir2bir_converter_tests.h"
+#include "retdec/llvmir2hll/obtainer/call_info_obtainers/optim_call_info_obtainer.h"
+#include "retdec/llvmir2hll/optimizer/optimizer_manager.h"
+#include "retdec/utils/string.h"
+
+using namespace ::testing;
+
+using retdec::utils::contains;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c optimizer_manager module.
+*/
+class OptimizerManagerTests: public LLVMIR2BIRConverterTests {
+protected:
+	virtual void SetUp() override;
+
+	std::string getLLVMIRWithManyFuncs(std::size_t funcCount) const;
+	std::string optimizeAndEmitCode(const std::string &llvmIR,
+		std::size_t threadCount);
+};
+
+void OptimizerManagerTests::SetUp() {
+	ON_CALL(*configMock, getAddressRangeForFunc(_))
+		.WillByDefault(Return(NO_ADDRESS_RANGE));
+	ON_CALL(*configMock, getLineRangeForFunc(_))
+		.WillByDefault(Return(NO_LINE_RANGE));
+}
+
+/**
+* @brief Returns LLVM IR of a module with @a funcCount groups of functions.
+*
+* Every group contains a loop, a condition, a function storing into a global
+* variable and a function calling the other ones, so both function-local and
+* module-level optimizations have something to do.
+*/
+std::string OptimizerManagerTests::getLLVMIRWithManyFuncs(
+		std::size_t funcCount) const {
+	std::string llvmIR = "@g = global i32 0\n";
+	for (std::size_t i = 0; i < funcCount; ++i) {
+		auto n = std::to_string(i);
+		llvmIR += R"(
+			define i32 @sum)" + n + R"((i32 %n) {
+			entry:
+				%i = alloca i32
+				%s = alloca i32
+				store i32 0, i32* %i
+				store i32 0, i32* %s
+				br label %loop
+			loop:
+				%iv = load i32, i32* %i
+				%sv = load i32, i32* %s
+				%sn = add i32 %sv, %iv
+				store i32 %sn, i32* %s
+				%in = add i32 %iv, 1
+				store i32 %in, i32* %i
+				%c = icmp slt i32 %in, %n
+				br i1 %c, label %loop, label %exit
+			exit:
+				%r = load i32, i32* %s
+				ret i32 %r
+			}
+
+			define i32 @max)" + n + R"((i32 %a, i32 %b) {
+				%c = icmp sgt i32 %a, %b
+				br i1 %c, label %t, label %f
+			t:
+				ret i32 %a
+			f:
+				ret i32 %b
+			}
+
+			define void @store)" + n + R"((i32 %x) {
+				%y = mul i32 %x, 1
+				store i32 %y, i32* @g
+				ret void
+			}
+
+			define i32 @caller)" + n + R"((i32 %x) {
+				%a = call i32 @sum)" + n + R"((i32 %x)
+				%b = call i32 @max)" + n + R"((i32 %a, i32 %x)
+				call void @store)" + n + R"((i32 %b)
+				%v = load i32, i32* @g
+				%r = add i32 %v, 0
+				ret i32 %r
+			}
+		)";
+	}
+	return llvmIR;
+}
+
+/**
+* @brief Converts @a llvmIR into BIR, optimizes it by using the given number
+*        of threads, and returns the emitted C code.
+*/
+std::string OptimizerManagerTests::optimizeAndEmitCode(
+		const std::string &llvmIR, std::size_t threadCount) {
+	auto module = convertLLVMIR2BIR<OrigLLVMIR2BIRConverter>(llvmIR);
+	auto aliasAnalysis = SimpleAliasAnalysis::create();
+	aliasAnalysis->init(module);
+
+	std::string code;
+	llvm::raw_string_ostream codeStream(code);
+	auto writer = CHLLWriter::create(codeStream);
+	writer->setOptionEmitTimeVaryingInfo(false);
+
+	OptimizerManager optManager(StringSet(), StringSet(), writer,
+		ValueAnalysis::create(aliasAnalysis, true),
+		OptimCallInfoObtainer::create(), CArithmExprEvaluator::create(),
+		false, false, nullptr, threadCount);
+	optManager.optimize(module);
+
+	writer->emitTargetCode(module);
+	return codeStream.str();
+}
+
+TEST_F(OptimizerManagerTests,
+EmittedCodeDoesNotDependOnNumberOfThreads) {
+	const std::size_t FUNC_COUNT = 16;
+	auto llvmIR = getLLVMIRWithManyFuncs(FUNC_COUNT);
+
+	auto serialCode = optimizeAndEmitCode(llvmIR, 1);
+	auto parallelCode = optimizeAndEmitCode(llvmIR, 4);
+
+	for (std::size_t i = 0; i < FUNC_COUNT; ++i) {
+		ASSERT_TRUE(contains(serialCode, "caller" + std::to_string(i) + "("))
+			<< serialCode;
+	}
+	EXPECT_EQ(serialCode, parallelCode);
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
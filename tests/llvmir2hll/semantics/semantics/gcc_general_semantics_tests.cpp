@@ -7,6 +7,8 @@
 #include <gtest/gtest.h>
 
 #include "retdec/llvmir2hll/semantics/semantics/gcc_general_semantics.h"
+#include "retdec/llvmir2hll/semantics/semantics/gcc_general_semantics/get_c_header_file_for_func.h"
+#include "retdec/llvmir2hll/semantics/semantics/gcc_general_semantics/get_name_of_param.h"
 
 using namespace ::testing;
 
@@ -52,6 +54,12 @@ GetCHeaderFileForUnknownFunctionsReturnsNoAnswer) {
 	EXPECT_FALSE(headerForFoo);
 }
 
+TEST_F(GCCGeneralSemanticsTests,
+TableOfCHeaderFilesIsSortedByFunctionNames) {
+	auto table = semantics::gcc_general::getFuncCHeadersTable();
+	EXPECT_TRUE(semantics::isSortedTable(table.begin, table.end));
+}
+
 //
 // getNameOfVarStoringResult()
 //
@@ -88,6 +96,29 @@ GetNameOfParamForKnownFunctionsReturnsCorrectAnswer) {
 	EXPECT_EQ("operation", flockParam2Name.get());
 }
 
+TEST_F(GCCGeneralSemanticsTests,
+GetNameOfParamForLastParamOfGdbmOpenReturnsCorrectAnswer) {
+	// gdbm_open (fourth parameter)
+	Maybe<std::string> gdbmOpenParam4Name(semantics->getNameOfParam("gdbm_open", 4));
+	ASSERT_TRUE(gdbmOpenParam4Name) << "no name of the fourth parameter of `gdbm_open`";
+	EXPECT_EQ("mode", gdbmOpenParam4Name.get());
+
+	// gdbm_open (fifth parameter)
+	Maybe<std::string> gdbmOpenParam5Name(semantics->getNameOfParam("gdbm_open", 5));
+	ASSERT_TRUE(gdbmOpenParam5Name) << "no name of the fifth parameter of `gdbm_open`";
+	EXPECT_EQ("fatal_func", gdbmOpenParam5Name.get());
+}
+
+TEST_F(GCCGeneralSemanticsTests,
+GetNameOfParamForAllParamsOfGethostentRReturnsCorrectAnswer) {
+	const char *expectedNames[] = {"ret", "buf", "buf_len", "host", "h_errnop"};
+	for (unsigned i = 0; i < 5; ++i) {
+		Maybe<std::string> paramName(semantics->getNameOfParam("gethostent_r", i + 1));
+		ASSERT_TRUE(paramName) << "no name of parameter " << i + 1 << " of `gethostent_r`";
+		EXPECT_EQ(expectedNames[i], paramName.get());
+	}
+}
+
 TEST_F(GCCGeneralSemanticsTests,
 GetNameOfParamForUnknownFunctionsReturnsNoAnswer) {
 	// foo
@@ -95,6 +126,12 @@ GetNameOfParamForUnknownFunctionsReturnsNoAnswer) {
 	EXPECT_FALSE(fooParam1Name) << "there should be no information for `foo`";
 }
 
+TEST_F(GCCGeneralSemanticsTests,
+TableOfParamNamesIsSortedByFunctionNamesAndParamPositions) {
+	auto table = semantics::gcc_general::getFuncParamNamesTable();
+	EXPECT_TRUE(semantics::isSortedTable(table.begin, table.end));
+}
+
 //
 // getSymbolicNamesForParam()
 //
@@ -0,0 +1,67 @@
+/**
+* @file tests/llvmir2hll/semantics/semantics/impl_support/sorted_table_tests.cpp
+* @brief Tests for the @c sorted_table module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <iterator>
+
+#include <gtest/gtest.h>
+
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/get_name_of_param.h"
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/sorted_table.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace semantics {
+namespace tests {
+
+/**
+* @brief Tests for the @c sorted_table module.
+*/
+class SortedTableTests: public Test {};
+
+TEST_F(SortedTableTests,
+EmptyTableIsSorted) {
+	const FuncParamName *table = nullptr;
+
+	EXPECT_TRUE(isSortedTable(table, table));
+}
+
+TEST_F(SortedTableTests,
+TableSortedByFunctionNamesAndParamPositionsIsSorted) {
+	const FuncParamName table[] = {
+		{"f", 1, "a"},
+		{"f", 2, "b"},
+		{"g", 1, "c"},
+	};
+
+	EXPECT_TRUE(isSortedTable(std::begin(table), std::end(table)));
+}
+
+TEST_F(SortedTableTests,
+TableWithUnsortedFunctionNamesIsNotSorted) {
+	const FuncParamName table[] = {
+		{"g", 1, "a"},
+		{"f", 1, "b"},
+	};
+
+	EXPECT_FALSE(isSortedTable(std::begin(table), std::end(table)));
+}
+
+TEST_F(SortedTableTests,
+TableWithDuplicateKeyIsNotSorted) {
+	const FuncParamName table[] = {
+		{"f", 1, "a"},
+		{"f", 1, "b"},
+	};
+
+	EXPECT_FALSE(isSortedTable(std::begin(table), std::end(table)));
+}
+
+} // namespace tests
+} // namespace semantics
+} // namespace llvmir2hll
+} // namespace retdec
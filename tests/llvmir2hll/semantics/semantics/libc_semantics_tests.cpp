@@ -7,6 +7,8 @@
 #include <gtest/gtest.h>
 
 #include "retdec/llvmir2hll/semantics/semantics/libc_semantics.h"
+#include "retdec/llvmir2hll/semantics/semantics/libc_semantics/get_c_header_file_for_func.h"
+#include "retdec/llvmir2hll/semantics/semantics/libc_semantics/get_name_of_param.h"
 
 using namespace ::testing;
 
@@ -82,6 +84,12 @@ GetCHeaderFileForUnknownFunctionsReturnsNoAnswer) {
 	EXPECT_FALSE(headerForFoo);
 }
 
+TEST_F(LibcSemanticsTests,
+TableOfCHeaderFilesIsSortedByFunctionNames) {
+	auto table = semantics::libc::getFuncCHeadersTable();
+	EXPECT_TRUE(semantics::isSortedTable(table.begin, table.end));
+}
+
 //
 // funcNeverReturns()
 //
@@ -147,6 +155,44 @@ GetNameOfParamForKnownFunctionsReturnsCorrectAnswer) {
 	EXPECT_EQ("mode", fopenParam2Name.get());
 }
 
+TEST_F(LibcSemanticsTests,
+GetNameOfParamForBothParamsOfSignalReturnsCorrectAnswer) {
+	// signal (first parameter)
+	Maybe<std::string> signalParam1Name(semantics->getNameOfParam("signal", 1));
+	ASSERT_TRUE(signalParam1Name) << "no name of the first parameter of `signal`";
+	EXPECT_EQ("sig_num", signalParam1Name.get());
+
+	// signal (second parameter)
+	Maybe<std::string> signalParam2Name(semantics->getNameOfParam("signal", 2));
+	ASSERT_TRUE(signalParam2Name) << "no name of the second parameter of `signal`";
+	EXPECT_EQ("sig_handler", signalParam2Name.get());
+}
+
+TEST_F(LibcSemanticsTests,
+GetNameOfParamForComparisonFunctionsOfBsearchAndQsortReturnsCorrectAnswer) {
+	// bsearch (fourth parameter)
+	Maybe<std::string> bsearchParam4Name(semantics->getNameOfParam("bsearch", 4));
+	ASSERT_TRUE(bsearchParam4Name) << "no name of the fourth parameter of `bsearch`";
+	EXPECT_EQ("size", bsearchParam4Name.get());
+
+	// bsearch (fifth parameter)
+	Maybe<std::string> bsearchParam5Name(semantics->getNameOfParam("bsearch", 5));
+	ASSERT_TRUE(bsearchParam5Name) << "no name of the fifth parameter of `bsearch`";
+	EXPECT_EQ("cmp_func", bsearchParam5Name.get());
+
+	// qsort (fourth parameter)
+	Maybe<std::string> qsortParam4Name(semantics->getNameOfParam("qsort", 4));
+	ASSERT_TRUE(qsortParam4Name) << "no name of the fourth parameter of `qsort`";
+	EXPECT_EQ("cmp_func", qsortParam4Name.get());
+}
+
+TEST_F(LibcSemanticsTests,
+GetNameOfParamForUnknownParamOfKnownFunctionReturnsNoAnswer) {
+	// fopen (third parameter)
+	Maybe<std::string> fopenParam3Name(semantics->getNameOfParam("fopen", 3));
+	EXPECT_FALSE(fopenParam3Name) << "there should be no information for the third parameter of `fopen`";
+}
+
 TEST_F(LibcSemanticsTests,
 GetNameOfParamForUnknownFunctionsReturnsNoAnswer) {
 	// foo
@@ -154,6 +200,12 @@ GetNameOfParamForUnknownFunctionsReturnsNoAnswer) {
 	EXPECT_FALSE(fooParam1Name) << "there should be no information for `foo`";
 }
 
+TEST_F(LibcSemanticsTests,
+TableOfParamNamesIsSortedByFunctionNamesAndParamPositions) {
+	auto table = semantics::libc::getFuncParamNamesTable();
+	EXPECT_TRUE(semantics::isSortedTable(table.begin, table.end));
+}
+
 //
 // getSymbolicNamesForParam()
 //
@@ -7,6 +7,8 @@
 #include <gtest/gtest.h>
 
 #include "retdec/llvmir2hll/semantics/semantics/win_api_semantics.h"
+#include "retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_c_header_file_for_func.h"
+#include "retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param.h"
 
 using namespace ::testing;
 
@@ -57,6 +59,12 @@ GetCHeaderFileForUnknownFunctionsReturnsNoAnswer) {
 	EXPECT_FALSE(headerForFoo);
 }
 
+TEST_F(WinAPISemanticsTests,
+TableOfCHeaderFilesIsSortedByFunctionNames) {
+	auto table = semantics::win_api::getFuncCHeadersTable();
+	EXPECT_TRUE(semantics::isSortedTable(table.begin, table.end));
+}
+
 //
 // funcNeverReturns()
 //
@@ -127,6 +135,19 @@ GetNameOfParamForKnownFunctionsReturnsCorrectAnswer) {
 	EXPECT_EQ("uStyle", openFileParam3Name.get());
 }
 
+TEST_F(WinAPISemanticsTests,
+GetNameOfParamForFunctionsFromDifferentTablesReturnsCorrectAnswer) {
+	// _lclose (first parameter)
+	Maybe<std::string> lcloseParam1Name(semantics->getNameOfParam("_lclose", 1));
+	ASSERT_TRUE(lcloseParam1Name) << "no name of the first parameter of `_lclose`";
+	EXPECT_EQ("hFile", lcloseParam1Name.get());
+
+	// XcvDataW (last parameter)
+	Maybe<std::string> xcvDataWParam8Name(semantics->getNameOfParam("XcvDataW", 8));
+	ASSERT_TRUE(xcvDataWParam8Name) << "no name of the last parameter of `XcvDataW`";
+	EXPECT_EQ("pdwStatus", xcvDataWParam8Name.get());
+}
+
 TEST_F(WinAPISemanticsTests,
 GetNameOfParamForUnknownFunctionsReturnsNoAnswer) {
 	// foo
@@ -134,6 +155,14 @@ GetNameOfParamForUnknownFunctionsReturnsNoAnswer) {
 	EXPECT_FALSE(fooParam1Name) << "there should be no information for `foo`";
 }
 
+TEST_F(WinAPISemanticsTests,
+TablesOfParamNamesAreSortedByFunctionNamesAndParamPositions) {
+	for (const auto &table : semantics::win_api::getFuncParamNamesTables()) {
+		EXPECT_TRUE(semantics::isSortedTable(table.begin, table.end)) <<
+			"table starting with `" << table.begin->funcName << "` is not sorted";
+	}
+}
+
 //
 // getSymbolicNamesForParam()
 //
@@ -208,6 +208,39 @@ LoadDataWithCorrectOffsetAndSizeWorks) {
 	EXPECT_EQ(expected, result);
 }
 
+TEST_F(SegmentDataSourceTests,
+GetDataViewWithCorrectOffsetAndSizeWorks) {
+	std::vector<std::uint8_t> data = { 0x10, 0x11, 0x12, 0x13 };
+	llvm::StringRef dataRef = llvm::StringRef(reinterpret_cast<const char*>(data.data()), data.size());
+	SegmentDataSource dataSource(dataRef);
+
+	auto view = dataSource.getDataView(1, 2);
+	EXPECT_EQ(data.data() + 1, view.data());
+	EXPECT_EQ(2, view.size());
+}
+
+TEST_F(SegmentDataSourceTests,
+GetDataViewPartiallyExceedingSizeWorks) {
+	std::vector<std::uint8_t> data = { 0x10, 0x11, 0x12, 0x13 };
+	llvm::StringRef dataRef = llvm::StringRef(reinterpret_cast<const char*>(data.data()), data.size());
+	SegmentDataSource dataSource(dataRef);
+
+	std::vector<std::uint8_t> expected = { 0x12, 0x13 };
+
+	auto view = dataSource.getDataView(2, 3);
+	EXPECT_EQ(expected, std::vector<std::uint8_t>(view.begin(), view.end()));
+}
+
+TEST_F(SegmentDataSourceTests,
+GetDataViewFromOffsetOutOfBoundsWorks) {
+	std::vector<std::uint8_t> data = { 0x10, 0x11, 0x12, 0x13 };
+	llvm::StringRef dataRef = llvm::StringRef(reinterpret_cast<const char*>(data.data()), data.size());
+	SegmentDataSource dataSource(dataRef);
+
+	EXPECT_TRUE(dataSource.getDataView(4, 1).empty());
+	EXPECT_TRUE(SegmentDataSource(llvm::StringRef(nullptr, 0)).getDataView(0, 1).empty());
+}
+
 TEST_F(SegmentDataSourceTests,
 SaveDataWithUnsetDataWorks) {
 	llvm::StringRef emptyRef = llvm::StringRef(nullptr, 0);
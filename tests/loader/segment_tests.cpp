@@ -210,6 +210,42 @@ GetBytesOutOfBoundsWithGreaterMemorySizeWorks) {
 	EXPECT_EQ(expected, loaded);
 }
 
+TEST_F(SegmentTests,
+GetBytesViewWorks) {
+	std::vector<std::uint8_t> mockFileData = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16 };
+
+	Segment seg(nullptr, 0x1000, 0x100, makeDataSource(mockFileData));
+
+	std::vector<std::uint8_t> expected = { 0x12, 0x13, 0x14 };
+
+	auto view = seg.getBytesView(2, 3);
+	EXPECT_EQ(expected, std::vector<std::uint8_t>(view.begin(), view.end()));
+}
+
+TEST_F(SegmentTests,
+GetBytesViewContainsOnlyPhysicalDataWorks) {
+	std::vector<std::uint8_t> mockFileData = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16 };
+
+	Segment seg(nullptr, 0x1000, 0x100, makeDataSource(mockFileData));
+
+	std::vector<std::uint8_t> expected = { 0x14, 0x15, 0x16 };
+
+	auto view = seg.getBytesView(4, 5);
+	EXPECT_EQ(expected, std::vector<std::uint8_t>(view.begin(), view.end()));
+	EXPECT_TRUE(seg.getBytesView(0x50, 4).empty());
+}
+
+TEST_F(SegmentTests,
+GetBytesViewIsLimitedBySegmentSizeWorks) {
+	std::vector<std::uint8_t> mockFileData = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16 };
+
+	Segment seg(nullptr, 0x1000, 0x4, makeDataSource(mockFileData));
+
+	EXPECT_EQ(2, seg.getBytesView(2, 5).size());
+	EXPECT_TRUE(seg.getBytesView(4, 1).empty());
+	EXPECT_TRUE(Segment(nullptr, 0x1000, 0x4, nullptr).getBytesView(0, 1).empty());
+}
+
 TEST_F(SegmentTests,
 SetBytesWorks) {
 	std::vector<std::uint8_t> mockFileData = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16 };
@@ -0,0 +1,342 @@
+/**
+* @file tests/pdbparser/pdb_file_tests.cpp
+* @brief Tests for the @c pdb_file module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/pdbparser/pdb_file.h"
+#include "retdec/utils/binary_path.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace pdbparser {
+namespace tests {
+
+namespace {
+
+const std::uint32_t PAGE_SIZE = 0x200;
+
+/**
+* @brief Stream of a PDB file created by the tests.
+*/
+struct TestStream {
+	std::string data;
+	std::vector<std::uint32_t> pages;
+};
+
+void writeDword(std::string &image, std::size_t offset, std::uint32_t value) {
+	std::memcpy(&image[offset], &value, sizeof(value));
+}
+
+void writeWord(std::string &image, std::size_t offset, std::uint16_t value) {
+	std::memcpy(&image[offset], &value, sizeof(value));
+}
+
+/**
+* @brief Writes @a data into the given pages of @a image.
+*/
+void writePages(std::string &image, const std::string &data,
+		const std::vector<std::uint32_t> &pages) {
+	for (std::size_t i = 0; i < pages.size(); ++i) {
+		if (pages[i] * PAGE_SIZE >= image.size()) {
+			// Invalid pages are tested too.
+			continue;
+		}
+		auto chunk = data.substr(i * PAGE_SIZE, PAGE_SIZE);
+		image.replace(pages[i] * PAGE_SIZE, chunk.size(), chunk);
+	}
+}
+
+/**
+* @brief Creates a PDB 7.00 image.
+*
+* @param[in] streams Streams with the pages they are stored in.
+* @param[in] rootPages Pages of the root directory.
+* @param[in] rootIndexesPage Page with the list of root directory pages.
+* @param[in] numPages Number of pages in the image.
+*/
+std::string createPdb(const std::vector<TestStream> &streams,
+		const std::vector<std::uint32_t> &rootPages,
+		std::uint32_t rootIndexesPage, std::uint32_t numPages) {
+	std::string root(4 + 4 * streams.size(), '\0');
+	writeDword(root, 0, streams.size());
+	for (std::size_t i = 0; i < streams.size(); ++i) {
+		writeDword(root, 4 + 4 * i, streams[i].data.size());
+	}
+	for (auto &s : streams) {
+		for (auto page : s.pages) {
+			std::string dword(4, '\0');
+			writeDword(dword, 0, page);
+			root += dword;
+		}
+	}
+
+	std::string image(numPages * PAGE_SIZE, '\0');
+	std::memcpy(&image[0], PDB_SIGNATURE_700, PDB_SIGNATURE_700_SIZE);
+	writeDword(image, 0x20, PAGE_SIZE);
+	writeDword(image, 0x24, 1);
+	writeDword(image, 0x28, numPages);
+	writeDword(image, 0x2C, root.size());
+	writeDword(image, 0x34, rootIndexesPage);
+	for (std::size_t i = 0; i < rootPages.size(); ++i) {
+		writeDword(image, rootIndexesPage * PAGE_SIZE + 4 * i, rootPages[i]);
+	}
+	writePages(image, root, rootPages);
+	for (auto &s : streams) {
+		writePages(image, s.data, s.pages);
+	}
+	return image;
+}
+
+/**
+* @brief Creates a DBI stream with one module whose stream is @a moduleSn.
+*
+* The GSI, PSI and SYM streams are streams 4, 5 and 6.
+*/
+std::string createDbiStream(std::uint16_t moduleSn) {
+	const std::string moduleNames("mod.obj\0mod.lib\0", 16);
+	const std::size_t modiSize = 0x40 + moduleNames.size();
+	const std::size_t dbgHdrSize = 11 * 2;
+	// The module list is followed by zeros because the parser of module
+	// names looks one byte past the names.
+	std::string dbi(0x40 + modiSize + 8 + dbgHdrSize, '\0');
+	writeWord(dbi, 0x0C, 4);
+	writeWord(dbi, 0x10, 5);
+	writeWord(dbi, 0x14, 6);
+	writeDword(dbi, 0x18, modiSize);
+	writeDword(dbi, 0x30, dbgHdrSize);
+	writeWord(dbi, 0x40 + 0x22, moduleSn);
+	dbi.replace(0x40 + 0x40, moduleNames.size(), moduleNames);
+	return dbi;
+}
+
+/**
+* @brief Creates a TPI stream without user-defined types.
+*/
+std::string createTpiStream() {
+	std::string tpi(sizeof(HDR), '\0');
+	writeDword(tpi, 0, 20040203);
+	writeDword(tpi, 4, sizeof(HDR));
+	writeDword(tpi, 8, 0x1000);
+	writeDword(tpi, 12, 0x1000);
+	return tpi;
+}
+
+/**
+* @brief Creates a module stream of the given size containing no symbols.
+*/
+std::string createModuleStream(std::size_t size) {
+	std::string data(size, '\0');
+	writeDword(data, 0, 4);  // CV_SIGNATURE_C13
+	for (std::size_t i = PAGE_SIZE; i < size; ++i) {
+		data[i] = static_cast<char>(i);
+	}
+	return data;
+}
+
+/**
+* @brief Creates streams 0-7 of a PDB file. Stream 7 is the module stream.
+*
+* Pages 0-2 are reserved for the header, the free page map and the list
+* of root directory pages.
+*/
+std::vector<TestStream> createStreams(std::uint16_t moduleSn,
+		const std::vector<std::uint32_t> &modulePages) {
+	return {
+		{"", {}},
+		{std::string(0x1C, '\x01'), {4}},
+		{createTpiStream(), {5}},
+		{createDbiStream(moduleSn), {6}},
+		{"", {}},
+		{"", {}},
+		{"", {}},
+		{createModuleStream(modulePages.size() * PAGE_SIZE), modulePages},
+	};
+}
+
+/**
+* @brief Creates streams 0-7 of a PDB file like createStreams(), but the GSI,
+*        PSI and SYM streams are not empty and, like the module stream, they
+*        are not linear.
+*
+* The streams are stored in pages 4-14.
+*/
+std::vector<TestStream> createStreamsWithPagedSymbolStreams() {
+	auto streams = createStreams(7, {8, 7});
+	streams[4] = {std::string(2 * PAGE_SIZE, '\0'), {10, 9}};
+	streams[5] = {std::string(2 * PAGE_SIZE, '\0'), {12, 11}};
+	streams[6] = {std::string(2 * PAGE_SIZE, '\0'), {14, 13}};
+	return streams;
+}
+
+} // anonymous namespace
+
+/**
+* @brief Tests for the @c pdb_file module.
+*/
+class PDBFileTests: public Test {
+protected:
+	virtual void TearDown() override {
+		std::remove(path.c_str());
+	}
+
+	void writeFile(const std::string &image) {
+		path = retdec::utils::getThisBinaryDirectoryPath().getPath()
+			+ "/pdb_file_tests.pdb";
+		std::ofstream file(path, std::ios::binary);
+		file.write(image.data(), image.size());
+	}
+
+	PDBFileState load(const std::string &image) {
+		writeFile(image);
+		return pdb.load_pdb_file(path.c_str());
+	}
+
+	std::string path;
+	PDBFile pdb;
+};
+
+TEST_F(PDBFileTests,
+LinearStreamIsUsedDirectlyFromFile) {
+	auto streams = createStreams(7, {7, 8});
+	ASSERT_EQ(PDB_STATE_OK, load(createPdb(streams, {3}, 2, 9)));
+
+	auto stream = pdb.get_stream(7);
+
+	ASSERT_NE(nullptr, stream);
+	EXPECT_TRUE(stream->linear);
+	ASSERT_EQ(streams[7].data.size(), stream->size);
+	EXPECT_EQ(streams[7].data, std::string(stream->data, stream->size));
+}
+
+TEST_F(PDBFileTests,
+PagedStreamIsCopiedIntoLinearMemoryWhenItIsFirstAccessed) {
+	auto streams = createStreams(7, {8, 7});
+	ASSERT_EQ(PDB_STATE_OK, load(createPdb(streams, {3}, 2, 9)));
+
+	auto stream = pdb.get_stream(7);
+
+	ASSERT_NE(nullptr, stream);
+	EXPECT_FALSE(stream->linear);
+	ASSERT_EQ(streams[7].data.size(), stream->size);
+	EXPECT_EQ(streams[7].data, std::string(stream->data, stream->size));
+	EXPECT_EQ(stream->data, pdb.get_stream(7)->data);
+}
+
+TEST_F(PDBFileTests,
+NonLinearRootDirectoryIsLoaded) {
+	// The root directory of so many streams does not fit into one page.
+	auto streams = createStreams(7, {7});
+	streams.resize(200);
+	ASSERT_EQ(PDB_STATE_OK, load(createPdb(streams, {10, 8}, 2, 11)));
+
+	EXPECT_NE(nullptr, pdb.get_stream(199));
+	EXPECT_EQ(nullptr, pdb.get_stream(200));
+	auto stream = pdb.get_stream(7);
+	ASSERT_NE(nullptr, stream);
+	EXPECT_EQ(streams[7].data, std::string(stream->data, stream->size));
+	stream = pdb.get_stream(1);
+	ASSERT_NE(nullptr, stream);
+	EXPECT_EQ(streams[1].data, std::string(stream->data, stream->size));
+}
+
+TEST_F(PDBFileTests,
+TruncatedFileIsRejected) {
+	auto image = createPdb(createStreams(7, {7, 8}), {3}, 2, 9);
+	image.resize(image.size() - PAGE_SIZE);
+
+	EXPECT_EQ(PDB_STATE_INVALID_FILE, load(image));
+}
+
+TEST_F(PDBFileTests,
+FileSmallerThanHeaderIsRejected) {
+	auto image = createPdb(createStreams(7, {7, 8}), {3}, 2, 9);
+	image.resize(0x30);
+
+	EXPECT_EQ(PDB_STATE_INVALID_FILE, load(image));
+}
+
+TEST_F(PDBFileTests,
+StreamWithPageOutsideOfFileIsRejected) {
+	auto image = createPdb(createStreams(7, {7, 9}), {3}, 2, 9);
+
+	EXPECT_EQ(PDB_STATE_INVALID_FILE, load(image));
+}
+
+TEST_F(PDBFileTests,
+ModuleWithStreamOutOfRangeIsSkipped) {
+	ASSERT_EQ(PDB_STATE_OK, load(createPdb(createStreams(50, {7}), {3}, 2, 8)));
+	pdb.initialize();
+
+	EXPECT_STREQ("mod.obj", pdb.get_module_name(0));
+	EXPECT_EQ(nullptr, pdb.get_module_name(1));
+	ASSERT_NE(nullptr, pdb.get_functions());
+	EXPECT_TRUE(pdb.get_functions()->empty());
+	ASSERT_NE(nullptr, pdb.get_global_variables());
+	EXPECT_TRUE(pdb.get_global_variables()->empty());
+}
+
+TEST_F(PDBFileTests,
+SymbolsOfModuleWithPagedStreamAreLoaded) {
+	ASSERT_EQ(PDB_STATE_OK, load(createPdb(createStreams(7, {8, 7}), {3}, 2, 9)));
+	pdb.initialize();
+
+	EXPECT_STREQ("mod.obj", pdb.get_module_name(0));
+	ASSERT_NE(nullptr, pdb.get_functions());
+	EXPECT_TRUE(pdb.get_functions()->empty());
+	EXPECT_NE(nullptr, pdb.get_types_container());
+}
+
+TEST_F(PDBFileTests,
+InitializationDoesNotReadSymbolStreams) {
+	ASSERT_EQ(PDB_STATE_OK,
+		load(createPdb(createStreamsWithPagedSymbolStreams(), {3}, 2, 15)));
+	pdb.initialize();
+
+	for (unsigned i = 4; i <= 7; ++i) {
+		EXPECT_FALSE(pdb.is_stream_loaded(i)) << "stream " << i << " was read";
+	}
+}
+
+TEST_F(PDBFileTests,
+LoadingFunctionsReadsOnlyModuleStreams) {
+	ASSERT_EQ(PDB_STATE_OK,
+		load(createPdb(createStreamsWithPagedSymbolStreams(), {3}, 2, 15)));
+	pdb.initialize();
+
+	ASSERT_NE(nullptr, pdb.get_functions());
+
+	EXPECT_FALSE(pdb.is_stream_loaded(4)) << "GSI stream was read";
+	EXPECT_FALSE(pdb.is_stream_loaded(5)) << "PSI stream was read";
+	EXPECT_FALSE(pdb.is_stream_loaded(6)) << "SYM stream was read";
+	EXPECT_TRUE(pdb.is_stream_loaded(7));
+}
+
+TEST_F(PDBFileTests,
+LoadingGlobalVariablesReadsSymStreamButNotGsiAndPsiStreams) {
+	ASSERT_EQ(PDB_STATE_OK,
+		load(createPdb(createStreamsWithPagedSymbolStreams(), {3}, 2, 15)));
+	pdb.initialize();
+
+	ASSERT_NE(nullptr, pdb.get_global_variables());
+	EXPECT_TRUE(pdb.get_global_variables()->empty());
+
+	EXPECT_FALSE(pdb.is_stream_loaded(4)) << "GSI stream was read";
+	EXPECT_FALSE(pdb.is_stream_loaded(5)) << "PSI stream was read";
+	EXPECT_TRUE(pdb.is_stream_loaded(6));
+	EXPECT_TRUE(pdb.is_stream_loaded(7));
+}
+
+} // namespace tests
+} // namespace pdbparser
+} // namespace retdec
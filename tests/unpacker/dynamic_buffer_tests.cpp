@@ -371,6 +371,41 @@ ForEachReverseWorks) {
 	EXPECT_EQ(std::vector<uint8_t>({ 0x00, 0x00, 0x00, 0xD4, 0xD5 }), buffer.getBuffer());
 }
 
+TEST_F(DynamicBufferTests,
+SetRealDataSizeWorks) {
+	DynamicBuffer buffer({ 0xE0, 0xE1 });
+	buffer.setCapacity(4);
+	buffer.setRealDataSize(3);
+
+	EXPECT_EQ(std::vector<uint8_t>({ 0xE0, 0xE1, 0x00 }), buffer.getBuffer());
+	EXPECT_EQ(4, buffer.getCapacity());
+	EXPECT_EQ(3, buffer.getRealDataSize());
+
+	buffer.setRealDataSize(1);
+
+	EXPECT_EQ(std::vector<uint8_t>({ 0xE0 }), buffer.getBuffer());
+	EXPECT_EQ(1, buffer.getRealDataSize());
+}
+
+TEST_F(DynamicBufferTests,
+SetRealDataSizeBeyondCapacityWorks) {
+	DynamicBuffer buffer(2);
+	buffer.setRealDataSize(5);
+
+	EXPECT_EQ(std::vector<uint8_t>({ 0x00, 0x00 }), buffer.getBuffer());
+	EXPECT_EQ(2, buffer.getCapacity());
+	EXPECT_EQ(2, buffer.getRealDataSize());
+}
+
+TEST_F(DynamicBufferTests,
+WriteThroughRawBufferWorks) {
+	std::vector<uint8_t> data = { 0xF0, 0xF1, 0xF2 };
+	DynamicBuffer buffer(data);
+	buffer.getRawBuffer()[1] = 0xFF;
+
+	EXPECT_EQ(std::vector<uint8_t>({ 0xF0, 0xFF, 0xF2 }), buffer.getBuffer());
+}
+
 } // namespace unpacker
 } // namespace retdec
 } // namespace tests
@@ -0,0 +1,141 @@
+/**
+* @file tests/unpacker/nrv_data_tests.cpp
+* @brief Tests for the NRV decompression algorithms.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/unpacker/decompression/nrv/bit_parsers.h"
+#include "retdec/unpacker/decompression/nrv/nrv2b_data.h"
+#include "retdec/unpacker/decompression/nrv/nrv2d_data.h"
+#include "retdec/unpacker/decompression/nrv/nrv2e_data.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace unpacker {
+namespace tests {
+
+class NrvDataTests : public Test
+{
+	protected:
+		std::vector<uint8_t> expectedData()
+		{
+			std::string data = "retdec retdec retdec !";
+			return std::vector<uint8_t>(data.begin(), data.end());
+		}
+};
+
+TEST_F(NrvDataTests,
+Nrv2bWith8BitParserWorks) {
+	BitParser8 bitParser;
+	Nrv2bData data(DynamicBuffer({
+			0xFE, 0x72, 0x65, 0x74, 0x64, 0x65, 0x63, 0x20, 0xC2, 0x06, 0xE0, 0x21,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF
+		}), &bitParser);
+	DynamicBuffer output(22);
+
+	EXPECT_TRUE(data.decompress(output));
+	EXPECT_EQ(expectedData(), output.getBuffer());
+}
+
+TEST_F(NrvDataTests,
+Nrv2bWithLe32BitParserWorks) {
+	BitParserLe32 bitParser;
+	Nrv2bData data(DynamicBuffer({
+			0x00, 0xE0, 0xC2, 0xFE, 0x72, 0x65, 0x74, 0x64, 0x65, 0x63, 0x20, 0x06,
+			0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF
+		}), &bitParser);
+	DynamicBuffer output(22);
+
+	EXPECT_TRUE(data.decompress(output));
+	EXPECT_EQ(expectedData(), output.getBuffer());
+}
+
+TEST_F(NrvDataTests,
+Nrv2dWith8BitParserWorks) {
+	BitParser8 bitParser;
+	Nrv2dData data(DynamicBuffer({
+			0xFE, 0x72, 0x65, 0x74, 0x64, 0x65, 0x63, 0x20, 0xC5, 0x0D, 0xC2, 0x21,
+			0x49, 0x24, 0x92, 0x4A, 0x80, 0xFF
+		}), &bitParser);
+	DynamicBuffer output(22);
+
+	EXPECT_TRUE(data.decompress(output));
+	EXPECT_EQ(expectedData(), output.getBuffer());
+}
+
+TEST_F(NrvDataTests,
+Nrv2dWithLe32BitParserWorks) {
+	BitParserLe32 bitParser;
+	Nrv2dData data(DynamicBuffer({
+			0x49, 0xC2, 0xC5, 0xFE, 0x72, 0x65, 0x74, 0x64, 0x65, 0x63, 0x20, 0x0D,
+			0x21, 0x80, 0x4A, 0x92, 0x24, 0xFF
+		}), &bitParser);
+	DynamicBuffer output(22);
+
+	EXPECT_TRUE(data.decompress(output));
+	EXPECT_EQ(expectedData(), output.getBuffer());
+}
+
+TEST_F(NrvDataTests,
+Nrv2eWith8BitParserWorks) {
+	BitParser8 bitParser;
+	Nrv2eData data(DynamicBuffer({
+			0xFE, 0x72, 0x65, 0x74, 0x64, 0x65, 0x63, 0x20, 0xC4, 0x0D, 0xC2, 0x21,
+			0x49, 0x24, 0x92, 0x4A, 0x80, 0xFF
+		}), &bitParser);
+	DynamicBuffer output(22);
+
+	EXPECT_TRUE(data.decompress(output));
+	EXPECT_EQ(expectedData(), output.getBuffer());
+}
+
+TEST_F(NrvDataTests,
+Nrv2eWithLe32BitParserWorks) {
+	BitParserLe32 bitParser;
+	Nrv2eData data(DynamicBuffer({
+			0x49, 0xC2, 0xC4, 0xFE, 0x72, 0x65, 0x74, 0x64, 0x65, 0x63, 0x20, 0x0D,
+			0x21, 0x80, 0x4A, 0x92, 0x24, 0xFF
+		}), &bitParser);
+	DynamicBuffer output(22);
+
+	EXPECT_TRUE(data.decompress(output));
+	EXPECT_EQ(expectedData(), output.getBuffer());
+}
+
+TEST_F(NrvDataTests,
+DecompressionIntoSmallBufferFails) {
+	BitParser8 bitParser;
+	Nrv2bData data(DynamicBuffer({
+			0xFE, 0x72, 0x65, 0x74, 0x64, 0x65, 0x63, 0x20, 0xC2, 0x06, 0xE0, 0x21,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF
+		}), &bitParser);
+	DynamicBuffer output(10);
+
+	EXPECT_FALSE(data.decompress(output));
+	EXPECT_EQ(10, output.getCapacity());
+	EXPECT_EQ(10, output.getRealDataSize());
+	EXPECT_EQ(std::vector<uint8_t>({ 'r', 'e', 't', 'd', 'e', 'c', ' ', 'r', 'e', 't' }), output.getBuffer());
+}
+
+TEST_F(NrvDataTests,
+DecompressionOfTruncatedDataFails) {
+	BitParser8 bitParser;
+	Nrv2bData data(DynamicBuffer({
+			0xFE, 0x72, 0x65, 0x74, 0x64, 0x65, 0x63, 0x20, 0xC2, 0x06
+		}), &bitParser);
+	DynamicBuffer output(22);
+
+	EXPECT_FALSE(data.decompress(output));
+	EXPECT_EQ(22, output.getCapacity());
+	EXPECT_EQ(7, output.getRealDataSize());
+}
+
+} // namespace tests
+} // namespace unpacker
+} // namespace retdec
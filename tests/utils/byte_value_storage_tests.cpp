@@ -615,6 +615,30 @@ Get8ByteArrayWorks) {
 	EXPECT_EQ(expected, loaded);
 }
 
+TEST_F(ByteValueStorageTests,
+GetValueReadsNumberOfBytesGivenByType) {
+	MockByteValueStorage storage;
+
+	EXPECT_CALL(storage, getXByte(0x1000, 4, _, Endianness::BIG))
+		.WillOnce(DoAll(SetArgReferee<2>(0xFFFFFFFE), Return(true)));
+
+	std::int32_t value = 0;
+	EXPECT_TRUE(storage.getValue(0x1000, value, Endianness::BIG));
+	EXPECT_EQ(-2, value);
+}
+
+TEST_F(ByteValueStorageTests,
+GetValueFailsIfBytesCannotBeRead) {
+	MockByteValueStorage storage;
+
+	EXPECT_CALL(storage, getXByte(0x1000, 2, _, Endianness::UNKNOWN))
+		.WillOnce(Return(false));
+
+	std::uint16_t value = 7;
+	EXPECT_FALSE(storage.getValue(0x1000, value));
+	EXPECT_EQ(7, value);
+}
+
 } // namespace tests
 } // namespace utils
 } // namespace retdec
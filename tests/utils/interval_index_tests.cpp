@@ -0,0 +1,125 @@
+/**
+* @file tests/utils/interval_index_tests.cpp
+* @brief Tests for the @c interval_index module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/interval_index.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+
+namespace tests {
+
+/**
+ * @brief Tests for the @c IntervalIndex class.
+ */
+class IntervalIndexTests: public Test
+{
+	protected:
+		using Index = IntervalIndex<const char*>;
+
+		static bool noPreference(const Index::Interval&, const Index::Interval&)
+		{
+			return false;
+		}
+};
+
+TEST_F(IntervalIndexTests, EmptyIndexFindsNothing)
+{
+	Index index;
+
+	EXPECT_TRUE(index.empty());
+	EXPECT_EQ(nullptr, index.find(0));
+	EXPECT_EQ(nullptr, index.find(0x1000));
+}
+
+TEST_F(IntervalIndexTests, DisjointIntervalsAreFound)
+{
+	Index index;
+	index.build({{0x1000, 0x1FFF, "a"}, {0x3000, 0x3FFF, "b"}}, noPreference);
+
+	EXPECT_FALSE(index.empty());
+	EXPECT_EQ(nullptr, index.find(0xFFF));
+	EXPECT_STREQ("a", index.find(0x1000));
+	EXPECT_STREQ("a", index.find(0x1FFF));
+	EXPECT_EQ(nullptr, index.find(0x2000));
+	EXPECT_STREQ("b", index.find(0x3000));
+	EXPECT_STREQ("b", index.find(0x3FFF));
+	EXPECT_EQ(nullptr, index.find(0x4000));
+}
+
+TEST_F(IntervalIndexTests, FirstAddedIntervalWinsWithoutPreference)
+{
+	Index index;
+	index.build({{0x2000, 0x2FFF, "b"}, {0x1000, 0x3FFF, "a"}}, noPreference);
+
+	EXPECT_STREQ("a", index.find(0x1000));
+	EXPECT_STREQ("b", index.find(0x2000));
+	EXPECT_STREQ("b", index.find(0x2FFF));
+	EXPECT_STREQ("a", index.find(0x3000));
+}
+
+TEST_F(IntervalIndexTests, PreferredIntervalWinsInOverlap)
+{
+	Index index;
+	index.build({{0x1000, 0x3FFF, "a"}, {0x2000, 0x2FFF, "b"}},
+			[](const Index::Interval& i1, const Index::Interval& i2)
+			{
+				return i1.first > i2.first;
+			});
+
+	EXPECT_STREQ("a", index.find(0x1FFF));
+	EXPECT_STREQ("b", index.find(0x2000));
+	EXPECT_STREQ("a", index.find(0x3000));
+}
+
+TEST_F(IntervalIndexTests, InvalidIntervalsAreIgnored)
+{
+	Index index;
+	index.build({{0x2000, 0x1000, "a"}}, noPreference);
+
+	EXPECT_TRUE(index.empty());
+	EXPECT_EQ(nullptr, index.find(0x1800));
+}
+
+TEST_F(IntervalIndexTests, IntervalCanEndAtHighestAddress)
+{
+	const auto max = std::numeric_limits<std::uint64_t>::max();
+	Index index;
+	index.build({{max - 0xF, max, "a"}}, noPreference);
+
+	EXPECT_EQ(nullptr, index.find(max - 0x10));
+	EXPECT_STREQ("a", index.find(max - 0xF));
+	EXPECT_STREQ("a", index.find(max));
+}
+
+TEST_F(IntervalIndexTests, RebuildDropsPreviousIntervals)
+{
+	Index index;
+	index.build({{0x1000, 0x1FFF, "a"}}, noPreference);
+	index.build({{0x3000, 0x3FFF, "b"}}, noPreference);
+
+	EXPECT_EQ(nullptr, index.find(0x1000));
+	EXPECT_STREQ("b", index.find(0x3000));
+}
+
+TEST_F(IntervalIndexTests, ClearDropsAllIntervals)
+{
+	Index index;
+	index.build({{0x1000, 0x1FFF, "a"}}, noPreference);
+	index.clear();
+
+	EXPECT_TRUE(index.empty());
+	EXPECT_EQ(nullptr, index.find(0x1000));
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec
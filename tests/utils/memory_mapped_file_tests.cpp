@@ -0,0 +1,99 @@
+/**
+* @file tests/utils/memory_mapped_file_tests.cpp
+* @brief Tests for the @c memory_mapped_file module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/binary_path.h"
+#include "retdec/utils/memory_mapped_file.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c memory_mapped_file module.
+*/
+class MemoryMappedFileTests: public Test {
+protected:
+	std::vector<std::uint8_t> readWholeFile(const std::string& path) {
+		std::ifstream file(path, std::ios::binary);
+		return std::vector<std::uint8_t>(
+			std::istreambuf_iterator<char>(file),
+			std::istreambuf_iterator<char>()
+		);
+	}
+};
+
+TEST_F(MemoryMappedFileTests,
+DefaultConstructedFileIsNotOpen) {
+	MemoryMappedFile file;
+
+	EXPECT_FALSE(file.isOpen());
+	EXPECT_EQ(nullptr, file.getData());
+	EXPECT_EQ(0, file.getSize());
+}
+
+TEST_F(MemoryMappedFileTests,
+MappingNonExistingFileFails) {
+	MemoryMappedFile file;
+
+	EXPECT_FALSE(file.open("this-file-does-not-exist.bin"));
+	EXPECT_FALSE(file.isOpen());
+}
+
+TEST_F(MemoryMappedFileTests,
+MappingDirectoryFails) {
+	MemoryMappedFile file(getThisBinaryDirectoryPath().getPath());
+
+	EXPECT_FALSE(file.isOpen());
+}
+
+TEST_F(MemoryMappedFileTests,
+MappedContentIsSameAsContentReadFromFile) {
+	auto path = getThisBinaryPath().getPath();
+	auto expected = readWholeFile(path);
+
+	MemoryMappedFile file(path);
+
+	ASSERT_TRUE(file.isOpen());
+	ASSERT_EQ(expected.size(), file.getSize());
+	EXPECT_TRUE(std::equal(expected.begin(), expected.end(), file.getData()));
+}
+
+TEST_F(MemoryMappedFileTests,
+MoveTransfersMapping) {
+	MemoryMappedFile file(getThisBinaryPath().getPath());
+	auto* data = file.getData();
+	auto size = file.getSize();
+
+	MemoryMappedFile other(std::move(file));
+
+	EXPECT_FALSE(file.isOpen());
+	EXPECT_TRUE(other.isOpen());
+	EXPECT_EQ(data, other.getData());
+	EXPECT_EQ(size, other.getSize());
+}
+
+TEST_F(MemoryMappedFileTests,
+CloseUnmapsFile) {
+	MemoryMappedFile file(getThisBinaryPath().getPath());
+
+	file.close();
+
+	EXPECT_FALSE(file.isOpen());
+	EXPECT_EQ(nullptr, file.getData());
+	EXPECT_EQ(0, file.getSize());
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec
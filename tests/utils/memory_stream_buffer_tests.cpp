@@ -0,0 +1,100 @@
+/**
+* @file tests/utils/memory_stream_buffer_tests.cpp
+* @brief Tests for the @c memory_stream_buffer module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <istream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/memory_stream_buffer.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c memory_stream_buffer module.
+*/
+class MemoryStreamBufferTests: public Test {
+protected:
+	MemoryStreamBufferTests():
+		data(reinterpret_cast<const std::uint8_t*>("0123456789")),
+		buffer(data, 10), stream(&buffer) {}
+
+	const std::uint8_t* data;
+	MemoryStreamBuffer buffer;
+	std::istream stream;
+};
+
+TEST_F(MemoryStreamBufferTests,
+StreamReadsAllBytes) {
+	std::string content;
+	stream >> content;
+
+	EXPECT_EQ("0123456789", content);
+	EXPECT_TRUE(stream.eof());
+}
+
+TEST_F(MemoryStreamBufferTests,
+SeekFromBeginningWorks) {
+	char c = 0;
+	stream.seekg(3);
+	stream.get(c);
+
+	EXPECT_EQ('3', c);
+	EXPECT_EQ(4, stream.tellg());
+}
+
+TEST_F(MemoryStreamBufferTests,
+SeekFromCurrentPositionAndEndWorks) {
+	char c = 0;
+	stream.seekg(2);
+	stream.seekg(5, std::ios_base::cur);
+	stream.get(c);
+	EXPECT_EQ('7', c);
+
+	stream.seekg(-1, std::ios_base::end);
+	stream.get(c);
+	EXPECT_EQ('9', c);
+
+	stream.seekg(0, std::ios_base::end);
+	EXPECT_EQ(10, stream.tellg());
+}
+
+TEST_F(MemoryStreamBufferTests,
+SeekOutsideOfDataFails) {
+	stream.seekg(11);
+
+	EXPECT_TRUE(stream.fail());
+}
+
+TEST_F(MemoryStreamBufferTests,
+ReadingPastEndReadsOnlyAvailableBytes) {
+	char bytes[20] = {};
+	stream.seekg(8);
+	stream.read(bytes, sizeof(bytes));
+
+	EXPECT_EQ(2, stream.gcount());
+	EXPECT_EQ(std::string("89"), std::string(bytes, 2));
+	EXPECT_TRUE(stream.eof());
+}
+
+TEST_F(MemoryStreamBufferTests,
+EmptyBufferCanBeRead) {
+	MemoryStreamBuffer empty(nullptr, 0);
+	std::istream emptyStream(&empty);
+
+	EXPECT_EQ(std::istream::traits_type::eof(), emptyStream.get());
+	emptyStream.clear();
+	emptyStream.seekg(0);
+	EXPECT_FALSE(emptyStream.fail());
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec
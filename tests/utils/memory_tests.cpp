@@ -57,6 +57,13 @@ LimitSystemMemoryReturnsFalseWhenLimitIsZero) {
 	ASSERT_FALSE(limitSystemMemory(0));
 }
 
+TEST_F(MemoryTests,
+GetPeakMemoryUsageReturnsNonZeroSize) {
+	auto size = getPeakMemoryUsage();
+
+	ASSERT_GT(size, 0);
+}
+
 #ifdef OS_WINDOWS
 TEST_F(MemoryTests,
 LimitSystemMemoryReturnsFalseOnWindowsWhenLimitIsBelowPageSize) {
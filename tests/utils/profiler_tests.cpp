@@ -0,0 +1,127 @@
+/**
+* @file tests/utils/profiler_tests.cpp
+* @brief Tests for the @c profiler module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/profiler.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c profiler module.
+*/
+class ProfilerTests: public Test {};
+
+TEST_F(ProfilerTests,
+NoRecordsAfterCreation) {
+	Profiler profiler;
+
+	ASSERT_TRUE(profiler.getRecords().empty());
+	ASSERT_FALSE(profiler.isRunning());
+}
+
+TEST_F(ProfilerTests,
+RecordsAreStoredInOrderOfStartsWithNestingLevel) {
+	Profiler profiler;
+
+	profiler.start("outer");
+	profiler.start("inner");
+	profiler.stop();
+	profiler.stop();
+	profiler.start("next");
+	profiler.stop();
+
+	const auto &records = profiler.getRecords();
+	ASSERT_EQ(3, records.size());
+	EXPECT_EQ("outer", records[0].name);
+	EXPECT_EQ(0, records[0].level);
+	EXPECT_EQ("inner", records[1].name);
+	EXPECT_EQ(1, records[1].level);
+	EXPECT_EQ("next", records[2].name);
+	EXPECT_EQ(0, records[2].level);
+	EXPECT_FALSE(profiler.isRunning());
+}
+
+TEST_F(ProfilerTests,
+SizesBeforeAndAfterAreStored) {
+	Profiler profiler;
+
+	profiler.start("phase", {{"functions", 3}});
+	profiler.stop({{"functions", 2}});
+
+	const auto &r = profiler.getRecords().front();
+	ASSERT_EQ(1, r.sizesBefore.size());
+	EXPECT_EQ("functions", r.sizesBefore[0].first);
+	EXPECT_EQ(3, r.sizesBefore[0].second);
+	ASSERT_EQ(1, r.sizesAfter.size());
+	EXPECT_EQ(2, r.sizesAfter[0].second);
+}
+
+TEST_F(ProfilerTests,
+AllocationsInPhaseAreCounted) {
+	Profiler profiler;
+	std::vector<std::unique_ptr<int>> ints;
+
+	profiler.start("phase");
+	for (int i = 0; i < 10; ++i) {
+		ints.push_back(std::make_unique<int>(i));
+	}
+	profiler.stop();
+
+	ASSERT_EQ(10, ints.size());
+	ASSERT_LE(10, profiler.getRecords().front().allocations);
+}
+
+TEST_F(ProfilerTests,
+AllocationCountingIsEnabledByLinkedHook) {
+	// Tests are linked with retdec-utils-allocation-hook.
+	Profiler profiler;
+	profiler.start("phase");
+	profiler.stop();
+	std::stringstream out;
+
+	profiler.writeJson(out);
+
+	ASSERT_TRUE(Profiler::isCountingAllocations());
+	EXPECT_NE(std::string::npos, out.str().find("\"allocations\": "));
+}
+
+TEST_F(ProfilerTests,
+StopWithoutStartDoesNothing) {
+	Profiler profiler;
+
+	profiler.stop();
+
+	ASSERT_TRUE(profiler.getRecords().empty());
+}
+
+TEST_F(ProfilerTests,
+WriteJsonEscapesNames) {
+	Profiler profiler;
+	profiler.start("a \"quoted\" name", {{"functions", 1}});
+	profiler.stop();
+	std::stringstream out;
+
+	profiler.writeJson(out);
+
+	EXPECT_NE(std::string::npos,
+		out.str().find("\"name\": \"a \\\"quoted\\\" name\""));
+	EXPECT_NE(std::string::npos,
+		out.str().find("\"before\": { \"functions\": 1 }"));
+	EXPECT_NE(std::string::npos, out.str().find("\"after\": {}"));
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec
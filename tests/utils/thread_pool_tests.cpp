@@ -0,0 +1,88 @@
+/**
+* @file tests/utils/thread_pool_tests.cpp
+* @brief Tests for the @c thread_pool module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/thread_pool.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c thread_pool module.
+*/
+class ThreadPoolTests: public Test {};
+
+TEST_F(ThreadPoolTests,
+DefaultThreadCountIsAtLeastOne) {
+	ThreadPool pool;
+
+	ASSERT_LE(1, pool.getThreadCount());
+}
+
+TEST_F(ThreadPoolTests,
+ParallelForRunsEveryTaskExactlyOnce) {
+	ThreadPool pool(4);
+	std::vector<std::atomic<int>> runs(1000);
+
+	pool.parallelFor(runs.size(), [&](std::size_t i) { ++runs[i]; });
+
+	for (auto& r : runs) {
+		ASSERT_EQ(1, r);
+	}
+}
+
+TEST_F(ThreadPoolTests,
+PoolCanRunMoreBatches) {
+	ThreadPool pool(3);
+	std::atomic<std::size_t> sum(0);
+
+	for (std::size_t n = 0; n < 50; ++n) {
+		pool.parallelFor(n, [&](std::size_t i) { sum += i; });
+	}
+
+	ASSERT_EQ(19600, sum);
+}
+
+TEST_F(ThreadPoolTests,
+NestedParallelForRunsInCallingThread) {
+	ThreadPool pool(4);
+	std::atomic<int> runs(0);
+
+	pool.parallelFor(8, [&](std::size_t) {
+		pool.parallelFor(8, [&](std::size_t) { ++runs; });
+	});
+
+	ASSERT_EQ(64, runs);
+}
+
+TEST_F(ThreadPoolTests,
+ExceptionFromTaskIsRethrownAfterAllTasksFinish) {
+	ThreadPool pool(4);
+	std::atomic<int> runs(0);
+
+	ASSERT_THROW(
+		pool.parallelFor(100, [&](std::size_t i) {
+			++runs;
+			if (i == 42) {
+				throw std::runtime_error("task failed");
+			}
+		}),
+		std::runtime_error
+	);
+	ASSERT_EQ(100, runs);
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec
@@ -4,9 +4,12 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <atomic>
 #include <cstdlib>
 #include <ctime>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -84,6 +87,37 @@ CorrectTimestampToDateConversion) {
 	EXPECT_EQ("2015-08-05 14:25:19", timestampToDate(std::time_t(1438784719)));
 }
 
+TEST_F(TimeTests,
+TimestampToDateConversionIsThreadSafe) {
+	// Every thread converts its own timestamp many times. With a buffer
+	// shared by all threads, some conversions would return dates of other
+	// threads.
+	const std::time_t timestamps[] = {0, 1438784719, 2000000000, 86399};
+	const std::string dates[] = {
+		"1970-01-01 00:00:00",
+		"2015-08-05 14:25:19",
+		"2033-05-18 03:33:20",
+		"1970-01-01 23:59:59"
+	};
+
+	std::atomic<bool> ok(true);
+	std::vector<std::thread> threads;
+	for (std::size_t i = 0; i < 4; ++i) {
+		threads.emplace_back([&, i]() {
+			for (int j = 0; j < 10000; ++j) {
+				if (timestampToDate(timestamps[i]) != dates[i]) {
+					ok = false;
+				}
+			}
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+
+	EXPECT_TRUE(ok);
+}
+
 } // namespace tests
 } // namespace utils
 } // namespace retdec
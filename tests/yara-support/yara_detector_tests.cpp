@@ -0,0 +1,137 @@
+/**
+* @file tests/yara-support/yara_detector_tests.cpp
+* @brief Tests for the @c yara_detector and @c rules_cache modules.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/binary_path.h"
+#include "retdec/yara-support/rules_cache.h"
+#include "retdec/yara-support/yara_detector.h"
+
+using namespace ::testing;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace yara_support {
+namespace tests {
+
+/**
+* @brief Tests for the @c yara_detector and @c rules_cache modules.
+*/
+class YaraDetectorTests: public Test {
+protected:
+	void SetUp() override {
+		std::ostringstream rules;
+		rules << "rule hello\n"
+			<< "{\n"
+			<< "\tmeta:\n"
+			<< "\t\tname = \"greeting\"\n"
+			<< "\t\tsize = 5\n"
+			<< "\tstrings:\n"
+			<< "\t\t$s = \"hello\"\n"
+			<< "\tcondition:\n"
+			<< "\t\t$s\n"
+			<< "}\n"
+			<< "rule bye\n"
+			<< "{\n"
+			<< "\tstrings:\n"
+			<< "\t\t$s = \"bye\"\n"
+			<< "\tcondition:\n"
+			<< "\t\t$s\n"
+			<< "}\n";
+		rulesPath = writeRuleFile("yara_detector_tests.yar", rules.str());
+	}
+
+	void TearDown() override {
+		RulesCache::getInstance().clear();
+		std::remove(rulesPath.c_str());
+	}
+
+	std::string writeRuleFile(const std::string &name, const std::string &rules) {
+		auto path = getThisBinaryDirectoryPath();
+		path.append(name);
+		std::ofstream(path.getPath()) << rules;
+		return path.getPath();
+	}
+
+	std::string rulesPath;
+};
+
+TEST_F(YaraDetectorTests,
+RulesFromSameFileAreCompiledOnlyOnce) {
+	auto first = RulesCache::getInstance().getRules(rulesPath);
+	auto second = RulesCache::getInstance().getRules(rulesPath);
+
+	ASSERT_NE(nullptr, first);
+	EXPECT_EQ(first, second);
+}
+
+TEST_F(YaraDetectorTests,
+NonExistingRuleFileIsNotLoaded) {
+	YaraDetector yara;
+
+	EXPECT_FALSE(yara.addRuleFile("this-file-does-not-exist.yar"));
+}
+
+TEST_F(YaraDetectorTests,
+MemoryBufferIsScannedWithRulesFromFile) {
+	const std::string data = "say hello";
+	YaraDetector yara;
+	ASSERT_TRUE(yara.addRuleFile(rulesPath));
+
+	ASSERT_TRUE(yara.analyze(reinterpret_cast<const std::uint8_t*>(data.data()), data.size()));
+
+	ASSERT_EQ(1, yara.getDetectedRules().size());
+	EXPECT_TRUE(yara.getUndetectedRules().empty());
+	const auto &rule = yara.getDetectedRules()[0];
+	EXPECT_EQ("hello", rule.getName());
+	ASSERT_NE(nullptr, rule.getMeta("name"));
+	EXPECT_EQ("greeting", rule.getMeta("name")->getStringValue());
+	ASSERT_NE(nullptr, rule.getMeta("size"));
+	EXPECT_EQ(5, rule.getMeta("size")->getIntValue());
+	ASSERT_NE(nullptr, rule.getFirstMatch());
+	EXPECT_EQ(4, rule.getFirstMatch()->getOffset());
+	EXPECT_EQ(5, rule.getFirstMatch()->getDataSize());
+}
+
+TEST_F(YaraDetectorTests,
+UndetectedRulesAreStoredOnlyWhenRequested) {
+	const std::string data = "say hello";
+	YaraDetector yara;
+	ASSERT_TRUE(yara.addRuleFile(rulesPath));
+
+	ASSERT_TRUE(yara.analyze(reinterpret_cast<const std::uint8_t*>(data.data()), data.size(), true));
+
+	ASSERT_EQ(1, yara.getUndetectedRules().size());
+	EXPECT_EQ("bye", yara.getUndetectedRules()[0].getName());
+}
+
+TEST_F(YaraDetectorTests,
+RulesFromSeveralFilesAreScannedTogetherAndKeepTheirNamespaces) {
+	const std::string data = "say hello";
+	const auto otherPath = writeRuleFile("yara_detector_tests_other.yar",
+		"rule hello { strings: $s = \"say\" condition: $s }\n");
+	YaraDetector yara;
+	ASSERT_TRUE(yara.addRuleFile(rulesPath, "first"));
+	ASSERT_TRUE(yara.addRuleFile(otherPath, "second"));
+
+	ASSERT_TRUE(yara.analyze(reinterpret_cast<const std::uint8_t*>(data.data()), data.size()));
+	std::remove(otherPath.c_str());
+
+	ASSERT_EQ(2, yara.getDetectedRules().size());
+	EXPECT_EQ("first", yara.getDetectedRules()[0].getNamespace());
+	EXPECT_EQ(4, yara.getDetectedRules()[0].getFirstMatch()->getOffset());
+	EXPECT_EQ("second", yara.getDetectedRules()[1].getNamespace());
+	EXPECT_EQ(0, yara.getDetectedRules()[1].getFirstMatch()->getOffset());
+}
+
+} // namespace tests
+} // namespace yara_support
+} // namespace retdec